@@ -1,13 +1,197 @@
-// #include <shaderc/shaderc.hpp>
+// Offline shader compiler: brings Engine/Intermediate/Shader up to date so the
+// runtime only reads cached SPIR-V at startup.
+//
+//   ShaderCompiler [--root <repo>] [--manifest <file>]... [--jobs N] [--force] [--no-scan]
+//
+// Compiles every stand-alone shader under the GLSL / Slang roots plus the
+// permutations listed in the manifests (by default the one the runtime
+// records, Engine/Intermediate/Shader/Permutations.txt). Unchanged shaders are
+// skipped; see ShaderBatchCompiler for the dependency tracking.
 
-// TODO: shaders should be compiled before engine build
-//        or can be rebuild and load at runtimes?
+#include "Core/Async/JobSystem.h"
+#include "Core/Log.h"
+#include "RHI/Shader.h"
+#include "RHI/Shader/ShaderBatchCompiler.h"
+#include "RHI/Shader/ShaderInternal.h"
 
-#include "slang/slang.h"
+#include <cxxopts.hpp>
 
-int main(int argc, char **argv)
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr const char* GLSL_SHADER_ROOT  = "Engine/Shader/GLSL";
+constexpr const char* SLANG_SHADER_ROOT = "Engine/Shader/Slang";
+constexpr const char* GLSL_CACHE_ROOT   = "Engine/Intermediate/Shader/GLSL";
+constexpr const char* SLANG_CACHE_ROOT  = "Engine/Intermediate/Shader/Slang";
+constexpr const char* DEFAULT_MANIFEST  = "Engine/Intermediate/Shader/Permutations.txt";
+
+/// Same processor setup as RenderRuntime::initShaderSystems, so cache paths match.
+std::shared_ptr<ya::ShaderStorage> createShaderStorage()
+{
+    auto storage = std::make_shared<ya::ShaderStorage>(ya::ShaderProcessorFactory()
+                                                           .withProcessorType(ya::ShaderProcessorFactory::EProcessorType::GLSL)
+                                                           .withShaderStoragePath(GLSL_SHADER_ROOT)
+                                                           .withCachedStoragePath(GLSL_CACHE_ROOT)
+                                                           .FactoryNew<ya::GLSLProcessor>());
+    storage->setSlangProcessor(ya::ShaderProcessorFactory()
+                                   .withProcessorType(ya::ShaderProcessorFactory::EProcessorType::Slang)
+                                   .withShaderStoragePath(SLANG_SHADER_ROOT)
+                                   .withCachedStoragePath(SLANG_CACHE_ROOT)
+                                   .FactoryNew<ya::SlangProcessor>());
+    return storage;
+}
+
+bool isGeneratedPath(const std::filesystem::path& relative)
+{
+    for (const auto& part : relative) {
+        if (part == "Generated") {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Stand-alone shaders only: include / import-only files have no stage
+/// markers (GLSL) or entry points (Slang) and cannot be compiled alone.
+bool isStandaloneShader(const std::filesystem::path& file, const std::string& source)
+{
+    if (file.extension() == ".glsl") {
+        return source.find("#type") != std::string::npos || source.find("SHADER_STAGE_") != std::string::npos;
+    }
+
+    const auto stem = file.stem().string();
+    if (stem.ends_with(".comp")) {
+        return source.find("compMain") != std::string::npos;
+    }
+    if (stem.ends_with(".task") || stem.ends_with(".mesh")) {
+        return source.find("taskMain") != std::string::npos || source.find("meshMain") != std::string::npos;
+    }
+    // SingleShader mode requires both graphics entry points otherwise.
+    return source.find("vertMain") != std::string::npos && source.find("fragMain") != std::string::npos;
+}
+
+void scanShaderRoot(const std::filesystem::path& root, std::string_view extension, std::vector<ya::ShaderDesc>& outShaders)
+{
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(root, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file() || it->path().extension().string() != extension) {
+            continue;
+        }
+        const auto relative = it->path().lexically_relative(root);
+        if (isGeneratedPath(relative)) {
+            continue;
+        }
+
+        std::string source;
+        if (!ya::shader_internal::readShaderTextFile(it->path().generic_string(), source) || !isStandaloneShader(it->path(), source)) {
+            continue;
+        }
+        outShaders.push_back(ya::ShaderDesc{.shaderName = relative.generic_string()});
+    }
+}
+
+const char* statusName(ya::EShaderBatchStatus status)
+{
+    switch (status) {
+    case ya::EShaderBatchStatus::UpToDate:
+        return "up-to-date";
+    case ya::EShaderBatchStatus::Compiled:
+        return "compiled";
+    case ya::EShaderBatchStatus::Failed:
+        return "FAILED";
+    }
+    return "?";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
 {
+    Logger::init();
+
+    cxxopts::Options options("ShaderCompiler", "Compile engine shaders into the SPIR-V disk cache");
+    options.add_options()
+        ("root", "Repository root the Engine/ paths are relative to", cxxopts::value<std::string>()->default_value("."))
+        ("manifest", "Permutation manifest(s); default: the runtime-recorded one", cxxopts::value<std::vector<std::string>>())
+        ("j,jobs", "Compile threads including this one, 0 = all cores", cxxopts::value<uint32_t>()->default_value("0"))
+        ("f,force", "Recompile even if the cache is current")
+        ("no-scan", "Only compile the manifest permutations")
+        ("v,verbose", "Print every shader, not only rebuilt or failed ones")
+        ("h,help", "Print usage");
+
+    std::vector<ya::ShaderDesc> shaders;
+    bool                        bVerbose = false;
+    ya::ShaderBatchOptions      batchOptions;
+    uint32_t                    jobs = 0;
+    try {
+        const auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::printf("%s\n", options.help().c_str());
+            return 0;
+        }
+        std::filesystem::current_path(result["root"].as<std::string>());
+
+        bVerbose            = result.count("verbose") > 0;
+        batchOptions.bForce = result.count("force") > 0;
+        jobs                = result["jobs"].as<uint32_t>();
+
+        if (!result.count("no-scan")) {
+            scanShaderRoot(GLSL_SHADER_ROOT, ".glsl", shaders);
+            scanShaderRoot(SLANG_SHADER_ROOT, ".slang", shaders);
+        }
+
+        if (result.count("manifest")) {
+            for (const auto& manifest : result["manifest"].as<std::vector<std::string>>()) {
+                if (!ya::loadShaderManifest(manifest, shaders)) {
+                    std::fprintf(stderr, "Cannot read manifest %s\n", manifest.c_str());
+                    return 2;
+                }
+            }
+        }
+        else {
+            // Absent until the runtime ran once; the scan still covers the base shaders.
+            ya::loadShaderManifest(DEFAULT_MANIFEST, shaders);
+        }
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n%s\n", e.what(), options.help().c_str());
+        return 2;
+    }
+
+    // --jobs counts this thread too; JobSystem::start takes the worker count.
+    auto& jobSystem      = ya::JobSystem::get();
+    batchOptions.bSerial = jobs == 1;
+    if (!batchOptions.bSerial) {
+        jobSystem.start(jobs > 0 ? jobs - 1 : 0);
+    }
+    const uint32_t threads = batchOptions.bSerial ? 1u : jobSystem.getConcurrency();
+
+    const auto storage = createShaderStorage();
+    const auto report  = ya::ShaderBatchCompiler(*storage).compile(shaders, batchOptions);
+    jobSystem.stop();
 
+    for (const auto& item : report.items) {
+        if (bVerbose || item.status != ya::EShaderBatchStatus::UpToDate) {
+            std::printf("%-10s %7.1f ms  %3u deps  %s\n",
+                        statusName(item.status),
+                        item.seconds * 1000.0,
+                        item.dependencyCount,
+                        item.cacheKey.c_str());
+        }
+    }
+    std::printf("%zu shaders: %u compiled, %u up to date, %u failed in %.2f s on %u threads\n",
+                report.items.size(),
+                report.compiled,
+                report.upToDate,
+                report.failed,
+                report.seconds,
+                threads);
 
-    return 0;
-}
\ No newline at end of file
+    return report.succeeded() ? 0 : 1;
+}
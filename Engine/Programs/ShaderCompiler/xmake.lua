@@ -1,19 +1,11 @@
 
--- add_requires("")
-add_requires("vulkansdk", {
-    configs = {
-        utils = {
-            -- "VkLayer_khronos_validation", -- import layer
-            is_mode("debug") and "slangd" or "slang"
-        }
-    }
-})
-
+-- Offline shader compiler: fills Engine/Intermediate/Shader with the SPIR-V
+-- disk cache the runtime loads. Run from the repository root (or pass --root).
 target("ShaderCompiler")
 do
     set_kind("binary")
     add_files("Source/**.cpp")
 
-    add_packages("vulkansdk")
+    add_deps("ya-rhi")
 
-end
\ No newline at end of file
+end
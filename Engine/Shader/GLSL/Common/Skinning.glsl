@@ -7,13 +7,14 @@
 #endif
 
 #if ENABLE_SKINNING
+// Palettes are packed back to back; paletteIndex is the first matrix of one.
 layout(set = SKINNING_SET_INDEX, binding = 0, std430) readonly buffer SkinningPaletteBuffer {
-    mat4 uSkinningPalettes[];
+    mat4 uSkinningBoneMatrices[];
 };
 
 mat4 getSkinningBoneMatrix(int paletteIndex, int boneIndex)
 {
-    return uSkinningPalettes[paletteIndex * MAX_BONE_COUNT + boneIndex];
+    return uSkinningBoneMatrices[paletteIndex + boneIndex];
 }
 
 void applySkinning(in int paletteIndex,
@@ -286,6 +286,7 @@ void renderDeferredPerformanceContent(DeferredRenderPipeline& pipeline)
     const float automationMs      = cpu(perf::sample::frameAutomation());
     const float unaccountedMs     = cpu(perf::sample::frameUnaccounted());
     const float extractMs         = cpu(perf::sample::renderExtract());
+    const float cullMs            = cpu(perf::sample::renderCull());
     const float runtimeMs         = cpu(perf::sample::renderRuntime());
     const float prepareFrameMs    = cpu(perf::sample::renderPrepareFrame());
     const float waitIdleMs        = cpu(perf::sample::renderWaitIdle());
@@ -308,13 +309,17 @@ void renderDeferredPerformanceContent(DeferredRenderPipeline& pipeline)
 
     ImGui::Text("CPU frame: %.3f ms", frameCpuMs);
     ImGui::Text("GPU frame: %.3f ms", frameGpuMs);
-    ImGui::Text("Draw items: %u", pipeline._lastDrawCount);
+    ImGui::Text("Draw items: %u (culled %.0f)",
+                pipeline._lastDrawCount,
+                metric(perf::sample::renderCull(), perf::metric::culledCount()));
     ImGui::Text("Point lights: %u", pipeline._lastPointLightCount);
 
     renderPerfTree("Frame Cycle", frameCpuMs, [&]() {
         renderPerfLeaf("Logic", logicMs, frameCpuMs);
         renderPerfTree("Render", renderMs, [&]() {
-            renderPerfLeaf("Extract", extractMs, renderMs);
+            renderPerfTree("Extract", extractMs, [&]() {
+                renderPerfLeaf("Cull", cullMs, extractMs);
+            });
             renderPerfTree("Runtime", runtimeMs, [&]() {
                 renderPerfTree("PrepareFrame", prepareFrameMs, [&]() {
                     renderPerfLeaf("WaitIdle", waitIdleMs, prepareFrameMs);
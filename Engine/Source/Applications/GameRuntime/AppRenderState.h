@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Render3D/RenderFrameData.h"
+#include "Render3D/RenderLodSelection.h"
 #include "Render3D/Common/ShadowSettings.h"
 #include "Render3D/Stage/IRenderStage.h"
 #include "GameRuntime/AppRenderFrameState.h"
@@ -23,6 +24,8 @@ struct AppRenderState
     AppRenderFrameState                                frameState;
     std::optional<AppRenderFrameState>                 extensionFrameState;
     std::array<RenderFrameData, MAX_FLIGHTS_IN_FLIGHT> frameDataPerFlight{};
+    /// Per-entity LOD hysteresis for the main view; cleared with the scene.
+    LodHistory                                         lodHistory;
 };
 
 } // namespace ya
@@ -7,6 +7,7 @@
 
 #include "Core/Config/ConfigManager.h"
 
+#include "Core/Async/JobSystem.h"
 #include "Core/Async/TaskQueue.h"
 #include "Core/Log.h"
 #include "Core/Profiling/Profiling.h"
@@ -23,6 +24,7 @@
 #include "Core/Scripting/ScriptApiRegistry.h"
 #include "Core/Scripting/ScriptApiAsset.h"
 #include "Render/Adapters/ModelInstantiationSystem.h"
+#include "Render/Adapters/SceneSpatialIndexSystem.h"
 #include "Render3D/Services/GameplayResourceBinding.h"
 #include "Render3D/EnvironmentLighting/EnvironmentLightingProcessor.h"
 #include "Render3D/Services/EnvironmentLightingResultProvider.h"
@@ -36,6 +38,9 @@
 #include "Render3D/Material/MaterialFactory.h"
 
 #include "ECS/Systems/AnimationSystem.h"
+#include "ECS/Component/Mesh/SkinnedMeshComponent.h"
+#include "Resource/Model.h"
+#include "Scene3D/TransformComponent.h"
 
 #include "Scene/Core/Scene.h"
 #include "Scene/Runtime/SceneManager.h"
@@ -43,6 +48,8 @@
 #include "GUI/Host/NativeWindowManager.h"
 #include "Render3D/RenderRuntime.h"
 
+#include <algorithm>
+#include <cmath>
 #include <format>
 #include <csignal>
 #include <filesystem>
@@ -177,7 +184,8 @@ void App::init(AppDesc ci)
         {
             app.getTaskManager().registerFrameTask(std::move(task));
         });
-        TaskQueue::get().start(/*numThreads=*/2);
+        JobSystem::get().start();
+        TaskQueue::get().start();
         profiling::beginRuntimeSession(app._ci);
         if (ConfigManager::get().hasDocument("automation")) {
             AppAutomation::applyRuntimeOverrides(app);
@@ -273,8 +281,55 @@ void App::init(AppDesc ci)
         auto* renderRuntime = app.getRenderServices().getRenderRuntime();
         return !renderRuntime || renderRuntime->isWorldSceneRenderEnabled();
     });
+    // Animation LOD is picked against last frame's camera (systems update
+    // before this frame's render state is resolved).
+    sys4->setLodViewProvider([&app](SkeletonAnimationSystem::LodView& view)
+    {
+        auto* renderRuntime = app.getRenderServices().getRenderRuntime();
+        if (!renderRuntime) {
+            return false;
+        }
+        const Extent2D extent = renderRuntime->getViewportExtent();
+        if (extent.height == 0) {
+            return false;
+        }
+        const auto& frameState = app._renderState->frameState;
+        view.cameraPosition    = frameState.cameraPos;
+        view.viewProjection    = frameState.projection * frameState.view;
+        view.pixelScale        = 0.5f * static_cast<float>(extent.height) * std::abs(frameState.projection[1][1]);
+        view.bOrthographic     = frameState.projection[3][3] == 1.0f;
+        return true;
+    });
+    // Skinned meshes sit on child entities and point back at the model-root
+    // animator; its LOD bounds are the union of their world bounds.
+    sys4->setBoundsProvider([](Scene& scene, SkeletonAnimationSystem::AnimatorBounds& bounds)
+    {
+        scene.getRegistry().view<SkinnedMeshComponent, TransformComponent>().each(
+            [&bounds](SkinnedMeshComponent& mc, TransformComponent& tc) {
+                const Mesh* mesh = mc.getMesh();
+                if (!mc._animator || !mesh || !mesh->boundingBox.isValid()) {
+                    return;
+                }
+                bounds[mc._animator].merge(mesh->boundingBox.transformed(tc.getTransform()));
+            });
+    });
+    SkeletonAnimationSystem::LodSettings animationLod;
+    animationLod.bEnabled        = ConfigManager::get().getOr<bool>("editor", "animation.lod.enabled", animationLod.bEnabled);
+    animationLod.fullPixels      = ConfigManager::get().getOr<float>("editor", "animation.lod.fullPixels", animationLod.fullPixels);
+    animationLod.distantPixels   = ConfigManager::get().getOr<float>("editor", "animation.lod.distantPixels", animationLod.distantPixels);
+    animationLod.reducedInterval = static_cast<uint32_t>(std::max(1, ConfigManager::get().getOr<int>("editor", "animation.lod.reducedInterval", static_cast<int>(animationLod.reducedInterval))));
+    animationLod.distantInterval = static_cast<uint32_t>(std::max(1, ConfigManager::get().getOr<int>("editor", "animation.lod.distantInterval", static_cast<int>(animationLod.distantInterval))));
+    sys4->setLodSettings(animationLod);
     sys4->init();
     app._systems.push_back(sys4);
+    // After transforms (and skinned roots) settle, so the index sees this frame's world bounds.
+    auto sysSpatial = ya::makeShared<SceneSpatialIndexSystem>();
+    sysSpatial->setSceneProvider([&app]() -> Scene*
+    {
+        return app.getSceneServices().getActiveScene();
+    });
+    sysSpatial->init();
+    app._systems.push_back(sysSpatial);
     auto sys5 = ya::makeShared<LinkageFramework>();
     // Light billboard policy is injected here (Host owns the config source);
     // the adapter never reaches Host/Config.
@@ -301,6 +356,8 @@ void App::init(AppDesc ci)
     auto sysPhysics = ya::makeShared<PhysicsSystem>();
     sysPhysics->setSceneManager(app.getSceneServices().getSceneManager());
     sysPhysics->setAppStateChangedSource(&app.onAppStateChanged);
+    sysPhysics->setAsyncStep(ConfigManager::get().getOr<bool>("editor", "physics.asyncStep", sysPhysics->isAsyncStep()));
+    sysPhysics->setInterpolateTransforms(ConfigManager::get().getOr<bool>("editor", "physics.interpolateTransforms", true));
     sysPhysics->init();
     app._systems.push_back(sysPhysics);
     app._deleter.push("Systems", [&app](void*)
@@ -464,6 +521,7 @@ void App::quit()
         app._automationControlService->shutdown();
     }
     TaskQueue::get().stop();
+    JobSystem::get().stop();
     {
         YA_PROFILE_SCOPE_LOG("Inheritance Quit");
         app.onQuit();
@@ -569,6 +627,7 @@ void App::handleSceneDestroy(Scene* scene)
     for (auto& frameData : app._renderState->frameDataPerFlight) {
         frameData.clear();
     }
+    app._renderState->lodHistory.clear();
 
     if (app._renderState->runtime) {
         app._renderState->runtime->resetSkyboxPool();
@@ -584,6 +643,9 @@ void App::handleSceneActivated(Scene* scene)
     }
 
     app.notifyModulesSceneActivated(scene);
+    // Entity ids are per scene; history from the previous one would seed
+    // unrelated entities.
+    app._renderState->lodHistory.clear();
 }
 
 void App::onEnterRuntime()
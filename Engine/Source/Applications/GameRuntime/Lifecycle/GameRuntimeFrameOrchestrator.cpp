@@ -416,6 +416,7 @@ void GameRuntimeFrameOrchestrator::tickRender(App& app, float dt)
                 .frameIndex     = App::_frameIndex,
                 .deltaTime      = dt,
                 .shadowSettings = &app.getRenderServices().getShadowSettings(),
+                .lodHistory     = &app._renderState->lodHistory,
             },
             app._renderState->frameDataPerFlight[flightIndex]);
     }
@@ -291,6 +291,7 @@ nlohmann::json buildRenderStagesJson()
 {
     static const std::array metricDefs = {
         std::pair{perf::sample::renderExtract(), "extractCpuMs"},
+        std::pair{perf::sample::renderCull(), "cullCpuMs"},
         std::pair{perf::sample::renderRuntime(), "runtimeCpuMs"},
         std::pair{perf::sample::renderPrepareFrame(), "prepareFrameCpuMs"},
         std::pair{perf::sample::renderWaitIdle(), "waitIdleCpuMs"},
@@ -313,7 +314,11 @@ nlohmann::json buildRenderStagesJson()
         std::pair{perf::sample::shadowPointFaceSkinned(), "shadowPointFaceSkinnedCpuMs"},
         std::pair{perf::sample::shadowPointDirectDrawStatic(), "shadowPointDirectDrawStaticCpuMs"},
     };
-    return buildCpuMetricMap(metricDefs);
+
+    auto json                = buildCpuMetricMap(metricDefs);
+    json["cullVisibleCount"] = getMetricValue(perf::sample::renderCull(), perf::metric::visibleCount());
+    json["cullCulledCount"]  = getMetricValue(perf::sample::renderCull(), perf::metric::culledCount());
+    return json;
 }
 
 nlohmann::json buildSyncDiagnosticsJson()
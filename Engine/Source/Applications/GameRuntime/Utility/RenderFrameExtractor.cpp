@@ -24,9 +24,15 @@
 #include "ECS/Systems/TransformSystem.h"
 #include "Scene/Core/Scene.h"
 #include "Render3D/Common/Shadow/Common/DirectionalShadowMath.h"
+#include "Render3D/RenderDrawSort.h"
+
+#include "Core/Math/Frustum.h"
+#include "Core/Profiling/PerfKeys.h"
+#include "Core/Profiling/PerfState.h"
 
 #include <algorithm>
 #include <cmath>
+#include <unordered_map>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace ya
@@ -126,6 +132,9 @@ void RenderFrameExtractor::extract(const ExtractInput& input, RenderFrameData& o
         .viewOwner = outFrame.viewOwner,
     };
     extractDrawItems(drawCtx);
+    cullDrawItems(outFrame);
+    markPointShadowCasters(*input.scene, outFrame);
+    selectDrawItemLods(input.lodSettings, input.lodHistory, outFrame);
     sortDrawItems(outFrame.cameraPos, outFrame);
 }
 
@@ -255,15 +264,11 @@ int32_t RenderFrameExtractor::registerSkinningPalette(DrawItemExtractionContext&
         return -1;
     }
 
-    auto& palette = ctx.frameData->skinningPalettes.emplace_back();
-    YA_CORE_ASSERT(pose.boneMatrices.size() <= palette.boneMatrices.size(), "Exceed max bone size");
-    const uint32_t boneCount = pose.boneMatrices.size();
-
-    for (uint32_t boneIndex = 0; boneIndex < boneCount; ++boneIndex) {
-        palette.boneMatrices[boneIndex] = pose.boneMatrices[boneIndex];
-    }
+    // Palettes are packed: only the skeleton's own bones are copied.
+    auto&         boneMatrices = ctx.frameData->skinningBoneMatrices;
+    const int32_t paletteIndex = static_cast<int32_t>(boneMatrices.size());
+    boneMatrices.insert(boneMatrices.end(), pose.boneMatrices.begin(), pose.boneMatrices.end());
 
-    const int32_t paletteIndex = static_cast<int32_t>(ctx.frameData->skinningPalettes.size() - 1);
     ctx.skinningPaletteCache.emplace(skeletonComp, paletteIndex);
     return paletteIndex;
 }
@@ -395,6 +400,203 @@ void RenderFrameExtractor::extractDrawItems(DrawItemExtractionContext& ctx)
     }
 }
 
+void RenderFrameExtractor::selectDrawItemLods(const LodSelectionSettings& settings, LodHistory* history, RenderFrameData& out)
+{
+    YA_PROFILE_FUNCTION();
+
+    const float viewportHeight = static_cast<float>(out.viewportExtent.height);
+    if (viewportHeight <= 0.0f) {
+        return;
+    }
+
+    auto selectItem = [&](RenderDrawItem& item)
+    {
+        const auto lods = item.mesh->getLods();
+        if (lods.size() <= 1) {
+            return;
+        }
+
+        // Errors are relative to the largest local bounds extent; scale
+        // them into world units, then into pixels at the nearest point of
+        // the bounding sphere.
+        const AABB&     bounds      = item.mesh->boundingBox;
+        const glm::vec3 localExtent = bounds.getExtent();
+        const float     maxScale    = std::max({glm::length(glm::vec3(item.worldMatrix[0])),
+                                                glm::length(glm::vec3(item.worldMatrix[1])),
+                                                glm::length(glm::vec3(item.worldMatrix[2]))});
+        const glm::vec3 center      = glm::vec3(item.worldMatrix * glm::vec4(bounds.getCenter(), 1.0f));
+        const float     radius      = 0.5f * glm::length(localExtent) * maxScale;
+        const float     distance    = std::max(glm::distance(out.cameraPos, center) - radius, 0.0f);
+        const float     meshExtent  = std::max({localExtent.x, localExtent.y, localExtent.z}) * maxScale;
+        const float     pixels      = meshExtent * render_lod::pixelsPerWorldUnit(out.projection, viewportHeight, distance);
+
+        if (history) {
+            const uint64_t key = LodHistory::key(entt::to_integral(out.viewOwner), item.entityId);
+            item.lod           = history->select(key, lods, pixels, settings, out.frameIndex);
+        }
+        else {
+            item.lod = render_lod::selectLod(lods, pixels, 0, settings);
+        }
+    };
+
+    // Runs after culling: the visible list is an in-order subsequence of the
+    // caster list, so visible casters reuse the camera's pick and only the
+    // culled ones are selected again.
+    auto selectBucket = [&](std::vector<RenderDrawItem>& items, std::vector<RenderDrawItem>* casters)
+    {
+        for (auto& item : items) {
+            selectItem(item);
+        }
+        if (!casters) {
+            return;
+        }
+        size_t visible = 0;
+        for (auto& caster : *casters) {
+            if (visible < items.size() && items[visible].entityId == caster.entityId && items[visible].mesh == caster.mesh) {
+                caster.lod = items[visible++].lod;
+            }
+            else {
+                selectItem(caster);
+            }
+        }
+    };
+
+    auto& staticBuckets = out.drawBuckets.staticMeshes;
+    auto& staticCasters = out.staticShadowCasters;
+    selectBucket(staticBuckets.pbrDrawItems, &staticCasters.pbrDrawItems);
+    selectBucket(staticBuckets.phongDrawItems, &staticCasters.phongDrawItems);
+    selectBucket(staticBuckets.unlitDrawItems, &staticCasters.unlitDrawItems);
+    selectBucket(staticBuckets.simpleDrawItems, &staticCasters.simpleDrawItems);
+    selectBucket(staticBuckets.fallbackDrawItems, &staticCasters.fallbackDrawItems);
+
+    auto& skinnedBuckets = out.drawBuckets.skinnedMeshes;
+    selectBucket(skinnedBuckets.pbrDrawItems, nullptr);
+    selectBucket(skinnedBuckets.phongDrawItems, nullptr);
+    selectBucket(skinnedBuckets.unlitDrawItems, nullptr);
+    selectBucket(skinnedBuckets.simpleDrawItems, nullptr);
+    selectBucket(skinnedBuckets.fallbackDrawItems, nullptr);
+
+    if (history && out.frameIndex % LodHistory::MAX_AGE == 0) {
+        history->prune(out.frameIndex);
+    }
+}
+
+void RenderFrameExtractor::cullDrawItems(RenderFrameData& out)
+{
+    YA_PROFILE_FUNCTION();
+    YA_PERF_SCOPE(perf::sample::renderCull(), perf::metric::cpuTimeMs(), perf::domain::render());
+
+    const Frustum frustum = Frustum::fromViewProjection(out.projection * out.view);
+
+    // Scratch reused across frames so culling does not allocate in steady state.
+    thread_local FrustumCullBounds    bounds;
+    thread_local std::vector<uint8_t> visibility;
+
+    size_t visibleCount = 0;
+    size_t culledCount  = 0;
+
+    // Every candidate stays a shadow caster; only the visible ones are kept for
+    // the camera passes. Swapping keeps both vectors' capacity across frames.
+    auto cullBucket = [&](std::vector<RenderDrawItem>& items, std::vector<RenderDrawItem>& casters)
+    {
+        casters.clear();
+        casters.swap(items);
+        if (casters.empty()) {
+            return;
+        }
+
+        bounds.clear();
+        bounds.reserve(casters.size());
+        for (const auto& item : casters) {
+            bounds.pushTransformed(item.mesh->boundingBox, item.worldMatrix);
+        }
+        visibility.resize(casters.size());
+        const size_t bucketVisible = FrustumCulling::cull(frustum, bounds, visibility);
+
+        items.reserve(bucketVisible);
+        for (size_t i = 0; i < casters.size(); ++i) {
+            if (visibility[i]) {
+                items.push_back(casters[i]);
+            }
+        }
+        visibleCount += bucketVisible;
+        culledCount += casters.size() - bucketVisible;
+    };
+
+    auto& staticBuckets = out.drawBuckets.staticMeshes;
+    auto& staticCasters = out.staticShadowCasters;
+    cullBucket(staticBuckets.pbrDrawItems, staticCasters.pbrDrawItems);
+    cullBucket(staticBuckets.phongDrawItems, staticCasters.phongDrawItems);
+    cullBucket(staticBuckets.unlitDrawItems, staticCasters.unlitDrawItems);
+    cullBucket(staticBuckets.simpleDrawItems, staticCasters.simpleDrawItems);
+    cullBucket(staticBuckets.fallbackDrawItems, staticCasters.fallbackDrawItems);
+
+    // Skinned meshes only carry bind-pose bounds, which animation can leave
+    // behind; they are never culled until per-pose bounds exist, and the
+    // shadow passes read the camera list directly.
+    visibleCount += out.drawBuckets.skinnedMeshes.totalDrawCount();
+
+    out.culledDrawCount = static_cast<uint32_t>(culledCount);
+
+    if (YA_PERF_IS_ENABLED()) {
+        auto& perfState = PerfState::Get();
+        perfState.setValue(perf::sample::renderCull(), perf::metric::visibleCount(), static_cast<float>(visibleCount), perf::domain::render());
+        perfState.setValue(perf::sample::renderCull(), perf::metric::culledCount(), static_cast<float>(culledCount), perf::domain::render());
+    }
+}
+
+void RenderFrameExtractor::markPointShadowCasters(const Scene& scene, RenderFrameData& out)
+{
+    static_assert(MAX_POINT_LIGHTS <= 32, "pointShadowMask holds one bit per point light");
+    YA_PROFILE_FUNCTION();
+
+    const SceneSpatialIndex& index = scene.getSpatialIndex();
+    if (out.numPointLights == 0 || index.empty()) {
+        return;
+    }
+
+    // One range query per light against the scene index; casters beyond a
+    // light's far plane cannot land in its cube map.
+    thread_local std::vector<entt::entity>               inRange;
+    thread_local std::unordered_map<uint32_t, uint32_t> masks;
+    masks.clear();
+    for (uint32_t light = 0; light < out.numPointLights; ++light) {
+        const auto& pl = out.pointLights[light];
+        inRange.clear();
+        index.querySphere(pl.position, pl.farPlane, inRange);
+        for (const entt::entity entity : inRange) {
+            masks[entt::to_integral(entity)] |= 1u << light;
+        }
+    }
+
+    // Entities the index has not seen at their current transform or mesh
+    // (spawned or moved after the last sync) keep casting into every light.
+    const auto& registry = scene.getRegistry();
+    auto        markBucket = [&](std::vector<RenderDrawItem>& items)
+    {
+        for (auto& item : items) {
+            const auto  entity = static_cast<entt::entity>(item.entityId);
+            const auto* proxy  = registry.try_get<SpatialProxyComponent>(entity);
+            const auto* tc     = registry.try_get<TransformComponent>(entity);
+            if (!proxy || !tc || proxy->proxyId == DynamicAABBTree::kNullNode ||
+                proxy->worldRevision != tc->getWorldRevision() || proxy->boundsSource != item.mesh) {
+                continue;
+            }
+            const auto it        = masks.find(item.entityId);
+            item.pointShadowMask = it != masks.end() ? it->second : 0u;
+        }
+    };
+
+    // Skinned casters keep the full mask: their indexed bind-pose bounds may
+    // not cover the animated pose.
+    auto& casters = out.staticShadowCasters;
+    markBucket(casters.pbrDrawItems);
+    markBucket(casters.phongDrawItems);
+    markBucket(casters.unlitDrawItems);
+    markBucket(casters.simpleDrawItems);
+    markBucket(casters.fallbackDrawItems);
+}
+
 void RenderFrameExtractor::sortDrawItems(const glm::vec3& cameraPos, RenderFrameData& out)
 {
     auto computeSortKey = [&cameraPos](RenderDrawItem& item)
@@ -403,29 +605,16 @@ void RenderFrameExtractor::sortDrawItems(const glm::vec3& cameraPos, RenderFrame
         item.sortKey  = glm::distance2(cameraPos, pos);
     };
 
+    // Packed-key radix sort; the scratch keeps steady-state frames allocation-free.
+    thread_local RenderDrawSortScratch scratch;
     auto sortOpaqueBucket = [](std::vector<RenderDrawItem>& items)
     {
-        std::sort(items.begin(), items.end(), [](const RenderDrawItem& a, const RenderDrawItem& b)
-                  {
-                      if (a.materialIndex != b.materialIndex) {
-                          return a.materialIndex < b.materialIndex;
-                      }
-                      if (a.mesh != b.mesh) {
-                          return a.mesh < b.mesh;
-                      }
-                      return a.sortKey < b.sortKey;
-                  });
+        sortDrawItemsByKey(items, EDrawSortMode::MaterialMeshFrontToBack, scratch);
     };
 
     auto sortFallbackBucket = [](std::vector<RenderDrawItem>& items)
     {
-        std::sort(items.begin(), items.end(), [](const RenderDrawItem& a, const RenderDrawItem& b)
-                  {
-                      if (a.mesh != b.mesh) {
-                          return a.mesh < b.mesh;
-                      }
-                      return a.sortKey < b.sortKey;
-                  });
+        sortDrawItemsByKey(items, EDrawSortMode::MeshFrontToBack, scratch);
     };
 
     auto sortBuckets = [&](RenderShadingDrawBuckets& buckets)
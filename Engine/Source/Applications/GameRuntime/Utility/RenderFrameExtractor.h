@@ -2,6 +2,7 @@
 
 #include "Render3D/RenderFrameData.h"
 #include "Render3D/Common/ShadowSettings.h"
+#include "Render3D/RenderLodSelection.h"
 
 #include <unordered_map>
 
@@ -34,6 +35,9 @@ struct RenderFrameExtractor
         uint64_t       frameIndex = 0;
         float          deltaTime  = 0.0f;
         const ShadowSettings* shadowSettings = nullptr;
+        LodSelectionSettings  lodSettings    = {};
+        /// Caller-owned LOD hysteresis state; null selects without history.
+        LodHistory*           lodHistory     = nullptr;
     };
 
     /// Extract a complete render frame snapshot from the scene.
@@ -44,6 +48,9 @@ struct RenderFrameExtractor
     static void extractLights(const ExtractInput& input, entt::registry& reg, RenderFrameData& out);
     static int32_t registerSkinningPalette(DrawItemExtractionContext& ctx, entt::entity entity, Mesh* mesh);
     static void extractDrawItems(DrawItemExtractionContext& ctx);
+    static void selectDrawItemLods(const LodSelectionSettings& settings, LodHistory* history, RenderFrameData& out);
+    static void cullDrawItems(RenderFrameData& out);
+    static void markPointShadowCasters(const Scene& scene, RenderFrameData& out);
     static void sortDrawItems(const glm::vec3& cameraPos, RenderFrameData& out);
 };
 
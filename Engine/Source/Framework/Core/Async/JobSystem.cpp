@@ -0,0 +1,493 @@
+#include "JobSystem.h"
+
+#include "Core/Log.h"
+#include "Core/Profiling/Instrumentor.h"
+#include "LockFreeQueue.h"
+
+#include <exception>
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr uint32_t kNoQueue     = JobHandle::kInvalidIndex;
+constexpr uint32_t kSpinRounds  = 64; // Yield-polls before an idle worker sleeps
+constexpr uint64_t kFreeTagUnit = uint64_t(1) << 32;
+
+// Deque owned by the current thread. Bound by start() (main) / workerLoop (workers).
+thread_local const JobSystem* tl_owner      = nullptr;
+thread_local uint32_t         tl_queueIndex = kNoQueue;
+thread_local uint32_t         tl_stealSeed  = 0x9E3779B9u;
+// Background jobs executing on this thread (nested through waits).
+thread_local uint32_t         tl_backgroundDepth = 0;
+
+uint32_t nextStealVictim(uint32_t bound)
+{
+    // xorshift32: cheap per-thread victim randomization.
+    uint32_t x = tl_stealSeed;
+    x ^= x << 13u;
+    x ^= x >> 17u;
+    x ^= x << 5u;
+    tl_stealSeed = x;
+    return x % bound;
+}
+
+struct SpinLockGuard
+{
+    std::atomic_flag& flag;
+
+    explicit SpinLockGuard(std::atomic_flag& inFlag) : flag(inFlag)
+    {
+        while (flag.test_and_set(std::memory_order_acquire)) {
+            while (flag.test(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    ~SpinLockGuard() { flag.clear(std::memory_order_release); }
+};
+
+} // namespace
+
+struct JobSystem::WorkerQueue
+{
+    WorkStealingDeque<uint32_t, kDequeCapacity> deque;
+
+    // Owner-thread counters, read racily by getStats().
+    alignas(64) std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t>             stolen{0};
+};
+
+JobSystem& JobSystem::get()
+{
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::JobSystem()
+{
+    _jobs = std::make_unique<Job[]>(kMaxJobs);
+    for (uint32_t i = 0; i < kMaxJobs; ++i) {
+        _jobs[i].nextFree.store(i + 1 < kMaxJobs ? i + 1 : JobHandle::kInvalidIndex, std::memory_order_relaxed);
+    }
+    _freeHead.store(0, std::memory_order_relaxed);
+
+    _queueCapacity = std::max(std::thread::hardware_concurrency(), 8u) + 1;
+    _queues        = std::make_unique<WorkerQueue[]>(_queueCapacity);
+}
+
+JobSystem::~JobSystem()
+{
+    stop();
+}
+
+void JobSystem::start(uint32_t numWorkers)
+{
+    if (_running) return;
+
+    if (numWorkers == 0) {
+        numWorkers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+    numWorkers = std::min(numWorkers, _queueCapacity - 1);
+    // Keep one worker free for frame work whenever there is more than one.
+    _backgroundLimit = std::max(numWorkers, 2u) - 1;
+
+    _stopping.store(false, std::memory_order_release);
+    _running = true;
+
+    tl_owner      = this;
+    tl_queueIndex = 0;
+    _queueCount.store(numWorkers + 1, std::memory_order_release);
+
+    _workers.reserve(numWorkers);
+    for (uint32_t i = 0; i < numWorkers; ++i) {
+        _workers.emplace_back([this, queueIndex = i + 1]() { workerLoop(queueIndex); });
+    }
+
+    YA_CORE_INFO("JobSystem: started with {} worker threads", numWorkers);
+}
+
+void JobSystem::stop()
+{
+    if (!_running) return;
+    YA_PROFILE_FUNCTION_LOG();
+
+    // Drain on the calling thread too, then let workers finish whatever is left.
+    while (tryExecuteOne(true)) {
+    }
+
+    {
+        std::lock_guard lock(_sleepMutex);
+        _stopping.store(true, std::memory_order_release);
+    }
+    _sleepCondition.notify_all();
+
+    for (auto& worker : _workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    _workers.clear();
+
+    // Jobs spawned by the last running jobs land in our deque or the injection queue.
+    while (tryExecuteOne(true)) {
+    }
+
+    _queueCount.store(0, std::memory_order_release);
+    if (tl_owner == this) {
+        tl_owner      = nullptr;
+        tl_queueIndex = kNoQueue;
+    }
+    _running = false;
+
+    YA_CORE_INFO("JobSystem: stopped");
+}
+
+// ── Job pool ─────────────────────────────────────────────────────────────
+
+uint32_t JobSystem::popFreeJob()
+{
+    uint64_t head = _freeHead.load(std::memory_order_acquire);
+    while (true) {
+        const uint32_t index = static_cast<uint32_t>(head);
+        if (index == JobHandle::kInvalidIndex) {
+            return JobHandle::kInvalidIndex;
+        }
+        // `next` may be stale if another thread popped this slot first; the tag makes that CAS fail.
+        const uint32_t next    = _jobs[index].nextFree.load(std::memory_order_relaxed);
+        const uint64_t newHead = ((head & ~uint64_t(0xFFFFFFFFu)) + kFreeTagUnit) | next;
+        if (_freeHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+void JobSystem::pushFreeJob(uint32_t index)
+{
+    uint64_t head = _freeHead.load(std::memory_order_relaxed);
+    while (true) {
+        _jobs[index].nextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        const uint64_t newHead = ((head & ~uint64_t(0xFFFFFFFFu)) + kFreeTagUnit) | index;
+        if (_freeHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+JobHandle JobSystem::allocateJob(JobHandle parent)
+{
+    uint32_t index = popFreeJob();
+    while (index == JobHandle::kInvalidIndex) {
+        // Pool exhausted: help drain instead of failing.
+        if (!tryExecuteOne()) {
+            std::this_thread::yield();
+        }
+        index = popFreeJob();
+    }
+
+    Job& job = _jobs[index];
+    {
+        SpinLockGuard lock(job.continuationLock);
+        job.bSealed           = false;
+        job.continuationCount = 0;
+    }
+    job.parent = JobHandle::kInvalidIndex;
+    job.unfinished.store(1, std::memory_order_relaxed);
+    job.pendingDependencies.store(1, std::memory_order_relaxed);
+
+    if (parent.valid()) {
+        YA_CORE_ASSERT(!isDone(parent), "JobSystem: child job attached to a finished parent");
+        _jobs[parent.index].unfinished.fetch_add(1, std::memory_order_relaxed);
+        job.parent = parent.index;
+    }
+
+    return JobHandle{
+        .index      = index,
+        .generation = job.generation.load(std::memory_order_relaxed),
+    };
+}
+
+void JobSystem::releaseJob(uint32_t index)
+{
+    pushFreeJob(index);
+}
+
+// ── Scheduling ───────────────────────────────────────────────────────────
+
+void JobSystem::addDependency(JobHandle job, JobHandle dependency)
+{
+    if (!job.valid() || !dependency.valid()) return;
+
+    Job& dep = _jobs[dependency.index];
+    {
+        SpinLockGuard lock(dep.continuationLock);
+        if (dep.generation.load(std::memory_order_relaxed) != dependency.generation || dep.bSealed) {
+            return; // Already finished.
+        }
+        if (dep.continuationCount < kMaxContinuations) {
+            dep.continuations[dep.continuationCount++] = job.index;
+            _jobs[job.index].pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    // Continuation list full: resolve the dependency eagerly on this thread.
+    wait(dependency);
+}
+
+void JobSystem::run(JobHandle job)
+{
+    if (!job.valid()) return;
+    if (_jobs[job.index].pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        enqueue(job.index);
+    }
+}
+
+uint32_t JobSystem::currentQueueIndex() const
+{
+    return tl_owner == this ? tl_queueIndex : kNoQueue;
+}
+
+void JobSystem::enqueue(uint32_t index)
+{
+    // Count first: a worker seeing the count but not the job just spins once more,
+    // the reverse order could let it sleep on a queued job.
+    _queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+
+    if (_jobs[index].priority == EJobPriority::Background) {
+        std::lock_guard lock(_backgroundMutex);
+        _backgroundQueue.push_back(index);
+        _backgroundCount.fetch_add(1, std::memory_order_release);
+    }
+    else if (const uint32_t queueIndex = currentQueueIndex();
+             queueIndex == kNoQueue || !_queues[queueIndex].deque.tryPush(index)) {
+        std::lock_guard lock(_injectionMutex);
+        _injectionQueue.push_back(index);
+        _injectionCount.fetch_add(1, std::memory_order_release);
+    }
+
+    if (_sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard lock(_sleepMutex);
+        _sleepCondition.notify_one();
+    }
+}
+
+uint32_t JobSystem::findJob(uint32_t queueIndex, bool bIncludeBackground)
+{
+    if (queueIndex != kNoQueue) {
+        if (auto index = _queues[queueIndex].deque.tryPop()) {
+            return *index;
+        }
+    }
+
+    if (_injectionCount.load(std::memory_order_acquire) > 0) {
+        std::lock_guard lock(_injectionMutex);
+        if (!_injectionQueue.empty()) {
+            const uint32_t index = _injectionQueue.front();
+            _injectionQueue.pop_front();
+            _injectionCount.fetch_sub(1, std::memory_order_relaxed);
+            return index;
+        }
+    }
+
+    const uint32_t queueCount = _queueCount.load(std::memory_order_acquire);
+    if (queueCount == 0) {
+        return JobHandle::kInvalidIndex;
+    }
+    const uint32_t first = nextStealVictim(queueCount);
+    for (uint32_t i = 0; i < queueCount; ++i) {
+        const uint32_t victim = (first + i) % queueCount;
+        if (victim == queueIndex) continue;
+        if (auto index = _queues[victim].deque.trySteal()) {
+            if (queueIndex != kNoQueue) {
+                _queues[queueIndex].stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+            return *index;
+        }
+    }
+    // Background work last: frame work queued meanwhile goes first.
+    return bIncludeBackground ? popBackgroundJob() : JobHandle::kInvalidIndex;
+}
+
+uint32_t JobSystem::popBackgroundJob()
+{
+    if (_backgroundCount.load(std::memory_order_acquire) == 0) {
+        return JobHandle::kInvalidIndex;
+    }
+    std::lock_guard lock(_backgroundMutex);
+    if (_backgroundQueue.empty()) {
+        return JobHandle::kInvalidIndex;
+    }
+    const uint32_t index = _backgroundQueue.front();
+    _backgroundQueue.pop_front();
+    _backgroundCount.fetch_sub(1, std::memory_order_relaxed);
+    return index;
+}
+
+bool JobSystem::canStartBackground() const
+{
+    // Soft limit: racing workers may overshoot it by one job each.
+    return _activeBackground.load(std::memory_order_relaxed) < _backgroundLimit ||
+           _stopping.load(std::memory_order_acquire);
+}
+
+bool JobSystem::hasWorkFor(bool bIncludeBackground) const
+{
+    const int64_t background = _backgroundCount.load(std::memory_order_seq_cst);
+    return _queuedJobs.load(std::memory_order_seq_cst) > background || (bIncludeBackground && background > 0);
+}
+
+void JobSystem::execute(uint32_t index, uint32_t queueIndex)
+{
+    _queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+    Job&       job         = _jobs[index];
+    const bool bBackground = job.priority == EJobPriority::Background;
+    if (bBackground) {
+        _activeBackground.fetch_add(1, std::memory_order_relaxed);
+        ++tl_backgroundDepth;
+    }
+    try {
+        job.invoke(job.payload);
+    }
+    catch (const std::exception& e) {
+        YA_CORE_ERROR("JobSystem: job threw: {}", e.what());
+    }
+    catch (...) {
+        YA_CORE_ERROR("JobSystem: job threw an unknown exception");
+    }
+    job.destroy(job.payload);
+
+    if (bBackground) {
+        --tl_backgroundDepth;
+        _activeBackground.fetch_sub(1, std::memory_order_relaxed);
+        // A worker may have gone to sleep on a full background limit.
+        if (_backgroundCount.load(std::memory_order_seq_cst) > 0 && _sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard lock(_sleepMutex);
+            _sleepCondition.notify_one();
+        }
+    }
+
+    if (queueIndex != kNoQueue) {
+        _queues[queueIndex].executed.fetch_add(1, std::memory_order_relaxed);
+    }
+    finish(index);
+}
+
+void JobSystem::finish(uint32_t index)
+{
+    while (index != JobHandle::kInvalidIndex) {
+        Job& job = _jobs[index];
+        if (job.unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        // Completed: seal the continuation list and publish "done" in one step.
+        uint32_t continuations[kMaxContinuations];
+        uint32_t continuationCount = 0;
+        {
+            SpinLockGuard lock(job.continuationLock);
+            job.bSealed       = true;
+            continuationCount = job.continuationCount;
+            std::copy_n(job.continuations, continuationCount, continuations);
+            job.generation.fetch_add(1, std::memory_order_release);
+        }
+
+        for (uint32_t i = 0; i < continuationCount; ++i) {
+            if (_jobs[continuations[i]].pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                enqueue(continuations[i]);
+            }
+        }
+
+        const uint32_t parent = job.parent;
+        releaseJob(index);
+        index = parent; // Tail-iterate instead of recursing up the parent chain.
+    }
+}
+
+// ── Waiting ──────────────────────────────────────────────────────────────
+
+bool JobSystem::tryExecuteOne(bool bIncludeBackground)
+{
+    const uint32_t queueIndex = currentQueueIndex();
+    const uint32_t index      = findJob(queueIndex, bIncludeBackground);
+    if (index == JobHandle::kInvalidIndex) {
+        return false;
+    }
+    execute(index, queueIndex);
+    return true;
+}
+
+void JobSystem::wait(JobHandle job)
+{
+    // Inside a background job the thread is already off the frame path.
+    waitHelping(job, tl_backgroundDepth > 0);
+}
+
+void JobSystem::waitBackground(JobHandle job)
+{
+    waitHelping(job, true);
+}
+
+void JobSystem::waitHelping(JobHandle job, bool bIncludeBackground)
+{
+    while (!isDone(job)) {
+        if (!tryExecuteOne(bIncludeBackground)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(uint32_t queueIndex)
+{
+    tl_owner      = this;
+    tl_queueIndex = queueIndex;
+    tl_stealSeed  = 0x9E3779B9u * (queueIndex + 1);
+
+    while (true) {
+        if (uint32_t index = findJob(queueIndex, canStartBackground()); index != JobHandle::kInvalidIndex) {
+            execute(index, queueIndex);
+            continue;
+        }
+
+        bool bFound = false;
+        for (uint32_t spin = 0; spin < kSpinRounds && !bFound; ++spin) {
+            std::this_thread::yield();
+            if (uint32_t index = findJob(queueIndex, canStartBackground()); index != JobHandle::kInvalidIndex) {
+                execute(index, queueIndex);
+                bFound = true;
+            }
+        }
+        if (bFound) continue;
+
+        std::unique_lock lock(_sleepMutex);
+        _sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        _sleepCondition.wait(lock, [this]() {
+            return _stopping.load(std::memory_order_acquire) || hasWorkFor(canStartBackground());
+        });
+        _sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+        if (_stopping.load(std::memory_order_acquire) && _queuedJobs.load(std::memory_order_acquire) <= 0) {
+            break;
+        }
+    }
+
+    tl_owner      = nullptr;
+    tl_queueIndex = kNoQueue;
+}
+
+JobSystem::Stats JobSystem::getStats() const
+{
+    Stats stats;
+    stats.workerCount = getWorkerCount();
+    stats.queuedJobs  = _queuedJobs.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < _queueCapacity; ++i) {
+        stats.executedJobs += _queues[i].executed.load(std::memory_order_relaxed);
+        stats.stolenJobs += _queues[i].stolen.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+} // namespace ya
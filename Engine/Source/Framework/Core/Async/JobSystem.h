@@ -0,0 +1,330 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Core/Api.h"
+
+namespace ya
+{
+
+/**
+ * @brief Lightweight reference to a job owned by JobSystem.
+ *
+ * Jobs live in a fixed pool and are recycled as soon as they complete; the
+ * generation tag makes a stale handle read as "done" instead of aliasing the
+ * slot's next occupant. Trivially copyable, no ref counting.
+ */
+struct JobHandle
+{
+    static constexpr uint32_t kInvalidIndex = ~0u;
+
+    uint32_t index      = kInvalidIndex;
+    uint32_t generation = 0;
+
+    [[nodiscard]] bool valid() const { return index != kInvalidIndex; }
+};
+
+/// Which threads may pick a job up.
+enum class EJobPriority : uint8_t
+{
+    Normal,     // Frame work: any thread, including waiters helping on the main thread
+    Background, // IO, imports, compiles: workers only, never a frame-critical waiter
+};
+
+/**
+ * @brief Work-stealing job system for CPU-parallel frame work.
+ *
+ * Architecture:
+ *   job pool            : fixed array of Job slots, lock-free tagged free list
+ *   per-thread deques   : Chase-Lev WorkStealingDeque — the owner pushes/pops
+ *                         LIFO, idle threads steal FIFO from the others
+ *   injection queue     : mutex-protected FIFO for threads that own no deque
+ *                         (render thread, IO callbacks, ...) and deque overflow
+ *   background queue    : mutex-protected FIFO of EJobPriority::Background
+ *                         jobs; only workers take from it, and at most
+ *                         `workers - 1` of them at once
+ *   idle workers        : sleep on a condvar, woken when work is queued
+ *
+ * Job lifecycle (create → run → execute → finish):
+ * - `create()` allocates a job but does not queue it, so dependencies and
+ *   children can be attached first. `schedule()` is create + run.
+ * - A job becomes runnable once `run()` was called and every job it depends on
+ *   has finished (`addDependency()` / `scheduleAfter()`).
+ * - A job finishes once its own body ran and all of its children finished —
+ *   a group job (empty body) is therefore a counter over its children.
+ * - `wait()` never blocks idle: the waiting thread executes queued jobs until
+ *   the awaited one is done, so waiting on the main thread adds a worker.
+ *   It only helps with Normal jobs, so a frame-critical wait cannot pick up a
+ *   long background job; waits made from inside a background job (or a
+ *   background parallelFor) help with both.
+ *
+ * The thread that calls `start()` owns deque 0 (the main thread), workers own
+ * deques 1..N. Jobs must not throw; an escaping exception is logged and the
+ * job is treated as finished so waiters never hang.
+ */
+class YA_CORE_API JobSystem
+{
+  public:
+    static constexpr size_t   kJobPayloadBytes  = 64;      // Inline callable storage, larger callables are boxed
+    static constexpr uint32_t kMaxJobs          = 1u << 14; // Pool size (jobs alive at once)
+    static constexpr uint32_t kMaxContinuations = 16;      // Jobs that may depend on a single job
+    static constexpr size_t   kDequeCapacity    = 4096;    // Per-thread deque size before injection fallback
+
+    struct Stats
+    {
+        uint32_t workerCount   = 0;
+        uint64_t executedJobs  = 0; // Jobs executed by threads owning a deque
+        uint64_t stolenJobs    = 0; // Subset of executedJobs taken from another thread's deque
+        int64_t  queuedJobs    = 0; // Runnable jobs not picked up yet
+    };
+
+    static JobSystem& get();
+
+    /**
+     * @brief Start worker threads and bind the calling thread as queue 0.
+     *        Safe to call multiple times (no-op if running).
+     * @param numWorkers Worker thread count, 0 = hardware_concurrency - 1.
+     */
+    void start(uint32_t numWorkers = 0);
+
+    /**
+     * @brief Execute every queued job, then stop and join all workers.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const { return _running; }
+
+    /// Worker threads, excluding the main thread.
+    [[nodiscard]] uint32_t getWorkerCount() const { return static_cast<uint32_t>(_workers.size()); }
+
+    /// Threads that execute jobs during a wait: workers + the calling thread.
+    [[nodiscard]] uint32_t getConcurrency() const { return getWorkerCount() + 1; }
+
+    /**
+     * @brief Allocate a job without queuing it.
+     * @param parent Optional group/parent job; the parent does not finish before this job.
+     */
+    template <typename Func>
+    JobHandle create(Func&& func, JobHandle parent = {}, EJobPriority priority = EJobPriority::Normal)
+    {
+        const JobHandle handle = allocateJob(parent);
+        bindPayload(_jobs[handle.index], std::forward<Func>(func));
+        _jobs[handle.index].priority = priority;
+        return handle;
+    }
+
+    /// Empty job that finishes once all of its children have finished.
+    JobHandle createGroup(JobHandle parent = {})
+    {
+        return create([]() {}, parent);
+    }
+
+    /**
+     * @brief Make `job` wait for `dependency`. Must be called before `run(job)`.
+     *        A finished (or invalid) dependency is ignored.
+     */
+    void addDependency(JobHandle job, JobHandle dependency);
+
+    /// Queue a created job; it executes once all of its dependencies have finished.
+    void run(JobHandle job);
+
+    template <typename Func>
+    JobHandle schedule(Func&& func, JobHandle parent = {}, EJobPriority priority = EJobPriority::Normal)
+    {
+        const JobHandle handle = create(std::forward<Func>(func), parent, priority);
+        run(handle);
+        return handle;
+    }
+
+    /// Long-running work (IO, decode, compiles) that must stay off frame-critical waits.
+    template <typename Func>
+    JobHandle scheduleBackground(Func&& func)
+    {
+        return schedule(std::forward<Func>(func), {}, EJobPriority::Background);
+    }
+
+    template <typename Func>
+    JobHandle scheduleAfter(std::initializer_list<JobHandle> dependencies, Func&& func, JobHandle parent = {})
+    {
+        const JobHandle handle = create(std::forward<Func>(func), parent);
+        for (const JobHandle& dependency : dependencies) {
+            addDependency(handle, dependency);
+        }
+        run(handle);
+        return handle;
+    }
+
+    [[nodiscard]] bool isDone(JobHandle job) const
+    {
+        return !job.valid() || _jobs[job.index].generation.load(std::memory_order_acquire) != job.generation;
+    }
+
+    /// Block until `job` finished, executing other jobs meanwhile.
+    void wait(JobHandle job);
+
+    /// wait() on a background job: also helps with background jobs, so the
+    /// awaited one cannot sit behind the background limit while the caller idles.
+    void waitBackground(JobHandle job);
+
+    /**
+     * @brief Execute one queued job on the calling thread, if any.
+     * @param bIncludeBackground Also take background jobs: for drains at
+     *        shutdown / flush, never on a frame-critical path.
+     * @return true if a job was executed.
+     */
+    bool tryExecuteOne(bool bIncludeBackground = false);
+
+    /**
+     * @brief Split [0, count) into batches and run `body(begin, end)` for each
+     *        across all threads. Blocks (helping) until every batch finished.
+     * @param batchSize Items per job, 0 = pick from count and thread count.
+     * @param priority  Background batches (compiles, IO) stay away from
+     *        frame-critical waiters; the caller still helps with them.
+     *
+     * The body is referenced, not copied: it must stay valid for the call,
+     * which it trivially does because the call blocks.
+     */
+    template <typename Func>
+    void parallelFor(uint32_t count, uint32_t batchSize, Func&& body, EJobPriority priority = EJobPriority::Normal)
+    {
+        if (count == 0) {
+            return;
+        }
+        if (batchSize == 0) {
+            // ~4 batches per thread keeps stealing effective without flooding the pool.
+            batchSize = std::max<uint32_t>(1, count / (getConcurrency() * 4));
+        }
+        if (count <= batchSize) {
+            body(0u, count);
+            return;
+        }
+
+        const JobHandle group = createGroup();
+        for (uint32_t begin = batchSize; begin < count; begin += batchSize) {
+            const uint32_t end = std::min(count, begin + batchSize);
+            schedule([&body, begin, end]() { body(begin, end); }, group, priority);
+        }
+        run(group);
+
+        // The first batch runs inline: the caller would otherwise just wait.
+        body(0u, batchSize);
+        waitHelping(group, priority == EJobPriority::Background);
+    }
+
+    /// Runnable jobs not picked up yet (approximate).
+    [[nodiscard]] size_t pendingCount() const
+    {
+        const int64_t queued = _queuedJobs.load(std::memory_order_relaxed);
+        return queued > 0 ? static_cast<size_t>(queued) : 0;
+    }
+
+    [[nodiscard]] Stats getStats() const;
+
+  private:
+    JobSystem();
+    ~JobSystem();
+
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    struct alignas(64) Job
+    {
+        using InvokeFn  = void (*)(void* payload);
+        using DestroyFn = void (*)(void* payload);
+
+        alignas(64) std::byte payload[kJobPayloadBytes];
+        InvokeFn  invoke  = nullptr;
+        DestroyFn destroy = nullptr;
+
+        uint32_t     parent            = JobHandle::kInvalidIndex;
+        uint32_t     continuationCount = 0;
+        bool         bSealed           = false; // Completed: no more continuations accepted
+        EJobPriority priority          = EJobPriority::Normal;
+
+        std::atomic<int32_t>  unfinished{0};          // Own body + unfinished children
+        std::atomic<int32_t>  pendingDependencies{0}; // Unfinished dependencies + the pending run() call
+        std::atomic<uint32_t> generation{0};          // Bumped on completion
+        std::atomic<uint32_t> nextFree{JobHandle::kInvalidIndex};
+        std::atomic_flag      continuationLock;
+
+        uint32_t continuations[kMaxContinuations]{};
+    };
+
+    struct WorkerQueue;
+
+    template <typename Func>
+    static void bindPayload(Job& job, Func&& func)
+    {
+        using Fn = std::decay_t<Func>;
+        if constexpr (sizeof(Fn) <= kJobPayloadBytes && alignof(Fn) <= alignof(Job)) {
+            new (job.payload) Fn(std::forward<Func>(func));
+            job.invoke  = [](void* payload) { (*static_cast<Fn*>(payload))(); };
+            job.destroy = [](void* payload) { static_cast<Fn*>(payload)->~Fn(); };
+        }
+        else {
+            // Oversized capture: box it, the payload keeps the pointer.
+            new (job.payload) Fn*(new Fn(std::forward<Func>(func)));
+            job.invoke  = [](void* payload) { (**static_cast<Fn**>(payload))(); };
+            job.destroy = [](void* payload) { delete *static_cast<Fn**>(payload); };
+        }
+    }
+
+    JobHandle allocateJob(JobHandle parent);
+    void      releaseJob(uint32_t index);
+    uint32_t  popFreeJob();
+    void      pushFreeJob(uint32_t index);
+
+    void     enqueue(uint32_t index);
+    uint32_t findJob(uint32_t queueIndex, bool bIncludeBackground);
+    uint32_t popBackgroundJob();
+    bool     canStartBackground() const;
+    bool     hasWorkFor(bool bIncludeBackground) const;
+    void     execute(uint32_t index, uint32_t queueIndex);
+    void     waitHelping(JobHandle job, bool bIncludeBackground);
+    void     finish(uint32_t index);
+    uint32_t currentQueueIndex() const;
+
+    void workerLoop(uint32_t queueIndex);
+
+    // ── Job pool ─────────────────────────────────────────────────────────
+    std::unique_ptr<Job[]> _jobs;
+    std::atomic<uint64_t>  _freeHead{0}; // (tag << 32) | index, tag defeats ABA
+
+    // ── Queues ───────────────────────────────────────────────────────────
+    // Allocated once in the constructor so thieves never race a resize.
+    std::unique_ptr<WorkerQueue[]>   _queues; // [0] = start() caller, [1..N] = workers
+    uint32_t                         _queueCapacity = 0;
+    std::atomic<uint32_t>            _queueCount{0};
+    std::deque<uint32_t>             _injectionQueue;
+    std::mutex                       _injectionMutex;
+    std::atomic<uint32_t>            _injectionCount{0};
+    std::deque<uint32_t>             _backgroundQueue;
+    std::mutex                       _backgroundMutex;
+    std::atomic<uint32_t>            _backgroundCount{0};  // Queued background jobs
+    std::atomic<uint32_t>            _activeBackground{0}; // Background jobs executing
+    uint32_t                         _backgroundLimit = 1;
+    alignas(64) std::atomic<int64_t> _queuedJobs{0};       // Includes queued background jobs
+
+    // ── Workers (sleep on condvar when idle) ─────────────────────────────
+    std::vector<std::thread> _workers;
+    std::mutex               _sleepMutex;
+    std::condition_variable  _sleepCondition;
+    std::atomic<uint32_t>    _sleepingWorkers{0};
+    std::atomic<bool>        _stopping{false};
+    bool                     _running{false};
+};
+
+} // namespace ya
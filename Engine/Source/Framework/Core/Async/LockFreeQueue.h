@@ -209,4 +209,122 @@ class MPSCQueue
     alignas(64) Node*               _tail;   // Pop end  (single-consumer, no atomic needed)
 };
 
+
+/**
+ * @brief Fixed-size Chase-Lev work-stealing deque.
+ *
+ * One owner thread pushes and pops at the bottom (LIFO, cache-hot), any number
+ * of thief threads steal from the top (FIFO, oldest work first).
+ * Follows "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (Lê et al., PPoPP'13) without the growable buffer: a full deque reports
+ * failure and the caller falls back to a shared queue.
+ *
+ * - push/pop: owner thread only, no CAS except when racing for the last item
+ * - steal:    any thread, one CAS on top
+ *
+ * @tparam T        Element type (trivially copyable, usually a pointer).
+ * @tparam Capacity Ring buffer size (must be power-of-two).
+ */
+template <typename T, size_t Capacity>
+class WorkStealingDeque
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque stores trivially copyable items");
+
+  public:
+    WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque&)            = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Push at the bottom (owner only).
+     * @return false if the deque is full.
+     */
+    bool tryPush(T value)
+    {
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const int64_t top    = _top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(Capacity)) {
+            return false; // Full
+        }
+
+        _buffer[bottom & kMask].store(value, std::memory_order_relaxed);
+        // Release publishes the item (and whatever it points to) to thieves.
+        _bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop from the bottom (owner only).
+     */
+    std::optional<T> tryPop()
+    {
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = _top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty: restore bottom.
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T value = _buffer[bottom & kMask].load(std::memory_order_relaxed);
+        if (top != bottom) {
+            return value; // More than one item left, no race with thieves.
+        }
+
+        // Last item: race against thieves for it.
+        const bool bWon = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        if (!bWon) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Steal from the top (any thread).
+     * @return std::nullopt if empty or if another thief won the race.
+     */
+    std::optional<T> trySteal()
+    {
+        int64_t top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return std::nullopt; // Empty
+        }
+
+        T value = _buffer[top & kMask].load(std::memory_order_relaxed);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt; // Lost the race
+        }
+        return value;
+    }
+
+    /**
+     * @brief Approximate size (safe from any thread, may be stale).
+     */
+    [[nodiscard]] size_t sizeApprox() const
+    {
+        const int64_t bottom = _bottom.load(std::memory_order_acquire);
+        const int64_t top    = _top.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+  private:
+    static constexpr int64_t kMask = static_cast<int64_t>(Capacity - 1);
+
+    // Thieves write _top, the owner writes _bottom — keep them on separate cache lines.
+    alignas(64) std::atomic<int64_t> _top{0};
+    alignas(64) std::atomic<int64_t> _bottom{0};
+    alignas(64) std::atomic<T>       _buffer[Capacity]{};
+};
+
 } // namespace ya
@@ -3,6 +3,8 @@
 #include "Core/Log.h"
 #include "Core/Profiling/Instrumentor.h"
 
+#include <vector>
+
 namespace ya
 {
 
@@ -12,6 +14,12 @@ TaskQueue& TaskQueue::get()
     return instance;
 }
 
+TaskQueue::TaskQueue()
+{
+    // Construct JobSystem first so it outlives this singleton at static destruction.
+    (void)JobSystem::get();
+}
+
 TaskQueue::~TaskQueue()
 {
     stop();
@@ -21,14 +29,13 @@ void TaskQueue::start(uint32_t numThreads)
 {
     if (_running) return;
 
-    _stopping.store(false, std::memory_order_release);
-    _running = true;
-
-    for (uint32_t i = 0; i < numThreads; ++i) {
-        _workers.emplace_back([this]() { workerLoop(); });
+    auto& jobSystem = JobSystem::get();
+    if (!jobSystem.isRunning()) {
+        jobSystem.start(numThreads);
     }
+    _running = true;
 
-    YA_CORE_INFO("TaskQueue: started with {} worker threads", numThreads);
+    YA_CORE_INFO("TaskQueue: started on JobSystem ({} worker threads)", jobSystem.getWorkerCount());
 }
 
 void TaskQueue::stop()
@@ -36,18 +43,14 @@ void TaskQueue::stop()
     YA_PROFILE_FUNCTION_LOG();
     if (!_running) return;
 
-    {
-        std::lock_guard lock(_queueMutex);
-        _stopping.store(true, std::memory_order_release);
-    }
-    _condition.notify_all();
-
-    for (auto& worker : _workers) {
-        if (worker.joinable()) {
-            worker.join();
+    // Submitted tasks still complete (same contract as the old join-on-stop);
+    // the calling thread helps instead of blocking.
+    auto& jobSystem = JobSystem::get();
+    while (_inFlightTasks.load(std::memory_order_acquire) > 0) {
+        if (!jobSystem.tryExecuteOne(true)) {
+            std::this_thread::yield();
         }
     }
-    _workers.clear();
     _running = false;
 
     while (_mainThreadCallbacks.tryPop()) {
@@ -56,48 +59,23 @@ void TaskQueue::stop()
     YA_CORE_INFO("TaskQueue: stopped");
 }
 
-void TaskQueue::workerLoop()
-{
-    while (true) {
-        std::function<void()> task;
-
-        {
-            std::unique_lock lock(_queueMutex);
-            _condition.wait(lock, [this]() {
-                return _stopping.load(std::memory_order_acquire) || !_tasks.empty();
-            });
-
-            if (_stopping.load(std::memory_order_acquire) && _tasks.empty()) {
-                return;
-            }
-
-            task = std::move(_tasks.front());
-            _tasks.pop();
-        }
-
-        task();
-    }
-}
-
 void TaskQueue::processMainThreadCallbacks(uint32_t maxCallbacks)
 {
-    // Lock-free pop from MPSC queue — no mutex, no contention.
-    uint32_t processed = 0;
-
-    while (auto callback = _mainThreadCallbacks.tryPop()) {
-        (*callback)();
-        ++processed;
-
-        if (maxCallbacks > 0 && processed >= maxCallbacks) {
+    // Lock-free pop from MPSC queue — no mutex, no contention. Take the batch
+    // first: callbacks posted while it runs belong to the next frame, so a
+    // callback that re-posts itself (budgeted work) cannot spin this loop.
+    std::vector<std::function<void()>> batch;
+    while (maxCallbacks == 0 || batch.size() < maxCallbacks) {
+        auto callback = _mainThreadCallbacks.tryPop();
+        if (!callback) {
             break;
         }
+        batch.push_back(std::move(*callback));
     }
-}
 
-size_t TaskQueue::pendingCount() const
-{
-    std::lock_guard lock(_queueMutex);
-    return _tasks.size();
+    for (auto& callback : batch) {
+        callback();
+    }
 }
 
 } // namespace ya
@@ -1,16 +1,12 @@
 #pragma once
 
 #include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <future>
 #include <memory>
-#include <mutex>
-#include <queue>
-#include <thread>
-#include <vector>
 
 #include "Core/Api.h"
+#include "JobSystem.h"
 #include "LockFreeQueue.h"
 
 namespace ya
@@ -76,20 +72,34 @@ class TaskHandle
     std::shared_ptr<std::atomic<ETaskStatus>> _status;
 };
 
+namespace detail
+{
+/// Promise + status in one allocation; TaskHandle aliases the status out of it.
+template <typename T>
+struct TaskState
+{
+    std::promise<T>           promise;
+    std::atomic<ETaskStatus> status{ETaskStatus::Pending};
+};
+} // namespace detail
+
 /**
- * @brief Lightweight thread-pool / task queue for async IO.
+ * @brief Async task facade over JobSystem (IO, decode, background work).
  *
  * Architecture:
- *   _tasks queue            : mutex + condvar (workers MUST sleep when idle —
- *                             lock-free can't do that without busy-spinning)
+ *   work                    : JobSystem jobs (work-stealing, workers sleep
+ *                             when idle) — no dedicated TaskQueue threads
  *   _mainThreadCallbacks    : MPSCQueue (lock-free, multiple workers push,
  *                             main thread pops — zero contention on the hot path)
  *
- * - Fixed number of worker threads (default 2, enough for file IO).
- * - `submit()` enqueues work → returns TaskHandle.
+ * - `submit()` schedules a job → returns TaskHandle.
  * - `submitWithCallback()` also enqueues a main-thread callback (lock-free).
  * - `processMainThreadCallbacks()` must be called from the main thread
  *   each frame to execute deferred GPU-upload or cache-store work.
+ *
+ * Per submit: one shared state (promise + status) and one job slot; the
+ * callable is stored inline in the job unless its captures exceed
+ * JobSystem::kJobPayloadBytes.
  */
 class YA_CORE_API TaskQueue
 {
@@ -97,55 +107,57 @@ class YA_CORE_API TaskQueue
     static TaskQueue& get();
 
     /**
-     * @brief Start worker threads. Safe to call multiple times (no-op if running).
-     * @param numThreads Number of IO worker threads.
+     * @brief Start the underlying JobSystem if nobody did yet.
+     *        Safe to call multiple times (no-op if running).
+     * @param numThreads Worker threads for JobSystem::start (0 = all cores).
      */
-    void start(uint32_t numThreads = 2);
+    void start(uint32_t numThreads = 0);
 
     /**
-     * @brief Signal workers to stop and join all threads.
+     * @brief Finish every submitted task and drop undelivered callbacks.
+     *        JobSystem keeps running; its owner stops it.
      */
     void stop();
 
     /**
      * @brief Submit a callable to be executed on a worker thread.
      * @return TaskHandle<R> where R = return type of func.
-     *
-     * The task queue (_tasks) uses mutex + condvar because workers must sleep
-     * when idle.  Lock-free queues require busy-spin polling which wastes CPU.
      */
     template <typename Func>
     auto submit(Func&& func) -> TaskHandle<std::invoke_result_t<Func>>
     {
         using R = std::invoke_result_t<Func>;
 
-        auto status  = std::make_shared<std::atomic<ETaskStatus>>(ETaskStatus::Pending);
-        auto promise = std::make_shared<std::promise<R>>();
-        auto future  = promise->get_future().share();
+        auto state  = std::make_shared<detail::TaskState<R>>();
+        auto future = state->promise.get_future().share();
+        auto status = std::shared_ptr<std::atomic<ETaskStatus>>(state, &state->status);
+
+        _pendingTasks.fetch_add(1, std::memory_order_relaxed);
+        _inFlightTasks.fetch_add(1, std::memory_order_relaxed);
 
-        auto task = [func = std::forward<Func>(func), promise, status]() mutable {
-            status->store(ETaskStatus::Running, std::memory_order_release);
+        JobSystem::get().scheduleBackground([this, func = std::forward<Func>(func), state = std::move(state)]() mutable {
+            _pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+            state->status.store(ETaskStatus::Running, std::memory_order_release);
+            // Status is published before the promise so a waiter woken by
+            // get() never observes a stale Running status.
             try {
                 if constexpr (std::is_void_v<R>) {
                     func();
-                    promise->set_value();
+                    state->status.store(ETaskStatus::Completed, std::memory_order_release);
+                    state->promise.set_value();
                 }
                 else {
-                    promise->set_value(func());
+                    R result = func();
+                    state->status.store(ETaskStatus::Completed, std::memory_order_release);
+                    state->promise.set_value(std::move(result));
                 }
-                status->store(ETaskStatus::Completed, std::memory_order_release);
             }
             catch (...) {
-                promise->set_exception(std::current_exception());
-                status->store(ETaskStatus::Failed, std::memory_order_release);
+                state->status.store(ETaskStatus::Failed, std::memory_order_release);
+                state->promise.set_exception(std::current_exception());
             }
-        };
-
-        {
-            std::lock_guard lock(_queueMutex);
-            _tasks.emplace(std::move(task));
-        }
-        _condition.notify_one();
+            _inFlightTasks.fetch_sub(1, std::memory_order_release);
+        });
 
         return TaskHandle<R>(std::move(future), std::move(status));
     }
@@ -168,62 +180,69 @@ class YA_CORE_API TaskQueue
     {
         using R = std::invoke_result_t<Func>;
 
-        auto status  = std::make_shared<std::atomic<ETaskStatus>>(ETaskStatus::Pending);
-        auto promise = std::make_shared<std::promise<R>>();
-        auto future  = promise->get_future().share();
+        auto state  = std::make_shared<detail::TaskState<R>>();
+        auto future = state->promise.get_future().share();
+        auto status = std::shared_ptr<std::atomic<ETaskStatus>>(state, &state->status);
 
-        auto task = [this,
-                     work   = std::forward<Func>(work),
-                     onDone = std::forward<Callback>(onDone),
-                     promise,
-                     status]() mutable
+        _pendingTasks.fetch_add(1, std::memory_order_relaxed);
+        _inFlightTasks.fetch_add(1, std::memory_order_relaxed);
 
-        {
-            status->store(ETaskStatus::Running, std::memory_order_release);
+        JobSystem::get().scheduleBackground([this,
+                                             work   = std::forward<Func>(work),
+                                             onDone = std::forward<Callback>(onDone),
+                                             state  = std::move(state)]() mutable {
+            _pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+            state->status.store(ETaskStatus::Running, std::memory_order_release);
             try {
                 if constexpr (std::is_void_v<R>) {
                     work();
-                    promise->set_value();
+                    state->status.store(ETaskStatus::Completed, std::memory_order_release);
+                    state->promise.set_value();
                     // Lock-free push to main-thread callback queue
                     _mainThreadCallbacks.push([onDone = std::move(onDone)]() { onDone(); });
                 }
                 else {
                     R result = work();
-                    promise->set_value(result);
+                    state->status.store(ETaskStatus::Completed, std::memory_order_release);
+                    state->promise.set_value(result);
                     // Lock-free push to main-thread callback queue
                     _mainThreadCallbacks.push(
                         [onDone = std::move(onDone), result = std::move(result)]() mutable {
                             onDone(std::move(result));
                         });
                 }
-                status->store(ETaskStatus::Completed, std::memory_order_release);
             }
             catch (...) {
-                promise->set_exception(std::current_exception());
-                status->store(ETaskStatus::Failed, std::memory_order_release);
+                state->status.store(ETaskStatus::Failed, std::memory_order_release);
+                state->promise.set_exception(std::current_exception());
             }
-        };
-
-        {
-            std::lock_guard lock(_queueMutex);
-            _tasks.emplace(std::move(task));
-        }
-        _condition.notify_one();
+            _inFlightTasks.fetch_sub(1, std::memory_order_release);
+        });
 
         return TaskHandle<R>(std::move(future), std::move(status));
     }
 
+    /**
+     * @brief Queue a callback for the next processMainThreadCallbacks() call.
+     *        Safe from any thread (lock-free push).
+     */
+    void postToMainThread(std::function<void()> callback)
+    {
+        _mainThreadCallbacks.push(std::move(callback));
+    }
+
     /**
      * @brief Process completed callbacks on the main thread (lock-free pop).
-     *        Call this once per frame from the main/render thread.
+     *        Call this once per frame from the main/render thread. Callbacks
+     *        posted while processing run on the next call.
      * @param maxCallbacks  Max callbacks to process per call (0 = all).
      */
     void processMainThreadCallbacks(uint32_t maxCallbacks = 0);
 
     /**
-     * @brief Number of pending tasks in the work queue.
+     * @brief Number of submitted tasks that have not started yet.
      */
-    [[nodiscard]] size_t pendingCount() const;
+    [[nodiscard]] size_t pendingCount() const { return _pendingTasks.load(std::memory_order_relaxed); }
 
     /**
      * @brief Whether the queue is running.
@@ -231,21 +250,15 @@ class YA_CORE_API TaskQueue
     [[nodiscard]] bool isRunning() const { return _running; }
 
   private:
-    TaskQueue() = default;
+    TaskQueue();
     ~TaskQueue();
 
     TaskQueue(const TaskQueue&)            = delete;
     TaskQueue& operator=(const TaskQueue&) = delete;
 
-    void workerLoop();
-
-    // ── Worker task queue (mutex + condvar — workers sleep when idle) ────
-    std::vector<std::thread>          _workers;
-    std::queue<std::function<void()>> _tasks;
-    mutable std::mutex                _queueMutex;
-    std::condition_variable           _condition;
-    std::atomic<bool>                 _stopping{false};
-    bool                              _running{false};
+    std::atomic<size_t> _pendingTasks{0};  // Submitted, not started
+    std::atomic<size_t> _inFlightTasks{0}; // Submitted, not finished
+    bool                _running{false};
 
     // ── Main-thread callback queue (lock-free MPSC) ─────────────────────
     // Multiple workers push (lock-free), main thread pops (single consumer).
@@ -0,0 +1,403 @@
+#include "DynamicAABBTree.h"
+
+#include "Core/Log.h"
+
+namespace ya
+{
+
+namespace
+{
+
+float surfaceArea(const AABB &box)
+{
+    const glm::vec3 d = box.max - box.min;
+    return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+AABB combine(const AABB &a, const AABB &b)
+{
+    return AABB(glm::min(a.min, b.min), glm::max(a.max, b.max));
+}
+
+bool contains(const AABB &outer, const AABB &inner)
+{
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+           inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+} // namespace
+
+// ── Proxies ─────────────────────────────────────────────────────────────
+
+int32_t DynamicAABBTree::createProxy(const AABB &bounds, uint64_t userData)
+{
+    YA_CORE_ASSERT(bounds.isValid(), "DynamicAABBTree: proxy bounds must be valid");
+
+    const int32_t leaf    = allocateNode();
+    Node         &node    = _nodes[leaf];
+    node.aabb             = makeFatAABB(bounds, glm::vec3(0.0f));
+    node.userData         = userData;
+    node.height           = 0;
+    insertLeaf(leaf);
+    ++_proxyCount;
+    return leaf;
+}
+
+void DynamicAABBTree::destroyProxy(int32_t proxyId)
+{
+    YA_CORE_ASSERT(proxyId >= 0 && proxyId < static_cast<int32_t>(_nodes.size()) && _nodes[proxyId].isLeaf() &&
+                       _nodes[proxyId].height == 0,
+                   "DynamicAABBTree: invalid proxy {}",
+                   proxyId);
+
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --_proxyCount;
+}
+
+bool DynamicAABBTree::moveProxy(int32_t proxyId, const AABB &bounds, const glm::vec3 &displacement)
+{
+    YA_CORE_ASSERT(bounds.isValid(), "DynamicAABBTree: proxy bounds must be valid");
+
+    const AABB &treeAABB = _nodes[proxyId].aabb;
+    if (contains(treeAABB, bounds)) {
+        // Still inside its fat box. Keep it unless the box has grown far too
+        // loose (e.g. the object stopped after a large displacement), which
+        // would make it show up in unrelated queries. Steady motion trails the
+        // box by up to one prediction, so that much looseness is expected.
+        const glm::vec3 slack = glm::vec3(4.0f * _settings.margin) +
+                                glm::abs(displacement) * _settings.displacementFactor;
+        const AABB      fat   = makeFatAABB(bounds, displacement);
+        const AABB      huge(fat.min - slack, fat.max + slack);
+        if (contains(huge, treeAABB)) {
+            return false;
+        }
+    }
+
+    removeLeaf(proxyId);
+    _nodes[proxyId].aabb = makeFatAABB(bounds, displacement);
+    insertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::clear()
+{
+    _nodes.clear();
+    _root       = kNullNode;
+    _freeList   = kNullNode;
+    _proxyCount = 0;
+}
+
+AABB DynamicAABBTree::makeFatAABB(const AABB &bounds, const glm::vec3 &displacement) const
+{
+    AABB fat(bounds.min - glm::vec3(_settings.margin), bounds.max + glm::vec3(_settings.margin));
+
+    // Stretch only along the direction of motion so the next few frames stay inside.
+    const glm::vec3 predicted = displacement * _settings.displacementFactor;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (predicted[axis] < 0.0f) {
+            fat.min[axis] += predicted[axis];
+        }
+        else {
+            fat.max[axis] += predicted[axis];
+        }
+    }
+    return fat;
+}
+
+// ── Node pool ───────────────────────────────────────────────────────────
+
+int32_t DynamicAABBTree::allocateNode()
+{
+    if (_freeList == kNullNode) {
+        _nodes.emplace_back();
+        return static_cast<int32_t>(_nodes.size() - 1);
+    }
+
+    const int32_t node = _freeList;
+    _freeList          = _nodes[node].parent;
+    _nodes[node]       = Node{};
+    return node;
+}
+
+void DynamicAABBTree::freeNode(int32_t node)
+{
+    _nodes[node].parent = _freeList;
+    _nodes[node].child1 = kNullNode;
+    _nodes[node].child2 = kNullNode;
+    _nodes[node].height = -1;
+    _freeList           = node;
+}
+
+// ── Structure ───────────────────────────────────────────────────────────
+
+void DynamicAABBTree::insertLeaf(int32_t leaf)
+{
+    if (_root == kNullNode) {
+        _root                = leaf;
+        _nodes[leaf].parent  = kNullNode;
+        return;
+    }
+
+    // Descend toward the sibling that minimizes the added surface area. The
+    // inherited cost is what every ancestor grows by if the leaf goes below it.
+    const AABB leafAABB = _nodes[leaf].aabb;
+    int32_t    index    = _root;
+    while (!_nodes[index].isLeaf()) {
+        const Node &node         = _nodes[index];
+        const float area         = surfaceArea(node.aabb);
+        const float combinedArea = surfaceArea(combine(node.aabb, leafAABB));
+
+        // Cost of making a new parent for this node and the leaf.
+        const float cost        = 2.0f * combinedArea;
+        const float inheritance = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int32_t child) {
+            const Node &childNode = _nodes[child];
+            const float merged    = surfaceArea(combine(childNode.aabb, leafAABB));
+            return (childNode.isLeaf() ? merged : merged - surfaceArea(childNode.aabb)) + inheritance;
+        };
+        const float cost1 = descendCost(node.child1);
+        const float cost2 = descendCost(node.child2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int32_t sibling   = index;
+    const int32_t oldParent = _nodes[sibling].parent;
+    const int32_t newParent = allocateNode();
+
+    Node &parentNode  = _nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.aabb   = combine(leafAABB, _nodes[sibling].aabb);
+    parentNode.height = _nodes[sibling].height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+
+    if (oldParent != kNullNode) {
+        Node &grandParent = _nodes[oldParent];
+        (grandParent.child1 == sibling ? grandParent.child1 : grandParent.child2) = newParent;
+    }
+    else {
+        _root = newParent;
+    }
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent    = newParent;
+
+    refitAncestors(oldParent, true);
+}
+
+void DynamicAABBTree::removeLeaf(int32_t leaf)
+{
+    if (leaf == _root) {
+        _root = kNullNode;
+        return;
+    }
+
+    const int32_t parent      = _nodes[leaf].parent;
+    const int32_t grandParent = _nodes[parent].parent;
+    const int32_t sibling     = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+
+    if (grandParent != kNullNode) {
+        Node &grandNode = _nodes[grandParent];
+        (grandNode.child1 == parent ? grandNode.child1 : grandNode.child2) = sibling;
+        _nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refitAncestors(grandParent, false);
+    }
+    else {
+        _root                  = sibling;
+        _nodes[sibling].parent = kNullNode;
+        freeNode(parent);
+    }
+    _nodes[leaf].parent = kNullNode;
+}
+
+void DynamicAABBTree::refitAncestors(int32_t index, bool bRotate)
+{
+    while (index != kNullNode) {
+        Node       &node   = _nodes[index];
+        const Node &child1 = _nodes[node.child1];
+        const Node &child2 = _nodes[node.child2];
+        node.aabb          = combine(child1.aabb, child2.aabb);
+        node.height        = 1 + std::max(child1.height, child2.height);
+
+        if (bRotate) {
+            rotate(index);
+        }
+        index = _nodes[index].parent;
+    }
+}
+
+void DynamicAABBTree::rotate(int32_t iA)
+{
+    // Try swapping one child of A with a grandchild on the other side. A's own
+    // box is unchanged by any swap, so only the rebuilt child's area matters.
+    //
+    //       A             A
+    //     /   \         /   \
+    //    B     C  -->  F     C'
+    //         / \           / \
+    //        F   G         B   G
+    Node &A = _nodes[iA];
+    if (A.height < 2) {
+        return;
+    }
+
+    const int32_t iB = A.child1;
+    const int32_t iC = A.child2;
+    Node         &B  = _nodes[iB];
+    Node         &C  = _nodes[iC];
+
+    enum class ERotation
+    {
+        None,
+        BF,
+        BG,
+        CD,
+        CE,
+    };
+
+    ERotation best     = ERotation::None;
+    float     bestCost = 0.0f;
+    auto      consider = [&](ERotation rotation, float cost) {
+        if (cost < bestCost) {
+            bestCost = cost;
+            best     = rotation;
+        }
+    };
+
+    // Costs below are the area of the internal node(s) the swap rebuilds; the
+    // untouched sibling subtree's area cancels out of the comparison.
+    if (B.height == 0) {
+        // C must be internal since A.height >= 2.
+        const Node &F = _nodes[C.child1];
+        const Node &G = _nodes[C.child2];
+        bestCost      = surfaceArea(C.aabb);
+        consider(ERotation::BF, surfaceArea(combine(B.aabb, G.aabb)));
+        consider(ERotation::BG, surfaceArea(combine(B.aabb, F.aabb)));
+    }
+    else if (C.height == 0) {
+        const Node &D = _nodes[B.child1];
+        const Node &E = _nodes[B.child2];
+        bestCost      = surfaceArea(B.aabb);
+        consider(ERotation::CD, surfaceArea(combine(C.aabb, E.aabb)));
+        consider(ERotation::CE, surfaceArea(combine(C.aabb, D.aabb)));
+    }
+    else {
+        const Node &D     = _nodes[B.child1];
+        const Node &E     = _nodes[B.child2];
+        const Node &F     = _nodes[C.child1];
+        const Node &G     = _nodes[C.child2];
+        const float areaB = surfaceArea(B.aabb);
+        const float areaC = surfaceArea(C.aabb);
+        bestCost          = areaB + areaC;
+        consider(ERotation::BF, areaB + surfaceArea(combine(B.aabb, G.aabb)));
+        consider(ERotation::BG, areaB + surfaceArea(combine(B.aabb, F.aabb)));
+        consider(ERotation::CD, areaC + surfaceArea(combine(C.aabb, E.aabb)));
+        consider(ERotation::CE, areaC + surfaceArea(combine(C.aabb, D.aabb)));
+    }
+
+    // Swap A's child `iOuter` with grandchild `iInner` under `iMid`, keeping
+    // `iKept` next to the moved child.
+    auto swap = [&](int32_t iOuter, int32_t iMid, int32_t iInner, int32_t iKept) {
+        Node &mid   = _nodes[iMid];
+        Node &outer = _nodes[iOuter];
+        Node &inner = _nodes[iInner];
+
+        (A.child1 == iOuter ? A.child1 : A.child2)       = iInner;
+        (mid.child1 == iInner ? mid.child1 : mid.child2) = iOuter;
+        outer.parent                                     = iMid;
+        inner.parent                                     = iA;
+
+        const Node &kept = _nodes[iKept];
+        mid.aabb         = combine(outer.aabb, kept.aabb);
+        mid.height       = 1 + std::max(outer.height, kept.height);
+        A.height         = 1 + std::max(mid.height, inner.height);
+    };
+
+    switch (best) {
+    case ERotation::None:
+        break;
+    case ERotation::BF:
+        swap(iB, iC, C.child1, C.child2);
+        break;
+    case ERotation::BG:
+        swap(iB, iC, C.child2, C.child1);
+        break;
+    case ERotation::CD:
+        swap(iC, iB, B.child1, B.child2);
+        break;
+    case ERotation::CE:
+        swap(iC, iB, B.child2, B.child1);
+        break;
+    }
+}
+
+// ── Diagnostics ─────────────────────────────────────────────────────────
+
+float DynamicAABBTree::getAreaRatio() const
+{
+    if (_root == kNullNode) {
+        return 0.0f;
+    }
+
+    const float rootArea = surfaceArea(_nodes[_root].aabb);
+    if (rootArea <= 0.0f) {
+        return 0.0f;
+    }
+
+    float totalArea = 0.0f;
+    for (const Node &node : _nodes) {
+        if (node.height > 0) {
+            totalArea += surfaceArea(node.aabb);
+        }
+    }
+    return totalArea / rootArea;
+}
+
+bool DynamicAABBTree::validate() const
+{
+    if (_root == kNullNode) {
+        return _proxyCount == 0;
+    }
+    if (_nodes[_root].parent != kNullNode) {
+        return false;
+    }
+
+    size_t               leafCount = 0;
+    std::vector<int32_t> stack{_root};
+    while (!stack.empty()) {
+        const int32_t index = stack.back();
+        stack.pop_back();
+        const Node &node = _nodes[index];
+
+        if (node.isLeaf()) {
+            if (node.height != 0 || node.child2 != kNullNode) {
+                return false;
+            }
+            ++leafCount;
+            continue;
+        }
+
+        const Node &child1 = _nodes[node.child1];
+        const Node &child2 = _nodes[node.child2];
+        if (child1.parent != index || child2.parent != index) {
+            return false;
+        }
+        if (node.height != 1 + std::max(child1.height, child2.height)) {
+            return false;
+        }
+        if (!contains(node.aabb, child1.aabb) || !contains(node.aabb, child2.aabb)) {
+            return false;
+        }
+        stack.push_back(node.child1);
+        stack.push_back(node.child2);
+    }
+    return leafCount == _proxyCount;
+}
+
+} // namespace ya
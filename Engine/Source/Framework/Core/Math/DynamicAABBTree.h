@@ -0,0 +1,330 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "Core/Math/AABB.h"
+#include "Core/Math/Frustum.h"
+#include "Core/Math/Ray.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ya
+{
+
+/**
+ * @brief Incremental bounding volume hierarchy over moving AABBs
+ *
+ * Leaves store "fat" boxes (tight bounds + margin, stretched along the last
+ * displacement), so a proxy that moves a little stays in place and costs only
+ * a containment test. Leaves that escape are removed and re-inserted:
+ *   - insertion descends by surface-area cost with inherited cost (SAH-style
+ *     branch selection), then refits the ancestors
+ *   - on the way up from an insertion every ancestor tries a tree rotation
+ *     that swaps a child with a grandchild when that shrinks the surface area
+ *
+ * Proxy ids are stable until destroyProxy() and index a node pool, so the
+ * caller can keep them in a component. Not thread-safe; queries are const and
+ * may run concurrently with each other.
+ */
+class YA_CORE_API DynamicAABBTree
+{
+  public:
+    static constexpr int32_t kNullNode = -1;
+
+    struct Settings
+    {
+        float margin             = 0.1f; // Absolute fattening on every side
+        float displacementFactor = 4.0f; // Fat box extends this many frames of motion ahead
+    };
+
+    DynamicAABBTree() = default;
+    explicit DynamicAABBTree(const Settings &settings) : _settings(settings) {}
+
+    /// Insert a proxy for `bounds`; `userData` is returned by getUserData().
+    int32_t createProxy(const AABB &bounds, uint64_t userData);
+
+    void destroyProxy(int32_t proxyId);
+
+    /**
+     * @brief Update a proxy after its bounds changed
+     * @param displacement Motion since the last update, used to predict the fat box
+     * @return true if the leaf was re-inserted (its fat box no longer fit)
+     */
+    bool moveProxy(int32_t proxyId, const AABB &bounds, const glm::vec3 &displacement = glm::vec3(0.0f));
+
+    void clear();
+
+    [[nodiscard]] uint64_t    getUserData(int32_t proxyId) const { return _nodes[proxyId].userData; }
+    [[nodiscard]] const AABB &getFatAABB(int32_t proxyId) const { return _nodes[proxyId].aabb; }
+    [[nodiscard]] size_t      getProxyCount() const { return _proxyCount; }
+    [[nodiscard]] int32_t     getHeight() const { return _root == kNullNode ? 0 : _nodes[_root].height; }
+
+    /// Sum of internal node surface areas over the root's; lower is a better tree.
+    [[nodiscard]] float getAreaRatio() const;
+
+    /// Check parent links, heights and that every parent encloses its children.
+    [[nodiscard]] bool validate() const;
+
+    // ── Queries ──────────────────────────────────────────────────────────
+    // Callbacks receive the proxy id and return false to stop the traversal.
+
+    /// Visit every live proxy in pool order (no spatial ordering).
+    template <typename Fn>
+    void forEachProxy(Fn &&fn) const;
+
+    template <typename Fn>
+    void query(const AABB &bounds, Fn &&fn) const;
+
+    /// Subtrees fully inside the frustum are reported without further plane tests.
+    template <typename Fn>
+    void queryFrustum(const Frustum &frustum, Fn &&fn) const;
+
+    template <typename Fn>
+    void querySphere(const glm::vec3 &center, float radius, Fn &&fn) const;
+
+    /**
+     * @brief Visit proxies whose fat box the ray enters before `maxDistance`
+     *
+     * `fn(proxyId, entryDistance)` returns the new clip distance: return the
+     * hit distance to only look for closer proxies, `maxDistance` to keep
+     * going, or a negative value to stop.
+     */
+    template <typename Fn>
+    void raycast(const Ray &ray, float maxDistance, Fn &&fn) const;
+
+  private:
+    struct Node
+    {
+        AABB     aabb;
+        uint64_t userData = 0;
+        int32_t  parent   = kNullNode; // Next free node while on the free list
+        int32_t  child1   = kNullNode;
+        int32_t  child2   = kNullNode;
+        int32_t  height   = -1; // 0 for leaves, -1 while free
+
+        [[nodiscard]] bool isLeaf() const { return child1 == kNullNode; }
+    };
+
+    /// Explicit traversal stack: fixed storage for typical depths, spills to the heap.
+    class TraversalStack
+    {
+      public:
+        void push(int32_t node)
+        {
+            if (_size < kInline) {
+                _inline[_size++] = node;
+                return;
+            }
+            _overflow.push_back(node);
+            ++_size;
+        }
+        int32_t pop()
+        {
+            --_size;
+            if (_size >= kInline) {
+                const int32_t node = _overflow.back();
+                _overflow.pop_back();
+                return node;
+            }
+            return _inline[_size];
+        }
+        [[nodiscard]] bool empty() const { return _size == 0; }
+
+      private:
+        static constexpr size_t kInline = 128;
+        int32_t                 _inline[kInline];
+        std::vector<int32_t>    _overflow;
+        size_t                  _size = 0;
+    };
+
+    int32_t allocateNode();
+    void    freeNode(int32_t node);
+    void    insertLeaf(int32_t leaf);
+    void    removeLeaf(int32_t leaf);
+    void    refitAncestors(int32_t node, bool bRotate);
+    void    rotate(int32_t node);
+    AABB    makeFatAABB(const AABB &bounds, const glm::vec3 &displacement) const;
+
+    template <typename Fn>
+    void reportSubtree(int32_t node, TraversalStack &stack, Fn &fn, bool &bContinue) const;
+
+    std::vector<Node> _nodes;
+    int32_t           _root       = kNullNode;
+    int32_t           _freeList   = kNullNode;
+    size_t            _proxyCount = 0;
+    Settings          _settings;
+};
+
+// ── Query templates ──────────────────────────────────────────────────────
+
+namespace detail
+{
+inline bool aabbOverlaps(const AABB &a, const AABB &b)
+{
+    return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+           a.min.y <= b.max.y && a.max.y >= b.min.y &&
+           a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+} // namespace detail
+
+template <typename Fn>
+void DynamicAABBTree::forEachProxy(Fn &&fn) const
+{
+    for (size_t index = 0; index < _nodes.size(); ++index) {
+        if (_nodes[index].height == 0 && !fn(static_cast<int32_t>(index))) {
+            return;
+        }
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::query(const AABB &bounds, Fn &&fn) const
+{
+    if (_root == kNullNode) {
+        return;
+    }
+    TraversalStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+        const int32_t index = stack.pop();
+        const Node   &node  = _nodes[index];
+        if (!detail::aabbOverlaps(node.aabb, bounds)) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            if (!fn(index)) {
+                return;
+            }
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::reportSubtree(int32_t subtree, TraversalStack &stack, Fn &fn, bool &bContinue) const
+{
+    // Uses the caller's stack above its current top; restores it on return.
+    int32_t pending = 1;
+    stack.push(subtree);
+    while (pending > 0 && bContinue) {
+        const int32_t index = stack.pop();
+        --pending;
+        const Node &node = _nodes[index];
+        if (node.isLeaf()) {
+            bContinue = fn(index);
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+        pending += 2;
+    }
+    while (pending-- > 0) {
+        stack.pop();
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::queryFrustum(const Frustum &frustum, Fn &&fn) const
+{
+    if (_root == kNullNode) {
+        return;
+    }
+    bool           bContinue = true;
+    TraversalStack stack;
+    stack.push(_root);
+    while (!stack.empty() && bContinue) {
+        const int32_t index = stack.pop();
+        const Node   &node  = _nodes[index];
+        switch (frustum.classify(node.aabb)) {
+        case Frustum::EContainment::Outside:
+            break;
+        case Frustum::EContainment::Inside:
+            reportSubtree(index, stack, fn, bContinue);
+            break;
+        case Frustum::EContainment::Intersects:
+            if (node.isLeaf()) {
+                bContinue = fn(index);
+            }
+            else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+            break;
+        }
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::querySphere(const glm::vec3 &center, float radius, Fn &&fn) const
+{
+    if (_root == kNullNode) {
+        return;
+    }
+    const float    radiusSq = radius * radius;
+    TraversalStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+        const int32_t   index   = stack.pop();
+        const Node     &node    = _nodes[index];
+        const glm::vec3 closest = glm::clamp(center, node.aabb.min, node.aabb.max);
+        const glm::vec3 delta   = closest - center;
+        if (glm::dot(delta, delta) > radiusSq) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            if (!fn(index)) {
+                return;
+            }
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::raycast(const Ray &ray, float maxDistance, Fn &&fn) const
+{
+    if (_root == kNullNode) {
+        return;
+    }
+    const glm::vec3 invDir = 1.0f / ray.direction;
+
+    // Slab test against the current clip distance; returns the entry distance.
+    auto enter = [&](const AABB &box, float clip, float &outEntry) {
+        const glm::vec3 t0   = (box.min - ray.origin) * invDir;
+        const glm::vec3 t1   = (box.max - ray.origin) * invDir;
+        const glm::vec3 tMin = glm::min(t0, t1);
+        const glm::vec3 tMax = glm::max(t0, t1);
+        const float     near = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+        const float     far  = std::min(std::min(tMax.x, tMax.y), std::min(tMax.z, clip));
+        outEntry             = near;
+        return near <= far;
+    };
+
+    TraversalStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+        const int32_t index = stack.pop();
+        const Node   &node  = _nodes[index];
+        float         entry = 0.0f;
+        if (!enter(node.aabb, maxDistance, entry)) {
+            continue;
+        }
+        if (node.isLeaf()) {
+            const float clip = fn(index, entry);
+            if (clip < 0.0f) {
+                return;
+            }
+            maxDistance = clip;
+            continue;
+        }
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+}
+
+} // namespace ya
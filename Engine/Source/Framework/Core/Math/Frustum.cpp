@@ -0,0 +1,351 @@
+#include "Frustum.h"
+
+#include "Core/Log.h"
+
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define YA_FRUSTUM_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <emmintrin.h>
+    #define YA_FRUSTUM_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define YA_FRUSTUM_NEON 1
+#endif
+
+namespace ya
+{
+
+namespace
+{
+
+// Large enough to pass every plane test, small enough that |n| * e stays finite.
+constexpr float kUnboundedExtent = 1.0e30f;
+
+struct PlaneSoA
+{
+    float nx[Frustum::Count], ny[Frustum::Count], nz[Frustum::Count], d[Frustum::Count];
+    float ax[Frustum::Count], ay[Frustum::Count], az[Frustum::Count]; // |normal|
+};
+
+PlaneSoA toPlaneSoA(const Frustum &frustum)
+{
+    PlaneSoA soa{};
+    for (size_t i = 0; i < Frustum::Count; ++i) {
+        const glm::vec4 &plane = frustum.planes[i];
+        soa.nx[i]              = plane.x;
+        soa.ny[i]              = plane.y;
+        soa.nz[i]              = plane.z;
+        soa.d[i]               = plane.w;
+        soa.ax[i]              = std::fabs(plane.x);
+        soa.ay[i]              = std::fabs(plane.y);
+        soa.az[i]              = std::fabs(plane.z);
+    }
+    return soa;
+}
+
+// Box is outside a plane when even its most positive corner is behind it:
+// dot(n, c) + d + dot(|n|, e) < 0.
+bool isVisibleScalar(const PlaneSoA &p, float cx, float cy, float cz, float ex, float ey, float ez)
+{
+    for (size_t i = 0; i < Frustum::Count; ++i) {
+        const float distance = p.nx[i] * cx + p.ny[i] * cy + p.nz[i] * cz + p.d[i];
+        const float radius   = p.ax[i] * ex + p.ay[i] * ey + p.az[i] * ez;
+        if (distance + radius < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t cullRangeScalar(const PlaneSoA &p, const FrustumCullBounds &b, size_t begin, size_t end, uint8_t *outVisible)
+{
+    size_t visibleCount = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const bool bVisible = isVisibleScalar(p, b.centerX[i], b.centerY[i], b.centerZ[i], b.extentX[i], b.extentY[i], b.extentZ[i]);
+        outVisible[i]       = bVisible ? 1 : 0;
+        visibleCount += bVisible ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+#if YA_FRUSTUM_AVX
+
+constexpr size_t kKernelWidth = 8;
+
+size_t cullRangeSimd(const PlaneSoA &p, const FrustumCullBounds &b, size_t count, uint8_t *outVisible)
+{
+    const size_t fullCount    = count & ~(kKernelWidth - 1);
+    size_t       visibleCount = 0;
+    for (size_t i = 0; i < fullCount; i += kKernelWidth) {
+        const __m256 cx = _mm256_loadu_ps(&b.centerX[i]);
+        const __m256 cy = _mm256_loadu_ps(&b.centerY[i]);
+        const __m256 cz = _mm256_loadu_ps(&b.centerZ[i]);
+        const __m256 ex = _mm256_loadu_ps(&b.extentX[i]);
+        const __m256 ey = _mm256_loadu_ps(&b.extentY[i]);
+        const __m256 ez = _mm256_loadu_ps(&b.extentZ[i]);
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (size_t plane = 0; plane < Frustum::Count; ++plane) {
+            __m256 distance = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(p.nx[plane]), cx),
+                                            _mm256_mul_ps(_mm256_set1_ps(p.ny[plane]), cy));
+            distance        = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(p.nz[plane]), cz));
+            distance        = _mm256_add_ps(distance, _mm256_set1_ps(p.d[plane]));
+            __m256 radius   = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(p.ax[plane]), ex),
+                                            _mm256_mul_ps(_mm256_set1_ps(p.ay[plane]), ey));
+            radius          = _mm256_add_ps(radius, _mm256_mul_ps(_mm256_set1_ps(p.az[plane]), ez));
+            inside          = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+
+        const int mask = _mm256_movemask_ps(inside);
+        for (size_t lane = 0; lane < kKernelWidth; ++lane) {
+            outVisible[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+        }
+        visibleCount += static_cast<size_t>(std::popcount(static_cast<uint32_t>(mask)));
+    }
+    return visibleCount + cullRangeScalar(p, b, fullCount, count, outVisible);
+}
+
+const char *kKernelName = "AVX";
+
+#elif YA_FRUSTUM_SSE2
+
+constexpr size_t kKernelWidth = 4;
+
+size_t cullRangeSimd(const PlaneSoA &p, const FrustumCullBounds &b, size_t count, uint8_t *outVisible)
+{
+    const size_t fullCount    = count & ~(kKernelWidth - 1);
+    size_t       visibleCount = 0;
+    for (size_t i = 0; i < fullCount; i += kKernelWidth) {
+        const __m128 cx = _mm_loadu_ps(&b.centerX[i]);
+        const __m128 cy = _mm_loadu_ps(&b.centerY[i]);
+        const __m128 cz = _mm_loadu_ps(&b.centerZ[i]);
+        const __m128 ex = _mm_loadu_ps(&b.extentX[i]);
+        const __m128 ey = _mm_loadu_ps(&b.extentY[i]);
+        const __m128 ez = _mm_loadu_ps(&b.extentZ[i]);
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (size_t plane = 0; plane < Frustum::Count; ++plane) {
+            __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.nx[plane]), cx),
+                                         _mm_mul_ps(_mm_set1_ps(p.ny[plane]), cy));
+            distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(p.nz[plane]), cz));
+            distance        = _mm_add_ps(distance, _mm_set1_ps(p.d[plane]));
+            __m128 radius   = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.ax[plane]), ex),
+                                         _mm_mul_ps(_mm_set1_ps(p.ay[plane]), ey));
+            radius          = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(p.az[plane]), ez));
+            inside          = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+        }
+
+        const int mask = _mm_movemask_ps(inside);
+        for (size_t lane = 0; lane < kKernelWidth; ++lane) {
+            outVisible[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+        }
+        visibleCount += static_cast<size_t>(std::popcount(static_cast<uint32_t>(mask)));
+    }
+    return visibleCount + cullRangeScalar(p, b, fullCount, count, outVisible);
+}
+
+const char *kKernelName = "SSE2";
+
+#elif YA_FRUSTUM_NEON
+
+constexpr size_t kKernelWidth = 4;
+
+size_t cullRangeSimd(const PlaneSoA &p, const FrustumCullBounds &b, size_t count, uint8_t *outVisible)
+{
+    const size_t fullCount    = count & ~(kKernelWidth - 1);
+    size_t       visibleCount = 0;
+    for (size_t i = 0; i < fullCount; i += kKernelWidth) {
+        const float32x4_t cx = vld1q_f32(&b.centerX[i]);
+        const float32x4_t cy = vld1q_f32(&b.centerY[i]);
+        const float32x4_t cz = vld1q_f32(&b.centerZ[i]);
+        const float32x4_t ex = vld1q_f32(&b.extentX[i]);
+        const float32x4_t ey = vld1q_f32(&b.extentY[i]);
+        const float32x4_t ez = vld1q_f32(&b.extentZ[i]);
+
+        uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+        for (size_t plane = 0; plane < Frustum::Count; ++plane) {
+            float32x4_t distance = vaddq_f32(vmulq_n_f32(cx, p.nx[plane]), vmulq_n_f32(cy, p.ny[plane]));
+            distance             = vaddq_f32(distance, vmulq_n_f32(cz, p.nz[plane]));
+            distance             = vaddq_f32(distance, vdupq_n_f32(p.d[plane]));
+            float32x4_t radius   = vaddq_f32(vmulq_n_f32(ex, p.ax[plane]), vmulq_n_f32(ey, p.ay[plane]));
+            radius               = vaddq_f32(radius, vmulq_n_f32(ez, p.az[plane]));
+            inside               = vandq_u32(inside, vcgeq_f32(vaddq_f32(distance, radius), vdupq_n_f32(0.0f)));
+        }
+
+        uint32_t lanes[kKernelWidth];
+        vst1q_u32(lanes, inside);
+        for (size_t lane = 0; lane < kKernelWidth; ++lane) {
+            outVisible[i + lane] = static_cast<uint8_t>(lanes[lane] & 1u);
+            visibleCount += lanes[lane] & 1u;
+        }
+    }
+    return visibleCount + cullRangeScalar(p, b, fullCount, count, outVisible);
+}
+
+const char *kKernelName = "NEON";
+
+#else
+
+size_t cullRangeSimd(const PlaneSoA &p, const FrustumCullBounds &b, size_t count, uint8_t *outVisible)
+{
+    return cullRangeScalar(p, b, 0, count, outVisible);
+}
+
+const char *kKernelName = "Scalar";
+
+#endif
+
+} // namespace
+
+// ── Frustum ─────────────────────────────────────────────────────────────
+
+Frustum Frustum::fromViewProjection(const glm::mat4 &viewProjection)
+{
+    // glm is column-major: row r of the matrix is (m[0][r], m[1][r], m[2][r], m[3][r]).
+    auto row = [&viewProjection](int r) {
+        return glm::vec4(viewProjection[0][r], viewProjection[1][r], viewProjection[2][r], viewProjection[3][r]);
+    };
+    const glm::vec4 row0 = row(0);
+    const glm::vec4 row1 = row(1);
+    const glm::vec4 row2 = row(2);
+    const glm::vec4 row3 = row(3);
+
+    Frustum frustum;
+    frustum.planes[Left]   = row3 + row0;
+    frustum.planes[Right]  = row3 - row0;
+    frustum.planes[Bottom] = row3 + row1;
+    frustum.planes[Top]    = row3 - row1;
+    frustum.planes[Near]   = row2; // [0, 1] depth; w + z would be the [-1, 1] plane
+    frustum.planes[Far]    = row3 - row2;
+
+    for (auto &plane : frustum.planes) {
+        const float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) {
+            plane /= length;
+        }
+    }
+    return frustum;
+}
+
+bool Frustum::intersects(const AABB &bounds) const
+{
+    if (!bounds.isValid()) {
+        return true;
+    }
+    const glm::vec3 center = bounds.getCenter();
+    const glm::vec3 extent = bounds.getExtent() * 0.5f;
+    return isVisibleScalar(toPlaneSoA(*this), center.x, center.y, center.z, extent.x, extent.y, extent.z);
+}
+
+Frustum::EContainment Frustum::classify(const AABB &bounds) const
+{
+    if (!bounds.isValid()) {
+        return EContainment::Intersects;
+    }
+    const glm::vec3 center = bounds.getCenter();
+    const glm::vec3 extent = bounds.getExtent() * 0.5f;
+
+    EContainment result = EContainment::Inside;
+    for (const glm::vec4 &plane : planes) {
+        const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        const float radius   = std::fabs(plane.x) * extent.x + std::fabs(plane.y) * extent.y + std::fabs(plane.z) * extent.z;
+        if (distance + radius < 0.0f) {
+            return EContainment::Outside;
+        }
+        if (distance - radius < 0.0f) {
+            result = EContainment::Intersects;
+        }
+    }
+    return result;
+}
+
+// ── FrustumCullBounds ───────────────────────────────────────────────────
+
+void FrustumCullBounds::clear()
+{
+    centerX.clear();
+    centerY.clear();
+    centerZ.clear();
+    extentX.clear();
+    extentY.clear();
+    extentZ.clear();
+    _count = 0;
+}
+
+void FrustumCullBounds::reserve(size_t count)
+{
+    centerX.reserve(count);
+    centerY.reserve(count);
+    centerZ.reserve(count);
+    extentX.reserve(count);
+    extentY.reserve(count);
+    extentZ.reserve(count);
+}
+
+void FrustumCullBounds::pushCenterExtent(float cx, float cy, float cz, float ex, float ey, float ez)
+{
+    centerX.push_back(cx);
+    centerY.push_back(cy);
+    centerZ.push_back(cz);
+    extentX.push_back(ex);
+    extentY.push_back(ey);
+    extentZ.push_back(ez);
+    ++_count;
+}
+
+void FrustumCullBounds::push(const AABB &worldBounds)
+{
+    if (!worldBounds.isValid()) {
+        pushCenterExtent(0.0f, 0.0f, 0.0f, kUnboundedExtent, kUnboundedExtent, kUnboundedExtent);
+        return;
+    }
+    const glm::vec3 center = worldBounds.getCenter();
+    const glm::vec3 extent = worldBounds.getExtent() * 0.5f;
+    pushCenterExtent(center.x, center.y, center.z, extent.x, extent.y, extent.z);
+}
+
+void FrustumCullBounds::pushTransformed(const AABB &localBounds, const glm::mat4 &world)
+{
+    if (!localBounds.isValid()) {
+        pushCenterExtent(0.0f, 0.0f, 0.0f, kUnboundedExtent, kUnboundedExtent, kUnboundedExtent);
+        return;
+    }
+    const glm::vec3 center = localBounds.getCenter();
+    const glm::vec3 extent = localBounds.getExtent() * 0.5f;
+
+    const glm::vec3 worldCenter = glm::vec3(world * glm::vec4(center, 1.0f));
+    const glm::vec3 worldExtent = glm::abs(glm::vec3(world[0])) * extent.x +
+                                  glm::abs(glm::vec3(world[1])) * extent.y +
+                                  glm::abs(glm::vec3(world[2])) * extent.z;
+    pushCenterExtent(worldCenter.x, worldCenter.y, worldCenter.z, worldExtent.x, worldExtent.y, worldExtent.z);
+}
+
+// ── FrustumCulling ──────────────────────────────────────────────────────
+
+namespace FrustumCulling
+{
+
+size_t cull(const Frustum &frustum, const FrustumCullBounds &bounds, std::span<uint8_t> outVisible)
+{
+    YA_CORE_ASSERT(outVisible.size() >= bounds.size(), "FrustumCulling::cull output span too small");
+    return cullRangeSimd(toPlaneSoA(frustum), bounds, bounds.size(), outVisible.data());
+}
+
+size_t cullScalar(const Frustum &frustum, const FrustumCullBounds &bounds, std::span<uint8_t> outVisible)
+{
+    YA_CORE_ASSERT(outVisible.size() >= bounds.size(), "FrustumCulling::cullScalar output span too small");
+    return cullRangeScalar(toPlaneSoA(frustum), bounds, 0, bounds.size(), outVisible.data());
+}
+
+const char *getKernelName()
+{
+    return kKernelName;
+}
+
+} // namespace FrustumCulling
+
+} // namespace ya
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "Core/Math/AABB.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ya
+{
+
+/**
+ * @brief View frustum as six inward-facing planes (xyz = normal, w = distance)
+ *
+ * A point p is inside a plane when dot(plane.xyz, p) + plane.w >= 0.
+ */
+struct YA_CORE_API Frustum
+{
+    enum EPlane : uint8_t
+    {
+        Left = 0,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        Count,
+    };
+
+    std::array<glm::vec4, EPlane::Count> planes{};
+
+    /**
+     * @brief Extract the planes from a projection * view matrix (Gribb-Hartmann)
+     *
+     * Expects the engine's [0, 1] clip depth (FMath::perspective /
+     * FMath::orthographic), so the near plane is z >= 0.
+     */
+    static Frustum fromViewProjection(const glm::mat4 &viewProjection);
+
+    enum class EContainment : uint8_t
+    {
+        Outside,
+        Intersects,
+        Inside,
+    };
+
+    /// Scalar reference test; conservative (may report boxes near corners as visible).
+    [[nodiscard]] bool intersects(const AABB &bounds) const;
+
+    /// Like intersects(), but also reports boxes fully inside every plane.
+    [[nodiscard]] EContainment classify(const AABB &bounds) const;
+};
+
+/**
+ * @brief World-space bounds in SoA layout (center + half extent) for batch culling
+ */
+struct YA_CORE_API FrustumCullBounds
+{
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;
+
+    void clear();
+    void reserve(size_t count);
+
+    [[nodiscard]] size_t size() const { return _count; }
+
+    /// Append world bounds; invalid (empty) boxes are treated as always visible.
+    void push(const AABB &worldBounds);
+
+    /**
+     * @brief Append `localBounds` transformed by `world` without expanding 8 corners
+     *
+     * Uses the center/extent form (Arvo): center' = M * center,
+     * extent' = |M3x3| * extent. Same result as AABB::transformed for affine M.
+     */
+    void pushTransformed(const AABB &localBounds, const glm::mat4 &world);
+
+  private:
+    void pushCenterExtent(float cx, float cy, float cz, float ex, float ey, float ez);
+
+    size_t _count = 0;
+};
+
+namespace FrustumCulling
+{
+
+/**
+ * @brief Test every box in `bounds` against `frustum`
+ * @param outVisible Receives 1 (visible) or 0 (culled) per box, size >= bounds.size()
+ * @return Number of visible boxes
+ *
+ * 8-wide with AVX, 4-wide with SSE2/NEON, scalar otherwise. All paths agree
+ * with cullScalar except possibly for boxes exactly touching a plane.
+ */
+YA_CORE_API size_t cull(const Frustum &frustum, const FrustumCullBounds &bounds, std::span<uint8_t> outVisible);
+
+/// Scalar reference implementation of cull().
+YA_CORE_API size_t cullScalar(const Frustum &frustum, const FrustumCullBounds &bounds, std::span<uint8_t> outVisible);
+
+/// Name of the kernel cull() dispatches to ("AVX", "SSE2", "NEON" or "Scalar").
+YA_CORE_API const char *getKernelName();
+
+} // namespace FrustumCulling
+
+} // namespace ya
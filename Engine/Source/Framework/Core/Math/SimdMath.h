@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Core/Math/GLM.h"
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <xmmintrin.h>
+    #define YA_MATH_SSE 1
+#endif
+
+namespace ya::simd_math
+{
+
+/**
+ * @brief out = a * b for column-major glm matrices
+ *
+ * Used by the hierarchy walks (transforms, skeleton poses) that multiply one
+ * matrix per node. @p out may not alias @p a or @p b.
+ */
+inline void multiplyMat4(const glm::mat4 &a, const glm::mat4 &b, glm::mat4 &out)
+{
+#if YA_MATH_SSE
+    const __m128 a0 = _mm_loadu_ps(&a[0][0]);
+    const __m128 a1 = _mm_loadu_ps(&a[1][0]);
+    const __m128 a2 = _mm_loadu_ps(&a[2][0]);
+    const __m128 a3 = _mm_loadu_ps(&a[3][0]);
+    for (int column = 0; column < 4; ++column) {
+        // out[c] = a[0] * b[c].x + a[1] * b[c].y + a[2] * b[c].z + a[3] * b[c].w
+        __m128 r = _mm_mul_ps(a0, _mm_set1_ps(b[column][0]));
+        r        = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(b[column][1])));
+        r        = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(b[column][2])));
+        r        = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(b[column][3])));
+        _mm_storeu_ps(&out[column][0], r);
+    }
+#else
+    out = a * b;
+#endif
+}
+
+} // namespace ya::simd_math
@@ -12,6 +12,18 @@
 namespace ya
 {
 
+Instrumentor::Instrumentor()
+    : m_Ring(std::make_unique<InstrumentorRingBackend>())
+{
+}
+
+Instrumentor::~Instrumentor()
+{
+    if (m_SessionActive) {
+        EndSession();
+    }
+}
+
 /**
  * @brief Start a profiling session
  *
@@ -43,17 +55,25 @@ void Instrumentor::BeginSession(const std::string &name, const std::string &file
         return;
     }
 
-    m_SessionActive    = true;
     m_SessionStartTime = std::chrono::steady_clock::now();
     m_EventCount       = 0;
-    m_DroppedEvents    = 0;
+    m_DroppedScopes    = 0;
     m_Events.clear();
     m_Frames.clear();
     m_FrameIndexMap.clear();
 
-    // Reserve capacity to reduce allocations
-    m_Events.reserve(10000);
-    m_Frames.reserve(1000);
+    m_ActiveBackend = m_Config.backend;
+    if (m_ActiveBackend == EInstrumentorBackend::ThreadRing) {
+        m_Ring->beginSession();
+    }
+    else {
+        // Reserve capacity to reduce allocations
+        m_Events.reserve(10000);
+        m_Frames.reserve(1000);
+    }
+
+    // Publishes m_ActiveBackend to the recording threads.
+    m_SessionActive.store(true, std::memory_order_release);
 
     YA_CORE_INFO("Instrumentor: Session '{}' started, writing to '{}'", name, filepath);
 }
@@ -79,6 +99,16 @@ void Instrumentor::EndSessionInternal()
 
     const std::string finishedSessionName = m_SessionName;
 
+    if (m_ActiveBackend == EInstrumentorBackend::ThreadRing) {
+        // Stop capture first; scopes still in flight land in the rings and are
+        // discarded by the next session.
+        m_SessionActive.store(false, std::memory_order_release);
+        m_Ring->endSession();
+        m_Ring->exportSession(m_Events, m_Frames, m_Config.bIncludeSourceInfo);
+        m_EventCount += m_Ring->getRecordedCount();
+        m_DroppedScopes += m_Ring->getDroppedCount();
+    }
+
     // Write speedscope JSON format if file stream is open
     if (m_OutputStream.is_open()) {
         WriteSpeedscopeJson();
@@ -117,10 +147,10 @@ void Instrumentor::EndSessionInternal()
 
     m_SessionActive = false;
 
-    YA_CORE_INFO("Instrumentor: Session '{}' ended. {} events recorded, {} dropped",
+    YA_CORE_INFO("Instrumentor: Session '{}' ended. {} events recorded, {} scopes dropped",
                  finishedSessionName,
                  m_EventCount.load(),
-                 m_DroppedEvents.load());
+                 m_DroppedScopes.load());
 }
 
 
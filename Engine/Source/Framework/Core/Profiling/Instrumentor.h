@@ -18,8 +18,10 @@
 #include <thread>
 #include <vector>
 
+#include "Core/FName.h"
 #include "Core/Log.h"
 #include "Core/Macro/VariadicMacros.h"
+#include "Core/Profiling/InstrumentorRing.h"
 
 namespace ya
 {
@@ -65,12 +67,22 @@ struct SpeedscopeFrame
     int         line; // Source line (optional)
 };
 
+/**
+ * @brief Event capture backend, selected per session at BeginSession
+ */
+enum class EInstrumentorBackend : uint8_t
+{
+    Locked,     // Legacy: global mutex + shared event vector per scope
+    ThreadRing, // Per-thread SPSC rings drained by a background thread
+};
+
 /**
  * @brief Configuration options for the profiler
  */
 struct ProfilerConfig
 {
-    bool bIncludeSourceInfo = true; // Include file:line in frame names
+    bool                 bIncludeSourceInfo = true; // Include file:line in frame names
+    EInstrumentorBackend backend            = EInstrumentorBackend::ThreadRing;
 };
 
 //=============================================================================
@@ -93,7 +105,8 @@ struct YA_CORE_API Instrumentor
 {
   private:
     // Session state
-    bool          m_SessionActive = false;
+    std::atomic<bool>    m_SessionActive{false};
+    EInstrumentorBackend m_ActiveBackend = EInstrumentorBackend::Locked; // Written before m_SessionActive
     std::string   m_SessionName;
     std::ofstream m_OutputStream;
 
@@ -116,16 +129,19 @@ struct YA_CORE_API Instrumentor
 
     // Statistics
     std::atomic<size_t> m_EventCount{0};
-    std::atomic<size_t> m_DroppedEvents{0};
+    std::atomic<size_t> m_DroppedScopes{0}; // Scopes, not events: a dropped scope records nothing
+
+    // Lock-free capture backend (EInstrumentorBackend::ThreadRing)
+    std::unique_ptr<InstrumentorRingBackend> m_Ring;
 
   public:
-    Instrumentor() = default;
-    ~Instrumentor()
-    {
-        if (m_SessionActive) {
-            EndSession();
-        }
-    }
+    static constexpr uint32_t kInvalidFrameIndex = static_cast<uint32_t>(-1);
+    // Tags frame indices handed out by the ring backend so their end event is
+    // routed back to it even if the session/backend changed in between.
+    static constexpr uint32_t kRingFrameBit = 0x80000000u;
+
+    Instrumentor();
+    ~Instrumentor();
 
     // Prevent copying
     Instrumentor(const Instrumentor &)            = delete;
@@ -146,17 +162,43 @@ struct YA_CORE_API Instrumentor
     /**
      * @brief Record a begin event for a scope/function
      *
-     * @param name Scope/function name
-     * @param file Source file (optional)
+     * @param name Scope/function name with a stable address (literal, __PRETTY_FUNCTION__)
+     * @param file Source file with a stable address (std::source_location::file_name())
      * @param line Source line (optional)
      * @return Frame index for use with WriteEndEvent
      */
-    uint32_t WriteBeginEvent(const std::string &name, const std::string &file = "", int line = 0)
+    uint32_t WriteBeginEvent(const char *name, const char *file = "", int line = 0)
+    {
+        if (!m_SessionActive.load(std::memory_order_acquire)) {
+            return kInvalidFrameIndex;
+        }
+        if (m_ActiveBackend == EInstrumentorBackend::ThreadRing) {
+            const uint32_t frame = m_Ring->writeBegin(name, file, line);
+            return frame == InstrumentorRingBackend::kInvalidFrame ? kInvalidFrameIndex : (frame | kRingFrameBit);
+        }
+        return WriteBeginEventLocked(name, file ? file : "", line);
+    }
+
+    /**
+     * @brief Record a begin event for a runtime-built name
+     *
+     * The ring backend keys frames by address, so the name is interned as an
+     * FName first (stable storage for the program lifetime).
+     */
+    uint32_t WriteBeginEvent(const std::string &name, const char *file = "", int line = 0)
     {
-        if (!m_SessionActive) {
-            return static_cast<uint32_t>(-1);
+        if (!m_SessionActive.load(std::memory_order_acquire)) {
+            return kInvalidFrameIndex;
+        }
+        if (m_ActiveBackend == EInstrumentorBackend::ThreadRing) {
+            return WriteBeginEvent(FName(name).c_str(), file, line);
         }
+        return WriteBeginEventLocked(name, file ? file : "", line);
+    }
 
+  private:
+    uint32_t WriteBeginEventLocked(const std::string &name, const std::string &file, int line)
+    {
         std::lock_guard<std::mutex> lock(m_Mutex);
 
         uint32_t frameIndex = GetOrCreateFrame(name, file, line);
@@ -182,6 +224,7 @@ struct YA_CORE_API Instrumentor
         return frameIndex;
     }
 
+  public:
     /**
      * @brief Record an end event for a scope/function (no console output)
      *
@@ -199,7 +242,7 @@ struct YA_CORE_API Instrumentor
      * @param durationNs Duration in nanoseconds
      * @param name Name for console output
      */
-    void WriteEndEventLog(int frameIndex, long long durationNs, const std::string &name)
+    void WriteEndEventLog(uint32_t frameIndex, long long durationNs, const std::string &name)
     {
         // Always print to console regardless of config
         if (!name.empty() && durationNs > 0) {
@@ -224,7 +267,16 @@ struct YA_CORE_API Instrumentor
      */
     void WriteEndEventInternal(uint32_t frameIndex)
     {
-        if (!m_SessionActive || frameIndex < 0) {
+        if (frameIndex == kInvalidFrameIndex) {
+            return;
+        }
+        // Ring scopes always close, even after the session ended: the ring
+        // reserved the slot and must release it.
+        if (frameIndex & kRingFrameBit) {
+            m_Ring->writeEnd(frameIndex & ~kRingFrameBit);
+            return;
+        }
+        if (!m_SessionActive.load(std::memory_order_acquire)) {
             return;
         }
 
@@ -271,11 +323,18 @@ struct YA_CORE_API Instrumentor
 
     /**
      * @brief Get profiling statistics
+     * @param eventCount    Open / close events recorded
+     * @param droppedScopes Scopes the ring backend dropped whole (they recorded no events)
      */
-    void GetStats(size_t &eventCount, size_t &droppedEvents) const
+    void GetStats(size_t &eventCount, size_t &droppedScopes) const
     {
         eventCount    = m_EventCount.load();
-        droppedEvents = m_DroppedEvents.load();
+        droppedScopes = m_DroppedScopes.load();
+        // Live ring counters (folded into the totals above at EndSession).
+        if (m_SessionActive.load(std::memory_order_acquire) && m_ActiveBackend == EInstrumentorBackend::ThreadRing) {
+            eventCount += m_Ring->getRecordedCount();
+            droppedScopes += m_Ring->getDroppedCount();
+        }
     }
 
     /**
@@ -467,8 +526,8 @@ struct InstrumentationTimer
      */
     explicit InstrumentationTimer(const std::string   &name,
                                   std::source_location loc = std::source_location::current())
-        : InstrumentationTimer(name.c_str(), loc)
     {
+        m_FrameIndex = Instrumentor::Get().WriteBeginEvent(name, loc.file_name(), static_cast<int>(loc.line()));
     }
 
     /**
@@ -530,7 +589,7 @@ struct InstrumentationTimerLog
     std::string                      m_File;
     int                              m_Line;
     std::chrono::time_point<clock_t> m_StartTime;
-    int                              m_FrameIndex;
+    uint32_t                         m_FrameIndex;
     bool                             m_Stopped = false;
 
   public:
@@ -550,7 +609,7 @@ struct InstrumentationTimerLog
                                      std::source_location loc = std::source_location::current())
         : m_Name(name), m_File(loc.file_name()), m_Line(static_cast<int>(loc.line())), m_StartTime(clock_t::now())
     {
-        m_FrameIndex = Instrumentor::Get().WriteBeginEvent(m_Name, m_File, m_Line);
+        m_FrameIndex = Instrumentor::Get().WriteBeginEvent(m_Name, loc.file_name(), m_Line);
     }
 
     ~InstrumentationTimerLog()
@@ -605,9 +664,9 @@ struct InstrumentationTimerConditional
     using clock_t = std::chrono::steady_clock;
 
   private:
-    int  m_FrameIndex = -1;
-    bool m_Enabled    = false;
-    bool m_Stopped    = false;
+    uint32_t m_FrameIndex = Instrumentor::kInvalidFrameIndex;
+    bool     m_Enabled    = false;
+    bool     m_Stopped    = false;
 
   public:
     /**
@@ -619,8 +678,11 @@ struct InstrumentationTimerConditional
     explicit InstrumentationTimerConditional(bool                 enabled,
                                              const std::string   &name,
                                              std::source_location loc = std::source_location::current())
-        : InstrumentationTimerConditional(enabled, name.c_str(), loc)
+        : m_Enabled(enabled)
     {
+        if (m_Enabled) {
+            m_FrameIndex = Instrumentor::Get().WriteBeginEvent(name, loc.file_name(), static_cast<int>(loc.line()));
+        }
     }
 
     explicit InstrumentationTimerConditional(bool                 enabled,
@@ -652,7 +714,7 @@ struct InstrumentationTimerConditional
             return;
         }
 
-        if (m_Enabled && m_FrameIndex >= 0) {
+        if (m_Enabled && m_FrameIndex != Instrumentor::kInvalidFrameIndex) {
             Instrumentor::Get().WriteEndEvent(m_FrameIndex);
         }
 
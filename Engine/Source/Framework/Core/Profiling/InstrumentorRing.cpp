@@ -0,0 +1,490 @@
+#include "InstrumentorRing.h"
+
+#include "Core/Async/LockFreeQueue.h"
+#include "Core/Profiling/Instrumentor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+    #include <intrin.h>
+    #define YA_PROFILER_HAS_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #include <x86intrin.h>
+    #define YA_PROFILER_HAS_TSC 1
+#else
+    #define YA_PROFILER_HAS_TSC 0
+#endif
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr size_t kRingCapacity   = 1u << 15; // Records per thread (16 B each → 512 KiB)
+constexpr size_t kRingUsable     = kRingCapacity - 1;
+constexpr size_t kFrameCacheSize = 256; // Power of two
+constexpr size_t kFrameCacheProbe = 8;
+constexpr auto   kDrainInterval  = std::chrono::milliseconds(2);
+
+struct ProfileRecord
+{
+    uint64_t ticks;
+    uint32_t frameId;
+    uint32_t bBegin;
+};
+static_assert(sizeof(ProfileRecord) == 16);
+
+int64_t steadyNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string makeFrameKey(std::string_view name, std::string_view file, int line)
+{
+    std::string key;
+    key.reserve(name.size() + file.size() + 16);
+    key.append(name);
+    key.push_back('\x1f');
+    key.append(file);
+    key.push_back('\x1f');
+    key.append(std::to_string(line));
+    return key;
+}
+
+} // namespace
+
+uint64_t ProfilerClock::now()
+{
+#if YA_PROFILER_HAS_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+struct InstrumentorRingBackend::ThreadRing
+{
+    struct FrameCacheEntry
+    {
+        const char *name    = nullptr;
+        const char *file    = nullptr;
+        int         line    = 0;
+        uint32_t    frameId = kInvalidFrame;
+    };
+
+    uint32_t threadIndex = 0;
+
+    // ── Producer side (owning thread only) ───────────────────────────────
+    SPSCQueue<ProfileRecord, kRingCapacity> queue;
+    uint32_t                                reservedEnds = 0; // Slots held for ends of open scopes
+    FrameCacheEntry                         frameCache[kFrameCacheSize];
+    std::atomic<size_t>                     dropped{0};
+    std::atomic<bool>                       bRetired{false}; // Owning thread will not push again
+
+    // ── Consumer side (drain thread, then EndSession) ────────────────────
+    std::vector<ProfileRecord> drained;
+};
+
+struct InstrumentorRingBackend::RetiredRing
+{
+    uint32_t                   threadIndex = 0;
+    std::vector<ProfileRecord> drained;
+};
+
+namespace
+{
+std::atomic<uint64_t> g_nextBackendId{1};
+
+thread_local uint64_t tl_ringOwner      = 0; // Instance id, 0 = none
+thread_local void    *tl_ring           = nullptr;
+thread_local bool     tl_bRingsTornDown = false;
+} // namespace
+
+/// Holds the calling thread's current ring and retires it when the thread
+/// exits. Shared ownership keeps the flag writable even if the backend that
+/// registered the ring is already gone.
+struct InstrumentorRingBackend::ThreadRingGuard
+{
+    std::shared_ptr<ThreadRing> ring;
+
+    ~ThreadRingGuard()
+    {
+        tl_bRingsTornDown = true;
+        tl_ringOwner      = 0;
+        tl_ring           = nullptr;
+        retire();
+    }
+
+    void retire()
+    {
+        if (ring) {
+            ring->bRetired.store(true, std::memory_order_release);
+            ring.reset();
+        }
+    }
+};
+
+InstrumentorRingBackend::InstrumentorRingBackend()
+    : _instanceId(g_nextBackendId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+InstrumentorRingBackend::~InstrumentorRingBackend() { endSession(); }
+
+InstrumentorRingBackend::ThreadRing *InstrumentorRingBackend::acquireThreadRing()
+{
+    if (tl_ringOwner == _instanceId) {
+        return static_cast<ThreadRing *>(tl_ring);
+    }
+    if (tl_bRingsTornDown) {
+        return nullptr; // Scope recorded from a later thread_local destructor
+    }
+
+    // A thread writes to one backend at a time; switching retires the old ring.
+    thread_local ThreadRingGuard guard;
+    guard.retire();
+
+    auto ring = std::make_shared<ThreadRing>();
+    ring->drained.reserve(4096);
+    {
+        std::lock_guard lock(_ringsMutex);
+        ring->threadIndex = _nextThreadIndex++;
+        _rings.push_back(ring);
+    }
+    guard.ring   = ring;
+    tl_ringOwner = _instanceId;
+    tl_ring      = ring.get();
+    return ring.get();
+}
+
+uint32_t InstrumentorRingBackend::resolveFrame(ThreadRing &ring, const char *name, const char *file, int line)
+{
+    // Thread-local pointer cache: names/files have stable addresses, so the
+    // address pair + line identifies the frame without touching the string.
+    const size_t hash = (reinterpret_cast<uintptr_t>(name) >> 3) * 0x9E3779B97F4A7C15ull ^
+                        (reinterpret_cast<uintptr_t>(file) >> 3) ^ static_cast<size_t>(line);
+    ThreadRing::FrameCacheEntry *freeEntry = nullptr;
+    for (size_t probe = 0; probe < kFrameCacheProbe; ++probe) {
+        auto &entry = ring.frameCache[(hash + probe) & (kFrameCacheSize - 1)];
+        if (entry.name == name && entry.file == file && entry.line == line) {
+            return entry.frameId;
+        }
+        if (!entry.name) {
+            freeEntry = &entry;
+            break;
+        }
+    }
+
+    // Miss: content-keyed registry (shared by all threads, rare).
+    uint32_t frameId = kInvalidFrame;
+    {
+        const std::string_view fileView = file ? std::string_view(file) : std::string_view();
+        std::string            key      = makeFrameKey(name, fileView, line);
+
+        std::lock_guard lock(_framesMutex);
+        if (auto it = _frameIds.find(key); it != _frameIds.end()) {
+            frameId = it->second;
+        }
+        else {
+            frameId = static_cast<uint32_t>(_frames.size());
+            _frames.push_back(FrameInfo{
+                .name = std::string(name),
+                .file = std::string(fileView),
+                .line = line,
+            });
+            _frameIds.emplace(std::move(key), frameId);
+        }
+    }
+
+    if (freeEntry) {
+        *freeEntry = ThreadRing::FrameCacheEntry{
+            .name    = name,
+            .file    = file,
+            .line    = line,
+            .frameId = frameId,
+        };
+    }
+    return frameId;
+}
+
+uint32_t InstrumentorRingBackend::writeBegin(const char *name, const char *file, int line)
+{
+    ThreadRing *ringPtr = acquireThreadRing();
+    if (!ringPtr) {
+        return kInvalidFrame;
+    }
+    ThreadRing &ring = *ringPtr;
+
+    // Need this record plus the matching end; otherwise drop the whole scope.
+    if (ring.queue.sizeApprox() + ring.reservedEnds + 2 > kRingUsable) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return kInvalidFrame;
+    }
+
+    const uint32_t frameId = resolveFrame(ring, name, file, line);
+    ring.queue.tryPush(ProfileRecord{
+        .ticks   = ProfilerClock::now(),
+        .frameId = frameId,
+        .bBegin  = 1,
+    });
+    ++ring.reservedEnds;
+    return frameId;
+}
+
+void InstrumentorRingBackend::writeEnd(uint32_t frameId)
+{
+    if (frameId == kInvalidFrame) {
+        return;
+    }
+
+    ThreadRing *ring = acquireThreadRing();
+    if (!ring) {
+        return;
+    }
+    if (ring->reservedEnds > 0) {
+        --ring->reservedEnds;
+    }
+    // Cannot fail: writeBegin reserved this slot.
+    ring->queue.tryPush(ProfileRecord{
+        .ticks   = ProfilerClock::now(),
+        .frameId = frameId,
+        .bBegin  = 0,
+    });
+}
+
+void InstrumentorRingBackend::drainAll(bool bDiscard)
+{
+    std::vector<ThreadRing *> rings;
+    {
+        std::lock_guard lock(_ringsMutex);
+        rings.reserve(_rings.size());
+        for (auto &ring : _rings) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    size_t                    drainedCount = 0;
+    std::vector<ThreadRing *> retired;
+    for (ThreadRing *ring : rings) {
+        // Checked before popping: a retired ring gets no more pushes, so this
+        // drain is its last one.
+        if (ring->bRetired.load(std::memory_order_acquire)) {
+            retired.push_back(ring);
+        }
+        while (auto record = ring->queue.tryPop()) {
+            if (!bDiscard) {
+                ring->drained.push_back(*record);
+                ++drainedCount;
+            }
+        }
+    }
+    _recordedCount.fetch_add(drainedCount, std::memory_order_relaxed);
+
+    if (!retired.empty()) {
+        releaseRetiredRings(retired);
+    }
+}
+
+void InstrumentorRingBackend::releaseRetiredRings(const std::vector<ThreadRing *> &retired)
+{
+    std::lock_guard lock(_ringsMutex);
+    for (ThreadRing *ring : retired) {
+        auto it = std::ranges::find_if(_rings, [ring](const auto &entry) { return entry.get() == ring; });
+        if (it == _rings.end()) {
+            continue;
+        }
+        // Keep what the session already collected; the ring itself goes.
+        _retiredDropped += ring->dropped.load(std::memory_order_relaxed);
+        if (!ring->drained.empty()) {
+            _retiredRings.push_back(RetiredRing{
+                .threadIndex = ring->threadIndex,
+                .drained     = std::move(ring->drained),
+            });
+        }
+        _rings.erase(it);
+    }
+}
+
+void InstrumentorRingBackend::drainLoop()
+{
+    std::unique_lock lock(_drainMutex);
+    while (_bDraining) {
+        lock.unlock();
+        drainAll(false);
+        lock.lock();
+        _drainCondition.wait_for(lock, kDrainInterval, [this]() { return !_bDraining; });
+    }
+}
+
+void InstrumentorRingBackend::beginSession()
+{
+    endSession();
+
+    // Records written between sessions (late scope ends) belong to nobody.
+    drainAll(true);
+    {
+        std::lock_guard lock(_ringsMutex);
+        for (auto &ring : _rings) {
+            ring->drained.clear();
+            ring->dropped.store(0, std::memory_order_relaxed);
+        }
+        _retiredRings.clear();
+        _retiredDropped = 0;
+    }
+    _recordedCount.store(0, std::memory_order_relaxed);
+
+    _sessionStartSteady = steadyNowNs();
+    _sessionStartTicks  = ProfilerClock::now();
+
+    {
+        std::lock_guard lock(_drainMutex);
+        _bDraining = true;
+    }
+    _drainThread = std::thread([this]() { drainLoop(); });
+}
+
+void InstrumentorRingBackend::endSession()
+{
+    {
+        std::lock_guard lock(_drainMutex);
+        if (!_bDraining) {
+            return;
+        }
+        _bDraining = false;
+    }
+    _drainCondition.notify_all();
+    if (_drainThread.joinable()) {
+        _drainThread.join();
+    }
+
+    // This thread is the only consumer now.
+    drainAll(false);
+
+    _sessionEndTicks            = ProfilerClock::now();
+    const int64_t  elapsedNs    = steadyNowNs() - _sessionStartSteady;
+    const uint64_t elapsedTicks = _sessionEndTicks - _sessionStartTicks;
+    _microsecondsPerTick        = elapsedTicks > 0 ? (static_cast<double>(elapsedNs) / 1000.0) / static_cast<double>(elapsedTicks) : 0.0;
+}
+
+size_t InstrumentorRingBackend::getDroppedCount() const
+{
+    std::lock_guard lock(_ringsMutex);
+    size_t          dropped = _retiredDropped;
+    for (const auto &ring : _rings) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+size_t InstrumentorRingBackend::getThreadRingCount() const
+{
+    std::lock_guard lock(_ringsMutex);
+    return _rings.size();
+}
+
+void InstrumentorRingBackend::exportSession(std::vector<SpeedscopeEvent> &outEvents,
+                                            std::vector<SpeedscopeFrame> &outFrames,
+                                            bool                          bIncludeSourceInfo) const
+{
+    {
+        std::lock_guard lock(_framesMutex);
+        outFrames.clear();
+        outFrames.reserve(_frames.size());
+        for (const FrameInfo &frame : _frames) {
+            std::string fullName = frame.name;
+            if (bIncludeSourceInfo && !frame.file.empty()) {
+                fullName = std::format("{}:{} ({})",
+                                       std::filesystem::path(frame.file).filename().string(),
+                                       frame.line,
+                                       frame.name);
+            }
+            outFrames.push_back({
+                .name = std::move(fullName),
+                .file = frame.file,
+                .line = frame.line,
+            });
+        }
+    }
+
+    auto toMicroseconds = [this](uint64_t ticks) {
+        const double delta = static_cast<double>(static_cast<int64_t>(ticks - _sessionStartTicks));
+        return std::max(0.0, delta * _microsecondsPerTick);
+    };
+
+    std::lock_guard lock(_ringsMutex);
+    size_t          total = 0;
+    for (const auto &ring : _rings) {
+        total += ring->drained.size();
+    }
+    for (const RetiredRing &ring : _retiredRings) {
+        total += ring.drained.size();
+    }
+    outEvents.clear();
+    outEvents.reserve(total);
+
+    // Scopes still open at EndSession are closed at the session's last
+    // timestamp, across every thread, not at their own thread's last record.
+    uint64_t lastTicks = _sessionStartTicks;
+    auto     trackLast = [&lastTicks](const std::vector<ProfileRecord> &drained) {
+        if (!drained.empty()) {
+            lastTicks = std::max(lastTicks, drained.back().ticks);
+        }
+    };
+    for (const RetiredRing &ring : _retiredRings) {
+        trackLast(ring.drained);
+    }
+    for (const auto &ring : _rings) {
+        trackLast(ring->drained);
+    }
+    const double lastAt = toMicroseconds(lastTicks);
+
+    std::vector<uint32_t> openFrames;
+    auto                  exportThread = [&](uint32_t threadIndex, const std::vector<ProfileRecord> &drained) {
+        if (drained.empty()) {
+            return;
+        }
+
+        const std::string tid = std::to_string(threadIndex);
+        openFrames.clear();
+        for (const ProfileRecord &record : drained) {
+            if (record.bBegin) {
+                openFrames.push_back(record.frameId);
+            }
+            else if (openFrames.empty()) {
+                continue; // Scope opened before the session started.
+            }
+            else {
+                openFrames.pop_back();
+            }
+            outEvents.push_back({
+                .type       = record.bBegin ? SpeedscopeEvent::Type::Open : SpeedscopeEvent::Type::Close,
+                .frameIndex = record.frameId,
+                .at         = toMicroseconds(record.ticks),
+                .tid        = tid,
+            });
+        }
+
+        while (!openFrames.empty()) {
+            outEvents.push_back({
+                .type       = SpeedscopeEvent::Type::Close,
+                .frameIndex = openFrames.back(),
+                .at         = lastAt,
+                .tid        = tid,
+            });
+            openFrames.pop_back();
+        }
+    };
+
+    for (const RetiredRing &ring : _retiredRings) {
+        exportThread(ring.threadIndex, ring.drained);
+    }
+    for (const auto &ring : _rings) {
+        exportThread(ring->threadIndex, ring->drained);
+    }
+}
+
+} // namespace ya
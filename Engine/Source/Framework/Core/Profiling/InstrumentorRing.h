@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Core/Api.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ya
+{
+
+struct SpeedscopeEvent;
+struct SpeedscopeFrame;
+
+//=============================================================================
+// ProfilerClock - cheap timestamp source for the ring backend
+//=============================================================================
+
+/**
+ * @brief Raw tick source: invariant TSC on x86-64, steady_clock ticks elsewhere.
+ *
+ * Ticks are converted to microseconds once per session by calibrating against
+ * steady_clock at session begin/end, never on the recording path.
+ */
+struct ProfilerClock
+{
+    static uint64_t now();
+};
+
+//=============================================================================
+// InstrumentorRingBackend - lock-free per-thread capture
+//=============================================================================
+
+/**
+ * @brief Capture backend where each thread records into its own SPSC ring.
+ *
+ * Recording path (any thread, no locks, no allocation after warm-up):
+ *   - frame id from a thread-local pointer-keyed cache; names must have a
+ *     stable address (literals, __PRETTY_FUNCTION__, interned FName text)
+ *   - one 16-byte record pushed into the thread's ring
+ *   - a begin reserves the slot of its matching end, so a full ring drops
+ *     whole scopes and the output stays balanced
+ *
+ * A background thread drains every ring into per-thread storage; EndSession
+ * converts it into speedscope events for the existing JSON writer. A ring is
+ * retired when its thread exits and freed after its final drain; records it
+ * already collected are kept until the next session.
+ */
+class YA_CORE_API InstrumentorRingBackend
+{
+  public:
+    static constexpr uint32_t kInvalidFrame = static_cast<uint32_t>(-1);
+
+    InstrumentorRingBackend();
+    ~InstrumentorRingBackend();
+
+    InstrumentorRingBackend(const InstrumentorRingBackend &)            = delete;
+    InstrumentorRingBackend &operator=(const InstrumentorRingBackend &) = delete;
+
+    /// Discard stale records and start the drain thread.
+    void beginSession();
+
+    /// Stop the drain thread and collect every remaining record.
+    void endSession();
+
+    /**
+     * @brief Record a begin event.
+     * @param name Stable-address scope name
+     * @param file Stable-address source file (may be null)
+     * @return Frame id for writeEnd, kInvalidFrame if the scope was dropped
+     */
+    uint32_t writeBegin(const char *name, const char *file, int line);
+
+    /// Record the end event of a scope whose writeBegin returned `frameId`.
+    void writeEnd(uint32_t frameId);
+
+    /**
+     * @brief Convert the collected session into speedscope events/frames.
+     *
+     * Per thread, end events without a begin (scope opened before the
+     * session) are skipped and scopes still open are closed at the thread's
+     * last timestamp, so every profile is balanced.
+     */
+    void exportSession(std::vector<SpeedscopeEvent> &outEvents,
+                       std::vector<SpeedscopeFrame> &outFrames,
+                       bool                          bIncludeSourceInfo) const;
+
+    [[nodiscard]] size_t getRecordedCount() const { return _recordedCount.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t getDroppedCount() const;
+
+    /// Rings still registered (threads that recorded and have not been released).
+    [[nodiscard]] size_t getThreadRingCount() const;
+
+  private:
+    struct FrameInfo
+    {
+        std::string name;
+        std::string file;
+        int         line = 0;
+    };
+    struct ThreadRing;
+    struct ThreadRingGuard;
+    struct RetiredRing;
+
+    /// Null once the calling thread is tearing down its thread_locals.
+    ThreadRing *acquireThreadRing();
+    uint32_t    resolveFrame(ThreadRing &ring, const char *name, const char *file, int line);
+    void        drainAll(bool bDiscard);
+    void        drainLoop();
+    void        releaseRetiredRings(const std::vector<ThreadRing *> &retired);
+
+    // ── Thread rings (one per recording thread, released after it exits) ─
+    std::vector<std::shared_ptr<ThreadRing>> _rings;
+    std::vector<RetiredRing>                 _retiredRings; // Drained records of released rings
+    size_t                                   _retiredDropped  = 0;
+    uint32_t                                 _nextThreadIndex = 0;
+    mutable std::mutex                       _ringsMutex;
+    // Identifies this backend to thread_local ring caches; unlike the address
+    // it is never reused by a later backend.
+    const uint64_t                           _instanceId;
+
+    // ── Frame registry (content-keyed, only touched on thread-cache miss) ─
+    std::vector<FrameInfo>                    _frames;
+    std::unordered_map<std::string, uint32_t> _frameIds;
+    mutable std::mutex                        _framesMutex;
+
+    // ── Drain thread ─────────────────────────────────────────────────────
+    std::thread             _drainThread;
+    std::mutex              _drainMutex;
+    std::condition_variable _drainCondition;
+    bool                    _bDraining = false;
+
+    // ── Session timing ───────────────────────────────────────────────────
+    uint64_t            _sessionStartTicks   = 0;
+    uint64_t            _sessionEndTicks     = 0;
+    int64_t             _sessionStartSteady  = 0; // steady_clock ns, for calibration
+    double              _microsecondsPerTick = 0.0;
+    std::atomic<size_t> _recordedCount{0};
+};
+
+} // namespace ya
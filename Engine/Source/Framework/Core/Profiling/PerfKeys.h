@@ -62,6 +62,20 @@ inline const FName& threadTimeMs()
     return key;
 }
 
+inline const FName& visibleCount()
+{
+    using namespace ya::literals;
+    static const FName key = "visible.count"_name;
+    return key;
+}
+
+inline const FName& culledCount()
+{
+    using namespace ya::literals;
+    static const FName key = "culled.count"_name;
+    return key;
+}
+
 } // namespace metric
 
 namespace sample
@@ -130,6 +144,13 @@ inline const FName& renderExtract()
     return key;
 }
 
+inline const FName& renderCull()
+{
+    using namespace ya::literals;
+    static const FName key = "Render/Cull"_name;
+    return key;
+}
+
 inline const FName& renderRuntime()
 {
     using namespace ya::literals;
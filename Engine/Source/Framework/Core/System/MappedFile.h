@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Core/Api.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace ya
+{
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * Pages are faulted in on first touch, so large binary assets can be handed
+ * to consumers as spans without reading or copying them up front. The view
+ * stays valid until close() or destruction.
+ */
+class YA_CORE_API MappedFile
+{
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// Map @p path; returns false (and stays closed) on any failure or empty file.
+    bool open(const std::filesystem::path& path);
+    void close();
+
+    [[nodiscard]] bool                       isOpen() const { return _data != nullptr; }
+    [[nodiscard]] const std::byte*           data() const { return _data; }
+    [[nodiscard]] size_t                     size() const { return _size; }
+    [[nodiscard]] std::span<const std::byte> bytes() const { return {_data, _size}; }
+
+  private:
+    const std::byte* _data = nullptr;
+    size_t           _size = 0;
+#if defined(_WIN32)
+    void* _fileHandle    = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
+
+} // namespace ya
@@ -1,8 +1,13 @@
 #include "ECS/Systems/AnimationSystem.h"
 
+#include "Core/Async/JobSystem.h"
 #include "ECS/Systems/SkeletonAnimatorComponent.h"
+#include "Resource/Core/AnimationPoseGraph.h"
 #include "Resource/Core/SkeletonAnimationSampler.h"
 #include "Scene/Core/Scene.h"
+#include "Scene3D/TransformComponent.h"
+
+#include <algorithm>
 
 namespace ya
 {
@@ -12,10 +17,107 @@ double resolveTicksPerSecond(const SkeletonAnimationClip& clip)
 {
     return clip.ticksPerSecond > 0.0 ? clip.ticksPerSecond : 1.0;
 }
+
+void sampleAnimator(SkeletonAnimatorComponent& skeletonComp, const AnimationPoseCache& poseCache, uint32_t maxNodeDepth)
+{
+    if (skeletonComp.hasPoseGraph()) {
+        AnimationPoseGraphEvaluator::evaluate(*skeletonComp.getSkeleton(), skeletonComp.getGraphInstance(), poseCache, skeletonComp._pose);
+    }
+    else if (const CompressedSkeletonClip* compressedClip = skeletonComp.getCompressedClip()) {
+        SkeletonAnimationSampler::samplePose(*skeletonComp.getSkeleton(),
+                                             *compressedClip,
+                                             skeletonComp._time,
+                                             skeletonComp._loop,
+                                             skeletonComp._clipCursor,
+                                             skeletonComp._pose,
+                                             maxNodeDepth);
+    }
+    else {
+        SkeletonAnimationSampler::samplePose(*skeletonComp.getSkeleton(),
+                                             *skeletonComp.getClip(),
+                                             skeletonComp._time,
+                                             skeletonComp._loop,
+                                             skeletonComp._pose);
+    }
+}
+
+void interpolateBoneMatrices(const AnimationLodState& lodState, std::vector<glm::mat4>& outBoneMatrices)
+{
+    if (lodState.fromBoneMatrices.size() != outBoneMatrices.size() || lodState.toBoneMatrices.size() != outBoneMatrices.size()) {
+        return;
+    }
+
+    // Component-wise: consecutive samples are close, and skinning blends
+    // matrices linearly anyway.
+    const float t = static_cast<float>(lodState.step) / static_cast<float>(std::max(lodState.interval, 1u));
+    for (size_t index = 0; index < outBoneMatrices.size(); ++index) {
+        outBoneMatrices[index] = lodState.fromBoneMatrices[index] * (1.0f - t) + lodState.toBoneMatrices[index] * t;
+    }
+}
+
 } // namespace
 
+AABB SkeletonAnimationSystem::fallbackBounds(const LodSettings& settings, const glm::mat4& worldMatrix)
+{
+    const glm::vec3 center   = glm::vec3(worldMatrix[3]);
+    const float     maxScale = std::max({glm::length(glm::vec3(worldMatrix[0])),
+                                         glm::length(glm::vec3(worldMatrix[1])),
+                                         glm::length(glm::vec3(worldMatrix[2]))});
+    const float     radius   = settings.boundsRadius * maxScale;
+    return AABB(center - glm::vec3(radius), center + glm::vec3(radius));
+}
+
+EAnimationLod SkeletonAnimationSystem::selectLod(const LodSettings& settings,
+                                                 const LodView&     view,
+                                                 const Frustum*     frustum,
+                                                 const AABB&        worldBounds,
+                                                 EAnimationLod      previous)
+{
+    if (settings.bSuspendCulled && frustum && !frustum->intersects(worldBounds)) {
+        return EAnimationLod::Suspended;
+    }
+
+    // Size is the largest extent of the bounds, measured at their nearest point.
+    const glm::vec3 extent   = worldBounds.getExtent();
+    const glm::vec3 nearest  = glm::clamp(view.cameraPosition, worldBounds.min, worldBounds.max);
+    const float     distance = std::max(glm::distance(view.cameraPosition, nearest), 1e-4f);
+    const float     size     = std::max({extent.x, extent.y, extent.z});
+    const float     pixels   = size * (view.bOrthographic ? view.pixelScale : view.pixelScale / distance);
+
+    // Hysteresis: leaving a finer LOD takes a size one band below its threshold.
+    const float band             = 1.0f - std::clamp(settings.hysteresis, 0.0f, 1.0f);
+    const bool  bWasFull         = previous == EAnimationLod::Full;
+    const bool  bWasReduced      = bWasFull || previous == EAnimationLod::Reduced;
+    const float fullThreshold    = settings.fullPixels * (bWasFull ? band : 1.0f);
+    const float reducedThreshold = settings.distantPixels * (bWasReduced ? band : 1.0f);
+    if (pixels >= fullThreshold) {
+        return EAnimationLod::Full;
+    }
+    return pixels >= reducedThreshold ? EAnimationLod::Reduced : EAnimationLod::Distant;
+}
+
+void SkeletonAnimationSystem::updateAnimator(BatchItem& item) const
+{
+    SkeletonAnimatorComponent& skeletonComp = *item.animator;
+    AnimationLodState&         lodState     = skeletonComp._lodState;
+    if (item.bSample) {
+        if (item.bInterpolate) {
+            lodState.fromBoneMatrices = skeletonComp._pose.boneMatrices;
+        }
+        sampleAnimator(skeletonComp, _poseCache, item.maxNodeDepth);
+        if (item.bInterpolate) {
+            lodState.toBoneMatrices = skeletonComp._pose.boneMatrices;
+        }
+    }
+    if (item.bInterpolate) {
+        interpolateBoneMatrices(lodState, skeletonComp._pose.boneMatrices);
+    }
+    skeletonComp.markPoseClean();
+}
+
 void SkeletonAnimationSystem::onUpdate(float deltaTime)
 {
+    _stats = {};
     if (!_sceneProvider) {
         return;
     }
@@ -33,28 +135,153 @@ void SkeletonAnimationSystem::onUpdate(float deltaTime)
         return;
     }
 
-    auto view = scene->getRegistry().view<SkeletonAnimatorComponent>();
-    view.each([deltaTime](SkeletonAnimatorComponent& skeletonComp) {
-        const SkeletonAnimationClip* clip = skeletonComp.getClip();
-        if (!skeletonComp.hasSkeleton() || !clip) {
+    YA_PROFILE_FUNCTION();
+
+    ++_frameIndex;
+    LodView       lodView;
+    const bool    bLod    = _lodSettings.bEnabled && _lodViewProvider && _lodViewProvider(lodView);
+    const Frustum frustum = bLod ? Frustum::fromViewProjection(lodView.viewProjection) : Frustum{};
+    _animatorBounds.clear();
+    if (bLod && _boundsProvider) {
+        _boundsProvider(*scene, _animatorBounds);
+    }
+
+    // Advance playback serially (cheap), pick LODs and collect what needs
+    // sampling. Graph animators register their clip samples with the shared
+    // pose cache here.
+    _batch.clear();
+    _poseCache.beginFrame();
+    auto& registry = scene->getRegistry();
+    auto  view     = registry.view<SkeletonAnimatorComponent>();
+    view.each([&](entt::entity entity, SkeletonAnimatorComponent& skeletonComp) {
+        if (!skeletonComp.hasSkeleton()) {
             return;
         }
 
-        if (skeletonComp._playing) {
-            skeletonComp._time += static_cast<double>(deltaTime) * static_cast<double>(skeletonComp._speed) * resolveTicksPerSecond(*clip);
-            skeletonComp.invalidatePose();
+        const bool bGraph = skeletonComp.hasPoseGraph();
+        if (bGraph) {
+            const Skeleton&         skeleton = *skeletonComp.getSkeleton();
+            AnimationGraphInstance& instance = skeletonComp.getGraphInstance();
+            if (skeletonComp._playing) {
+                AnimationPoseGraphEvaluator::advance(skeleton, instance, deltaTime * skeletonComp._speed);
+                skeletonComp.invalidatePose();
+            }
+            else if (skeletonComp.isPoseDirty()) {
+                // Paused: re-weight the graph for parameter changes without moving time.
+                AnimationPoseGraphEvaluator::advance(skeleton, instance, 0.0f);
+            }
+        }
+        else {
+            const SkeletonAnimationClip* clip = skeletonComp.getClip();
+            if (!clip) {
+                return;
+            }
+            if (skeletonComp._playing) {
+                skeletonComp._time += static_cast<double>(deltaTime) * static_cast<double>(skeletonComp._speed) * resolveTicksPerSecond(*clip);
+                skeletonComp.invalidatePose();
+            }
         }
 
         if (!skeletonComp.isPoseDirty()) {
             return;
         }
 
-        SkeletonAnimationSampler::samplePose(*skeletonComp.getSkeleton(),
-                                             *clip,
-                                             skeletonComp._time,
-                                             skeletonComp._loop,
-                                             skeletonComp._pose);
-        skeletonComp.markPoseClean();
+        AnimationLodState&  lodState      = skeletonComp._lodState;
+        const EAnimationLod previousLod   = lodState.lod;
+        const bool          bInterpolated = lodState.bInterpolated;
+        lodState.lod                      = EAnimationLod::Full;
+        lodState.bInterpolated            = false;
+        if (bLod) {
+            const auto it = _animatorBounds.find(&skeletonComp);
+            AABB       bounds;
+            if (it != _animatorBounds.end()) {
+                bounds = it->second;
+            }
+            else {
+                const auto* transform = registry.try_get<TransformComponent>(entity);
+                bounds                = fallbackBounds(_lodSettings, transform ? transform->getWorldMatrix() : glm::mat4(1.0f));
+            }
+            lodState.lod = selectLod(_lodSettings, lodView, &frustum, bounds, previousLod);
+        }
+
+        BatchItem item{.animator = &skeletonComp};
+        switch (lodState.lod) {
+        case EAnimationLod::Full:
+            lodState.interval = 1;
+            break;
+        case EAnimationLod::Reduced:
+            lodState.interval = std::max(_lodSettings.reducedInterval, 1u);
+            ++_stats.reducedCount;
+            break;
+        case EAnimationLod::Distant:
+            lodState.interval = std::max(_lodSettings.distantInterval, 1u);
+            item.maxNodeDepth = _lodSettings.distantMaxDepth;
+            ++_stats.distantCount;
+            break;
+        case EAnimationLod::Suspended:
+            // The pose stays dirty, so it is sampled as soon as it is visible again.
+            ++_stats.suspendedCount;
+            return;
+        }
+
+        // Spread each interval's samples across frames by entity. Coming
+        // back from a suspension, or starting to interpolate, samples right
+        // away and snaps to that sample.
+        const bool bInterpolate = _lodSettings.bInterpolate && lodState.interval > 1;
+        const auto slot         = static_cast<uint64_t>(entt::to_integral(entity));
+        const bool bResume      = previousLod == EAnimationLod::Suspended ||
+                                  skeletonComp._pose.boneMatrices.empty() ||
+                                  (bInterpolate && !bInterpolated);
+        const bool bDue         = lodState.interval == 1 || bResume || (_frameIndex + slot) % lodState.interval == 0;
+        if (bDue) {
+            lodState.step = bResume ? lodState.interval : 1;
+        }
+        else if (bInterpolate) {
+            item.bSample  = false;
+            lodState.step = std::min(lodState.step + 1, lodState.interval);
+        }
+        else {
+            return;
+        }
+        item.bInterpolate      = bInterpolate;
+        lodState.bInterpolated = bInterpolate;
+
+        if (item.bSample) {
+            if (bGraph) {
+                AnimationPoseGraphEvaluator::gather(*skeletonComp.getSkeleton(), skeletonComp.getGraphInstance(), _poseCache);
+            }
+            ++_stats.sampledCount;
+        }
+        if (item.bInterpolate) {
+            ++_stats.interpolatedCount;
+        }
+        _batch.push_back(item);
+    });
+
+    const auto count       = static_cast<uint32_t>(_batch.size());
+    const auto sampleCount = _poseCache.getEntryCount();
+    _stats.clipRequests    = _poseCache.getStats().requestCount;
+    _stats.clipSamples     = sampleCount;
+
+    JobSystem& jobs           = JobSystem::get();
+    const bool bJobsAvailable = jobs.isRunning() && jobs.getWorkerCount() > 0;
+    _stats.bParallel          = _bParallelUpdate && bJobsAvailable && std::max(count, sampleCount) >= kMinParallelAnimators;
+    if (!_stats.bParallel) {
+        _poseCache.sampleAll();
+        for (BatchItem& item : _batch) {
+            updateAnimator(item);
+        }
+        return;
+    }
+
+    // Unique clip samples first, then every animator blends from them.
+    jobs.parallelFor(sampleCount, 0, [this](uint32_t begin, uint32_t end) {
+        _poseCache.sampleRange(begin, end);
+    });
+    jobs.parallelFor(count, 0, [this](uint32_t begin, uint32_t end) {
+        for (uint32_t index = begin; index < end; ++index) {
+            updateAnimator(_batch[index]);
+        }
     });
 }
 
@@ -68,4 +295,14 @@ void SkeletonAnimationSystem::setTickPolicy(TickPolicy policy)
     _tickPolicy = std::move(policy);
 }
 
+void SkeletonAnimationSystem::setLodViewProvider(LodViewProvider provider)
+{
+    _lodViewProvider = std::move(provider);
+}
+
+void SkeletonAnimationSystem::setBoundsProvider(BoundsProvider provider)
+{
+    _boundsProvider = std::move(provider);
+}
+
 } // namespace ya
@@ -1,29 +1,154 @@
 #pragma once
 
 #include "Core/Api.h"
+#include "Core/Math/AABB.h"
+#include "Core/Math/Frustum.h"
 #include "Core/System/System.h"
+#include "ECS/Systems/SkeletonAnimatorComponent.h"
+#include "Resource/Core/AnimationPoseGraph.h"
+
+#include <glm/glm.hpp>
 
 #include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
 
 namespace ya
 {
 
 struct Scene;
 
+/**
+ * @brief Samples every playing SkeletonAnimatorComponent once per frame
+ *
+ * The update runs as one batch: a serial pass advances playback and collects
+ * the animators whose pose is dirty, then their poses are sampled in chunks
+ * across the JobSystem. Each animator only writes its own pose and clip
+ * cursor; skeletons and clips are shared read-only.
+ *
+ * Animators driven by an AnimationPoseGraph gather their clip samples into a
+ * per-frame AnimationPoseCache first, so animators playing the same clip at
+ * the same time share one sample; the cache is sampled in parallel before
+ * the graphs are blended.
+ *
+ * Animation LOD (when a LOD view provider is bound): each animator's
+ * projected size picks an EAnimationLod. Sizes come from the world bounds of
+ * the meshes it skins (bounds provider), or a LodSettings::boundsRadius
+ * sphere at the entity for animators without one. Reduced and Distant animators are
+ * sampled every Nth frame, spread over frames by entity, and their bone
+ * matrices are interpolated from the previous sample towards the latest one
+ * in between (so they trail playback by up to N frames). Distant animators
+ * only sample the upper node hierarchy of compressed clips; animators outside
+ * the view frustum are suspended. Playback time always advances, so a
+ * character resumes in sync.
+ */
 struct YA_ECS_SYSTEMS_API SkeletonAnimationSystem : public ISystem
 {
     using SceneProvider = std::function<Scene*()>;
     using TickPolicy    = std::function<bool()>;
 
+    /// Below this many dirty animators the batch is sampled on the calling thread.
+    static constexpr uint32_t kMinParallelAnimators = 16;
+
+    /// Camera the animation LODs are picked for.
+    struct LodView
+    {
+        glm::vec3 cameraPosition = glm::vec3(0.0f);
+        glm::mat4 viewProjection = glm::mat4(1.0f);
+        /// 0.5 * viewportHeight * |projection[1][1]|: pixels per world unit at
+        /// distance 1 (perspective) or at any distance (orthographic).
+        float     pixelScale     = 0.0f;
+        bool      bOrthographic  = false;
+    };
+    /// Fills the view; returning false disables LOD for the frame (everything runs at Full).
+    using LodViewProvider = std::function<bool(LodView&)>;
+    /// World bounds of the meshes each animator skins. Mesh components live
+    /// outside this module, so the Host gathers them once per LOD frame.
+    using AnimatorBounds  = std::unordered_map<const SkeletonAnimatorComponent*, AABB>;
+    using BoundsProvider  = std::function<void(Scene&, AnimatorBounds&)>;
+
+    struct LodSettings
+    {
+        bool     bEnabled        = true;
+        /// Projected character height (pixels) at and above which animators run at Full.
+        float    fullPixels      = 200.0f;
+        /// Below this the animator is Distant, in between Reduced.
+        float    distantPixels   = 60.0f;
+        /// An animator keeps its finer LOD until it shrinks this fraction below the threshold.
+        float    hysteresis      = 0.1f;
+        uint32_t reducedInterval = 2;
+        uint32_t distantInterval = 4;
+        /// Deepest node Distant animators sample (root = 0).
+        uint32_t distantMaxDepth = 3;
+        bool     bSuspendCulled  = true;
+        bool     bInterpolate    = true;
+        /// Bounding sphere radius, in the entity's local units, of animators
+        /// the bounds provider has no meshes for.
+        float    boundsRadius    = 1.0f;
+    };
+
+    struct Stats
+    {
+        uint32_t sampledCount      = 0; // Poses sampled by the last update
+        uint32_t interpolatedCount = 0; // Poses interpolated between samples
+        uint32_t reducedCount      = 0;
+        uint32_t distantCount      = 0;
+        uint32_t suspendedCount    = 0;
+        uint32_t clipRequests      = 0; // Clip samples requested by pose graphs
+        uint32_t clipSamples       = 0; // Unique clip samples after sharing
+        bool     bParallel         = false;
+    };
+
     /// Injected seams (bound by the Host at startup; no App access from here).
     void setSceneProvider(SceneProvider provider);
     void setTickPolicy(TickPolicy policy);
+    void setLodViewProvider(LodViewProvider provider);
+    void setBoundsProvider(BoundsProvider provider);
+
+    void                             setLodSettings(const LodSettings& settings) { _lodSettings = settings; }
+    [[nodiscard]] const LodSettings& getLodSettings() const { return _lodSettings; }
+
+    /// LOD of a character covering @p worldBounds; @p frustum may be null (no culling).
+    [[nodiscard]] static EAnimationLod selectLod(const LodSettings& settings,
+                                                 const LodView&     view,
+                                                 const Frustum*     frustum,
+                                                 const AABB&        worldBounds,
+                                                 EAnimationLod      previous);
+    /// Bounds of an animator without meshes: a boundsRadius sphere at the entity origin.
+    [[nodiscard]] static AABB fallbackBounds(const LodSettings& settings, const glm::mat4& worldMatrix);
+
+    /// Split large batches across the JobSystem (if running).
+    void setParallelUpdate(bool bEnable) { _bParallelUpdate = bEnable; }
+
+    [[nodiscard]] const Stats& getStats() const { return _stats; }
 
     void onUpdate(float deltaTime) override;
 
   private:
-    SceneProvider _sceneProvider;
-    TickPolicy    _tickPolicy;
+    struct BatchItem
+    {
+        SkeletonAnimatorComponent* animator     = nullptr;
+        uint32_t                   maxNodeDepth = std::numeric_limits<uint32_t>::max();
+        bool                       bSample      = true;
+        bool                       bInterpolate = false;
+    };
+
+    /// Sample and / or interpolate one animator; touches only that animator.
+    void updateAnimator(BatchItem& item) const;
+
+    SceneProvider   _sceneProvider;
+    TickPolicy      _tickPolicy;
+    LodViewProvider _lodViewProvider;
+    BoundsProvider  _boundsProvider;
+    LodSettings     _lodSettings;
+    bool            _bParallelUpdate = true;
+    uint64_t        _frameIndex      = 0;
+    Stats           _stats;
+
+    std::vector<BatchItem> _batch;
+    AnimationPoseCache     _poseCache;
+    AnimatorBounds         _animatorBounds;
 };
 
 } // namespace ya
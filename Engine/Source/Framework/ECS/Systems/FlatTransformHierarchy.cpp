@@ -0,0 +1,224 @@
+#include "FlatTransformHierarchy.h"
+
+#include "TransformSystem.h"
+
+#include "Core/Async/JobSystem.h"
+#include "Core/Math/SimdMath.h"
+#include "ECS/Entity.h"
+#include "Hierarchy/Node.h"
+#include "Scene/Core/Scene.h"
+#include "Scene3D/Node3D.h"
+#include "Scene3D/TransformComponent.h"
+
+#include <atomic>
+
+namespace ya
+{
+
+// ============================================================================
+// Structure
+// ============================================================================
+
+bool FlatTransformHierarchy::sync(Scene *scene)
+{
+    Node *root = scene ? scene->_rootNode.get() : nullptr;
+    if (scene == _scene && root == _root && (!root || root->getStructureVersion() == _structureVersion)) {
+        return false;
+    }
+
+    YA_PROFILE_FUNCTION();
+    rebuild(scene, root);
+    return true;
+}
+
+void FlatTransformHierarchy::reset()
+{
+    _entities.clear();
+    _parents.clear();
+    _levelOffsets.clear();
+    _world.clear();
+    _revisions.clear();
+    _changed.clear();
+    _scene            = nullptr;
+    _root             = nullptr;
+    _structureVersion = ~0ull;
+    _stats            = {};
+}
+
+void FlatTransformHierarchy::rebuild(Scene *scene, Node *root)
+{
+    const uint64_t rebuildCount = _stats.rebuildCount;
+    reset();
+    _scene              = scene;
+    _root               = root;
+    _structureVersion   = root ? root->getStructureVersion() : ~0ull;
+    _stats.rebuildCount = rebuildCount + 1;
+    if (!scene || !root) {
+        return;
+    }
+
+    // Pass 1: depth-first walk (explicit stack; imported skeletons can be
+    // very deep). Slots are recorded in visit order with their level and the
+    // visit index of the nearest Node3D ancestor.
+    struct Visit
+    {
+        entt::entity entity;
+        int32_t      parentVisit;
+        uint32_t     level;
+    };
+    struct Pending
+    {
+        Node    *node;
+        int32_t  parentVisit;
+        uint32_t level;
+    };
+
+    std::vector<Visit>   visits;
+    std::vector<Pending> stack{{root, -1, 0}};
+    uint32_t             levelCount = 0;
+    while (!stack.empty()) {
+        const Pending pending = stack.back();
+        stack.pop_back();
+
+        int32_t  childParent = pending.parentVisit;
+        uint32_t childLevel  = pending.level;
+
+        auto *node3D = dynamic_cast<Node3D *>(pending.node);
+        if (node3D && node3D->getEntity()) {
+            childParent = static_cast<int32_t>(visits.size());
+            childLevel  = pending.level + 1;
+            visits.push_back({node3D->getEntity()->getHandle(), pending.parentVisit, pending.level});
+            levelCount = std::max(levelCount, childLevel);
+        }
+
+        const auto &children = pending.node->getChildren();
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            if (*it) {
+                stack.push_back({*it, childParent, childLevel});
+            }
+        }
+    }
+
+    // Pass 2: counting sort by level. Within a level slots keep visit order,
+    // so siblings stay adjacent.
+    _levelOffsets.assign(levelCount + 1, 0);
+    for (const Visit &visit : visits) {
+        ++_levelOffsets[visit.level + 1];
+    }
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        _levelOffsets[level + 1] += _levelOffsets[level];
+    }
+
+    const size_t          count = visits.size();
+    std::vector<uint32_t> cursor(_levelOffsets.begin(), _levelOffsets.end() - 1);
+    std::vector<int32_t>  slotOfVisit(count);
+    for (size_t i = 0; i < count; ++i) {
+        slotOfVisit[i] = static_cast<int32_t>(cursor[visits[i].level]++);
+    }
+
+    _entities.resize(count);
+    _parents.resize(count);
+    _world.resize(count, glm::mat4(1.0f));
+    _revisions.resize(count, 0);
+    _changed.assign(count, 0);
+
+    auto &storage = scene->getRegistry().storage<TransformComponent>();
+    for (size_t i = 0; i < count; ++i) {
+        const int32_t slot = slotOfVisit[i];
+        _entities[slot]    = visits[i].entity;
+        _parents[slot]     = visits[i].parentVisit >= 0 ? slotOfVisit[visits[i].parentVisit] : -1;
+
+        // Seed the mirror so clean slots are valid parents on the first update.
+        if (storage.contains(visits[i].entity)) {
+            const TransformComponent &tc = storage.get(visits[i].entity);
+            _world[slot]                 = tc._worldMatrix;
+            _revisions[slot]             = tc.getWorldRevision();
+        }
+    }
+
+    _stats.nodeCount  = static_cast<uint32_t>(count);
+    _stats.levelCount = levelCount;
+}
+
+// ============================================================================
+// Update
+// ============================================================================
+
+template <typename Storage>
+uint32_t FlatTransformHierarchy::updateRange(Storage &storage, uint32_t begin, uint32_t end)
+{
+    uint32_t updated = 0;
+    for (uint32_t slot = begin; slot < end; ++slot) {
+        const int32_t parent        = _parents[slot];
+        const bool    parentChanged = parent >= 0 && _changed[parent];
+
+        const entt::entity entity = _entities[slot];
+        if (!storage.contains(entity)) {
+            // Node3D without a transform passes its parent's matrix through,
+            // like the recursive path does.
+            _world[slot]   = parent >= 0 ? _world[parent] : glm::mat4(1.0f);
+            _changed[slot] = parentChanged;
+            continue;
+        }
+
+        TransformComponent &tc = storage.get(entity);
+
+        // World written outside this system (gizmo, setWorldTransform): adopt it.
+        bool bChanged = false;
+        if (tc.getWorldRevision() != _revisions[slot]) {
+            _world[slot] = tc._worldMatrix;
+            bChanged     = true;
+        }
+
+        if (tc.isLocalDirty() || tc.isWorldDirty() || parentChanged) {
+            TransformSystem::computeLocalMatrix(&tc);
+            if (parent >= 0) {
+                simd_math::multiplyMat4(_world[parent], tc._localMatrix, _world[slot]);
+            }
+            else {
+                _world[slot] = tc._localMatrix;
+            }
+            tc._worldMatrix = _world[slot];
+            tc.clearWorldDirty();
+            bChanged = true;
+            ++updated;
+        }
+
+        _revisions[slot] = tc.getWorldRevision();
+        _changed[slot]   = bChanged ? 1 : 0;
+    }
+    return updated;
+}
+
+void FlatTransformHierarchy::update(entt::registry &registry, bool bParallel)
+{
+    YA_PROFILE_FUNCTION();
+
+    auto      &storage      = registry.storage<TransformComponent>();
+    JobSystem &jobs         = JobSystem::get();
+    const bool bUseJobs     = bParallel && jobs.isRunning() && jobs.getWorkerCount() > 0;
+    uint32_t   updatedTotal = 0;
+
+    const uint32_t levelCount = _levelOffsets.empty() ? 0 : static_cast<uint32_t>(_levelOffsets.size() - 1);
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        const uint32_t begin = _levelOffsets[level];
+        const uint32_t count = _levelOffsets[level + 1] - begin;
+
+        if (!bUseJobs || count < kMinParallelLevelSize) {
+            updatedTotal += updateRange(storage, begin, begin + count);
+            continue;
+        }
+
+        // Each chunk writes only its own slots and reads the previous level,
+        // which is complete before this level starts.
+        std::atomic<uint32_t> updated{0};
+        jobs.parallelFor(count, 0, [&](uint32_t chunkBegin, uint32_t chunkEnd) {
+            updated.fetch_add(updateRange(storage, begin + chunkBegin, begin + chunkEnd), std::memory_order_relaxed);
+        });
+        updatedTotal += updated.load(std::memory_order_relaxed);
+    }
+
+    _stats.updatedCount = updatedTotal;
+}
+
+} // namespace ya
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Core/Base.h"
+#include "Core/Math/GLM.h"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace ya
+{
+
+struct Scene;
+struct Node;
+
+/**
+ * @brief Node tree flattened into depth-ordered arrays for TransformSystem
+ *
+ * Every Node3D with an entity gets one slot; slots are grouped by depth so a
+ * parent always precedes its children, and each level can be updated in
+ * parallel chunks. Children read their parent's world matrix from the
+ * contiguous `_world` mirror instead of chasing Node/TransformComponent
+ * pointers. Local TRS stays in TransformComponent (the authoring store); only
+ * dirty slots read it.
+ *
+ * The arrays are rebuilt when the scene root's structure version or the root
+ * itself changes, i.e. on reparent/create/destroy within this scene, never on
+ * plain transform edits or on edits to other scenes.
+ * TransformComponents are looked up by entity each update since entt may
+ * relocate them when other components are removed.
+ */
+struct YA_ECS_SYSTEMS_API FlatTransformHierarchy
+{
+    struct Stats
+    {
+        uint32_t nodeCount    = 0;
+        uint32_t levelCount   = 0;
+        uint32_t updatedCount = 0; // World matrices recomputed by the last update()
+        uint64_t rebuildCount = 0;
+    };
+
+    /// Levels smaller than this run on the calling thread.
+    static constexpr uint32_t kMinParallelLevelSize = 1024;
+
+    /**
+     * @brief Rebuild the arrays if the scene's node tree changed shape
+     * @return true if a rebuild happened
+     */
+    bool sync(Scene *scene);
+
+    /**
+     * @brief Recompute world matrices of dirty slots, parents first
+     * @param bParallel Split large levels across the JobSystem (if running)
+     */
+    void update(entt::registry &registry, bool bParallel);
+
+    void reset();
+
+    [[nodiscard]] const Stats &getStats() const { return _stats; }
+
+  private:
+    void rebuild(Scene *scene, Node *root);
+
+    template <typename Storage>
+    uint32_t updateRange(Storage &storage, uint32_t begin, uint32_t end);
+
+    std::vector<entt::entity> _entities;
+    std::vector<int32_t>      _parents;      // Slot of the nearest Node3D ancestor, -1 at top level
+    std::vector<uint32_t>     _levelOffsets; // Level L spans [_levelOffsets[L], _levelOffsets[L + 1])
+    std::vector<glm::mat4>    _world;        // Mirror of each slot's world matrix
+    std::vector<uint32_t>     _revisions;    // TransformComponent world revision mirrored in _world
+    std::vector<uint8_t>      _changed;      // World matrix changed during the current update()
+
+    const Scene *_scene            = nullptr;
+    const Node  *_root             = nullptr;
+    uint64_t     _structureVersion = ~0ull;
+    Stats        _stats;
+};
+
+} // namespace ya
@@ -2,6 +2,7 @@
 
 #include "Core/Reflection/Reflection.h"
 #include "ECS/Component.h"
+#include "Resource/Core/AnimationPoseGraph.h"
 #include "Resource/Core/Skeleton.h"
 #include "Resource/Core/SkeletonAnimationSampler.h"
 
@@ -9,10 +10,34 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace ya
 {
 
+/// How much work SkeletonAnimationSystem spends on one animator.
+enum class EAnimationLod : uint8_t
+{
+    Full,      // Sampled every frame
+    Reduced,   // Sampled every Nth frame, interpolated in between
+    Distant,   // Like Reduced, less often, and only the upper bone hierarchy
+    Suspended, // Culled: playback time advances, the pose is not touched
+};
+
+/// Per-animator LOD bookkeeping; written by SkeletonAnimationSystem only.
+struct AnimationLodState
+{
+    EAnimationLod lod           = EAnimationLod::Full;
+    /// Frames since the last sample, up to the update interval.
+    uint32_t      step          = 0;
+    uint32_t      interval      = 1;
+    /// Whether the last update interpolated; the matrices below are only current while it does.
+    bool          bInterpolated = false;
+    /// Bone matrices shown when the last sample was taken, and that sample.
+    std::vector<glm::mat4> fromBoneMatrices;
+    std::vector<glm::mat4> toBoneMatrices;
+};
+
 // Animator that owns the runtime Skeleton + playback state for a skinned mesh hierarchy.
 // Stage 3: pure rename of the former SkeletonComponent. Stage 4 will move this
 // from the mesh entity up to the model-root entity and let SkinnedMeshComponent
@@ -42,8 +67,16 @@ struct SkeletonAnimatorComponent : public IComponent
     bool     _loop      = true;
     bool     _playing   = true;
 
-    SkeletonPose _pose;
-    bool         _bPoseDirty = true;
+    SkeletonPose         _pose;
+    CompressedClipCursor _clipCursor;
+    bool                 _bPoseDirty = true;
+
+    /// Optional runtime graph; when set it replaces single-clip playback
+    /// (_clipIndex / _time / _loop are ignored, _speed and _playing still apply).
+    std::shared_ptr<const AnimationPoseGraph> _poseGraph;
+    AnimationGraphInstance                    _graphInstance;
+
+    AnimationLodState _lodState;
 
     void setFromModel(const std::string&          modelPath,
                       uint32_t                    meshIndex,
@@ -55,9 +88,24 @@ struct SkeletonAnimatorComponent : public IComponent
         _skeletonIndex   = skeletonIndex;
         _skeleton        = std::move(skeleton);
         _time            = 0.0;
+        _clipCursor      = {};
         invalidatePose();
     }
 
+    void setPoseGraph(std::shared_ptr<const AnimationPoseGraph> graph)
+    {
+        _poseGraph = std::move(graph);
+        _graphInstance = {};
+        if (_poseGraph) {
+            _graphInstance.reset(*_poseGraph);
+        }
+        invalidatePose();
+    }
+
+    bool hasPoseGraph() const { return _poseGraph != nullptr && _poseGraph->isValid(); }
+    AnimationGraphInstance&       getGraphInstance() { return _graphInstance; }
+    const AnimationGraphInstance& getGraphInstance() const { return _graphInstance; }
+
     bool hasSkeleton() const { return _skeleton != nullptr; }
     const Skeleton* getSkeleton() const { return _skeleton.get(); }
     Skeleton* getSkeleton() { return _skeleton.get(); }
@@ -72,6 +120,11 @@ struct SkeletonAnimatorComponent : public IComponent
         return hasValidClip() ? &_skeleton->animations[_clipIndex] : nullptr;
     }
 
+    const CompressedSkeletonClip* getCompressedClip() const
+    {
+        return hasValidClip() ? _skeleton->getCompressedAnimation(_clipIndex) : nullptr;
+    }
+
     const SkeletonPose& getPose() const { return _pose; }
     SkeletonPose&       getPoseMut() { return _pose; }
 
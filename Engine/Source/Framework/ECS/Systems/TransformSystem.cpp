@@ -144,7 +144,11 @@ void TransformSystem::onUpdate(float /*dt*/)
     }
 
     // Step 1: Update Node-based hierarchy (if root node exists)
-    if (scene->_rootNode) {
+    if (_updateMode == EUpdateMode::Flattened) {
+        _flatHierarchy.sync(scene);
+        _flatHierarchy.update(scene->getRegistry(), _bParallelUpdate);
+    }
+    else if (scene->_rootNode) {
         updateNodeTree(scene->_rootNode.get(), nullptr);
     }
 
@@ -231,13 +235,19 @@ void TransformSystem::updateFlatTransforms(Scene *scene)
 
     auto view = registry.view<TransformComponent>();
     for (auto entityHandle : view) {
+        auto &tc = view.get<TransformComponent>(entityHandle);
+
+        // Clean transforms need no work; test this before the node map lookup,
+        // which would otherwise run for every hierarchy entity each frame.
+        if (!tc.isLocalDirty() && !tc.isWorldDirty()) {
+            continue;
+        }
+
         // Skip if this entity is managed by a Node
         if (scene->getNodeByEntity(entityHandle) != nullptr) {
             continue;
         }
 
-        auto &tc = view.get<TransformComponent>(entityHandle);
-
         // Compute local matrix if dirty
         if (tc.isLocalDirty()) {
             computeLocalMatrix(&tc);
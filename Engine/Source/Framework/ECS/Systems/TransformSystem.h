@@ -2,6 +2,7 @@
 
 #include "Core/Base.h"
 #include "Core/System/System.h"
+#include "FlatTransformHierarchy.h"
 
 #include <functional>
 
@@ -26,7 +27,10 @@ struct TransformComponent;
  * Call onUpdate() each frame before rendering to ensure all world matrices are up-to-date.
  *
  * Update Strategy:
- * 1. If using Node Tree: Traverse from root nodes, recursively update world transforms
+ * 1. If using Node Tree:
+ *    - Flattened (default): depth-ordered arrays, one level at a time, large
+ *      levels split across the JobSystem (see FlatTransformHierarchy)
+ *    - Recursive: traverse from root nodes, recursively update world transforms
  * 2. If using flat Entities: Simply copy local to world (no parent)
  */
 struct YA_ECS_SYSTEMS_API TransformSystem : public ISystem
@@ -34,9 +38,23 @@ struct YA_ECS_SYSTEMS_API TransformSystem : public ISystem
     using Self = TransformSystem;
     using SceneProvider = std::function<Scene*()>;
 
+    enum class EUpdateMode : uint8_t
+    {
+        Flattened, // Depth-ordered arrays, parallel per level
+        Recursive, // Walk Node children depth-first
+    };
+
     /// Injected seam (bound by the Host at startup; no App access from here).
     void setSceneProvider(SceneProvider provider);
 
+    void                      setUpdateMode(EUpdateMode mode) { _updateMode = mode; }
+    [[nodiscard]] EUpdateMode getUpdateMode() const { return _updateMode; }
+
+    /// Flattened mode only: split large levels across the JobSystem.
+    void setParallelUpdate(bool bEnable) { _bParallelUpdate = bEnable; }
+
+    [[nodiscard]] const FlatTransformHierarchy::Stats &getFlatHierarchyStats() const { return _flatHierarchy.getStats(); }
+
     void init() override {}
 
     /**
@@ -97,7 +115,10 @@ struct YA_ECS_SYSTEMS_API TransformSystem : public ISystem
     static void setWorldPosition(TransformComponent *tc, const glm::vec3 &worldPos);
 
   private:
-    SceneProvider _sceneProvider;
+    SceneProvider          _sceneProvider;
+    EUpdateMode            _updateMode      = EUpdateMode::Flattened;
+    bool                   _bParallelUpdate = true;
+    FlatTransformHierarchy _flatHierarchy;
 
     /**
      * @brief Recursively update world transforms for Node tree
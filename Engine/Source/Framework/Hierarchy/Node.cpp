@@ -1,5 +1,6 @@
 #include "Node.h"
 
+#include <atomic>
 
 namespace ya
 {
@@ -8,6 +9,49 @@ namespace ya
 // Node Implementation (Pure Hierarchy)
 // ============================================================================
 
+namespace
+{
+// Source of version values only; each tree keeps its own. Drawing them from
+// one counter keeps a new tree at a recycled address from matching a stale
+// cached version.
+std::atomic<uint64_t> g_nextStructureVersion{1};
+
+uint64_t nextStructureVersion()
+{
+    return g_nextStructureVersion.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace
+
+Node::Node(std::string name, Entity *entity)
+    : _name(std::move(name)),
+      _entity(entity),
+      _structureVersion(nextStructureVersion())
+{
+}
+
+const Node *Node::getRoot() const
+{
+    const Node *root = this;
+    while (root->_parent) {
+        root = root->_parent;
+    }
+    return root;
+}
+
+uint64_t Node::getStructureVersion() const
+{
+    return getRoot()->_structureVersion;
+}
+
+void Node::bumpStructureVersion()
+{
+    Node *root = this;
+    while (root->_parent) {
+        root = root->_parent;
+    }
+    root->_structureVersion = nextStructureVersion();
+}
+
 const std::string &Node::getName() const
 {
     return _name;
@@ -67,6 +111,7 @@ void Node::setParent(Node *parent, size_t childIndex)
 
     if (oldParent) {
         oldParent->removeChildInternal(this);
+        oldParent->bumpStructureVersion();
     }
 
     _parent = parent;
@@ -76,6 +121,9 @@ void Node::setParent(Node *parent, size_t childIndex)
         parent->_children.insert(parent->_children.begin() + static_cast<std::ptrdiff_t>(childIndex), this);
     }
 
+    // The tree this node joined; also covers becoming a root of its own.
+    bumpStructureVersion();
+
     // Notify derived classes (Node3D will update cached parent TC)
     onParentChanged();
 
@@ -110,6 +158,8 @@ void Node::removeChild(Node *child)
 
     child->_parent = nullptr;
     removeChildInternal(child);
+    bumpStructureVersion();
+    child->bumpStructureVersion();
 
     // Notify the removed child
     child->onParentChanged();
@@ -127,9 +177,13 @@ void Node::clearChildren()
 {
     for (auto *child : _children) {
         child->_parent = nullptr;
+        child->bumpStructureVersion();
         child->onParentChanged();
         child->onHierarchyDirty();
     }
+    if (!_children.empty()) {
+        bumpStructureVersion();
+    }
     _children.clear();
 }
 
@@ -33,9 +33,10 @@ struct YA_HIERARCHY_API Node : public disable_copy
     Node               *_parent = nullptr;
     std::vector<Node *> _children;
     Entity             *_entity = nullptr;
+    uint64_t            _structureVersion; // Meaningful on the root only
 
   public:
-    explicit Node(std::string name, Entity *entity) : _name(std::move(name)), _entity(entity) {}
+    explicit Node(std::string name, Entity *entity);
     virtual ~Node() = default;
 
     // === Identity ===
@@ -55,7 +56,8 @@ struct YA_HIERARCHY_API Node : public disable_copy
     {
         return index < _children.size() ? _children[index] : nullptr;
     }
-    [[nodiscard]] size_t getChildIndex(const Node *child) const;
+    [[nodiscard]] const Node *getRoot() const;
+    [[nodiscard]] size_t      getChildIndex(const Node *child) const;
     [[nodiscard]] bool   isAncestorOf(const Node *node) const;
 
     void setParent(Node *parent);
@@ -66,6 +68,16 @@ struct YA_HIERARCHY_API Node : public disable_copy
     void removeFromParent();
     void clearChildren();
 
+    /**
+     * @brief Version of the tree this node belongs to
+     *
+     * Changes on every parent/child edit inside the tree and only then, so a
+     * cache of one scene's shape (e.g. TransformSystem's flattened hierarchy)
+     * is not invalidated by edits to other scenes or detached subtrees.
+     * Walks to the root: O(depth).
+     */
+    [[nodiscard]] uint64_t getStructureVersion() const;
+
 
     // === Virtual Hooks for Derived Classes ===
     // These are public because they may be called on other Node instances during propagation
@@ -92,6 +104,9 @@ struct YA_HIERARCHY_API Node : public disable_copy
     virtual void onHierarchyDirty() {}
 
   protected:
+    /// Give the tree containing this node a fresh version.
+    void bumpStructureVersion();
+
     /**
      * @brief Internal: Remove child from children list without notifying
      */
@@ -1,5 +1,6 @@
 #include "PhysicsSystem.h"
 
+#include "Core/Async/JobSystem.h"
 #include "Core/Common/FWD-std.h"
 #include "Core/Log.h"
 #include "Scene3D/TransformComponent.h"
@@ -22,6 +23,8 @@
 
 #include "entt/entt.hpp"
 
+#include <atomic>
+
 // Explicitly import the Jolt length / scalar literal operators instead of
 // pulling the whole JPH::literals namespace into this translation unit.
 using JPH::literals::operator""_r;
@@ -213,6 +216,63 @@ struct PhysicsSystem::World
                                                 std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1)};
     JPH::PhysicsSystem                physicsSystem;
     std::unordered_map<entt::entity, JPH::BodyID> bodyIds;
+
+    struct BodyPose
+    {
+        glm::vec3 position = glm::vec3(0.0f);
+        glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    };
+    // Dynamic body poses around the last step of one step batch.
+    struct Snapshot
+    {
+        std::vector<entt::entity> entities;
+        std::vector<JPH::BodyID>  bodies;
+        std::vector<BodyPose>     previous; // Before the batch's last step
+        std::vector<BodyPose>     current;
+
+        void clear()
+        {
+            entities.clear();
+            bodies.clear();
+            previous.clear();
+            current.clear();
+        }
+    };
+    // Transforms are written from snapshots[front]; a step batch fills the other one.
+    Snapshot  snapshots[2];
+    uint32_t  front        = 0;
+    JobHandle stepJob;
+    bool      bStepPending = false;
+    // Written by the step, possibly while the game thread reads it.
+    std::atomic<std::thread::id> stepThread{};
+
+    void capturePoses(const std::vector<JPH::BodyID>& bodies, std::vector<BodyPose>& outPoses)
+    {
+        const JPH::BodyInterface& bodyInterface = physicsSystem.GetBodyInterface();
+        outPoses.resize(bodies.size());
+        for (size_t index = 0; index < bodies.size(); ++index) {
+            const JPH::RVec3 bodyPosition = bodyInterface.GetCenterOfMassPosition(bodies[index]);
+            const JPH::Quat  bodyRotation = bodyInterface.GetRotation(bodies[index]);
+            outPoses[index].position      = glm::vec3(static_cast<float>(bodyPosition.GetX()),
+                                                      static_cast<float>(bodyPosition.GetY()),
+                                                      static_cast<float>(bodyPosition.GetZ()));
+            // JPH::Quat stores (x, y, z, w); glm::quat stores (w, x, y, z).
+            outPoses[index].rotation      = glm::quat(bodyRotation.GetW(), bodyRotation.GetX(), bodyRotation.GetY(), bodyRotation.GetZ());
+        }
+    }
+
+    // Touches only Jolt and `target`, so it may run off the game thread.
+    void step(Snapshot& target, uint32_t stepCount)
+    {
+        stepThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        for (uint32_t index = 0; index < stepCount; ++index) {
+            if (index + 1 == stepCount) {
+                capturePoses(target.bodies, target.previous);
+            }
+            physicsSystem.Update(kFixedDeltaTime, 1, &tempAllocator, &jobSystem);
+        }
+        capturePoses(target.bodies, target.current);
+    }
 };
 
 PhysicsSystem::~PhysicsSystem() = default;
@@ -269,6 +329,9 @@ void PhysicsSystem::onUpdate(float dt)
         return;
     }
 
+    // Jolt must not be touched while last frame's step batch is in flight.
+    waitForStep();
+
     // Defensive consistency for hosts without a SceneManager (or a missed
     // event): bodies always belong to the scene we are simulating.
     if (_bodyOwnerScene != scene) {
@@ -279,15 +342,77 @@ void PhysicsSystem::onUpdate(float dt)
     auto& registry = scene->getRegistry();
     reconcileBodies(registry);
 
+    JobSystem& jobs   = JobSystem::get();
+    const bool bAsync = _bAsyncStep && jobs.isRunning() && jobs.getWorkerCount() > 0;
+    if (bAsync) {
+        // Show the batch that ran during the previous frame, at the alpha it was kicked with.
+        writebackTransforms(registry);
+    }
+
     // Fixed-timestep simulation. Buffered time is capped so a hitch cannot
     // turn into an unbounded catch-up loop.
-    _accumulator = std::min(_accumulator + dt, kMaxBufferedTime);
+    _accumulator       = std::min(_accumulator + dt, kMaxBufferedTime);
+    uint32_t stepCount = 0;
     while (_accumulator >= kFixedDeltaTime) {
-        _world->physicsSystem.Update(kFixedDeltaTime, 1, &_world->tempAllocator, &_world->jobSystem);
         _accumulator -= kFixedDeltaTime;
+        ++stepCount;
+    }
+    _alpha = _bInterpolate ? std::clamp(_accumulator / kFixedDeltaTime, 0.0f, 1.0f) : 1.0f;
+
+    if (stepCount > 0) {
+        kickStep(registry, stepCount, bAsync);
+    }
+    if (!bAsync) {
+        writebackTransforms(registry);
     }
+}
 
-    writebackTransforms(registry);
+void PhysicsSystem::setAsyncStep(bool bEnable)
+{
+    waitForStep();
+    _bAsyncStep = bEnable;
+}
+
+void PhysicsSystem::kickStep(entt::registry& registry, uint32_t stepCount, bool bAsync)
+{
+    World&           world  = *_world;
+    World::Snapshot& target = world.snapshots[world.front ^ 1];
+    target.entities.clear();
+    target.bodies.clear();
+    for (const auto& [entity, bodyId] : world.bodyIds) {
+        if (registry.get<PhysicsBodyComponent>(entity)._isDynamic) {
+            target.entities.push_back(entity);
+            target.bodies.push_back(bodyId);
+        }
+    }
+
+    if (!bAsync) {
+        world.step(target, stepCount);
+        world.front ^= 1;
+        return;
+    }
+
+    // Background: a game-thread wait or parallelFor later this frame must not
+    // pick the whole batch up and run it inline.
+    world.stepJob      = JobSystem::get().scheduleBackground([&world, &target, stepCount]() { world.step(target, stepCount); });
+    world.bStepPending = true;
+}
+
+void PhysicsSystem::waitForStep()
+{
+    if (!_world || !_world->bStepPending) {
+        return;
+    }
+    // Help with background work too: the step may still be queued behind the
+    // background limit, and the game thread has nothing else to do here.
+    JobSystem::get().waitBackground(_world->stepJob);
+    _world->bStepPending = false;
+    _world->front ^= 1;
+}
+
+std::thread::id PhysicsSystem::getLastStepThread() const
+{
+    return _world ? _world->stepThread.load(std::memory_order_relaxed) : std::thread::id{};
 }
 
 void PhysicsSystem::onAppStateChanged(AppState state)
@@ -378,29 +503,19 @@ void PhysicsSystem::writebackTransforms(entt::registry& registry)
     if (!_world) {
         return;
     }
-    JPH::BodyInterface& bodyInterface = _world->physicsSystem.GetBodyInterface();
-
-    for (auto&& [entity, transform, bodyComponent] :
-         registry.view<TransformComponent, PhysicsBodyComponent>().each()) {
-        if (!bodyComponent._isDynamic) {
-            continue; // Static bodies never move.
+    // Only dynamic bodies are snapshotted; static bodies never move.
+    const World::Snapshot& snapshot = _world->snapshots[_world->front];
+    for (size_t index = 0; index < snapshot.entities.size(); ++index) {
+        const entt::entity entity = snapshot.entities[index];
+        if (!registry.valid(entity) || !registry.all_of<TransformComponent, PhysicsBodyComponent>(entity)) {
+            continue; // Lost its body since the snapshot was taken.
         }
 
-        const auto it = _world->bodyIds.find(entity);
-        if (it == _world->bodyIds.end()) {
-            continue;
-        }
-
-        const JPH::RVec3 bodyPosition = bodyInterface.GetCenterOfMassPosition(it->second);
-        const JPH::Quat  bodyRotation = bodyInterface.GetRotation(it->second);
-
-        transform.setPosition(glm::vec3(static_cast<float>(bodyPosition.GetX()),
-                                        static_cast<float>(bodyPosition.GetY()),
-                                        static_cast<float>(bodyPosition.GetZ())));
-
-        // JPH::Quat stores (x, y, z, w); glm::quat stores (w, x, y, z).
-        const glm::quat glmQuat(bodyRotation.GetW(), bodyRotation.GetX(), bodyRotation.GetY(), bodyRotation.GetZ());
-        transform.setRotation(glm::degrees(glm::eulerAngles(glmQuat)));
+        const World::BodyPose& from      = snapshot.previous[index];
+        const World::BodyPose& to        = snapshot.current[index];
+        auto&                  transform = registry.get<TransformComponent>(entity);
+        transform.setPosition(glm::mix(from.position, to.position, _alpha));
+        transform.setRotation(glm::degrees(glm::eulerAngles(glm::slerp(from.rotation, to.rotation, _alpha))));
     }
 }
 
@@ -409,6 +524,11 @@ void PhysicsSystem::clearAllBodies()
     if (!_world) {
         return;
     }
+    waitForStep();
+    // Snapshots name entities, which a fresh scene may reuse.
+    _world->snapshots[0].clear();
+    _world->snapshots[1].clear();
+
     JPH::BodyInterface& bodyInterface = _world->physicsSystem.GetBodyInterface();
     for (const auto& [entity, bodyId] : _world->bodyIds) {
         bodyInterface.RemoveBody(bodyId);
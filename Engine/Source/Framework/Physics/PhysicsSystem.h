@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <memory>
+#include <thread>
 
 #include "entt/entt.hpp"
 
@@ -24,6 +25,19 @@ struct SceneManager;
  * resulting body positions / rotations are written back into the entity
  * transforms every frame.
  *
+ * Each step batch records the dynamic body poses before and after its last
+ * step into one of two snapshot buffers. Transforms are interpolated between
+ * those poses by the accumulator remainder, so motion stays smooth when the
+ * frame rate is not a multiple of the step rate.
+ *
+ * With async stepping the step batch runs as a background JobSystem job
+ * kicked at the end of onUpdate(), overlapping the rest of the frame
+ * (rendering included). Being background work, frame-critical waits and
+ * parallelFor calls on the game thread never pick it up and run it inline.
+ * The next onUpdate() waits for it and applies its snapshot, so transforms
+ * trail the simulation by one frame. Every Jolt access on the game thread
+ * (body reconciliation, cleanup) waits for the pending step first.
+ *
  * All Jolt state lives behind the World pimpl so this header (and every TU
  * that includes it) stays free of Jolt headers and its global allocator hooks.
  */
@@ -44,8 +58,12 @@ struct YA_PHYSICS_API PhysicsSystem : public ISystem
     DelegateHandle _onSceneActivatedHandle = INVALID_HANDLE;
     DelegateHandle _onSceneDestroyHandle   = INVALID_HANDLE;
     bool           _bSimulationActive      = false;
+    bool           _bAsyncStep             = false;
+    bool           _bInterpolate           = true;
 
     float                  _accumulator    = 0.0f;
+    // Accumulator remainder as a fraction of a step; blends the snapshot poses.
+    float                  _alpha          = 1.0f;
     static constexpr float kFixedDeltaTime = 1.0f / 60.0f;
 
   public:
@@ -56,6 +74,15 @@ struct YA_PHYSICS_API PhysicsSystem : public ISystem
     /// Simulation follows app mode transitions (Runtime / Simulation on,
     /// Stopped off). Without a source the system defaults to always active.
     void setAppStateChangedSource(MulticastDelegate<void(AppState)>* source) { _appStateChangedSource = source; }
+    /// Step on the JobSystem (when running) overlapped with the rest of the
+    /// frame instead of blocking onUpdate(). Off by default.
+    void setAsyncStep(bool bEnable);
+    [[nodiscard]] bool isAsyncStep() const { return _bAsyncStep; }
+    /// Interpolate transforms between the last two steps (default) instead of
+    /// snapping to the latest step.
+    void setInterpolateTransforms(bool bEnable) { _bInterpolate = bEnable; }
+    /// Thread that ran the latest step batch (default id before the first one).
+    [[nodiscard]] std::thread::id getLastStepThread() const;
 
     void init() override;
     void onUpdate(float dt) override;
@@ -67,6 +94,8 @@ struct YA_PHYSICS_API PhysicsSystem : public ISystem
     void onSceneDestroyed(Scene* scene);
     void reconcileBodies(entt::registry& registry);
     void writebackTransforms(entt::registry& registry);
+    void kickStep(entt::registry& registry, uint32_t stepCount, bool bAsync);
+    void waitForStep();
     void clearAllBodies();
 };
 
@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstddef>
 #include <cstring>
+#include <span>
 
 #include "RHI/Core/Buffer.h"
 #include "RHI/Core/CommandBuffer.h"
@@ -347,15 +348,6 @@ std::shared_ptr<Texture> Texture::createSolidCubeMap(IRender& render, const Colo
     };
     assignTextureResource(*texture, image, imageView, resourceDesc);
 
-    std::shared_ptr<IBuffer> stagingBuffer = resourceFactory.createBuffer(
-        BufferCreateInfo{
-            .label       = std::format("StagingBuffer_CubeMap_{}", texture->_label),
-            .usage       = EBufferUsage::TransferSrc,
-            .data        = facePixels.data(),
-            .size        = static_cast<uint32_t>(sizeof(facePixels)),
-            .memoryUsage = EMemoryUsage::CpuToGpu,
-        });
-
     ImageSubresourceRange cubeRange{
         .aspectMask     = EImageAspect::Color,
         .baseMipLevel   = 0,
@@ -368,9 +360,9 @@ std::shared_ptr<Texture> Texture::createSolidCubeMap(IRender& render, const Colo
     if (!uploadService.upload(
             render,
             TextureUploadRequest{
-                .image   = texture->getImageShared(),
-                .staging = stagingBuffer,
-                .regions = {{
+                .image      = texture->getImageShared(),
+                .sourceData = std::as_bytes(std::span(facePixels)),
+                .regions    = {{
                     .bufferOffset      = 0,
                     .bufferRowLength   = 0,
                     .bufferImageHeight = 0,
@@ -495,14 +487,6 @@ void Texture::initFromData(IRender& render,
         return;
     }
 
-    std::shared_ptr<IBuffer> stagingBuffer = resourceFactory.createBuffer(
-        ya::BufferCreateInfo{
-            .label       = std::format("StagingBuffer_Texture_{}", _filepath.empty() ? _label : _filepath),
-            .usage       = EBufferUsage::TransferSrc,
-            .data        = const_cast<void*>(pixels),
-            .size        = static_cast<uint32_t>(imageSize),
-            .memoryUsage = EMemoryUsage::CpuToGpu,
-        });
 
     std::vector<BufferImageCopy> regions;
     const bool                   isCompressed = EFormat::isBlockCompressed(format);
@@ -581,7 +565,7 @@ void Texture::initFromData(IRender& render,
             render,
             TextureUploadRequest{
                 .image            = image,
-                .staging          = stagingBuffer,
+                .sourceData       = std::span(static_cast<const std::byte*>(pixels), static_cast<size_t>(imageSize)),
                 .regions          = std::move(regions),
                 .bGenerateMipmaps = bGenerateMipmaps,
                 .finalLayout      = EImageLayout::ShaderReadOnlyOptimal,
@@ -676,22 +660,13 @@ void Texture::initFallbackTexture(IRender& render, const void* pixels, size_t da
         return;
     }
 
-    std::shared_ptr<IBuffer> stagingBuffer = resourceFactory.createBuffer(
-        ya::BufferCreateInfo{
-            .label       = std::format("StagingBuffer_Fallback_{}", _label),
-            .usage       = EBufferUsage::TransferSrc,
-            .data        = const_cast<void*>(pixels),
-            .size        = static_cast<uint32_t>(dataSize),
-            .memoryUsage = EMemoryUsage::CpuToGpu,
-        });
-
     TextureUploadService uploadService;
     if (!uploadService.upload(
             render,
             TextureUploadRequest{
-                .image   = image,
-                .staging = stagingBuffer,
-                .regions = {{
+                .image      = image,
+                .sourceData = std::span(static_cast<const std::byte*>(pixels), dataSize),
+                .regions    = {{
                     .bufferOffset      = 0,
                     .bufferRowLength   = 0,
                     .bufferImageHeight = 0,
@@ -799,14 +774,6 @@ void Texture::initCubeMapFromMemory(IRender& render, const CubeMapMemoryCreateIn
         }
     }
 
-    std::shared_ptr<IBuffer> stagingBuffer = resourceFactory.createBuffer(
-        BufferCreateInfo{
-            .label       = std::format("StagingBuffer_CubeMap_{}", _label),
-            .usage       = EBufferUsage::TransferSrc,
-            .data        = stagingData.data(),
-            .size        = static_cast<uint32_t>(totalSize),
-            .memoryUsage = EMemoryUsage::CpuToGpu,
-        });
 
     ImageSubresourceRange cubeRange{
         .aspectMask     = EImageAspect::Color,
@@ -820,9 +787,9 @@ void Texture::initCubeMapFromMemory(IRender& render, const CubeMapMemoryCreateIn
     if (!uploadService.upload(
             render,
             TextureUploadRequest{
-                .image   = image,
-                .staging = stagingBuffer,
-                .regions = {{
+                .image      = image,
+                .sourceData = std::as_bytes(std::span(stagingData)),
+                .regions    = {{
                     .bufferOffset      = 0,
                     .bufferRowLength   = 0,
                     .bufferImageHeight = 0,
@@ -11,18 +11,57 @@ namespace ya
 
 VulkanBuffer::~VulkanBuffer()
 {
-    if (_handle != VK_NULL_HANDLE && _allocation != VK_NULL_HANDLE) {
-        if (bMemoryMapped) {
-            vmaUnmapMemory(_render->getVmaAllocator(), _allocation);
-        }
-        vmaDestroyBuffer(_render->getVmaAllocator(), _handle, _allocation);
-        _handle     = VK_NULL_HANDLE;
-        _allocation = VK_NULL_HANDLE;
+    if (_handle == VK_NULL_HANDLE || _allocation == VK_NULL_HANDLE) {
+        return;
     }
+    if (bMemoryMapped) {
+        vmaUnmapMemory(_render->getVmaAllocator(), _allocation);
+    }
+
+    // A submitted upload batch may still be copying into this buffer; its
+    // memory is released once that batch retires.
+    auto release = [allocator = _render->getVmaAllocator(), handle = _handle, allocation = _allocation]() {
+        vmaDestroyBuffer(allocator, handle, allocation);
+    };
+    auto* uploadQueue = _render->getUploadQueue();
+    if (!uploadQueue || !uploadQueue->forget(this, release)) {
+        release();
+    }
+    _handle     = VK_NULL_HANDLE;
+    _allocation = VK_NULL_HANDLE;
 }
 
 void VulkanBuffer::createWithDataInternal(const void* data, uint32_t size, EMemoryUsage memUsage)
 {
+    if (bHostVisible) {
+        // Host-visible buffers (staging, dynamic data) are written in place;
+        // no device copy is involved.
+        VulkanBuffer::allocate(_render, size, memUsage, _usageFlags, _handle, _allocation);
+        void* mappedData = nullptr;
+        VK_CALL(vmaMapMemory(_render->getVmaAllocator(), _allocation, &mappedData));
+        std::memcpy(mappedData, data, size);
+        if (!bHostCoherent) {
+            vmaFlushAllocation(_render->getVmaAllocator(), _allocation, 0, VK_WHOLE_SIZE);
+        }
+        vmaUnmapMemory(_render->getVmaAllocator(), _allocation);
+        return;
+    }
+
+    VulkanBuffer::allocate(_render,
+                           static_cast<uint32_t>(size),
+                           EMemoryUsage::GpuOnly,
+                           _usageFlags | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                           _handle,
+                           _allocation);
+
+    // Batched with the frame's other uploads; flushed before any submission
+    // that could read this buffer.
+    if (auto* uploadQueue = _render->getUploadQueue()) {
+        const auto bytes = std::span(static_cast<const std::byte*>(data), size);
+        if (uploadQueue->uploadBuffer(this, 0, bytes, name).valid()) {
+            return;
+        }
+    }
 
     VkBuffer      stageBuffer     = nullptr;
     VmaAllocation stageAllocation = nullptr;
@@ -39,13 +78,6 @@ void VulkanBuffer::createWithDataInternal(const void* data, uint32_t size, EMemo
     std::memcpy(mappedData, data, size);
     vmaUnmapMemory(_render->getVmaAllocator(), stageAllocation);
 
-    VulkanBuffer::allocate(_render,
-                           static_cast<uint32_t>(size),
-                           EMemoryUsage::GpuOnly,
-                           _usageFlags | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                           _handle,
-                           _allocation);
-
     VulkanBuffer::transfer(_render, stageBuffer, _handle, size, "fromRowData");
 
     vmaDestroyBuffer(_render->getVmaAllocator(), stageBuffer, stageAllocation);
@@ -267,6 +267,30 @@ void VulkanCommandPool::cleanup()
 }
 
 bool VulkanCommandBuffer::begin(bool oneTimeSubmit)
+{
+    _bSecondary = false;
+    return beginRecording(oneTimeSubmit ? VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT : 0u, nullptr);
+}
+
+bool VulkanCommandBuffer::beginSecondary()
+{
+    // Not RENDER_PASS_CONTINUE: the secondary begins and ends its own
+    // dynamic rendering, so nothing is inherited.
+    const VkCommandBufferInheritanceInfo inheritance{
+        .sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        .pNext                = nullptr,
+        .renderPass           = VK_NULL_HANDLE,
+        .subpass              = 0,
+        .framebuffer          = VK_NULL_HANDLE,
+        .occlusionQueryEnable = VK_FALSE,
+        .queryFlags           = 0,
+        .pipelineStatistics   = 0,
+    };
+    _bSecondary = true;
+    return beginRecording(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, &inheritance);
+}
+
+bool VulkanCommandBuffer::beginRecording(VkCommandBufferUsageFlags flags, const VkCommandBufferInheritanceInfo* inheritance)
 {
     clearRetainedResources();
 #if YA_CMDBUF_RECORD_MODE
@@ -277,8 +301,8 @@ bool VulkanCommandBuffer::begin(bool oneTimeSubmit)
     VkCommandBufferBeginInfo beginInfo{
         .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext            = nullptr,
-        .flags            = oneTimeSubmit ? VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT : 0u,
-        .pInheritanceInfo = nullptr,
+        .flags            = flags,
+        .pInheritanceInfo = inheritance,
     };
 
     VkResult result = vkBeginCommandBuffer(_commandBuffer, &beginInfo);
@@ -301,6 +325,25 @@ bool VulkanCommandBuffer::end()
     return false;
 }
 
+bool VulkanCommandBuffer::executeSecondary(ICommandBuffer& secondary)
+{
+    auto* vkSecondary = dynamic_cast<VulkanCommandBuffer*>(&secondary);
+    YA_CORE_ASSERT(vkSecondary && vkSecondary->_bSecondary && !vkSecondary->_isRecording,
+                   "executeSecondary expects an ended secondary command buffer");
+    YA_CORE_ASSERT(_currentRenderingMode == ERenderingMode::None,
+                   "Secondary command buffers must be executed outside rendering");
+    if (!vkSecondary || _bSecondary) {
+        return false;
+    }
+
+    vkCmdExecuteCommands(_commandBuffer, 1, &vkSecondary->_commandBuffer);
+    for (auto& resource : vkSecondary->retainedResources) {
+        retainResource(std::move(resource));
+    }
+    vkSecondary->clearRetainedResources();
+    return true;
+}
+
 void VulkanCommandBuffer::reset()
 {
     vkResetCommandBuffer(_commandBuffer, 0);
@@ -482,41 +525,11 @@ void VulkanCommandBuffer::executeEndRendering(const RenderingInfo& info)
 
         if (!info.bExternalTransitionManagement) {
             // Final layout transitions for manual image path
-            std::vector<VulkanImage::LayoutTransition> transitions;
-            for (auto& attachment : info.attachments.colors) {
-                if (attachment.finalLayout != EImageLayout::Undefined && attachment.image) {
-                    if (auto* vkImg = dynamic_cast<VulkanImage*>(attachment.image)) {
-                        VulkanImage::LayoutTransition transition{vkImg, attachment.finalLayout};
-                        if (tryResolveRenderAttachmentSubresourceRange(attachment, transition.range)) {
-                            transition.useRange = true;
-                        }
-                        transitions.push_back(transition);
-                    }
+            forEachRenderingLayoutTransition(info, true, [this](IImage* image, EImageLayout::T layout, const ImageSubresourceRange* range) {
+                if (dynamic_cast<VulkanImage*>(image)) {
+                    executeTrackedTransition(image, layout, range);
                 }
-
-                if (attachment.finalLayout != EImageLayout::Undefined && attachment.resolveImage) {
-                    if (auto* vkImg = dynamic_cast<VulkanImage*>(attachment.resolveImage)) {
-                        transitions.push_back(VulkanImage::LayoutTransition{vkImg, attachment.finalLayout});
-                    }
-                }
-            }
-            if (info.attachments.depth) {
-                auto& attachment = *info.attachments.depth;
-                if (attachment.finalLayout != EImageLayout::Undefined && attachment.image) {
-                    if (auto* vkImg = dynamic_cast<VulkanImage*>(attachment.image)) {
-                        VulkanImage::LayoutTransition transition{vkImg, attachment.finalLayout};
-                        if (tryResolveRenderAttachmentSubresourceRange(attachment, transition.range)) {
-                            transition.useRange = true;
-                        }
-                        transitions.push_back(transition);
-                    }
-                }
-            }
-            if (!transitions.empty()) {
-                for (const auto& transition : transitions) {
-                    executeTrackedTransition(transition.image, transition.newLayout, transition.useRange ? &transition.range : nullptr);
-                }
-            }
+            });
         }
     }
 
@@ -847,6 +860,7 @@ void VulkanCommandBuffer::executeTrackedTransition(IImage* image, EImageLayout::
     if (!image) {
         return;
     }
+    YA_CORE_ASSERT(!_bSecondary, "Tracked layout transitions are not recorded into secondary command buffers");
     for (const auto& transition : _resourceStateTracker.transition(*image, newLayout, subresourceRange)) {
         executeTransitionImageLayout(transition.image, transition.oldState.layout, transition.newState.layout, &transition.range);
     }
@@ -1121,45 +1135,11 @@ void VulkanCommandBuffer::beginDynamicRenderingFromManualImages(const RenderingI
     }
 
     if (!info.bExternalTransitionManagement) {
-        std::vector<VulkanImage::LayoutTransition> transitions;
-        for (auto& attachment : info.attachments.colors) {
-            if (attachment.initialLayout != EImageLayout::Undefined && attachment.image) {
-                if (auto* vkImg = dynamic_cast<VulkanImage*>(attachment.image)) {
-                    VulkanImage::LayoutTransition transition{vkImg, attachment.initialLayout};
-                    if (tryResolveRenderAttachmentSubresourceRange(attachment, transition.range)) {
-                        transition.useRange = true;
-                    }
-                    transitions.push_back(transition);
-                }
+        forEachRenderingLayoutTransition(info, false, [this](IImage* image, EImageLayout::T layout, const ImageSubresourceRange* range) {
+            if (dynamic_cast<VulkanImage*>(image)) {
+                executeTrackedTransition(image, layout, range);
             }
-
-            if (attachment.initialLayout != EImageLayout::Undefined && attachment.resolveImage) {
-                if (auto* vkImg = dynamic_cast<VulkanImage*>(attachment.resolveImage)) {
-                    transitions.push_back(VulkanImage::LayoutTransition{vkImg, attachment.initialLayout});
-                }
-            }
-        }
-        if (info.attachments.depth) {
-            auto& attachment   = *info.attachments.depth;
-            auto  targetLayout = attachment.initialLayout;
-            if (targetLayout == EImageLayout::Undefined) {
-                targetLayout = EImageLayout::DepthStencilAttachmentOptimal;
-            }
-            if (attachment.image) {
-                if (auto* vkImg = dynamic_cast<VulkanImage*>(attachment.image)) {
-                    VulkanImage::LayoutTransition transition{vkImg, targetLayout};
-                    if (tryResolveRenderAttachmentSubresourceRange(attachment, transition.range)) {
-                        transition.useRange = true;
-                    }
-                    transitions.push_back(transition);
-                }
-            }
-        }
-        if (!transitions.empty()) {
-            for (const auto& transition : transitions) {
-                executeTrackedTransition(transition.image, transition.newLayout, transition.useRange ? &transition.range : nullptr);
-            }
-        }
+        });
     }
 
     // Build color attachments from manual images
@@ -1266,6 +1246,7 @@ void VulkanCommandBuffer::transitionImageLayout(
     EImageLayout::T              newLayout,
     const ImageSubresourceRange* subresourceRange)
 {
+    YA_CORE_ASSERT(!_bSecondary, "Tracked layout transitions are not recorded into secondary command buffers");
     validateTrackedOldLayout(image, oldLayout, subresourceRange);
     executeTransitionImageLayout(image, oldLayout, newLayout, subresourceRange);
     if (image) {
@@ -25,6 +25,7 @@ class YA_RHI_BACKEND_API VulkanCommandBuffer : public ICommandBuffer
     VulkanRender*   _render        = nullptr;
     VkCommandBuffer _commandBuffer = VK_NULL_HANDLE;
     bool            _isRecording   = false;
+    bool            _bSecondary    = false;
     uint32_t        _debugLabelDepth = 0;
     std::string     _debugName;
     ResourceStateTracker _resourceStateTracker;
@@ -107,6 +108,7 @@ class YA_RHI_BACKEND_API VulkanCommandBuffer : public ICommandBuffer
     void validateTrackedOldLayout(IImage* image, EImageLayout::T oldLayout, const ImageSubresourceRange* subresourceRange);
     void executeTrackedTransition(IImage* image, EImageLayout::T newLayout,
                                   const ImageSubresourceRange* subresourceRange = nullptr);
+    bool beginRecording(VkCommandBufferUsageFlags flags, const VkCommandBufferInheritanceInfo* inheritance);
 
   public:
     VulkanCommandBuffer(VulkanRender* render, VkCommandBuffer commandBuffer)
@@ -132,11 +134,19 @@ class YA_RHI_BACKEND_API VulkanCommandBuffer : public ICommandBuffer
     [[nodiscard]] const std::string& getDebugName() const { return _debugName; }
 
     bool begin(bool oneTimeSubmit = false) override;
+    /**
+     * Begin as a one-time secondary command buffer that opens its own dynamic
+     * rendering scopes. Image layouts are only known in the primary's order,
+     * so a secondary records no tracked transitions: rendering must use
+     * bExternalTransitionManagement and the primary emits the transitions.
+     */
+    bool beginSecondary();
     bool end() override;
     void reset() override;
     bool generateMipmaps(IImage* image,
                          EImageLayout::T baseLevelLayout,
                          EImageLayout::T finalLayout) override;
+    bool executeSecondary(ICommandBuffer& secondary) override;
 
 #if YA_CMDBUF_RECORD_MODE
     void executeAll() override;
@@ -0,0 +1,147 @@
+#include "VulkanPipelineCache.h"
+
+#include "Core/Log.h"
+
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <thread>
+
+namespace ya::vulkan_pipeline_cache
+{
+
+namespace
+{
+
+// FNV-1a; only guards against truncated / bit-rotted files, the identity
+// check is what rejects foreign blobs.
+uint64_t hashBlob(std::span<const uint8_t> blob)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const uint8_t byte : blob) {
+        hash ^= byte;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+bool matchesIdentity(const VulkanPipelineCacheFileHeader& header, const VulkanPipelineCacheIdentity& identity)
+{
+    return header.vendorID == identity.vendorID &&
+           header.deviceID == identity.deviceID &&
+           header.driverVersion == identity.driverVersion &&
+           std::memcmp(header.pipelineCacheUUID, identity.pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+}
+
+} // namespace
+
+std::filesystem::path makeCachePath(const std::filesystem::path& directory, const VulkanPipelineCacheIdentity& identity)
+{
+    return directory / std::format("Vulkan_{:04x}_{:04x}.bin", identity.vendorID, identity.deviceID);
+}
+
+bool isBlobCompatible(std::span<const uint8_t> blob, const VulkanPipelineCacheIdentity& identity)
+{
+    VkPipelineCacheHeaderVersionOne header{};
+    if (blob.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, blob.data(), sizeof(header));
+    return header.headerSize >= sizeof(header) &&
+           header.headerSize <= blob.size() &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == identity.vendorID &&
+           header.deviceID == identity.deviceID &&
+           std::memcmp(header.pipelineCacheUUID, identity.pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+}
+
+std::vector<uint8_t> loadBlob(const std::filesystem::path& path, const VulkanPipelineCacheIdentity& identity)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input.is_open()) {
+        return {};
+    }
+
+    VulkanPipelineCacheFileHeader header{};
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!input.good() ||
+        header.magic != VulkanPipelineCacheFileHeader::MAGIC ||
+        header.version != VulkanPipelineCacheFileHeader::VERSION) {
+        YA_CORE_WARN("Pipeline cache {}: unknown format, ignored", path.generic_string());
+        return {};
+    }
+    if (!matchesIdentity(header, identity)) {
+        YA_CORE_INFO("Pipeline cache {}: written by another device or driver, ignored", path.generic_string());
+        return {};
+    }
+
+    std::error_code ec;
+    const auto      fileSize = std::filesystem::file_size(path, ec);
+    if (ec || header.dataSize != fileSize - sizeof(header)) {
+        YA_CORE_WARN("Pipeline cache {}: truncated, ignored", path.generic_string());
+        return {};
+    }
+
+    std::vector<uint8_t> blob(static_cast<size_t>(header.dataSize));
+    input.read(reinterpret_cast<char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+    if (!input.good() || hashBlob(blob) != header.dataHash || !isBlobCompatible(blob, identity)) {
+        YA_CORE_WARN("Pipeline cache {}: corrupt, ignored", path.generic_string());
+        return {};
+    }
+    return blob;
+}
+
+bool saveBlob(const std::filesystem::path& path, const VulkanPipelineCacheIdentity& identity, std::span<const uint8_t> blob)
+{
+    if (!isBlobCompatible(blob, identity)) {
+        return false;
+    }
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec) {
+            return false;
+        }
+    }
+
+    auto tempPath = path;
+    tempPath += std::format(".{:x}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    VulkanPipelineCacheFileHeader header{
+        .vendorID      = identity.vendorID,
+        .deviceID      = identity.deviceID,
+        .driverVersion = identity.driverVersion,
+        .dataSize      = blob.size(),
+        .dataHash      = hashBlob(blob),
+    };
+    std::memcpy(header.pipelineCacheUUID, identity.pipelineCacheUUID.data(), VK_UUID_SIZE);
+
+    {
+        std::ofstream output(tempPath, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            return false;
+        }
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+        if (!output.good()) {
+            output.close();
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        // Windows refuses to rename over an open / existing file in some setups.
+        std::filesystem::remove(path, ec);
+        std::filesystem::rename(tempPath, path, ec);
+    }
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace ya::vulkan_pipeline_cache
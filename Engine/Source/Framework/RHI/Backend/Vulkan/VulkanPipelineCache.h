@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Core/Base.h"
+
+#include <vulkan/vulkan.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace ya
+{
+
+/// The device/driver a VkPipelineCache blob was produced by. A blob from any
+/// other identity is discarded: drivers may reject it, or worse, accept it.
+struct VulkanPipelineCacheIdentity
+{
+    uint32_t                          vendorID      = 0;
+    uint32_t                          deviceID      = 0;
+    uint32_t                          driverVersion = 0;
+    std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUUID{};
+
+    bool operator==(const VulkanPipelineCacheIdentity&) const = default;
+
+    static VulkanPipelineCacheIdentity fromProperties(const VkPhysicalDeviceProperties& properties)
+    {
+        VulkanPipelineCacheIdentity identity{
+            .vendorID      = properties.vendorID,
+            .deviceID      = properties.deviceID,
+            .driverVersion = properties.driverVersion,
+        };
+        std::copy(std::begin(properties.pipelineCacheUUID), std::end(properties.pipelineCacheUUID), identity.pipelineCacheUUID.begin());
+        return identity;
+    }
+};
+
+/// File prefix in front of the driver's blob. The driver header
+/// (VkPipelineCacheHeaderVersionOne) has no driver version, hence our own.
+struct VulkanPipelineCacheFileHeader
+{
+    static constexpr uint32_t MAGIC   = 0x59415043; // YAPC
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic         = MAGIC;
+    uint32_t version       = VERSION;
+    uint32_t vendorID      = 0;
+    uint32_t deviceID      = 0;
+    uint32_t driverVersion = 0;
+    uint8_t  pipelineCacheUUID[VK_UUID_SIZE]{};
+    uint32_t reserved      = 0;
+    uint64_t dataSize      = 0;
+    uint64_t dataHash      = 0;
+};
+
+namespace vulkan_pipeline_cache
+{
+
+/// Default location: one file per vendor/device pair, so switching GPUs does
+/// not throw away the other one's cache.
+YA_RHI_BACKEND_API std::filesystem::path makeCachePath(const std::filesystem::path& directory, const VulkanPipelineCacheIdentity& identity);
+
+/// Whether @p blob starts with a VkPipelineCacheHeaderVersionOne for @p identity.
+YA_RHI_BACKEND_API bool isBlobCompatible(std::span<const uint8_t> blob, const VulkanPipelineCacheIdentity& identity);
+
+/// Read the blob saved for @p identity. Empty when the file is missing,
+/// truncated, corrupt or from another device / driver.
+YA_RHI_BACKEND_API std::vector<uint8_t> loadBlob(const std::filesystem::path& path, const VulkanPipelineCacheIdentity& identity);
+
+/// Write through a temp file and rename, so a crash mid-save leaves the
+/// previous cache intact.
+YA_RHI_BACKEND_API bool saveBlob(const std::filesystem::path& path, const VulkanPipelineCacheIdentity& identity, std::span<const uint8_t> blob);
+
+} // namespace vulkan_pipeline_cache
+
+} // namespace ya
@@ -1,6 +1,7 @@
 #include "VulkanRender.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanDescriptorSet.h"
+#include "VulkanPipelineCache.h"
 #include "VulkanSampler.h"
 #include "RHI/NativeWindow.h"
 
@@ -46,6 +47,8 @@ void VulkanRender::releaseTrackedSamplers()
 
 namespace
 {
+constexpr const char* PIPELINE_CACHE_DIRECTORY = "Engine/Intermediate/PipelineCache";
+
 struct FormatSupportSummary
 {
     VkFormat format             = VK_FORMAT_UNDEFINED;
@@ -214,8 +217,13 @@ void VulkanRender::destroyInternal()
         std::this_thread::sleep_for(std::chrono::milliseconds(2000));
     }
 
+    // The upload queue owns a staging buffer; release it while VMA is alive.
+    _uploadQueue.reset();
+    releaseAsyncCommandResources();
+    releaseSecondaryCommandPools();
     releaseSyncResources();
     releaseFrameGpuTimingResources();
+    savePipelineCache();
     VK_DESTROY(PipelineCache, m_LogicalDevice, _pipelineCache);
 
     if (_swapChain) {
@@ -227,6 +235,7 @@ void VulkanRender::destroyInternal()
     }
     // m_renderPass.cleanup();
 
+    _asyncCommandPool->cleanup();
     _graphicsCommandPool->cleanup();
     if (_presentCommandPool) {
         _presentCommandPool->cleanup();
@@ -879,6 +888,7 @@ bool VulkanRender::createLogicDevice(uint32_t graphicsQueueCount, uint32_t prese
                                                  supportedFeatures.multiDrawIndirect &&
                                                  supportedFeatures.drawIndirectFirstInstance;
         _capabilities.dynamicRendering         = dynamicRenderingFeatures.dynamicRendering == VK_TRUE;
+        _capabilities.shaderDrawParameters     = vulkan11Features.shaderDrawParameters == VK_TRUE;
         bSupportsExtendedDynamicState          = (candidate.properties.apiVersion >= VK_API_VERSION_1_3) ||
                                                  (bHasExtendedDynamicState && supportedExtendedDynamicStateFeatures.extendedDynamicState == VK_TRUE);
         _capabilities.dynamicCullMode          = bSupportsExtendedDynamicState;
@@ -958,26 +968,74 @@ bool VulkanRender::createCommandPool()
 
     // _presentCommandPool  = std::move(VulkanCommandPool(this, _presentQueueFamily.queueFamilyIndex, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
 
-    return _graphicsCommandPool->_handle != VK_NULL_HANDLE;
+    _asyncCommandPool = std::make_unique<VulkanCommandPool>(
+        this,
+        &getGraphicsQueues()[0],
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+
+    return _graphicsCommandPool->_handle != VK_NULL_HANDLE && _asyncCommandPool->_handle != VK_NULL_HANDLE;
 }
 
 void VulkanRender::createPipelineCache()
 {
+    YA_PROFILE_FUNCTION_LOG();
+    const auto identity = VulkanPipelineCacheIdentity::fromProperties(_physicalDeviceProperties);
+    _pipelineCachePath  = vulkan_pipeline_cache::makeCachePath(PIPELINE_CACHE_DIRECTORY, identity);
+
+    // Not EXTERNALLY_SYNCHRONIZED: PipelinePrecompiler creates pipelines from
+    // JobSystem workers against this cache.
+    const auto                initialData = vulkan_pipeline_cache::loadBlob(_pipelineCachePath, identity);
     VkPipelineCacheCreateInfo ci{
         .sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
         .pNext           = nullptr,
         .flags           = 0,
-        .initialDataSize = 0,
-        .pInitialData    = nullptr,
-
+        .initialDataSize = initialData.size(),
+        .pInitialData    = initialData.empty() ? nullptr : initialData.data(),
     };
 
-    vkCreatePipelineCache(getDevice(), &ci, nullptr, &_pipelineCache);
+    VkResult result = vkCreatePipelineCache(getDevice(), &ci, nullptr, &_pipelineCache);
+    if (result != VK_SUCCESS && !initialData.empty()) {
+        YA_CORE_WARN("Pipeline cache {} rejected by the driver ({}), starting empty", _pipelineCachePath.generic_string(), static_cast<int32_t>(result));
+        ci.initialDataSize = 0;
+        ci.pInitialData    = nullptr;
+        result             = vkCreatePipelineCache(getDevice(), &ci, nullptr, &_pipelineCache);
+    }
+    if (result == VK_SUCCESS) {
+        YA_CORE_INFO("Pipeline cache {}: {} ({} bytes)",
+                     _pipelineCachePath.generic_string(),
+                     initialData.empty() ? "cold" : "warm",
+                     initialData.size());
+    }
 
     // Initialize descriptor helper (using new since we use raw pointer)
     _descriptorHelper = new VulkanDescriptorHelper(this);
 }
 
+bool VulkanRender::savePipelineCache()
+{
+    if (_pipelineCache == VK_NULL_HANDLE || _pipelineCachePath.empty()) {
+        return false;
+    }
+
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(getDevice(), _pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+        return false;
+    }
+    std::vector<uint8_t> data(dataSize);
+    // VK_INCOMPLETE would leave a truncated blob; only save complete data.
+    if (vkGetPipelineCacheData(getDevice(), _pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+        return false;
+    }
+    data.resize(dataSize);
+
+    const auto identity = VulkanPipelineCacheIdentity::fromProperties(_physicalDeviceProperties);
+    if (!vulkan_pipeline_cache::saveBlob(_pipelineCachePath, identity, data)) {
+        YA_CORE_WARN("Failed to save pipeline cache {}", _pipelineCachePath.generic_string());
+        return false;
+    }
+    return true;
+}
+
 IDescriptorSetHelper* VulkanRender::getDescriptorHelper()
 {
     return _descriptorHelper;
@@ -1199,6 +1257,183 @@ void VulkanRender::releaseSyncResources()
     }
 }
 
+ICommandBuffer* VulkanRender::beginAsyncCommands(const std::string& context)
+{
+    VkCommandBuffer vkCmdBuf = VK_NULL_HANDLE;
+    {
+        std::lock_guard lock(_asyncMutex);
+        if (!_finishedAsyncCmdBufs.empty()) {
+            vkFreeCommandBuffers(m_LogicalDevice,
+                                 _asyncCommandPool->_handle,
+                                 static_cast<uint32_t>(_finishedAsyncCmdBufs.size()),
+                                 _finishedAsyncCmdBufs.data());
+            _finishedAsyncCmdBufs.clear();
+        }
+        _asyncCommandPool->allocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, vkCmdBuf);
+    }
+    setDebugObjectName(VK_OBJECT_TYPE_COMMAND_BUFFER, vkCmdBuf, "AsyncCommandBuffer_" + context);
+    VulkanCommandPool::begin(vkCmdBuf, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    // Deleted in submitAsyncCommands; the VkCommandBuffer lives until its fence.
+    return new VulkanCommandBuffer(this, vkCmdBuf);
+}
+
+uint64_t VulkanRender::submitAsyncCommands(ICommandBuffer* commandBuffer)
+{
+    auto vkCmdBuf = commandBuffer->getHandleAs<VkCommandBuffer>();
+    delete commandBuffer;
+    VulkanCommandPool::end(vkCmdBuf);
+
+    std::lock_guard lock(_asyncMutex);
+    VkFence         fence = VK_NULL_HANDLE;
+    if (!_freeAsyncFences.empty()) {
+        fence = _freeAsyncFences.back();
+        _freeAsyncFences.pop_back();
+        VK_CALL(vkResetFences(m_LogicalDevice, 1, &fence));
+    }
+    else {
+        const VkFenceCreateInfo fenceCI{
+            .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+        };
+        VK_CALL(vkCreateFence(m_LogicalDevice, &fenceCI, getAllocator(), &fence));
+    }
+
+    {
+        std::lock_guard queueLock(_graphicsQueueMutex);
+        queueBeginLabel("AsyncSubmit");
+        _graphicsQueues[0].submit({vkCmdBuf}, {}, {}, fence);
+        queueEndLabel();
+    }
+
+    _asyncSubmissions.push_back({
+        .cmdBuf = vkCmdBuf,
+        .fence  = fence,
+        .value  = ++_asyncSubmittedValue,
+    });
+    return _asyncSubmittedValue;
+}
+
+uint64_t VulkanRender::pollAsyncCommands()
+{
+    std::lock_guard lock(_asyncMutex);
+    return pollAsyncCommandsLocked();
+}
+
+uint64_t VulkanRender::pollAsyncCommandsLocked()
+{
+    while (!_asyncSubmissions.empty()) {
+        auto& submission = _asyncSubmissions.front();
+        if (vkGetFenceStatus(m_LogicalDevice, submission.fence) != VK_SUCCESS) {
+            break;
+        }
+        // Another thread may be recording from _asyncCommandPool right now.
+        _finishedAsyncCmdBufs.push_back(submission.cmdBuf);
+        _freeAsyncFences.push_back(submission.fence);
+        _asyncCompletedValue = submission.value;
+        _asyncSubmissions.pop_front();
+    }
+    return _asyncCompletedValue;
+}
+
+void VulkanRender::waitAsyncCommands(uint64_t value)
+{
+    // Held across the wait so the fence cannot be recycled underneath it.
+    std::lock_guard lock(_asyncMutex);
+    for (const auto& submission : _asyncSubmissions) {
+        if (submission.value >= value) {
+            VK_CALL(vkWaitForFences(m_LogicalDevice, 1, &submission.fence, VK_TRUE, UINT64_MAX));
+            break;
+        }
+    }
+    pollAsyncCommandsLocked();
+}
+
+void VulkanRender::releaseAsyncCommandResources()
+{
+    // Called after vkDeviceWaitIdle: every submission has finished.
+    std::lock_guard lock(_asyncMutex);
+    pollAsyncCommandsLocked();
+    for (const auto& submission : _asyncSubmissions) {
+        _finishedAsyncCmdBufs.push_back(submission.cmdBuf);
+        vkDestroyFence(m_LogicalDevice, submission.fence, getAllocator());
+    }
+    _asyncSubmissions.clear();
+    if (!_finishedAsyncCmdBufs.empty()) {
+        vkFreeCommandBuffers(m_LogicalDevice,
+                             _asyncCommandPool->_handle,
+                             static_cast<uint32_t>(_finishedAsyncCmdBufs.size()),
+                             _finishedAsyncCmdBufs.data());
+        _finishedAsyncCmdBufs.clear();
+    }
+    for (VkFence fence : _freeAsyncFences) {
+        vkDestroyFence(m_LogicalDevice, fence, getAllocator());
+    }
+    _freeAsyncFences.clear();
+}
+
+ICommandBuffer* VulkanRender::beginSecondaryCommands()
+{
+    SecondaryCommandSlot* slot = nullptr;
+    {
+        // Only the slot lookup is shared; each slot is used by its own thread.
+        std::lock_guard lock(_secondarySlotsMutex);
+        const size_t index = _secondarySlotIndices.try_emplace(std::this_thread::get_id(), _secondarySlotIndices.size()).first->second;
+        auto&        slots = _secondarySlots[currentFrameIdx];
+        while (slots.size() <= index) {
+            auto newSlot  = std::make_unique<SecondaryCommandSlot>();
+            newSlot->pool = std::make_unique<VulkanCommandPool>(this, &getGraphicsQueues()[0], VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+            slots.push_back(std::move(newSlot));
+        }
+        slot = slots[index].get();
+    }
+
+    if (slot->used == slot->buffers.size()) {
+        VkCommandBuffer vkCmdBuf = VK_NULL_HANDLE;
+        if (!slot->pool->allocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_SECONDARY, vkCmdBuf)) {
+            return nullptr;
+        }
+        slot->buffers.push_back(std::make_unique<VulkanCommandBuffer>(this, vkCmdBuf));
+    }
+    auto* cmdBuf = slot->buffers[slot->used].get();
+    if (!cmdBuf->beginSecondary()) {
+        YA_CORE_ERROR("Failed to begin secondary command buffer");
+        return nullptr;
+    }
+    ++slot->used;
+    return cmdBuf;
+}
+
+void VulkanRender::resetSecondaryCommandPools(uint32_t flightIndex)
+{
+    // The frame fence signalled: every secondary of this flight has executed.
+    std::lock_guard lock(_secondarySlotsMutex);
+    for (auto& slot : _secondarySlots[flightIndex]) {
+        if (slot->used == 0) {
+            continue;
+        }
+        VK_CALL(vkResetCommandPool(m_LogicalDevice, slot->pool->_handle, 0));
+        for (size_t i = 0; i < slot->used; ++i) {
+            slot->buffers[i]->clearRetainedResources();
+        }
+        slot->used = 0;
+    }
+}
+
+void VulkanRender::releaseSecondaryCommandPools()
+{
+    // Called after vkDeviceWaitIdle; destroying a pool frees its buffers.
+    std::lock_guard lock(_secondarySlotsMutex);
+    for (auto& slots : _secondarySlots) {
+        for (auto& slot : slots) {
+            slot->buffers.clear();
+            slot->pool->cleanup();
+        }
+        slots.clear();
+    }
+    _secondarySlotIndices.clear();
+}
+
 void VulkanRender::createFrameGpuTimingResources()
 {
     _lastCompletedFrameGpuTimeMs = 0.0f;
@@ -1329,6 +1564,7 @@ bool VulkanRender::begin(int32_t* outImageIndex)
     }
 
     updateCompletedFrameGpuTiming();
+    resetSecondaryCommandPools(currentFrameIdx);
 
     // 重置fence为未信号状态，准备给GPU在本帧结束时发送信号
     {
@@ -1340,6 +1576,9 @@ bool VulkanRender::begin(int32_t* outImageIndex)
     // any GPU resources that were deferred-deleted during that frame.
     ++_frameIndex;
     DeferredDeletionQueue::get().flush(_frameIndex);
+    if (_uploadQueue) {
+        _uploadQueue->retire();
+    }
 
     auto vkSwapChain = this->getSwapchain<VulkanSwapChain>();
 
@@ -1486,6 +1725,12 @@ void VulkanRender::submitToQueue(
     const std::vector<void*>& signalSemaphores,
     void*                     fence)
 {
+    // Queued uploads go first on the same queue; their trailing barriers
+    // order them before anything this submission reads.
+    if (_uploadQueue) {
+        _uploadQueue->flush();
+    }
+
     std::vector<VkSemaphore> vkWaitSemaphores;
     std::vector<VkSemaphore> vkSignalSemaphores;
 
@@ -1499,6 +1744,7 @@ void VulkanRender::submitToQueue(
         vkSignalSemaphores.push_back(static_cast<VkSemaphore>(sem));
     }
 
+    std::lock_guard lock(_graphicsQueueMutex);
     queueBeginLabel("GraphicsSubmit");
     _graphicsQueues[0].submit(
         cmdBufs.data(),
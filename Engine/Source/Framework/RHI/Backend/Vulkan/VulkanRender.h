@@ -9,10 +9,18 @@
 
 #include <vulkan/vulkan.h>
 
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 
 
 #include "RHI/Core/Swapchain.h"
 #include "RHI/Core/BuiltinTextureSource.h"
+#include "RHI/Core/GpuUploadQueue.h"
 #include "RHI/Render.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanDescriptorSet.h"
@@ -135,7 +143,14 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
     // owning to logical device
     std::unique_ptr<VulkanCommandPool> _graphicsCommandPool = nullptr;
     std::unique_ptr<VulkanCommandPool> _presentCommandPool  = nullptr;
+    // Upload batches may be recorded off the main thread; they get their own
+    // pool so recording never touches _graphicsCommandPool.
+    std::unique_ptr<VulkanCommandPool> _asyncCommandPool    = nullptr;
+    // vkQueueSubmit / vkQueuePresentKHR need the VkQueue externally
+    // synchronized, and upload flushes can submit from worker threads.
+    std::mutex                         _graphicsQueueMutex;
     VkPipelineCache                    _pipelineCache       = VK_NULL_HANDLE;
+    std::filesystem::path              _pipelineCachePath;
     VkDescriptorPool                   _descriptorPool      = VK_NULL_HANDLE;
 
     VkSemaphore m_imageAvailableSemaphore;
@@ -161,6 +176,25 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
     std::vector<std::string> _disabledGraphicsCards;
     // Backend-owned frame counter used for deferred deletion pacing.
     uint64_t _frameIndex = 0;
+
+    // Async commands (GpuUploadQueue batches): one fence per submission,
+    // completed in submission order on the graphics queue. _asyncMutex guards
+    // the bookkeeping below; command buffers of finished submissions are freed
+    // by the next beginAsyncCommands(), the only place (besides recording,
+    // which GpuUploadQueue serializes) that touches _asyncCommandPool.
+    struct AsyncCommandSubmission
+    {
+        VkCommandBuffer cmdBuf = VK_NULL_HANDLE;
+        VkFence         fence  = VK_NULL_HANDLE;
+        uint64_t        value  = 0;
+    };
+    std::deque<AsyncCommandSubmission> _asyncSubmissions;
+    std::vector<VkFence>               _freeAsyncFences;
+    std::vector<VkCommandBuffer>       _finishedAsyncCmdBufs;
+    std::mutex                         _asyncMutex;
+    uint64_t                           _asyncSubmittedValue = 0;
+    uint64_t                           _asyncCompletedValue = 0;
+    std::unique_ptr<GpuUploadQueue>    _uploadQueue         = nullptr;
     // Every sampler created through this render's factory, kept alive until
     // device teardown so handles are released before the device dies (some
     // owners may outlive the device via static destruction).
@@ -178,6 +212,21 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
     bool                      _bFrameGpuTimingSupported    = false;
     std::vector<uint8_t>      _frameGpuTimingValid;
 
+    // Secondary command buffers (IRender::beginSecondaryCommands) for render
+    // graph passes recorded on workers. Command pools are externally
+    // synchronized, so each recording thread gets one pool per in-flight
+    // frame; begin() resets them once the frame fence signalled and the
+    // wrappers are handed out again.
+    struct SecondaryCommandSlot
+    {
+        std::unique_ptr<VulkanCommandPool>                pool;
+        std::vector<std::unique_ptr<VulkanCommandBuffer>> buffers;
+        size_t                                            used = 0;
+    };
+    std::array<std::vector<std::unique_ptr<SecondaryCommandSlot>>, flightFrameSize> _secondarySlots;
+    std::unordered_map<std::thread::id, size_t>                                     _secondarySlotIndices;
+    std::mutex                                                                      _secondarySlotsMutex;
+
 
   public:
     INativeWindow*                       _nativeWindow = nullptr;
@@ -208,6 +257,7 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
         YA_CORE_ASSERT(success, "Failed to initialize Vulkan render!");
 
         _resourceFactory = std::make_unique<VulkanRenderResourceFactory>(this);
+        _uploadQueue     = std::make_unique<GpuUploadQueue>(*this, *_resourceFactory);
 
         return true;
     }
@@ -375,6 +425,9 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
     [[nodiscard]] T* getSwapchain() const { return static_cast<T*>(_swapChain); }
 
     [[nodiscard]] VkPipelineCache getPipelineCache() const { return _pipelineCache; }
+    /// Write the pipeline cache to Engine/Intermediate/PipelineCache. Done on
+    /// shutdown; call after a precompile batch to survive a crash as well.
+    bool savePipelineCache();
 
     [[nodiscard]] bool                      isGraphicsPresentSameQueueFamily() const { return _graphicsQueueFamily.queueFamilyIndex == _presentQueueFamily.queueFamilyIndex; }
     [[nodiscard]] const QueueFamilyIndices& getGraphicsQueueFamilyInfo() const { return _graphicsQueueFamily; }
@@ -402,6 +455,8 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
     [[nodiscard]] int32_t getMemoryIndex(VkMemoryPropertyFlags properties, uint32_t memoryTypeBits) const;
 
     std::unique_ptr<VulkanCommandPool>::pointer getGraphicsCommandPool() const { return _graphicsCommandPool.get(); }
+    /// Held around every submission to or present on the graphics queue.
+    std::mutex&                                 getGraphicsQueueMutex() { return _graphicsQueueMutex; }
     const ::VkAllocationCallbacks*              getAllocator();
 
 
@@ -410,6 +465,11 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
     // IRender interface: isolated commands
     ICommandBuffer* beginIsolateCommands(const std::string& context = "") override
     {
+        // Isolated work may read resources whose uploads are still queued.
+        if (_uploadQueue) {
+            _uploadQueue->flush();
+        }
+
         VkCommandBuffer vkCmdBuf = VK_NULL_HANDLE;
         _graphicsCommandPool->allocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY, vkCmdBuf);
         const std::string debugName = "IsolatedCommandBuffer_" + context;
@@ -430,14 +490,26 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
         auto vkCmdBuf = commandBuffer->getHandleAs<VkCommandBuffer>();
 
         VulkanCommandPool::end(vkCmdBuf);
-        getGraphicsQueues()[0].submit({vkCmdBuf});
-        getGraphicsQueues()[0].waitIdle();
+        {
+            std::lock_guard lock(_graphicsQueueMutex);
+            getGraphicsQueues()[0].submit({vkCmdBuf});
+            getGraphicsQueues()[0].waitIdle();
+        }
         vkFreeCommandBuffers(m_LogicalDevice, _graphicsCommandPool->_handle, 1, &vkCmdBuf);
 
         // Delete the wrapper
         delete commandBuffer;
     }
 
+    // IRender interface: async commands (see GpuUploadQueue)
+    ICommandBuffer* beginAsyncCommands(const std::string& context = "") override;
+    uint64_t        submitAsyncCommands(ICommandBuffer* commandBuffer) override;
+    uint64_t        pollAsyncCommands() override;
+    void            waitAsyncCommands(uint64_t value) override;
+    GpuUploadQueue* getUploadQueue() override { return _uploadQueue.get(); }
+
+    ICommandBuffer* beginSecondaryCommands() override;
+
     // IRender interface: get swapchain
     ISwapchain* getSwapchain() override { return _swapChain; }
 
@@ -493,6 +565,10 @@ struct YA_RHI_BACKEND_API VulkanRender : public IRender
 
     void createSyncResources(int32_t swapchainImageSize);
     void releaseSyncResources();
+    void releaseAsyncCommandResources();
+    void resetSecondaryCommandPools(uint32_t flightIndex);
+    void releaseSecondaryCommandPools();
+    uint64_t pollAsyncCommandsLocked();
     void createFrameGpuTimingResources();
     void releaseFrameGpuTimingResources();
     void updateCompletedFrameGpuTiming();
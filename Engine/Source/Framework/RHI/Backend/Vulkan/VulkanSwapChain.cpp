@@ -473,7 +473,12 @@ VkResult VulkanSwapChain::presentImage(uint32_t idx, std::vector<VkSemaphore> wa
         .pResults           = &result,
     };
 
-    VkResult ret = vkQueuePresentKHR(_render->getPresentQueues()[0].getHandle(), &presentInfo);
+    VkResult ret = VK_SUCCESS;
+    {
+        // The present queue is usually the graphics queue.
+        std::lock_guard lock(_render->getGraphicsQueueMutex());
+        ret = vkQueuePresentKHR(_render->getPresentQueues()[0].getHandle(), &presentInfo);
+    }
     if (ret != VK_SUCCESS) {
         if (ret == VK_SUBOPTIMAL_KHR || ret == VK_ERROR_OUT_OF_DATE_KHR) {
             YA_CORE_WARN("Swap chain is out of date or suboptimal {}: {}", idx, ret);
@@ -284,6 +284,19 @@ struct ICommandBuffer
         return false;
     }
 
+    /**
+     * @brief Execute an ended secondary command buffer from this one
+     *
+     * Called outside any rendering scope. Takes over the secondary's retained
+     * resources. Returns false when the backend has no secondary command
+     * buffers (see IRender::beginSecondaryCommands()).
+     */
+    virtual bool executeSecondary(ICommandBuffer& secondary)
+    {
+        (void)secondary;
+        return false;
+    }
+
     void retainResource(std::shared_ptr<void> resource)
     {
         if (resource) {
@@ -0,0 +1,420 @@
+#include "GpuUploadQueue.h"
+
+#include "Core/Log.h"
+#include "Core/Profiling/Instrumentor.h"
+#include "RHI/Core/Buffer.h"
+#include "RHI/Core/CommandBuffer.h"
+#include "RHI/Core/Image.h"
+#include "RHI/Core/RenderResourceFactory.h"
+#include "RHI/Render.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <limits>
+
+namespace ya
+{
+
+namespace
+{
+
+uint64_t alignUp(uint64_t value, uint64_t alignment)
+{
+    const uint64_t remainder = value % alignment;
+    return remainder == 0 ? value : value + (alignment - remainder);
+}
+
+/// Every stage a copied buffer may be consumed in: vertex/index fetch,
+/// indirect arguments, shader reads and further transfers.
+constexpr auto kBufferConsumerAccess = static_cast<EResourceAccess::T>(
+    EResourceAccess::VertexAttributeRead | EResourceAccess::IndexRead | EResourceAccess::IndirectCommandRead |
+    EResourceAccess::ShaderRead | EResourceAccess::TransferRead);
+
+} // namespace
+
+GpuUploadQueue::GpuUploadQueue(IRender& render, IRenderResourceFactory& factory)
+    : GpuUploadQueue(render, factory, Config{})
+{
+}
+
+GpuUploadQueue::GpuUploadQueue(IRender& render, IRenderResourceFactory& factory, Config config)
+    : _render(render),
+      _factory(factory),
+      _config(config)
+{
+    YA_CORE_ASSERT(_config.alignment > 0, "GpuUploadQueue alignment must be non-zero");
+    // IBuffer offsets are 32-bit.
+    _config.ringBytes = std::min<uint64_t>(_config.ringBytes, std::numeric_limits<uint32_t>::max());
+}
+
+GpuUploadQueue::~GpuUploadQueue()
+{
+    // Destinations may die with the device right after us; make sure nothing
+    // still references them.
+    flush();
+    for (const auto& batch : _batches) {
+        _render.waitAsyncCommands(batch.submitValue);
+    }
+    retire();
+}
+
+GpuUploadTicket GpuUploadQueue::uploadBuffer(IBuffer* dst, uint64_t dstOffset, std::span<const std::byte> data, std::string label)
+{
+    if (!dst || data.empty()) {
+        YA_CORE_ERROR("GpuUploadQueue: invalid buffer upload '{}'", label);
+        return {};
+    }
+    if (dstOffset + data.size() > dst->getSize()) {
+        YA_CORE_ERROR("GpuUploadQueue: buffer upload '{}' of {} bytes at {} exceeds '{}' ({} bytes)",
+                      label,
+                      data.size(),
+                      dstOffset,
+                      dst->getName(),
+                      dst->getSize());
+        return {};
+    }
+
+    return enqueue(Pending{.dstBuffer = dst, .dstOffset = dstOffset, .label = std::move(label)}, data);
+}
+
+GpuUploadTicket GpuUploadQueue::uploadTexture(TextureUploadRequest request, std::span<const std::byte> data, uint32_t* outMipLevels)
+{
+    if (!request.image || !request.image->getHandle() || request.regions.empty() || data.empty()) {
+        YA_CORE_ERROR("GpuUploadQueue: invalid texture upload '{}'", request.label);
+        return {};
+    }
+
+    // Mirrors TextureUploadService::record(): generation succeeds for single
+    // level images and for formats the backend can blit.
+    uint32_t mipLevels = request.image->getMipLevels();
+    if (request.bGenerateMipmaps && mipLevels > 1 && !_render.supportsMipGeneration(request.image->getFormat())) {
+        mipLevels = 1;
+    }
+
+    request.staging.reset();
+    request.sourceData = {};
+    Pending pending{.texture = std::make_unique<TextureUploadRequest>(std::move(request))};
+    pending.label = pending.texture->label;
+
+    const GpuUploadTicket ticket = enqueue(std::move(pending), data);
+    if (ticket.valid() && outMipLevels) {
+        *outMipLevels = mipLevels;
+    }
+    return ticket;
+}
+
+bool GpuUploadQueue::forget(const IBuffer* dst, std::function<void()> release)
+{
+    std::lock_guard lock(_mutex);
+    for (auto& pending : _pending) {
+        if (pending.dstBuffer == dst) {
+            // Keep the entry so ring space still retires in order; it just
+            // records no copy.
+            pending.dstBuffer = nullptr;
+        }
+    }
+
+    // The newest batch copying into dst retires last; the older ones only
+    // drop the pointer so a buffer reusing the address is not matched.
+    Batch* lastWriter = nullptr;
+    for (auto& batch : _batches) {
+        if (auto it = std::ranges::find(batch.destinations, dst); it != batch.destinations.end()) {
+            batch.destinations.erase(it);
+            lastWriter = &batch;
+        }
+    }
+    if (!lastWriter) {
+        return false;
+    }
+    lastWriter->releases.push_back(std::move(release));
+    return true;
+}
+
+GpuUploadTicket GpuUploadQueue::enqueue(Pending pending, std::span<const std::byte> data)
+{
+    const bool bStaged = stage(pending, data);
+    if (!bStaged) {
+        if (pending.ringCharge == 0) {
+            return {};
+        }
+        // The ring reservation is already charged; keep an entry that records
+        // no copy so ring space still retires in order.
+        pending.dstBuffer = nullptr;
+        pending.texture.reset();
+    }
+
+    std::lock_guard lock(_mutex);
+    pending.serial = _nextSerial++;
+    const GpuUploadTicket ticket{pending.serial};
+    _pending.push_back(std::move(pending));
+    return bStaged ? ticket : GpuUploadTicket{};
+}
+
+bool GpuUploadQueue::stage(Pending& pending, std::span<const std::byte> data)
+{
+    pending.size = data.size();
+
+    // A single upload hogging most of the ring would serialize everything
+    // behind it; give it its own staging buffer instead.
+    if (data.size() > _config.ringBytes / 2) {
+        pending.staging = _factory.createBuffer(BufferCreateInfo{
+            .label       = std::format("GpuUploadQueue.Staging:{}", pending.label),
+            .usage       = EBufferUsage::TransferSrc,
+            .data        = const_cast<std::byte*>(data.data()),
+            .size        = static_cast<uint32_t>(data.size()),
+            .memoryUsage = EMemoryUsage::CpuToGpu,
+        });
+        if (!pending.staging) {
+            YA_CORE_ERROR("GpuUploadQueue: failed to create staging buffer for '{}' ({} bytes)", pending.label, data.size());
+            return false;
+        }
+        std::lock_guard lock(_mutex);
+        ++_stats.dedicatedUploads;
+        ++_stats.queuedUploads;
+        _stats.pendingBytes += data.size();
+        return true;
+    }
+
+    // Created on first use, under the lock: producers on several threads may
+    // reach this together.
+    std::shared_ptr<IBuffer> ring;
+    {
+        std::lock_guard lock(_mutex);
+        if (!_ring) {
+            _ring = _factory.createBuffer(BufferCreateInfo{
+                .label       = "GpuUploadQueue.Ring",
+                .usage       = EBufferUsage::TransferSrc,
+                .size        = static_cast<uint32_t>(_config.ringBytes),
+                .memoryUsage = EMemoryUsage::CpuToGpu,
+            });
+            if (!_ring) {
+                YA_CORE_ERROR("GpuUploadQueue: failed to create the {} byte staging ring", _config.ringBytes);
+                return false;
+            }
+        }
+        ring = _ring;
+    }
+
+    for (;;) {
+        {
+            std::lock_guard lock(_mutex);
+            if (tryAllocateRingLocked(pending)) {
+                ++_stats.queuedUploads;
+                _stats.pendingBytes += data.size();
+                break;
+            }
+        }
+
+        // Out of ring space: submit what is queued, then wait for the oldest
+        // batch so its bytes can be reused.
+        YA_PROFILE_SCOPE("GpuUploadQueue::stall");
+        flush();
+        uint64_t oldestValue = 0;
+        {
+            std::lock_guard lock(_mutex);
+            if (_batches.empty()) {
+                YA_CORE_ERROR("GpuUploadQueue: ring cannot hold '{}' ({} bytes)", pending.label, data.size());
+                return false;
+            }
+            oldestValue = _batches.front().submitValue;
+            ++_stats.stalls;
+        }
+        _render.waitAsyncCommands(oldestValue);
+        retire();
+    }
+
+    pending.staging = ring;
+    if (!ring->writeData(data.data(), static_cast<uint32_t>(data.size()), static_cast<uint32_t>(pending.stagingOffset))) {
+        YA_CORE_ERROR("GpuUploadQueue: failed to write '{}' into the staging ring", pending.label);
+        return false;
+    }
+    return true;
+}
+
+bool GpuUploadQueue::tryAllocateRingLocked(Pending& pending)
+{
+    const uint64_t capacity = _config.ringBytes;
+    const uint64_t size     = pending.size;
+    if (size == 0 || size > capacity) {
+        return false;
+    }
+
+    uint64_t offset = 0;
+    if (_ringUsed == 0) {
+        _ringHead = 0;
+        _ringTail = 0;
+    }
+    else if (_ringHead > _ringTail) {
+        // Live bytes are [tail, head): append, or wrap to the front.
+        offset = alignUp(_ringHead, _config.alignment);
+        if (offset + size > capacity) {
+            if (size > _ringTail) {
+                return false;
+            }
+            offset = 0;
+        }
+    }
+    else {
+        // Live bytes wrap: [tail, capacity) + [0, head), or the ring is full.
+        offset = alignUp(_ringHead, _config.alignment);
+        if (offset + size > _ringTail) {
+            return false;
+        }
+    }
+
+    const uint64_t end    = offset + size;
+    const uint64_t charge = offset >= _ringHead ? end - _ringHead : (capacity - _ringHead) + end;
+    _ringHead             = end;
+    _ringUsed += charge;
+
+    pending.stagingOffset = offset;
+    pending.ringEnd       = end;
+    pending.ringCharge    = charge;
+    return true;
+}
+
+void GpuUploadQueue::recordLocked(ICommandBuffer& cmdBuf, Pending& pending)
+{
+    if (pending.dstBuffer) {
+        cmdBuf.copyBuffer(pending.staging.get(), pending.dstBuffer, pending.size, pending.stagingOffset, pending.dstOffset);
+        cmdBuf.bufferMemoryBarrier(pending.dstBuffer,
+                                   EPipelineStage::Transfer,
+                                   EPipelineStage::AllCommands,
+                                   EResourceAccess::TransferWrite,
+                                   kBufferConsumerAccess,
+                                   pending.dstOffset,
+                                   pending.size);
+        return;
+    }
+
+    if (pending.texture) {
+        TextureUploadRequest& request = *pending.texture;
+        request.staging               = pending.staging;
+        for (auto& region : request.regions) {
+            region.bufferOffset += pending.stagingOffset;
+        }
+        TextureUploadService{}.record(cmdBuf, request);
+    }
+}
+
+bool GpuUploadQueue::flush()
+{
+    std::lock_guard lock(_mutex);
+    if (_pending.empty()) {
+        return false;
+    }
+    YA_PROFILE_SCOPE("GpuUploadQueue::flush");
+
+    ICommandBuffer* cmdBuf = _render.beginAsyncCommands("GpuUploadQueue");
+    if (!cmdBuf) {
+        YA_CORE_ERROR("GpuUploadQueue: failed to open a command buffer for {} pending uploads", _pending.size());
+        return false;
+    }
+
+    Batch    batch;
+    uint64_t batchBytes = 0;
+    for (auto& pending : _pending) {
+        recordLocked(*cmdBuf, pending);
+        if (pending.dstBuffer) {
+            batch.destinations.push_back(pending.dstBuffer);
+        }
+
+        batchBytes += pending.size;
+        batch.lastSerial = pending.serial;
+        if (pending.ringCharge > 0) {
+            batch.ringEnd = pending.ringEnd;
+            batch.ringBytes += pending.ringCharge;
+        }
+        if (pending.staging && pending.staging != _ring) {
+            batch.keepAlive.push_back(std::move(pending.staging));
+        }
+        if (pending.texture) {
+            batch.keepAlive.push_back(std::move(pending.texture->image));
+        }
+    }
+    batch.submitValue = _render.submitAsyncCommands(cmdBuf);
+
+    _stats.pendingBytes = 0;
+    _stats.inFlightBytes += batch.ringBytes;
+    _stats.submittedBytes += batchBytes;
+    _stats.lastBatchBytes   = batchBytes;
+    _stats.lastBatchUploads = static_cast<uint32_t>(_pending.size());
+    ++_stats.submittedBatches;
+
+    _pending.clear();
+    _batches.push_back(std::move(batch));
+    return true;
+}
+
+void GpuUploadQueue::retire()
+{
+    const uint64_t                     completedValue = _render.pollAsyncCommands();
+    std::vector<std::function<void()>> releases;
+    {
+        std::lock_guard lock(_mutex);
+        releases = retireLocked(completedValue);
+    }
+    for (auto& release : releases) {
+        release();
+    }
+}
+
+std::vector<std::function<void()>> GpuUploadQueue::retireLocked(uint64_t completedValue)
+{
+    std::vector<std::function<void()>> releases;
+    while (!_batches.empty() && _batches.front().submitValue <= completedValue) {
+        Batch& batch = _batches.front();
+        std::ranges::move(batch.releases, std::back_inserter(releases));
+        if (batch.ringBytes > 0) {
+            _ringTail = batch.ringEnd;
+            _ringUsed -= batch.ringBytes;
+            _stats.inFlightBytes -= batch.ringBytes;
+        }
+        _completedSerial = batch.lastSerial;
+        _batches.pop_front();
+    }
+    // Only pending (unsubmitted) reservations may remain; they start at tail.
+    if (_ringUsed == 0) {
+        _ringHead = 0;
+        _ringTail = 0;
+    }
+    return releases;
+}
+
+void GpuUploadQueue::wait(GpuUploadTicket ticket)
+{
+    if (isComplete(ticket)) {
+        return;
+    }
+    flush();
+
+    uint64_t waitValue = 0;
+    {
+        std::lock_guard lock(_mutex);
+        for (const auto& batch : _batches) {
+            if (batch.lastSerial >= ticket.serial) {
+                waitValue = batch.submitValue;
+                break;
+            }
+        }
+    }
+    if (waitValue != 0) {
+        _render.waitAsyncCommands(waitValue);
+    }
+    retire();
+}
+
+bool GpuUploadQueue::isComplete(GpuUploadTicket ticket) const
+{
+    std::lock_guard lock(_mutex);
+    return ticket.serial <= _completedSerial;
+}
+
+GpuUploadQueue::Stats GpuUploadQueue::getStats() const
+{
+    std::lock_guard lock(_mutex);
+    return _stats;
+}
+
+} // namespace ya
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "RHI/Core/TextureUploadService.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ya
+{
+
+struct IBuffer;
+struct IRender;
+struct IRenderResourceFactory;
+struct ICommandBuffer;
+
+/// Identifies one queued upload; complete once the GPU finished its batch.
+struct GpuUploadTicket
+{
+    uint64_t serial = 0;
+
+    [[nodiscard]] bool valid() const { return serial != 0; }
+};
+
+/**
+ * @brief Batched, asynchronous CPU-to-GPU uploads through a staging ring
+ *
+ * Source bytes are copied into a persistent host-visible ring buffer when the
+ * upload is queued; the copy commands are recorded later by flush(), which
+ * puts every pending buffer and texture upload into ONE command buffer and
+ * submits it with IRender::submitAsyncCommands(). Nothing waits on the queue:
+ * retire() polls the submitted value the backend reports as completed and
+ * releases ring space (and the destination references) of finished batches.
+ *
+ * The backend flushes before every graphics submission and before isolated
+ * commands, so a resource is populated before any later GPU work that reads
+ * it, without per-upload queue idles. Uploads larger than the ring get a
+ * dedicated staging buffer but still ride in the shared batch. When the ring
+ * is full, the oldest batches are waited on (counted in Stats::stalls).
+ *
+ * Uploads may be queued from any thread. Recording and submission happen
+ * under the queue's mutex, so the backend sees one async command buffer at a
+ * time.
+ */
+class YA_RHI_API GpuUploadQueue
+{
+  public:
+    struct Config
+    {
+        uint64_t ringBytes = 64ull << 20;
+        /// Staging offsets are aligned to this (covers every texel block size).
+        uint32_t alignment = 16;
+    };
+
+    struct Stats
+    {
+        uint64_t queuedUploads    = 0;
+        uint64_t submittedBatches = 0;
+        uint64_t submittedBytes   = 0;
+        uint64_t dedicatedUploads = 0; // Did not fit the ring
+        uint64_t stalls           = 0; // Waited on the GPU to free ring space
+        uint64_t pendingBytes     = 0; // Queued, not submitted yet
+        uint64_t inFlightBytes    = 0; // Ring bytes held by submitted batches
+        uint64_t lastBatchBytes   = 0;
+        uint32_t lastBatchUploads = 0;
+    };
+
+    GpuUploadQueue(IRender& render, IRenderResourceFactory& factory);
+    GpuUploadQueue(IRender& render, IRenderResourceFactory& factory, Config config);
+    ~GpuUploadQueue();
+
+    GpuUploadQueue(const GpuUploadQueue&)            = delete;
+    GpuUploadQueue& operator=(const GpuUploadQueue&) = delete;
+
+    /// Queue a copy of @p data into @p dst at @p dstOffset. The destination
+    /// must outlive the copy or be passed to forget() first.
+    GpuUploadTicket uploadBuffer(IBuffer* dst, uint64_t dstOffset, std::span<const std::byte> data, std::string label = {});
+
+    /**
+     * Queue a texture upload. @p data is the staging payload the request's
+     * regions index into (request.staging is ignored). The request records
+     * exactly what TextureUploadService::record() does; the returned mip count
+     * is predicted from IRender::supportsMipGeneration().
+     */
+    GpuUploadTicket uploadTexture(TextureUploadRequest request, std::span<const std::byte> data, uint32_t* outMipLevels = nullptr);
+
+    /**
+     * Drop not-yet-submitted copies into @p dst (called when it is destroyed).
+     * If a submitted batch still writes into @p dst, @p release is kept until
+     * that batch retired and true is returned; otherwise the caller releases
+     * the destination's memory itself.
+     */
+    bool forget(const IBuffer* dst, std::function<void()> release);
+
+    /// Record and submit every pending upload as one batch. Returns false when
+    /// nothing was pending or the command buffer could not be opened.
+    bool flush();
+
+    /// Release ring space of batches the GPU has finished.
+    void retire();
+
+    /// Flush, then block until @p ticket completed.
+    void wait(GpuUploadTicket ticket);
+
+    [[nodiscard]] bool     isComplete(GpuUploadTicket ticket) const;
+    [[nodiscard]] Stats    getStats() const;
+    [[nodiscard]] uint64_t getRingCapacity() const { return _config.ringBytes; }
+
+  private:
+    struct Pending
+    {
+        uint64_t                 serial = 0;
+        std::shared_ptr<IBuffer> staging;          // Ring or dedicated
+        uint64_t                 stagingOffset = 0;
+        uint64_t                 size          = 0;
+        uint64_t                 ringEnd       = 0; // 0 for dedicated staging
+        uint64_t                 ringCharge    = 0; // Ring bytes incl. alignment/wrap padding
+        IBuffer*                 dstBuffer     = nullptr;
+        uint64_t                 dstOffset     = 0;
+        std::unique_ptr<TextureUploadRequest> texture;
+        std::string              label;
+    };
+
+    struct Batch
+    {
+        uint64_t submitValue = 0; // IRender async-commands value
+        uint64_t lastSerial  = 0;
+        uint64_t ringEnd     = 0; // Ring tail after this batch retires (0 = unchanged)
+        uint64_t ringBytes   = 0;
+        std::vector<std::shared_ptr<void>>    keepAlive;
+        std::vector<const IBuffer*>           destinations;
+        std::vector<std::function<void()>>    releases; // Destinations destroyed while in flight
+    };
+
+    IRender&                 _render;
+    IRenderResourceFactory&  _factory;
+    Config                   _config;
+    mutable std::mutex       _mutex;
+    std::shared_ptr<IBuffer> _ring;
+    uint64_t                 _ringHead = 0;
+    uint64_t                 _ringTail = 0;
+    uint64_t                 _ringUsed = 0;
+    uint64_t                 _nextSerial      = 1;
+    uint64_t                 _completedSerial = 0;
+    std::vector<Pending>     _pending;
+    std::deque<Batch>        _batches;
+    Stats                    _stats;
+
+    GpuUploadTicket enqueue(Pending pending, std::span<const std::byte> data);
+    /// Copy @p data into the ring (waiting on the GPU for space if needed) or
+    /// into a dedicated staging buffer.
+    bool stage(Pending& pending, std::span<const std::byte> data);
+    bool tryAllocateRingLocked(Pending& pending);
+    /// Pops finished batches; returns their deferred releases to run unlocked.
+    std::vector<std::function<void()>> retireLocked(uint64_t completedValue);
+    void recordLocked(ICommandBuffer& cmdBuf, Pending& pending);
+};
+
+} // namespace ya
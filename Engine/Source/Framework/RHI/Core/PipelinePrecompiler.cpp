@@ -0,0 +1,111 @@
+#include "RHI/Core/PipelinePrecompiler.h"
+
+#include "Core/Async/JobSystem.h"
+#include "Core/Log.h"
+#include "Core/Profiling/Instrumentor.h"
+
+#include <chrono>
+#include <exception>
+
+namespace ya
+{
+
+PipelinePrecompiler::~PipelinePrecompiler()
+{
+    if (_worker.joinable()) {
+        _worker.join();
+    }
+}
+
+void PipelinePrecompiler::add(std::string label, std::function<bool()> build)
+{
+    YA_CORE_ASSERT(!_worker.joinable(), "PipelinePrecompiler: add() while an async build is running");
+    _items.push_back(Item{.label = std::move(label), .build = std::move(build)});
+}
+
+void PipelinePrecompiler::add(std::shared_ptr<IGraphicsPipeline> pipeline, GraphicsPipelineCreateInfo ci)
+{
+    auto label = ci.shaderDesc.cacheKey();
+    add(std::move(label), [pipeline = std::move(pipeline), ci = std::move(ci)]() {
+        return pipeline && pipeline->recreate(ci);
+    });
+}
+
+void PipelinePrecompiler::add(std::shared_ptr<IComputePipeline> pipeline, ComputePipelineCreateInfo ci)
+{
+    auto label = ci.shaderDesc.cacheKey();
+    add(std::move(label), [pipeline = std::move(pipeline), ci = std::move(ci)]() {
+        return pipeline && pipeline->recreate(ci);
+    });
+}
+
+PipelinePrecompileReport PipelinePrecompiler::build()
+{
+    YA_PROFILE_SCOPE_LOG("PipelinePrecompiler::build");
+    const auto begin = std::chrono::steady_clock::now();
+
+    auto items = std::move(_items);
+    _items.clear();
+
+    // Not vector<bool>: workers write neighbouring entries concurrently.
+    std::vector<uint8_t> results(items.size(), 0);
+    auto                 buildOne = [&](uint32_t index) {
+        try {
+            results[index] = items[index].build() ? 1 : 0;
+        }
+        catch (const std::exception& e) {
+            YA_CORE_ERROR("PipelinePrecompiler: {} threw: {}", items[index].label, e.what());
+        }
+    };
+
+    auto& jobSystem = JobSystem::get();
+    if (!jobSystem.isRunning() || items.size() < 2) {
+        for (uint32_t i = 0; i < items.size(); ++i) {
+            buildOne(i);
+        }
+    }
+    else {
+        // One pipeline per job: driver compile times vary widely.
+        jobSystem.parallelFor(static_cast<uint32_t>(items.size()), 1, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                buildOne(i);
+            }
+        }, EJobPriority::Background);
+    }
+
+    PipelinePrecompileReport report;
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (results[i]) {
+            ++report.built;
+        }
+        else {
+            ++report.failed;
+            report.failedLabels.push_back(items[i].label);
+            YA_CORE_ERROR("PipelinePrecompiler: failed to build {}", items[i].label);
+        }
+    }
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    YA_CORE_INFO("PipelinePrecompiler: {} built, {} failed in {:.1f} ms", report.built, report.failed, report.seconds * 1000.0);
+    return report;
+}
+
+void PipelinePrecompiler::buildAsync()
+{
+    YA_CORE_ASSERT(!_worker.joinable(), "PipelinePrecompiler: async build already running");
+    _bDone.store(false, std::memory_order_relaxed);
+    _worker = std::thread([this]() {
+        _asyncReport = build();
+        _bDone.store(true, std::memory_order_release);
+    });
+}
+
+PipelinePrecompileReport PipelinePrecompiler::wait()
+{
+    if (!_worker.joinable()) {
+        return {};
+    }
+    _worker.join();
+    return std::move(_asyncReport);
+}
+
+} // namespace ya
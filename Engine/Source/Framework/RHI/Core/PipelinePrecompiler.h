@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "RHI/Core/Pipeline.h"
+#include "RHI/RenderDefines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ya
+{
+
+struct PipelinePrecompileReport
+{
+    uint32_t                 built   = 0;
+    uint32_t                 failed  = 0;
+    double                   seconds = 0.0;
+    std::vector<std::string> failedLabels;
+
+    [[nodiscard]] bool succeeded() const { return failed == 0; }
+};
+
+/**
+ * @brief Builds a batch of pipelines on JobSystem workers
+ *
+ * Stages and level loaders queue every pipeline permutation they know they
+ * will bind, then build them together instead of one after another on the
+ * main thread (or, worse, lazily on first draw). Pipeline creation goes
+ * through the backend's pipeline cache, which the Vulkan backend keeps on
+ * disk, so warm starts mostly hit the driver cache.
+ *
+ * A queued pipeline object must not be bound or recreated elsewhere until
+ * build() returns or wait() / isReady() reports the batch done.
+ */
+class YA_RHI_API PipelinePrecompiler
+{
+  public:
+    PipelinePrecompiler() = default;
+    ~PipelinePrecompiler();
+
+    PipelinePrecompiler(const PipelinePrecompiler&)            = delete;
+    PipelinePrecompiler& operator=(const PipelinePrecompiler&) = delete;
+
+    /// Generic entry: @p build creates the pipeline and returns success.
+    void add(std::string label, std::function<bool()> build);
+    void add(std::shared_ptr<IGraphicsPipeline> pipeline, GraphicsPipelineCreateInfo ci);
+    void add(std::shared_ptr<IComputePipeline> pipeline, ComputePipelineCreateInfo ci);
+
+    [[nodiscard]] size_t size() const { return _items.size(); }
+
+    /// Build every queued pipeline, spread over JobSystem workers when it is
+    /// running (serially otherwise), and clear the queue.
+    PipelinePrecompileReport build();
+
+    /// Run build() on a background thread, e.g. behind a level-load screen.
+    void                     buildAsync();
+    [[nodiscard]] bool       isReady() const { return !_worker.joinable() || _bDone.load(std::memory_order_acquire); }
+    /// Join the background build and return its report.
+    PipelinePrecompileReport wait();
+
+  private:
+    struct Item
+    {
+        std::string           label;
+        std::function<bool()> build;
+    };
+
+    std::vector<Item>        _items;
+    std::thread              _worker;
+    std::atomic<bool>        _bDone{false};
+    PipelinePrecompileReport _asyncReport;
+};
+
+} // namespace ya
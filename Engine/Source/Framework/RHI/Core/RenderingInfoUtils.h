@@ -58,6 +58,48 @@ inline RenderAttachment makeRenderAttachment(
     return attachment;
 }
 
+/**
+ * @brief Attachment layout transitions of beginRendering() or endRendering()
+ *
+ * Calls @p fn(image, layout, range) for each attachment moved to its initial
+ * layout (@p bEnd false) or its final layout (@p bEnd true); range is null for
+ * the whole image. Backends skip these when bExternalTransitionManagement is
+ * set, leaving them to the caller.
+ */
+template <typename Fn>
+void forEachRenderingLayoutTransition(const RenderingInfo& info, bool bEnd, Fn&& fn)
+{
+    const auto visit = [&](const RenderAttachment& attachment, EImageLayout::T layout) {
+        if (attachment.image) {
+            ImageSubresourceRange range{};
+            const bool bHasRange = tryResolveRenderAttachmentSubresourceRange(attachment, range);
+            fn(attachment.image, layout, bHasRange ? &range : nullptr);
+        }
+    };
+
+    for (const auto& attachment : info.attachments.colors) {
+        const auto layout = bEnd ? attachment.finalLayout : attachment.initialLayout;
+        if (layout == EImageLayout::Undefined) {
+            continue;
+        }
+        visit(attachment, layout);
+        if (attachment.resolveImage) {
+            fn(attachment.resolveImage, layout, static_cast<const ImageSubresourceRange*>(nullptr));
+        }
+    }
+
+    if (info.attachments.depth) {
+        const auto& attachment = *info.attachments.depth;
+        auto        layout     = bEnd ? attachment.finalLayout : attachment.initialLayout;
+        if (!bEnd && layout == EImageLayout::Undefined) {
+            layout = EImageLayout::DepthStencilAttachmentOptimal;
+        }
+        if (layout != EImageLayout::Undefined) {
+            visit(attachment, layout);
+        }
+    }
+}
+
 inline bool renderAttachmentMatchesImageViewImage(const RenderAttachment& attachment)
 {
     return !attachment.image || !attachment.imageView || attachment.imageView->getImage() == attachment.image;
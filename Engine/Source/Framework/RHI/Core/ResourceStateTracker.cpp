@@ -2,7 +2,10 @@
 
 #include "RHI/Core/Image.h"
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
 
 namespace ya
 {
@@ -21,6 +24,12 @@ uint32_t defaultAspectMask(EFormat::T format)
     return EImageAspect::Color;
 }
 
+/// Index of @p aspect among the set bits of @p aspectMask.
+uint32_t aspectSlot(uint32_t aspectMask, uint32_t aspect)
+{
+    return static_cast<uint32_t>(std::popcount(aspectMask & (aspect - 1u)));
+}
+
 template <typename Fn>
 void forEachAspect(uint32_t aspectMask, Fn&& fn)
 {
@@ -53,71 +62,270 @@ ImageSubresourceRange ResourceStateTracker::normalizeRange(const IImage& image,
     return normalized;
 }
 
-ImageResourceState ResourceStateTracker::makeSeedState(const IImage& image, uint32_t aspect, uint32_t mip, uint32_t layer)
+ResourceStateTracker::ImageRecord& ResourceStateTracker::acquireRecord(const IImage& image, uint32_t aspectMask)
 {
-    ImageResourceState state;
-    state.layout = image.getCompatibilityLayout(aspect, mip, layer);
-    state.subresourceRange = ImageSubresourceRange{
-        .aspectMask     = aspect,
-        .baseMipLevel   = mip,
-        .levelCount     = 1,
-        .baseArrayLayer = layer,
-        .layerCount     = 1,
-    };
-    return state;
+    const auto [it, bInserted] = _images.try_emplace(&image);
+    auto& record = it->second;
+    if (bInserted) {
+        record.mipLevels   = image.getMipLevels();
+        record.arrayLayers = image.getArrayLayers();
+
+        // Most images seed one layout everywhere; only build rows when the
+        // compatibility layouts actually differ.
+        const uint32_t defaultMask = defaultAspectMask(image.getFormat());
+        const auto     firstLayout = image.getCompatibilityLayout(defaultMask & (~defaultMask + 1u), 0, 0);
+        bool           bUniform    = true;
+        forEachAspect(defaultMask, [&](uint32_t aspect) {
+            for (uint32_t mip = 0; bUniform && mip < record.mipLevels; ++mip) {
+                for (uint32_t layer = 0; bUniform && layer < record.arrayLayers; ++layer) {
+                    bUniform = image.getCompatibilityLayout(aspect, mip, layer) == firstLayout;
+                }
+            }
+        });
+
+        if (bUniform) {
+            record.aspectMask     = defaultMask;
+            record.uniform.layout = firstLayout;
+        }
+        else {
+            seedAspects(image, record, defaultMask);
+        }
+    }
+
+    if ((aspectMask & ~record.aspectMask) != 0) {
+        seedAspects(image, record, aspectMask & ~record.aspectMask);
+    }
+    return record;
 }
 
-ImageResourceState ResourceStateTracker::getState(const IImage& image, uint32_t aspect, uint32_t mip, uint32_t layer) const
+void ResourceStateTracker::seedAspects(const IImage& image, ImageRecord& record, uint32_t aspectMask)
 {
-    const auto it = _imageStates.find(ImageSubresourceKey{.image = &image, .aspect = aspect, .mip = mip, .layer = layer});
-    return it != _imageStates.end() ? it->second : makeSeedState(image, aspect, mip, layer);
+    split(record);
+    forEachAspect(aspectMask, [&](uint32_t aspect) {
+        record.aspectMask |= aspect;
+        const auto firstRow = record.rows.begin() + static_cast<std::ptrdiff_t>(aspectSlot(record.aspectMask, aspect) * record.mipLevels);
+        const auto rowIt    = record.rows.insert(firstRow, record.mipLevels, std::vector<LayerRun>{});
+        for (uint32_t mip = 0; mip < record.mipLevels; ++mip) {
+            seedRow(image, aspect, mip, record.arrayLayers, *(rowIt + mip));
+        }
+    });
+    tryCollapse(record);
 }
 
-void ResourceStateTracker::seedImage(const IImage& image)
+void ResourceStateTracker::seedRow(const IImage& image, uint32_t aspect, uint32_t mip, uint32_t arrayLayers, std::vector<LayerRun>& row)
 {
-    const auto probe = ImageSubresourceKey{
-        .image  = &image,
-        .aspect = defaultAspectMask(image.getFormat()) & (~defaultAspectMask(image.getFormat()) + 1u),
-        .mip    = 0,
-        .layer  = 0,
-    };
-    if (_imageStates.contains(probe)) {
+    row.clear();
+    for (uint32_t layer = 0; layer < arrayLayers; ++layer) {
+        const auto layout = image.getCompatibilityLayout(aspect, mip, layer);
+        if (!row.empty() && row.back().state.layout == layout) {
+            ++row.back().layerCount;
+        }
+        else {
+            row.push_back({.baseLayer = layer, .layerCount = 1, .state = TrackedState{.layout = layout}});
+        }
+    }
+}
+
+void ResourceStateTracker::split(ImageRecord& record)
+{
+    if (!record.bUniform) {
         return;
     }
-    forEachAspect(defaultAspectMask(image.getFormat()), [&](uint32_t aspect) {
-        for (uint32_t mip = 0; mip < image.getMipLevels(); ++mip) {
-            for (uint32_t layer = 0; layer < image.getArrayLayers(); ++layer) {
-                _imageStates[ImageSubresourceKey{.image = &image, .aspect = aspect, .mip = mip, .layer = layer}] =
-                    makeSeedState(image, aspect, mip, layer);
+    // Rows left over from the last collapse keep their capacity.
+    record.rows.resize(static_cast<size_t>(std::popcount(record.aspectMask)) * record.mipLevels);
+    for (auto& row : record.rows) {
+        row.assign(1, LayerRun{.baseLayer = 0, .layerCount = record.arrayLayers, .state = record.uniform});
+    }
+    record.bUniform = false;
+}
+
+void ResourceStateTracker::tryCollapse(ImageRecord& record)
+{
+    if (record.bUniform || record.rows.empty() || record.rows.front().size() != 1) {
+        return;
+    }
+    const auto& state = record.rows.front().front().state;
+    for (const auto& row : record.rows) {
+        if (row.size() != 1 || row.front().state != state) {
+            return;
+        }
+    }
+    record.uniform  = state;
+    record.bUniform = true;
+}
+
+void ResourceStateTracker::assignLayers(std::vector<LayerRun>& row, uint32_t baseLayer, uint32_t layerCount, const TrackedState& state)
+{
+    const uint32_t endLayer = baseLayer + layerCount;
+    const auto     first    = std::find_if(row.begin(), row.end(), [&](const LayerRun& run) {
+        return run.baseLayer + run.layerCount > baseLayer;
+    });
+    const auto last = std::find_if(first, row.end(), [&](const LayerRun& run) {
+        return run.baseLayer >= endLayer;
+    });
+
+    // Replace the overlapped runs with [head][assigned][tail], then coalesce.
+    std::array<LayerRun, 3> pieces{};
+    size_t                  pieceCount = 0;
+    if (first->baseLayer < baseLayer) {
+        pieces[pieceCount++] = {.baseLayer = first->baseLayer, .layerCount = baseLayer - first->baseLayer, .state = first->state};
+    }
+    pieces[pieceCount++] = {.baseLayer = baseLayer, .layerCount = layerCount, .state = state};
+    const auto& tail     = *(last - 1);
+    if (tail.baseLayer + tail.layerCount > endLayer) {
+        pieces[pieceCount++] = {.baseLayer = endLayer, .layerCount = tail.baseLayer + tail.layerCount - endLayer, .state = tail.state};
+    }
+    const auto at = row.erase(first, last);
+    row.insert(at, pieces.begin(), pieces.begin() + static_cast<std::ptrdiff_t>(pieceCount));
+
+    size_t out = 0;
+    for (size_t index = 1; index < row.size(); ++index) {
+        if (row[index].state == row[out].state) {
+            row[out].layerCount += row[index].layerCount;
+        }
+        else {
+            row[++out] = row[index];
+        }
+    }
+    row.resize(out + 1);
+}
+
+void ResourceStateTracker::assignState(ImageRecord& record, const ImageSubresourceRange& range, const TrackedState& state)
+{
+    const bool bWholeImage = (record.aspectMask & ~range.aspectMask) == 0 &&
+                             range.baseMipLevel == 0 && range.levelCount == record.mipLevels &&
+                             range.baseArrayLayer == 0 && range.layerCount == record.arrayLayers;
+    if (bWholeImage) {
+        record.bUniform = true;
+        record.uniform  = state;
+        return;
+    }
+    if (record.bUniform && record.uniform == state) {
+        return;
+    }
+
+    split(record);
+    forEachAspect(range.aspectMask, [&](uint32_t aspect) {
+        const size_t firstRow = static_cast<size_t>(aspectSlot(record.aspectMask, aspect)) * record.mipLevels;
+        for (uint32_t mip = range.baseMipLevel; mip < range.baseMipLevel + range.levelCount; ++mip) {
+            assignLayers(record.rows[firstRow + mip], range.baseArrayLayer, range.layerCount, state);
+        }
+    });
+    tryCollapse(record);
+}
+
+void ResourceStateTracker::collectSpans(const ImageRecord& record, const ImageSubresourceRange& range)
+{
+    auto& outSpans    = _spanScratch;
+    auto& pieces      = _rowPieces;
+    auto& previousRow = _previousRowSpans;
+    auto& currentRow  = _currentRowSpans;
+    outSpans.clear();
+    if (record.bUniform) {
+        outSpans.push_back({.range = range, .state = record.uniform});
+        return;
+    }
+
+    const auto mergeInto = [](TrackedState& into, const TrackedState& from) {
+        into.stages |= from.stages;
+        into.access |= from.access;
+    };
+
+    // Per row, coalesce runs that share a layout (a barrier only needs the
+    // layout to match; stages/access are unioned). Then extend a span from the
+    // previous mip when its layer range and layout repeat in this one.
+    const uint32_t endLayer = range.baseArrayLayer + range.layerCount;
+    forEachAspect(range.aspectMask, [&](uint32_t aspect) {
+        const size_t firstRow = static_cast<size_t>(aspectSlot(record.aspectMask, aspect)) * record.mipLevels;
+        previousRow.clear();
+        for (uint32_t mip = range.baseMipLevel; mip < range.baseMipLevel + range.levelCount; ++mip) {
+            pieces.clear();
+            for (const auto& run : record.rows[firstRow + mip]) {
+                const uint32_t runBegin = std::max(run.baseLayer, range.baseArrayLayer);
+                const uint32_t runEnd   = std::min(run.baseLayer + run.layerCount, endLayer);
+                if (runBegin >= runEnd) {
+                    continue;
+                }
+                if (!pieces.empty() && pieces.back().state.layout == run.state.layout) {
+                    pieces.back().range.layerCount += runEnd - runBegin;
+                    mergeInto(pieces.back().state, run.state);
+                    continue;
+                }
+                pieces.push_back({
+                    .range = ImageSubresourceRange{
+                        .aspectMask     = aspect,
+                        .baseMipLevel   = mip,
+                        .levelCount     = 1,
+                        .baseArrayLayer = runBegin,
+                        .layerCount     = runEnd - runBegin,
+                    },
+                    .state = run.state,
+                });
             }
+
+            currentRow.clear();
+            size_t cursor = 0;
+            for (const auto& piece : pieces) {
+                while (cursor < previousRow.size() &&
+                       outSpans[previousRow[cursor]].range.baseArrayLayer < piece.range.baseArrayLayer) {
+                    ++cursor;
+                }
+                if (cursor < previousRow.size()) {
+                    auto& span = outSpans[previousRow[cursor]];
+                    if (span.range.baseArrayLayer == piece.range.baseArrayLayer &&
+                        span.range.layerCount == piece.range.layerCount &&
+                        span.state.layout == piece.state.layout) {
+                        ++span.range.levelCount;
+                        mergeInto(span.state, piece.state);
+                        currentRow.push_back(previousRow[cursor]);
+                        continue;
+                    }
+                }
+                outSpans.push_back(piece);
+                currentRow.push_back(outSpans.size() - 1);
+            }
+            std::swap(previousRow, currentRow);
         }
     });
+
+    // Depth/stencil: one barrier covers both aspects when their boxes agree.
+    if (std::popcount(range.aspectMask) > 1) {
+        size_t out = 0;
+        for (size_t index = 0; index < outSpans.size(); ++index) {
+            const auto& span    = outSpans[index];
+            bool        bMerged = false;
+            for (size_t prior = 0; prior < out && !bMerged; ++prior) {
+                auto& candidate = outSpans[prior];
+                if ((candidate.range.aspectMask & span.range.aspectMask) == 0 &&
+                    candidate.range.baseMipLevel == span.range.baseMipLevel &&
+                    candidate.range.levelCount == span.range.levelCount &&
+                    candidate.range.baseArrayLayer == span.range.baseArrayLayer &&
+                    candidate.range.layerCount == span.range.layerCount &&
+                    candidate.state.layout == span.state.layout) {
+                    candidate.range.aspectMask |= span.range.aspectMask;
+                    mergeInto(candidate.state, span.state);
+                    bMerged = true;
+                }
+            }
+            if (!bMerged) {
+                outSpans[out++] = span;
+            }
+        }
+        outSpans.resize(out);
+    }
 }
 
 void ResourceStateTracker::reset()
 {
-    _imageStates.clear();
+    _images.clear();
 }
 
 void ResourceStateTracker::setState(IImage& image, const ImageResourceState& state, const ImageSubresourceRange* range)
 {
-    seedImage(image);
     const auto normalized = normalizeRange(image, range);
-    forEachAspect(normalized.aspectMask, [&](uint32_t aspect) {
-        for (uint32_t mip = normalized.baseMipLevel; mip < normalized.baseMipLevel + normalized.levelCount; ++mip) {
-            for (uint32_t layer = normalized.baseArrayLayer; layer < normalized.baseArrayLayer + normalized.layerCount; ++layer) {
-                auto trackedState = state;
-                trackedState.subresourceRange = ImageSubresourceRange{
-                    .aspectMask     = aspect,
-                    .baseMipLevel   = mip,
-                    .levelCount     = 1,
-                    .baseArrayLayer = layer,
-                    .layerCount     = 1,
-                };
-                _imageStates[ImageSubresourceKey{.image = &image, .aspect = aspect, .mip = mip, .layer = layer}] = trackedState;
-            }
-        }
-    });
+    assignState(acquireRecord(image, normalized.aspectMask),
+                normalized,
+                TrackedState{.stages = state.stages, .access = state.access, .layout = state.layout});
 }
 
 void ResourceStateTracker::setLayout(IImage& image, EImageLayout::T layout, const ImageSubresourceRange* range)
@@ -132,39 +340,20 @@ std::vector<ImageLayoutExpectationMismatch> ResourceStateTracker::validateLayout
     EImageLayout::T expectedLayout,
     const ImageSubresourceRange* range)
 {
-    seedImage(image);
     const auto normalized = normalizeRange(image, range);
-    std::vector<ImageLayoutExpectationMismatch> mismatches;
-
-    forEachAspect(normalized.aspectMask, [&](uint32_t aspect) {
-        for (uint32_t mip = normalized.baseMipLevel; mip < normalized.baseMipLevel + normalized.levelCount; ++mip) {
-            uint32_t layer = normalized.baseArrayLayer;
-            while (layer < normalized.baseArrayLayer + normalized.layerCount) {
-                const auto actualLayout = getState(image, aspect, mip, layer).layout;
-                const auto runStart     = layer;
-                while (layer < normalized.baseArrayLayer + normalized.layerCount &&
-                       getState(image, aspect, mip, layer).layout == actualLayout) {
-                    ++layer;
-                }
+    collectSpans(acquireRecord(image, normalized.aspectMask), normalized);
 
-                if (actualLayout != expectedLayout) {
-                    mismatches.push_back({
-                        .image          = &image,
-                        .expectedLayout = expectedLayout,
-                        .actualLayout   = actualLayout,
-                        .range = ImageSubresourceRange{
-                            .aspectMask     = aspect,
-                            .baseMipLevel   = mip,
-                            .levelCount     = 1,
-                            .baseArrayLayer = runStart,
-                            .layerCount     = layer - runStart,
-                        },
-                    });
-                }
-            }
+    std::vector<ImageLayoutExpectationMismatch> mismatches;
+    for (const auto& span : _spanScratch) {
+        if (span.state.layout != expectedLayout) {
+            mismatches.push_back({
+                .image          = &image,
+                .expectedLayout = expectedLayout,
+                .actualLayout   = span.state.layout,
+                .range          = span.range,
+            });
         }
-    });
-
+    }
     return mismatches;
 }
 
@@ -173,76 +362,53 @@ std::vector<ImageLayoutTransition> ResourceStateTracker::transition(
     const ImageResourceState& newState,
     const ImageSubresourceRange* range)
 {
-    seedImage(image);
     const auto normalized = normalizeRange(image, range);
+    auto&      record     = acquireRecord(image, normalized.aspectMask);
+    collectSpans(record, normalized);
+
+    const auto makeState = [](const TrackedState& state, const ImageSubresourceRange& stateRange) {
+        ImageResourceState result;
+        result.stages           = state.stages;
+        result.access           = state.access;
+        result.layout           = state.layout;
+        result.subresourceRange = stateRange;
+        return result;
+    };
+    const auto makeTransition = [&](const TrackedState& oldState, const ImageSubresourceRange& transitionRange) {
+        auto mergedState             = newState;
+        mergedState.subresourceRange = transitionRange;
+        return ImageLayoutTransition{
+            .image    = &image,
+            .oldState = makeState(oldState, transitionRange),
+            .newState = mergedState,
+            .range    = transitionRange,
+        };
+    };
+
     std::vector<ImageLayoutTransition> transitions;
-    auto newStateTemplate             = newState;
-    newStateTemplate.subresourceRange = normalized;
-
-    EImageLayout::T commonOldLayout  = EImageLayout::Undefined;
-    bool            bHasCommonLayout = true;
-    bool            bFirst           = true;
-    forEachAspect(normalized.aspectMask, [&](uint32_t aspect) {
-        for (uint32_t mip = normalized.baseMipLevel; mip < normalized.baseMipLevel + normalized.levelCount; ++mip) {
-            for (uint32_t layer = normalized.baseArrayLayer; layer < normalized.baseArrayLayer + normalized.layerCount; ++layer) {
-                const auto layout = getState(image, aspect, mip, layer).layout;
-                if (bFirst) {
-                    commonOldLayout = layout;
-                    bFirst          = false;
-                } else if (layout != commonOldLayout) {
-                    bHasCommonLayout = false;
-                }
-            }
-        }
+    const bool bHasCommonLayout = std::all_of(_spanScratch.begin(), _spanScratch.end(), [&](const StateSpan& span) {
+        return span.state.layout == _spanScratch.front().state.layout;
     });
-
     if (bHasCommonLayout) {
-        if (commonOldLayout != newState.layout) {
-            auto oldState = getState(
-                image,
-                normalized.aspectMask & (~normalized.aspectMask + 1u),
-                normalized.baseMipLevel,
-                normalized.baseArrayLayer);
-            auto mergedState             = newStateTemplate;
-            mergedState.subresourceRange = normalized;
-            transitions.push_back({.image = &image, .oldState = oldState, .newState = mergedState, .range = normalized});
+        // One barrier for the whole requested range, whatever its split.
+        if (_spanScratch.front().state.layout != newState.layout) {
+            TrackedState oldState = _spanScratch.front().state;
+            for (const auto& span : _spanScratch) {
+                oldState.stages |= span.state.stages;
+                oldState.access |= span.state.access;
+            }
+            transitions.push_back(makeTransition(oldState, normalized));
         }
-        setState(image, newStateTemplate, &normalized);
-        return transitions;
     }
-
-    forEachAspect(normalized.aspectMask, [&](uint32_t aspect) {
-        for (uint32_t mip = normalized.baseMipLevel; mip < normalized.baseMipLevel + normalized.levelCount; ++mip) {
-            uint32_t layer = normalized.baseArrayLayer;
-            while (layer < normalized.baseArrayLayer + normalized.layerCount) {
-                const auto oldState = getState(image, aspect, mip, layer);
-                const auto runStart = layer;
-                while (layer < normalized.baseArrayLayer + normalized.layerCount &&
-                       getState(image, aspect, mip, layer).layout == oldState.layout) {
-                    ++layer;
-                }
-                if (oldState.layout != newState.layout) {
-                    const auto transitionRange = ImageSubresourceRange{
-                        .aspectMask     = aspect,
-                        .baseMipLevel   = mip,
-                        .levelCount     = 1,
-                        .baseArrayLayer = runStart,
-                        .layerCount     = layer - runStart,
-                    };
-                    auto mergedState             = newStateTemplate;
-                    mergedState.subresourceRange = transitionRange;
-                    transitions.push_back({
-                        .image    = &image,
-                        .oldState = oldState,
-                        .newState = mergedState,
-                        .range    = transitionRange,
-                    });
-                }
+    else {
+        for (const auto& span : _spanScratch) {
+            if (span.state.layout != newState.layout) {
+                transitions.push_back(makeTransition(span.state, span.range));
             }
         }
-    });
+    }
 
-    setState(image, newStateTemplate, &normalized);
+    assignState(record, normalized, TrackedState{.stages = newState.stages, .access = newState.access, .layout = newState.layout});
     return transitions;
 }
 
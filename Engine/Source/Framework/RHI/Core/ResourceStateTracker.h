@@ -3,7 +3,6 @@
 #include "RHI/RenderDefines.h"
 #include "Core/Api.h"
 
-#include <functional>
 #include <unordered_map>
 #include <vector>
 
@@ -31,34 +30,66 @@ struct ImageLayoutExpectationMismatch
 class YA_RHI_API ResourceStateTracker
 {
   private:
-    struct ImageSubresourceKey
+    /// Layout plus the stages/access of the last operation on a set of subresources.
+    struct TrackedState
     {
-        const IImage* image  = nullptr;
-        uint32_t      aspect = 0;
-        uint32_t      mip    = 0;
-        uint32_t      layer  = 0;
+        EPipelineStage::T  stages = EPipelineStage::None;
+        EResourceAccess::T access = EResourceAccess::None;
+        EImageLayout::T    layout = EImageLayout::Undefined;
 
-        bool operator==(const ImageSubresourceKey&) const = default;
+        bool operator==(const TrackedState&) const = default;
     };
 
-    struct ImageSubresourceKeyHash
+    /// Layers [baseLayer, baseLayer + layerCount) of one aspect/mip sharing a state.
+    struct LayerRun
     {
-        size_t operator()(const ImageSubresourceKey& key) const
-        {
-            size_t seed = std::hash<const IImage*>{}(key.image);
-            seed ^= std::hash<uint32_t>{}(key.aspect) + 0x9e3779b9u + (seed << 6u) + (seed >> 2u);
-            seed ^= std::hash<uint32_t>{}(key.mip) + 0x9e3779b9u + (seed << 6u) + (seed >> 2u);
-            seed ^= std::hash<uint32_t>{}(key.layer) + 0x9e3779b9u + (seed << 6u) + (seed >> 2u);
-            return seed;
-        }
+        uint32_t     baseLayer  = 0;
+        uint32_t     layerCount = 0;
+        TrackedState state{};
     };
 
-    std::unordered_map<ImageSubresourceKey, ImageResourceState, ImageSubresourceKeyHash> _imageStates;
+    /**
+     * @brief Tracked state of one image
+     *
+     * While bUniform is set, `uniform` describes every subresource and `rows`
+     * is ignored, so whole-image transitions never touch per-subresource data.
+     * A partial write splits the record into one sorted, coalesced run list
+     * per (aspect, mip), indexed by aspectSlot * mipLevels + mip. It collapses
+     * back once every row holds the same single run again.
+     */
+    struct ImageRecord
+    {
+        uint32_t                           aspectMask  = 0;
+        uint32_t                           mipLevels   = 0;
+        uint32_t                           arrayLayers = 0;
+        bool                               bUniform    = true;
+        TrackedState                       uniform{};
+        std::vector<std::vector<LayerRun>> rows;
+    };
+
+    /// Maximal box of subresources sharing one layout, produced for queries.
+    struct StateSpan
+    {
+        ImageSubresourceRange range{};
+        TrackedState          state{};
+    };
+
+    std::unordered_map<const IImage*, ImageRecord> _images;
+    // Reused by collectSpans() so steady-state queries do not allocate.
+    std::vector<StateSpan>                         _spanScratch;
+    std::vector<StateSpan>                         _rowPieces;
+    std::vector<size_t>                            _previousRowSpans;
+    std::vector<size_t>                            _currentRowSpans;
 
     static ImageSubresourceRange normalizeRange(const IImage& image, const ImageSubresourceRange* range);
-    void seedImage(const IImage& image);
-    ImageResourceState getState(const IImage& image, uint32_t aspect, uint32_t mip, uint32_t layer) const;
-    static ImageResourceState makeSeedState(const IImage& image, uint32_t aspect, uint32_t mip, uint32_t layer);
+    ImageRecord& acquireRecord(const IImage& image, uint32_t aspectMask);
+    static void  seedAspects(const IImage& image, ImageRecord& record, uint32_t aspectMask);
+    static void  seedRow(const IImage& image, uint32_t aspect, uint32_t mip, uint32_t arrayLayers, std::vector<LayerRun>& row);
+    static void  split(ImageRecord& record);
+    static void  tryCollapse(ImageRecord& record);
+    static void  assignLayers(std::vector<LayerRun>& row, uint32_t baseLayer, uint32_t layerCount, const TrackedState& state);
+    static void  assignState(ImageRecord& record, const ImageSubresourceRange& range, const TrackedState& state);
+    void         collectSpans(const ImageRecord& record, const ImageSubresourceRange& range);
 
   public:
     void reset();
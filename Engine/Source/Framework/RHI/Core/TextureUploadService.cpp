@@ -3,7 +3,9 @@
 #include "Core/Log.h"
 #include "RHI/Core/Buffer.h"
 #include "RHI/Core/CommandBuffer.h"
+#include "RHI/Core/GpuUploadQueue.h"
 #include "RHI/Core/Image.h"
+#include "RHI/Core/RenderResourceFactory.h"
 #include "RHI/Render.h"
 
 #include <format>
@@ -17,8 +19,8 @@ bool TextureUploadService::upload(IRender& render, const TextureUploadRequest& r
         YA_CORE_ERROR("TextureUploadService: upload for '{}' has no valid image", request.label);
         return false;
     }
-    if (!request.staging) {
-        YA_CORE_ERROR("TextureUploadService: upload for '{}' has no staging buffer", request.label);
+    if (!request.staging && request.sourceData.empty()) {
+        YA_CORE_ERROR("TextureUploadService: upload for '{}' has no staging buffer or source data", request.label);
         return false;
     }
     if (request.regions.empty()) {
@@ -26,6 +28,28 @@ bool TextureUploadService::upload(IRender& render, const TextureUploadRequest& r
         return false;
     }
 
+    std::shared_ptr<IBuffer> staging = request.staging;
+    if (!staging) {
+        if (auto* uploadQueue = render.getUploadQueue()) {
+            return uploadQueue->uploadTexture(request, request.sourceData, outMipLevels).valid();
+        }
+
+        auto* resourceFactory = render.getResourceFactory();
+        if (resourceFactory) {
+            staging = resourceFactory->createBuffer(BufferCreateInfo{
+                .label       = std::format("StagingBuffer_{}", request.label),
+                .usage       = EBufferUsage::TransferSrc,
+                .data        = const_cast<std::byte*>(request.sourceData.data()),
+                .size        = static_cast<uint32_t>(request.sourceData.size()),
+                .memoryUsage = EMemoryUsage::CpuToGpu,
+            });
+        }
+        if (!staging) {
+            YA_CORE_ERROR("TextureUploadService: failed to create staging buffer for '{}'", request.label);
+            return false;
+        }
+    }
+
     ICommandBuffer* cmdBuf = render.beginIsolateCommands(
         request.label.empty() ? "TextureUpload" : std::format("TextureUpload:{}", request.label));
     if (!cmdBuf) {
@@ -33,16 +57,31 @@ bool TextureUploadService::upload(IRender& render, const TextureUploadRequest& r
         return false;
     }
 
+    if (staging == request.staging) {
+        record(*cmdBuf, request, outMipLevels);
+    }
+    else {
+        TextureUploadRequest staged = request;
+        staged.staging              = staging;
+        record(*cmdBuf, staged, outMipLevels);
+    }
+
+    render.endIsolateCommands(cmdBuf);
+    return true;
+}
+
+void TextureUploadService::record(ICommandBuffer& cmdBuf, const TextureUploadRequest& request, uint32_t* outMipLevels)
+{
     const ImageSubresourceRange* uploadRange = request.uploadRange.has_value() ? &*request.uploadRange : nullptr;
-    cmdBuf->transitionImageLayout(request.image.get(), EImageLayout::Undefined, EImageLayout::TransferDst, uploadRange);
+    cmdBuf.transitionImageLayout(request.image.get(), EImageLayout::Undefined, EImageLayout::TransferDst, uploadRange);
 
     for (const auto& region : request.regions) {
-        cmdBuf->copyBufferToImage(request.staging.get(), request.image.get(), EImageLayout::TransferDst, {region});
+        cmdBuf.copyBufferToImage(request.staging.get(), request.image.get(), EImageLayout::TransferDst, {region});
     }
 
     uint32_t uploadedMipLevels = request.image->getMipLevels();
     if (request.bGenerateMipmaps) {
-        if (!cmdBuf->generateMipmaps(request.image.get(), EImageLayout::TransferDst, request.finalLayout)) {
+        if (!cmdBuf.generateMipmaps(request.image.get(), EImageLayout::TransferDst, request.finalLayout)) {
             YA_CORE_ERROR("TextureUploadService: GPU mip generation failed for '{}'; keeping base level only", request.label);
             const ImageSubresourceRange baseLevelRange{
                 .aspectMask     = EImageAspect::Color,
@@ -51,21 +90,18 @@ bool TextureUploadService::upload(IRender& render, const TextureUploadRequest& r
                 .baseArrayLayer = 0,
                 .layerCount     = 1,
             };
-            cmdBuf->transitionImageLayout(request.image.get(), EImageLayout::TransferDst, request.finalLayout, &baseLevelRange);
+            cmdBuf.transitionImageLayout(request.image.get(), EImageLayout::TransferDst, request.finalLayout, &baseLevelRange);
             uploadedMipLevels = 1;
         }
     }
     else {
         const ImageSubresourceRange* finalizeRange = request.finalizeRange.has_value() ? &*request.finalizeRange : nullptr;
-        cmdBuf->transitionImageLayout(request.image.get(), EImageLayout::TransferDst, request.finalLayout, finalizeRange);
+        cmdBuf.transitionImageLayout(request.image.get(), EImageLayout::TransferDst, request.finalLayout, finalizeRange);
     }
 
-    render.endIsolateCommands(cmdBuf);
-
     if (outMipLevels) {
         *outMipLevels = uploadedMipLevels;
     }
-    return true;
 }
 
 } // namespace ya
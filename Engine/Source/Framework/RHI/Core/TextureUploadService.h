@@ -2,8 +2,10 @@
 
 #include "RHI/RenderDefines.h"
 
+#include <cstddef>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -11,6 +13,7 @@ namespace ya
 {
 
 struct IBuffer;
+struct ICommandBuffer;
 struct IImage;
 struct IRender;
 struct BufferImageCopy;
@@ -22,10 +25,16 @@ struct ImageSubresourceRange;
 /// Undefined -> TransferDst -> finalLayout transitions plus all copy regions
 /// inside one isolate-command scope (FG-803). Texture no longer drives
 /// begin/end isolate commands itself.
+///
+/// Instead of a staging buffer the caller may pass the CPU payload in
+/// sourceData (regions index into it); the service then stages it itself,
+/// through the render's GpuUploadQueue when it has one.
 struct TextureUploadRequest
 {
     std::shared_ptr<IImage>          image{};
     std::shared_ptr<IBuffer>         staging{};
+    /// Only read during upload(); the bytes are copied before it returns.
+    std::span<const std::byte>       sourceData{};
     std::vector<BufferImageCopy>     regions{};
     /// Optional subresource range for the initial Undefined -> TransferDst
     /// transition; absent means the full image.
@@ -47,12 +56,21 @@ struct YA_RHI_API TextureUploadService
     /// Records and submits one upload. Returns false when the command scope
     /// cannot be opened or recording fails.
     ///
+    /// A sourceData request goes through IRender::getUploadQueue() when
+    /// available: it is batched with the frame's other uploads and this
+    /// returns as soon as the bytes are staged, before the GPU copied them.
+    ///
     /// When bGenerateMipmaps is set and generation succeeds, the image ends
     /// fully readable with its declared mip chain; if generation is
     /// unsupported/fails, only the base level is transitioned to finalLayout
     /// and outMipLevels (when provided) receives 1. Otherwise outMipLevels
     /// receives the image's mip level count.
     bool upload(IRender& render, const TextureUploadRequest& request, uint32_t* outMipLevels = nullptr);
+
+    /// Records the transitions, copies and mip generation of a request with a
+    /// staging buffer into @p cmdBuf without submitting. Used by upload() and
+    /// by GpuUploadQueue batches.
+    void record(ICommandBuffer& cmdBuf, const TextureUploadRequest& request, uint32_t* outMipLevels = nullptr);
 };
 
 } // namespace ya
@@ -14,6 +14,7 @@ struct IRenderResourceFactory;
 struct RenderTargetCreateInfo;
 struct INativeWindow;
 struct ShaderStorage;
+class GpuUploadQueue;
 
 
 enum class ERenderObject : uint32_t
@@ -47,6 +48,9 @@ struct RenderCapabilities
     /// requires the enabled VK_EXT_extended_dynamic_state extension. False
     /// means callers must bake the cull mode into the pipeline statically.
     bool dynamicCullMode     = false;
+    /// Vertex shaders may read the draw's firstInstance
+    /// (SV_StartInstanceLocation / gl_BaseInstance).
+    bool shaderDrawParameters = false;
 };
 
 struct YA_RHI_API IRender : public plat_base<IRender>
@@ -151,6 +155,55 @@ struct YA_RHI_API IRender : public plat_base<IRender>
      */
     virtual void endIsolateCommands(ICommandBuffer* commandBuffer) = 0;
 
+    /**
+     * @brief Begin recording commands that are submitted without waiting
+     *
+     * Pairs with submitAsyncCommands(). The default falls back to isolated
+     * (submit-and-wait) commands, so every submission is complete on return.
+     */
+    virtual ICommandBuffer* beginAsyncCommands(const std::string& context = "")
+    {
+        return beginIsolateCommands(context);
+    }
+
+    /**
+     * @brief Submit commands opened with beginAsyncCommands()
+     * @return Monotonically increasing value; the submission has finished on
+     *         the GPU once pollAsyncCommands() reports a value >= it
+     */
+    virtual uint64_t submitAsyncCommands(ICommandBuffer* commandBuffer)
+    {
+        endIsolateCommands(commandBuffer);
+        return ++_asyncCommandsValue;
+    }
+
+    /**
+     * @brief Highest async-commands value the GPU has finished (non-blocking)
+     */
+    virtual uint64_t pollAsyncCommands() { return _asyncCommandsValue; }
+
+    /**
+     * @brief Block until the async-commands value @p value has finished
+     */
+    virtual void waitAsyncCommands(uint64_t value) { (void)value; }
+
+    /**
+     * @brief Begin a secondary command buffer owned by the calling thread
+     *
+     * For recording part of a frame on a worker: end() it on that thread,
+     * then execute it with ICommandBuffer::executeSecondary() on the frame
+     * command buffer. Buffers belong to the current in-flight frame and are
+     * recycled once its fence signalled.
+     * @return nullptr when the backend has no secondary command buffers
+     */
+    virtual ICommandBuffer* beginSecondaryCommands() { return nullptr; }
+
+    /**
+     * @brief Batched staging uploads, flushed before each graphics submission
+     * @return nullptr when the backend uploads synchronously
+     */
+    virtual GpuUploadQueue* getUploadQueue() { return nullptr; }
+
     /**
      * @brief Get the swapchain interface
      */
@@ -314,6 +367,9 @@ struct YA_RHI_API IRender : public plat_base<IRender>
      * @brief Get the native window handle (backend-specific)
      */
     virtual void* getNativeWindowHandle() const = 0;
+
+  private:
+    uint64_t _asyncCommandsValue = 0; // Default synchronous async-commands path
 };
 
 } // namespace ya
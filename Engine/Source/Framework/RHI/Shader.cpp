@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -32,6 +33,7 @@
 
 #include <SDL3/SDL_gpu.h>
 
+#include "Core/Async/JobSystem.h"
 #include "Core/System/VirtualFileSystem.h"
 
 // Slang runtime API
@@ -214,10 +216,14 @@ std::optional<std::string> resolveShaderIncludePath(std::string_view requestedSo
         return resolvedName;
     }
 
-    auto fallback     = (std::filesystem::path("Engine/Shader/GLSL") / reqPath).lexically_normal();
-    auto fallbackName = fallback.generic_string();
-    if (shaderPathExists(fallbackName)) {
-        return fallbackName;
+    // The roots the compilers search (shaderc includer: GLSL, Slang session:
+    // Slang). An unresolved include drops the file's closure from the hash.
+    for (const char* root : {"Engine/Shader/GLSL", "Engine/Shader/Slang"}) {
+        auto fallback     = (std::filesystem::path(root) / reqPath).lexically_normal();
+        auto fallbackName = fallback.generic_string();
+        if (shaderPathExists(fallbackName)) {
+            return fallbackName;
+        }
     }
     return std::nullopt;
 }
@@ -305,7 +311,9 @@ bool appendShaderDependencyHash(const std::string& filePath, std::unordered_set<
     return true;
 }
 
-uint64_t buildShaderSourceHash(const std::vector<ShaderStageSource>& stageSources, const std::vector<std::string>& defines)
+uint64_t buildShaderSourceHash(const std::vector<ShaderStageSource>& stageSources,
+                               const std::vector<std::string>&       defines,
+                               std::vector<std::string>*             outDependencies)
 {
     auto sortedStages = stageSources;
     std::sort(sortedStages.begin(), sortedStages.end(), [](const ShaderStageSource& lhs, const ShaderStageSource& rhs)
@@ -332,6 +340,11 @@ uint64_t buildShaderSourceHash(const std::vector<ShaderStageSource>& stageSource
 
         hashAppendString(hash, stageSource.source);
     }
+
+    if (outDependencies) {
+        outDependencies->assign(visitedFiles.begin(), visitedFiles.end());
+        std::sort(outDependencies->begin(), outDependencies->end());
+    }
     return hash;
 }
 
@@ -378,6 +391,22 @@ std::vector<std::pair<ya::EShaderStage::T, const std::vector<ShaderStageIr>*>> c
     return stages;
 }
 
+bool isShaderDiskCacheCurrent(const std::filesystem::path& cachePath, uint64_t expectedHash)
+{
+    std::ifstream input(cachePath, std::ios::binary);
+    if (!input.is_open()) {
+        return false;
+    }
+
+    ya::ShaderDiskCacheHeader header{};
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    return input.good() &&
+           header.magic == ya::ShaderDiskCacheHeader::MAGIC &&
+           header.version == ya::ShaderDiskCacheHeader::VERSION &&
+           header.sourceHash == expectedHash &&
+           header.stageCount != 0;
+}
+
 bool loadShaderDiskCache(const std::filesystem::path& cachePath, uint64_t expectedHash, ShaderStageSpirvMap& outSpvMap)
 {
     outSpvMap.clear();
@@ -443,8 +472,9 @@ bool saveShaderDiskCache(const std::filesystem::path& cachePath, uint64_t source
         return false;
     }
 
+    // Per-thread temp name: parallel compiles may race on the same entry.
     auto tempPath = cachePath;
-    tempPath += ".tmp";
+    tempPath += std::format(".{:x}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
     std::filesystem::remove(tempPath, ec);
     ec.clear();
 
@@ -509,14 +539,29 @@ void ShaderStorage::preloadAsync(std::vector<ShaderDesc> shaders)
     _preloadThread = std::make_unique<std::thread>([this, shaders = std::move(shaders)]()
                                                    {
         YA_PROFILE_SCOPE_LOG("ShaderStorage::preloadAsync");
-        for (const auto& desc : shaders) {
+        auto loadOne = [this](const ShaderDesc& desc) {
             try {
-                load(desc);
+                (void)load(desc);
             }
             catch (const std::exception& e) {
                 YA_CORE_ERROR("Preload failed for shader '{}': {}", desc.cacheKey(), e.what());
             }
-        } });
+        };
+
+        // Fan out over the job workers; this thread only keeps the caller
+        // free to continue init until waitForPreload().
+        auto& jobSystem = JobSystem::get();
+        if (!jobSystem.isRunning()) {
+            for (const auto& desc : shaders) {
+                loadOne(desc);
+            }
+            return;
+        }
+        jobSystem.parallelFor(static_cast<uint32_t>(shaders.size()), 1, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                loadOne(shaders[i]);
+            }
+        }, EJobPriority::Background); });
 }
 
 void ShaderStorage::waitForPreload()
@@ -1,6 +1,8 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -195,6 +197,16 @@ struct ShaderDiskCacheStageHeader
     uint32_t wordCount = 0;
 };
 
+/// Where a ShaderDesc's SPIR-V is cached and the hash it must carry to be current.
+struct ShaderCacheEntry
+{
+    std::filesystem::path    cachePath;
+    uint64_t                 sourceHash = 0;
+    /// Source files the hash covers: stage sources plus every transitive
+    /// #include / import, normalized.
+    std::vector<std::string> dependencies;
+};
+
 struct IShaderProcessor
 {
     friend class ShaderProcessorFactory;
@@ -206,10 +218,6 @@ struct IShaderProcessor
     stdpath     intermediateStoragePath = "Intermediate/Shader/";
     std::string cachedFileSuffix;
 
-  public:
-    std::string           curFileName;
-    std::filesystem::path curFilePath;
-
   public:
     using ir_t          = uint32_t;
     using spirv_ir_t    = std::vector<ir_t>;
@@ -223,8 +231,14 @@ struct IShaderProcessor
 
   public:
 
+    // process() and resolveCache() keep no per-call state on the processor, so
+    // one instance may compile several ShaderDescs concurrently.
     virtual std::optional<stage2spirv_t>                    process(const ShaderDesc& ci, EShaderProcessMode mode = EShaderProcessMode::UseCache) = 0;
     [[nodiscard]] virtual ShaderReflection::ShaderResources reflect(EShaderStage::T stage, const std::vector<ir_t>& spirvData)                      = 0;
+
+    /// Read @p ci's sources and hash them (with their includes) without
+    /// compiling. nullopt when a source cannot be read.
+    [[nodiscard]] virtual std::optional<ShaderCacheEntry> resolveCache(const ShaderDesc& ci) = 0;
 };
 
 struct YA_RHI_API GLSLProcessor : public IShaderProcessor
@@ -245,6 +259,7 @@ struct YA_RHI_API GLSLProcessor : public IShaderProcessor
 
     std::optional<stage2spirv_t>      process(const ShaderDesc& ci, EShaderProcessMode mode = EShaderProcessMode::UseCache) override;
     ShaderReflection::ShaderResources reflect(EShaderStage::T stage, const std::vector<ir_t>& spirvData) override;
+    std::optional<ShaderCacheEntry>   resolveCache(const ShaderDesc& ci) override;
 
     auto compileToSpv(std::string_view filename, std::string_view content, EShaderStage::T stage, const std::vector<std::string>& defines, std::vector<ir_t>& outSpv) -> bool;
 
@@ -252,7 +267,7 @@ struct YA_RHI_API GLSLProcessor : public IShaderProcessor
 
   private:
 
-    std::filesystem::path GetCachePath(bool bVulkan) const;
+    std::filesystem::path GetCachePath(std::string_view cacheKey, bool bVulkan) const;
 
     bool                                             processCombinedSource(const stdpath& filepath, const std::vector<std::string>& defines, stage2spirv_t& outSpvMap);
     std::unordered_map<EShaderStage::T, std::string> preprocessCombinedSource(const stdpath& filepath);
@@ -274,8 +289,11 @@ struct YA_RHI_API SlangProcessor : public IShaderProcessor
   public:
     std::optional<stage2spirv_t>      process(const ShaderDesc& ci, EShaderProcessMode mode = EShaderProcessMode::UseCache) override;
     ShaderReflection::ShaderResources reflect(EShaderStage::T stage, const std::vector<ir_t>& spirvData) override;
+    std::optional<ShaderCacheEntry>   resolveCache(const ShaderDesc& ci) override;
 
   private:
+    std::filesystem::path getCachePath(std::string_view cacheKey) const;
+
     // Compile a single .slang source file + entry point to SPIR-V.
     // `source`    – full source text (read from VFS)
     // `filePath`  – path used for error messages and #include resolution
@@ -300,7 +318,19 @@ struct YA_RHI_API ShaderStorage
     std::shared_ptr<IShaderProcessor>               _processor;
     std::shared_ptr<IShaderProcessor>               _slangProcessor; // optional, for .slang files
     std::unordered_map<std::string, cache_value_t>  _shaderCache;
+    std::unordered_map<std::string, ShaderDesc>     _loadedDescs; // Permutations requested this run
     mutable std::mutex                              _cacheMutex;
+
+    /// A compile in progress; concurrent loads of the same key wait on it
+    /// instead of compiling again. The ticket tells a superseding
+    /// ForceRecompile's entry apart from the one a finished compile owns.
+    struct InFlightCompile
+    {
+        std::shared_future<cache_value_t> result;
+        uint64_t                          ticket = 0;
+    };
+    std::unordered_map<std::string, InFlightCompile> _inFlight;
+    uint64_t                                         _nextTicket = 0;
     std::unique_ptr<std::thread>                    _preloadThread;
 
     ShaderStorage(std::shared_ptr<IShaderProcessor> processor)
@@ -365,26 +395,75 @@ struct YA_RHI_API ShaderStorage
         const auto cacheKey = ci.cacheKey();
         YA_CORE_ASSERT(!cacheKey.empty(), "Shader cache key is empty");
 
-        if (mode == EShaderProcessMode::UseCache) {
-            std::lock_guard lock(_cacheMutex);
-            auto it = _shaderCache.find(cacheKey);
-            if (it != _shaderCache.end()) {
-                return it->second;
+        // UseCache joins a compile already running for the key (pipeline
+        // precompile workers often request the same permutation together).
+        // ForceRecompile never joins one that may predate a source edit, but
+        // registers itself so later UseCache loads wait for its result.
+        std::promise<cache_value_t> promise;
+        uint64_t                    ticket = 0;
+        {
+            std::unique_lock lock(_cacheMutex);
+            if (mode == EShaderProcessMode::UseCache) {
+                if (auto it = _shaderCache.find(cacheKey); it != _shaderCache.end()) {
+                    return it->second;
+                }
+                if (auto it = _inFlight.find(cacheKey); it != _inFlight.end()) {
+                    auto pending = it->second.result;
+                    lock.unlock();
+                    return pending.get();
+                }
             }
+            ticket              = ++_nextTicket;
+            _inFlight[cacheKey] = {.result = promise.get_future().share(), .ticket = ticket};
         }
 
-        YA_PROFILE_SCOPE_LOG(std::format("ShaderStorage::load {}", cacheKey).c_str());
-        auto opt = selectProcessor(ci)->process(ci, mode);
-        if (!opt.has_value()) {
-            throw std::runtime_error(std::format("Failed to process shader: {}", cacheKey));
+        auto finish = [&](const cache_value_t& compiled)
+        {
+            std::lock_guard lock(_cacheMutex);
+            if (auto it = _inFlight.find(cacheKey); it != _inFlight.end() && it->second.ticket == ticket) {
+                _inFlight.erase(it);
+            }
+            if (compiled) {
+                _shaderCache[cacheKey] = compiled;
+                _loadedDescs.try_emplace(cacheKey, ci);
+            }
+        };
+
+        try {
+            YA_PROFILE_SCOPE_LOG(std::format("ShaderStorage::load {}", cacheKey).c_str());
+            auto opt = selectProcessor(ci)->process(ci, mode);
+            if (!opt.has_value()) {
+                throw std::runtime_error(std::format("Failed to process shader: {}", cacheKey));
+            }
+
+            auto compiled = std::make_shared<stage2spirv_t>(std::move(*opt));
+            finish(compiled);
+            promise.set_value(compiled);
+            return compiled;
+        }
+        catch (...) {
+            finish(nullptr);
+            promise.set_exception(std::current_exception());
+            throw;
         }
+    }
 
-        auto compiled = std::make_shared<stage2spirv_t>(std::move(*opt));
+    /// Every permutation loaded so far, sorted by cache key. Fed to the
+    /// ShaderCompiler program (as a manifest) so the next start finds them cached.
+    [[nodiscard]] std::vector<ShaderDesc> getLoadedShaderDescs() const
+    {
+        std::vector<ShaderDesc> descs;
         {
             std::lock_guard lock(_cacheMutex);
-            _shaderCache[cacheKey] = compiled;
+            descs.reserve(_loadedDescs.size());
+            for (const auto& [_, desc] : _loadedDescs) {
+                descs.push_back(desc);
+            }
         }
-        return compiled;
+        std::sort(descs.begin(), descs.end(), [](const ShaderDesc& lhs, const ShaderDesc& rhs) {
+            return lhs.cacheKey() < rhs.cacheKey();
+        });
+        return descs;
     }
 
     [[nodiscard]] std::shared_ptr<const stage2spirv_t> reload(const ShaderDesc& ci)
@@ -399,19 +478,24 @@ struct YA_RHI_API ShaderStorage
         return load(ci, forceReload ? EShaderProcessMode::ForceRecompile : EShaderProcessMode::UseCache);
     }
 
+    /// Throw unless @p ci's current sources compile. A disk-cache entry written
+    /// for exactly these sources (e.g. by the offline ShaderCompiler) counts,
+    /// so startup validation does not recompile.
     void validate(const ShaderDesc& ci)
     {
         const auto cacheKey = ci.cacheKey();
         YA_CORE_ASSERT(!cacheKey.empty(), "Shader cache key is empty");
 
         YA_PROFILE_SCOPE_LOG(std::format("ShaderStorage::validate {}", cacheKey).c_str());
-        auto opt = selectProcessor(ci)->process(ci, EShaderProcessMode::ForceRecompile);
+        auto opt = selectProcessor(ci)->process(ci, EShaderProcessMode::UseCache);
         if (!opt.has_value()) {
             throw std::runtime_error(std::format("Failed to process shader: {}", cacheKey));
         }
     }
 
-    /// Launch a background thread that loads all given shaders.
+    /// Launch a background thread that loads all given shaders, spread over
+    /// JobSystem workers when it is running. With caches prebuilt by the
+    /// ShaderCompiler program this only reads SPIR-V.
     /// Call waitForPreload() before any code that depends on the results.
     void preloadAsync(std::vector<ShaderDesc> shaders);
 
@@ -33,6 +33,63 @@ constexpr std::string_view kEolChars =
 #endif
 
 using shader_internal::ShaderStageSource;
+
+/// Sources hashed for @p ci's disk cache: one entry per stage file, or the
+/// combined file (tagged Vertex) in SingleShader mode.
+bool readShaderSources(const ShaderDesc& ci, const std::filesystem::path& storageRoot, std::vector<ShaderStageSource>& outSources)
+{
+    if (ci.sourceMode == ShaderDesc::ESourceMode::StageFiles)
+    {
+        uint32_t seenStages = 0;
+        for (const auto& stageFile : ci.stageFiles)
+        {
+            if (seenStages & stageFile.stage) {
+                YA_CORE_ERROR("Duplicate stage entry in ShaderDesc::stageFiles, stage={}", static_cast<int>(stageFile.stage));
+                return false;
+            }
+            seenStages |= stageFile.stage;
+
+            std::filesystem::path stagePath(stageFile.file);
+            if (!stagePath.is_absolute()) {
+                stagePath = storageRoot / stagePath;
+            }
+
+            auto        stagePathStr = stagePath.generic_string();
+            std::string stageSource;
+            if (!shader_internal::readShaderTextFile(stagePathStr, stageSource)) {
+                YA_CORE_ERROR("Failed to read explicit stage-file shader source: {}", stagePathStr);
+                return false;
+            }
+
+            outSources.push_back(ShaderStageSource{
+                .stage  = stageFile.stage,
+                .path   = stagePathStr,
+                .source = std::move(stageSource),
+            });
+        }
+        return true;
+    }
+
+    std::string shaderName = ci.shaderName;
+    YA_CORE_ASSERT(!shaderName.empty(), "SingleShader mode requires shaderName");
+    if (!shaderName.ends_with(".glsl")) {
+        shaderName += ".glsl";
+    }
+
+    const auto  filePath = (storageRoot / shaderName).generic_string();
+    std::string shaderSource;
+    if (!shader_internal::readShaderTextFile(filePath, shaderSource)) {
+        YA_CORE_ERROR("Failed to read shader source: {}", filePath);
+        return false;
+    }
+
+    outSources.push_back(ShaderStageSource{
+        .stage  = EShaderStage::Vertex,
+        .path   = filePath,
+        .source = std::move(shaderSource),
+    });
+    return true;
+}
 } // namespace
 
 namespace EShaderStage
@@ -169,10 +226,9 @@ struct ShadercVfsIncluder : public shaderc::CompileOptions::IncluderInterface
 // GLSLProcessor Implementation
 // ============================================================
 
-std::filesystem::path GLSLProcessor::GetCachePath(bool bVulkan) const
+std::filesystem::path GLSLProcessor::GetCachePath(std::string_view cacheKey, bool bVulkan) const
 {
     auto cacheDir = stdpath(intermediateStoragePath) / (bVulkan ? "Vulkan" : "OpenGL");
-    auto cacheKey = curFileName.empty() ? curFilePath.generic_string() : curFileName;
     return cacheDir / shader_internal::makeCacheFileName(cacheKey);
 }
 
@@ -315,7 +371,7 @@ std::unordered_map<EShaderStage::T, std::string> GLSLProcessor::preprocessCombin
 
 bool GLSLProcessor::processSpvFiles(std::string_view vertFile, std::string_view fragFile, stage2spirv_t& outSpvMap)
 {
-    YA_CORE_INFO("Found spv shader files for {}: {} and {}", curFileName, vertFile, fragFile);
+    YA_CORE_INFO("Found spv shader files: {} and {}", vertFile, fragFile);
 
     auto toSpirv = [](std::string_view ctx, const std::string& src, std::vector<ir_t>& spirv) {
         if (src.size() % sizeof(ir_t) != 0)
@@ -335,7 +391,7 @@ bool GLSLProcessor::processSpvFiles(std::string_view vertFile, std::string_view
         YA_CORE_WARN("Failed to read cached vertex shader file: {}", vertFile);
         return false;
     }
-    if (!toSpirv(curFileName, vertFileStr, vertSpv)) {
+    if (!toSpirv(vertFile, vertFileStr, vertSpv)) {
         YA_CORE_ERROR("Failed to convert cached vertex shader file to SPIR-V: {}", vertFile);
         return false;
     }
@@ -348,7 +404,7 @@ bool GLSLProcessor::processSpvFiles(std::string_view vertFile, std::string_view
         YA_CORE_ERROR("Failed to read cached fragment shader file: {}", fragFile);
         return false;
     }
-    if (!toSpirv(curFileName, fragFileStr, fragSpv)) {
+    if (!toSpirv(fragFile, fragFileStr, fragSpv)) {
         YA_CORE_ERROR("Failed to convert cached fragment shader file to SPIR-V: {}", fragFile);
         return false;
     }
@@ -381,13 +437,25 @@ bool GLSLProcessor::processCombinedSource(const stdpath& filepath, const std::ve
     return true;
 }
 
+std::optional<ShaderCacheEntry> GLSLProcessor::resolveCache(const ShaderDesc& ci)
+{
+    std::vector<ShaderStageSource> sources;
+    if (!readShaderSources(ci, shaderStoragePath, sources)) {
+        return {};
+    }
+
+    ShaderCacheEntry entry;
+    entry.cachePath  = GetCachePath(ci.cacheKey(), true);
+    entry.sourceHash = shader_internal::buildShaderSourceHash(sources, ci.defines, &entry.dependencies);
+    return entry;
+}
+
 std::optional<GLSLProcessor::stage2spirv_t> GLSLProcessor::process(const ShaderDesc& ci, EShaderProcessMode mode)
 {
     const auto cacheKey = ci.cacheKey();
     YA_CORE_ASSERT(!cacheKey.empty(), "ShaderDesc cache key cannot be empty");
 
     stage2spirv_t ret;
-    uint64_t      sourceHash = 0;
 
     auto hasValidStageSet = [&](const stage2spirv_t& stageMap) {
         if (stageMap.contains(EShaderStage::Vertex) && stageMap.contains(EShaderStage::Fragment)) {
@@ -406,49 +474,22 @@ std::optional<GLSLProcessor::stage2spirv_t> GLSLProcessor::process(const ShaderD
         return true;
     };
 
-    if (ci.sourceMode == ShaderDesc::ESourceMode::StageFiles)
-    {
-        std::vector<ShaderStageSource> stageSources;
-        stageSources.reserve(ci.stageFiles.size());
-
-        for (const auto& stageFile : ci.stageFiles)
-        {
-            if (ret.contains(stageFile.stage)) {
-                YA_CORE_ERROR("Duplicate stage entry in ShaderDesc::stageFiles, stage={}", static_cast<int>(stageFile.stage));
-                return {};
-            }
-
-            std::filesystem::path stagePath(stageFile.file);
-            if (!stagePath.is_absolute()) {
-                stagePath = stdpath(shaderStoragePath) / stagePath;
-            }
-
-            auto stagePathStr = stagePath.generic_string();
-            std::string stageSource;
-            if (!shader_internal::readShaderTextFile(stagePathStr, stageSource)) {
-                YA_CORE_ERROR("Failed to read explicit stage-file shader source: {}", stagePathStr);
-                return {};
-            }
-
-            stageSources.push_back(ShaderStageSource{
-                .stage  = stageFile.stage,
-                .path   = stagePathStr,
-                .source = std::move(stageSource),
-            });
-            ret[stageFile.stage] = {};
-        }
+    std::vector<ShaderStageSource> sources;
+    if (!readShaderSources(ci, shaderStoragePath, sources)) {
+        return {};
+    }
 
-        ret.clear();
-        curFileName = cacheKey;
-        curFilePath.clear();
-        sourceHash = shader_internal::buildShaderSourceHash(stageSources, ci.defines);
-        const auto cachePath = GetCachePath(true);
-        if (mode == EShaderProcessMode::UseCache && shader_internal::loadShaderDiskCache(cachePath, sourceHash, ret)) {
-            YA_CORE_INFO("Loaded shader disk cache for {}", cacheKey);
-            return {std::move(ret)};
-        }
+    const uint64_t sourceHash = shader_internal::buildShaderSourceHash(sources, ci.defines);
+    const auto     cachePath  = GetCachePath(cacheKey, true);
+    if (mode == EShaderProcessMode::UseCache && shader_internal::loadShaderDiskCache(cachePath, sourceHash, ret)) {
+        YA_CORE_INFO("Loaded shader disk cache for {}", cacheKey);
+        return {std::move(ret)};
+    }
+    ret.clear();
 
-        for (const auto& stageSource : stageSources) {
+    if (ci.sourceMode == ShaderDesc::ESourceMode::StageFiles)
+    {
+        for (const auto& stageSource : sources) {
             if (!compileStageSource(stageSource, "explicit stage-file")) {
                 return {};
             }
@@ -458,57 +499,27 @@ std::optional<GLSLProcessor::stage2spirv_t> GLSLProcessor::process(const ShaderD
             YA_CORE_ERROR("Explicit stage-files mode requires vertex+fragment or compute-only stages: {}", cacheKey);
             return {};
         }
-
-        if (!shader_internal::saveShaderDiskCache(cachePath, sourceHash, ret)) {
-            YA_CORE_WARN("Failed to write shader disk cache: {}", cachePath.generic_string());
-        }
         YA_CORE_INFO("Preprocessed explicit stage-files shader for {}: {} stages found", cacheKey, ret.size());
     }
     else
     {
-        std::string shaderName = ci.shaderName;
-        YA_CORE_ASSERT(!shaderName.empty(), "SingleShader mode requires shaderName");
-        if (!shaderName.ends_with(".glsl")) {
-            shaderName += ".glsl";
-        }
-
-        curFileName = cacheKey;
-        curFilePath = stdpath(shaderStoragePath) / shaderName;
-
-        std::string shaderSource;
-        if (!shader_internal::readShaderTextFile(curFilePath.generic_string(), shaderSource)) {
-            YA_CORE_ERROR("Failed to read shader source: {}", curFilePath.generic_string());
-            return {};
-        }
-
-        sourceHash = shader_internal::buildShaderSourceHash({ShaderStageSource{
-            .stage  = EShaderStage::Vertex,
-            .path   = curFilePath.generic_string(),
-            .source = shaderSource,
-        }}, ci.defines);
-        const auto cachePath = GetCachePath(true);
-        if (mode == EShaderProcessMode::UseCache && shader_internal::loadShaderDiskCache(cachePath, sourceHash, ret)) {
-            YA_CORE_INFO("Loaded shader disk cache for {}", shaderName);
-            return {std::move(ret)};
-        }
-
-        ret.clear();
-        if (processCombinedSource(curFilePath, ci.defines, ret)) {
-            YA_CORE_INFO("Preprocessed shader source for {}: {} stages found", shaderName, ret.size());
+        const stdpath filePath = sources.front().path;
+        if (processCombinedSource(filePath, ci.defines, ret)) {
+            YA_CORE_INFO("Preprocessed shader source for {}: {} stages found", cacheKey, ret.size());
         }
         else {
-            YA_CORE_ERROR("Failed to preprocess shader source: {}", shaderName);
+            YA_CORE_ERROR("Failed to preprocess shader source: {}", cacheKey);
             return {};
         }
 
         if (!hasValidStageSet(ret)) {
-            YA_CORE_ERROR("SingleShader mode requires vertex+fragment or compute-only stages: {}", shaderName);
+            YA_CORE_ERROR("SingleShader mode requires vertex+fragment or compute-only stages: {}", cacheKey);
             return {};
         }
+    }
 
-        if (!shader_internal::saveShaderDiskCache(cachePath, sourceHash, ret)) {
-            YA_CORE_WARN("Failed to write shader disk cache: {}", cachePath.generic_string());
-        }
+    if (!shader_internal::saveShaderDiskCache(cachePath, sourceHash, ret)) {
+        YA_CORE_WARN("Failed to write shader disk cache: {}", cachePath.generic_string());
     }
 
     for (const auto& [stage, spirv] : ret) {
@@ -0,0 +1,284 @@
+#include "RHI/Shader/ShaderBatchCompiler.h"
+
+#include "RHI/Shader/ShaderInternal.h"
+
+#include "Core/Async/JobSystem.h"
+
+#include "utility.cc/string_utils.h"
+
+#include <array>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <unordered_set>
+
+namespace ya
+{
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct StageToken
+{
+    EShaderStage::T  stage;
+    std::string_view name;
+};
+
+// EShaderStage::fromString() asserts on unknown names; manifests are user input.
+constexpr std::array<StageToken, 6> kStageTokens = {{
+    {.stage = EShaderStage::Vertex, .name = "vertex"},
+    {.stage = EShaderStage::Fragment, .name = "fragment"},
+    {.stage = EShaderStage::Geometry, .name = "geometry"},
+    {.stage = EShaderStage::Compute, .name = "compute"},
+    {.stage = EShaderStage::Task, .name = "task"},
+    {.stage = EShaderStage::Mesh, .name = "mesh"},
+}};
+
+const StageToken* findStageToken(std::string_view name)
+{
+    for (const auto& token : kStageTokens) {
+        if (token.name == name) {
+            return &token;
+        }
+    }
+    return nullptr;
+}
+
+const StageToken* findStageToken(EShaderStage::T stage)
+{
+    for (const auto& token : kStageTokens) {
+        if (token.stage == stage) {
+            return &token;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+std::optional<ShaderDesc> parseShaderManifestLine(std::string_view line)
+{
+    if (const auto comment = line.find('#'); comment != std::string_view::npos) {
+        line = line.substr(0, comment);
+    }
+    line = ut::str::trim(line);
+    if (line.empty()) {
+        return std::nullopt;
+    }
+
+    ShaderDesc       desc;
+    std::string_view rest = line;
+    const auto       bar  = rest.find('|');
+    std::string_view head = ut::str::trim(rest.substr(0, bar));
+    rest                  = bar == std::string_view::npos ? std::string_view{} : rest.substr(bar + 1);
+
+    const auto colon = head.find(':');
+    if (colon != std::string_view::npos && findStageToken(head.substr(0, colon))) {
+        desc.sourceMode = ShaderDesc::ESourceMode::StageFiles;
+        while (!head.empty()) {
+            const auto       space = head.find_first_of(" \t");
+            std::string_view token = head.substr(0, space);
+            head                   = space == std::string_view::npos ? std::string_view{} : ut::str::trim(head.substr(space));
+
+            const auto  tokenColon = token.find(':');
+            const auto* stage      = tokenColon == std::string_view::npos ? nullptr : findStageToken(token.substr(0, tokenColon));
+            if (!stage) {
+                YA_CORE_WARN("Shader manifest: bad stage token '{}' in '{}'", token, line);
+                return std::nullopt;
+            }
+
+            std::string_view file  = token.substr(tokenColon + 1);
+            std::string_view entry = {};
+            if (const auto at = file.find('@'); at != std::string_view::npos) {
+                entry = file.substr(at + 1);
+                file  = file.substr(0, at);
+            }
+            desc.stageFiles.push_back(ShaderDesc::StageFile{
+                .stage     = stage->stage,
+                .file      = std::string(file),
+                .entryName = std::string(entry),
+            });
+        }
+    }
+    else {
+        desc.shaderName = std::string(head);
+    }
+
+    while (!rest.empty()) {
+        const auto next = rest.find('|');
+        const auto def  = ut::str::trim(rest.substr(0, next));
+        if (!def.empty()) {
+            desc.defines.emplace_back(def);
+        }
+        rest = next == std::string_view::npos ? std::string_view{} : rest.substr(next + 1);
+    }
+
+    if (desc.cacheKey().empty()) {
+        return std::nullopt;
+    }
+    return desc;
+}
+
+std::string formatShaderManifestLine(const ShaderDesc& desc)
+{
+    std::string line;
+    if (!desc.shaderName.empty()) {
+        line = desc.shaderName;
+    }
+    else {
+        for (const auto& stageFile : desc.stageFiles) {
+            const auto* token = findStageToken(stageFile.stage);
+            if (!token) {
+                continue;
+            }
+            if (!line.empty()) {
+                line += ' ';
+            }
+            line += token->name;
+            line += ':';
+            line += stageFile.file;
+            if (!stageFile.entryName.empty()) {
+                line += '@';
+                line += stageFile.entryName;
+            }
+        }
+    }
+    for (const auto& define : desc.defines) {
+        line += " | ";
+        line += define;
+    }
+    return line;
+}
+
+bool loadShaderManifest(const std::filesystem::path& path, std::vector<ShaderDesc>& outShaders)
+{
+    std::ifstream input(path);
+    if (!input.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(input, line)) {
+        if (auto desc = parseShaderManifestLine(line)) {
+            outShaders.push_back(std::move(*desc));
+        }
+    }
+    return true;
+}
+
+bool saveShaderManifest(const std::filesystem::path& path, std::span<const ShaderDesc> shaders)
+{
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    std::ofstream output(path, std::ios::trunc);
+    if (!output.is_open()) {
+        return false;
+    }
+    output << "# Shader permutations requested at runtime; input of the ShaderCompiler program.\n";
+    for (const auto& desc : shaders) {
+        output << formatShaderManifestLine(desc) << '\n';
+    }
+    return output.good();
+}
+
+bool mergeShaderManifest(const std::filesystem::path& path, std::span<const ShaderDesc> shaders)
+{
+    std::vector<ShaderDesc> merged;
+    loadShaderManifest(path, merged);
+
+    std::unordered_set<std::string> keys;
+    for (const auto& desc : merged) {
+        keys.insert(desc.cacheKey());
+    }
+    const size_t known = merged.size();
+    for (const auto& desc : shaders) {
+        if (keys.insert(desc.cacheKey()).second) {
+            merged.push_back(desc);
+        }
+    }
+    return merged.size() == known || saveShaderManifest(path, merged);
+}
+
+ShaderBatchItemResult ShaderBatchCompiler::compileOne(const ShaderDesc& desc, const ShaderBatchOptions& options) const
+{
+    ShaderBatchItemResult result{.cacheKey = desc.cacheKey()};
+    const auto            begin = Clock::now();
+
+    try {
+        auto processor = _storage.selectProcessor(desc);
+        auto entry     = processor->resolveCache(desc);
+        if (!entry) {
+            YA_CORE_ERROR("ShaderBatchCompiler: cannot read sources of {}", result.cacheKey);
+        }
+        else {
+            result.dependencyCount = static_cast<uint32_t>(entry->dependencies.size());
+            if (!options.bForce && shader_internal::isShaderDiskCacheCurrent(entry->cachePath, entry->sourceHash)) {
+                result.status = EShaderBatchStatus::UpToDate;
+            }
+            else if (processor->process(desc, EShaderProcessMode::ForceRecompile)) {
+                result.status = EShaderBatchStatus::Compiled;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        YA_CORE_ERROR("ShaderBatchCompiler: {} threw: {}", result.cacheKey, e.what());
+    }
+
+    result.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return result;
+}
+
+ShaderBatchReport ShaderBatchCompiler::compile(std::span<const ShaderDesc> shaders, ShaderBatchOptions options) const
+{
+    YA_PROFILE_SCOPE_LOG("ShaderBatchCompiler::compile");
+    const auto begin = Clock::now();
+
+    // Permutation lists are often generated; the same key twice would race
+    // on one cache file.
+    std::vector<const ShaderDesc*>  unique;
+    std::unordered_set<std::string> seenKeys;
+    unique.reserve(shaders.size());
+    for (const auto& desc : shaders) {
+        if (seenKeys.insert(desc.cacheKey()).second) {
+            unique.push_back(&desc);
+        }
+    }
+
+    ShaderBatchReport report;
+    report.items.resize(unique.size());
+
+    auto& jobSystem = JobSystem::get();
+    if (options.bSerial || !jobSystem.isRunning()) {
+        for (size_t i = 0; i < unique.size(); ++i) {
+            report.items[i] = compileOne(*unique[i], options);
+        }
+    }
+    else {
+        // One shader per job: compile times vary by orders of magnitude.
+        jobSystem.parallelFor(static_cast<uint32_t>(unique.size()), 1, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                report.items[i] = compileOne(*unique[i], options);
+            }
+        }, EJobPriority::Background);
+    }
+
+    for (const auto& item : report.items) {
+        switch (item.status) {
+        case EShaderBatchStatus::UpToDate:
+            ++report.upToDate;
+            break;
+        case EShaderBatchStatus::Compiled:
+            ++report.compiled;
+            break;
+        case EShaderBatchStatus::Failed:
+            ++report.failed;
+            break;
+        }
+    }
+    report.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return report;
+}
+
+} // namespace ya
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "RHI/Shader.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ya
+{
+
+enum class EShaderBatchStatus : uint8_t
+{
+    UpToDate, // Disk cache matches the current sources, nothing compiled
+    Compiled,
+    Failed,
+};
+
+struct ShaderBatchItemResult
+{
+    std::string        cacheKey;
+    EShaderBatchStatus status          = EShaderBatchStatus::Failed;
+    uint32_t           dependencyCount = 0; // Files the cache hash covers
+    double             seconds         = 0.0;
+};
+
+struct ShaderBatchReport
+{
+    std::vector<ShaderBatchItemResult> items; // Input order, duplicate cache keys dropped
+    uint32_t                           upToDate = 0;
+    uint32_t                           compiled = 0;
+    uint32_t                           failed   = 0;
+    double                             seconds  = 0.0; // Wall time of the batch
+
+    [[nodiscard]] bool succeeded() const { return failed == 0; }
+};
+
+struct ShaderBatchOptions
+{
+    bool bForce  = false; // Recompile even when the disk cache is current
+    bool bSerial = false; // Compile on the calling thread only
+};
+
+/**
+ * @brief Brings the SPIR-V disk cache up to date for a list of ShaderDescs
+ *
+ * Each desc is routed to the processor ShaderStorage would pick for it, so the
+ * cache files are exactly the ones the runtime loads. A desc is up to date when
+ * its cache header carries the hash of its sources and their transitive
+ * #include / import closure; only the remaining ones are compiled, in parallel
+ * on JobSystem (when it is running). Editing a shared include therefore
+ * rebuilds just the permutations that reach it.
+ */
+class YA_RHI_API ShaderBatchCompiler
+{
+  public:
+    explicit ShaderBatchCompiler(const ShaderStorage& storage)
+        : _storage(storage)
+    {
+    }
+
+    [[nodiscard]] ShaderBatchReport compile(std::span<const ShaderDesc> shaders, ShaderBatchOptions options = {}) const;
+
+  private:
+    const ShaderStorage& _storage;
+
+    ShaderBatchItemResult compileOne(const ShaderDesc& desc, const ShaderBatchOptions& options) const;
+};
+
+/**
+ * Permutation manifest: one ShaderDesc per line, `#` starts a comment.
+ *
+ *     Test/Unlit.glsl
+ *     DeferredRender/GBufferPass_PBR.slang | ENABLE_SKINNING 1
+ *     vertex:Sprite2D.slang fragment:Sprite2D.slang@fragMain | FOO=1
+ *
+ * The part before the first `|` is a shader name or a list of
+ * `stage:file[@entry]`; every further `|` field is one define, in order
+ * (defines are part of the cache key).
+ */
+YA_RHI_API std::optional<ShaderDesc> parseShaderManifestLine(std::string_view line);
+YA_RHI_API std::string               formatShaderManifestLine(const ShaderDesc& desc);
+/// Appends the descs of @p path to @p outShaders; false if it cannot be read.
+YA_RHI_API bool loadShaderManifest(const std::filesystem::path& path, std::vector<ShaderDesc>& outShaders);
+YA_RHI_API bool saveShaderManifest(const std::filesystem::path& path, std::span<const ShaderDesc> shaders);
+/// Add the descs of @p shaders whose cache key @p path does not list yet;
+/// rewrites the file only when something was added.
+YA_RHI_API bool mergeShaderManifest(const std::filesystem::path& path, std::span<const ShaderDesc> shaders);
+
+} // namespace ya
@@ -20,10 +20,15 @@ struct ShaderStageSource
     std::string     source;
 };
 
-uint64_t buildShaderSourceHash(const std::vector<ShaderStageSource>& stageSources, const std::vector<std::string>& defines);
+/// @p outDependencies, when given, receives every file the hash read.
+uint64_t buildShaderSourceHash(const std::vector<ShaderStageSource>& stageSources,
+                               const std::vector<std::string>&       defines,
+                               std::vector<std::string>*             outDependencies = nullptr);
 std::string makeCacheFileName(std::string_view cacheKey);
 bool isValidSpirvModule(const std::vector<ShaderStageIr>& spirv);
 bool loadShaderDiskCache(const std::filesystem::path& cachePath, uint64_t expectedHash, ShaderStageSpirvMap& outSpvMap);
+/// Header-only check: the cache file exists and was written for @p expectedHash.
+bool isShaderDiskCacheCurrent(const std::filesystem::path& cachePath, uint64_t expectedHash);
 bool saveShaderDiskCache(const std::filesystem::path& cachePath, uint64_t sourceHash, const ShaderStageSpirvMap& spvMap);
 bool shaderPathExists(std::string_view path);
 bool readShaderTextFile(std::string_view path, std::string& output);
@@ -103,6 +103,60 @@ struct SlangVfsFileSystem : public ISlangFileSystem
     std::atomic<uint32_t> _refCount{1};
 };
 
+/// Sources hashed for @p ci's disk cache: one entry per stage file, or the
+/// shader file (tagged Vertex) in SingleShader mode.
+bool readSlangSources(const ShaderDesc& ci, const std::filesystem::path& storageRoot, std::vector<shader_internal::ShaderStageSource>& outSources)
+{
+    if (ci.sourceMode == ShaderDesc::ESourceMode::StageFiles) {
+        uint32_t seenStages = 0;
+        for (const auto& stageFile : ci.stageFiles) {
+            if (seenStages & stageFile.stage) {
+                YA_CORE_ERROR("[Slang] Duplicate stage in stageFiles, stage={}", static_cast<int>(stageFile.stage));
+                return false;
+            }
+            seenStages |= stageFile.stage;
+
+            std::filesystem::path stagePath(stageFile.file);
+            if (!stagePath.is_absolute()) {
+                stagePath = storageRoot / stagePath;
+            }
+
+            std::string stageSource;
+            if (!shader_internal::readShaderTextFile(stagePath.generic_string(), stageSource)) {
+                YA_CORE_ERROR("[Slang] Failed to read stage-file shader source: {}", stagePath.generic_string());
+                return false;
+            }
+
+            outSources.push_back(shader_internal::ShaderStageSource{
+                .stage  = stageFile.stage,
+                .path   = stagePath.generic_string(),
+                .source = std::move(stageSource),
+            });
+        }
+        return true;
+    }
+
+    std::string shaderName = ci.shaderName;
+    YA_CORE_ASSERT(!shaderName.empty(), "SingleShader mode requires shaderName");
+    if (!shaderName.ends_with(".slang")) {
+        shaderName += ".slang";
+    }
+
+    const auto  filePath = (storageRoot / shaderName).generic_string();
+    std::string source;
+    if (!shader_internal::readShaderTextFile(filePath, source)) {
+        YA_CORE_ERROR("[Slang] Failed to read shader: {}", filePath);
+        return false;
+    }
+
+    outSources.push_back(shader_internal::ShaderStageSource{
+        .stage  = EShaderStage::Vertex,
+        .path   = filePath,
+        .source = std::move(source),
+    });
+    return true;
+}
+
 } // namespace
 
 bool SlangProcessor::compileToSpv(std::string_view                source,
@@ -262,6 +316,24 @@ bool SlangProcessor::compileToSpv(std::string_view                source,
     return true;
 }
 
+std::filesystem::path SlangProcessor::getCachePath(std::string_view cacheKey) const
+{
+    return stdpath(intermediateStoragePath) / "Slang" / shader_internal::makeCacheFileName(cacheKey);
+}
+
+std::optional<ShaderCacheEntry> SlangProcessor::resolveCache(const ShaderDesc& ci)
+{
+    std::vector<shader_internal::ShaderStageSource> sources;
+    if (!readSlangSources(ci, shaderStoragePath, sources)) {
+        return {};
+    }
+
+    ShaderCacheEntry entry;
+    entry.cachePath  = getCachePath(ci.cacheKey());
+    entry.sourceHash = shader_internal::buildShaderSourceHash(sources, ci.defines, &entry.dependencies);
+    return entry;
+}
+
 std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const ShaderDesc& ci, EShaderProcessMode mode)
 {
     const auto cacheKey = ci.cacheKey();
@@ -287,12 +359,18 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
         return true;
     };
 
-    auto getCachePath = [&]() -> std::filesystem::path
-    {
-        auto cacheDir = stdpath(intermediateStoragePath) / "Slang";
-        auto key      = curFileName.empty() ? curFilePath.generic_string() : curFileName;
-        return cacheDir / shader_internal::makeCacheFileName(key);
-    };
+    std::vector<shader_internal::ShaderStageSource> sources;
+    if (!readSlangSources(ci, shaderStoragePath, sources)) {
+        return {};
+    }
+
+    const uint64_t sourceHash = shader_internal::buildShaderSourceHash(sources, ci.defines);
+    const auto     cachePath  = getCachePath(cacheKey);
+    if (mode == EShaderProcessMode::UseCache && shader_internal::loadShaderDiskCache(cachePath, sourceHash, ret)) {
+        YA_CORE_INFO("[Slang] Loaded shader disk cache for {}", cacheKey);
+        return {std::move(ret)};
+    }
+    ret.clear();
 
     if (ci.sourceMode == ShaderDesc::ESourceMode::StageFiles) {
         static const std::unordered_map<EShaderStage::T, std::string> defaultStageEntryNames = {
@@ -304,57 +382,15 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
             {EShaderStage::Mesh, "meshMain"},
         };
 
-        std::vector<shader_internal::ShaderStageSource> stageSources;
-        stageSources.reserve(ci.stageFiles.size());
-
-        for (const auto& stageFile : ci.stageFiles) {
-            if (ret.contains(stageFile.stage)) {
-                YA_CORE_ERROR("[Slang] Duplicate stage in stageFiles, stage={}", static_cast<int>(stageFile.stage));
-                return {};
-            }
-
-            std::filesystem::path stagePath(stageFile.file);
-            if (!stagePath.is_absolute()) {
-                stagePath = stdpath(shaderStoragePath) / stagePath;
-            }
-
-            std::string stageSource;
-            if (!shader_internal::readShaderTextFile(stagePath.generic_string(), stageSource)) {
-                YA_CORE_ERROR("[Slang] Failed to read stage-file shader source: {}", stagePath.generic_string());
-                return {};
-            }
-
-            stageSources.push_back(shader_internal::ShaderStageSource{
-                .stage  = stageFile.stage,
-                .path   = stagePath.generic_string(),
-                .source = std::move(stageSource),
-            });
-            ret[stageFile.stage] = {};
-        }
-
-        ret.clear();
-        curFileName = cacheKey;
-        curFilePath = stdpath(shaderStoragePath) / cacheKey;
-
-        const uint64_t sourceHash = shader_internal::buildShaderSourceHash(stageSources, ci.defines);
-        const auto     cachePath  = getCachePath();
-        if (mode == EShaderProcessMode::UseCache && shader_internal::loadShaderDiskCache(cachePath, sourceHash, ret)) {
-            YA_CORE_INFO("[Slang] Loaded shader disk cache for {}", cacheKey);
-            return {std::move(ret)};
-        }
-
-        for (const auto& stageFile : ci.stageFiles) {
-            std::filesystem::path stagePath(stageFile.file);
-            if (!stagePath.is_absolute()) {
-                stagePath = stdpath(shaderStoragePath) / stagePath;
-            }
+        for (size_t i = 0; i < ci.stageFiles.size(); ++i) {
+            const auto& stageFile = ci.stageFiles[i];
 
             std::string entryName = stageFile.entryName;
             if (entryName.empty()) {
                 const auto entryIt = defaultStageEntryNames.find(stageFile.stage);
                 entryName = entryIt != defaultStageEntryNames.end() ? entryIt->second : std::string{"main"};
             }
-            if (!compileStage(stageFile.stage, stagePath.generic_string(), entryName)) {
+            if (!compileStage(stageFile.stage, sources[i].path, entryName)) {
                 return {};
             }
         }
@@ -370,33 +406,8 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
         YA_CORE_INFO("[Slang] Compiled {} stages for: {}", ret.size(), cacheKey);
     }
     else {
-        std::string shaderName = ci.shaderName;
-        YA_CORE_ASSERT(!shaderName.empty(), "SingleShader mode requires shaderName");
-        if (!shaderName.ends_with(".slang")) {
-            shaderName += ".slang";
-        }
-
-        curFileName = cacheKey;
-        curFilePath = stdpath(shaderStoragePath) / shaderName;
-
-        std::string source;
-        if (!shader_internal::readShaderTextFile(curFilePath.generic_string(), source)) {
-            YA_CORE_ERROR("[Slang] Failed to read shader: {}", curFilePath.generic_string());
-            return {};
-        }
-
-        const uint64_t sourceHash = shader_internal::buildShaderSourceHash(
-            {shader_internal::ShaderStageSource{
-                .stage  = EShaderStage::Vertex,
-                .path   = curFilePath.generic_string(),
-                .source = source,
-            }},
-            ci.defines);
-        const auto cachePath = getCachePath();
-        if (mode == EShaderProcessMode::UseCache && shader_internal::loadShaderDiskCache(cachePath, sourceHash, ret)) {
-            YA_CORE_INFO("[Slang] Loaded shader disk cache for {}", shaderName);
-            return {std::move(ret)};
-        }
+        const std::string& filePath = sources.front().path;
+        const std::string& source   = sources.front().source;
 
         struct StageEntryCandidate
         {
@@ -407,7 +418,7 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
 
         const auto isStageSuffixShader = [&](std::string_view suffix)
         {
-            return shaderName.ends_with(std::string(suffix) + ".slang");
+            return filePath.ends_with(std::string(suffix) + ".slang");
         };
 
         const bool isComputeOnlyShader = isStageSuffixShader(".comp");
@@ -425,7 +436,7 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
 
         for (const auto& candidate : stageCandidates) {
             std::vector<ir_t> spv;
-            if (compileToSpv(source, curFilePath.generic_string(), candidate.entryName, candidate.stage, ci.defines, spv)) {
+            if (compileToSpv(source, filePath, candidate.entryName, candidate.stage, ci.defines, spv)) {
                 ret[candidate.stage] = std::move(spv);
                 continue;
             }
@@ -433,7 +444,7 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
             if (candidate.required) {
                 YA_CORE_ERROR("[Slang] Failed to compile required stage {} for: {}",
                               EShaderStage::toString(candidate.stage),
-                              shaderName);
+                              filePath);
                 return {};
             }
         }
@@ -441,7 +452,7 @@ std::optional<SlangProcessor::stage2spirv_t> SlangProcessor::process(const Shade
         if (!shader_internal::saveShaderDiskCache(cachePath, sourceHash, ret)) {
             YA_CORE_WARN("[Slang] Failed to write shader disk cache: {}", cachePath.generic_string());
         }
-        YA_CORE_INFO("[Slang] Compiled {} stages for: {}", ret.size(), shaderName);
+        YA_CORE_INFO("[Slang] Compiled {} stages for: {}", ret.size(), filePath);
     }
 
     for (const auto& [stage, spirv] : ret) {
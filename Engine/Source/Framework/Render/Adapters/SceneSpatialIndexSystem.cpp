@@ -0,0 +1,101 @@
+#include "SceneSpatialIndexSystem.h"
+
+#include "ECS/Component/Mesh/SkinnedMeshComponent.h"
+#include "ECS/Component/Mesh/StaticMeshComponent.h"
+#include "Resource/Model.h"
+#include "Scene/Core/Scene.h"
+#include "Scene3D/TransformComponent.h"
+
+#include "Core/Profiling/Instrumentor.h"
+
+#include <vector>
+
+namespace ya
+{
+
+void SceneSpatialIndexSystem::setSceneProvider(SceneProvider provider)
+{
+    _sceneProvider = std::move(provider);
+}
+
+void SceneSpatialIndexSystem::onUpdate(float dt)
+{
+    (void)dt;
+
+    Scene* scene = _sceneProvider ? _sceneProvider() : nullptr;
+    if (!scene || !scene->isValid()) {
+        return;
+    }
+    syncScene(*scene);
+}
+
+void SceneSpatialIndexSystem::syncScene(Scene& scene)
+{
+    YA_PROFILE_FUNCTION();
+
+    auto&              registry = scene.getRegistry();
+    SceneSpatialIndex& index    = scene.getSpatialIndex();
+    size_t             synced   = 0;
+
+    auto sync = [&](entt::entity handle, const Mesh* mesh, const TransformComponent& tc) {
+        if (!mesh || !mesh->boundingBox.isValid()) {
+            if (auto* proxy = registry.try_get<SpatialProxyComponent>(handle)) {
+                index.remove(*proxy);
+            }
+            return;
+        }
+
+        ++synced;
+        auto& proxy = registry.get_or_emplace<SpatialProxyComponent>(handle);
+        if (proxy.proxyId != DynamicAABBTree::kNullNode &&
+            proxy.worldRevision == tc.getWorldRevision() &&
+            proxy.boundsSource == mesh) {
+            return;
+        }
+
+        index.update(handle, proxy, mesh->boundingBox.transformed(tc.getTransform()));
+        proxy.worldRevision = tc.getWorldRevision();
+        proxy.boundsSource  = mesh;
+    };
+
+    registry.view<StaticMeshComponent, TransformComponent>().each(
+        [&](entt::entity handle, StaticMeshComponent& mc, TransformComponent& tc) {
+            sync(handle, mc.getMesh(), tc);
+        });
+    registry.view<SkinnedMeshComponent, TransformComponent>().each(
+        [&](entt::entity handle, SkinnedMeshComponent& mc, TransformComponent& tc) {
+            sync(handle, mc.getMesh(), tc);
+        });
+
+    if (synced != index.size()) {
+        sweepStaleProxies(scene);
+    }
+}
+
+void SceneSpatialIndexSystem::sweepStaleProxies(Scene& scene)
+{
+    YA_PROFILE_FUNCTION();
+
+    auto&              registry = scene.getRegistry();
+    SceneSpatialIndex& index    = scene.getSpatialIndex();
+
+    // Entities that lost their mesh or transform keep the link component;
+    // drop both the proxy and the link.
+    std::vector<entt::entity> unlinked;
+    auto collect = [&](auto view) {
+        for (auto handle : view) {
+            index.remove(view.template get<SpatialProxyComponent>(handle));
+            unlinked.push_back(handle);
+        }
+    };
+    collect(registry.view<SpatialProxyComponent>(entt::exclude<StaticMeshComponent, SkinnedMeshComponent>));
+    collect(registry.view<SpatialProxyComponent>(entt::exclude<TransformComponent>));
+    for (auto handle : unlinked) {
+        registry.remove<SpatialProxyComponent>(handle);
+    }
+
+    // Destroyed entities took their link with them; their proxies are orphaned in the tree.
+    index.removeStale(registry);
+}
+
+} // namespace ya
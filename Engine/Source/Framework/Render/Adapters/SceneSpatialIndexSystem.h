@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "Core/System/System.h"
+
+#include <functional>
+
+namespace ya
+{
+
+struct Scene;
+
+/**
+ * @brief Mirror mesh entity world bounds into the active scene's SceneSpatialIndex.
+ *
+ * Runs after TransformSystem. Only entities whose world matrix revision or
+ * mesh changed since the last sync touch the tree, and most of those stay
+ * inside their fat box (a containment test, no re-insert). Proxies of
+ * destroyed entities or entities that lost their mesh are swept when the
+ * proxy count stops matching the synced set.
+ *
+ * Skinned meshes use bind-pose bounds, same as the renderer.
+ */
+struct YA_RENDER_ECS_ADAPTERS_API SceneSpatialIndexSystem : public ISystem
+{
+    using SceneProvider = std::function<Scene*()>;
+
+    /// Injected seam (bound by the Host at startup; no App access from here).
+    void setSceneProvider(SceneProvider provider);
+
+    void init() override {}
+    void onUpdate(float dt) override;
+
+    /// Bring @p scene's index up to date now; cheap when nothing moved.
+    /// Queries made between system updates (e.g. picking right after a
+    /// spawn) call this first so new entities are found.
+    static void syncScene(Scene& scene);
+
+  private:
+    SceneProvider _sceneProvider;
+
+    static void sweepStaleProxies(Scene& scene);
+};
+
+} // namespace ya
@@ -7,6 +7,7 @@
 #include "ECS/Entity.h"
 #include "Resource/Model.h"
 #include "Scene/Core/Scene.h"
+#include "Render/Adapters/SceneSpatialIndexSystem.h"
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace ya
@@ -28,52 +29,39 @@ std::optional<RaycastHit> RayCastMousePickingSystem::raycast(Scene *scene, const
         return std::nullopt;
     }
 
-    std::optional<RaycastHit> closestHit;
-    float                     closestDistance = std::numeric_limits<float>::max();
+    auto& registry = scene->getRegistry();
 
-    // Helper lambda to test mesh component (works for MeshComponent, StaticMeshComponent, SkinnedMeshComponent)
-    auto testMeshComponent = [&](entt::entity entityHandle, TransformComponent &tc, auto &meshComp) {
-        Mesh* mesh = meshComp.getMesh();
-        if (!mesh) {
-            return;
-        }
+    // Broad phase through the scene's spatial index, synced first so entities
+    // spawned or moved since the last system update are found; candidates are
+    // refined against their tight world AABB.
+    // TODO: how to apply material's logic transform to the mesh in the world?
+    //      经过材质处理，mesh的实际大小位置可能发生变化
+    SceneSpatialIndexSystem::syncScene(*scene);
 
-        // Get world transform
-        glm::mat4 worldTransform = tc.getTransform();
-
-        auto worldAABB = mesh->boundingBox.transformed(worldTransform);
-
-        // Test ray-AABB intersection
-        float distance = 0.0f;
-        if (ray.intersects(worldAABB, &distance))
-        {
-            // Check if this is the closest hit
-            if (distance < closestDistance)
-            {
-                closestDistance = distance;
-                closestHit      = RaycastHit{
-                         .entity   = scene->getEntityByEnttID(entityHandle),
-                         .distance = distance,
-                         .point    = ray.origin + ray.direction * distance,
-                };
-            }
+    auto exactTest = [&](entt::entity handle, float& outDistance) {
+        const auto* tc = registry.try_get<TransformComponent>(handle);
+        if (!tc) {
+            return false;
+        }
+        const Mesh* mesh = nullptr;
+        if (const auto* staticMesh = registry.try_get<StaticMeshComponent>(handle)) {
+            mesh = staticMesh->getMesh();
+        }
+        else if (const auto* skinnedMesh = registry.try_get<SkinnedMeshComponent>(handle)) {
+            mesh = skinnedMesh->getMesh();
         }
+        return mesh && ray.intersects(mesh->boundingBox.transformed(tc->getTransform()), &outDistance);
     };
 
-    // TODO: how to apply material's logic transform to the mesh in the world?
-    //      经过材质处理，mesh的实际大小位置可能发生变化
-    // Check all entities with any mesh component type
-    auto& registry = scene->getRegistry();
-    registry.view<StaticMeshComponent, TransformComponent>().each(
-        [&](entt::entity handle, StaticMeshComponent &mc, TransformComponent &tc) {
-            testMeshComponent(handle, tc, mc);
-        });
-    registry.view<SkinnedMeshComponent, TransformComponent>().each(
-        [&](entt::entity handle, SkinnedMeshComponent &mc, TransformComponent &tc) {
-            testMeshComponent(handle, tc, mc);
-        });
-
-    return closestHit;
+    const auto hit = scene->getSpatialIndex().raycastClosest(ray, std::numeric_limits<float>::max(), exactTest);
+    if (!hit) {
+        return std::nullopt;
+    }
+    return RaycastHit{
+        .entity   = scene->getEntityByEnttID(hit->entity),
+        .distance = hit->distance,
+        .point    = ray.at(hit->distance),
+    };
 }
 
 std::optional<RaycastHit> RayCastMousePickingSystem::raycastBillboards(Scene* scene,
@@ -78,8 +78,8 @@ const char* toString(ERGBufferAccess access)
     return "<unknown>";
 }
 
-template <typename UsageT>
-bool containsUsage(const std::vector<UsageT>& usages, const UsageT& needle)
+template <typename ContainerT, typename UsageT>
+bool containsUsage(const ContainerT& usages, const UsageT& needle)
 {
     return std::find(usages.begin(), usages.end(), needle) != usages.end();
 }
@@ -576,6 +576,19 @@ void retainResolvedRenderTexture(ICommandBuffer& cmdBuf, const RenderTexture& im
     cmdBuf.retainResources(image.getRetainedResources());
 }
 
+void collectAttachmentTransitions(const RenderingInfo&                              info,
+                                  bool                                              bEnd,
+                                  std::vector<RGAttachmentTransitions::Transition>& out)
+{
+    forEachRenderingLayoutTransition(info, bEnd, [&out](IImage* image, EImageLayout::T layout, const ImageSubresourceRange* range) {
+        out.push_back({
+            .image  = image,
+            .layout = layout,
+            .range  = range ? std::optional(*range) : std::nullopt,
+        });
+    });
+}
+
 } // namespace
 
 const RGTextureResource& RGPassContext::getTexture(RGTextureHandle handle) const
@@ -852,15 +865,27 @@ void RGRenderContext::beginRasterRendering(const RasterRenderingDesc& desc) cons
     }
 
     _activeRenderingInfo = RenderingInfo{
-        .label       = _pass.name,
-        .attachments = std::move(attachments),
+        .label                         = _pass.name,
+        .bExternalTransitionManagement = _attachmentTransitions != nullptr,
+        .attachments                   = std::move(attachments),
     };
+    if (_attachmentTransitions) {
+        // Every begin transition is hoisted in front of the secondary, so a
+        // scope may not follow one that already moved its attachments on.
+        YA_CORE_ASSERT(_attachmentTransitions->after.empty(),
+                       "RGRenderContext pass {} opens a second rendering scope in a secondary command buffer",
+                       _pass.name);
+        collectAttachmentTransitions(*_activeRenderingInfo, false, _attachmentTransitions->before);
+    }
     _cmdBuf.beginRendering(*_activeRenderingInfo);
 }
 
 void RGRenderContext::endRendering() const
 {
     _cmdBuf.endRendering(_activeRenderingInfo.value_or(RenderingInfo{}));
+    if (_attachmentTransitions && _activeRenderingInfo) {
+        collectAttachmentTransitions(*_activeRenderingInfo, true, _attachmentTransitions->after);
+    }
     _activeRenderingInfo.reset();
 }
 
@@ -982,6 +1007,11 @@ void RGPassBuilder::declareCopy()
     pass().kind = ERGPassKind::Copy;
 }
 
+void RGPassBuilder::allowParallelRecording()
+{
+    pass().bParallelRecording = true;
+}
+
 void RGPassBuilder::declareRaster(const RGRasterPassDesc& desc)
 {
     auto& currentPass      = pass();
@@ -1131,23 +1161,20 @@ const RGPass* RenderGraph::getPass(RGPassHandle handle) const
     return findResource(_passes, handle);
 }
 
-RGPassHandle RenderGraph::addPass(
-    const std::string&                           name,
-    const std::function<void(RGPassBuilder&)>&   setup,
-    const std::function<void(RGRenderContext&)>& execute)
+RGPassHandle RenderGraph::beginPass(std::string_view name, RGPassCallback execute)
 {
     RGPassHandle handle{
         .index      = static_cast<uint32_t>(_passes.size()),
         .generation = _nextPassGeneration++,
     };
     _passes.push_back(RGPass{
-        .handle  = handle,
-        .name    = name,
-        .execute = execute,
+        .handle       = handle,
+        .name         = std::pmr::string(name, _resource),
+        .textures     = std::pmr::vector<RGTextureUsage>(_resource),
+        .buffers      = std::pmr::vector<RGBufferUsage>(_resource),
+        .dependencies = std::pmr::vector<RGPassHandle>(_resource),
+        .execute      = std::move(execute),
     });
-
-    RGPassBuilder builder(*this, _passes.size() - 1);
-    setup(builder);
     return handle;
 }
 
@@ -1174,21 +1201,23 @@ RGCompiledGraph RenderGraph::compile() const
     struct TrackedTextureAccess
     {
         std::optional<RGPassHandle> writer{};
-        std::vector<RGPassHandle>   readers{};
+        std::pmr::vector<RGPassHandle> readers{};
     };
-    std::unordered_map<RGTextureHandle, TrackedTextureAccess> textureAccesses;
+    // Scratch below lives in the graph's memory resource (the frame arena in
+    // the pipelines); only the returned RGCompiledGraph uses the heap.
+    std::pmr::unordered_map<RGTextureHandle, TrackedTextureAccess> textureAccesses(_resource);
     struct TrackedBufferAccess
     {
         RGPassHandle    pass{};
         RGBufferRange   range{};
         ERGBufferAccess access = ERGBufferAccess::StorageRead;
     };
-    std::unordered_map<RGBufferHandle, std::vector<TrackedBufferAccess>> bufferAccesses;
-    std::unordered_map<std::string, const RGTextureResource*>            persistentTexturesByKey;
-    std::unordered_map<std::string, const RGBufferResource*>             persistentBuffersByKey;
-    std::vector<std::vector<uint32_t>>                                   adjacency(_passes.size());
-    std::vector<uint32_t>                                                indegree(_passes.size(), 0);
-    std::vector<RGCompiledPassPlan>                                      passPlans(_passes.size());
+    std::pmr::unordered_map<RGBufferHandle, std::pmr::vector<TrackedBufferAccess>> bufferAccesses(_resource);
+    std::pmr::unordered_map<std::string_view, const RGTextureResource*>            persistentTexturesByKey(_resource);
+    std::pmr::unordered_map<std::string_view, const RGBufferResource*>             persistentBuffersByKey(_resource);
+    std::pmr::vector<std::pmr::vector<uint32_t>>                                   adjacency(_passes.size(), _resource);
+    std::pmr::vector<uint32_t>                                                     indegree(_passes.size(), 0, _resource);
+    std::vector<RGCompiledPassPlan>                                                passPlans(_passes.size());
 
     for (size_t i = 0; i < _passes.size(); ++i) {
         passPlans[i].pass       = _passes[i].handle;
@@ -1540,7 +1569,7 @@ RGCompiledGraph RenderGraph::compile() const
         persistentBuffersByKey.emplace(buffer.persistentKey->value, &buffer);
     }
 
-    std::unordered_set<std::string> exportedTextureNames;
+    std::pmr::unordered_set<std::string_view> exportedTextureNames(_resource);
     exportedTextureNames.reserve(_textureExports.size());
     for (const auto& exported : _textureExports) {
         const auto* resource = getTexture(exported.texture);
@@ -1562,7 +1591,7 @@ RGCompiledGraph RenderGraph::compile() const
         });
     }
 
-    std::deque<uint32_t> ready;
+    std::pmr::deque<uint32_t> ready(_resource);
     for (uint32_t i = 0; i < indegree.size(); ++i) {
         if (indegree[i] == 0) {
             ready.push_back(i);
@@ -1574,7 +1603,7 @@ RGCompiledGraph RenderGraph::compile() const
         ready.pop_front();
         compiled.order.push_back(_passes[index].handle);
 
-        auto neighbors = adjacency[index];
+        auto& neighbors = adjacency[index];
         std::sort(neighbors.begin(), neighbors.end());
         for (const auto next : neighbors) {
             if (--indegree[next] == 0) {
@@ -10,9 +10,14 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory_resource>
+#include <new>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace ya
@@ -216,16 +221,97 @@ struct RGRasterPassDesc
     std::optional<RGDepthAttachmentDesc> depth{};
 };
 
+class RGRenderContext;
+
+/**
+ * @brief Move-only pass execute callback stored in the graph's memory resource
+ *
+ * Stands in for std::function so capturing lambdas do not hit the heap when
+ * the graph is backed by an RGFrameArena. The callable is destroyed (and its
+ * storage returned to the resource) with the callback.
+ */
+class RGPassCallback
+{
+  public:
+    RGPassCallback() = default;
+
+    template <typename F>
+    RGPassCallback(F&& callable, std::pmr::memory_resource* resource)
+    {
+        using Callable = std::decay_t<F>;
+        void* storage  = resource->allocate(sizeof(Callable), alignof(Callable));
+        _object        = ::new (storage) Callable(std::forward<F>(callable));
+        _resource      = resource;
+        _invoke        = [](void* object, RGRenderContext& ctx) {
+            (*static_cast<Callable*>(object))(ctx);
+        };
+        _destroy = [](void* object, std::pmr::memory_resource* owner) {
+            static_cast<Callable*>(object)->~Callable();
+            owner->deallocate(object, sizeof(Callable), alignof(Callable));
+        };
+    }
+
+    RGPassCallback(RGPassCallback&& other) noexcept
+    {
+        steal(other);
+    }
+
+    RGPassCallback& operator=(RGPassCallback&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            steal(other);
+        }
+        return *this;
+    }
+
+    RGPassCallback(const RGPassCallback&)            = delete;
+    RGPassCallback& operator=(const RGPassCallback&) = delete;
+
+    ~RGPassCallback() { reset(); }
+
+    void reset()
+    {
+        if (_destroy) {
+            _destroy(_object, _resource);
+        }
+        _object   = nullptr;
+        _resource = nullptr;
+        _invoke   = nullptr;
+        _destroy  = nullptr;
+    }
+
+    explicit operator bool() const { return _invoke != nullptr; }
+
+    void operator()(RGRenderContext& ctx) const { _invoke(_object, ctx); }
+
+  private:
+    void steal(RGPassCallback& other)
+    {
+        _object         = std::exchange(other._object, nullptr);
+        _resource       = std::exchange(other._resource, nullptr);
+        _invoke         = std::exchange(other._invoke, nullptr);
+        _destroy        = std::exchange(other._destroy, nullptr);
+    }
+
+    void*                      _object   = nullptr;
+    std::pmr::memory_resource* _resource = nullptr;
+    void (*_invoke)(void*, RGRenderContext&)             = nullptr;
+    void (*_destroy)(void*, std::pmr::memory_resource*) = nullptr;
+};
+
+/// Declaration containers live in the owning graph's memory resource.
 struct RGPass
 {
-    RGPassHandle                handle{};
-    std::string                 name;
-    ERGPassKind                 kind = ERGPassKind::Unknown;
-    std::vector<RGTextureUsage> textures;
-    std::vector<RGBufferUsage>  buffers;
-    std::vector<RGPassHandle>   dependencies;
-    std::optional<RGRasterPassDesc> rasterDesc{};
-    std::function<void(class RGRenderContext&)> execute;
+    RGPassHandle                     handle{};
+    std::pmr::string                 name;
+    ERGPassKind                      kind = ERGPassKind::Unknown;
+    std::pmr::vector<RGTextureUsage> textures;
+    std::pmr::vector<RGBufferUsage>  buffers;
+    std::pmr::vector<RGPassHandle>   dependencies;
+    std::optional<RGRasterPassDesc>  rasterDesc{};
+    RGPassCallback                   execute;
+    bool                             bParallelRecording = false; // See RGPassBuilder::allowParallelRecording
 };
 
 struct RGDependencyEdge
@@ -434,6 +520,33 @@ class RGPassContext
     [[nodiscard]] YA_RENDER_GRAPH_API const RGBufferDesc& getBufferDesc(RGBufferHandle handle) const;
 };
 
+/**
+ * @brief Attachment layout transitions left to the primary command buffer
+ *
+ * A pass recorded into a secondary command buffer cannot resolve old layouts:
+ * those are only known in primary order. Its rendering scopes are begun with
+ * bExternalTransitionManagement and the transitions collected here, which the
+ * executor emits on the primary before and after executing the secondary.
+ */
+struct RGAttachmentTransitions
+{
+    struct Transition
+    {
+        IImage*                              image  = nullptr;
+        EImageLayout::T                      layout = EImageLayout::Undefined;
+        std::optional<ImageSubresourceRange> range;
+    };
+
+    std::vector<Transition> before;
+    std::vector<Transition> after;
+
+    void clear()
+    {
+        before.clear();
+        after.clear();
+    }
+};
+
 class RGRenderContext
 {
   public:
@@ -486,6 +599,7 @@ class RGRenderContext
     const RenderGraphResourceRegistry& _registry;
     ICommandBuffer&                    _cmdBuf;
     const RGCompiledPassPlan*          _compiledPassPlan = nullptr;
+    RGAttachmentTransitions*           _attachmentTransitions = nullptr; // Set when recording into a secondary
     mutable std::optional<RenderingInfo> _activeRenderingInfo;
 
     [[nodiscard]] YA_RENDER_GRAPH_API const RGTextureUsage* findDeclaredTextureUsage(RGTextureHandle handle) const;
@@ -505,8 +619,10 @@ class RGRenderContext
         const RGPass& pass,
         const RenderGraphResourceRegistry& registry,
         const RGCompiledPassPlan* compiledPassPlan,
-        ICommandBuffer& cmdBuf)
-        : _graph(graph), _pass(pass), _registry(registry), _cmdBuf(cmdBuf), _compiledPassPlan(compiledPassPlan)
+        ICommandBuffer& cmdBuf,
+        RGAttachmentTransitions* attachmentTransitions = nullptr)
+        : _graph(graph), _pass(pass), _registry(registry), _cmdBuf(cmdBuf), _compiledPassPlan(compiledPassPlan),
+          _attachmentTransitions(attachmentTransitions)
     {}
 
     /// Pass-scoped binding helpers.
@@ -599,31 +715,44 @@ class RGPassBuilder
     YA_RENDER_GRAPH_API void declareCompute();
     YA_RENDER_GRAPH_API void declareCopy();
     YA_RENDER_GRAPH_API void declareRaster(const RGRasterPassDesc& desc);
+    /**
+     * @brief Let the executor record this pass on a worker thread
+     *
+     * Only valid when execute() touches nothing but the RGRenderContext's
+     * command buffer and state that is read-only during graph execution.
+     * Barrier placement is unaffected; it does not enter the compiled plan.
+     */
+    YA_RENDER_GRAPH_API void allowParallelRecording();
     YA_RENDER_GRAPH_API void useColorAttachment(RGTextureHandle handle);
     YA_RENDER_GRAPH_API void useDepthAttachment(RGTextureHandle handle);
     YA_RENDER_GRAPH_API void transferSrc(RGTextureHandle handle);
     YA_RENDER_GRAPH_API void transferDst(RGTextureHandle handle);
 };
 
+class RGCompileCache;
+
 class RenderGraph
 {
   private:
+    friend class RGCompileCache;
+
     struct RGTextureExportRequest
     {
         std::string     name;
         RGTextureHandle texture{};
     };
 
+    std::pmr::memory_resource* _resource = nullptr;
     uint32_t _nextTextureGeneration = 1;
     uint32_t _nextBufferGeneration  = 1;
     uint32_t _nextPassGeneration    = 1;
-    std::vector<RGTextureResource> _textures;
-    std::vector<RGBufferResource>  _buffers;
-    std::vector<RGPass>            _passes;
-    std::vector<RGTextureExportRequest> _textureExports;
+    std::pmr::vector<RGTextureResource> _textures;
+    std::pmr::vector<RGBufferResource>  _buffers;
+    std::pmr::vector<RGPass>            _passes;
+    std::pmr::vector<RGTextureExportRequest> _textureExports;
 
     template <typename HandleT, typename ResourceT>
-    static const ResourceT* findResource(const std::vector<ResourceT>& resources, HandleT handle)
+    static const ResourceT* findResource(const std::pmr::vector<ResourceT>& resources, HandleT handle)
     {
         if (!handle.isValid() || handle.index >= resources.size()) {
             return nullptr;
@@ -632,7 +761,46 @@ class RenderGraph
         return resource.handle == handle ? &resource : nullptr;
     }
 
+    template <typename ExecuteFn>
+    RGPassCallback makePassCallback(ExecuteFn&& execute)
+    {
+        using Callable = std::decay_t<ExecuteFn>;
+        if constexpr (std::is_same_v<Callable, RGPassCallback>) {
+            return std::forward<ExecuteFn>(execute);
+        }
+        else {
+            if constexpr (std::is_pointer_v<Callable> ||
+                          std::is_same_v<Callable, std::function<void(RGRenderContext&)>>) {
+                // Empty std::function / null function pointer: no execute body.
+                if (!static_cast<bool>(execute)) {
+                    return {};
+                }
+            }
+            return RGPassCallback(std::forward<ExecuteFn>(execute), _resource);
+        }
+    }
+
+    YA_RENDER_GRAPH_API RGPassHandle beginPass(std::string_view name, RGPassCallback execute);
+
   public:
+    /**
+     * @brief Declaration storage (resources, passes, usage lists, execute callables)
+     * and compile() scratch come from @p resource.
+     *
+     * Pass an RGFrameArena to keep per-frame graph building off the heap; the
+     * resource must outlive the graph.
+     */
+    explicit RenderGraph(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : _resource(resource ? resource : std::pmr::get_default_resource()),
+          _textures(_resource),
+          _buffers(_resource),
+          _passes(_resource),
+          _textureExports(_resource)
+    {}
+
+    RenderGraph(const RenderGraph&)            = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
     [[nodiscard]] YA_RENDER_GRAPH_API RGTextureHandle createTexture(const RGTextureDesc& desc, ERGResourceLifetime lifetime = ERGResourceLifetime::Transient);
     [[nodiscard]] YA_RENDER_GRAPH_API RGTextureHandle createPersistentTexture(const RGTextureDesc& desc, const RGPersistentTextureKey& key);
     [[nodiscard]] YA_RENDER_GRAPH_API RGTextureHandle importTexture(const RGImportedTextureDesc& desc);
@@ -645,19 +813,35 @@ class RenderGraph
     [[nodiscard]] YA_RENDER_GRAPH_API const RGBufferResource* getBuffer(RGBufferHandle handle) const;
     [[nodiscard]] YA_RENDER_GRAPH_API const RGPass* getPass(RGPassHandle handle) const;
 
-    [[nodiscard]] YA_RENDER_GRAPH_API RGPassHandle addPass(
-        const std::string& name,
-        const std::function<void(RGPassBuilder&)>& setup,
-        const std::function<void(RGRenderContext&)>& execute = {});
+    template <typename SetupFn>
+    [[nodiscard]] RGPassHandle addPass(std::string_view name, SetupFn&& setup)
+    {
+        return addPass(name, std::forward<SetupFn>(setup), RGPassCallback{});
+    }
+
+    /**
+     * @brief Declare a pass; the execute callable is stored in the graph's memory resource
+     *
+     * setup runs immediately and is not retained, so it is never copied.
+     */
+    template <typename SetupFn, typename ExecuteFn>
+    [[nodiscard]] RGPassHandle addPass(std::string_view name, SetupFn&& setup, ExecuteFn&& execute)
+    {
+        const RGPassHandle handle = beginPass(name, makePassCallback(std::forward<ExecuteFn>(execute)));
+        RGPassBuilder      builder(*this, handle.index);
+        setup(builder);
+        return handle;
+    }
     [[nodiscard]] YA_RENDER_GRAPH_API RGCompiledGraph compile() const;
     [[nodiscard]] YA_RENDER_GRAPH_API RGTopologyDescription describeCompiledTopology(const RGCompiledGraph& compiled) const;
     [[nodiscard]] YA_RENDER_GRAPH_API std::optional<RGPassContext> createPassContext(RGPassHandle handle) const;
     [[nodiscard]] YA_RENDER_GRAPH_API std::string debugDump(const RGCompiledGraph& compiled) const;
     YA_RENDER_GRAPH_API void exportTexture(RGTextureHandle handle, std::string name);
 
-    [[nodiscard]] const std::vector<RGTextureResource>& getTextures() const { return _textures; }
-    [[nodiscard]] const std::vector<RGBufferResource>& getBuffers() const { return _buffers; }
-    [[nodiscard]] const std::vector<RGPass>& getPasses() const { return _passes; }
+    [[nodiscard]] const std::pmr::vector<RGTextureResource>& getTextures() const { return _textures; }
+    [[nodiscard]] const std::pmr::vector<RGBufferResource>& getBuffers() const { return _buffers; }
+    [[nodiscard]] const std::pmr::vector<RGPass>& getPasses() const { return _passes; }
+    [[nodiscard]] std::pmr::memory_resource* getMemoryResource() const { return _resource; }
 };
 
 } // namespace ya
@@ -0,0 +1,278 @@
+#include "RenderGraphCommandStream.h"
+
+#include <array>
+#include <cstring>
+
+namespace ya
+{
+
+#if !YA_CMDBUF_RECORD_MODE
+
+RGCommandStream::~RGCommandStream()
+{
+    clear();
+}
+
+void RGCommandStream::replay(ICommandBuffer& target)
+{
+    for (const Command& command : _commands) {
+        command.replay(command.object, target);
+    }
+    for (auto& resource : retainedResources) {
+        target.retainResource(std::move(resource));
+    }
+    retainedResources.clear();
+}
+
+void RGCommandStream::clear()
+{
+    for (const Command& command : _commands) {
+        if (command.destroy) {
+            command.destroy(command.object);
+        }
+    }
+    _commands.clear();
+    _storage.reset();
+    _renderingInfoCount = 0;
+    retainedResources.clear();
+}
+
+size_t RGCommandStream::storeRenderingInfo(const RenderingInfo& info)
+{
+    if (_renderingInfoCount < _renderingInfos.size()) {
+        // Copy-assign so the slot's attachment vector and label keep their capacity.
+        _renderingInfos[_renderingInfoCount] = info;
+    }
+    else {
+        _renderingInfos.push_back(info);
+    }
+    return _renderingInfoCount++;
+}
+
+const void* RGCommandStream::copyBytes(const void* data, size_t size, size_t alignment)
+{
+    if (size == 0 || !data) {
+        return nullptr;
+    }
+    void* storage = _storage.allocate(size, alignment);
+    std::memcpy(storage, data, size);
+    return storage;
+}
+
+bool RGCommandStream::generateMipmaps(IImage* image, EImageLayout::T baseLevelLayout, EImageLayout::T finalLayout)
+{
+    record([=](ICommandBuffer& target) { target.generateMipmaps(image, baseLevelLayout, finalLayout); });
+    return true;
+}
+
+void RGCommandStream::bindPipeline(IGraphicsPipeline* pipeline)
+{
+    record([=](ICommandBuffer& target) { target.bindPipeline(pipeline); });
+}
+
+void RGCommandStream::bindComputePipeline(IComputePipeline* pipeline)
+{
+    record([=](ICommandBuffer& target) { target.bindComputePipeline(pipeline); });
+}
+
+void RGCommandStream::bindVertexBuffer(uint32_t binding, const IBuffer* buffer, uint64_t offset)
+{
+    record([=](ICommandBuffer& target) { target.bindVertexBuffer(binding, buffer, offset); });
+}
+
+void RGCommandStream::bindIndexBuffer(IBuffer* buffer, uint64_t offset, bool use16BitIndices)
+{
+    record([=](ICommandBuffer& target) { target.bindIndexBuffer(buffer, offset, use16BitIndices); });
+}
+
+void RGCommandStream::draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+{
+    record([=](ICommandBuffer& target) { target.draw(vertexCount, instanceCount, firstVertex, firstInstance); });
+}
+
+void RGCommandStream::drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+    record([=](ICommandBuffer& target) { target.drawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance); });
+}
+
+void RGCommandStream::setViewport(float x, float y, float width, float height, float minDepth, float maxDepth)
+{
+    record([=](ICommandBuffer& target) { target.setViewport(x, y, width, height, minDepth, maxDepth); });
+}
+
+void RGCommandStream::setScissor(int32_t x, int32_t y, uint32_t width, uint32_t height)
+{
+    record([=](ICommandBuffer& target) { target.setScissor(x, y, width, height); });
+}
+
+void RGCommandStream::setCullMode(ECullMode::T cullMode)
+{
+    record([=](ICommandBuffer& target) { target.setCullMode(cullMode); });
+}
+
+void RGCommandStream::setPolygonMode(EPolygonMode::T polygonMode)
+{
+    record([=](ICommandBuffer& target) { target.setPolygonMode(polygonMode); });
+}
+
+void RGCommandStream::setDepthBias(float constantFactor, float clamp, float slopeFactor)
+{
+    record([=](ICommandBuffer& target) { target.setDepthBias(constantFactor, clamp, slopeFactor); });
+}
+
+void RGCommandStream::bindDescriptorSets(IPipelineLayout*                        pipelineLayout,
+                                         uint32_t                                firstSet,
+                                         const std::vector<DescriptorSetHandle>& descriptorSets,
+                                         const std::vector<uint32_t>&            dynamicOffsets)
+{
+    const auto sets    = copyArray(descriptorSets);
+    const auto offsets = copyArray(dynamicOffsets);
+    record([this, pipelineLayout, firstSet, sets, offsets](ICommandBuffer& target) {
+        _descriptorSetScratch.assign(sets.begin(), sets.end());
+        _dynamicOffsetScratch.assign(offsets.begin(), offsets.end());
+        target.bindDescriptorSets(pipelineLayout, firstSet, _descriptorSetScratch, _dynamicOffsetScratch);
+    });
+}
+
+void RGCommandStream::bindComputeDescriptorSets(IPipelineLayout*                        pipelineLayout,
+                                                uint32_t                                firstSet,
+                                                const std::vector<DescriptorSetHandle>& descriptorSets,
+                                                const std::vector<uint32_t>&            dynamicOffsets)
+{
+    const auto sets    = copyArray(descriptorSets);
+    const auto offsets = copyArray(dynamicOffsets);
+    record([this, pipelineLayout, firstSet, sets, offsets](ICommandBuffer& target) {
+        _descriptorSetScratch.assign(sets.begin(), sets.end());
+        _dynamicOffsetScratch.assign(offsets.begin(), offsets.end());
+        target.bindComputeDescriptorSets(pipelineLayout, firstSet, _descriptorSetScratch, _dynamicOffsetScratch);
+    });
+}
+
+void RGCommandStream::pushConstants(IPipelineLayout* pipelineLayout, EShaderStage::T stages, uint32_t offset, uint32_t size, const void* data)
+{
+    const void* bytes = copyBytes(data, size);
+    record([=](ICommandBuffer& target) { target.pushConstants(pipelineLayout, stages, offset, size, bytes); });
+}
+
+void RGCommandStream::copyBuffer(IBuffer* src, IBuffer* dst, uint64_t size, uint64_t srcOffset, uint64_t dstOffset)
+{
+    record([=](ICommandBuffer& target) { target.copyBuffer(src, dst, size, srcOffset, dstOffset); });
+}
+
+void RGCommandStream::dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+{
+    record([=](ICommandBuffer& target) { target.dispatch(groupCountX, groupCountY, groupCountZ); });
+}
+
+void RGCommandStream::dispatchIndirect(IBuffer* buffer, uint64_t offset)
+{
+    record([=](ICommandBuffer& target) { target.dispatchIndirect(buffer, offset); });
+}
+
+void RGCommandStream::drawIndirect(IBuffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    record([=](ICommandBuffer& target) { target.drawIndirect(buffer, offset, drawCount, stride); });
+}
+
+void RGCommandStream::drawIndexedIndirect(IBuffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    record([=](ICommandBuffer& target) { target.drawIndexedIndirect(buffer, offset, drawCount, stride); });
+}
+
+void RGCommandStream::drawIndexedIndirectCount(IBuffer* drawBuffer, uint64_t drawOffset,
+                                               IBuffer* countBuffer, uint64_t countOffset,
+                                               uint32_t maxDrawCount, uint32_t stride)
+{
+    record([=](ICommandBuffer& target) {
+        target.drawIndexedIndirectCount(drawBuffer, drawOffset, countBuffer, countOffset, maxDrawCount, stride);
+    });
+}
+
+void RGCommandStream::fillBuffer(IBuffer* buffer, uint64_t offset, uint64_t size, uint32_t value)
+{
+    record([=](ICommandBuffer& target) { target.fillBuffer(buffer, offset, size, value); });
+}
+
+void RGCommandStream::bufferMemoryBarrier(IBuffer*           buffer,
+                                          EPipelineStage::T  srcStage,
+                                          EPipelineStage::T  dstStage,
+                                          EResourceAccess::T srcAccess,
+                                          EResourceAccess::T dstAccess,
+                                          uint64_t           offset,
+                                          uint64_t           size)
+{
+    record([=](ICommandBuffer& target) { target.bufferMemoryBarrier(buffer, srcStage, dstStage, srcAccess, dstAccess, offset, size); });
+}
+
+void RGCommandStream::copyBufferToImage(IBuffer* srcBuffer, IImage* dstImage, EImageLayout::T dstImageLayout, const std::vector<BufferImageCopy>& regions)
+{
+    const auto copies = copyArray(regions);
+    record([this, srcBuffer, dstImage, dstImageLayout, copies](ICommandBuffer& target) {
+        _bufferImageCopyScratch.assign(copies.begin(), copies.end());
+        target.copyBufferToImage(srcBuffer, dstImage, dstImageLayout, _bufferImageCopyScratch);
+    });
+}
+
+void RGCommandStream::copyImage(IImage* srcImage, EImageLayout::T srcImageLayout, IImage* dstImage, EImageLayout::T dstImageLayout, const std::vector<ImageCopy>& regions)
+{
+    const auto copies = copyArray(regions);
+    record([this, srcImage, srcImageLayout, dstImage, dstImageLayout, copies](ICommandBuffer& target) {
+        _imageCopyScratch.assign(copies.begin(), copies.end());
+        target.copyImage(srcImage, srcImageLayout, dstImage, dstImageLayout, _imageCopyScratch);
+    });
+}
+
+void RGCommandStream::copyImageToBuffer(IImage* srcImage, EImageLayout::T srcImageLayout, IBuffer* dstBuffer, const std::vector<BufferImageCopy>& regions)
+{
+    const auto copies = copyArray(regions);
+    record([this, srcImage, srcImageLayout, dstBuffer, copies](ICommandBuffer& target) {
+        _bufferImageCopyScratch.assign(copies.begin(), copies.end());
+        target.copyImageToBuffer(srcImage, srcImageLayout, dstBuffer, _bufferImageCopyScratch);
+    });
+}
+
+void RGCommandStream::beginRendering(const RenderingInfo& info)
+{
+    const size_t slot = storeRenderingInfo(info);
+    record([this, slot](ICommandBuffer& target) { target.beginRendering(_renderingInfos[slot]); });
+}
+
+void RGCommandStream::endRendering(const RenderingInfo& info)
+{
+    const size_t slot = storeRenderingInfo(info);
+    record([this, slot](ICommandBuffer& target) { target.endRendering(_renderingInfos[slot]); });
+}
+
+void RGCommandStream::transitionImageLayout(IImage* image, EImageLayout::T oldLayout, EImageLayout::T newLayout, const ImageSubresourceRange* subresourceRange)
+{
+    const std::optional<ImageSubresourceRange> range = subresourceRange ? std::optional(*subresourceRange) : std::nullopt;
+    record([=](ICommandBuffer& target) { target.transitionImageLayout(image, oldLayout, newLayout, range ? &*range : nullptr); });
+}
+
+void RGCommandStream::transitionImageLayoutAuto(IImage* image, EImageLayout::T newLayout, const ImageSubresourceRange* subresourceRange)
+{
+    // Old layouts are resolved by the target's state tracker at replay, in
+    // primary-stream order, not against this stream.
+    const std::optional<ImageSubresourceRange> range = subresourceRange ? std::optional(*subresourceRange) : std::nullopt;
+    record([=](ICommandBuffer& target) { target.transitionImageLayoutAuto(image, newLayout, range ? &*range : nullptr); });
+}
+
+void RGCommandStream::debugBeginLabel(const char* labelName, const float* colorRGBA)
+{
+    const auto* label = static_cast<const char*>(copyBytes(labelName, labelName ? std::strlen(labelName) + 1 : 0, 1));
+    std::optional<std::array<float, 4>> color;
+    if (colorRGBA) {
+        color.emplace();
+        std::memcpy(color->data(), colorRGBA, sizeof(float) * 4);
+    }
+    record([=](ICommandBuffer& target) { target.debugBeginLabel(label, color ? color->data() : nullptr); });
+}
+
+void RGCommandStream::debugEndLabel()
+{
+    record([](ICommandBuffer& target) { target.debugEndLabel(); });
+}
+
+#endif // !YA_CMDBUF_RECORD_MODE
+
+} // namespace ya
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "RHI/Core/CommandBuffer.h"
+#include "Core/Api.h"
+#include "Graph/RenderGraphFrameArena.h"
+
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ya
+{
+
+#if !YA_CMDBUF_RECORD_MODE
+
+/**
+ * @brief Backend-neutral deferred command list for off-thread pass recording
+ *
+ * Implements ICommandBuffer by storing every call as a small closure in an
+ * RGFrameArena; replay() re-issues the calls in order on a real command
+ * buffer. The render graph executor records parallel-safe passes into one
+ * stream each on worker threads and replays them on the render thread, so the
+ * primary command stream (including barriers and tracked layout transitions,
+ * which the backend resolves at replay) is identical to serial recording.
+ *
+ * Array arguments (descriptor sets, copy regions) are copied into the arena
+ * and rendering infos into a reused slot array, so recording does not
+ * allocate once the stream is warm; replay hands arrays to the target through
+ * member scratch vectors. A stream is owned by one thread at a time. clear()
+ * keeps all capacity for the next frame.
+ */
+class YA_RENDER_GRAPH_API RGCommandStream final : public ICommandBuffer
+{
+  public:
+    RGCommandStream() = default;
+    ~RGCommandStream() override;
+
+    /// Re-issue every recorded command on @p target and hand over retained resources.
+    void replay(ICommandBuffer& target);
+
+    /// Drop recorded commands; storage is kept for reuse.
+    void clear();
+
+    [[nodiscard]] size_t getCommandCount() const { return _commands.size(); }
+    [[nodiscard]] bool   isEmpty() const { return _commands.empty() && retainedResources.empty(); }
+
+    // ── ICommandBuffer ───────────────────────────────────────────────
+    CommandBufferHandle getHandle() const override { return {}; }
+    CommandBufferHandle getTypedHandle() const override { return {}; }
+    bool                begin(bool = false) override { return true; }
+    bool                end() override { return true; }
+    void                reset() override { clear(); }
+
+    /// Recorded like any other command; the replay result is not observable,
+    /// so this always reports success to the recording pass.
+    bool generateMipmaps(IImage* image, EImageLayout::T baseLevelLayout, EImageLayout::T finalLayout) override;
+
+    void bindPipeline(IGraphicsPipeline* pipeline) override;
+    void bindComputePipeline(IComputePipeline* pipeline) override;
+    void bindVertexBuffer(uint32_t binding, const IBuffer* buffer, uint64_t offset = 0) override;
+    void bindIndexBuffer(IBuffer* buffer, uint64_t offset = 0, bool use16BitIndices = false) override;
+    void draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
+    void drawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) override;
+    void setViewport(float x, float y, float width, float height, float minDepth = 0.0f, float maxDepth = 1.0f) override;
+    void setScissor(int32_t x, int32_t y, uint32_t width, uint32_t height) override;
+    void setCullMode(ECullMode::T cullMode) override;
+    void setPolygonMode(EPolygonMode::T polygonMode) override;
+    void setDepthBias(float constantFactor, float clamp, float slopeFactor) override;
+    void bindDescriptorSets(IPipelineLayout*                        pipelineLayout,
+                            uint32_t                                firstSet,
+                            const std::vector<DescriptorSetHandle>& descriptorSets,
+                            const std::vector<uint32_t>&            dynamicOffsets = {}) override;
+    void bindComputeDescriptorSets(IPipelineLayout*                        pipelineLayout,
+                                   uint32_t                                firstSet,
+                                   const std::vector<DescriptorSetHandle>& descriptorSets,
+                                   const std::vector<uint32_t>&            dynamicOffsets = {}) override;
+    void pushConstants(IPipelineLayout* pipelineLayout, EShaderStage::T stages, uint32_t offset, uint32_t size, const void* data) override;
+    void copyBuffer(IBuffer* src, IBuffer* dst, uint64_t size, uint64_t srcOffset = 0, uint64_t dstOffset = 0) override;
+    void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
+    void dispatchIndirect(IBuffer* buffer, uint64_t offset = 0) override;
+    void drawIndirect(IBuffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride) override;
+    void drawIndexedIndirect(IBuffer* buffer, uint64_t offset, uint32_t drawCount, uint32_t stride) override;
+    void drawIndexedIndirectCount(IBuffer* drawBuffer, uint64_t drawOffset,
+                                  IBuffer* countBuffer, uint64_t countOffset,
+                                  uint32_t maxDrawCount, uint32_t stride) override;
+    void fillBuffer(IBuffer* buffer, uint64_t offset, uint64_t size, uint32_t value) override;
+    void bufferMemoryBarrier(IBuffer*           buffer,
+                             EPipelineStage::T  srcStage,
+                             EPipelineStage::T  dstStage,
+                             EResourceAccess::T srcAccess,
+                             EResourceAccess::T dstAccess,
+                             uint64_t           offset = 0,
+                             uint64_t           size   = 0) override;
+    void copyBufferToImage(IBuffer* srcBuffer, IImage* dstImage, EImageLayout::T dstImageLayout, const std::vector<BufferImageCopy>& regions) override;
+    void copyImage(IImage* srcImage, EImageLayout::T srcImageLayout, IImage* dstImage, EImageLayout::T dstImageLayout, const std::vector<ImageCopy>& regions) override;
+    void copyImageToBuffer(IImage* srcImage, EImageLayout::T srcImageLayout, IBuffer* dstBuffer, const std::vector<BufferImageCopy>& regions) override;
+    void beginRendering(const RenderingInfo& info) override;
+    void endRendering(const RenderingInfo& info = {}) override;
+    void transitionImageLayout(IImage* image, EImageLayout::T oldLayout, EImageLayout::T newLayout, const ImageSubresourceRange* subresourceRange = nullptr) override;
+    void transitionImageLayoutAuto(IImage* image, EImageLayout::T newLayout, const ImageSubresourceRange* subresourceRange = nullptr) override;
+    void debugBeginLabel(const char* labelName, const float* colorRGBA = nullptr) override;
+    void debugEndLabel() override;
+
+  private:
+    struct Command
+    {
+        void (*replay)(const void* object, ICommandBuffer& target) = nullptr;
+        void (*destroy)(void* object)                              = nullptr; // Null when trivially destructible
+        void* object                                               = nullptr;
+    };
+
+    template <typename F>
+    void record(F&& fn)
+    {
+        using Fn      = std::decay_t<F>;
+        void* storage = _storage.allocate(sizeof(Fn), alignof(Fn));
+        Command command{
+            .replay = [](const void* object, ICommandBuffer& target) { (*static_cast<const Fn*>(object))(target); },
+            .object = ::new (storage) Fn(std::forward<F>(fn)),
+        };
+        if constexpr (!std::is_trivially_destructible_v<Fn>) {
+            command.destroy = [](void* object) { static_cast<Fn*>(object)->~Fn(); };
+        }
+        _commands.push_back(command);
+    }
+
+    /// Copy @p size bytes into the stream's storage (push constants, labels, ...).
+    const void* copyBytes(const void* data, size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    std::span<const T> copyArray(const std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return {static_cast<const T*>(copyBytes(values.data(), values.size() * sizeof(T), alignof(T))), values.size()};
+    }
+
+    /// Copy @p info into the next rendering info slot; returns its index.
+    size_t storeRenderingInfo(const RenderingInfo& info);
+
+    RGFrameArena                     _storage{16 * 1024};
+    std::vector<Command>             _commands;
+    std::vector<RenderingInfo>       _renderingInfos; // Slots reused across clear()
+    size_t                           _renderingInfoCount = 0;
+    // Replay-side views of arena arrays for the vector-taking target API.
+    std::vector<DescriptorSetHandle> _descriptorSetScratch;
+    std::vector<uint32_t>            _dynamicOffsetScratch;
+    std::vector<BufferImageCopy>     _bufferImageCopyScratch;
+    std::vector<ImageCopy>           _imageCopyScratch;
+};
+
+#endif // !YA_CMDBUF_RECORD_MODE
+
+} // namespace ya
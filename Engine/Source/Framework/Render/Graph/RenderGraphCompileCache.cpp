@@ -0,0 +1,290 @@
+#include "RenderGraphCompileCache.h"
+
+#include <chrono>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ya
+{
+
+namespace
+{
+
+/// Appends compile() inputs as raw bytes. Strings are length-prefixed so
+/// adjacent fields cannot run into each other.
+class SignatureWriter
+{
+  public:
+    explicit SignatureWriter(std::vector<uint8_t>& out)
+        : _out(out)
+    {}
+
+    template <typename T>
+    void value(T v)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "SignatureWriter only writes scalars");
+        const size_t offset = _out.size();
+        _out.resize(offset + sizeof(T));
+        std::memcpy(_out.data() + offset, &v, sizeof(T));
+    }
+
+    void string(std::string_view s)
+    {
+        value(static_cast<uint32_t>(s.size()));
+        _out.insert(_out.end(), s.begin(), s.end());
+    }
+
+    template <typename Tag>
+    void handle(const RGHandle<Tag>& h)
+    {
+        value(h.index);
+        value(h.generation);
+    }
+
+    void extent(const Extent3D& e)
+    {
+        value(e.width);
+        value(e.height);
+        value(e.depth);
+    }
+
+    void range(const ImageSubresourceRange& r)
+    {
+        value(r.aspectMask);
+        value(r.baseMipLevel);
+        value(r.levelCount);
+        value(r.baseArrayLayer);
+        value(r.layerCount);
+    }
+
+    void state(const BufferResourceState& s)
+    {
+        value(s.stages);
+        value(s.access);
+        value(s.offset);
+        value(s.size);
+    }
+
+    void clearValue(const ClearValue& c)
+    {
+        value(c.isDepthStencil);
+        if (c.isDepthStencil) {
+            value(c.depthStencil.depth);
+            value(c.depthStencil.stencil);
+        }
+        else {
+            value(c.color.r);
+            value(c.color.g);
+            value(c.color.b);
+            value(c.color.a);
+        }
+    }
+
+    void textureDesc(const RGTextureDesc& desc)
+    {
+        string(desc.label);
+        value(desc.format);
+        extent(desc.extent);
+        value(desc.mipLevels);
+        value(desc.arrayLayers);
+        value(desc.samples);
+        value(desc.usage);
+        value(desc.flags);
+    }
+
+    void bufferDesc(const RGBufferDesc& desc)
+    {
+        string(desc.label);
+        value(desc.usage);
+        value(desc.size);
+        value(desc.memoryUsage);
+        value(desc.alignment);
+    }
+
+    void rasterDesc(const RGRasterPassDesc& desc)
+    {
+        value(desc.renderArea.offset.x);
+        value(desc.renderArea.offset.y);
+        value(desc.renderArea.extent.x);
+        value(desc.renderArea.extent.y);
+        value(desc.layerCount);
+        value(static_cast<uint32_t>(desc.colors.size()));
+        for (const auto& color : desc.colors) {
+            handle(color.color);
+            handle(color.resolve);
+            value(color.resolveMode);
+            clearValue(color.clearValue);
+            value(color.loadOp);
+            value(color.storeOp);
+            value(color.finalLayout);
+        }
+        value(desc.depth.has_value());
+        if (desc.depth) {
+            handle(desc.depth->depth);
+            clearValue(desc.depth->clearValue);
+            value(desc.depth->loadOp);
+            value(desc.depth->storeOp);
+            value(desc.depth->finalLayout);
+        }
+    }
+
+  private:
+    std::vector<uint8_t>& _out;
+};
+
+uint64_t hashSignature(const std::vector<uint8_t>& bytes)
+{
+    // FNV-1a; the signature is also compared byte for byte, so this only
+    // needs to reject mismatches quickly.
+    uint64_t hash = 14695981039346656037ull;
+    for (const uint8_t byte : bytes) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+void RGCompileCache::writeSignature(const RenderGraph& graph, std::vector<uint8_t>& out)
+{
+    out.clear();
+    SignatureWriter writer(out);
+
+    // Imported backing objects (native handles, ImageResource, IBuffer*) are
+    // deliberately left out: they are rebound every frame by the registry.
+    writer.value(static_cast<uint32_t>(graph._textures.size()));
+    for (const auto& texture : graph._textures) {
+        writer.handle(texture.handle);
+        writer.value(texture.lifetime);
+        writer.string(texture.persistentKey ? std::string_view(texture.persistentKey->value) : std::string_view{});
+        writer.textureDesc(texture.desc);
+        writer.value(texture.imported.has_value());
+        if (!texture.imported) {
+            continue;
+        }
+        const auto& importDesc = texture.imported->importDesc;
+        writer.value(importDesc.usage);
+        writer.value(importDesc.initialLayout);
+        writer.value(importDesc.finalLayout);
+        writer.value(texture.imported->subresourceRange.has_value());
+        if (texture.imported->subresourceRange) {
+            writer.range(*texture.imported->subresourceRange);
+        }
+        writer.value(texture.imported->viewDesc.has_value());
+        if (texture.imported->viewDesc) {
+            const auto& viewDesc = *texture.imported->viewDesc;
+            writer.value(viewDesc.aspectFlags);
+            writer.value(viewDesc.baseMipLevel);
+            writer.value(viewDesc.levelCount);
+            writer.value(viewDesc.baseArrayLayer);
+            writer.value(viewDesc.layerCount);
+        }
+    }
+
+    writer.value(static_cast<uint32_t>(graph._buffers.size()));
+    for (const auto& buffer : graph._buffers) {
+        writer.handle(buffer.handle);
+        writer.value(buffer.lifetime);
+        writer.string(buffer.persistentKey ? std::string_view(buffer.persistentKey->value) : std::string_view{});
+        writer.bufferDesc(buffer.desc);
+        writer.value(buffer.imported.has_value());
+        if (!buffer.imported) {
+            continue;
+        }
+        // compile() validates accesses against the backing buffer's usage.
+        writer.value(buffer.imported->buffer ? buffer.imported->buffer->getUsage() : EBufferUsage::None);
+        writer.state(buffer.imported->initialState);
+        writer.value(buffer.imported->finalState.has_value());
+        if (buffer.imported->finalState) {
+            writer.state(*buffer.imported->finalState);
+        }
+    }
+
+    writer.value(static_cast<uint32_t>(graph._passes.size()));
+    for (const auto& pass : graph._passes) {
+        writer.handle(pass.handle);
+        writer.string(pass.name);
+        writer.value(pass.kind);
+        writer.value(static_cast<uint32_t>(pass.textures.size()));
+        for (const auto& usage : pass.textures) {
+            writer.handle(usage.handle);
+            writer.value(usage.access);
+        }
+        writer.value(static_cast<uint32_t>(pass.buffers.size()));
+        for (const auto& usage : pass.buffers) {
+            writer.handle(usage.handle);
+            writer.value(usage.access);
+            writer.value(usage.range.offset);
+            writer.value(usage.range.size);
+        }
+        writer.value(static_cast<uint32_t>(pass.dependencies.size()));
+        for (const auto& dependency : pass.dependencies) {
+            writer.handle(dependency);
+        }
+        writer.value(pass.rasterDesc.has_value());
+        if (pass.rasterDesc) {
+            writer.rasterDesc(*pass.rasterDesc);
+        }
+    }
+
+    writer.value(static_cast<uint32_t>(graph._textureExports.size()));
+    for (const auto& exported : graph._textureExports) {
+        writer.string(exported.name);
+        writer.handle(exported.texture);
+    }
+}
+
+const RGCompiledGraph& RGCompileCache::compile(const RenderGraph& graph)
+{
+    using Clock      = std::chrono::steady_clock;
+    const auto start = Clock::now();
+
+    _stats.bLastHit = false;
+    if (_bEnabled) {
+        writeSignature(graph, _scratch);
+        const uint64_t hash = hashSignature(_scratch);
+        _stats.lastSignatureHash = hash;
+        _stats.lastSignatureSize = static_cast<uint32_t>(_scratch.size());
+
+        if (_bHasCached && hash == _signatureHash && _scratch == _signature) {
+            _stats.bLastHit = true;
+            ++_stats.hitCount;
+        }
+        else {
+            _compiled      = graph.compile();
+            _bHasCached    = _compiled.isValid();
+            _signatureHash = hash;
+            std::swap(_signature, _scratch);
+            ++_stats.missCount;
+        }
+    }
+    else {
+        _compiled   = graph.compile();
+        _bHasCached = false;
+        ++_stats.missCount;
+    }
+
+    _stats.lastCompileMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    _stats.totalCompileMs += _stats.lastCompileMs;
+    return _compiled;
+}
+
+void RGCompileCache::invalidate()
+{
+    _bHasCached    = false;
+    _signatureHash = 0;
+    _signature.clear();
+}
+
+void RGCompileCache::setEnabled(bool bEnabled)
+{
+    _bEnabled = bEnabled;
+    if (!bEnabled) {
+        invalidate();
+    }
+}
+
+} // namespace ya
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Graph/RenderGraph.h"
+#include "Core/Api.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ya
+{
+
+struct RGCompileCacheStats
+{
+    uint64_t hitCount          = 0;
+    uint64_t missCount         = 0;
+    uint64_t lastSignatureHash = 0;
+    uint32_t lastSignatureSize = 0;     // Bytes of declared topology hashed by the last compile()
+    bool     bLastHit          = false;
+    double   lastCompileMs     = 0.0;   // Signature + lookup, plus RenderGraph::compile() on a miss
+    double   totalCompileMs    = 0.0;
+};
+
+/**
+ * @brief Reuses the previous RGCompiledGraph while the declared topology is unchanged
+ *
+ * Most frames declare the same passes, resource usages and descriptors, so the
+ * compiled plan (order, dependency edges, state plans, transient lifetimes and
+ * aliasing) comes out identical. compile() serializes everything
+ * RenderGraph::compile() reads into a signature; when it matches the previous
+ * one byte for byte the cached plan is returned without recompiling.
+ *
+ * The plan only refers to graph handles, never to backing objects, so imported
+ * images/buffers that change between frames are rebound by the resource
+ * registry sync as usual. Pass callbacks are not part of the signature.
+ * Invalid graphs are never cached.
+ */
+class YA_RENDER_GRAPH_API RGCompileCache
+{
+  public:
+    /// Compiled plan for `graph`; valid until the next compile() or invalidate().
+    [[nodiscard]] const RGCompiledGraph& compile(const RenderGraph& graph);
+
+    void invalidate();
+
+    void setEnabled(bool bEnabled);
+    [[nodiscard]] bool isEnabled() const { return _bEnabled; }
+
+    [[nodiscard]] const RGCompileCacheStats& getStats() const { return _stats; }
+    void resetStats() { _stats = {}; }
+
+    /// Serialize every compile() input of `graph` into `out` (cleared first).
+    static void writeSignature(const RenderGraph& graph, std::vector<uint8_t>& out);
+
+  private:
+    std::vector<uint8_t> _signature;
+    std::vector<uint8_t> _scratch;
+    uint64_t             _signatureHash = 0;
+    bool                 _bHasCached    = false;
+    bool                 _bEnabled      = true;
+    RGCompiledGraph      _compiled;
+    RGCompileCacheStats  _stats;
+};
+
+} // namespace ya
@@ -1,6 +1,9 @@
 #include "RenderGraphExecutor.h"
 
+#include "Core/Async/JobSystem.h"
+
 #include <algorithm>
+#include <chrono>
 #include <unordered_set>
 
 namespace ya
@@ -34,6 +37,13 @@ bool isTransientAliasBoundary(const RGCompiledGraph& compiled,
                        });
 }
 
+void emitAttachmentTransitions(const std::vector<RGAttachmentTransitions::Transition>& transitions, ICommandBuffer& cmdBuf)
+{
+    for (const auto& transition : transitions) {
+        cmdBuf.transitionImageLayoutAuto(transition.image, transition.layout, transition.range ? &*transition.range : nullptr);
+    }
+}
+
 } // namespace
 
 const BufferResourceState* RenderGraphExecutor::findBufferState(
@@ -74,7 +84,9 @@ bool RenderGraphExecutor::prepare(
 {
     _bufferStates.clear();
 
-    outCompiled = graph.compile();
+    // Identical topology to the previous frame reuses the cached plan;
+    // imported resources are still rebound by the registry sync below.
+    outCompiled = _compileCache.compile(graph);
     if (!outCompiled.isValid()) {
         if (outResult) {
             outResult->clear();
@@ -95,79 +107,51 @@ bool RenderGraphExecutor::executeCompiled(
     const RGCompiledGraph& compiled,
     ICommandBuffer&       cmdBuf)
 {
-    for (const auto& passPlan : compiled.passPlans) {
-        const auto* pass = graph.getPass(passPlan.pass);
-        YA_CORE_ASSERT(pass != nullptr, "RenderGraphExecutor encountered invalid pass handle {}", passPlan.pass.index);
-        std::unordered_set<RGBufferHandle> aliasBoundaryBarriersEmitted;
-
-        for (const auto& statePlan : passPlan.textureStates) {
+    const bool bParallel = _bParallelRecording && JobSystem::get().isRunning();
+    if (_bParallelRecording) {
+        _parallelRecordingStats = {};
+    }
 
-            const auto* texture = _registry.resolveTexture(statePlan.texture);
-            YA_CORE_ASSERT(texture != nullptr, "RenderGraphExecutor failed to resolve texture {}", statePlan.texture.index);
-            YA_CORE_ASSERT(texture->getImage() != nullptr, "RenderGraphExecutor texture {} has no backing image", statePlan.texture.index);
+    // [batchBegin, batchEnd) were pre-recorded into _parallelPasses.
+    size_t batchBegin = 0;
+    size_t batchEnd   = 0;
+    for (size_t i = 0; i < compiled.passPlans.size(); ++i) {
+        const auto& passPlan = compiled.passPlans[i];
+        const auto* pass     = graph.getPass(passPlan.pass);
+        YA_CORE_ASSERT(pass != nullptr, "RenderGraphExecutor encountered invalid pass handle {}", passPlan.pass.index);
 
-            cmdBuf.transitionImageLayoutAuto(
-                texture->getImage(),
-                statePlan.layout,
-                &statePlan.subresourceRange);
+        if (bParallel && i >= batchEnd) {
+            batchBegin = i;
+            batchEnd   = recordParallelBatch(graph, compiled, i);
         }
 
-        for (const auto& statePlan : passPlan.bufferStates) {
+        emitPassBarriers(graph, compiled, passPlan, cmdBuf);
 
-            auto* buffer = _registry.resolveBuffer(statePlan.buffer);
-            YA_CORE_ASSERT(buffer != nullptr, "RenderGraphExecutor failed to resolve buffer {}", statePlan.buffer.index);
-            if (const auto* resource = graph.getBuffer(statePlan.buffer);
-                resource && resource->imported.has_value()) {
-                cmdBuf.retainResources(resource->imported->retainedResources);
-            }
+        if (!pass->execute) {
+            continue;
+        }
 
-            const auto newState = normalizeBufferState(statePlan.requiredState, *buffer);
-            BufferResourceState oldState{};
-            const auto statesIt = _bufferStates.find(buffer);
-            const auto* priorState = statesIt != _bufferStates.end()
-                ? findBufferState(statesIt->second, newState)
-                : nullptr;
-            if (priorState) {
-                oldState = *priorState;
+#if !YA_CMDBUF_RECORD_MODE
+        if (i < batchEnd) {
+            using Clock      = std::chrono::steady_clock;
+            const auto start = Clock::now();
+            auto&      recording = _parallelPasses[i - batchBegin];
+            if (recording.secondary) {
+                emitAttachmentTransitions(recording.transitions.before, cmdBuf);
+                [[maybe_unused]] const bool bExecuted = cmdBuf.executeSecondary(*recording.secondary);
+                YA_CORE_ASSERT(bExecuted, "RenderGraphExecutor could not execute the secondary of pass {}", pass->name);
+                emitAttachmentTransitions(recording.transitions.after, cmdBuf);
+                recording.secondary = nullptr;
             }
-            else if (const auto* resource = graph.getBuffer(statePlan.buffer);
-                     resource && resource->imported.has_value()) {
-                oldState = normalizeBufferState(resource->imported->initialState, *buffer);
-            }
-
-            const bool bAliasBoundary =
-                !aliasBoundaryBarriersEmitted.contains(statePlan.buffer) &&
-                isTransientAliasBoundary(compiled, passPlan.pass, statePlan.buffer);
-            const bool bNeedsBarrier =
-                bAliasBoundary ||
-                oldState.stages != newState.stages ||
-                oldState.access != newState.access ||
-                oldState.offset != newState.offset ||
-                oldState.size != newState.size;
-
-            if (bNeedsBarrier) {
-                const auto barrierOffset = bAliasBoundary ? 0 : newState.offset;
-                const auto barrierSize = bAliasBoundary ? buffer->getSize() : newState.size;
-                cmdBuf.bufferMemoryBarrier(
-                    buffer,
-                    oldState.stages,
-                    newState.stages,
-                    oldState.access,
-                    newState.access,
-                    barrierOffset,
-                    barrierSize);
-                if (bAliasBoundary) {
-                    aliasBoundaryBarriersEmitted.insert(statePlan.buffer);
-                    _bufferStates[buffer].clear();
-                }
+            else {
+                _parallelRecordingStats.recordedCommandCount += recording.stream->getCommandCount();
+                recording.stream->replay(cmdBuf);
+                recording.stream->clear();
             }
-
-            setBufferState(_bufferStates[buffer], newState);
-        }
-
-        if (!pass->execute) {
+            _parallelRecordingStats.replayMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
             continue;
         }
+#endif
 
         RGRenderContext ctx(graph, *pass, _registry, &passPlan, cmdBuf);
         pass->execute(ctx);
@@ -178,6 +162,147 @@ bool RenderGraphExecutor::executeCompiled(
     return true;
 }
 
+void RenderGraphExecutor::emitPassBarriers(
+    const RenderGraph&        graph,
+    const RGCompiledGraph&    compiled,
+    const RGCompiledPassPlan& passPlan,
+    ICommandBuffer&           cmdBuf)
+{
+    std::unordered_set<RGBufferHandle> aliasBoundaryBarriersEmitted;
+
+    for (const auto& statePlan : passPlan.textureStates) {
+
+        const auto* texture = _registry.resolveTexture(statePlan.texture);
+        YA_CORE_ASSERT(texture != nullptr, "RenderGraphExecutor failed to resolve texture {}", statePlan.texture.index);
+        YA_CORE_ASSERT(texture->getImage() != nullptr, "RenderGraphExecutor texture {} has no backing image", statePlan.texture.index);
+
+        cmdBuf.transitionImageLayoutAuto(
+            texture->getImage(),
+            statePlan.layout,
+            &statePlan.subresourceRange);
+    }
+
+    for (const auto& statePlan : passPlan.bufferStates) {
+
+        auto* buffer = _registry.resolveBuffer(statePlan.buffer);
+        YA_CORE_ASSERT(buffer != nullptr, "RenderGraphExecutor failed to resolve buffer {}", statePlan.buffer.index);
+        if (const auto* resource = graph.getBuffer(statePlan.buffer);
+            resource && resource->imported.has_value()) {
+            cmdBuf.retainResources(resource->imported->retainedResources);
+        }
+
+        const auto newState = normalizeBufferState(statePlan.requiredState, *buffer);
+        BufferResourceState oldState{};
+        const auto statesIt = _bufferStates.find(buffer);
+        const auto* priorState = statesIt != _bufferStates.end()
+            ? findBufferState(statesIt->second, newState)
+            : nullptr;
+        if (priorState) {
+            oldState = *priorState;
+        }
+        else if (const auto* resource = graph.getBuffer(statePlan.buffer);
+                 resource && resource->imported.has_value()) {
+            oldState = normalizeBufferState(resource->imported->initialState, *buffer);
+        }
+
+        const bool bAliasBoundary =
+            !aliasBoundaryBarriersEmitted.contains(statePlan.buffer) &&
+            isTransientAliasBoundary(compiled, passPlan.pass, statePlan.buffer);
+        const bool bNeedsBarrier =
+            bAliasBoundary ||
+            oldState.stages != newState.stages ||
+            oldState.access != newState.access ||
+            oldState.offset != newState.offset ||
+            oldState.size != newState.size;
+
+        if (bNeedsBarrier) {
+            const auto barrierOffset = bAliasBoundary ? 0 : newState.offset;
+            const auto barrierSize = bAliasBoundary ? buffer->getSize() : newState.size;
+            cmdBuf.bufferMemoryBarrier(
+                buffer,
+                oldState.stages,
+                newState.stages,
+                oldState.access,
+                newState.access,
+                barrierOffset,
+                barrierSize);
+            if (bAliasBoundary) {
+                aliasBoundaryBarriersEmitted.insert(statePlan.buffer);
+                _bufferStates[buffer].clear();
+            }
+        }
+
+        setBufferState(_bufferStates[buffer], newState);
+    }
+}
+
+size_t RenderGraphExecutor::recordParallelBatch(const RenderGraph& graph, const RGCompiledGraph& compiled, size_t begin)
+{
+#if YA_CMDBUF_RECORD_MODE
+    (void)graph;
+    (void)compiled;
+    return begin;
+#else
+    const auto isParallelSafe = [&](size_t index) {
+        const auto* pass = graph.getPass(compiled.passPlans[index].pass);
+        return pass && pass->execute && pass->bParallelRecording;
+    };
+
+    size_t end = begin;
+    while (end < compiled.passPlans.size() && isParallelSafe(end)) {
+        ++end;
+    }
+    // A lone pass gains nothing from a worker; record it directly.
+    if (end - begin < 2) {
+        return begin;
+    }
+
+    const size_t count = end - begin;
+    if (_parallelPasses.size() < count) {
+        _parallelPasses.resize(count);
+    }
+
+    using Clock      = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    JobSystem::get().parallelFor(static_cast<uint32_t>(count), 1, [&](uint32_t first, uint32_t last) {
+        for (uint32_t offset = first; offset < last; ++offset) {
+            const auto& passPlan  = compiled.passPlans[begin + offset];
+            const auto* pass      = graph.getPass(passPlan.pass);
+            auto&       recording = _parallelPasses[offset];
+            recording.transitions.clear();
+            // The registry is read-only after prepare(), so contexts may resolve concurrently.
+            recording.secondary = _secondaryProvider ? _secondaryProvider() : nullptr;
+            if (recording.secondary) {
+                RGRenderContext ctx(graph, *pass, _registry, &passPlan, *recording.secondary, &recording.transitions);
+                pass->execute(ctx);
+                recording.secondary->end();
+                continue;
+            }
+
+            if (!recording.stream) {
+                recording.stream = std::make_unique<RGCommandStream>();
+            }
+            recording.stream->clear();
+            RGRenderContext ctx(graph, *pass, _registry, &passPlan, *recording.stream);
+            pass->execute(ctx);
+        }
+    });
+    _parallelRecordingStats.recordMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    ++_parallelRecordingStats.batchCount;
+    _parallelRecordingStats.parallelPassCount += static_cast<uint32_t>(count);
+    for (size_t offset = 0; offset < count; ++offset) {
+        _parallelRecordingStats.secondaryPassCount += _parallelPasses[offset].secondary ? 1u : 0u;
+    }
+    return end;
+#endif
+}
+
+void RenderGraphExecutor::setParallelRecording(bool bEnabled)
+{
+    _bParallelRecording = bEnabled;
+    _parallelRecordingStats = {};
+}
+
 void RenderGraphExecutor::finalizeImportedBufferStates(const RGCompiledGraph& compiled, ICommandBuffer& cmdBuf)
 {
     for (const auto& finalize : compiled.importedBufferFinalizes) {
@@ -237,16 +362,13 @@ bool RenderGraphExecutor::execute(
     RGCompiledGraph* outCompiled,
     RenderGraphExecutionResult* outResult)
 {
-    RGCompiledGraph compiled{};
+    // Compile straight into the caller's plan so a retained outCompiled keeps
+    // its capacity across frames instead of taking a second copy.
+    RGCompiledGraph  localCompiled{};
+    RGCompiledGraph& compiled = outCompiled ? *outCompiled : localCompiled;
     if (!prepare(graph, compiled, outResult)) {
-        if (outCompiled) {
-            *outCompiled = compiled;
-        }
         return false;
     }
-    if (outCompiled) {
-        *outCompiled = compiled;
-    }
     if (!executeCompiled(graph, compiled, cmdBuf)) {
         return false;
     }
@@ -265,6 +387,7 @@ void RenderGraphExecutor::clear()
 {
     _bufferStates.clear();
     _registry.clear();
+    _compileCache.invalidate();
 }
 
 } // namespace ya
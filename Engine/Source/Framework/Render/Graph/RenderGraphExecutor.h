@@ -2,19 +2,35 @@
 
 #include "Graph/RenderGraph.h"
 #include "Core/Api.h"
+#include "Graph/RenderGraphCommandStream.h"
+#include "Graph/RenderGraphCompileCache.h"
 #include "Graph/RenderGraphResourceRegistry.h"
 
+#include <functional>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
 namespace ya
 {
 
+/// Last executeCompiled() call with parallel recording enabled.
+struct RGParallelRecordingStats
+{
+    uint32_t batchCount           = 0; // Runs of parallel-safe passes recorded on workers
+    uint32_t parallelPassCount    = 0; // Passes recorded on workers
+    uint32_t secondaryPassCount   = 0; // ... of which into secondary command buffers
+    uint64_t recordedCommandCount = 0; // Commands replayed from command streams
+    double   recordMs             = 0.0; // Wall time of the parallel recording phases
+    double   replayMs             = 0.0; // Render-thread time executing secondaries and replaying streams
+};
+
 class YA_RENDER_GRAPH_API RenderGraphExecutor
 {
   private:
     std::unordered_map<IBuffer*, std::vector<BufferResourceState>> _bufferStates;
     RenderGraphResourceRegistry _registry;
+    RGCompileCache              _compileCache;
 
     [[nodiscard]] static const BufferResourceState* findBufferState(
         const std::vector<BufferResourceState>& states,
@@ -23,6 +39,23 @@ class YA_RENDER_GRAPH_API RenderGraphExecutor
         std::vector<BufferResourceState>& states,
         const BufferResourceState&         state);
 
+    bool                             _bParallelRecording = false;
+    RGParallelRecordingStats         _parallelRecordingStats;
+    std::function<ICommandBuffer*()> _secondaryProvider;
+#if !YA_CMDBUF_RECORD_MODE
+    /// One pass of the current parallel batch: a secondary command buffer
+    /// when the provider handed one out, the command stream otherwise.
+    struct ParallelPassRecording
+    {
+        ICommandBuffer*                  secondary = nullptr;
+        RGAttachmentTransitions          transitions;
+        std::unique_ptr<RGCommandStream> stream;
+    };
+    std::vector<ParallelPassRecording> _parallelPasses; // Reused across frames
+#endif
+
+    void emitPassBarriers(const RenderGraph& graph, const RGCompiledGraph& compiled, const RGCompiledPassPlan& passPlan, ICommandBuffer& cmdBuf);
+    [[nodiscard]] size_t recordParallelBatch(const RenderGraph& graph, const RGCompiledGraph& compiled, size_t begin);
     void finalizeImportedBufferStates(const RGCompiledGraph& compiled, ICommandBuffer& cmdBuf);
     void finalizeImportedTextureStates(const RGCompiledGraph& compiled, ICommandBuffer& cmdBuf);
     void captureExecutionResult(const RGCompiledGraph& compiled, RenderGraphExecutionResult& outResult) const;
@@ -50,7 +83,36 @@ class YA_RENDER_GRAPH_API RenderGraphExecutor
 
     void clear();
 
+    /**
+     * @brief Record runs of consecutive parallel-safe passes on the JobSystem
+     *
+     * Passes that opted in with RGPassBuilder::allowParallelRecording() and sit
+     * next to each other in the compiled order form a batch. Each pass of a
+     * batch is recorded on a worker into a secondary command buffer from the
+     * provider (see setSecondaryCommandBufferProvider()); the render thread
+     * then emits the planned barriers and attachment transitions and executes
+     * the secondaries in compiled order. Without a provider, or when it
+     * returns nullptr, the pass is recorded into an RGCommandStream and
+     * replayed instead. Falls back to serial recording when the JobSystem is
+     * not running.
+     *
+     * Parallel-safe passes must not transition images themselves, and may
+     * open at most one rendering scope.
+     */
+    void setParallelRecording(bool bEnabled);
+
+    /// Hands out a begun secondary command buffer owned by the calling
+    /// worker (e.g. IRender::beginSecondaryCommands()).
+    void setSecondaryCommandBufferProvider(std::function<ICommandBuffer*()> provider)
+    {
+        _secondaryProvider = std::move(provider);
+    }
+    [[nodiscard]] bool isParallelRecording() const { return _bParallelRecording; }
+    [[nodiscard]] const RGParallelRecordingStats& getParallelRecordingStats() const { return _parallelRecordingStats; }
+
     [[nodiscard]] const RenderGraphResourceRegistry& getRegistry() const { return _registry; }
+    [[nodiscard]] RGCompileCache& getCompileCache() { return _compileCache; }
+    [[nodiscard]] const RGCompileCacheStats& getCompileCacheStats() const { return _compileCache.getStats(); }
 };
 
 } // namespace ya
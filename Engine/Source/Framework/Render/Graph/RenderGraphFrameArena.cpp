@@ -0,0 +1,83 @@
+#include "RenderGraphFrameArena.h"
+
+#include <algorithm>
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr size_t kMinBlockSize = 4 * 1024;
+
+} // namespace
+
+RGFrameArena::RGFrameArena(size_t initialCapacity, std::pmr::memory_resource* upstream)
+    : _upstream(upstream ? upstream : std::pmr::new_delete_resource())
+{
+    addBlock(std::max(initialCapacity, kMinBlockSize));
+}
+
+RGFrameArena::~RGFrameArena()
+{
+    releaseBlocks();
+}
+
+void RGFrameArena::reset()
+{
+    // Fold an overflowed frame into one block so the next frame does not
+    // chain through several (or allocate at all).
+    if (_blocks.size() > 1) {
+        const size_t combined = _stats.capacity;
+        releaseBlocks();
+        addBlock(combined);
+    }
+
+    _blockIndex      = 0;
+    _offset          = 0;
+    _stats.bytesUsed = 0;
+    ++_stats.resetCount;
+}
+
+void* RGFrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    for (;;) {
+        const Block&    block   = _blocks[_blockIndex];
+        const uintptr_t base    = reinterpret_cast<uintptr_t>(block.data);
+        const uintptr_t cursor  = base + _offset;
+        const uintptr_t aligned = (cursor + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        if (aligned + bytes <= base + block.size) {
+            _stats.bytesUsed += (aligned + bytes) - cursor;
+            _stats.peakBytesUsed = std::max(_stats.peakBytesUsed, _stats.bytesUsed);
+            _offset              = (aligned + bytes) - base;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        if (_blockIndex + 1 == _blocks.size()) {
+            addBlock(std::max(block.size * 2, bytes + alignment));
+        }
+        ++_blockIndex;
+        _offset = 0;
+    }
+}
+
+void RGFrameArena::addBlock(size_t size)
+{
+    auto* data = static_cast<std::byte*>(_upstream->allocate(size, alignof(std::max_align_t)));
+    _blocks.push_back({.data = data, .size = size});
+    _stats.capacity += size;
+    _stats.blockCount = static_cast<uint32_t>(_blocks.size());
+    ++_stats.upstreamAllocationCount;
+}
+
+void RGFrameArena::releaseBlocks()
+{
+    for (const Block& block : _blocks) {
+        _upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+    }
+    _blocks.clear();
+    _stats.capacity   = 0;
+    _stats.blockCount = 0;
+}
+
+} // namespace ya
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core/Api.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace ya
+{
+
+/**
+ * @brief Per-frame monotonic memory resource for render graph declaration and compile
+ *
+ * Bump-allocates from retained blocks; deallocate() is a no-op and reset()
+ * rewinds everything at once. When a frame overflows into extra blocks,
+ * reset() replaces them with a single block of the combined size, so a steady
+ * frame is served from one block with no upstream allocation.
+ *
+ * Owned by the pipeline that builds the graph; reset() once per frame, after
+ * the previous frame's RenderGraph has been destroyed.
+ */
+class YA_RENDER_GRAPH_API RGFrameArena final : public std::pmr::memory_resource
+{
+  public:
+    struct Stats
+    {
+        size_t   bytesUsed               = 0; // Since the last reset()
+        size_t   peakBytesUsed           = 0;
+        size_t   capacity                = 0;
+        uint32_t blockCount              = 0;
+        uint64_t upstreamAllocationCount = 0;
+        uint64_t resetCount              = 0;
+    };
+
+    static constexpr size_t kDefaultInitialCapacity = 64 * 1024;
+
+    explicit RGFrameArena(size_t initialCapacity = kDefaultInitialCapacity,
+                          std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~RGFrameArena() override;
+
+    RGFrameArena(const RGFrameArena&)            = delete;
+    RGFrameArena& operator=(const RGFrameArena&) = delete;
+
+    void reset();
+
+    [[nodiscard]] const Stats& getStats() const { return _stats; }
+
+  private:
+    struct Block
+    {
+        std::byte* data = nullptr;
+        size_t     size = 0;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void*, size_t, size_t) override {}
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    void addBlock(size_t size);
+    void releaseBlocks();
+
+    std::pmr::memory_resource* _upstream   = nullptr;
+    std::vector<Block>         _blocks;
+    size_t                     _blockIndex = 0; // Block currently bumped
+    size_t                     _offset     = 0; // Offset within _blocks[_blockIndex]
+    Stats                      _stats;
+};
+
+} // namespace ya
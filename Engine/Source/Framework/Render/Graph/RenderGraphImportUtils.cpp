@@ -17,7 +17,7 @@ RGPassHandle addBufferCopyPass(RenderGraph& graph, const RGBufferCopyParams& par
     }
 
     return graph.addPass(
-        std::string(params.label),
+        params.label,
         [copies = params.copies,
          dependency = params.dependency](RGPassBuilder& pass) {
             if (dependency.has_value()) {
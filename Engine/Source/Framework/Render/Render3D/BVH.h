@@ -1,18 +0,0 @@
-/**
-BVH(Bounding Volume Hierarchy)
-*/
-#pragma once
-
-#include <glm/glm.hpp>
-
-namespace ya
-{
-
-struct BoundingBox
-{
-    glm::vec3 min;
-    glm::vec3 max;
-};
-
-
-}; // namespace ya
\ No newline at end of file
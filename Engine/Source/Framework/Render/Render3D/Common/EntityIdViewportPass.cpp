@@ -286,7 +286,8 @@ void EntityIdViewportPass::drawStaticBucket(ICommandBuffer* cmdBuf, const std::v
         cmdBuf->pushConstants(_pipelineLayout.get(), EShaderStage::Vertex | EShaderStage::Fragment, 0, sizeof(PushConstants), &pc);
         cmdBuf->bindVertexBuffer(0, item.mesh->getVertexBufferMut(), item.mesh->getVertexBufferOffset());
         cmdBuf->bindIndexBuffer(item.mesh->getIndexBufferMut(), item.mesh->getIndexBufferOffset(), false);
-        cmdBuf->drawIndexed(item.mesh->getIndexCount(), 1, 0, 0, 0);
+        const MeshLod& lod = item.mesh->getLod(item.lod);
+        cmdBuf->drawIndexed(lod.indexCount, 1, lod.firstIndex, 0, 0);
     }
 }
 
@@ -299,7 +300,7 @@ void EntityIdViewportPass::drawSkinnedBucket(ICommandBuffer* cmdBuf, const std::
 
         PushConstants pc{.modelMat = item.worldMatrix, .entityId = item.entityId, .skinningPaletteIndex = item.skinningPaletteIndex};
         cmdBuf->pushConstants(_skinnedPipelineLayout.get(), EShaderStage::Vertex | EShaderStage::Fragment, 0, sizeof(PushConstants), &pc);
-        item.mesh->drawSkinned(cmdBuf);
+        item.mesh->drawSkinned(cmdBuf, item.lod);
     }
 }
 
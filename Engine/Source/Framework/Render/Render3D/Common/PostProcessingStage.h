@@ -15,7 +15,7 @@
 namespace ya
 {
 
-struct PostProcessingStage
+struct YA_RENDER_3D_API PostProcessingStage
 {
     static constexpr std::string_view kOutputExportName = "Postprocessing.Output";
 
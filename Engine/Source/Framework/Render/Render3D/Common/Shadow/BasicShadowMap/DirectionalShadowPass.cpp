@@ -196,6 +196,8 @@ std::optional<RGPassHandle> DirectionalShadowPass::appendCascadePass(
             pass.uniformRead(frameBuffer, frameRange);
             pass.storageRead(skinningBuffer);
             pass.useDepthAttachment(depth);
+            // Cascades only read frame data and record draws; safe to record off-thread.
+            pass.allowParallelRecording();
         },
         [this, payload, depth, frameDS, skinningDS](RGRenderContext& ctx) {
             YA_PERF_SCOPE(perf::sample::shadowDirectional(), perf::metric::cpuTimeMs(), perf::domain::render());
@@ -230,11 +232,11 @@ std::optional<RGPassHandle> DirectionalShadowPass::appendCascadePass(
             };
             {
                 YA_PROFILE_SCOPE("DirectionalShadowPass::DrawStatic");
-                ShadowDrawHelper::drawStaticBuckets(&commandBuffer, staticRes, payload.frameData->drawBuckets.staticMeshes);
+                ShadowDrawHelper::drawStaticBuckets(&commandBuffer, staticRes, payload.frameData->staticShadowCasters);
             }
             {
                 YA_PROFILE_SCOPE("DirectionalShadowPass::DrawSkinned");
-                ShadowDrawHelper::drawSkinnedBuckets(&commandBuffer, skinnedRes, payload.frameData->drawBuckets.skinnedMeshes);
+                ShadowDrawHelper::drawSkinnedBuckets(&commandBuffer, skinnedRes, payload.frameData->skinnedShadowCasters());
             }
             ctx.endRendering();
         });
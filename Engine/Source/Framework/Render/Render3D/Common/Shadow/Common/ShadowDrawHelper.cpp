@@ -13,7 +13,8 @@ namespace ya::ShadowDrawHelper
 
 void drawStaticBuckets(ICommandBuffer* cmdBuf,
                        const PassResources& res,
-                       const RenderShadingDrawBuckets& buckets)
+                       const RenderShadingDrawBuckets& buckets,
+                       uint32_t casterMask)
 {
     YA_PERF_SCOPE(perf::sample::shadowPointDirectDrawStatic(), perf::metric::cpuTimeMs(), perf::domain::render());
 
@@ -23,10 +24,10 @@ void drawStaticBuckets(ICommandBuffer* cmdBuf,
         cmdBuf->bindPipeline(res.pipeline);
         cmdBuf->bindDescriptorSets(res.pipelineLayout, 0, {res.frameDS});
         for (const auto& item : items) {
-            if (!item.mesh) continue;
+            if (!item.mesh || (item.pointShadowMask & casterMask) == 0) continue;
             ModelPushConstant pc{.modelMat = item.worldMatrix, .skinningPaletteIndex = -1};
             cmdBuf->pushConstants(res.pipelineLayout, EShaderStage::Vertex, 0, sizeof(ModelPushConstant), &pc);
-            item.mesh->drawStatic(cmdBuf);
+            item.mesh->drawStatic(cmdBuf, item.lod);
         }
     };
 
@@ -39,7 +40,8 @@ void drawStaticBuckets(ICommandBuffer* cmdBuf,
 
 void drawSkinnedBuckets(ICommandBuffer* cmdBuf,
                         const PassResources& res,
-                        const RenderShadingDrawBuckets& buckets)
+                        const RenderShadingDrawBuckets& buckets,
+                        uint32_t casterMask)
 {
     auto drawItems = [&](DrawCandidateView items)
     {
@@ -47,10 +49,10 @@ void drawSkinnedBuckets(ICommandBuffer* cmdBuf,
         cmdBuf->bindPipeline(res.pipeline);
         cmdBuf->bindDescriptorSets(res.pipelineLayout, 0, {res.frameDS, res.skinningDS});
         for (const auto& item : items) {
-            if (!item.mesh) continue;
+            if (!item.mesh || (item.pointShadowMask & casterMask) == 0) continue;
             ModelPushConstant pc{.modelMat = item.worldMatrix, .skinningPaletteIndex = item.skinningPaletteIndex};
             cmdBuf->pushConstants(res.pipelineLayout, EShaderStage::Vertex, 0, sizeof(ModelPushConstant), &pc);
-            item.mesh->drawSkinned(cmdBuf);
+            item.mesh->drawSkinned(cmdBuf, item.lod);
         }
     };
 
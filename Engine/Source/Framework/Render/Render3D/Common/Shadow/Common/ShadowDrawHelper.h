@@ -34,14 +34,17 @@ namespace ShadowDrawHelper
     };
 
     /// Draw all static-mesh buckets with the given pipeline / frame DS.
+    /// Items whose pointShadowMask shares no bit with @p casterMask are skipped.
     void drawStaticBuckets(ICommandBuffer* cmdBuf,
                            const PassResources& res,
-                           const RenderShadingDrawBuckets& buckets);
+                           const RenderShadingDrawBuckets& buckets,
+                           uint32_t casterMask = ~0u);
 
     /// Draw all skinned-mesh buckets. Requires res.skinningDS != nullptr.
     void drawSkinnedBuckets(ICommandBuffer* cmdBuf,
                             const PassResources& res,
-                            const RenderShadingDrawBuckets& buckets);
+                            const RenderShadingDrawBuckets& buckets,
+                            uint32_t casterMask = ~0u);
 }
 
 } // namespace ya
@@ -107,17 +107,17 @@ void ShadowFrameResources::destroy()
 
 std::optional<uint32_t> ShadowFrameResources::calculateSkinningCapacity(
     uint32_t currentCapacity,
-    uint32_t paletteCount)
+    uint32_t boneMatrixCount)
 {
-    constexpr uint32_t maxPaletteCount = std::numeric_limits<uint32_t>::max() / sizeof(RenderSkinningPalette);
-    const uint32_t requiredCount = std::max(1u, paletteCount);
-    if (requiredCount > maxPaletteCount) {
+    constexpr uint32_t maxMatrixCount = std::numeric_limits<uint32_t>::max() / sizeof(glm::mat4);
+    const uint32_t requiredCount = std::max(1u, boneMatrixCount);
+    if (requiredCount > maxMatrixCount) {
         return std::nullopt;
     }
 
-    uint32_t nextCapacity = currentCapacity == 0 ? 16u : currentCapacity;
+    uint32_t nextCapacity = currentCapacity == 0 ? INITIAL_SKINNING_MATRIX_CAPACITY : currentCapacity;
     while (nextCapacity < requiredCount) {
-        if (nextCapacity > maxPaletteCount / 2u) {
+        if (nextCapacity > maxMatrixCount / 2u) {
             nextCapacity = requiredCount;
             break;
         }
@@ -126,19 +126,19 @@ std::optional<uint32_t> ShadowFrameResources::calculateSkinningCapacity(
     return nextCapacity;
 }
 
-bool ShadowFrameResources::ensureSkinningCapacity(uint32_t paletteCount)
+bool ShadowFrameResources::ensureSkinningCapacity(uint32_t boneMatrixCount)
 {
-    if (_descriptorPool && std::max(1u, paletteCount) <= _skinningCapacity) {
+    if (_descriptorPool && std::max(1u, boneMatrixCount) <= _skinningCapacity) {
         return true;
     }
 
-    const auto nextCapacity = calculateSkinningCapacity(_skinningCapacity, paletteCount);
+    const auto nextCapacity = calculateSkinningCapacity(_skinningCapacity, boneMatrixCount);
     if (!nextCapacity.has_value()) {
-        YA_CORE_ERROR("Shadow skinning palette count {} exceeds buffer size limit", paletteCount);
+        YA_CORE_ERROR("Shadow skinning bone matrix count {} exceeds buffer size limit", boneMatrixCount);
         return false;
     }
 
-    const uint32_t bufferSize = *nextCapacity * sizeof(RenderSkinningPalette);
+    const uint32_t bufferSize = *nextCapacity * sizeof(glm::mat4);
     std::array<stdptr<IBuffer>, MAX_FLIGHTS_IN_FLIGHT> nextBuffers{};
     for (uint32_t flightIndex = 0; flightIndex < MAX_FLIGHTS_IN_FLIGHT; ++flightIndex) {
         nextBuffers[flightIndex] = _render->getResourceFactory()->createBuffer(
@@ -182,7 +182,7 @@ bool ShadowFrameResources::prepare(const BasicShadowFramePayload& payload)
         return false;
     }
     if (!_uploadArena->beginFlight(payload.flightIndex) ||
-        !ensureSkinningCapacity(static_cast<uint32_t>(payload.frameData->skinningPalettes.size()))) {
+        !ensureSkinningCapacity(static_cast<uint32_t>(payload.frameData->skinningBoneMatrices.size()))) {
         return false;
     }
 
@@ -260,12 +260,12 @@ bool ShadowFrameResources::prepare(const BasicShadowFramePayload& payload)
         next.pointFaces[faceGlobalIndex] = slice;
     }
 
-    const auto& palettes = payload.frameData->skinningPalettes;
+    const auto& boneMatrices = payload.frameData->skinningBoneMatrices;
     auto&       skinning = next.skinningBuffer;
-    if (!palettes.empty()) {
-        const uint64_t bytes = static_cast<uint64_t>(palettes.size()) * sizeof(RenderSkinningPalette);
+    if (!boneMatrices.empty()) {
+        const uint64_t bytes = static_cast<uint64_t>(boneMatrices.size()) * sizeof(glm::mat4);
         if (bytes > std::numeric_limits<uint32_t>::max() ||
-            !skinning->writeData(palettes.data(), static_cast<uint32_t>(bytes), 0) ||
+            !skinning->writeData(boneMatrices.data(), static_cast<uint32_t>(bytes), 0) ||
             !skinning->flush(static_cast<uint32_t>(bytes), 0)) {
             return false;
         }
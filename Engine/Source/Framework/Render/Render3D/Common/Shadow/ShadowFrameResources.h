@@ -54,8 +54,8 @@ class ShadowFrameResources
   private:
     static std::optional<uint32_t> calculateSkinningCapacity(
         uint32_t currentCapacity,
-        uint32_t paletteCount);
-    bool ensureSkinningCapacity(uint32_t paletteCount);
+        uint32_t boneMatrixCount);
+    bool ensureSkinningCapacity(uint32_t boneMatrixCount);
 
     IRender* _render = nullptr;
     std::unique_ptr<FrameUploadArena> _uploadArena;
@@ -21,7 +21,7 @@ struct PostProcessingStage;
 struct RenderTargetCreateInfo;
 struct EntityIdViewportPass;
 
-struct DeferredFrameGraphOrchestrator
+struct YA_RENDER_3D_API DeferredFrameGraphOrchestrator
 {
     struct BuildDependencies
     {
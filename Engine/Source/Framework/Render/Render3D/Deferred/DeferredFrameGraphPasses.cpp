@@ -71,6 +71,12 @@ void importFrameBuffers(DeferredFrameGraphPassContext& context)
         EBufferUsage::StorageBuffer,
         0,
         0);
+    graphResources.buffers.instances = importHostWritten(
+        frameBinding.instances.buffer,
+        "Deferred.InstanceSSBO",
+        EBufferUsage::StorageBuffer,
+        frameBinding.instances.offset,
+        frameBinding.instances.size);
     if (context.bUseSSAO) {
         graphResources.buffers.ssaoFrame = importHostWritten(
             frameBinding.ssaoFrame.buffer,
@@ -157,20 +163,26 @@ void appendGBuffer(DeferredFrameGraphPassContext& context)
             .range  = RGBufferRange{.offset = frameBinding.light.offset, .size = frameBinding.light.size},
         },
         .skinning                    = graphResources.buffers.skinning,
+        .instances = {
+            .handle = graphResources.buffers.instances,
+            .range  = RGBufferRange{.offset = frameBinding.instances.offset, .size = frameBinding.instances.size},
+        },
         .gBufferColors               = graphResources.textures.gBufferColors,
         .gBufferDepth                = graphResources.textures.gBufferDepth,
         .renderArea                  = Rect2D{.pos = {0, 0}, .extent = gbufferExtent.toVec2()},
         .layerCount                  = 1,
         .frameAndLightDescriptorSet  = frameBinding.frameAndLightDescriptorSet,
         .skinningDescriptorSet       = frameBinding.skinningDescriptorSet,
+        .instanceDescriptorSet       = frameBinding.instanceDescriptorSet,
     };
 
     graphResources.passes.gBuffer = graph.addPass(
-        std::string(kTopologyPassGBuffer),
+        kTopologyPassGBuffer,
         [&params](RGPassBuilder& passBuilder) {
             passBuilder.uniformRead(params.frame.handle, params.frame.range);
             passBuilder.uniformRead(params.light.handle, params.light.range);
             passBuilder.storageRead(params.skinning);
+            passBuilder.storageRead(params.instances.handle, params.instances.range);
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
                 .layerCount = params.layerCount,
@@ -188,12 +200,14 @@ void appendGBuffer(DeferredFrameGraphPassContext& context)
                     .finalLayout = EImageLayout::ShaderReadOnlyOptimal,
                 },
             });
+            passBuilder.allowParallelRecording();
         },
         [stageCtx = context.stageCtx, params, gBufferStage = &context.gBufferStage, bReverseViewportY = context.bReverseViewportY](RGRenderContext& rgCtx) {
             const auto rasterParams = rgCtx.getRasterPassExecutionParams();
             [[maybe_unused]] IBuffer* const frameBuffer    = rgCtx.resolveBuffer(params.frame.handle);
             [[maybe_unused]] IBuffer* const lightBuffer    = rgCtx.resolveBuffer(params.light.handle);
             [[maybe_unused]] IBuffer* const skinningBuffer = rgCtx.resolveBuffer(params.skinning);
+            [[maybe_unused]] IBuffer* const instanceBuffer = rgCtx.resolveBuffer(params.instances.handle);
 
             rgCtx.beginDeclaredRasterRendering();
 
@@ -205,9 +219,14 @@ void appendGBuffer(DeferredFrameGraphPassContext& context)
             rgCtx.getCommandBuffer().setViewport(0.0f, gbVpY, static_cast<float>(vpW), gbVpH);
             rgCtx.getCommandBuffer().setScissor(0, 0, vpW, vpH);
 
-            gBufferStage->execute(stageCtx, GBufferStage::FrameInputs{
+            // Record into the pass command buffer, which is a worker-owned
+            // secondary (or stream) when the executor records this pass in parallel.
+            auto passStageCtx   = stageCtx;
+            passStageCtx.cmdBuf = &rgCtx.getCommandBuffer();
+            gBufferStage->execute(passStageCtx, GBufferStage::FrameInputs{
                 .frameAndLightDescriptorSet = params.frameAndLightDescriptorSet,
                 .skinningDescriptorSet      = params.skinningDescriptorSet,
+                .instanceDescriptorSet      = params.instanceDescriptorSet,
             });
             rgCtx.endRendering();
         });
@@ -286,7 +305,7 @@ void appendLight(DeferredFrameGraphPassContext& context)
     };
 
     graphResources.passes.light = graph.addPass(
-        std::string(kTopologyPassLight),
+        kTopologyPassLight,
         [&params](RGPassBuilder& passBuilder) {
             passBuilder.uniformRead(params.frame.handle, params.frame.range);
             passBuilder.uniformRead(params.light.handle, params.light.range);
@@ -323,6 +342,8 @@ void appendLight(DeferredFrameGraphPassContext& context)
                     .finalLayout = EImageLayout::ShaderReadOnlyOptimal,
                 }},
             });
+            // Only writes its own descriptor set and records one fullscreen draw.
+            passBuilder.allowParallelRecording();
         },
         [stageCtx = context.stageCtx, params, lightStage = &context.lightStage](RGRenderContext& rgCtx) {
             [[maybe_unused]] const auto rasterParams = rgCtx.getRasterPassExecutionParams();
@@ -337,7 +358,9 @@ void appendLight(DeferredFrameGraphPassContext& context)
 
             rgCtx.beginDeclaredRasterRendering();
             YA_PERF_SCOPE(perf::sample::deferredLight(), perf::metric::cpuTimeMs(), perf::domain::render());
-            lightStage->execute(stageCtx, params.frameAndLightDescriptorSet, params.environmentLightingDescriptorSet);
+            auto passStageCtx   = stageCtx;
+            passStageCtx.cmdBuf = &rgCtx.getCommandBuffer();
+            lightStage->execute(passStageCtx, params.frameAndLightDescriptorSet, params.environmentLightingDescriptorSet);
             rgCtx.endRendering();
         });
 }
@@ -352,7 +375,7 @@ void appendForwardOpaque(DeferredFrameGraphPassContext& context)
     };
 
     context.graph.addPass(
-        std::string(kTopologyPassForwardOpaque),
+        kTopologyPassForwardOpaque,
         [&params](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -398,7 +421,7 @@ void appendSkybox(DeferredFrameGraphPassContext& context)
     };
 
     context.graphResources.passes.skybox = context.graph.addPass(
-        std::string(kTopologyPassSkybox),
+        kTopologyPassSkybox,
         [&params](RGPassBuilder& passBuilder) {
             passBuilder.uniformRead(params.frame.handle, params.frame.range);
             passBuilder.declareRaster({
@@ -454,7 +477,7 @@ void appendForwardTransparent(DeferredFrameGraphPassContext& context)
     };
 
     context.graphResources.passes.sceneOverlay = context.graph.addPass(
-        std::string(kTopologyPassForwardTransparent),
+        kTopologyPassForwardTransparent,
         [&params](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -556,7 +579,7 @@ void appendOverlay(DeferredFrameGraphPassContext& context)
     };
 
     context.graphResources.passes.viewportOverlay = context.graph.addPass(
-        std::string(kTopologyPassOverlay),
+        kTopologyPassOverlay,
         [&params](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -59,12 +59,14 @@ struct DeferredGBufferPassParams
     BufferInput                    frame{};
     BufferInput                    light{};
     RGBufferHandle                 skinning{};
+    BufferInput                    instances{};
     std::array<RGTextureHandle, 4> gBufferColors{};
     RGTextureHandle                gBufferDepth{};
     Rect2D                         renderArea{};
     uint32_t                       layerCount = 1;
     DescriptorSetHandle            frameAndLightDescriptorSet{};
     DescriptorSetHandle            skinningDescriptorSet{};
+    DescriptorSetHandle            instanceDescriptorSet{};
 };
 
 struct DeferredSSAOPassParams
@@ -37,6 +37,7 @@ struct DeferredFrameGraphResources
         RGBufferHandle                frame{};
         RGBufferHandle                light{};
         RGBufferHandle                skinning{};
+        RGBufferHandle                instances{};
         std::optional<RGBufferHandle> ssaoFrame{};
         RGBufferHandle                skyboxFrame{};
     } buffers{};
@@ -77,11 +77,27 @@ void DeferredFrameResourceSet::init(IRender* render)
             .poolSizes = {{.type = EPipelineDescriptorType::UniformBuffer, .descriptorCount = MAX_FLIGHTS_IN_FLIGHT}},
         });
 
+    _instanceDSL = IDescriptorSetLayout::create(
+        _render,
+        DescriptorSetLayoutDesc{
+            .label    = "Deferred_Instance_DSL",
+            .set      = 3,
+            .bindings = {{.binding = 0, .descriptorType = EPipelineDescriptorType::StorageBuffer, .descriptorCount = 1, .stageFlags = EShaderStage::Vertex}},
+        });
+
+    _instanceDSP = IDescriptorPool::create(
+        _render,
+        DescriptorPoolCreateInfo{
+            .label     = "Deferred_Instance_DSP",
+            .maxSets   = MAX_FLIGHTS_IN_FLIGHT,
+            .poolSizes = {{.type = EPipelineDescriptorType::StorageBuffer, .descriptorCount = MAX_FLIGHTS_IN_FLIGHT}},
+        });
+
     _uploadArena = std::make_unique<FrameUploadArena>(
         *render->getResourceFactory(),
         MAX_FLIGHTS_IN_FLIGHT,
         64u * 1024u,
-        EBufferUsage::UniformBuffer,
+        EBufferUsage::UniformBuffer | EBufferUsage::StorageBuffer,
         "Deferred.FrameUpload");
 
     for (uint32_t flightIndex = 0; flightIndex < MAX_FLIGHTS_IN_FLIGHT; ++flightIndex) {
@@ -89,6 +105,7 @@ void DeferredFrameResourceSet::init(IRender* render)
             .frameAndLightDescriptorSet = _frameAndLightDSP->allocateDescriptorSets(_frameAndLightDSL),
             .ssaoFrameDescriptorSet     = _ssaoFrameDSP->allocateDescriptorSets(_ssaoFrameDSL),
             .skyboxFrameDescriptorSet   = _skyboxFrameDSP->allocateDescriptorSets(_skyboxFrameDSL),
+            .instanceDescriptorSet      = _instanceDSP->allocateDescriptorSets(_instanceDSL),
         };
     }
 
@@ -105,6 +122,9 @@ void DeferredFrameResourceSet::destroy()
     _ssaoFrameDSL.reset();
     _skyboxFrameDSP.reset();
     _skyboxFrameDSL.reset();
+    _instanceDSP.reset();
+    _instanceDSL.reset();
+    _instanceScratch = {};
     _frameAndLightDSP.reset();
     _frameAndLightDSL.reset();
     _shadowState = {};
@@ -156,20 +176,20 @@ DeferredFrameResourceSet::LightData DeferredFrameResourceSet::buildLightData(con
 
 std::optional<uint32_t> DeferredFrameResourceSet::calculateSkinningCapacity(
     uint32_t currentCapacity,
-    uint32_t paletteCount)
+    uint32_t boneMatrixCount)
 {
-    constexpr uint32_t maxPaletteCount = std::numeric_limits<uint32_t>::max() / sizeof(RenderSkinningPalette);
-    const uint32_t requiredCount = std::max(1u, paletteCount);
-    if (requiredCount > maxPaletteCount) {
+    constexpr uint32_t maxMatrixCount = std::numeric_limits<uint32_t>::max() / sizeof(glm::mat4);
+    const uint32_t requiredCount = std::max(1u, boneMatrixCount);
+    if (requiredCount > maxMatrixCount) {
         return std::nullopt;
     }
 
-    uint32_t nextCapacity = currentCapacity == 0 ? 16u : currentCapacity;
-    if (nextCapacity > maxPaletteCount) {
+    uint32_t nextCapacity = currentCapacity == 0 ? INITIAL_SKINNING_MATRIX_CAPACITY : currentCapacity;
+    if (nextCapacity > maxMatrixCount) {
         return std::nullopt;
     }
     while (nextCapacity < requiredCount) {
-        if (nextCapacity > maxPaletteCount / 2u) {
+        if (nextCapacity > maxMatrixCount / 2u) {
             nextCapacity = requiredCount;
             break;
         }
@@ -178,15 +198,15 @@ std::optional<uint32_t> DeferredFrameResourceSet::calculateSkinningCapacity(
     return nextCapacity;
 }
 
-bool DeferredFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
+bool DeferredFrameResourceSet::ensureSkinningCapacity(uint32_t boneMatrixCount)
 {
-    if (_skinningDSP && std::max(1u, paletteCount) <= _skinningCapacity) {
+    if (_skinningDSP && std::max(1u, boneMatrixCount) <= _skinningCapacity) {
         return true;
     }
 
-    const auto nextCapacity = calculateSkinningCapacity(_skinningCapacity, paletteCount);
+    const auto nextCapacity = calculateSkinningCapacity(_skinningCapacity, boneMatrixCount);
     if (!nextCapacity.has_value()) {
-        YA_CORE_ERROR("Deferred skinning palette count {} exceeds buffer size limit", paletteCount);
+        YA_CORE_ERROR("Deferred skinning bone matrix count {} exceeds buffer size limit", boneMatrixCount);
         return false;
     }
 
@@ -202,7 +222,7 @@ bool DeferredFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
         return false;
     }
 
-    const uint32_t bufferSize = *nextCapacity * sizeof(RenderSkinningPalette);
+    const uint32_t bufferSize = *nextCapacity * sizeof(glm::mat4);
     std::array<stdptr<IBuffer>, MAX_FLIGHTS_IN_FLIGHT> nextBuffers{};
     std::array<DescriptorSetHandle, MAX_FLIGHTS_IN_FLIGHT> nextDescriptorSets{};
     for (uint32_t flightIndex = 0; flightIndex < MAX_FLIGHTS_IN_FLIGHT; ++flightIndex) {
@@ -260,22 +280,22 @@ bool DeferredFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
 bool DeferredFrameResourceSet::prepareSkinning(const RenderStageContext& ctx)
 {
     YA_CORE_ASSERT(ctx.frameData != nullptr, "Deferred skinning prepare requires frame data");
-    const auto& palettes = ctx.frameData->skinningPalettes;
-    if (palettes.size() > std::numeric_limits<uint32_t>::max()) {
-        YA_CORE_ERROR("Deferred skinning palette count exceeds uint32 range");
+    const auto& boneMatrices = ctx.frameData->skinningBoneMatrices;
+    if (boneMatrices.size() > std::numeric_limits<uint32_t>::max()) {
+        YA_CORE_ERROR("Deferred skinning bone matrix count exceeds uint32 range");
         return false;
     }
-    if (!ensureSkinningCapacity(static_cast<uint32_t>(palettes.size()))) {
+    if (!ensureSkinningCapacity(static_cast<uint32_t>(boneMatrices.size()))) {
         return false;
     }
-    if (palettes.empty()) {
+    if (boneMatrices.empty()) {
         return true;
     }
 
     auto& buffer = _bindings[ctx.flightIndex].skinningBuffer;
     YA_CORE_ASSERT(buffer != nullptr, "Deferred skinning buffer is missing for flight {}", ctx.flightIndex);
-    const uint32_t byteCount = static_cast<uint32_t>(palettes.size() * sizeof(RenderSkinningPalette));
-    return buffer->writeData(palettes.data(), byteCount, 0) && buffer->flush(byteCount, 0);
+    const uint32_t byteCount = static_cast<uint32_t>(boneMatrices.size() * sizeof(glm::mat4));
+    return buffer->writeData(boneMatrices.data(), byteCount, 0) && buffer->flush(byteCount, 0);
 }
 
 void DeferredFrameResourceSet::updateDescriptorSet(uint32_t flightIndex, const Binding& binding)
@@ -347,6 +367,26 @@ void DeferredFrameResourceSet::updateSkyboxDescriptorSet(uint32_t flightIndex, c
     });
 }
 
+void DeferredFrameResourceSet::updateInstanceDescriptorSet(uint32_t flightIndex, const Binding& binding)
+{
+    const auto& previous = _bindings[flightIndex];
+    const bool bChanged = previous.instances.buffer.get() != binding.instances.buffer.get() ||
+                          previous.instances.offset != binding.instances.offset ||
+                          previous.instances.size != binding.instances.size;
+    if (!bChanged) {
+        return;
+    }
+
+    _render->getDescriptorHelper()->updateDescriptorSets({
+        IDescriptorSetHelper::genBufferWrite(
+            binding.instanceDescriptorSet,
+            0,
+            0,
+            EPipelineDescriptorType::StorageBuffer,
+            {binding.instances.descriptor()}),
+    });
+}
+
 bool DeferredFrameResourceSet::prepare(const RenderStageContext& ctx)
 {
     if (!_render || !_uploadArena || !ctx.frameData || ctx.flightIndex >= MAX_FLIGHTS_IN_FLIGHT) {
@@ -416,11 +456,47 @@ bool DeferredFrameResourceSet::prepare(const RenderStageContext& ctx)
     Binding next = _bindings[ctx.flightIndex];
     next.frame   = frame;
     next.light   = light;
+    if (!prepareInstances(ctx, next)) {
+        return false;
+    }
     updateDescriptorSet(ctx.flightIndex, next);
+    updateInstanceDescriptorSet(ctx.flightIndex, next);
     _bindings[ctx.flightIndex] = std::move(next);
     return true;
 }
 
+bool DeferredFrameResourceSet::prepareInstances(const RenderStageContext& ctx, Binding& next)
+{
+    // One record per static PBR draw item, in bucket order, so GBufferStage
+    // can draw each DrawPacket as firstInstance/instanceCount of this slice.
+    // At least one record keeps the descriptor range valid on empty frames.
+    const auto     items     = DrawCandidateView{std::span<const RenderDrawItem>(ctx.frameData->drawBuckets.staticMeshes.pbrDrawItems)};
+    const uint64_t byteCount = static_cast<uint64_t>(std::max<size_t>(items.size(), 1)) * sizeof(DrawInstanceData);
+    if (byteCount > std::numeric_limits<uint32_t>::max()) {
+        YA_CORE_ERROR("Deferred instance upload of {} draws exceeds 32-bit buffer size", items.size());
+        return false;
+    }
+
+    // Vulkan caps minStorageBufferOffsetAlignment at 256.
+    constexpr uint32_t kStorageAlignment = 256;
+    const auto instances = _uploadArena->allocate(
+        ctx.flightIndex,
+        static_cast<uint32_t>(byteCount),
+        std::max(_render->getUniformBufferOffsetAlignment(), kStorageAlignment));
+    if (!instances.has_value()) {
+        return false;
+    }
+
+    _instanceScratch.resize(std::max<size_t>(items.size(), 1));
+    packDrawInstances(items, _instanceScratch);
+    if (!instances->write(_instanceScratch.data(), static_cast<uint32_t>(byteCount))) {
+        return false;
+    }
+
+    next.instances = *instances;
+    return true;
+}
+
 bool DeferredFrameResourceSet::prepareSSAO(
     const RenderStageContext& ctx,
     const SSAOFrameData& frameData)
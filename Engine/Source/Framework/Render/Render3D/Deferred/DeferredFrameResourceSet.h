@@ -12,6 +12,7 @@
 
 #include <array>
 #include <optional>
+#include <vector>
 
 namespace ya
 {
@@ -20,8 +21,9 @@ namespace ya
  * Owns Deferred's shared frame/light descriptor set and its per-flight data.
  *
  * The descriptor set layout and descriptor sets are pipeline resources. The
- * frame and light payloads are frame-local slices in a per-flight upload arena;
- * skinning uses capacity-managed per-flight storage buffers. The graph imports
+ * frame and light payloads and the instanced-draw records are frame-local
+ * slices in a per-flight upload arena; skinning uses capacity-managed
+ * per-flight storage buffers. The graph imports
  * those owner-backed resources after this object has prepared the current
  * flight.
  */
@@ -41,10 +43,12 @@ class YA_RENDER_3D_API DeferredFrameResourceSet
         DescriptorSetHandle             skinningDescriptorSet{};
         DescriptorSetHandle             ssaoFrameDescriptorSet{};
         DescriptorSetHandle             skyboxFrameDescriptorSet{};
+        DescriptorSetHandle             instanceDescriptorSet{};
         FrameUploadArena::Allocation    frame;
         FrameUploadArena::Allocation    light;
         FrameUploadArena::Allocation    ssaoFrame;
         FrameUploadArena::Allocation    skyboxFrame;
+        FrameUploadArena::Allocation    instances; // DrawInstanceData per static PBR draw item
         stdptr<IBuffer>                  skinningBuffer;
 
         [[nodiscard]] bool isValid() const
@@ -73,6 +77,7 @@ class YA_RENDER_3D_API DeferredFrameResourceSet
     [[nodiscard]] stdptr<IDescriptorSetLayout> getSkinningDSL() const { return _skinningDSL; }
     [[nodiscard]] stdptr<IDescriptorSetLayout> getSSAOFrameDSL() const { return _ssaoFrameDSL; }
     [[nodiscard]] stdptr<IDescriptorSetLayout> getSkyboxFrameDSL() const { return _skyboxFrameDSL; }
+    [[nodiscard]] stdptr<IDescriptorSetLayout> getInstanceDSL() const { return _instanceDSL; }
     [[nodiscard]] const Binding&               getBinding(uint32_t flightIndex) const;
     [[nodiscard]] uint32_t getMaxShadowedPointLights() const { return _shadowState.maxShadowedPointLights; }
     [[nodiscard]] uint32_t getLastShadowedPointLights() const { return _lastShadowedPointLights; }
@@ -88,7 +93,10 @@ class YA_RENDER_3D_API DeferredFrameResourceSet
     stdptr<IDescriptorPool>           _ssaoFrameDSP;
     stdptr<IDescriptorSetLayout>      _skyboxFrameDSL;
     stdptr<IDescriptorPool>           _skyboxFrameDSP;
+    stdptr<IDescriptorSetLayout>      _instanceDSL;
+    stdptr<IDescriptorPool>           _instanceDSP;
     std::array<Binding, MAX_FLIGHTS_IN_FLIGHT> _bindings{};
+    std::vector<DrawInstanceData>              _instanceScratch; // Packed before upload; capacity reused
     ShadowRuntimeState _shadowState{};
     uint32_t _skinningCapacity = 0;
     uint32_t _lastShadowedPointLights = 0;
@@ -96,12 +104,14 @@ class YA_RENDER_3D_API DeferredFrameResourceSet
     [[nodiscard]] LightData buildLightData(const RenderFrameData& frameData) const;
     [[nodiscard]] static std::optional<uint32_t> calculateSkinningCapacity(
         uint32_t currentCapacity,
-        uint32_t paletteCount);
-    bool ensureSkinningCapacity(uint32_t paletteCount);
+        uint32_t boneMatrixCount);
+    bool ensureSkinningCapacity(uint32_t boneMatrixCount);
     bool prepareSkinning(const RenderStageContext& ctx);
+    bool prepareInstances(const RenderStageContext& ctx, Binding& next);
     void updateDescriptorSet(uint32_t flightIndex, const Binding& binding);
     void updateSSAODescriptorSet(uint32_t flightIndex, const Binding& binding);
     void updateSkyboxDescriptorSet(uint32_t flightIndex, const Binding& binding);
+    void updateInstanceDescriptorSet(uint32_t flightIndex, const Binding& binding);
 };
 
 } // namespace ya
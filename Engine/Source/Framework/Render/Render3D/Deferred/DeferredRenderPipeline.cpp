@@ -692,6 +692,10 @@ void DeferredRenderPipeline::initPipelineState(const InitDesc& desc)
 {
     _render                       = desc.render;
     _graphExecutor                = _render ? std::make_unique<RenderGraphExecutor>(*_render->getResourceFactory()) : nullptr;
+    if (_graphExecutor) {
+        _graphExecutor->setParallelRecording(true);
+        _graphExecutor->setSecondaryCommandBufferProvider([render = _render]() { return render->beginSecondaryCommands(); });
+    }
     _shadowSettings               = desc.shadowSettings;
     _automationShadowOverrides    = desc.automationShadowOverrides;
     _environmentLightingDSL       = desc.environmentLightingDSL;
@@ -746,7 +750,8 @@ void DeferredRenderPipeline::initStages()
     _gBufferStage->init(
         _render,
         _frameResources->getFrameAndLightDSL(),
-        _frameResources->getSkinningDSL());
+        _frameResources->getSkinningDSL(),
+        _frameResources->getInstanceDSL());
 
     _ssaoStage = ya::makeShared<SSAOStage>();
     _ssaoStage->setup(_currentGBufferResources);
@@ -1228,7 +1233,9 @@ void DeferredRenderPipeline::executeDeferredMainGraph(const RenderPipelineFrameC
         .extent     = {.width = vpW, .height = vpH},
     };
     _lastFrameInput = frame;
-    RenderGraph graph;
+    // Last frame's graph is gone, so its declaration storage can be rewound.
+    _graphArena.reset();
+    RenderGraph graph(&_graphArena);
     DeferredFrameGraphResources graphResources{};
     _frameGraphOrchestrator.build(
         DeferredFrameGraphOrchestrator::BuildDependencies{
@@ -1260,7 +1267,7 @@ void DeferredRenderPipeline::executeDeferredMainGraph(const RenderPipelineFrameC
         });
 
     YA_CORE_ASSERT(_graphExecutor != nullptr, "DeferredRenderPipeline graph executor is not initialized");
-    RGCompiledGraph compiled{};
+    RGCompiledGraph&           compiled = _compiledGraph;
     RenderGraphExecutionResult result;
     if (!_graphExecutor->prepare(graph, compiled, &result)) {
         _lastFrameGraphTopology = {};
@@ -11,6 +11,7 @@
 #include "LightStage.h"
 #include "RHI/Core/DescriptorSet.h"
 #include "Graph/RenderGraphExecutor.h"
+#include "Graph/RenderGraphFrameArena.h"
 #include "RHI/Core/Pipeline.h"
 #include "RHI/Core/RenderTexture.h"
 #include "RHI/Core/RenderTargetCreateInfo.h"
@@ -169,6 +170,8 @@ struct YA_RENDER_3D_API DeferredRenderPipeline : public IRenderPipeline
     ShadowSettings             _frameShadowSettings = ShadowSettings::fromQuality(EShadowQuality::Off);
     EnvironmentLightingSceneResources _currentEnvironmentLightingTextures{};
     std::unique_ptr<RenderGraphExecutor> _graphExecutor;
+    RGFrameArena                        _graphArena;    // Backs the per-frame RenderGraph
+    RGCompiledGraph                     _compiledGraph; // Reused so the cached plan copy keeps its capacity
     RGTopologyDescription               _lastFrameGraphTopology{};
 
     DeferredRenderPipeline() = default;
@@ -39,13 +39,20 @@ void refreshShadingPipelineFormats(IGraphicsPipeline* pipeline, const DeferredAt
 
 void GBufferStage::init(IRender* render,
                         stdptr<IDescriptorSetLayout> frameAndLightDSL,
-                        stdptr<IDescriptorSetLayout> skinningDSL)
+                        stdptr<IDescriptorSetLayout> skinningDSL,
+                        stdptr<IDescriptorSetLayout> instanceDSL)
 {
     _render = render;
-    initSharedResources(std::move(frameAndLightDSL), std::move(skinningDSL));
-    initPBR();
-    initPhong();
-    initUnlit();
+    initSharedResources(std::move(frameAndLightDSL), std::move(skinningDSL), std::move(instanceDSL));
+
+    // The seven shading permutations build in parallel.
+    PipelinePrecompiler precompiler;
+    initPBR(precompiler);
+    initPhong(precompiler);
+    initUnlit(precompiler);
+    const auto report = precompiler.build();
+    YA_CORE_ASSERT(report.succeeded(), "Failed to create {} GBuffer pipeline(s)", report.failed);
+
     initFallbackMaterial();
 }
 
@@ -53,6 +60,7 @@ void GBufferStage::refreshPipelineFormats(const DeferredAttachmentFormats& forma
 {
     refreshShadingPipelineFormats(_pbr.pipeline.get(), formats);
     refreshShadingPipelineFormats(_pbrSkinned.pipeline.get(), formats);
+    refreshShadingPipelineFormats(_pbrInstanced.pipeline.get(), formats);
     refreshShadingPipelineFormats(_phong.pipeline.get(), formats);
     refreshShadingPipelineFormats(_phongSkinned.pipeline.get(), formats);
     refreshShadingPipelineFormats(_unlit.pipeline.get(), formats);
@@ -60,15 +68,17 @@ void GBufferStage::refreshPipelineFormats(const DeferredAttachmentFormats& forma
 }
 
 void GBufferStage::initSharedResources(stdptr<IDescriptorSetLayout> frameAndLightDSL,
-                                       stdptr<IDescriptorSetLayout> skinningDSL)
+                                       stdptr<IDescriptorSetLayout> skinningDSL,
+                                       stdptr<IDescriptorSetLayout> instanceDSL)
 {
     _frameAndLightDSL = std::move(frameAndLightDSL);
     YA_CORE_ASSERT(_frameAndLightDSL != nullptr, "GBufferStage requires frame/light DSL");
     _skinningDSL = std::move(skinningDSL);
     YA_CORE_ASSERT(_skinningDSL != nullptr, "GBufferStage requires skinning DSL");
+    _instanceDSL = std::move(instanceDSL);
 }
 
-void GBufferStage::initPBR()
+void GBufferStage::initPBR(PipelinePrecompiler& precompiler)
 {
     auto dsls = IDescriptorSetLayout::create(
         _render,
@@ -121,7 +131,7 @@ void GBufferStage::initPBR()
         .viewportState = {.viewports = {Viewport::defaults()}, .scissors = {Scissor::defaults()}},
     };
     _pbr.pipeline = IGraphicsPipeline::create(_render);
-    YA_CORE_ASSERT(_pbr.pipeline && _pbr.pipeline->recreate(ci), "Failed to create PBR GBuffer pipeline");
+    precompiler.add(_pbr.pipeline, ci);
 
     auto skinnedCI                         = ci;
     skinnedCI.shaderDesc.vertexBufferDescs = {
@@ -142,7 +152,30 @@ void GBufferStage::initPBR()
         {_frameAndLightDSL, _pbr.materialResourceDSL, _pbr.materialParamsDSL, _skinningDSL});
     skinnedCI.pipelineLayout = _pbrSkinned.pipelineLayout.get();
     _pbrSkinned.pipeline     = IGraphicsPipeline::create(_render);
-    YA_CORE_ASSERT(_pbrSkinned.pipeline && _pbrSkinned.pipeline->recreate(skinnedCI), "Failed to create skinned PBR GBuffer pipeline");
+    precompiler.add(_pbrSkinned.pipeline, skinnedCI);
+
+    // The instanced variant reads SV_StartInstanceLocation; without
+    // shaderDrawParameters static PBR keeps the per-draw push-constant path.
+    const bool bInstancedPBR = _instanceDSL && _render->getCapabilities().shaderDrawParameters;
+    if (_instanceDSL && !bInstancedPBR) {
+        YA_CORE_WARN("GBufferStage: shaderDrawParameters unsupported, static PBR draws are not instanced");
+    }
+    if (bInstancedPBR) {
+        auto instancedCI               = ci;
+        instancedCI.shaderDesc.defines = {"ENABLE_INSTANCING 1"};
+
+        // Model matrices come from the instance buffer, so no push constants.
+        _pbrInstanced.materialResourceDSL = _pbr.materialResourceDSL;
+        _pbrInstanced.materialParamsDSL   = _pbr.materialParamsDSL;
+        _pbrInstanced.pipelineLayout      = IPipelineLayout::create(
+            _render,
+            "Deferred_PBR_GBuffer_Instanced_PPL",
+            {},
+            {_frameAndLightDSL, _pbr.materialResourceDSL, _pbr.materialParamsDSL, _instanceDSL});
+        instancedCI.pipelineLayout = _pbrInstanced.pipelineLayout.get();
+        _pbrInstanced.pipeline     = IGraphicsPipeline::create(_render);
+        precompiler.add(_pbrInstanced.pipeline, instancedCI);
+    }
 
     const uint32_t texCount = static_cast<uint32_t>(_pbr.materialResourceDSL->getLayoutInfo().bindings.size());
     _pbrMatPool.init(_render, _pbr.materialParamsDSL, _pbr.materialResourceDSL, [texCount](uint32_t n)
@@ -153,7 +186,7 @@ void GBufferStage::initPBR()
                      16);
 }
 
-void GBufferStage::initPhong()
+void GBufferStage::initPhong(PipelinePrecompiler& precompiler)
 {
     auto dsls = IDescriptorSetLayout::create(
         _render,
@@ -204,7 +237,7 @@ void GBufferStage::initPhong()
         .viewportState = {.viewports = {Viewport::defaults()}, .scissors = {Scissor::defaults()}},
     };
     _phong.pipeline = IGraphicsPipeline::create(_render);
-    YA_CORE_ASSERT(_phong.pipeline && _phong.pipeline->recreate(ci), "Failed to create Phong GBuffer pipeline");
+    precompiler.add(_phong.pipeline, ci);
 
     auto skinnedCI                         = ci;
     skinnedCI.shaderDesc.vertexBufferDescs = {
@@ -225,7 +258,7 @@ void GBufferStage::initPhong()
         {_frameAndLightDSL, _phong.materialResourceDSL, _phong.materialParamsDSL, _skinningDSL});
     skinnedCI.pipelineLayout = _phongSkinned.pipelineLayout.get();
     _phongSkinned.pipeline   = IGraphicsPipeline::create(_render);
-    YA_CORE_ASSERT(_phongSkinned.pipeline && _phongSkinned.pipeline->recreate(skinnedCI), "Failed to create skinned Phong GBuffer pipeline");
+    precompiler.add(_phongSkinned.pipeline, skinnedCI);
 
     const uint32_t texCount = static_cast<uint32_t>(_phong.materialResourceDSL->getLayoutInfo().bindings.size());
     _phongMatPool.init(_render, _phong.materialParamsDSL, _phong.materialResourceDSL, [texCount](uint32_t n)
@@ -236,7 +269,7 @@ void GBufferStage::initPhong()
                        16);
 }
 
-void GBufferStage::initUnlit()
+void GBufferStage::initUnlit(PipelinePrecompiler& precompiler)
 {
     auto dsls = IDescriptorSetLayout::create(
         _render,
@@ -283,7 +316,7 @@ void GBufferStage::initUnlit()
         .viewportState      = {.viewports = {Viewport::defaults()}, .scissors = {Scissor::defaults()}},
     };
     _unlit.pipeline = IGraphicsPipeline::create(_render);
-    YA_CORE_ASSERT(_unlit.pipeline && _unlit.pipeline->recreate(ci), "Failed to create Unlit GBuffer pipeline");
+    precompiler.add(_unlit.pipeline, ci);
 
     auto skinnedCI                         = ci;
     skinnedCI.shaderDesc.vertexBufferDescs = {
@@ -304,7 +337,7 @@ void GBufferStage::initUnlit()
         {_frameAndLightDSL, _unlit.materialResourceDSL, _unlit.materialParamsDSL, _skinningDSL});
     skinnedCI.pipelineLayout = _unlitSkinned.pipelineLayout.get();
     _unlitSkinned.pipeline   = IGraphicsPipeline::create(_render);
-    YA_CORE_ASSERT(_unlitSkinned.pipeline && _unlitSkinned.pipeline->recreate(skinnedCI), "Failed to create skinned Unlit GBuffer pipeline");
+    precompiler.add(_unlitSkinned.pipeline, skinnedCI);
 
     const uint32_t texCount = static_cast<uint32_t>(_unlit.materialResourceDSL->getLayoutInfo().bindings.size());
     _unlitMatPool.init(_render, _unlit.materialParamsDSL, _unlit.materialResourceDSL, [texCount](uint32_t n)
@@ -343,11 +376,13 @@ void GBufferStage::destroy()
 
     _pbr          = {};
     _pbrSkinned   = {};
+    _pbrInstanced = {};
     _phong        = {};
     _phongSkinned = {};
     _unlit        = {};
     _unlitSkinned = {};
 
+    _instanceDSL.reset();
     _skinningDSL.reset();
     _frameAndLightDSL.reset();
     _render = nullptr;
@@ -366,6 +401,9 @@ void GBufferStage::prepare(const RenderStageContext& ctx)
     if (_pbrSkinned.pipeline) {
         _pbrSkinned.pipeline->beginFrame();
     }
+    if (_pbrInstanced.pipeline) {
+        _pbrInstanced.pipeline->beginFrame();
+    }
     if (_phong.pipeline) {
         _phong.pipeline->beginFrame();
     }
@@ -548,14 +586,39 @@ void GBufferStage::drawPBR(const RenderStageContext& ctx, const FrameInputs& inp
     auto* cmdBuf = ctx.cmdBuf;
     auto  ds0    = inputs.frameAndLightDescriptorSet;
 
+    auto& packets = _pbrPackets;
+
+    // Only static PBR is instanced. Static items share one instance record per
+    // item (uploaded by DeferredFrameResourceSet in the same order), so each
+    // packet is a single instanced draw over its record range. Skinned PBR and
+    // the Phong/Unlit models still push per-item constants.
+    auto drawInstanced = [&](DrawCandidateView items)
+    {
+        auto* layout = _pbrInstanced.pipelineLayout.get();
+        cmdBuf->bindPipeline(_pbrInstanced.pipeline.get());
+        packets.clear();
+        buildDrawPackets(items, false, packets);
+        for (const auto& packet : packets) {
+            if (!packet.isValid() || !packet.material) continue;
+            cmdBuf->bindDescriptorSets(layout, 0, {ds0, _pbrMatPool.resourceDS(packet.materialIndex), _pbrMatPool.paramDS(packet.materialIndex), inputs.instanceDescriptorSet});
+            packet.mesh->drawStaticInstanced(cmdBuf, packet.instanceCount, packet.firstInstance, packet.lod);
+        }
+    };
+
     auto drawBucket = [&](DrawCandidateView items, bool bSkinned)
     {
         if (items.empty()) return;
+        if (!bSkinned && _pbrInstanced.pipeline && inputs.instanceDescriptorSet) {
+            drawInstanced(items);
+            return;
+        }
 
         auto* pipeline = bSkinned ? _pbrSkinned.pipeline.get() : _pbr.pipeline.get();
         auto* layout   = bSkinned ? _pbrSkinned.pipelineLayout.get() : _pbr.pipelineLayout.get();
         cmdBuf->bindPipeline(pipeline);
-        for (const auto& packet : buildDrawPackets(items, bSkinned)) {
+        packets.clear();
+        buildDrawPackets(items, bSkinned, packets);
+        for (const auto& packet : packets) {
             if (!packet.isValid() || !packet.material) continue;
             if (bSkinned) {
                 YA_CORE_ASSERT(inputs.skinningDescriptorSet, "GBufferStage missing skinning descriptor set");
@@ -569,10 +632,10 @@ void GBufferStage::drawPBR(const RenderStageContext& ctx, const FrameInputs& inp
                 PBRPushConstant pc{.modelMat = item.worldMatrix, .skinningPaletteIndex = item.skinningPaletteIndex};
                 cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(pc), &pc);
                 if (bSkinned) {
-                    item.mesh->drawSkinned(cmdBuf);
+                    item.mesh->drawSkinned(cmdBuf, item.lod);
                 }
                 else {
-                    item.mesh->drawStatic(cmdBuf);
+                    item.mesh->drawStatic(cmdBuf, item.lod);
                 }
             }
         }
@@ -608,10 +671,10 @@ void GBufferStage::drawPhong(const RenderStageContext& ctx, const FrameInputs& i
             PhongPushConstant pc{.modelMat = item.worldMatrix, .skinningPaletteIndex = item.skinningPaletteIndex};
             cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(pc), &pc);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
@@ -649,10 +712,10 @@ void GBufferStage::drawUnlit(const RenderStageContext& ctx, const FrameInputs& i
             };
             cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(pc), &pc);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
@@ -692,10 +755,10 @@ void GBufferStage::drawFallback(const RenderStageContext& ctx, const FrameInputs
             };
             cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(pc), &pc);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
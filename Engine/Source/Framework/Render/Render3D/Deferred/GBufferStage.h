@@ -3,6 +3,7 @@
 #include "DeferredAttachmentFormats.h"
 #include "RHI/Core/DescriptorSet.h"
 #include "RHI/Core/Pipeline.h"
+#include "RHI/Core/PipelinePrecompiler.h"
 #include "Render3D/Material/MaterialDescPool.h"
 #include "Render3D/Material/PBRMaterial.h"
 #include "Render3D/Material/PhongMaterial.h"
@@ -16,6 +17,7 @@
 #include "DeferredRender.GBufferPass_Unlit.slang.h"
 
 #include <algorithm>
+#include <vector>
 
 namespace ya
 {
@@ -27,7 +29,7 @@ namespace ya
 /// MaterialDescPools.
 ///
 /// LightStage consumes the same frame/light DS from the pipeline resource set.
-struct GBufferStage : public IRenderStage
+struct YA_RENDER_3D_API GBufferStage : public IRenderStage
 {
     // ── Slang-generated type aliases ─────────────────────────────
     using PBRPushConstant = slang_types::DeferredRender::GBufferPass_PBR::PushConstants;
@@ -62,6 +64,7 @@ struct GBufferStage : public IRenderStage
 
     ShadingPipeline                                _pbr;
     ShadingPipeline                                _pbrSkinned;
+    ShadingPipeline                                _pbrInstanced; // Static PBR only, one draw per DrawPacket
     ShadingPipeline                                _phong;
     ShadingPipeline                                _phongSkinned;
     ShadingPipeline                                _unlit;
@@ -70,10 +73,12 @@ struct GBufferStage : public IRenderStage
     MaterialDescPool<PhongMaterial, PhongParamUBO> _phongMatPool;
     MaterialDescPool<UnlitMaterial, UnlitParamUBO> _unlitMatPool;
     UnlitMaterial*                                 _fallbackMaterial = nullptr;
+    std::vector<DrawPacket>                        _pbrPackets; // Reused by drawPBR across buckets and frames
 
     // Kept alive for graphics pipeline layouts; buffers, descriptor sets and
     // capacity are owned by DeferredFrameResourceSet.
     stdptr<IDescriptorSetLayout> _skinningDSL;
+    stdptr<IDescriptorSetLayout> _instanceDSL; // Null (or no shaderDrawParameters) disables the instanced static PBR path
 
     // ── Common vertex attributes ─────────────────────────────────
     std::vector<VertexAttribute> _commonVertexAttributes = {
@@ -88,6 +93,7 @@ struct GBufferStage : public IRenderStage
     {
         DescriptorSetHandle frameAndLightDescriptorSet{};
         DescriptorSetHandle skinningDescriptorSet{};
+        DescriptorSetHandle instanceDescriptorSet{}; // Optional: DrawInstanceData per static PBR draw item
 
         [[nodiscard]] bool isValid() const
         {
@@ -99,7 +105,8 @@ struct GBufferStage : public IRenderStage
 
     void init(IRender* render,
               stdptr<IDescriptorSetLayout> frameAndLightDSL,
-              stdptr<IDescriptorSetLayout> skinningDSL);
+              stdptr<IDescriptorSetLayout> skinningDSL,
+              stdptr<IDescriptorSetLayout> instanceDSL = nullptr);
     void init(IRender* render) override { init(render, nullptr, nullptr); }
     void destroy() override;
     void prepare(const RenderStageContext& ctx) override;
@@ -111,6 +118,7 @@ struct GBufferStage : public IRenderStage
     void                                       refreshPipelineFormats(const DeferredAttachmentFormats& formats);
     [[nodiscard]] IGraphicsPipeline*           getPBRPipeline() const { return _pbr.pipeline.get(); }
     [[nodiscard]] IGraphicsPipeline*           getPBRSkinnedPipeline() const { return _pbrSkinned.pipeline.get(); }
+    [[nodiscard]] IGraphicsPipeline*           getPBRInstancedPipeline() const { return _pbrInstanced.pipeline.get(); }
     [[nodiscard]] IGraphicsPipeline*           getPhongPipeline() const { return _phong.pipeline.get(); }
     [[nodiscard]] IGraphicsPipeline*           getPhongSkinnedPipeline() const { return _phongSkinned.pipeline.get(); }
     [[nodiscard]] IGraphicsPipeline*           getUnlitPipeline() const { return _unlit.pipeline.get(); }
@@ -118,10 +126,11 @@ struct GBufferStage : public IRenderStage
 
   private:
     void initSharedResources(stdptr<IDescriptorSetLayout> frameAndLightDSL,
-                             stdptr<IDescriptorSetLayout> skinningDSL);
-    void initPBR();
-    void initPhong();
-    void initUnlit();
+                             stdptr<IDescriptorSetLayout> skinningDSL,
+                             stdptr<IDescriptorSetLayout> instanceDSL);
+    void initPBR(PipelinePrecompiler& precompiler);
+    void initPhong(PipelinePrecompiler& precompiler);
+    void initUnlit(PipelinePrecompiler& precompiler);
     void initFallbackMaterial();
     void preparePBR(const RenderFrameData& frameData);
     void preparePhong(const RenderFrameData& frameData);
@@ -555,10 +555,10 @@ void ViewportOverlayStage::drawOverlay(const RenderStageContext& ctx, const Fram
             _overlayPC.colorType = mat->colorType;
             cmdBuf->pushConstants(_overlayPPL.get(), EShaderStage::Vertex, 0, sizeof(OverlayPushConstant), &_overlayPC);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
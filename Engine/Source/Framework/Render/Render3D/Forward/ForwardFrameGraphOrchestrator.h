@@ -19,7 +19,7 @@ struct ShadowStage;
 /// viewport sequence. The pipeline stays responsible for the frame boundary
 /// (resource upload), scene snapshots (direction gizmos), executor execution
 /// and publishing exported outputs.
-struct ForwardFrameGraphOrchestrator
+struct YA_RENDER_3D_API ForwardFrameGraphOrchestrator
 {
     struct BuildDependencies
     {
@@ -160,7 +160,7 @@ void appendOpaquePass(RenderGraph& graph,
                       OpaquePassParams params)
 {
     [[maybe_unused]] const auto pass = graph.addPass(
-        std::string(kTopologyPassOpaque),
+        kTopologyPassOpaque,
         [&params, &resources](RGPassBuilder& passBuilder) {
             if (resources.shadowDepth.has_value()) {
                 passBuilder.read(*resources.shadowDepth);
@@ -209,7 +209,7 @@ void appendSkyboxPass(RenderGraph& graph,
                       SkyboxPassParams params)
 {
     [[maybe_unused]] const auto pass = graph.addPass(
-        std::string(kTopologyPassSkybox),
+        kTopologyPassSkybox,
         [&params, &resources](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -247,7 +247,7 @@ void appendTransparentPass(RenderGraph& graph,
                            TransparentPassParams params)
 {
     [[maybe_unused]] const auto pass = graph.addPass(
-        std::string(kTopologyPassTransparent),
+        kTopologyPassTransparent,
         [&params, &resources](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -281,7 +281,7 @@ void appendEntityIdPass(RenderGraph& graph,
                         EntityIdPassParams params)
 {
     [[maybe_unused]] const auto pass = graph.addPass(
-        std::string("Forward EntityId"),
+        "Forward EntityId",
         [&params, &resources](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -326,7 +326,7 @@ void appendOverlayPass(RenderGraph& graph,
                        OverlayPassParams params)
 {
     [[maybe_unused]] const auto pass = graph.addPass(
-        std::string(kTopologyPassOverlay),
+        kTopologyPassOverlay,
         [&params, &resources](RGPassBuilder& passBuilder) {
             passBuilder.declareRaster({
                 .renderArea = params.renderArea,
@@ -260,12 +260,12 @@ void ForwardFrameResourceSet::updateSkyboxFrameDescriptorSet(
     });
 }
 
-bool ForwardFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
+bool ForwardFrameResourceSet::ensureSkinningCapacity(uint32_t boneMatrixCount)
 {
-    constexpr uint32_t maxPaletteCount = std::numeric_limits<uint32_t>::max() / sizeof(RenderSkinningPalette);
-    const uint32_t requiredCount = std::max(1u, paletteCount);
-    if (requiredCount > maxPaletteCount) {
-        YA_CORE_ERROR("Forward skinning palette count {} exceeds buffer size limit", paletteCount);
+    constexpr uint32_t maxMatrixCount = std::numeric_limits<uint32_t>::max() / sizeof(glm::mat4);
+    const uint32_t requiredCount = std::max(1u, boneMatrixCount);
+    if (requiredCount > maxMatrixCount) {
+        YA_CORE_ERROR("Forward skinning bone matrix count {} exceeds buffer size limit", boneMatrixCount);
         return false;
     }
 
@@ -273,13 +273,13 @@ bool ForwardFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
         return true;
     }
 
-    uint32_t nextCapacity = _skinningCapacity == 0 ? 16u : _skinningCapacity;
-    if (nextCapacity > maxPaletteCount) {
+    uint32_t nextCapacity = _skinningCapacity == 0 ? INITIAL_SKINNING_MATRIX_CAPACITY : _skinningCapacity;
+    if (nextCapacity > maxMatrixCount) {
         YA_CORE_ERROR("Forward skinning capacity {} exceeds buffer size limit", nextCapacity);
         return false;
     }
     while (nextCapacity < requiredCount) {
-        if (nextCapacity > maxPaletteCount / 2u) {
+        if (nextCapacity > maxMatrixCount / 2u) {
             nextCapacity = requiredCount;
             break;
         }
@@ -298,7 +298,7 @@ bool ForwardFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
         return false;
     }
 
-    const uint32_t bufferSize = nextCapacity * sizeof(RenderSkinningPalette);
+    const uint32_t bufferSize = nextCapacity * sizeof(glm::mat4);
     std::array<stdptr<IBuffer>, MAX_FLIGHTS_IN_FLIGHT> nextBuffers{};
     std::array<DescriptorSetHandle, MAX_FLIGHTS_IN_FLIGHT> nextDescriptorSets{};
     for (uint32_t flightIndex = 0; flightIndex < MAX_FLIGHTS_IN_FLIGHT; ++flightIndex) {
@@ -356,22 +356,22 @@ bool ForwardFrameResourceSet::ensureSkinningCapacity(uint32_t paletteCount)
 bool ForwardFrameResourceSet::prepareSkinning(const RenderStageContext& ctx)
 {
     YA_CORE_ASSERT(ctx.frameData != nullptr, "Forward skinning prepare requires frame data");
-    const auto& palettes = ctx.frameData->skinningPalettes;
-    if (palettes.size() > std::numeric_limits<uint32_t>::max()) {
-        YA_CORE_ERROR("Forward skinning palette count exceeds uint32 range");
+    const auto& boneMatrices = ctx.frameData->skinningBoneMatrices;
+    if (boneMatrices.size() > std::numeric_limits<uint32_t>::max()) {
+        YA_CORE_ERROR("Forward skinning bone matrix count exceeds uint32 range");
         return false;
     }
-    if (!ensureSkinningCapacity(static_cast<uint32_t>(palettes.size()))) {
+    if (!ensureSkinningCapacity(static_cast<uint32_t>(boneMatrices.size()))) {
         return false;
     }
-    if (palettes.empty()) {
+    if (boneMatrices.empty()) {
         return true;
     }
 
     auto& buffer = _bindings[ctx.flightIndex].skinningBuffer;
     YA_CORE_ASSERT(buffer != nullptr, "Forward skinning buffer is missing for flight {}", ctx.flightIndex);
-    const uint32_t byteCount = static_cast<uint32_t>(palettes.size() * sizeof(RenderSkinningPalette));
-    return buffer->writeData(palettes.data(), byteCount, 0) && buffer->flush(byteCount, 0);
+    const uint32_t byteCount = static_cast<uint32_t>(boneMatrices.size() * sizeof(glm::mat4));
+    return buffer->writeData(boneMatrices.data(), byteCount, 0) && buffer->flush(byteCount, 0);
 }
 
 const ForwardFrameResourceSet::Binding& ForwardFrameResourceSet::getBinding(uint32_t flightIndex) const
@@ -70,7 +70,7 @@ class ForwardFrameResourceSet
     void init(IRender* render);
     void destroy();
 
-    /** Upload the current frame's skinning palettes for the fence-safe flight. */
+    /** Upload the current frame's skinning boneMatrices for the fence-safe flight. */
     bool prepareSkinning(const RenderStageContext& ctx);
     /** Upload all frame/light/skybox payloads into the current flight's arena. */
     bool prepareFramePayloads(const RenderStageContext& ctx, const FramePayloads& payloads);
@@ -98,7 +98,7 @@ class ForwardFrameResourceSet
     std::array<Binding, MAX_FLIGHTS_IN_FLIGHT> _bindings{};
     uint32_t _skinningCapacity = 0;
 
-    bool ensureSkinningCapacity(uint32_t paletteCount);
+    bool ensureSkinningCapacity(uint32_t boneMatrixCount);
     void updatePBRFrameDescriptorSet(uint32_t flightIndex,
                                      const FrameUploadArena::Allocation& frame,
                                      const FrameUploadArena::Allocation& light);
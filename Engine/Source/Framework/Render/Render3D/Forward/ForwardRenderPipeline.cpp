@@ -650,7 +650,9 @@ bool ForwardRenderPipeline::executeViewportPassGraph(const RenderPipelineFrameCo
         }
     }
 
-    RenderGraph graph;
+    // Last frame's graph is gone, so its declaration storage can be rewound.
+    _graphArena.reset();
+    RenderGraph graph(&_graphArena);
     auto viewportPassContext = _viewportStage->buildPassContext(stageCtx);
     _frameGraphOrchestrator.build(
         ForwardFrameGraphOrchestrator::BuildDependencies{
@@ -673,7 +675,7 @@ bool ForwardRenderPipeline::executeViewportPassGraph(const RenderPipelineFrameCo
             .viewportOverlaySnapshot  = _lastFrameInput.viewportOverlaySnapshot,
         });
 
-    RGCompiledGraph compiled{};
+    RGCompiledGraph&           compiled = _compiledGraph;
     RenderGraphExecutionResult result;
     const bool bExecuted = _graphExecutor->execute(graph, *frame.cmdBuf, &compiled, &result);
     if (bExecuted) {
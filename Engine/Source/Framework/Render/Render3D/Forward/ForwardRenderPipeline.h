@@ -6,6 +6,7 @@
 #include "Render3D/Forward/ForwardFrameGraphOrchestrator.h"
 #include "Render3D/Forward/ForwardFrameResourceSet.h"
 #include "Graph/RenderGraphExecutor.h"
+#include "Graph/RenderGraphFrameArena.h"
 #include "RHI/Core/RenderAttachmentFormats.h"
 #include "RHI/Core/RenderTargetCreateInfo.h"
 #include "RHI/Render.h"
@@ -75,6 +76,8 @@ struct YA_RENDER_3D_API ForwardRenderPipeline : public IRenderPipeline
     PostProcessingStage          _postProcessStage;
     ForwardFrameGraphOrchestrator _frameGraphOrchestrator{};
     std::unique_ptr<RenderGraphExecutor> _graphExecutor;
+    RGFrameArena                         _graphArena;    // Backs the per-frame RenderGraph
+    RGCompiledGraph                      _compiledGraph; // Reused so the cached plan copy keeps its capacity
     stdptr<ForwardFrameResourceSet> _frameResources;
     RGTopologyDescription        _lastFrameGraphTopology{};
 
@@ -311,10 +311,10 @@ void ForwardViewportAuxPasses::drawSimple(const DrawContext& drawCtx)
             pc.colorType = mat->colorType;
             cmdBuf->pushConstants(_simplePPL.get(), EShaderStage::Vertex, 0, sizeof(SimplePC), &pc);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
@@ -384,10 +384,10 @@ void ForwardViewportAuxPasses::drawDebug(const DrawContext& drawCtx)
             cmdBuf->bindDescriptorSets(_debugPPL.get(), 0, {_debugUboDS});
             cmdBuf->pushConstants(_debugPPL.get(), EShaderStage::Vertex, 0, sizeof(DebugModelPC), &pc);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
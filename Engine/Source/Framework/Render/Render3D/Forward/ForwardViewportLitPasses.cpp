@@ -571,10 +571,10 @@ void ForwardViewportLitPasses::drawPBR(const DrawContext& drawCtx)
             PBRPushConstant pc{.modelMat = item.worldMatrix, .skinningPaletteIndex = item.skinningPaletteIndex};
             cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(PBRPushConstant), &pc);
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
@@ -637,10 +637,10 @@ void ForwardViewportLitPasses::drawPhong(const DrawContext& drawCtx)
             cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(PhongModelPC), &pc);
 
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
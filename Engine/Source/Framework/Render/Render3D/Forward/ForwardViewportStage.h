@@ -27,7 +27,7 @@ struct EnvironmentLightingProcessor;
 /// SkyBoxSystem and DebugRenderSystem.
 ///
 /// Consumes RenderFrameData snapshot for draw items.
-struct ForwardViewportStage : public IRenderStage
+struct YA_RENDER_3D_API ForwardViewportStage : public IRenderStage
 {
     struct InitDesc
     {
@@ -274,10 +274,10 @@ void ForwardViewportUnlitPass::draw(const DrawContext& drawCtx)
             cmdBuf->pushConstants(layout, EShaderStage::Vertex, 0, sizeof(UnlitPC), &pc);
 
             if (bSkinned) {
-                item.mesh->drawSkinned(cmdBuf);
+                item.mesh->drawSkinned(cmdBuf, item.lod);
             }
             else {
-                item.mesh->drawStatic(cmdBuf);
+                item.mesh->drawStatic(cmdBuf, item.lod);
             }
         }
     };
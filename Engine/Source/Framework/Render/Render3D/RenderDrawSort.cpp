@@ -0,0 +1,250 @@
+#include "RenderDrawSort.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <xmmintrin.h>
+    #define YA_DRAW_SORT_PREFETCH 1
+#endif
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr uint32_t kRadixBits    = 11;
+constexpr uint32_t kRadixSize    = 1u << kRadixBits;
+constexpr uint32_t kMaxDigits    = (64 + kRadixBits - 1) / kRadixBits;
+constexpr size_t   kMinMeshSlots = 64;
+constexpr size_t   kGatherAhead  = 8;
+
+size_t hashMesh(const Mesh* mesh, size_t mask)
+{
+    const auto bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(mesh));
+    return static_cast<size_t>(((bits >> 4) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+void resetMeshTable(RenderDrawSortScratch& scratch, size_t slotCount)
+{
+    scratch.meshSlots.assign(slotCount, nullptr);
+    scratch.meshIds.assign(slotCount, 0);
+}
+
+/// Dense id for @p mesh in first-seen order. Returns false once the id space
+/// or the table is exhausted.
+bool lookupMeshId(RenderDrawSortScratch& scratch, const Mesh* mesh, uint32_t& nextId, uint32_t& outId)
+{
+    // Keep the table at most half full.
+    if ((static_cast<size_t>(nextId) + 1) * 2 > scratch.meshSlots.size()) {
+        std::vector<const Mesh*> oldSlots = std::move(scratch.meshSlots);
+        std::vector<uint32_t>    oldIds   = std::move(scratch.meshIds);
+        resetMeshTable(scratch, oldSlots.size() * 2);
+        const size_t mask = scratch.meshSlots.size() - 1;
+        for (size_t slot = 0; slot < oldSlots.size(); ++slot) {
+            if (!oldSlots[slot]) {
+                continue;
+            }
+            size_t probe = hashMesh(oldSlots[slot], mask);
+            while (scratch.meshSlots[probe]) {
+                probe = (probe + 1) & mask;
+            }
+            scratch.meshSlots[probe] = oldSlots[slot];
+            scratch.meshIds[probe]   = oldIds[slot];
+        }
+    }
+
+    const size_t mask  = scratch.meshSlots.size() - 1;
+    size_t       probe = hashMesh(mesh, mask);
+    for (;;) {
+        const Mesh* slotMesh = scratch.meshSlots[probe];
+        if (slotMesh == mesh) {
+            outId = scratch.meshIds[probe];
+            return true;
+        }
+        if (!slotMesh) {
+            if (nextId > draw_sort_key::kMaxMeshId) {
+                return false;
+            }
+            scratch.meshSlots[probe] = mesh;
+            scratch.meshIds[probe]   = nextId;
+            outId                    = nextId++;
+            return true;
+        }
+        probe = (probe + 1) & mask;
+    }
+}
+
+/// Stable LSD sort of the low @p keyBits of every entry key.
+void radixSort(std::vector<RenderDrawSortScratch::Entry>& entries,
+               std::vector<RenderDrawSortScratch::Entry>& swap,
+               uint32_t                                   keyBits)
+{
+    const size_t   count      = entries.size();
+    const uint32_t digitCount = (keyBits + kRadixBits - 1) / kRadixBits;
+    swap.resize(count);
+
+    // 11-bit digits: 8 KiB per histogram stays in L1 while scattering.
+    thread_local std::array<std::array<uint32_t, kRadixSize>, kMaxDigits> histograms;
+    for (uint32_t digit = 0; digit < digitCount; ++digit) {
+        histograms[digit].fill(0);
+    }
+    for (const auto& entry : entries) {
+        uint64_t key = entry.key;
+        for (uint32_t digit = 0; digit < digitCount; ++digit) {
+            ++histograms[digit][key & (kRadixSize - 1)];
+            key >>= kRadixBits;
+        }
+    }
+
+    auto* src = entries.data();
+    auto* dst = swap.data();
+    for (uint32_t digit = 0; digit < digitCount; ++digit) {
+        auto&          histogram = histograms[digit];
+        const uint32_t shift     = digit * kRadixBits;
+        // Every key shares this digit: the pass would be an identity copy.
+        if (histogram[(src[0].key >> shift) & (kRadixSize - 1)] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (auto& bucketCount : histogram) {
+            const uint32_t bucketSize = bucketCount;
+            bucketCount               = offset;
+            offset += bucketSize;
+        }
+        for (size_t index = 0; index < count; ++index) {
+            const auto& entry = src[index];
+            dst[histogram[(entry.key >> shift) & (kRadixSize - 1)]++] = entry;
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != entries.data()) {
+        std::memcpy(entries.data(), src, count * sizeof(RenderDrawSortScratch::Entry));
+    }
+}
+
+} // namespace
+
+namespace draw_sort_key
+{
+
+uint32_t quantizeDepth(float depth)
+{
+    // Negative and NaN depths clamp to the nearest value.
+    if (!(depth > 0.0f)) {
+        return 0;
+    }
+    return std::bit_cast<uint32_t>(depth) >> (32 - kDepthBits);
+}
+
+} // namespace draw_sort_key
+
+void sortDrawItemsByKey(std::vector<RenderDrawItem>& items, EDrawSortMode mode, RenderDrawSortScratch& scratch)
+{
+    if (items.size() < 2) {
+        return;
+    }
+    if (items.size() > UINT32_MAX) {
+        sortDrawItemsByComparator(items, mode);
+        return;
+    }
+
+    const bool bUsesMaterial = mode != EDrawSortMode::MeshFrontToBack;
+    resetMeshTable(scratch, std::max(kMinMeshSlots, scratch.meshSlots.size()));
+    uint32_t nextMeshId  = 0;
+    uint32_t maxMaterial = 0;
+
+    // First pass: dense mesh ids (parked in the key) and field ranges.
+    auto& entries = scratch.entries;
+    entries.resize(items.size());
+    for (size_t index = 0; index < items.size(); ++index) {
+        const auto& item   = items[index];
+        uint32_t    meshId = 0;
+        if ((bUsesMaterial && item.materialIndex > draw_sort_key::kMaxMaterialIndex) ||
+            !lookupMeshId(scratch, item.mesh, nextMeshId, meshId)) {
+            sortDrawItemsByComparator(items, mode);
+            return;
+        }
+        maxMaterial    = std::max(maxMaterial, bUsesMaterial ? item.materialIndex : 0u);
+        entries[index] = {.key = meshId, .index = static_cast<uint32_t>(index)};
+    }
+
+    // Second pass: pack each field at its used width.
+    const uint32_t meshBits     = static_cast<uint32_t>(std::bit_width(nextMeshId - 1));
+    const uint32_t materialBits = static_cast<uint32_t>(std::bit_width(maxMaterial));
+    constexpr uint32_t depthBits = draw_sort_key::kDepthBits;
+    constexpr uint64_t depthMask = (1ull << depthBits) - 1;
+    if (mode == EDrawSortMode::BackToFront) {
+        for (auto& entry : entries) {
+            const auto&    item     = items[entry.index];
+            const uint64_t inverted = ~static_cast<uint64_t>(draw_sort_key::quantizeDepth(item.sortKey)) & depthMask;
+            entry.key = (((inverted << materialBits) | item.materialIndex) << meshBits) | entry.key;
+        }
+    }
+    else {
+        for (auto& entry : entries) {
+            const auto&    item     = items[entry.index];
+            const uint64_t material = bUsesMaterial ? item.materialIndex : 0u;
+            entry.key = (((material << meshBits) | entry.key) << depthBits) | draw_sort_key::quantizeDepth(item.sortKey);
+        }
+    }
+
+    radixSort(entries, scratch.swap, materialBits + meshBits + depthBits);
+
+    // The gather is a random read of whole items; prefetch a few ahead.
+    auto&        gathered = scratch.gathered;
+    const size_t count    = entries.size();
+    gathered.resize(count);
+    for (size_t index = 0; index < count; ++index) {
+#if YA_DRAW_SORT_PREFETCH
+        if (index + kGatherAhead < count) {
+            _mm_prefetch(reinterpret_cast<const char*>(&items[entries[index + kGatherAhead].index]), _MM_HINT_T0);
+        }
+#endif
+        gathered[index] = items[entries[index].index];
+    }
+    items.swap(gathered);
+}
+
+void sortDrawItemsByComparator(std::vector<RenderDrawItem>& items, EDrawSortMode mode)
+{
+    switch (mode) {
+    case EDrawSortMode::MaterialMeshFrontToBack:
+        std::sort(items.begin(), items.end(), [](const RenderDrawItem& a, const RenderDrawItem& b) {
+            if (a.materialIndex != b.materialIndex) {
+                return a.materialIndex < b.materialIndex;
+            }
+            if (a.mesh != b.mesh) {
+                return a.mesh < b.mesh;
+            }
+            return a.sortKey < b.sortKey;
+        });
+        break;
+    case EDrawSortMode::MeshFrontToBack:
+        std::sort(items.begin(), items.end(), [](const RenderDrawItem& a, const RenderDrawItem& b) {
+            if (a.mesh != b.mesh) {
+                return a.mesh < b.mesh;
+            }
+            return a.sortKey < b.sortKey;
+        });
+        break;
+    case EDrawSortMode::BackToFront:
+        std::sort(items.begin(), items.end(), [](const RenderDrawItem& a, const RenderDrawItem& b) {
+            if (a.sortKey != b.sortKey) {
+                return a.sortKey > b.sortKey;
+            }
+            if (a.materialIndex != b.materialIndex) {
+                return a.materialIndex < b.materialIndex;
+            }
+            return a.mesh < b.mesh;
+        });
+        break;
+    }
+}
+
+} // namespace ya
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "Render3D/RenderFrameData.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ya
+{
+
+/// Draw ordering for one bucket of extracted draw items.
+enum class EDrawSortMode : uint8_t
+{
+    MaterialMeshFrontToBack, // Opaque: material, then mesh, then nearest first
+    MeshFrontToBack,         // Material-less buckets: mesh, then nearest first
+    BackToFront,             // Transparent: farthest first, then material and mesh
+};
+
+/**
+ * @brief Packed 64-bit draw sort key
+ *
+ * Front-to-back modes pack, most significant first:
+ *   material | mesh | depth
+ * and BackToFront packs inverted depth | material | mesh. Depth is the top
+ * kDepthBits of the float sort key: a non-negative float's bit pattern is
+ * monotonic in its value, so truncation keeps depth order at ~2^-11 relative
+ * precision. Mesh ids are dense per sort (first-seen order), and every field
+ * is only as wide as the largest value in the bucket, so a typical bucket
+ * needs three or four radix passes instead of six. Ties keep extraction
+ * order because the radix sort is stable.
+ */
+namespace draw_sort_key
+{
+
+inline constexpr uint32_t kDepthBits        = 20;
+inline constexpr uint32_t kMaxMaterialIndex = (1u << 16) - 1u;
+inline constexpr uint32_t kMaxMeshId        = (1u << 20) - 1u;
+
+/// Quantize a non-negative sort value (distance squared) to kDepthBits.
+[[nodiscard]] YA_RENDER_3D_API uint32_t quantizeDepth(float depth);
+
+} // namespace draw_sort_key
+
+/// Reusable buffers for sortDrawItemsByKey(); keep one per thread so
+/// steady-state frames do not allocate.
+struct RenderDrawSortScratch
+{
+    struct Entry
+    {
+        uint64_t key   = 0;
+        uint32_t index = 0;
+    };
+
+    std::vector<Entry>          entries;
+    std::vector<Entry>          swap;
+    std::vector<RenderDrawItem> gathered;
+    std::vector<const Mesh*>    meshSlots; // Open-addressed mesh -> id table
+    std::vector<uint32_t>       meshIds;
+};
+
+/**
+ * @brief Sort a draw bucket through packed keys and an LSD radix sort
+ *
+ * Builds one {key, index} pair per item, radix-sorts the 16-byte pairs
+ * with 11-bit digits (digits shared by every key are skipped), then gathers
+ * the items once. Item `sortKey` must already hold the view depth. Buckets
+ * whose material index or mesh count does not fit the key fall back to
+ * sortDrawItemsByComparator().
+ */
+YA_RENDER_3D_API void sortDrawItemsByKey(std::vector<RenderDrawItem>& items,
+                                         EDrawSortMode                mode,
+                                         RenderDrawSortScratch&       scratch);
+
+/// Reference ordering with std::sort over whole items (mesh order is by pointer).
+YA_RENDER_3D_API void sortDrawItemsByComparator(std::vector<RenderDrawItem>& items, EDrawSortMode mode);
+
+} // namespace ya
@@ -6,6 +6,7 @@
 #include "Common.Limits.slang.h"
 
 #include <glm/glm.hpp>
+#include <algorithm>
 #include <array>
 #include <span>
 #include <vector>
@@ -15,15 +16,9 @@ namespace ya
 
 using slang_types::Common::Limits::MAX_BONE_COUNT;
 
-struct RenderSkinningPalette
-{
-    std::array<glm::mat4, MAX_BONE_COUNT> boneMatrices{};
-
-    RenderSkinningPalette()
-    {
-        boneMatrices.fill(glm::mat4(1.0f));
-    }
-};
+/// Initial per-flight skinning buffer size, in bone matrices: room for 16
+/// full-size palettes before the first grow.
+inline constexpr uint32_t INITIAL_SKINNING_MATRIX_CAPACITY = 16u * MAX_BONE_COUNT;
 
 /// A single renderable instance snapshot — everything the draw call needs.
 struct RenderDrawItem
@@ -34,7 +29,9 @@ struct RenderDrawItem
     uint32_t  materialIndex;   // material->getIndex(), used for descriptor set lookup
     uint32_t  entityId  = 0;   // raw entt entity handle, written by the entity-id pick pass
     float     sortKey;         // distance to camera (or other sort criterion)
-    int32_t   skinningPaletteIndex = -1; // -1 means static draw, otherwise index into RenderFrameData::skinningPalettes
+    int32_t   skinningPaletteIndex = -1; // -1 means static draw, otherwise first matrix of the palette in RenderFrameData::skinningBoneMatrices
+    uint32_t  lod       = 0;   // Mesh LOD to draw, picked by the extractor from screen size
+    uint32_t  pointShadowMask = ~0u; // Bit i: may cast into point light i's shadow (extractor range query)
 };
 
 /// Read-only view over extracted draw candidates.
@@ -82,6 +79,7 @@ struct DrawPacket
     uint32_t          materialIndex   = 0;
     uint32_t          firstInstance   = 0;
     uint32_t          instanceCount   = 0;
+    uint32_t          lod             = 0;
     float             sortKey         = 0.0f;
     bool              bSkinned        = false;
 
@@ -96,14 +94,11 @@ struct DrawPacket
 /// The extractor currently sorts opaque candidates by material and mesh. This
 /// helper preserves that order and only groups adjacent candidates with the
 /// same binding identity; it never reorders or owns the candidate snapshot.
-[[nodiscard]] inline std::vector<DrawPacket> buildDrawPackets(DrawCandidateView candidates,
-                                                               bool               bSkinned)
+/// Packets are appended to @p outPackets so callers can reuse its capacity.
+inline void buildDrawPackets(DrawCandidateView        candidates,
+                             bool                     bSkinned,
+                             std::vector<DrawPacket>& outPackets)
 {
-    std::vector<DrawPacket> packets;
-    if (candidates.empty()) {
-        return packets;
-    }
-
     size_t groupBegin = 0;
     while (groupBegin < candidates.size()) {
         const auto& first = candidates[groupBegin];
@@ -112,7 +107,8 @@ struct DrawPacket
             const auto& current = candidates[groupEnd];
             if (current.mesh != first.mesh ||
                 current.material != first.material ||
-                current.materialIndex != first.materialIndex) {
+                current.materialIndex != first.materialIndex ||
+                current.lod != first.lod) {
                 break;
             }
             ++groupEnd;
@@ -120,22 +116,60 @@ struct DrawPacket
 
         const auto group = DrawCandidateView{
             std::span<const RenderDrawItem>(candidates.data() + groupBegin, groupEnd - groupBegin)};
-        packets.push_back(DrawPacket{
+        outPackets.push_back(DrawPacket{
             .candidates    = group,
             .mesh          = first.mesh,
             .material      = first.material,
             .materialIndex = first.materialIndex,
             .firstInstance = static_cast<uint32_t>(groupBegin),
             .instanceCount = static_cast<uint32_t>(groupEnd - groupBegin),
+            .lod           = first.lod,
             .sortKey       = first.sortKey,
             .bSkinned      = bSkinned,
         });
         groupBegin = groupEnd;
     }
+}
 
+[[nodiscard]] inline std::vector<DrawPacket> buildDrawPackets(DrawCandidateView candidates,
+                                                               bool               bSkinned)
+{
+    std::vector<DrawPacket> packets;
+    buildDrawPackets(candidates, bSkinned, packets);
     return packets;
 }
 
+/// Per-instance record read by instanced draw shaders (std430 layout).
+///
+/// Mirrors `DrawInstance` in DeferredRender/GBufferPass_PBR.slang.
+struct DrawInstanceData
+{
+    glm::mat4 worldMatrix{1.0f};
+    uint32_t  entityId             = 0;
+    int32_t   skinningPaletteIndex = -1;
+    uint32_t  _pad0                = 0;
+    uint32_t  _pad1                = 0;
+};
+static_assert(sizeof(DrawInstanceData) == 80, "DrawInstanceData must match the std430 shader struct");
+
+/// Pack one instance record per candidate, in candidate order.
+///
+/// Record `i` belongs to candidate `i`, so a packet built from the same range
+/// draws `[packet.firstInstance, packet.firstInstance + packet.instanceCount)`
+/// of the packed array. @p outInstances must hold `candidates.size()` records.
+inline void packDrawInstances(DrawCandidateView candidates, std::span<DrawInstanceData> outInstances)
+{
+    const size_t count = std::min(candidates.size(), outInstances.size());
+    for (size_t index = 0; index < count; ++index) {
+        const auto& item    = candidates[index];
+        outInstances[index] = DrawInstanceData{
+            .worldMatrix          = item.worldMatrix,
+            .entityId             = item.entityId,
+            .skinningPaletteIndex = item.skinningPaletteIndex,
+        };
+    }
+}
+
 struct RenderShadingDrawBuckets
 {
     std::vector<RenderDrawItem> pbrDrawItems;
@@ -202,10 +236,17 @@ struct RenderFrameData
     // ═══════════════════════════════════════════════════════════════
     // Draw lists (bucketed by mesh class, then shading model)
     // ═══════════════════════════════════════════════════════════════
+    // Camera-visible draws, frustum culled and sorted by the extractor.
     RenderMeshClassDrawBuckets drawBuckets;
+    // Every extracted static draw, unculled and unsorted: shadow casters
+    // outside the camera frustum still cast into it.
+    RenderShadingDrawBuckets staticShadowCasters;
+    uint32_t                 culledDrawCount = 0;
 
-    // Animation / Skinning snapshot data.
-    std::vector<RenderSkinningPalette> skinningPalettes;
+    // Animation / Skinning snapshot data: every skinned instance's bone
+    // matrices back to back, only as many as its skeleton has bones. A draw's
+    // skinningPaletteIndex is the offset of its first matrix.
+    std::vector<glm::mat4> skinningBoneMatrices;
 
     // ═══════════════════════════════════════════════════════════════
     // Frame constants
@@ -219,9 +260,15 @@ struct RenderFrameData
     void clear()
     {
         drawBuckets.clear();
-        skinningPalettes.clear();
+        staticShadowCasters.clear();
+        skinningBoneMatrices.clear();
+        culledDrawCount = 0;
     }
 
+    /// Skinned draws are never camera culled, so the camera list is also the
+    /// shadow caster list.
+    [[nodiscard]] const RenderShadingDrawBuckets& skinnedShadowCasters() const { return drawBuckets.skinnedMeshes; }
+
     /// Build a backward-compatible FrameContext for systems that haven't migrated yet.
     [[nodiscard]] FrameContext toFrameContext() const
     {
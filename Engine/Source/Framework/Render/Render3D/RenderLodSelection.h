@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Resource/Core/EngineMeshData.h"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+
+namespace ya
+{
+
+/// Screen-space LOD thresholds shared by every view.
+struct LodSelectionSettings
+{
+    /// Coarsest LOD whose simplification error projects below this many pixels.
+    float maxPixelError = 1.0f;
+    /// Fractional band around maxPixelError inside which the previous LOD is
+    /// kept, so objects sitting at a threshold do not flicker between levels.
+    float hysteresis    = 0.25f;
+};
+
+namespace render_lod
+{
+
+/**
+ * @brief Pixels covered by one world unit at @p distance from the camera
+ *
+ * Perspective projections scale with proj[1][1] / distance; orthographic
+ * ones (proj[3][3] == 1) are distance independent.
+ */
+[[nodiscard]] inline float pixelsPerWorldUnit(const glm::mat4& projection, float viewportHeight, float distance)
+{
+    const float halfHeight = 0.5f * viewportHeight * std::abs(projection[1][1]);
+    if (projection[3][3] == 1.0f) {
+        return halfHeight;
+    }
+    return halfHeight / std::max(distance, 1e-4f);
+}
+
+/**
+ * @brief Pick the coarsest LOD whose projected error stays under the threshold
+ *
+ * @param lods           Mesh LOD chain; `error` is relative to the mesh extent.
+ * @param pixelsPerMesh  Projected size of the mesh extent, in pixels.
+ * @param previousLod    LOD this object drew with last frame (any value when new).
+ *
+ * The previous LOD is kept while its error stays within
+ * maxPixelError * (1 ± hysteresis); otherwise the result snaps to the nearest
+ * LOD that satisfies that band.
+ */
+[[nodiscard]] inline uint32_t selectLod(std::span<const MeshLod>    lods,
+                                        float                       pixelsPerMesh,
+                                        uint32_t                    previousLod,
+                                        const LodSelectionSettings& settings)
+{
+    if (lods.size() <= 1) {
+        return 0;
+    }
+
+    const auto coarsestWithin = [&](float threshold) {
+        uint32_t lod = 0;
+        for (uint32_t level = 1; level < lods.size(); ++level) {
+            if (lods[level].error * pixelsPerMesh > threshold) {
+                break;
+            }
+            lod = level;
+        }
+        return lod;
+    };
+
+    const float    hysteresis = std::clamp(settings.hysteresis, 0.0f, 0.95f);
+    const uint32_t strict     = coarsestWithin(settings.maxPixelError * (1.0f - hysteresis));
+    const uint32_t loose      = coarsestWithin(settings.maxPixelError * (1.0f + hysteresis));
+    return std::clamp(previousLod, strict, loose);
+}
+
+} // namespace render_lod
+
+/**
+ * @brief LOD each (view, entity) drew with last time, for hysteresis
+ *
+ * Owned by whoever drives extraction. Entity ids only mean something within
+ * one scene, so the owner clears it whenever the scene changes.
+ */
+struct LodHistory
+{
+    struct Entry
+    {
+        uint32_t lod       = 0;
+        uint64_t lastFrame = 0;
+    };
+
+    /// Entries unseen for this many frames are dropped by prune().
+    static constexpr uint64_t MAX_AGE = 240;
+
+    std::unordered_map<uint64_t, Entry> entries;
+
+    [[nodiscard]] static uint64_t key(uint32_t viewOwner, uint32_t entityId)
+    {
+        return (static_cast<uint64_t>(viewOwner) << 32) | entityId;
+    }
+
+    /// selectLod() against the LOD @p entryKey drew with last time; remembers the result.
+    uint32_t select(uint64_t entryKey, std::span<const MeshLod> lods, float pixelsPerMesh,
+                    const LodSelectionSettings& settings, uint64_t frameIndex)
+    {
+        auto [it, bInserted] = entries.try_emplace(entryKey);
+        // A new entry has no history; start from the strict choice.
+        const uint32_t lod   = render_lod::selectLod(lods, pixelsPerMesh, bInserted ? 0 : it->second.lod, settings);
+        it->second           = Entry{.lod = lod, .lastFrame = frameIndex};
+        return lod;
+    }
+
+    void prune(uint64_t frameIndex)
+    {
+        std::erase_if(entries, [frameIndex](const auto& entry) {
+            return entry.second.lastFrame + MAX_AGE < frameIndex;
+        });
+    }
+
+    void clear() { entries.clear(); }
+};
+
+} // namespace ya
@@ -6,6 +6,7 @@
 #include "RHI/Core/RenderTexture.h"
 #include "RHI/Core/RenderResourceFactory.h"
 #include "RHI/Core/Swapchain.h"
+#include "RHI/Shader/ShaderBatchCompiler.h"
 #include "Render3D/Pipelines/BasicPostprocessing.h"
 #include "Resource/AssetManager.h"
 #include "Core/Common/DeferredDeletionQueue.h"
@@ -20,6 +21,10 @@ namespace ya
 namespace
 {
 
+/// Permutations this run compiled or loaded, accumulated for the offline
+/// ShaderCompiler so later starts only read cached SPIR-V.
+constexpr const char* SHADER_PERMUTATION_MANIFEST_PATH = "Engine/Intermediate/Shader/Permutations.txt";
+
 std::shared_ptr<RenderTexture> createPresentationRenderTexture(IRender& render, VulkanSwapChain& swapchain, uint32_t imageIndex)
 {
     const auto& swapchainCI = swapchain.getCreateInfo();
@@ -160,7 +165,11 @@ void RenderRuntime::initShaderSystems()
         ShaderDesc{.shaderName = "Misc/pbr_generate_brdf_lut.slang"},
     });
     _deleter.push("ShaderStorage", [this](void*)
-                  { _shaderStorage.reset(); });
+                  {
+        if (!mergeShaderManifest(SHADER_PERMUTATION_MANIFEST_PATH, _shaderStorage->getLoadedShaderDescs())) {
+            YA_CORE_WARN("Failed to update shader permutation manifest: {}", SHADER_PERMUTATION_MANIFEST_PATH);
+        }
+        _shaderStorage.reset(); });
 }
 
 void RenderRuntime::initDiagnostics(const InitDesc& desc)
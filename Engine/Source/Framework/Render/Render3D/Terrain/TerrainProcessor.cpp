@@ -1,14 +1,18 @@
 #include "Render3D/Terrain/TerrainProcessor.h"
 
 #include "Core/Log.h"
+#include "Core/System/VirtualFileSystem.h"
 #include "ECS/Systems/Components/TerrainComponent.h"
 #include "RHI/Render.h"
 #include "Render3D/Terrain/TerrainMeshBuilder.h"
 #include "Resource/AssetManager.h"
+#include "Resource/Core/DerivedData/DerivedDataCache.h"
+#include "Resource/Core/DerivedData/MeshDataCodec.h"
 #include "Scene/Core/Scene.h"
 
 #include <algorithm>
 #include <format>
+#include <optional>
 
 namespace ya
 {
@@ -92,6 +96,55 @@ std::string buildTerrainDerivedKey(const TerrainComponent& terrain, uint64_t hei
                        terrain._gridResolution);
 }
 
+/// Bump when buildTerrainMeshData output changes for the same inputs.
+constexpr uint32_t TERRAIN_MESH_DDC_VERSION = 1;
+
+/// Persistent key for the built terrain mesh: height map content and import
+/// meta plus every build parameter. Invalid when the source cannot be read.
+DerivedDataKey buildTerrainCacheKey(AssetManager& assets, const TerrainComponent& terrain)
+{
+    auto* vfs = VirtualFileSystem::get();
+    if (!vfs) {
+        return {};
+    }
+    const std::string&    heightMapPath = terrain._heightMapRef.getPath();
+    DerivedDataKeyBuilder builder("TerrainMesh", TERRAIN_MESH_DDC_VERSION);
+    if (!builder.sourceFile(vfs->translatePath(heightMapPath))) {
+        return {};
+    }
+    builder.string(AssetManager::normalizeAssetPath(heightMapPath))
+        .meta(assets.getOrLoadMeta(heightMapPath))
+        .value(terrain._size.x)
+        .value(terrain._size.y)
+        .value(terrain._heightScale)
+        .value(terrain._heightOffset)
+        .value(clampTerrainGridResolution(terrain._gridResolution));
+    return builder.finish();
+}
+
+std::optional<EngineMeshData> loadCachedTerrainMesh(const DerivedDataKey& cacheKey)
+{
+    if (!cacheKey.isValid()) {
+        return std::nullopt;
+    }
+    auto payload = DerivedDataCache::get().load(cacheKey);
+    if (!payload) {
+        return std::nullopt;
+    }
+    BinaryReader reader(*payload);
+    return readMeshData(reader);
+}
+
+void storeCachedTerrainMesh(const DerivedDataKey& cacheKey, const EngineMeshData& meshData)
+{
+    if (!cacheKey.isValid()) {
+        return;
+    }
+    BinaryWriter writer;
+    writeMeshData(writer, meshData);
+    DerivedDataCache::get().store(cacheKey, writer.bytes);
+}
+
 } // namespace
 
 void TerrainProcessor::init()
@@ -335,7 +388,32 @@ void TerrainProcessor::resolvePendingTerrain(Scene* scene)
             return;
         }
 
+        auto bindTerrainMesh = [&](const EngineMeshData& meshData) {
+            auto resource            = std::make_shared<TerrainDerivedResource>();
+            auto* render = getRender();
+            YA_CORE_ASSERT(render, "TerrainProcessor mesh creation requires render backend");
+            resource->mesh           = Mesh::create(*render, meshData);
+            resource->heightMapVersion = heightMapVersion;
+            resource->lastUsedFrame  = currentFrame;
+            _terrainDerivedResources[derivedKey] = resource;
+
+            state.currentDerivedKey  = derivedKey;
+            state.boundResource      = resource;
+            state.pendingHeightMapHandle   = 0;
+            state.lastBuiltHeightMapVersion = heightMapVersion;
+            state.state                    = TerrainRuntimeState::EResolveState::Ready;
+            state.lastCompletedAuthoringVersion = terrain.getAuthoringVersion();
+            _activeTerrain.erase(entity);
+        };
+
         if (state.pendingHeightMapHandle == 0) {
+            // A previous session (or another terrain) may already have built
+            // this exact mesh: skip both the height map decode and the build.
+            if (auto cachedMesh = loadCachedTerrainMesh(buildTerrainCacheKey(*assets, terrain))) {
+                bindTerrainMesh(*cachedMesh);
+                return;
+            }
+
             const auto handle = assets->loadTextureBatchIntoMemory(AssetManager::TextureBatchMemoryLoadRequest{
                 .filepaths   = {terrain._heightMapRef.getPath()},
                 .colorSpace  = AssetManager::ETextureColorSpace::Linear,
@@ -378,7 +456,7 @@ void TerrainProcessor::resolvePendingTerrain(Scene* scene)
             return;
         }
 
-        auto meshData = buildTerrainMeshData(TerrainMeshBuildDesc{
+        const auto meshData = buildTerrainMeshData(TerrainMeshBuildDesc{
             .name           = std::format("terrain_{}", terrain._heightMapRef.getPath()),
             .size           = terrain._size,
             .heightScale    = terrain._heightScale,
@@ -389,21 +467,8 @@ void TerrainProcessor::resolvePendingTerrain(Scene* scene)
             .heights        = heights,
         });
 
-        auto resource            = std::make_shared<TerrainDerivedResource>();
-        auto* render = getRender();
-        YA_CORE_ASSERT(render, "TerrainProcessor mesh creation requires render backend");
-        resource->mesh           = Mesh::create(*render, meshData);
-        resource->heightMapVersion = heightMapVersion;
-        resource->lastUsedFrame  = currentFrame;
-        _terrainDerivedResources[derivedKey] = resource;
-
-        state.currentDerivedKey  = derivedKey;
-        state.boundResource      = resource;
-        state.pendingHeightMapHandle   = 0;
-        state.lastBuiltHeightMapVersion = heightMapVersion;
-        state.state                    = TerrainRuntimeState::EResolveState::Ready;
-        state.lastCompletedAuthoringVersion = terrain.getAuthoringVersion();
-        _activeTerrain.erase(entity);
+        storeCachedTerrainMesh(buildTerrainCacheKey(*assets, terrain), meshData);
+        bindTerrainMesh(meshData);
     };
 
     while (!_dirtyTerrainQueue.empty()) {
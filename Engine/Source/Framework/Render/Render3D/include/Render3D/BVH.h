@@ -1,2 +0,0 @@
-#pragma once
-#include "../../BVH.h"
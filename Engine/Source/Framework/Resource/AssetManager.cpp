@@ -1,5 +1,6 @@
 #include "Resource/AssetManager.h"
 
+#include "Resource/Manager/AssetImportPipeline.h"
 #include "Resource/Manager/AssetModelManager.h"
 #include "Resource/Manager/AssetTextureManager.h"
 
@@ -44,6 +45,7 @@ AssetManager* AssetManager::get()
 AssetManager::AssetManager()
     : _textureManager(std::make_unique<AssetTextureManager>(*this))
     , _modelManager(std::make_unique<AssetModelManager>(*this))
+    , _importPipeline(std::make_unique<AssetImportPipeline>())
 {
 }
 
@@ -79,6 +81,9 @@ void AssetManager::clearCache()
     YA_PROFILE_FUNCTION_LOG();
     _textureManager->clear();
     _modelManager->clear();
+    // After the managers bumped their clear generation: cancelled uploads
+    // then see a stale generation and drop their results.
+    _importPipeline->cancelWaiting();
     _metaCache.clear();
 
     YA_CORE_INFO("AssetManager cleared");
@@ -180,6 +185,16 @@ const AssetModelManager& AssetManager::modelManager() const
     return *_modelManager;
 }
 
+AssetImportPipeline& AssetManager::importPipeline()
+{
+    return *_importPipeline;
+}
+
+const AssetImportPipeline& AssetManager::importPipeline() const
+{
+    return *_importPipeline;
+}
+
 void AssetManager::dispatchToGameThread(std::function<void()> task)
 {
     if (!task) {
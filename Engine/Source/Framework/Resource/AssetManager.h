@@ -18,6 +18,7 @@ struct Importer;
 namespace ya
 {
 
+class AssetImportPipeline;
 class AssetModelManager;
 class AssetTextureManager;
 struct IRender;
@@ -79,6 +80,8 @@ class YA_RESOURCE_API AssetManager : public IResourceCache
 
     std::unique_ptr<AssetTextureManager> _textureManager;
     std::unique_ptr<AssetModelManager>   _modelManager;
+    // Declared after the managers: destroyed first, so no stage outlives them.
+    std::unique_ptr<AssetImportPipeline> _importPipeline;
     IRender*                             _render = nullptr;
 
   public:
@@ -220,6 +223,12 @@ class YA_RESOURCE_API AssetManager : public IResourceCache
     /// Check whether an async model load is still in flight.
     bool isModelLoadPending(const std::string& filepath) const;
 
+    /// Staged read/decode/post-process/upload pipeline shared by async
+    /// texture and model loads; exposes progress, per-stage throughput and
+    /// the in-flight memory budget.
+    AssetImportPipeline&       importPipeline();
+    const AssetImportPipeline& importPipeline() const;
+
     /// Release all cached textures (GPU images). Hosts call this before
     /// tearing down the render backend / VMA allocator so dedicated image
     /// allocations are freed while the device is still alive.
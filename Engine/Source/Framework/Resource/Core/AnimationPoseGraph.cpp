@@ -0,0 +1,558 @@
+#include "Resource/Core/AnimationPoseGraph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace ya
+{
+namespace
+{
+constexpr float ZERO_SCALE_EPSILON = 1e-6f;
+
+const SkeletonAnimationClip* findClip(const Skeleton& skeleton, uint32_t clipIndex)
+{
+    return clipIndex < skeleton.animations.size() ? &skeleton.animations[clipIndex] : nullptr;
+}
+
+/// Playback length of a clip node in seconds, 0 for empty clips.
+double clipSeconds(const Skeleton& skeleton, const PoseGraphNode& node)
+{
+    const SkeletonAnimationClip* clip = findClip(skeleton, node.clipIndex);
+    if (!clip || clip->duration <= 0.0 || node.speed <= 0.0f) {
+        return 0.0;
+    }
+    const double ticksPerSecond = clip->ticksPerSecond > 0.0 ? clip->ticksPerSecond : 1.0;
+    return clip->duration / ticksPerSecond / static_cast<double>(node.speed);
+}
+
+float parameterWeight(const AnimationGraphInstance& instance, uint32_t parameter)
+{
+    if (parameter >= instance.parameters.size()) {
+        return 1.0f;
+    }
+    return std::clamp(instance.parameters[parameter], 0.0f, 1.0f);
+}
+
+struct BlendSegment
+{
+    uint32_t lower = 0;
+    uint32_t upper = 0;
+    float    t     = 0.0f; // Weight of `upper`
+};
+
+BlendSegment findBlendSegment(const PoseGraphNode& node, float position)
+{
+    const auto& positions = node.blendPositions;
+    if (positions.empty() || position <= positions.front()) {
+        return {};
+    }
+    const auto last = static_cast<uint32_t>(positions.size() - 1);
+    if (position >= positions.back()) {
+        return {last, last, 0.0f};
+    }
+
+    const auto upper = static_cast<uint32_t>(std::distance(positions.begin(), std::upper_bound(positions.begin(), positions.end(), position)));
+    const float range = positions[upper] - positions[upper - 1];
+    return {upper - 1, upper, range > 0.0f ? (position - positions[upper - 1]) / range : 0.0f};
+}
+
+float machineFade(const AnimationGraphInstance::MachineState& machine)
+{
+    if (machine.previous == INVALID_POSE_GRAPH_INDEX || machine.fadeDuration <= 0.0f) {
+        return 1.0f;
+    }
+    return std::clamp(machine.fadeElapsed / machine.fadeDuration, 0.0f, 1.0f);
+}
+
+void resetNodeTimes(const AnimationPoseGraph& graph, AnimationGraphInstance& instance, uint32_t nodeIndex)
+{
+    if (nodeIndex >= graph.nodes.size()) {
+        return;
+    }
+    instance.nodeTimes[nodeIndex] = 0.0;
+    for (const uint32_t input : graph.nodes[nodeIndex].inputs) {
+        resetNodeTimes(graph, instance, input);
+    }
+}
+
+void advanceNode(const Skeleton& skeleton, AnimationGraphInstance& instance, uint32_t nodeIndex, float weight, double deltaSeconds, bool bTimeDriven)
+{
+    const AnimationPoseGraph& graph = *instance.graph;
+    if (nodeIndex >= graph.nodes.size() || weight <= 0.0f) {
+        return;
+    }
+
+    const PoseGraphNode& node       = graph.nodes[nodeIndex];
+    instance.nodeWeights[nodeIndex] = weight;
+    switch (node.type) {
+    case EPoseNodeType::Clip:
+    {
+        const SkeletonAnimationClip* clip = findClip(skeleton, node.clipIndex);
+        if (clip && !bTimeDriven) {
+            const double ticksPerSecond = clip->ticksPerSecond > 0.0 ? clip->ticksPerSecond : 1.0;
+            instance.nodeTimes[nodeIndex] += deltaSeconds * static_cast<double>(node.speed) * ticksPerSecond;
+        }
+        break;
+    }
+    case EPoseNodeType::BlendSpace1D:
+    {
+        if (node.inputs.empty()) {
+            break;
+        }
+        const float        position = node.parameter < instance.parameters.size() ? instance.parameters[node.parameter] : 0.0f;
+        const BlendSegment segment  = findBlendSegment(node, position);
+
+        // Samples play in step: one normalized phase, advanced at the blended
+        // length of the two active samples, drives every clip sample.
+        const double lowerSeconds = clipSeconds(skeleton, graph.nodes[node.inputs[segment.lower]]);
+        const double upperSeconds = clipSeconds(skeleton, graph.nodes[node.inputs[segment.upper]]);
+        const double seconds      = lowerSeconds + (upperSeconds - lowerSeconds) * static_cast<double>(segment.t);
+        double&      phase        = instance.nodeTimes[nodeIndex];
+        if (seconds > 0.0) {
+            phase = std::fmod(phase + deltaSeconds / seconds, 1.0);
+        }
+
+        for (size_t index = 0; index < node.inputs.size(); ++index) {
+            const uint32_t       input     = node.inputs[index];
+            const PoseGraphNode& inputNode = graph.nodes[input];
+            if (inputNode.type == EPoseNodeType::Clip) {
+                const SkeletonAnimationClip* clip = findClip(skeleton, inputNode.clipIndex);
+                instance.nodeTimes[input]         = clip ? phase * clip->duration : 0.0;
+            }
+        }
+
+        const float lowerWeight = weight * (1.0f - segment.t);
+        const float upperWeight = weight * segment.t;
+        advanceNode(skeleton, instance, node.inputs[segment.lower], lowerWeight, deltaSeconds, true);
+        if (segment.upper != segment.lower) {
+            advanceNode(skeleton, instance, node.inputs[segment.upper], upperWeight, deltaSeconds, true);
+        }
+        break;
+    }
+    case EPoseNodeType::Layer:
+    case EPoseNodeType::Additive:
+        if (node.inputs.size() == 2) {
+            advanceNode(skeleton, instance, node.inputs[0], weight, deltaSeconds, bTimeDriven);
+            advanceNode(skeleton, instance, node.inputs[1], weight * parameterWeight(instance, node.parameter), deltaSeconds, false);
+        }
+        break;
+    case EPoseNodeType::StateMachine:
+    {
+        auto& machine = instance.machines[nodeIndex];
+        if (machine.previous != INVALID_POSE_GRAPH_INDEX) {
+            machine.fadeElapsed += static_cast<float>(deltaSeconds);
+            if (machine.fadeElapsed >= machine.fadeDuration) {
+                machine.previous = INVALID_POSE_GRAPH_INDEX;
+            }
+        }
+        const float fade = machineFade(machine);
+        if (machine.current < node.inputs.size()) {
+            advanceNode(skeleton, instance, node.inputs[machine.current], weight * fade, deltaSeconds, false);
+        }
+        if (machine.previous < node.inputs.size()) {
+            advanceNode(skeleton, instance, node.inputs[machine.previous], weight * (1.0f - fade), deltaSeconds, false);
+        }
+        break;
+    }
+    }
+}
+
+struct EvaluationContext
+{
+    const AnimationPoseGraph& graph;
+    const Skeleton&           skeleton;
+    AnimationGraphInstance&   instance;
+    const AnimationPoseCache& cache;
+};
+
+void applyAdditive(const AnimationLocalPose& base,
+                   const AnimationLocalPose& additive,
+                   const AnimationLocalPose& reference,
+                   float                     weight,
+                   AnimationLocalPose&       out)
+{
+    const glm::quat identity(1.0f, 0.0f, 0.0f, 0.0f);
+    for (size_t nodeIndex = 0; nodeIndex < out.size(); ++nodeIndex) {
+        const SkeletonChannelSample& from  = reference[nodeIndex];
+        const SkeletonChannelSample& to    = additive[nodeIndex];
+        SkeletonChannelSample&       blend = out[nodeIndex];
+
+        const glm::quat deltaRotation = glm::conjugate(glm::normalize(from.rotation)) * glm::normalize(to.rotation);
+        const glm::vec3 deltaScale(std::fabs(from.scale.x) > ZERO_SCALE_EPSILON ? to.scale.x / from.scale.x : 1.0f,
+                                   std::fabs(from.scale.y) > ZERO_SCALE_EPSILON ? to.scale.y / from.scale.y : 1.0f,
+                                   std::fabs(from.scale.z) > ZERO_SCALE_EPSILON ? to.scale.z / from.scale.z : 1.0f);
+
+        blend.position = base[nodeIndex].position + (to.position - from.position) * weight;
+        blend.rotation = glm::normalize(base[nodeIndex].rotation * animation_codec::nlerp(identity, deltaRotation, weight));
+        blend.scale    = base[nodeIndex].scale * glm::mix(glm::vec3(1.0f), deltaScale, weight);
+    }
+}
+
+const AnimationLocalPose* evaluateNode(EvaluationContext& ctx, uint32_t nodeIndex)
+{
+    const PoseGraphNode& node      = ctx.graph.nodes[nodeIndex];
+    const size_t         nodeCount = ctx.skeleton.nodes.size();
+    AnimationPosePool&   pool      = ctx.instance.pool;
+    const auto&          weights   = ctx.instance.nodeWeights;
+
+    switch (node.type) {
+    case EPoseNodeType::Clip:
+        return &ctx.cache.getPose(ctx.instance.sampleEntries[nodeIndex]);
+    case EPoseNodeType::BlendSpace1D:
+    case EPoseNodeType::StateMachine:
+    {
+        // Both blend the (at most two) inputs that were given weight.
+        uint32_t active[2]   = {INVALID_POSE_GRAPH_INDEX, INVALID_POSE_GRAPH_INDEX};
+        uint32_t activeCount = 0;
+        for (const uint32_t input : node.inputs) {
+            if (weights[input] > 0.0f && activeCount < 2 && input != active[0]) {
+                active[activeCount++] = input;
+            }
+        }
+        if (activeCount < 2) {
+            return activeCount == 1 ? evaluateNode(ctx, active[0]) : nullptr;
+        }
+
+        AnimationLocalPose&       out  = pool.acquire(nodeCount);
+        const uint32_t            mark = pool.mark();
+        const AnimationLocalPose* lhs  = evaluateNode(ctx, active[0]);
+        const AnimationLocalPose* rhs  = evaluateNode(ctx, active[1]);
+        const float               t    = weights[active[1]] / (weights[active[0]] + weights[active[1]]);
+        if (!lhs || !rhs) {
+            return lhs ? lhs : rhs; // Keep the child's buffers held
+        }
+        AnimationPoseGraphEvaluator::blendLocalPoses(*lhs, *rhs, t, out);
+        pool.release(mark);
+        return &out;
+    }
+    case EPoseNodeType::Layer:
+    case EPoseNodeType::Additive:
+    {
+        const uint32_t overlayNode = node.inputs[1];
+        if (weights[overlayNode] <= 0.0f) {
+            return evaluateNode(ctx, node.inputs[0]);
+        }
+
+        AnimationLocalPose&       out     = pool.acquire(nodeCount);
+        const uint32_t            mark    = pool.mark();
+        const AnimationLocalPose* base    = evaluateNode(ctx, node.inputs[0]);
+        const AnimationLocalPose* overlay = evaluateNode(ctx, overlayNode);
+        const float               weight  = parameterWeight(ctx.instance, node.parameter);
+        if (!base || !overlay) {
+            return base; // Keep the child's buffers held
+        }
+        if (node.type == EPoseNodeType::Additive) {
+            applyAdditive(*base, *overlay, ctx.cache.getPose(ctx.instance.sampleEntries[nodeIndex]), weight, out);
+        }
+        else {
+            const std::vector<float>* mask = node.boneMask < ctx.graph.boneMasks.size() ? &ctx.graph.boneMasks[node.boneMask] : nullptr;
+            for (size_t index = 0; index < nodeCount; ++index) {
+                const float nodeWeight = weight * (mask ? (index < mask->size() ? (*mask)[index] : 0.0f) : 1.0f);
+                out[index]             = (*base)[index];
+                if (nodeWeight > 0.0f) {
+                    out[index].position = glm::mix((*base)[index].position, (*overlay)[index].position, nodeWeight);
+                    out[index].rotation = animation_codec::nlerp((*base)[index].rotation, (*overlay)[index].rotation, nodeWeight);
+                    out[index].scale    = glm::mix((*base)[index].scale, (*overlay)[index].scale, nodeWeight);
+                }
+            }
+        }
+        pool.release(mark);
+        return &out;
+    }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+// ── AnimationPoseGraph ─────────────────────────────────────────────────────
+
+uint32_t AnimationPoseGraph::addParameter(const FName& name, float defaultValue)
+{
+    parameterNames.push_back(name);
+    parameterDefaults.push_back(defaultValue);
+    return static_cast<uint32_t>(parameterNames.size() - 1);
+}
+
+uint32_t AnimationPoseGraph::findParameter(const FName& name) const
+{
+    const auto it = std::find(parameterNames.begin(), parameterNames.end(), name);
+    return it != parameterNames.end() ? static_cast<uint32_t>(std::distance(parameterNames.begin(), it)) : INVALID_POSE_GRAPH_INDEX;
+}
+
+uint32_t AnimationPoseGraph::addClip(uint32_t clipIndex, float speed, bool bLoop)
+{
+    nodes.push_back(PoseGraphNode{.type = EPoseNodeType::Clip, .clipIndex = clipIndex, .speed = speed, .bLoop = bLoop});
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+uint32_t AnimationPoseGraph::addBlendSpace1D(uint32_t parameter, std::vector<std::pair<float, uint32_t>> samples)
+{
+    std::sort(samples.begin(), samples.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    PoseGraphNode node{.type = EPoseNodeType::BlendSpace1D, .parameter = parameter};
+    for (const auto& [position, input] : samples) {
+        node.blendPositions.push_back(position);
+        node.inputs.push_back(input);
+    }
+    nodes.push_back(std::move(node));
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+uint32_t AnimationPoseGraph::addLayer(uint32_t base, uint32_t overlay, uint32_t boneMask, uint32_t weightParameter)
+{
+    nodes.push_back(PoseGraphNode{
+        .type      = EPoseNodeType::Layer,
+        .inputs    = {base, overlay},
+        .parameter = weightParameter,
+        .boneMask  = boneMask,
+    });
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+uint32_t AnimationPoseGraph::addAdditive(uint32_t base, uint32_t additiveClipNode, uint32_t weightParameter)
+{
+    nodes.push_back(PoseGraphNode{
+        .type      = EPoseNodeType::Additive,
+        .inputs    = {base, additiveClipNode},
+        .parameter = weightParameter,
+    });
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+uint32_t AnimationPoseGraph::addStateMachine(std::vector<uint32_t> states, uint32_t initialState)
+{
+    nodes.push_back(PoseGraphNode{
+        .type         = EPoseNodeType::StateMachine,
+        .inputs       = std::move(states),
+        .initialState = initialState,
+    });
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+uint32_t AnimationPoseGraph::addBoneMask(std::vector<float> nodeWeights)
+{
+    boneMasks.push_back(std::move(nodeWeights));
+    return static_cast<uint32_t>(boneMasks.size() - 1);
+}
+
+std::vector<float> AnimationPoseGraph::makeSubtreeMask(const Skeleton& skeleton, const FName& rootNodeName)
+{
+    std::vector<float> mask(skeleton.nodes.size(), 0.0f);
+    for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
+        // Parents precede their children in the node array.
+        const uint32_t parentIndex = skeleton.nodes[nodeIndex].parentIndex;
+        const bool     bRoot       = skeleton.nodes[nodeIndex].name == rootNodeName;
+        const bool     bInherited  = parentIndex < nodeIndex && mask[parentIndex] > 0.0f;
+        mask[nodeIndex]            = bRoot || bInherited ? 1.0f : 0.0f;
+    }
+    return mask;
+}
+
+// ── AnimationPosePool ──────────────────────────────────────────────────────
+
+AnimationLocalPose& AnimationPosePool::acquire(size_t nodeCount)
+{
+    if (_used == _buffers.size()) {
+        _buffers.emplace_back();
+    }
+    AnimationLocalPose& buffer = _buffers[_used++];
+    buffer.resize(nodeCount);
+    return buffer;
+}
+
+// ── AnimationPoseCache ─────────────────────────────────────────────────────
+
+size_t AnimationPoseCache::KeyHash::operator()(const Key& key) const
+{
+    size_t hash = std::hash<const void*>{}(key.skeleton);
+    hash ^= std::hash<uint32_t>{}(key.clipIndex) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<double>{}(key.clipTime) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+void AnimationPoseCache::beginFrame()
+{
+    _lookup.clear();
+    _entryCount = 0;
+    _stats      = {};
+}
+
+const AnimationLocalPose& AnimationPoseCache::getBindPose(const Skeleton& skeleton)
+{
+    // Skeletons are shared and immutable once built; the size check only
+    // guards against an address being reused by a different skeleton.
+    AnimationLocalPose& bindPose = _bindPoses[&skeleton];
+    if (bindPose.size() != skeleton.nodes.size()) {
+        SkeletonAnimationSampler::makeBindLocalPose(skeleton, bindPose);
+    }
+    return bindPose;
+}
+
+uint32_t AnimationPoseCache::request(const Skeleton& skeleton, uint32_t clipIndex, double time, bool bLoop)
+{
+    ++_stats.requestCount;
+
+    Key key{.skeleton = &skeleton, .clipIndex = INVALID_POSE_GRAPH_INDEX};
+    if (const SkeletonAnimationClip* clip = findClip(skeleton, clipIndex)) {
+        key.clipIndex = clipIndex;
+        if (clip->duration > 0.0) {
+            key.clipTime = bLoop ? SkeletonAnimationSampler::wrapTime(time, clip->duration) : std::clamp(time, 0.0, clip->duration);
+        }
+    }
+
+    const auto [it, bInserted] = _lookup.try_emplace(key, _entryCount);
+    if (!bInserted) {
+        return it->second;
+    }
+
+    if (_entryCount == _entries.size()) {
+        _entries.emplace_back();
+    }
+    Entry& entry   = _entries[_entryCount];
+    entry.key      = key;
+    entry.bindPose = &getBindPose(skeleton);
+    ++_stats.sampleCount;
+    return _entryCount++;
+}
+
+void AnimationPoseCache::sampleRange(uint32_t begin, uint32_t end)
+{
+    end = std::min(end, _entryCount);
+    for (uint32_t index = begin; index < end; ++index) {
+        Entry&          entry    = _entries[index];
+        const Skeleton& skeleton = *entry.key.skeleton;
+        entry.localPose          = *entry.bindPose;
+        if (entry.key.clipIndex == INVALID_POSE_GRAPH_INDEX) {
+            continue;
+        }
+
+        // Times are already wrapped / clamped into the clip.
+        if (const CompressedSkeletonClip* compressed = skeleton.getCompressedAnimation(entry.key.clipIndex)) {
+            SkeletonAnimationSampler::sampleLocalPose(*compressed, entry.key.clipTime, false, entry.cursor, entry.localPose);
+        }
+        else {
+            SkeletonAnimationSampler::sampleLocalPose(skeleton, skeleton.animations[entry.key.clipIndex], entry.key.clipTime, false, entry.localPose);
+        }
+    }
+}
+
+// ── AnimationGraphInstance ─────────────────────────────────────────────────
+
+void AnimationGraphInstance::reset(const AnimationPoseGraph& target)
+{
+    graph      = &target;
+    parameters = target.parameterDefaults;
+    nodeTimes.assign(target.nodes.size(), 0.0);
+    nodeWeights.assign(target.nodes.size(), 0.0f);
+    sampleEntries.assign(target.nodes.size(), 0);
+    machines.assign(target.nodes.size(), MachineState{});
+    for (size_t nodeIndex = 0; nodeIndex < target.nodes.size(); ++nodeIndex) {
+        machines[nodeIndex].current = target.nodes[nodeIndex].initialState;
+    }
+}
+
+bool AnimationGraphInstance::setParameter(const FName& name, float value)
+{
+    const uint32_t parameter = graph ? graph->findParameter(name) : INVALID_POSE_GRAPH_INDEX;
+    if (parameter == INVALID_POSE_GRAPH_INDEX) {
+        return false;
+    }
+    setParameter(parameter, value);
+    return true;
+}
+
+void AnimationGraphInstance::setParameter(uint32_t parameter, float value)
+{
+    if (parameter < parameters.size()) {
+        parameters[parameter] = value;
+    }
+}
+
+void AnimationGraphInstance::requestState(uint32_t machineNode, uint32_t state, float fadeSeconds)
+{
+    if (!graph || machineNode >= machines.size() || state >= graph->nodes[machineNode].inputs.size()) {
+        return;
+    }
+    MachineState& machine = machines[machineNode];
+    if (machine.current == state) {
+        return;
+    }
+
+    // A fade already in progress snaps: its outgoing state is dropped.
+    machine.previous     = fadeSeconds > 0.0f ? machine.current : INVALID_POSE_GRAPH_INDEX;
+    machine.current      = state;
+    machine.fadeElapsed  = 0.0f;
+    machine.fadeDuration = fadeSeconds;
+    resetNodeTimes(*graph, *this, graph->nodes[machineNode].inputs[state]);
+}
+
+// ── AnimationPoseGraphEvaluator ────────────────────────────────────────────
+
+void AnimationPoseGraphEvaluator::advance(const Skeleton& skeleton, AnimationGraphInstance& instance, float deltaSeconds)
+{
+    if (!instance.graph || !instance.graph->isValid()) {
+        return;
+    }
+    std::fill(instance.nodeWeights.begin(), instance.nodeWeights.end(), 0.0f);
+    advanceNode(skeleton, instance, instance.graph->rootNode, 1.0f, static_cast<double>(deltaSeconds), false);
+}
+
+void AnimationPoseGraphEvaluator::gather(const Skeleton& skeleton, AnimationGraphInstance& instance, AnimationPoseCache& cache)
+{
+    if (!instance.graph || !instance.graph->isValid()) {
+        return;
+    }
+
+    const auto& nodes = instance.graph->nodes;
+    for (size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+        const PoseGraphNode& node = nodes[nodeIndex];
+        if (instance.nodeWeights[nodeIndex] <= 0.0f) {
+            continue;
+        }
+        if (node.type == EPoseNodeType::Clip) {
+            instance.sampleEntries[nodeIndex] = cache.request(skeleton, node.clipIndex, instance.nodeTimes[nodeIndex], node.bLoop);
+        }
+        else if (node.type == EPoseNodeType::Additive && instance.nodeWeights[node.inputs[1]] > 0.0f) {
+            // Reference pose: the additive clip's first frame.
+            instance.sampleEntries[nodeIndex] = cache.request(skeleton, nodes[node.inputs[1]].clipIndex, 0.0, false);
+        }
+    }
+}
+
+void AnimationPoseGraphEvaluator::evaluate(const Skeleton&           skeleton,
+                                           AnimationGraphInstance&   instance,
+                                           const AnimationPoseCache& cache,
+                                           SkeletonPose&             outPose)
+{
+    if (!instance.graph || !instance.graph->isValid() || instance.nodeWeights[instance.graph->rootNode] <= 0.0f) {
+        return;
+    }
+
+    EvaluationContext ctx{
+        .graph    = *instance.graph,
+        .skeleton = skeleton,
+        .instance = instance,
+        .cache    = cache,
+    };
+    instance.pool.release(0);
+    // Null only for graphs with empty blend or state nodes.
+    const AnimationLocalPose* localPose = evaluateNode(ctx, instance.graph->rootNode);
+    if (!localPose) {
+        return;
+    }
+    SkeletonAnimationSampler::composePose(skeleton, *localPose, outPose);
+}
+
+void AnimationPoseGraphEvaluator::blendLocalPoses(const AnimationLocalPose& lhs, const AnimationLocalPose& rhs, float t, AnimationLocalPose& out)
+{
+    const size_t count = std::min({lhs.size(), rhs.size(), out.size()});
+    for (size_t index = 0; index < count; ++index) {
+        out[index].position = glm::mix(lhs[index].position, rhs[index].position, t);
+        out[index].rotation = animation_codec::nlerp(lhs[index].rotation, rhs[index].rotation, t);
+        out[index].scale    = glm::mix(lhs[index].scale, rhs[index].scale, t);
+    }
+}
+
+} // namespace ya
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "Core/Api.h"
+#include "Core/FName.h"
+#include "Resource/Core/SkeletonAnimationSampler.h"
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ya
+{
+
+inline constexpr uint32_t INVALID_POSE_GRAPH_INDEX = std::numeric_limits<uint32_t>::max();
+
+/// One SkeletonChannelSample per skeleton node.
+using AnimationLocalPose = std::vector<SkeletonChannelSample>;
+
+enum class EPoseNodeType : uint8_t
+{
+    Clip,         // Samples one of the skeleton's clips
+    BlendSpace1D, // Blends the two inputs around a parameter value
+    Layer,        // Overrides the masked nodes of the base with an overlay
+    Additive,     // Adds a clip's difference to its first frame onto the base
+    StateMachine, // Plays one input, cross-fading when the state changes
+};
+
+struct PoseGraphNode
+{
+    EPoseNodeType type = EPoseNodeType::Clip;
+
+    // Clip
+    uint32_t clipIndex = 0;
+    float    speed     = 1.0f;
+    bool     bLoop     = true;
+
+    /// BlendSpace1D: samples, sorted by blendPositions. Layer / Additive:
+    /// {base, overlay}. StateMachine: one input per state.
+    std::vector<uint32_t> inputs;
+    std::vector<float>    blendPositions;
+
+    /// BlendSpace1D: blend position. Layer / Additive: weight (1 when unset).
+    uint32_t parameter    = INVALID_POSE_GRAPH_INDEX;
+    /// Layer only: per-node overlay weights, index into AnimationPoseGraph::boneMasks.
+    uint32_t boneMask     = INVALID_POSE_GRAPH_INDEX;
+    /// StateMachine only: state entered on reset.
+    uint32_t initialState = 0;
+};
+
+/**
+ * @brief Shared, immutable description of how a character's pose is built
+ *
+ * Nodes reference the clips of one Skeleton by index. A graph is built once
+ * and shared by every instance; per-instance state (times, parameters, active
+ * states) lives in AnimationGraphInstance.
+ */
+struct YA_RESOURCE_CORE_API AnimationPoseGraph
+{
+    std::vector<PoseGraphNode>      nodes;
+    std::vector<FName>              parameterNames;
+    std::vector<float>              parameterDefaults;
+    std::vector<std::vector<float>> boneMasks;
+    uint32_t                        rootNode = INVALID_POSE_GRAPH_INDEX;
+
+    uint32_t addParameter(const FName& name, float defaultValue = 0.0f);
+    [[nodiscard]] uint32_t findParameter(const FName& name) const;
+
+    uint32_t addClip(uint32_t clipIndex, float speed = 1.0f, bool bLoop = true);
+    /// @p samples are (position, node) pairs; any order.
+    uint32_t addBlendSpace1D(uint32_t parameter, std::vector<std::pair<float, uint32_t>> samples);
+    uint32_t addLayer(uint32_t base, uint32_t overlay, uint32_t boneMask, uint32_t weightParameter = INVALID_POSE_GRAPH_INDEX);
+    /// @p additiveClipNode must be a Clip node; its first frame is the reference pose.
+    uint32_t addAdditive(uint32_t base, uint32_t additiveClipNode, uint32_t weightParameter = INVALID_POSE_GRAPH_INDEX);
+    uint32_t addStateMachine(std::vector<uint32_t> states, uint32_t initialState = 0);
+
+    /// @p nodeWeights holds one weight per skeleton node.
+    uint32_t addBoneMask(std::vector<float> nodeWeights);
+    /// Mask selecting @p rootNodeName and everything below it.
+    [[nodiscard]] static std::vector<float> makeSubtreeMask(const Skeleton& skeleton, const FName& rootNodeName);
+
+    [[nodiscard]] bool isValid() const { return rootNode < nodes.size(); }
+};
+
+/**
+ * @brief Pose buffers reused frame to frame
+ *
+ * Buffers are handed out stack-wise during one evaluation and keep their
+ * capacity, so a warmed-up pool does not allocate.
+ */
+class YA_RESOURCE_CORE_API AnimationPosePool
+{
+  public:
+    [[nodiscard]] uint32_t mark() const { return _used; }
+    AnimationLocalPose&    acquire(size_t nodeCount);
+    void                   release(uint32_t mark) { _used = mark; }
+
+    /// Buffers ever created; stays flat once the deepest graph path was evaluated.
+    [[nodiscard]] size_t getBufferCount() const { return _buffers.size(); }
+
+  private:
+    // A deque keeps handed-out references valid while the pool grows.
+    std::deque<AnimationLocalPose> _buffers;
+    uint32_t                       _used = 0;
+};
+
+/**
+ * @brief Clip samples shared by every graph instance within a frame
+ *
+ * Instances request (skeleton, clip, time) samples while gathering; requests
+ * that resolve to the same clip time share one entry, so a crowd playing the
+ * same clip in step samples it once. Requests are not thread safe; sampling
+ * distinct entries is, so the owner may split sampleRange() across threads.
+ */
+class YA_RESOURCE_CORE_API AnimationPoseCache
+{
+  public:
+    struct Stats
+    {
+        uint32_t requestCount = 0;
+        uint32_t sampleCount  = 0; // Unique entries this frame
+    };
+
+    /// Forget last frame's requests; entry buffers and cursors are kept.
+    void beginFrame();
+
+    [[nodiscard]] uint32_t request(const Skeleton& skeleton, uint32_t clipIndex, double time, bool bLoop);
+
+    [[nodiscard]] uint32_t getEntryCount() const { return _entryCount; }
+    /// Sample entries [begin, end).
+    void                   sampleRange(uint32_t begin, uint32_t end);
+    void                   sampleAll() { sampleRange(0, _entryCount); }
+
+    [[nodiscard]] const AnimationLocalPose& getPose(uint32_t entry) const { return _entries[entry].localPose; }
+    [[nodiscard]] const Stats&              getStats() const { return _stats; }
+
+  private:
+    struct Key
+    {
+        const Skeleton* skeleton  = nullptr;
+        uint32_t        clipIndex = 0;
+        double          clipTime  = 0.0;
+
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+    struct Entry
+    {
+        Key                       key;
+        const AnimationLocalPose* bindPose = nullptr;
+        CompressedClipCursor      cursor;
+        AnimationLocalPose        localPose;
+    };
+
+    const AnimationLocalPose& getBindPose(const Skeleton& skeleton);
+
+    std::vector<Entry>                                      _entries;
+    uint32_t                                                _entryCount = 0;
+    std::unordered_map<Key, uint32_t, KeyHash>              _lookup;
+    std::unordered_map<const Skeleton*, AnimationLocalPose> _bindPoses;
+    Stats                                                   _stats;
+};
+
+/// Per-character playback state of an AnimationPoseGraph.
+struct YA_RESOURCE_CORE_API AnimationGraphInstance
+{
+    struct MachineState
+    {
+        uint32_t current      = 0;
+        uint32_t previous     = INVALID_POSE_GRAPH_INDEX;
+        float    fadeElapsed  = 0.0f;
+        float    fadeDuration = 0.0f;
+    };
+
+    const AnimationPoseGraph* graph = nullptr;
+    std::vector<float>        parameters;
+    /// Clip nodes: time in ticks. BlendSpace1D nodes: normalized phase.
+    std::vector<double>       nodeTimes;
+    /// Effective weight of each node this frame; 0 for skipped branches.
+    std::vector<float>        nodeWeights;
+    std::vector<MachineState> machines;
+    /// Cache entries gathered this frame: sample of Clip nodes, reference pose of Additive nodes.
+    std::vector<uint32_t>     sampleEntries;
+    AnimationPosePool         pool;
+
+    void reset(const AnimationPoseGraph& target);
+    bool setParameter(const FName& name, float value);
+    void setParameter(uint32_t parameter, float value);
+    /// Switch @p machineNode to @p state, cross-fading over @p fadeSeconds.
+    void requestState(uint32_t machineNode, uint32_t state, float fadeSeconds);
+};
+
+/**
+ * @brief Three-step evaluation of graph instances
+ *
+ * advance() and evaluate() only touch the instance, so instances can run in
+ * parallel. gather() registers clip samples with the shared cache and must
+ * run serially; the cache is sampled between gather() and evaluate().
+ */
+struct YA_RESOURCE_CORE_API AnimationPoseGraphEvaluator
+{
+    static void advance(const Skeleton& skeleton, AnimationGraphInstance& instance, float deltaSeconds);
+    static void gather(const Skeleton& skeleton, AnimationGraphInstance& instance, AnimationPoseCache& cache);
+    static void evaluate(const Skeleton&           skeleton,
+                         AnimationGraphInstance&   instance,
+                         const AnimationPoseCache& cache,
+                         SkeletonPose&             outPose);
+
+    static void blendLocalPoses(const AnimationLocalPose& lhs, const AnimationLocalPose& rhs, float t, AnimationLocalPose& out);
+};
+
+} // namespace ya
@@ -0,0 +1,315 @@
+#include "Resource/Core/CompressedAnimationClip.h"
+
+#include "Resource/Core/Skeleton.h"
+#include "Resource/Core/SkeletonAnimationSampler.h"
+
+#include <limits>
+
+namespace ya
+{
+namespace
+{
+// Key times are uint16 frame indices.
+constexpr uint32_t MAX_FRAME_COUNT = std::numeric_limits<uint16_t>::max();
+// Longest run of frames one key pair may bridge; bounds the cost of key
+// reduction to O(frames * MAX_KEY_SPAN) per track.
+constexpr uint32_t MAX_KEY_SPAN = 64;
+
+glm::quat alignHemisphere(const glm::quat& value, const glm::quat& reference)
+{
+    return glm::dot(value, reference) < 0.0f ? -value : value;
+}
+
+/**
+ * Greedy key reduction over the resampled frames: from each kept key, bridge
+ * as many frames as `fits(key, candidate)` allows. Frame 0 and the last
+ * frame are always kept unless the track is constant.
+ */
+template <typename Fits>
+void reduceKeys(uint32_t frameCount, bool bConstant, Fits&& fits, std::vector<uint16_t>& outKeys)
+{
+    outKeys.clear();
+    outKeys.push_back(0);
+    if (bConstant || frameCount <= 1) {
+        return;
+    }
+
+    uint32_t key = 0;
+    while (key + 1 < frameCount) {
+        uint32_t next = key + 1;
+        while (next + 1 < frameCount && next + 1 - key <= MAX_KEY_SPAN && fits(key, next + 1)) {
+            ++next;
+        }
+        outKeys.push_back(static_cast<uint16_t>(next));
+        key = next;
+    }
+}
+
+void appendVectorTrack(const std::vector<glm::vec3>& values,
+                       float                         tolerance,
+                       std::vector<glm::vec3>&       mins,
+                       std::vector<glm::vec3>&       extents,
+                       std::vector<uint16_t>&        frames,
+                       std::vector<PackedVec3>&      packed,
+                       std::vector<uint32_t>&        offsets,
+                       std::vector<glm::vec3>&       decodedScratch,
+                       std::vector<uint16_t>&        keyScratch)
+{
+    glm::vec3 min = values.front();
+    glm::vec3 max = values.front();
+    for (const auto& value : values) {
+        min = glm::min(min, value);
+        max = glm::max(max, value);
+    }
+    const glm::vec3 extent = max - min;
+
+    // Reduce against the quantized values so the tolerance bounds the error
+    // of what is actually decoded.
+    decodedScratch.resize(values.size());
+    for (size_t frame = 0; frame < values.size(); ++frame) {
+        decodedScratch[frame] = animation_codec::decodeVec3(animation_codec::encodeVec3(values[frame], min, extent), min, extent);
+    }
+
+    const auto& decoded   = decodedScratch;
+    const bool  bConstant = std::all_of(decoded.begin(), decoded.end(), [&](const glm::vec3& value) {
+        return glm::length(value - decoded.front()) <= tolerance;
+    });
+    reduceKeys(static_cast<uint32_t>(values.size()), bConstant, [&](uint32_t key, uint32_t candidate) {
+        const float span = static_cast<float>(candidate - key);
+        for (uint32_t frame = key + 1; frame < candidate; ++frame) {
+            const glm::vec3 interpolated = glm::mix(decoded[key], decoded[candidate], static_cast<float>(frame - key) / span);
+            if (glm::length(interpolated - decoded[frame]) > tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }, keyScratch);
+
+    mins.push_back(min);
+    extents.push_back(extent);
+    for (const uint16_t frame : keyScratch) {
+        frames.push_back(frame);
+        packed.push_back(animation_codec::encodeVec3(values[frame], min, extent));
+    }
+    offsets.push_back(static_cast<uint32_t>(frames.size()));
+}
+
+void appendRotationTrack(const std::vector<glm::quat>& values,
+                         float                         tolerance,
+                         CompressedSkeletonClip&       clip,
+                         std::vector<glm::quat>&       decodedScratch,
+                         std::vector<uint16_t>&        keyScratch)
+{
+    decodedScratch.resize(values.size());
+    for (size_t frame = 0; frame < values.size(); ++frame) {
+        decodedScratch[frame] = alignHemisphere(animation_codec::decodeQuat(animation_codec::encodeQuat(values[frame])), values[frame]);
+    }
+
+    const auto& decoded   = decodedScratch;
+    const bool  bConstant = std::all_of(decoded.begin(), decoded.end(), [&](const glm::quat& value) {
+        return glm::length(alignHemisphere(value, decoded.front()) - decoded.front()) <= tolerance;
+    });
+    reduceKeys(static_cast<uint32_t>(values.size()), bConstant, [&](uint32_t key, uint32_t candidate) {
+        const float span = static_cast<float>(candidate - key);
+        for (uint32_t frame = key + 1; frame < candidate; ++frame) {
+            const glm::quat interpolated = animation_codec::nlerp(decoded[key], decoded[candidate], static_cast<float>(frame - key) / span);
+            if (glm::length(alignHemisphere(decoded[frame], interpolated) - interpolated) > tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }, keyScratch);
+
+    for (const uint16_t frame : keyScratch) {
+        clip.rotationFrames.push_back(frame);
+        clip.rotations.push_back(animation_codec::encodeQuat(values[frame]));
+    }
+    clip.rotationKeyOffsets.push_back(static_cast<uint32_t>(clip.rotationFrames.size()));
+}
+
+template <typename T>
+size_t arrayBytes(const std::vector<T>& values)
+{
+    return values.size() * sizeof(T);
+}
+
+} // namespace
+
+namespace animation_codec
+{
+
+PackedQuat encodeQuat(const glm::quat& value)
+{
+    const glm::quat normalized = glm::normalize(value);
+    float           components[4] = {normalized.x, normalized.y, normalized.z, normalized.w};
+
+    uint32_t dropped = 0;
+    for (uint32_t component = 1; component < 4; ++component) {
+        if (std::abs(components[component]) > std::abs(components[dropped])) {
+            dropped = component;
+        }
+    }
+    const float sign = components[dropped] < 0.0f ? -1.0f : 1.0f;
+
+    PackedQuat packed;
+    int        index = 0;
+    for (uint32_t component = 0; component < 4; ++component) {
+        if (component == dropped) {
+            continue;
+        }
+        const float unit      = std::clamp((sign * components[component] / QUAT_COMPONENT_RANGE + 1.0f) * 0.5f, 0.0f, 1.0f);
+        packed.words[index++] = static_cast<uint16_t>(std::lround(unit * QUAT_COMPONENT_SCALE));
+    }
+    packed.words[0] |= static_cast<uint16_t>((dropped & 1u) << 15u);
+    packed.words[1] |= static_cast<uint16_t>(((dropped >> 1u) & 1u) << 15u);
+    return packed;
+}
+
+PackedVec3 encodeVec3(const glm::vec3& value, const glm::vec3& min, const glm::vec3& extent)
+{
+    const auto quantize = [](float component, float lower, float range) {
+        if (range <= 0.0f) {
+            return uint16_t{0};
+        }
+        return static_cast<uint16_t>(std::lround(std::clamp((component - lower) / range, 0.0f, 1.0f) * 65535.0f));
+    };
+    return PackedVec3{
+        .x = quantize(value.x, min.x, extent.x),
+        .y = quantize(value.y, min.y, extent.y),
+        .z = quantize(value.z, min.z, extent.z),
+    };
+}
+
+} // namespace animation_codec
+
+size_t CompressedSkeletonClip::getMemoryUsage() const
+{
+    return name.size() +
+           arrayBytes(trackNodes) +
+           arrayBytes(positionMins) + arrayBytes(positionExtents) +
+           arrayBytes(scaleMins) + arrayBytes(scaleExtents) +
+           arrayBytes(rotationKeyOffsets) + arrayBytes(positionKeyOffsets) + arrayBytes(scaleKeyOffsets) +
+           arrayBytes(depthTrackEnds) +
+           arrayBytes(rotationFrames) + arrayBytes(rotations) +
+           arrayBytes(positionFrames) + arrayBytes(positions) +
+           arrayBytes(scaleFrames) + arrayBytes(scales);
+}
+
+void CompressedClipCursor::reset(const CompressedSkeletonClip& target)
+{
+    const uint32_t trackCount = target.getTrackCount();
+    clip                      = &target;
+    frame                     = 0.0;
+    keys.resize(static_cast<size_t>(trackCount) * 3);
+    for (uint32_t track = 0; track < trackCount; ++track) {
+        keys[track]                  = target.rotationKeyOffsets[track];
+        keys[trackCount + track]     = target.positionKeyOffsets[track];
+        keys[2 * trackCount + track] = target.scaleKeyOffsets[track];
+    }
+}
+
+CompressedSkeletonClip compressAnimationClip(const Skeleton&                     skeleton,
+                                             const SkeletonAnimationClip&        clip,
+                                             const AnimationCompressionSettings& settings)
+{
+    CompressedSkeletonClip compressed;
+    compressed.name           = clip.name;
+    compressed.duration       = clip.duration;
+    compressed.ticksPerSecond = clip.ticksPerSecond;
+
+    const double ticksPerSecond = clip.ticksPerSecond > 0.0 ? clip.ticksPerSecond : 1.0;
+    const double sampleRate     = std::max(static_cast<double>(settings.sampleRate), 1.0);
+    if (clip.duration > 0.0) {
+        const double intervals   = std::ceil(clip.duration * sampleRate / ticksPerSecond);
+        compressed.frameCount    = static_cast<uint32_t>(std::clamp(intervals, 1.0, static_cast<double>(MAX_FRAME_COUNT - 1))) + 1;
+        compressed.frameInterval = clip.duration / static_cast<double>(compressed.frameCount - 1);
+    }
+    else {
+        compressed.frameCount = 1;
+    }
+
+    compressed.rotationKeyOffsets.push_back(0);
+    compressed.positionKeyOffsets.push_back(0);
+    compressed.scaleKeyOffsets.push_back(0);
+
+    const uint32_t         frameCount = compressed.frameCount;
+    std::vector<glm::quat> rotations(frameCount);
+    std::vector<glm::vec3> positions(frameCount);
+    std::vector<glm::vec3> scales(frameCount);
+    std::vector<glm::quat> decodedRotations;
+    std::vector<glm::vec3> decodedVectors;
+    std::vector<uint16_t>  keyScratch;
+
+    // Nodes are stored parent-first, so one pass resolves every depth.
+    std::vector<uint32_t> nodeDepths(skeleton.nodes.size(), 0);
+    for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
+        const uint32_t parentIndex = skeleton.nodes[nodeIndex].parentIndex;
+        nodeDepths[nodeIndex]      = parentIndex < nodeIndex ? nodeDepths[parentIndex] + 1 : 0;
+    }
+
+    std::vector<const SkeletonAnimationChannel*> channels;
+    channels.reserve(clip.channels.size());
+    for (const SkeletonAnimationChannel& channel : clip.channels) {
+        if (channel.nodeIndex < skeleton.nodes.size()) {
+            channels.push_back(&channel);
+        }
+    }
+    std::stable_sort(channels.begin(), channels.end(), [&nodeDepths](const auto* lhs, const auto* rhs) {
+        return nodeDepths[lhs->nodeIndex] < nodeDepths[rhs->nodeIndex];
+    });
+
+    for (const SkeletonAnimationChannel* channelPtr : channels) {
+        const SkeletonAnimationChannel& channel = *channelPtr;
+        const uint32_t                  depth   = nodeDepths[channel.nodeIndex];
+        if (compressed.depthTrackEnds.size() <= depth) {
+            compressed.depthTrackEnds.resize(depth + 1, compressed.getTrackCount());
+        }
+
+        const SkeletonChannelSample bind = SkeletonAnimationSampler::decomposeTransform(skeleton.nodes[channel.nodeIndex].localTransform);
+        for (uint32_t frame = 0; frame < frameCount; ++frame) {
+            const double time = frame + 1 == frameCount ? clip.duration : frame * compressed.frameInterval;
+            rotations[frame]  = SkeletonAnimationSampler::sampleQuatTrack(channel.rotationKeys, time, bind.rotation);
+            if (frame > 0) {
+                rotations[frame] = alignHemisphere(rotations[frame], rotations[frame - 1]);
+            }
+            positions[frame] = SkeletonAnimationSampler::sampleVectorTrack(channel.positionKeys, time, bind.position);
+            scales[frame]    = SkeletonAnimationSampler::sampleVectorTrack(channel.scaleKeys, time, bind.scale);
+        }
+
+        compressed.trackNodes.push_back(channel.nodeIndex);
+        appendRotationTrack(rotations, settings.rotationTolerance, compressed, decodedRotations, keyScratch);
+        appendVectorTrack(positions,
+                          settings.positionTolerance,
+                          compressed.positionMins,
+                          compressed.positionExtents,
+                          compressed.positionFrames,
+                          compressed.positions,
+                          compressed.positionKeyOffsets,
+                          decodedVectors,
+                          keyScratch);
+        appendVectorTrack(scales,
+                          settings.scaleTolerance,
+                          compressed.scaleMins,
+                          compressed.scaleExtents,
+                          compressed.scaleFrames,
+                          compressed.scales,
+                          compressed.scaleKeyOffsets,
+                          decodedVectors,
+                          keyScratch);
+        compressed.depthTrackEnds[depth] = compressed.getTrackCount();
+    }
+
+    return compressed;
+}
+
+size_t getAnimationClipMemoryUsage(const SkeletonAnimationClip& clip)
+{
+    size_t bytes = clip.name.size();
+    for (const auto& channel : clip.channels) {
+        bytes += sizeof(SkeletonAnimationChannel) +
+                 arrayBytes(channel.positionKeys) + arrayBytes(channel.rotationKeys) + arrayBytes(channel.scaleKeys);
+    }
+    return bytes;
+}
+
+} // namespace ya
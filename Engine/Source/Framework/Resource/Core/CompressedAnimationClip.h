@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Core/Api.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ya
+{
+
+struct Skeleton;
+struct SkeletonAnimationClip;
+
+struct AnimationCompressionSettings
+{
+    /// Resampling rate, in frames per second of playback.
+    float sampleRate        = 30.0f;
+    /// Largest deviation a dropped key may introduce, in local-space units.
+    float positionTolerance = 1e-4f;
+    /// Largest deviation a dropped key may introduce, as quaternion distance.
+    float rotationTolerance = 1e-4f;
+    float scaleTolerance    = 1e-4f;
+};
+
+/**
+ * @brief Smallest-three quaternion in 48 bits
+ *
+ * The largest component is dropped (and made positive); the other three are
+ * stored as 15-bit fractions of [-1/sqrt(2), 1/sqrt(2)]. The dropped
+ * component's index lives in the top bits of the first two words.
+ */
+struct PackedQuat
+{
+    uint16_t words[3] = {};
+};
+
+/// Three 16-bit fractions of a per-track [min, min + extent] range.
+struct PackedVec3
+{
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint16_t z = 0;
+};
+
+/**
+ * @brief Cooked clip: uniformly resampled, key-reduced and quantized
+ *
+ * Tracks are stored SoA: one entry per animated node in the per-track arrays,
+ * and the keys of all tracks concatenated per kind, so track t owns keys
+ * [rotationKeyOffsets[t], rotationKeyOffsets[t + 1]) of rotationFrames /
+ * rotations (likewise for positions and scales). Key times are indices into
+ * the resampled frame grid; every track has at least one key of each kind,
+ * with channels missing a kind holding the bind pose.
+ *
+ * Tracks are ordered by the depth of their node in the skeleton, so the first
+ * getTrackCountForDepth(d) tracks animate every node down to depth d; LOD
+ * sampling of a bone subset is a prefix of the track arrays.
+ */
+struct YA_RESOURCE_CORE_API CompressedSkeletonClip
+{
+    std::string name;
+    double      duration       = 0.0;
+    double      ticksPerSecond = 0.0;
+    /// Ticks between resampled frames; 0 for single-frame clips.
+    double      frameInterval  = 0.0;
+    uint32_t    frameCount     = 0;
+
+    std::vector<uint32_t>  trackNodes;
+    std::vector<glm::vec3> positionMins;
+    std::vector<glm::vec3> positionExtents;
+    std::vector<glm::vec3> scaleMins;
+    std::vector<glm::vec3> scaleExtents;
+    std::vector<uint32_t>  rotationKeyOffsets;
+    std::vector<uint32_t>  positionKeyOffsets;
+    std::vector<uint32_t>  scaleKeyOffsets;
+    /// depthTrackEnds[d]: tracks whose node depth is at most d.
+    std::vector<uint32_t>  depthTrackEnds;
+
+    std::vector<uint16_t>   rotationFrames;
+    std::vector<PackedQuat> rotations;
+    std::vector<uint16_t>   positionFrames;
+    std::vector<PackedVec3> positions;
+    std::vector<uint16_t>   scaleFrames;
+    std::vector<PackedVec3> scales;
+
+    [[nodiscard]] uint32_t getTrackCount() const { return static_cast<uint32_t>(trackNodes.size()); }
+    [[nodiscard]] uint32_t getTrackCountForDepth(uint32_t maxDepth) const
+    {
+        return maxDepth < depthTrackEnds.size() ? depthTrackEnds[maxDepth] : getTrackCount();
+    }
+    [[nodiscard]] bool     isValid() const { return frameCount > 0 && rotationKeyOffsets.size() == trackNodes.size() + 1; }
+    /// Bytes held by the clip's arrays.
+    [[nodiscard]] size_t   getMemoryUsage() const;
+};
+
+/**
+ * @brief Per-instance playback position in a CompressedSkeletonClip
+ *
+ * Holds the current key of every track so forward playback only steps to the
+ * next key instead of searching. Playing backwards or looping rewinds with
+ * one binary search per track.
+ */
+struct YA_RESOURCE_CORE_API CompressedClipCursor
+{
+    const CompressedSkeletonClip* clip  = nullptr;
+    double                        frame = 0.0;
+    /// Current key per track: rotations, then positions, then scales.
+    std::vector<uint32_t>         keys;
+
+    void reset(const CompressedSkeletonClip& target);
+};
+
+namespace animation_codec
+{
+
+inline constexpr float QUAT_COMPONENT_RANGE = 0.70710678f;
+inline constexpr float QUAT_COMPONENT_SCALE = 32767.0f;
+
+[[nodiscard]] inline glm::quat decodeQuat(const PackedQuat& packed)
+{
+    const uint32_t dropped = ((packed.words[0] >> 15u) & 1u) | (((packed.words[1] >> 15u) & 1u) << 1u);
+
+    float components[4];
+    float sum   = 0.0f;
+    int   index = 0;
+    for (int component = 0; component < 4; ++component) {
+        if (static_cast<uint32_t>(component) == dropped) {
+            continue;
+        }
+        const float unit       = static_cast<float>(packed.words[index++] & 0x7fffu) / QUAT_COMPONENT_SCALE;
+        components[component]  = (unit * 2.0f - 1.0f) * QUAT_COMPONENT_RANGE;
+        sum                   += components[component] * components[component];
+    }
+    components[dropped] = std::sqrt(std::max(0.0f, 1.0f - sum));
+    // glm::quat(w, x, y, z); components are stored x, y, z, w.
+    return glm::quat(components[3], components[0], components[1], components[2]);
+}
+
+[[nodiscard]] inline glm::vec3 decodeVec3(const PackedVec3& packed, const glm::vec3& min, const glm::vec3& extent)
+{
+    constexpr float INV_SCALE = 1.0f / 65535.0f;
+    return min + extent * glm::vec3(static_cast<float>(packed.x) * INV_SCALE,
+                                    static_cast<float>(packed.y) * INV_SCALE,
+                                    static_cast<float>(packed.z) * INV_SCALE);
+}
+
+YA_RESOURCE_CORE_API PackedQuat encodeQuat(const glm::quat& value);
+YA_RESOURCE_CORE_API PackedVec3 encodeVec3(const glm::vec3& value, const glm::vec3& min, const glm::vec3& extent);
+
+/// Normalized lerp along the shorter arc; keys are close enough that it
+/// tracks slerp within the compression tolerance.
+[[nodiscard]] inline glm::quat nlerp(const glm::quat& lhs, const glm::quat& rhs, float t)
+{
+    const float sign = glm::dot(lhs, rhs) < 0.0f ? -1.0f : 1.0f;
+    return glm::normalize(lhs * (1.0f - t) + rhs * (sign * t));
+}
+
+} // namespace animation_codec
+
+/// Cook @p clip for @p skeleton. Channels that target no skeleton node are dropped.
+YA_RESOURCE_CORE_API CompressedSkeletonClip compressAnimationClip(const Skeleton&                     skeleton,
+                                                                  const SkeletonAnimationClip&        clip,
+                                                                  const AnimationCompressionSettings& settings = {});
+
+/// Bytes held by the key arrays of a full-precision clip, for comparison.
+YA_RESOURCE_CORE_API size_t getAnimationClipMemoryUsage(const SkeletonAnimationClip& clip);
+
+} // namespace ya
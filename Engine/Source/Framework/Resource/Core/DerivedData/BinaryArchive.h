@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ya
+{
+
+/// Append-only byte stream for cooked/derived payloads. Fields are written
+/// one by one so struct padding never reaches disk and output is reproducible.
+class BinaryWriter
+{
+  public:
+    std::vector<std::byte> bytes;
+
+    template <typename T>
+    void pod(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* first = reinterpret_cast<const std::byte*>(&value);
+        bytes.insert(bytes.end(), first, first + sizeof(T));
+    }
+
+    void str(std::string_view value)
+    {
+        pod(static_cast<uint32_t>(value.size()));
+        raw(value.data(), value.size());
+    }
+
+    /// Count-prefixed contiguous array; only for padding-free element types.
+    template <typename T>
+    void podArray(std::span<const T> values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        pod(static_cast<uint32_t>(values.size()));
+        raw(values.data(), values.size_bytes());
+    }
+    template <typename T>
+    void podArray(const std::vector<T>& values)
+    {
+        podArray(std::span<const T>(values));
+    }
+
+    void raw(const void* data, size_t size)
+    {
+        const auto* first = static_cast<const std::byte*>(data);
+        bytes.insert(bytes.end(), first, first + size);
+    }
+};
+
+/// Bounds-checked reader for BinaryWriter output. Any overrun latches ok()
+/// to false and later reads return value-initialized data.
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(std::span<const std::byte> bytes)
+        : _bytes(bytes)
+    {
+    }
+
+    [[nodiscard]] bool   ok() const { return _bOk; }
+    [[nodiscard]] size_t remaining() const { return _bytes.size() - _cursor; }
+
+    template <typename T>
+    T pod()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value{};
+        if (const std::byte* source = take(sizeof(T))) {
+            std::memcpy(&value, source, sizeof(T));
+        }
+        return value;
+    }
+
+    std::string str()
+    {
+        const auto size = pod<uint32_t>();
+        if (const std::byte* source = take(size)) {
+            return std::string(reinterpret_cast<const char*>(source), size);
+        }
+        return {};
+    }
+
+    /// Element count guarded against the remaining bytes, so a corrupt count
+    /// cannot trigger a huge allocation.
+    uint32_t count(size_t minElementSize)
+    {
+        const auto value = pod<uint32_t>();
+        if (static_cast<uint64_t>(value) * minElementSize > remaining()) {
+            _bOk = false;
+            return 0;
+        }
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> podArray()
+    {
+        std::vector<T> values(count(sizeof(T)));
+        const std::byte* source = take(values.size() * sizeof(T));
+        if (source && !values.empty()) {
+            std::memcpy(values.data(), source, values.size() * sizeof(T));
+        }
+        return values;
+    }
+
+  private:
+    std::span<const std::byte> _bytes;
+    size_t                     _cursor = 0;
+    bool                       _bOk    = true;
+
+    const std::byte* take(size_t size)
+    {
+        if (!_bOk || size > remaining()) {
+            _bOk = false;
+            return nullptr;
+        }
+        const std::byte* source = _bytes.data() + _cursor;
+        _cursor += size;
+        return source;
+    }
+};
+
+} // namespace ya
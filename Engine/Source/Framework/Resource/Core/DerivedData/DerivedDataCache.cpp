@@ -0,0 +1,537 @@
+#include "DerivedDataCache.h"
+
+#include "Core/Log.h"
+#include "Core/System/VirtualFileSystem.h"
+#include "Resource/Core/Meta/AssetMeta.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr uint64_t DDC_PRIME_1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t DDC_PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t DDC_PRIME_3 = 0x165667B19E3779F9ull;
+constexpr uint64_t DDC_PRIME_4 = 0x85EBCA77C2B2AE63ull;
+
+constexpr std::string_view DDC_DIRECTORY      = "Engine/Intermediate/DerivedDataCache";
+constexpr std::string_view DDC_FILE_EXTENSION = ".ddc";
+constexpr size_t           DDC_READ_CHUNK     = 1u << 20;
+
+uint64_t rotl(uint64_t value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+uint64_t fmix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+struct DerivedDataEntryHeader
+{
+    static constexpr uint32_t MAGIC   = 0x43444459; // YDDC
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t       magic       = MAGIC;
+    uint32_t       version     = VERSION;
+    uint64_t       payloadSize = 0;
+    DerivedDataKey key;
+    DerivedDataKey payloadHash;
+    uint64_t       reserved[2] = {};
+};
+static_assert(sizeof(DerivedDataEntryHeader) == 64);
+
+DerivedDataKey hashBytes(std::span<const std::byte> bytes)
+{
+    DerivedDataHasher hasher;
+    hasher.update(bytes.data(), bytes.size());
+    return hasher.finish();
+}
+
+std::optional<DerivedDataKey> parseKeyName(std::string_view name)
+{
+    if (name.size() != 32) {
+        return std::nullopt;
+    }
+    DerivedDataKey key;
+    for (size_t index = 0; index < 32; ++index) {
+        const char ch     = name[index];
+        uint64_t   nibble = 0;
+        if (ch >= '0' && ch <= '9') {
+            nibble = static_cast<uint64_t>(ch - '0');
+        }
+        else if (ch >= 'a' && ch <= 'f') {
+            nibble = static_cast<uint64_t>(ch - 'a' + 10);
+        }
+        else {
+            return std::nullopt;
+        }
+        uint64_t& lane = index < 16 ? key.hi : key.lo;
+        lane           = (lane << 4) | nibble;
+    }
+    return key;
+}
+
+int64_t nowTicks()
+{
+    return static_cast<int64_t>(std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+}
+
+} // namespace
+
+// ============================================================
+// DerivedDataKey / DerivedDataHasher
+// ============================================================
+
+std::string DerivedDataKey::toString() const
+{
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string           text(32, '0');
+    for (size_t index = 0; index < 16; ++index) {
+        text[15 - index] = digits[(hi >> (index * 4)) & 0xF];
+        text[31 - index] = digits[(lo >> (index * 4)) & 0xF];
+    }
+    return text;
+}
+
+void DerivedDataHasher::mixWord(uint64_t word)
+{
+    _laneA = rotl(_laneA ^ (word * DDC_PRIME_1), 31) * DDC_PRIME_2;
+    _laneB = rotl(_laneB ^ (word * DDC_PRIME_3), 29) * DDC_PRIME_4;
+}
+
+void DerivedDataHasher::update(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    _length += size;
+
+    // Finish a word left over from the previous update.
+    while (_pendingN != 0 && _pendingN < 8 && size > 0) {
+        _pending |= static_cast<uint64_t>(*bytes++) << (_pendingN * 8);
+        ++_pendingN;
+        --size;
+    }
+    if (_pendingN == 8) {
+        mixWord(_pending);
+        _pending  = 0;
+        _pendingN = 0;
+    }
+
+    while (size >= 8) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes, 8);
+        mixWord(word);
+        bytes += 8;
+        size -= 8;
+    }
+
+    for (; size > 0; --size) {
+        _pending |= static_cast<uint64_t>(*bytes++) << (_pendingN * 8);
+        ++_pendingN;
+    }
+}
+
+DerivedDataKey DerivedDataHasher::finish() const
+{
+    uint64_t laneA = _laneA;
+    uint64_t laneB = _laneB;
+    if (_pendingN != 0) {
+        laneA = rotl(laneA ^ (_pending * DDC_PRIME_1), 31) * DDC_PRIME_2;
+        laneB = rotl(laneB ^ (_pending * DDC_PRIME_3), 29) * DDC_PRIME_4;
+    }
+    laneA ^= _length;
+    laneB ^= _length * DDC_PRIME_1;
+    laneA += laneB;
+    laneB += laneA;
+    return {.hi = fmix(laneA), .lo = fmix(laneB ^ rotl(laneA, 17))};
+}
+
+// ============================================================
+// DerivedDataKeyBuilder
+// ============================================================
+
+DerivedDataKeyBuilder::DerivedDataKeyBuilder(std::string_view processorName, uint32_t processorVersion)
+{
+    string(processorName);
+    value(processorVersion);
+}
+
+DerivedDataKeyBuilder& DerivedDataKeyBuilder::bytes(std::span<const std::byte> data)
+{
+    value(static_cast<uint64_t>(data.size()));
+    _hasher.update(data.data(), data.size());
+    return *this;
+}
+
+DerivedDataKeyBuilder& DerivedDataKeyBuilder::string(std::string_view text)
+{
+    return bytes(std::as_bytes(std::span<const char>(text.data(), text.size())));
+}
+
+DerivedDataKeyBuilder& DerivedDataKeyBuilder::meta(const AssetMeta& assetMeta)
+{
+    // dump() of nlohmann::json objects is key-sorted, hence canonical.
+    string(assetMeta.type);
+    return string(assetMeta.properties.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+}
+
+bool DerivedDataKeyBuilder::sourceFile(const std::filesystem::path& physicalPath)
+{
+    const auto contentKey = DerivedDataCache::get().hashSourceFile(physicalPath);
+    if (!contentKey) {
+        _bValid = false;
+        return false;
+    }
+    value(*contentKey);
+    return true;
+}
+
+// ============================================================
+// DerivedDataCache
+// ============================================================
+
+DerivedDataCache& DerivedDataCache::get()
+{
+    static DerivedDataCache instance([]() {
+        if (auto* vfs = VirtualFileSystem::get()) {
+            return vfs->translatePath(DDC_DIRECTORY);
+        }
+        return std::filesystem::path(DDC_DIRECTORY);
+    }());
+    return instance;
+}
+
+DerivedDataCache::DerivedDataCache(std::filesystem::path root, uint64_t budgetBytes)
+    : _root(std::move(root)),
+      _budgetBytes(budgetBytes)
+{
+}
+
+std::filesystem::path DerivedDataCache::entryPath(const std::string& keyName) const
+{
+    return _root / keyName.substr(0, 2) / (keyName + std::string(DDC_FILE_EXTENSION));
+}
+
+void DerivedDataCache::ensureIndexedLocked()
+{
+    if (_bIndexed) {
+        return;
+    }
+    _bIndexed = true;
+
+    std::error_code ec;
+    if (!std::filesystem::is_directory(_root, ec)) {
+        return;
+    }
+    for (auto it = std::filesystem::recursive_directory_iterator(_root, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        const auto& path = it->path();
+        if (path.extension() != DDC_FILE_EXTENSION) {
+            // Temp files from an interrupted store.
+            if (path.extension() == ".tmp") {
+                std::error_code removeEc;
+                std::filesystem::remove(path, removeEc);
+            }
+            continue;
+        }
+        const std::string keyName = path.stem().string();
+        if (!parseKeyName(keyName)) {
+            continue;
+        }
+        const auto bytes = it->file_size(ec);
+        const auto time  = it->last_write_time(ec);
+        if (ec) {
+            ec.clear();
+            continue;
+        }
+        _entries[keyName] = {
+            .bytes      = static_cast<uint64_t>(bytes),
+            .lastAccess = static_cast<int64_t>(time.time_since_epoch().count()),
+        };
+        _stats.totalBytes += bytes;
+    }
+    _stats.entryCount = _entries.size();
+}
+
+void DerivedDataCache::forgetLocked(const std::string& keyName, bool bCorrupt)
+{
+    std::error_code ec;
+    std::filesystem::remove(entryPath(keyName), ec);
+    if (auto it = _entries.find(keyName); it != _entries.end()) {
+        _stats.totalBytes -= std::min(_stats.totalBytes, it->second.bytes);
+        _entries.erase(it);
+    }
+    _stats.entryCount = _entries.size();
+    if (bCorrupt) {
+        ++_stats.corruptions;
+    }
+}
+
+std::optional<std::vector<std::byte>> DerivedDataCache::load(const DerivedDataKey& key)
+{
+    const std::string keyName = key.toString();
+
+    // Only the index lookup and the LRU bump are serialized; the read and the
+    // payload hash run unlocked so concurrent loads do not queue on the disk.
+    uint64_t expectedBytes = 0;
+    int64_t  accessTicks   = 0;
+    {
+        std::lock_guard lock(_mutex);
+        ensureIndexedLocked();
+
+        auto entryIt = _entries.find(keyName);
+        if (entryIt == _entries.end()) {
+            ++_stats.misses;
+            return std::nullopt;
+        }
+        expectedBytes              = entryIt->second.bytes;
+        accessTicks                = nowTicks();
+        entryIt->second.lastAccess = accessTicks;
+        ++_stats.hits;
+    }
+
+    // A store() that replaced the entry meanwhile also rewrote its access
+    // time; only drop the entry this load actually looked at.
+    auto reject = [&](bool bCorrupt) -> std::optional<std::vector<std::byte>>
+    {
+        std::lock_guard lock(_mutex);
+        if (auto it = _entries.find(keyName); it != _entries.end() && it->second.lastAccess == accessTicks) {
+            forgetLocked(keyName, bCorrupt);
+        }
+        --_stats.hits;
+        ++_stats.misses;
+        return std::nullopt;
+    };
+
+    const auto    path = entryPath(keyName);
+    std::ifstream input(path, std::ios::binary);
+    if (!input.is_open()) {
+        return reject(false);
+    }
+
+    DerivedDataEntryHeader header{};
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!input.good() ||
+        header.magic != DerivedDataEntryHeader::MAGIC ||
+        header.version != DerivedDataEntryHeader::VERSION ||
+        header.key != key ||
+        header.payloadSize + sizeof(header) != expectedBytes) {
+        YA_CORE_WARN("DerivedDataCache: dropping invalid entry {}", keyName);
+        return reject(true);
+    }
+
+    std::vector<std::byte> payload(header.payloadSize);
+    input.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    if (!input.good() || hashBytes(payload) != header.payloadHash) {
+        YA_CORE_WARN("DerivedDataCache: dropping corrupt entry {}", keyName);
+        return reject(true);
+    }
+    input.close();
+
+    // The mtime doubles as the LRU timestamp so order survives restarts.
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+    return payload;
+}
+
+bool DerivedDataCache::store(const DerivedDataKey& key, std::span<const std::byte> payload)
+{
+    if (!key.isValid()) {
+        return false;
+    }
+
+    const std::string keyName = key.toString();
+    const auto        path    = entryPath(keyName);
+
+    DerivedDataEntryHeader header{};
+    header.payloadSize = payload.size();
+    header.key         = key;
+    header.payloadHash = hashBytes(payload);
+
+    // Hashing and writing happen outside the lock; only the index update
+    // and the rename are serialized.
+    std::filesystem::path tempPath;
+    {
+        std::lock_guard lock(_mutex);
+        ensureIndexedLocked();
+        tempPath = path;
+        tempPath += "." + std::to_string(++_tempCounter) + ".tmp";
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if (ec) {
+        return false;
+    }
+    {
+        std::ofstream output(tempPath, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            return false;
+        }
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        output.flush();
+        if (!output.good()) {
+            output.close();
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::lock_guard lock(_mutex);
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        ec.clear();
+        std::filesystem::remove(path, ec);
+        ec.clear();
+        std::filesystem::rename(tempPath, path, ec);
+    }
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+
+    const uint64_t entryBytes = sizeof(header) + payload.size();
+    auto&          entry      = _entries[keyName];
+    _stats.totalBytes         = _stats.totalBytes - std::min(_stats.totalBytes, entry.bytes) + entryBytes;
+    entry                     = {.bytes = entryBytes, .lastAccess = nowTicks()};
+    _stats.entryCount         = _entries.size();
+    ++_stats.writes;
+
+    trimLocked();
+    return true;
+}
+
+bool DerivedDataCache::contains(const DerivedDataKey& key)
+{
+    std::lock_guard lock(_mutex);
+    ensureIndexedLocked();
+    return _entries.contains(key.toString());
+}
+
+void DerivedDataCache::remove(const DerivedDataKey& key)
+{
+    std::lock_guard lock(_mutex);
+    ensureIndexedLocked();
+    forgetLocked(key.toString(), false);
+}
+
+std::optional<DerivedDataKey> DerivedDataCache::hashSourceFile(const std::filesystem::path& physicalPath)
+{
+    std::error_code ec;
+    const auto      fileSize  = std::filesystem::file_size(physicalPath, ec);
+    const auto      writeTime = std::filesystem::last_write_time(physicalPath, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const std::string pathKey = physicalPath.lexically_normal().generic_string();
+    const SourceHashInfo stamp{
+        .fileSize  = static_cast<uint64_t>(fileSize),
+        .writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count()),
+    };
+
+    {
+        std::lock_guard lock(_mutex);
+        if (auto it = _sourceHashes.find(pathKey);
+            it != _sourceHashes.end() && it->second.fileSize == stamp.fileSize && it->second.writeTime == stamp.writeTime) {
+            return it->second.contentKey;
+        }
+    }
+
+    // Persisted memo: an unchanged file is never re-read after a restart.
+    DerivedDataKeyBuilder memoKeyBuilder("SourceFileHash", 1);
+    memoKeyBuilder.string(pathKey).value(stamp.fileSize).value(stamp.writeTime);
+    const DerivedDataKey memoKey = memoKeyBuilder.finish();
+
+    DerivedDataKey contentKey;
+    if (auto memo = load(memoKey); memo && memo->size() == sizeof(DerivedDataKey)) {
+        std::memcpy(&contentKey, memo->data(), sizeof(contentKey));
+    }
+    else {
+        std::ifstream input(physicalPath, std::ios::binary);
+        if (!input.is_open()) {
+            return std::nullopt;
+        }
+        DerivedDataHasher      hasher;
+        std::vector<char>      chunk(DDC_READ_CHUNK);
+        while (input) {
+            input.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            hasher.update(chunk.data(), static_cast<size_t>(input.gcount()));
+        }
+        contentKey = hasher.finish();
+        store(memoKey, std::as_bytes(std::span<const DerivedDataKey>(&contentKey, 1)));
+    }
+
+    std::lock_guard lock(_mutex);
+    auto&           info = _sourceHashes[pathKey];
+    info                 = stamp;
+    info.contentKey      = contentKey;
+    return contentKey;
+}
+
+void DerivedDataCache::setBudget(uint64_t budgetBytes)
+{
+    std::lock_guard lock(_mutex);
+    _budgetBytes = budgetBytes;
+}
+
+uint64_t DerivedDataCache::getBudget() const
+{
+    std::lock_guard lock(_mutex);
+    return _budgetBytes;
+}
+
+void DerivedDataCache::trim()
+{
+    std::lock_guard lock(_mutex);
+    ensureIndexedLocked();
+    trimLocked();
+}
+
+void DerivedDataCache::trimLocked()
+{
+    if (_stats.totalBytes <= _budgetBytes) {
+        return;
+    }
+
+    std::vector<std::pair<int64_t, std::string>> byAge;
+    byAge.reserve(_entries.size());
+    for (const auto& [keyName, info] : _entries) {
+        byAge.emplace_back(info.lastAccess, keyName);
+    }
+    std::sort(byAge.begin(), byAge.end());
+
+    for (const auto& [_, keyName] : byAge) {
+        if (_stats.totalBytes <= _budgetBytes) {
+            break;
+        }
+        forgetLocked(keyName, false);
+        ++_stats.evictions;
+    }
+}
+
+DerivedDataCache::Stats DerivedDataCache::getStats() const
+{
+    std::lock_guard lock(_mutex);
+    return _stats;
+}
+
+} // namespace ya
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "Core/Api.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace ya
+{
+
+struct AssetMeta;
+
+/// 128-bit content hash naming one derived-data entry.
+struct DerivedDataKey
+{
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+
+    bool operator==(const DerivedDataKey&) const = default;
+
+    [[nodiscard]] bool        isValid() const { return hi != 0 || lo != 0; }
+    [[nodiscard]] std::string toString() const; // 32 lowercase hex digits
+};
+
+/// Streaming 128-bit hash (two independent 64-bit multiply-rotate lanes).
+/// Not cryptographic; collision-resistant enough for cache addressing.
+class YA_RESOURCE_CORE_API DerivedDataHasher
+{
+  public:
+    void           update(const void* data, size_t size);
+    DerivedDataKey finish() const;
+
+  private:
+    uint64_t _laneA    = 0x243F6A8885A308D3ull;
+    uint64_t _laneB    = 0x13198A2E03707344ull;
+    uint64_t _length   = 0;
+    uint64_t _pending  = 0;
+    uint32_t _pendingN = 0;
+
+    void mixWord(uint64_t word);
+};
+
+/**
+ * @brief Builds a DDC key from everything a derived result depends on
+ *
+ * Every key starts with the processor name and version: bump the version
+ * whenever the processor's output changes for the same inputs. Source files
+ * are hashed by content (memoized per path/size/mtime by the cache), so
+ * touching a file without changing it keeps its derived data.
+ */
+class YA_RESOURCE_CORE_API DerivedDataKeyBuilder
+{
+  public:
+    DerivedDataKeyBuilder(std::string_view processorName, uint32_t processorVersion);
+
+    DerivedDataKeyBuilder& bytes(std::span<const std::byte> data);
+    DerivedDataKeyBuilder& string(std::string_view value);
+    DerivedDataKeyBuilder& meta(const AssetMeta& assetMeta);
+    /// Fold in the content hash of @p physicalPath; returns false (and makes
+    /// the key invalid) if the file cannot be read.
+    bool                   sourceFile(const std::filesystem::path& physicalPath);
+
+    template <typename T>
+    DerivedDataKeyBuilder& value(const T& field)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        _hasher.update(&field, sizeof(T));
+        return *this;
+    }
+
+    [[nodiscard]] DerivedDataKey finish() const { return _bValid ? _hasher.finish() : DerivedDataKey{}; }
+
+  private:
+    DerivedDataHasher _hasher;
+    bool              _bValid = true;
+};
+
+/**
+ * @brief Content-addressed derived-data cache on local disk
+ *
+ * Entries live under `<root>/<2 hex>/<32 hex>.ddc` with a header that carries
+ * the key, payload size and payload hash; load() verifies all three and drops
+ * corrupt entries. store() writes a temp file and renames it, so a crash never
+ * leaves a torn entry. A size budget is enforced by evicting least recently
+ * used entries (last access is the file mtime, so LRU order survives a
+ * restart). Thread-safe.
+ */
+class YA_RESOURCE_CORE_API DerivedDataCache
+{
+  public:
+    static constexpr uint64_t DEFAULT_BUDGET_BYTES = 4ull << 30;
+
+    struct Stats
+    {
+        uint64_t hits        = 0;
+        uint64_t misses      = 0;
+        uint64_t writes      = 0;
+        uint64_t corruptions = 0;
+        uint64_t evictions   = 0;
+        uint64_t totalBytes  = 0;
+        uint64_t entryCount  = 0;
+    };
+
+    /// Process-wide cache under Engine/Intermediate/DerivedDataCache.
+    static DerivedDataCache& get();
+
+    explicit DerivedDataCache(std::filesystem::path root, uint64_t budgetBytes = DEFAULT_BUDGET_BYTES);
+
+    DerivedDataCache(const DerivedDataCache&)            = delete;
+    DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+    /// Payload for @p key, or nullopt on a miss or a corrupt entry.
+    std::optional<std::vector<std::byte>> load(const DerivedDataKey& key);
+    bool                                  store(const DerivedDataKey& key, std::span<const std::byte> payload);
+    bool                                  contains(const DerivedDataKey& key);
+    void                                  remove(const DerivedDataKey& key);
+
+    /// Content hash of a source file, memoized by path, size and mtime both
+    /// in memory and as a DDC entry.
+    std::optional<DerivedDataKey> hashSourceFile(const std::filesystem::path& physicalPath);
+
+    void     setBudget(uint64_t budgetBytes);
+    uint64_t getBudget() const;
+    /// Evict LRU entries until the store fits in the budget.
+    void     trim();
+
+    [[nodiscard]] Stats                        getStats() const;
+    [[nodiscard]] const std::filesystem::path& getRoot() const { return _root; }
+
+  private:
+    struct EntryInfo
+    {
+        uint64_t bytes      = 0;
+        int64_t  lastAccess = 0;
+    };
+
+    struct SourceHashInfo
+    {
+        uint64_t       fileSize  = 0;
+        int64_t        writeTime = 0;
+        DerivedDataKey contentKey;
+    };
+
+    std::filesystem::path _root;
+    uint64_t              _budgetBytes = DEFAULT_BUDGET_BYTES;
+    mutable std::mutex    _mutex;
+    bool                  _bIndexed = false;
+    uint64_t              _tempCounter = 0;
+    Stats                 _stats;
+
+    std::unordered_map<std::string, EntryInfo>      _entries; // keyed by DerivedDataKey::toString()
+    std::unordered_map<std::string, SourceHashInfo> _sourceHashes;
+
+    std::filesystem::path entryPath(const std::string& keyName) const;
+    void                  ensureIndexedLocked();
+    void                  forgetLocked(const std::string& keyName, bool bCorrupt);
+    void                  trimLocked();
+};
+
+} // namespace ya
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Resource/Core/DerivedData/BinaryArchive.h"
+#include "Resource/Core/EngineMeshData.h"
+
+#include <optional>
+
+namespace ya
+{
+
+/// Derived-data payload for one EngineMeshData. Vertex strides are recorded
+/// so a layout change reads as a miss instead of garbage.
+inline void writeMeshData(BinaryWriter& writer, const EngineMeshView& mesh)
+{
+    writer.pod(static_cast<uint32_t>(sizeof(ya::Vertex)));
+    writer.pod(static_cast<uint32_t>(sizeof(ya::SkeletonMeshVertex)));
+    writer.str(mesh.name);
+    writer.podArray(mesh.vertices);
+    writer.podArray(mesh.skeletonVertices);
+    writer.podArray(mesh.indices);
+    writer.podArray(mesh.lods);
+    writer.podArray(mesh.meshlets);
+    writer.podArray(mesh.meshletVertices);
+    writer.podArray(mesh.meshletTriangles);
+}
+
+inline std::optional<EngineMeshData> readMeshData(BinaryReader& reader)
+{
+    const auto vertexStride     = reader.pod<uint32_t>();
+    const auto skinVertexStride = reader.pod<uint32_t>();
+    if (vertexStride != sizeof(ya::Vertex) || skinVertexStride != sizeof(ya::SkeletonMeshVertex)) {
+        return std::nullopt;
+    }
+
+    EngineMeshData mesh;
+    mesh.name             = reader.str();
+    mesh.vertices         = reader.podArray<ya::Vertex>();
+    mesh.skeletonVertices = reader.podArray<ya::SkeletonMeshVertex>();
+    mesh.indices          = reader.podArray<uint32_t>();
+    mesh.lods             = reader.podArray<MeshLod>();
+    mesh.meshlets         = reader.podArray<Meshlet>();
+    mesh.meshletVertices  = reader.podArray<uint32_t>();
+    mesh.meshletTriangles = reader.podArray<uint8_t>();
+    if (!reader.ok()) {
+        return std::nullopt;
+    }
+    return mesh;
+}
+
+} // namespace ya
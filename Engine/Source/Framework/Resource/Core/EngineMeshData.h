@@ -3,18 +3,103 @@
 #include "Core/Base.h"
 #include "Core/Math/Geometry.h"
 
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ya
 {
 
+/// One level of detail: a range of the mesh index buffer over the shared
+/// vertex buffer. LOD 0 is the full mesh.
+struct MeshLod
+{
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    /// Simplification error relative to the mesh's bounding-box extent.
+    float    error      = 0.0f;
+    uint32_t reserved   = 0;
+
+    bool operator==(const MeshLod&) const = default;
+};
+static_assert(sizeof(MeshLod) == 16);
+
+/**
+ * @brief Cluster of at most MAX_VERTICES vertices and MAX_TRIANGLES triangles
+ *
+ * `vertexOffset` indexes EngineMeshData::meshletVertices (mesh vertex
+ * indices), `triangleOffset` indexes meshletTriangles (three local uint8
+ * indices per triangle). LOD 0 indices are stored in meshlet order, so
+ * `triangleOffset` is also the cluster's first index in the index buffer.
+ *
+ * Bounds are in mesh space. The normal cone holds every triangle normal
+ * within acos(coneCutoff) of `coneAxis`; coneCutoff <= 0 means the cluster
+ * faces too many ways to be back-face culled.
+ */
+struct Meshlet
+{
+    static constexpr uint32_t MAX_VERTICES  = 64;
+    static constexpr uint32_t MAX_TRIANGLES = 124;
+
+    uint32_t  vertexOffset   = 0;
+    uint32_t  triangleOffset = 0;
+    uint32_t  vertexCount    = 0;
+    uint32_t  triangleCount  = 0;
+    glm::vec3 center{};
+    float     radius         = 0.0f;
+    glm::vec3 coneAxis{0.0f, 0.0f, 1.0f};
+    float     coneCutoff     = -1.0f;
+
+    bool operator==(const Meshlet&) const = default;
+};
+static_assert(sizeof(Meshlet) == 48);
+
 struct EngineMeshData
 {
     std::string                         name;
     std::vector<ya::Vertex>             vertices;
     std::vector<ya::SkeletonMeshVertex> skeletonVertices;
+    /// LOD 0 indices, followed by every coarser LOD listed in `lods`.
     std::vector<uint32_t>               indices;
+    /// Empty, or the whole chain starting with LOD 0.
+    std::vector<MeshLod>                lods;
+    /// LOD 0 clusters; empty when meshlets were not built.
+    std::vector<Meshlet>                meshlets;
+    std::vector<uint32_t>               meshletVertices;
+    std::vector<uint8_t>                meshletTriangles;
+
+    [[nodiscard]] bool hasSkinning() const { return !skeletonVertices.empty(); }
+};
+
+/// Non-owning view of mesh data, e.g. blobs in a memory-mapped cooked model.
+/// The viewed memory must outlive the consumer call (Mesh::create uploads
+/// synchronously).
+struct EngineMeshView
+{
+    std::string_view                        name;
+    std::span<const ya::Vertex>             vertices;
+    std::span<const ya::SkeletonMeshVertex> skeletonVertices;
+    std::span<const uint32_t>               indices;
+    std::span<const MeshLod>                lods;
+    std::span<const Meshlet>                meshlets;
+    std::span<const uint32_t>               meshletVertices;
+    std::span<const uint8_t>                meshletTriangles;
+
+    EngineMeshView() = default;
+    EngineMeshView(const EngineMeshData& data)
+        : name(data.name), vertices(data.vertices), skeletonVertices(data.skeletonVertices), indices(data.indices), lods(data.lods),
+          meshlets(data.meshlets), meshletVertices(data.meshletVertices), meshletTriangles(data.meshletTriangles)
+    {
+    }
+    EngineMeshView(std::string_view                        inName,
+                   std::span<const ya::Vertex>             inVertices,
+                   std::span<const ya::SkeletonMeshVertex> inSkeletonVertices,
+                   std::span<const uint32_t>               inIndices,
+                   std::span<const MeshLod>                inLods = {})
+        : name(inName), vertices(inVertices), skeletonVertices(inSkeletonVertices), indices(inIndices), lods(inLods)
+    {
+    }
 
     [[nodiscard]] bool hasSkinning() const { return !skeletonVertices.empty(); }
 };
@@ -0,0 +1,525 @@
+#include "CookedModel.h"
+
+#include "Core/Log.h"
+#include "Resource/Core/DerivedData/BinaryArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <variant>
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr uint64_t COOKED_HASH_OFFSET = 14695981039346656037ull;
+constexpr uint64_t COOKED_HASH_PRIME  = 1099511628211ull;
+
+uint64_t hashPath(std::string_view value)
+{
+    uint64_t hash = COOKED_HASH_OFFSET;
+    for (char ch : value) {
+        hash ^= static_cast<uint8_t>(ch);
+        hash *= COOKED_HASH_PRIME;
+    }
+    return hash;
+}
+
+uint64_t alignUp(uint64_t value, uint64_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+void writeMaterial(BinaryWriter& out, const MaterialData& material)
+{
+    out.str(material.name);
+    out.str(material.type);
+    out.str(material.directory);
+
+    out.pod(static_cast<uint32_t>(material.params.size()));
+    for (const auto& [key, value] : material.params) {
+        out.str(key.toString());
+        out.pod(static_cast<uint8_t>(value.index()));
+        std::visit(
+            [&out](const auto& typed)
+            {
+                using T = std::decay_t<decltype(typed)>;
+                if constexpr (std::is_same_v<T, std::string>) {
+                    out.str(typed);
+                }
+                else if constexpr (std::is_same_v<T, bool>) {
+                    out.pod(static_cast<uint8_t>(typed ? 1 : 0));
+                }
+                else {
+                    out.pod(typed);
+                }
+            },
+            value);
+    }
+
+    out.pod(static_cast<uint32_t>(material.texturePaths.size()));
+    for (const auto& [key, path] : material.texturePaths) {
+        out.str(key.toString());
+        out.str(path);
+    }
+}
+
+template <size_t I = 0>
+bool readMaterialValue(BinaryReader& in, uint8_t index, MaterialValue& outValue)
+{
+    if constexpr (I < std::variant_size_v<MaterialValue>) {
+        if (index != I) {
+            return readMaterialValue<I + 1>(in, index, outValue);
+        }
+        using T = std::variant_alternative_t<I, MaterialValue>;
+        if constexpr (std::is_same_v<T, std::string>) {
+            outValue = in.str();
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            outValue = in.pod<uint8_t>() != 0;
+        }
+        else {
+            outValue = in.pod<T>();
+        }
+        return in.ok();
+    }
+    else {
+        return false;
+    }
+}
+
+bool readMaterial(BinaryReader& in, MaterialData& material)
+{
+    material.name      = in.str();
+    material.type      = in.str();
+    material.directory = in.str();
+
+    const uint32_t paramCount = in.count(sizeof(uint32_t) + 1);
+    for (uint32_t index = 0; index < paramCount && in.ok(); ++index) {
+        const FName   key       = FName(in.str());
+        const uint8_t typeIndex = in.pod<uint8_t>();
+        MaterialValue value;
+        if (!readMaterialValue(in, typeIndex, value)) {
+            return false;
+        }
+        material.params[key] = std::move(value);
+    }
+
+    const uint32_t textureCount = in.count(sizeof(uint32_t) * 2);
+    for (uint32_t index = 0; index < textureCount && in.ok(); ++index) {
+        const FName key            = FName(in.str());
+        material.texturePaths[key] = in.str();
+    }
+    return in.ok();
+}
+
+void writeVectorKeys(BinaryWriter& out, const std::vector<ImportedSkeletonVectorKeyframe>& keys)
+{
+    out.pod(static_cast<uint32_t>(keys.size()));
+    for (const auto& key : keys) {
+        out.pod(key.time);
+        out.pod(key.value);
+    }
+}
+
+std::vector<ImportedSkeletonVectorKeyframe> readVectorKeys(BinaryReader& in)
+{
+    std::vector<ImportedSkeletonVectorKeyframe> keys(in.count(sizeof(double) + sizeof(glm::vec3)));
+    for (auto& key : keys) {
+        key.time  = in.pod<double>();
+        key.value = in.pod<glm::vec3>();
+    }
+    return keys;
+}
+
+void writeSkeleton(BinaryWriter& out, const ImportedSkeletonData& skeleton)
+{
+    out.str(skeleton.name);
+    out.pod(skeleton.rootNodeIndex);
+
+    out.pod(static_cast<uint32_t>(skeleton.nodes.size()));
+    for (const auto& node : skeleton.nodes) {
+        out.str(node.name.toString());
+        out.pod(node.parentIndex);
+        out.pod(node.localTransform);
+        out.pod(node.globalTransform);
+        out.podArray(node.children);
+    }
+
+    out.pod(static_cast<uint32_t>(skeleton.nameToNodeIndex.size()));
+    for (const auto& [name, nodeIndex] : skeleton.nameToNodeIndex) {
+        out.str(name.toString());
+        out.pod(nodeIndex);
+    }
+
+    out.pod(static_cast<uint32_t>(skeleton.bones.size()));
+    for (const auto& bone : skeleton.bones) {
+        out.str(bone.name.toString());
+        out.pod(bone.offsetMatrix);
+        out.pod(bone.boneIndex);
+        out.pod(bone.nodeIndex);
+    }
+
+    out.pod(static_cast<uint32_t>(skeleton.boneNameToIndex.size()));
+    for (const auto& [name, boneIndex] : skeleton.boneNameToIndex) {
+        out.str(name.toString());
+        out.pod(boneIndex);
+    }
+
+    out.pod(static_cast<uint32_t>(skeleton.animations.size()));
+    for (const auto& clip : skeleton.animations) {
+        out.str(clip.name);
+        out.pod(clip.duration);
+        out.pod(clip.ticksPerSecond);
+        out.pod(static_cast<uint32_t>(clip.channels.size()));
+        for (const auto& channel : clip.channels) {
+            out.str(channel.targetName.toString());
+            writeVectorKeys(out, channel.positionKeys);
+            out.pod(static_cast<uint32_t>(channel.rotationKeys.size()));
+            for (const auto& key : channel.rotationKeys) {
+                out.pod(key.time);
+                out.pod(key.value);
+            }
+            writeVectorKeys(out, channel.scaleKeys);
+        }
+    }
+
+    out.podArray(skeleton.meshIndices);
+}
+
+bool readSkeleton(BinaryReader& in, ImportedSkeletonData& skeleton)
+{
+    skeleton.name          = in.str();
+    skeleton.rootNodeIndex = in.pod<uint32_t>();
+
+    skeleton.nodes.resize(in.count(sizeof(uint32_t) * 3 + sizeof(glm::mat4) * 2));
+    for (auto& node : skeleton.nodes) {
+        node.name            = FName(in.str());
+        node.parentIndex     = in.pod<uint32_t>();
+        node.localTransform  = in.pod<glm::mat4>();
+        node.globalTransform = in.pod<glm::mat4>();
+        node.children        = in.podArray<uint32_t>();
+    }
+
+    const uint32_t nodeNameCount = in.count(sizeof(uint32_t) * 2);
+    for (uint32_t index = 0; index < nodeNameCount && in.ok(); ++index) {
+        const FName name                = FName(in.str());
+        skeleton.nameToNodeIndex[name] = in.pod<uint32_t>();
+    }
+
+    skeleton.bones.resize(in.count(sizeof(uint32_t) * 3 + sizeof(glm::mat4)));
+    for (auto& bone : skeleton.bones) {
+        bone.name         = FName(in.str());
+        bone.offsetMatrix = in.pod<glm::mat4>();
+        bone.boneIndex    = in.pod<uint32_t>();
+        bone.nodeIndex    = in.pod<uint32_t>();
+    }
+
+    const uint32_t boneNameCount = in.count(sizeof(uint32_t) * 2);
+    for (uint32_t index = 0; index < boneNameCount && in.ok(); ++index) {
+        const FName name                = FName(in.str());
+        skeleton.boneNameToIndex[name] = in.pod<uint32_t>();
+    }
+
+    skeleton.animations.resize(in.count(sizeof(uint32_t) * 2 + sizeof(double) * 2));
+    for (auto& clip : skeleton.animations) {
+        clip.name           = in.str();
+        clip.duration       = in.pod<double>();
+        clip.ticksPerSecond = in.pod<double>();
+        clip.channels.resize(in.count(sizeof(uint32_t) * 4));
+        for (auto& channel : clip.channels) {
+            channel.targetName   = FName(in.str());
+            channel.positionKeys = readVectorKeys(in);
+            channel.rotationKeys.resize(in.count(sizeof(double) + sizeof(glm::quat)));
+            for (auto& key : channel.rotationKeys) {
+                key.time  = in.pod<double>();
+                key.value = in.pod<glm::quat>();
+            }
+            channel.scaleKeys = readVectorKeys(in);
+        }
+    }
+
+    skeleton.meshIndices = in.podArray<uint32_t>();
+    return in.ok();
+}
+
+template <typename T>
+void writeBlob(std::ofstream& output, uint64_t& cursor, uint64_t offset, std::span<const T> values)
+{
+    static const char zeros[CookedModelHeader::BLOB_ALIGNMENT] = {};
+    if (offset > cursor) {
+        output.write(zeros, static_cast<std::streamsize>(offset - cursor));
+        cursor = offset;
+    }
+    output.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+    cursor += values.size_bytes();
+}
+
+} // namespace
+
+CookedModelSourceStamp CookedModelSourceStamp::fromFile(std::string_view assetPath, const std::filesystem::path& physicalPath)
+{
+    std::error_code ec;
+    const auto      fileSize = std::filesystem::file_size(physicalPath, ec);
+    if (ec) {
+        return {};
+    }
+    const auto writeTime = std::filesystem::last_write_time(physicalPath, ec);
+    if (ec) {
+        return {};
+    }
+
+    return {
+        .pathHash  = hashPath(assetPath),
+        .fileSize  = static_cast<uint64_t>(fileSize),
+        .writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count()),
+    };
+}
+
+bool CookedModel::write(const std::filesystem::path&    path,
+                        const CookedModelSourceStamp&   source,
+                        const ImportedModelData&        importedModel,
+                        std::span<const EngineMeshData> meshes)
+{
+    if (meshes.size() != importedModel.meshes.size()) {
+        YA_CORE_ERROR("CookedModel::write: {} meshes for {} imported meshes in '{}'",
+                      meshes.size(),
+                      importedModel.meshes.size(),
+                      importedModel.filepath);
+        return false;
+    }
+
+    BinaryWriter meta;
+    meta.str(importedModel.filepath);
+    meta.str(importedModel.directory);
+    for (const auto& mesh : meshes) {
+        meta.str(mesh.name);
+    }
+    meta.podArray(importedModel.meshMaterialIndices);
+    meta.podArray(importedModel.meshSkeletonIndices);
+    meta.pod(static_cast<uint32_t>(importedModel.materials.size()));
+    for (const auto& material : importedModel.materials) {
+        writeMaterial(meta, material);
+    }
+    meta.pod(static_cast<uint32_t>(importedModel.skeletons.size()));
+    for (const auto& skeleton : importedModel.skeletons) {
+        writeSkeleton(meta, skeleton);
+    }
+
+    constexpr uint64_t alignment = CookedModelHeader::BLOB_ALIGNMENT;
+
+    CookedModelHeader header{};
+    header.meshCount       = static_cast<uint32_t>(meshes.size());
+    header.source          = source;
+    header.meshTableOffset = sizeof(CookedModelHeader);
+    header.metaOffset      = alignUp(header.meshTableOffset + meshes.size() * sizeof(CookedMeshRecord), alignment);
+    header.metaSize        = meta.bytes.size();
+
+    std::vector<CookedMeshRecord> records(meshes.size());
+    uint64_t                      offset = alignUp(header.metaOffset + header.metaSize, alignment);
+    for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
+        const auto& mesh   = meshes[meshIndex];
+        auto&       record = records[meshIndex];
+
+        record.vertexCount     = static_cast<uint32_t>(mesh.vertices.size());
+        record.skinVertexCount = static_cast<uint32_t>(mesh.skeletonVertices.size());
+        record.indexCount      = static_cast<uint32_t>(mesh.indices.size());
+        record.lodCount        = static_cast<uint32_t>(mesh.lods.size());
+        record.meshletCount        = static_cast<uint32_t>(mesh.meshlets.size());
+        record.meshletVertexCount  = static_cast<uint32_t>(mesh.meshletVertices.size());
+        record.meshletTriangleSize = static_cast<uint32_t>(mesh.meshletTriangles.size());
+
+        record.vertexOffset = offset;
+        offset              = alignUp(offset + mesh.vertices.size() * sizeof(ya::Vertex), alignment);
+        record.skinOffset   = offset;
+        offset              = alignUp(offset + mesh.skeletonVertices.size() * sizeof(ya::SkeletonMeshVertex), alignment);
+        record.indexOffset  = offset;
+        offset              = alignUp(offset + mesh.indices.size() * sizeof(uint32_t), alignment);
+        record.lodOffset    = offset;
+        offset              = alignUp(offset + mesh.lods.size() * sizeof(MeshLod), alignment);
+
+        record.meshletOffset         = offset;
+        offset                       = alignUp(offset + mesh.meshlets.size() * sizeof(Meshlet), alignment);
+        record.meshletVertexOffset   = offset;
+        offset                       = alignUp(offset + mesh.meshletVertices.size() * sizeof(uint32_t), alignment);
+        record.meshletTriangleOffset = offset;
+        offset                       = alignUp(offset + mesh.meshletTriangles.size(), alignment);
+    }
+    header.fileSize = offset;
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if (ec) {
+        return false;
+    }
+
+    auto tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream output(tempPath, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            return false;
+        }
+
+        uint64_t cursor = 0;
+        writeBlob(output, cursor, 0, std::span<const CookedModelHeader>(&header, 1));
+        writeBlob(output, cursor, header.meshTableOffset, std::span<const CookedMeshRecord>(records));
+        writeBlob(output, cursor, header.metaOffset, std::span<const std::byte>(meta.bytes));
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
+            writeBlob(output, cursor, records[meshIndex].vertexOffset, std::span<const ya::Vertex>(meshes[meshIndex].vertices));
+            writeBlob(output, cursor, records[meshIndex].skinOffset, std::span<const ya::SkeletonMeshVertex>(meshes[meshIndex].skeletonVertices));
+            writeBlob(output, cursor, records[meshIndex].indexOffset, std::span<const uint32_t>(meshes[meshIndex].indices));
+            writeBlob(output, cursor, records[meshIndex].lodOffset, std::span<const MeshLod>(meshes[meshIndex].lods));
+            writeBlob(output, cursor, records[meshIndex].meshletOffset, std::span<const Meshlet>(meshes[meshIndex].meshlets));
+            writeBlob(output, cursor, records[meshIndex].meshletVertexOffset, std::span<const uint32_t>(meshes[meshIndex].meshletVertices));
+            writeBlob(output, cursor, records[meshIndex].meshletTriangleOffset, std::span<const uint8_t>(meshes[meshIndex].meshletTriangles));
+        }
+        writeBlob(output, cursor, header.fileSize, std::span<const std::byte>());
+
+        output.flush();
+        if (!output.good()) {
+            output.close();
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        ec.clear();
+        std::filesystem::remove(path, ec);
+        ec.clear();
+        std::filesystem::rename(tempPath, path, ec);
+    }
+    if (ec) {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<CookedModel> CookedModel::open(const std::filesystem::path& path, const CookedModelSourceStamp& expectedSource)
+{
+    auto cooked = std::make_shared<CookedModel>();
+    if (!cooked->_file.open(path) || cooked->_file.size() < sizeof(CookedModelHeader)) {
+        return nullptr;
+    }
+
+    CookedModelHeader header{};
+    std::memcpy(&header, cooked->_file.data(), sizeof(header));
+    const uint64_t fileSize = cooked->_file.size();
+    if (header.magic != CookedModelHeader::MAGIC ||
+        header.version != CookedModelHeader::VERSION ||
+        header.headerSize != sizeof(CookedModelHeader) ||
+        header.vertexStride != sizeof(ya::Vertex) ||
+        header.skinVertexStride != sizeof(ya::SkeletonMeshVertex) ||
+        header.fileSize != fileSize ||
+        header.source != expectedSource) {
+        return nullptr;
+    }
+
+    const uint64_t meshTableEnd = header.meshTableOffset + static_cast<uint64_t>(header.meshCount) * sizeof(CookedMeshRecord);
+    if (header.meshTableOffset % alignof(CookedMeshRecord) != 0 || meshTableEnd > fileSize ||
+        header.metaOffset > fileSize || header.metaSize > fileSize - header.metaOffset) {
+        YA_CORE_WARN("CookedModel::open: corrupt section table in '{}'", path.string());
+        return nullptr;
+    }
+
+    const auto* base     = cooked->_file.data();
+    cooked->_meshRecords = {reinterpret_cast<const CookedMeshRecord*>(base + header.meshTableOffset), header.meshCount};
+    for (const auto& record : cooked->_meshRecords) {
+        const bool bInBounds =
+            record.vertexOffset <= fileSize && record.vertexCount * uint64_t{sizeof(ya::Vertex)} <= fileSize - record.vertexOffset &&
+            record.skinOffset <= fileSize && record.skinVertexCount * uint64_t{sizeof(ya::SkeletonMeshVertex)} <= fileSize - record.skinOffset &&
+            record.indexOffset <= fileSize && record.indexCount * uint64_t{sizeof(uint32_t)} <= fileSize - record.indexOffset &&
+            record.lodOffset <= fileSize && record.lodCount * uint64_t{sizeof(MeshLod)} <= fileSize - record.lodOffset &&
+            record.meshletOffset <= fileSize && record.meshletCount * uint64_t{sizeof(Meshlet)} <= fileSize - record.meshletOffset &&
+            record.meshletVertexOffset <= fileSize && record.meshletVertexCount * uint64_t{sizeof(uint32_t)} <= fileSize - record.meshletVertexOffset &&
+            record.meshletTriangleOffset <= fileSize && record.meshletTriangleSize <= fileSize - record.meshletTriangleOffset;
+        const bool bAligned = record.vertexOffset % CookedModelHeader::BLOB_ALIGNMENT == 0 &&
+                              record.skinOffset % CookedModelHeader::BLOB_ALIGNMENT == 0 &&
+                              record.indexOffset % CookedModelHeader::BLOB_ALIGNMENT == 0 &&
+                              record.lodOffset % CookedModelHeader::BLOB_ALIGNMENT == 0 &&
+                              record.meshletOffset % CookedModelHeader::BLOB_ALIGNMENT == 0 &&
+                              record.meshletVertexOffset % CookedModelHeader::BLOB_ALIGNMENT == 0;
+        if (!bInBounds || !bAligned) {
+            YA_CORE_WARN("CookedModel::open: corrupt mesh record in '{}'", path.string());
+            return nullptr;
+        }
+
+        // LOD ranges are handed to draw calls unchecked later on.
+        const auto* lods     = reinterpret_cast<const MeshLod*>(base + record.lodOffset);
+        const bool  bLodsFit = std::all_of(lods, lods + record.lodCount, [&record](const MeshLod& lod) {
+            return lod.firstIndex <= record.indexCount && lod.indexCount <= record.indexCount - lod.firstIndex;
+        });
+        const auto* meshlets     = reinterpret_cast<const Meshlet*>(base + record.meshletOffset);
+        const bool  bMeshletsFit = std::all_of(meshlets, meshlets + record.meshletCount, [&record](const Meshlet& meshlet) {
+            return meshlet.vertexCount <= Meshlet::MAX_VERTICES && meshlet.triangleCount <= Meshlet::MAX_TRIANGLES &&
+                   meshlet.vertexOffset <= record.meshletVertexCount &&
+                   meshlet.vertexCount <= record.meshletVertexCount - meshlet.vertexOffset &&
+                   meshlet.triangleOffset <= record.meshletTriangleSize &&
+                   meshlet.triangleCount * 3u <= record.meshletTriangleSize - meshlet.triangleOffset;
+        });
+        if (!bLodsFit || !bMeshletsFit) {
+            YA_CORE_WARN("CookedModel::open: LOD or meshlet range out of bounds in '{}'", path.string());
+            return nullptr;
+        }
+    }
+
+    if (!cooked->decodeMeta({base + header.metaOffset, static_cast<size_t>(header.metaSize)})) {
+        YA_CORE_WARN("CookedModel::open: corrupt meta section in '{}'", path.string());
+        return nullptr;
+    }
+    return cooked;
+}
+
+bool CookedModel::decodeMeta(std::span<const std::byte> meta)
+{
+    BinaryReader in(meta);
+    _filepath  = in.str();
+    _directory = in.str();
+
+    _meshNames.resize(_meshRecords.size());
+    for (auto& name : _meshNames) {
+        name = in.str();
+    }
+    _meshMaterialIndices = in.podArray<int32_t>();
+    _meshSkeletonIndices = in.podArray<int32_t>();
+
+    _materials.resize(in.count(sizeof(uint32_t) * 5));
+    for (auto& material : _materials) {
+        if (!readMaterial(in, material)) {
+            return false;
+        }
+    }
+
+    _skeletons.resize(in.count(sizeof(uint32_t) * 8));
+    for (auto& skeleton : _skeletons) {
+        if (!readSkeleton(in, skeleton)) {
+            return false;
+        }
+    }
+    return in.ok();
+}
+
+EngineMeshView CookedModel::getMesh(size_t meshIndex) const
+{
+    YA_CORE_ASSERT(meshIndex < _meshRecords.size(), "CookedModel::getMesh index out of range");
+    const auto& record = _meshRecords[meshIndex];
+    const auto* base   = _file.data();
+    EngineMeshView view(
+        _meshNames[meshIndex],
+        {reinterpret_cast<const ya::Vertex*>(base + record.vertexOffset), record.vertexCount},
+        {reinterpret_cast<const ya::SkeletonMeshVertex*>(base + record.skinOffset), record.skinVertexCount},
+        {reinterpret_cast<const uint32_t*>(base + record.indexOffset), record.indexCount},
+        {reinterpret_cast<const MeshLod*>(base + record.lodOffset), record.lodCount});
+    view.meshlets         = {reinterpret_cast<const Meshlet*>(base + record.meshletOffset), record.meshletCount};
+    view.meshletVertices  = {reinterpret_cast<const uint32_t*>(base + record.meshletVertexOffset), record.meshletVertexCount};
+    view.meshletTriangles = {reinterpret_cast<const uint8_t*>(base + record.meshletTriangleOffset), record.meshletTriangleSize};
+    return view;
+}
+
+} // namespace ya
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Core/System/MappedFile.h"
+#include "Resource/Core/EngineMeshData.h"
+#include "Resource/Core/Model/ImportedModelData.h"
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ya
+{
+
+struct Model;
+struct IRender;
+
+/// Identity of the source asset a cooked model was built from. A cooked file
+/// is only reused while its stamp matches the current source file and import
+/// settings.
+struct CookedModelSourceStamp
+{
+    uint64_t pathHash     = 0;
+    uint64_t fileSize     = 0;
+    int64_t  writeTime    = 0;
+    /// MeshOptimizationSettings::hash() of the settings the cook was built with.
+    uint64_t settingsHash = 0;
+
+    bool operator==(const CookedModelSourceStamp&) const = default;
+
+    /// Stamp for @p assetPath, whose physical file is @p physicalPath.
+    /// Returns a zero stamp when the file cannot be stat'ed; the caller sets
+    /// settingsHash.
+    static YA_RESOURCE_CORE_API CookedModelSourceStamp fromFile(std::string_view             assetPath,
+                                                                const std::filesystem::path& physicalPath);
+};
+
+/**
+ * @brief On-disk header of a cooked model (`.yamodel`)
+ *
+ * File layout, every section aligned to BLOB_ALIGNMENT:
+ *   CookedModelHeader | CookedMeshRecord[meshCount] | meta | vertex/skin/index/LOD/meshlet blobs
+ * The blobs are the post-normalization (and post-optimization) EngineMeshData
+ * arrays, byte-for-byte, so a mapped file feeds the GPU upload path directly.
+ * Vertex strides are recorded so a change to ya::Vertex invalidates old files.
+ */
+struct CookedModelHeader
+{
+    static constexpr uint32_t MAGIC          = 0x4D434159; // YACM
+    static constexpr uint32_t VERSION        = 5;
+    static constexpr uint64_t BLOB_ALIGNMENT = 16;
+
+    uint32_t               magic            = MAGIC;
+    uint32_t               version          = VERSION;
+    uint32_t               headerSize       = sizeof(CookedModelHeader);
+    uint32_t               vertexStride     = sizeof(ya::Vertex);
+    uint32_t               skinVertexStride = sizeof(ya::SkeletonMeshVertex);
+    uint32_t               meshCount        = 0;
+    uint32_t               reserved[2]      = {};
+    CookedModelSourceStamp source;
+    uint64_t               meshTableOffset = 0;
+    uint64_t               metaOffset      = 0;
+    uint64_t               metaSize        = 0;
+    uint64_t               fileSize        = 0;
+};
+
+struct CookedMeshRecord
+{
+    uint64_t vertexOffset          = 0;
+    uint64_t skinOffset            = 0;
+    uint64_t indexOffset           = 0;
+    uint32_t vertexCount           = 0;
+    uint32_t skinVertexCount       = 0;
+    /// Covers LOD 0 and every coarser LOD.
+    uint32_t indexCount            = 0;
+    uint32_t lodCount              = 0;
+    uint64_t lodOffset             = 0;
+    uint64_t meshletOffset         = 0;
+    uint64_t meshletVertexOffset   = 0;
+    uint64_t meshletTriangleOffset = 0;
+    uint32_t meshletCount          = 0;
+    uint32_t meshletVertexCount    = 0;
+    /// Bytes, three per triangle.
+    uint32_t meshletTriangleSize   = 0;
+    uint32_t reserved              = 0;
+};
+
+static_assert(sizeof(CookedModelHeader) % CookedModelHeader::BLOB_ALIGNMENT == 0);
+static_assert(sizeof(CookedMeshRecord) % 8 == 0);
+
+/**
+ * @brief Memory-mapped cooked model
+ *
+ * Mesh geometry stays in the mapping and is exposed as EngineMeshView spans;
+ * only the small meta section (names, materials, skeletons, animation keys)
+ * is decoded into owning containers. Vertex data is never parsed or copied on
+ * the CPU.
+ */
+class CookedModel
+{
+  public:
+    /// Map @p path and validate it against @p expectedSource. Returns null for
+    /// a missing, stale, truncated or incompatible file.
+    static YA_RESOURCE_CORE_API std::shared_ptr<CookedModel> open(const std::filesystem::path& path,
+                                                                  const CookedModelSourceStamp& expectedSource);
+
+    /// Write @p importedModel with its normalized @p meshes (one per imported
+    /// mesh). Writes to a temp file and renames, so readers never see a torn file.
+    static YA_RESOURCE_CORE_API bool write(const std::filesystem::path&   path,
+                                           const CookedModelSourceStamp&  source,
+                                           const ImportedModelData&       importedModel,
+                                           std::span<const EngineMeshData> meshes);
+
+    [[nodiscard]] size_t         getMeshCount() const { return _meshRecords.size(); }
+    [[nodiscard]] EngineMeshView getMesh(size_t meshIndex) const;
+
+    [[nodiscard]] const std::string&                       getFilepath() const { return _filepath; }
+    [[nodiscard]] const std::string&                       getDirectory() const { return _directory; }
+    [[nodiscard]] const std::vector<MaterialData>&         getMaterials() const { return _materials; }
+    [[nodiscard]] const std::vector<int32_t>&              getMeshMaterialIndices() const { return _meshMaterialIndices; }
+    [[nodiscard]] const std::vector<int32_t>&              getMeshSkeletonIndices() const { return _meshSkeletonIndices; }
+    [[nodiscard]] const std::vector<ImportedSkeletonData>& getSkeletons() const { return _skeletons; }
+    [[nodiscard]] size_t                                   getMappedSize() const { return _file.size(); }
+
+    /// GPU meshes upload straight from the mapping (defined with Model).
+    std::shared_ptr<Model> createModel(IRender& render) const;
+
+  private:
+    MappedFile                        _file;
+    std::span<const CookedMeshRecord> _meshRecords;
+    std::vector<std::string>          _meshNames;
+    std::string                       _filepath;
+    std::string                       _directory;
+    std::vector<MaterialData>         _materials;
+    std::vector<int32_t>              _meshMaterialIndices;
+    std::vector<int32_t>              _meshSkeletonIndices;
+    std::vector<ImportedSkeletonData> _skeletons;
+
+    bool decodeMeta(std::span<const std::byte> meta);
+};
+
+} // namespace ya
@@ -4,6 +4,7 @@
 #include "Resource/Core/Model/ImportedMeshData.h"
 #include "Resource/Core/Model/ImportedSkeletonData.h"
 #include "Resource/Core/Model/MaterialData.h"
+#include "Resource/Core/Model/MeshOptimizer.h"
 
 #include <algorithm>
 #include <memory>
@@ -36,7 +37,7 @@ struct ImportedModelData
     [[nodiscard]] bool isValid() const { return !meshes.empty(); }
 
     static ImportedModelData decode(const std::string& filepath);
-    std::shared_ptr<Model>   createModel(IRender& render) const;
+    std::shared_ptr<Model>   createModel(IRender& render, const MeshOptimizationSettings& settings = {}) const;
 
     bool hasSkinningDataForMesh(size_t meshIndex, size_t vertexCount) const
     {
@@ -0,0 +1,431 @@
+#include "MeshOptimizer.h"
+
+#include "Resource/Core/Meta/AssetMeta.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+// Bump when an optimization pass changes its output for the same input, so
+// cooked models are rebuilt.
+constexpr uint32_t MESH_OPTIMIZER_VERSION = 3;
+
+constexpr uint32_t INVALID_INDEX = ~0u;
+
+// ── Forsyth vertex cache optimization ──────────────────────────────────
+
+constexpr uint32_t FORSYTH_CACHE_SIZE        = 32;
+constexpr uint32_t FORSYTH_MAX_VALENCE       = 32;
+constexpr float    FORSYTH_CACHE_DECAY_POWER = 1.5f;
+constexpr float    FORSYTH_LAST_TRI_SCORE    = 0.75f;
+constexpr float    FORSYTH_VALENCE_SCALE     = 2.0f;
+constexpr float    FORSYTH_VALENCE_POWER     = 0.5f;
+
+struct ForsythTables
+{
+    std::array<float, FORSYTH_CACHE_SIZE + 1>  cache{};   // [0] = not cached
+    std::array<float, FORSYTH_MAX_VALENCE + 1> valence{}; // [0] = no live triangles
+
+    ForsythTables()
+    {
+        for (uint32_t position = 0; position < FORSYTH_CACHE_SIZE; ++position) {
+            cache[position + 1] = position < 3
+                                    ? FORSYTH_LAST_TRI_SCORE
+                                    : std::pow(1.0f - float(position - 3) / float(FORSYTH_CACHE_SIZE - 3), FORSYTH_CACHE_DECAY_POWER);
+        }
+        for (uint32_t count = 1; count <= FORSYTH_MAX_VALENCE; ++count) {
+            valence[count] = FORSYTH_VALENCE_SCALE * std::pow(float(count), -FORSYTH_VALENCE_POWER);
+        }
+    }
+
+    [[nodiscard]] float score(int32_t cachePosition, uint32_t liveTriangles) const
+    {
+        if (liveTriangles == 0) {
+            return -1.0f;
+        }
+        return cache[cachePosition + 1] + valence[std::min(liveTriangles, FORSYTH_MAX_VALENCE)];
+    }
+};
+
+// ── FIFO cache simulation (timestamp trick: no explicit queue) ─────────
+
+uint32_t updateFifoCache(uint32_t a, uint32_t b, uint32_t c, uint32_t cacheSize, std::vector<uint32_t>& timestamps, uint32_t& timestamp)
+{
+    uint32_t misses = 0;
+    for (const uint32_t vertex : {a, b, c}) {
+        if (timestamp - timestamps[vertex] > cacheSize) {
+            timestamps[vertex] = timestamp++;
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+bool hasValidTriangles(std::span<const uint32_t> indices, size_t vertexCount)
+{
+    return indices.size() % 3 == 0 &&
+           std::ranges::all_of(indices, [vertexCount](uint32_t index) { return index < vertexCount; });
+}
+
+} // namespace
+
+// ── Settings ───────────────────────────────────────────────────────────
+
+uint64_t MeshOptimizationSettings::hash() const
+{
+    uint64_t   hash  = 14695981039346656037ull;
+    const auto mixIn = [&hash](uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            hash ^= (value >> shift) & 0xffu;
+            hash *= 1099511628211ull;
+        }
+    };
+    uint32_t thresholdBits = 0;
+    std::memcpy(&thresholdBits, &overdrawThreshold, sizeof(thresholdBits));
+
+    mixIn(MESH_OPTIMIZER_VERSION);
+    mixIn((bVertexCache ? 1u : 0u) | (bOverdraw ? 2u : 0u) | (bVertexFetch ? 4u : 0u) | (bMeshlets ? 16u : 0u));
+    mixIn(bOverdraw ? thresholdBits : 0u);
+    mixIn(lodCount);
+    if (lodCount > 0) {
+        uint32_t reductionBits = 0;
+        uint32_t errorBits     = 0;
+        std::memcpy(&reductionBits, &lodReduction, sizeof(reductionBits));
+        std::memcpy(&errorBits, &lodMaxError, sizeof(errorBits));
+        mixIn(reductionBits);
+        mixIn(errorBits);
+    }
+    return hash;
+}
+
+MeshOptimizationSettings MeshOptimizationSettings::fromMeta(const AssetMeta& meta)
+{
+    const MeshOptimizationSettings defaults;
+    return MeshOptimizationSettings{
+        .bVertexCache      = meta.getBool("optimizeVertexCache", defaults.bVertexCache),
+        .bOverdraw         = meta.getBool("optimizeOverdraw", defaults.bOverdraw),
+        .overdrawThreshold = std::max(1.0f, meta.getFloat("overdrawThreshold", defaults.overdrawThreshold)),
+        .bVertexFetch      = meta.getBool("optimizeVertexFetch", defaults.bVertexFetch),
+        .bMeshlets         = meta.getBool("buildMeshlets", defaults.bMeshlets),
+        .lodCount          = static_cast<uint32_t>(std::clamp(meta.getInt("lodCount", static_cast<int>(defaults.lodCount)), 0, 7)),
+        .lodReduction      = std::clamp(meta.getFloat("lodReduction", defaults.lodReduction), 0.05f, 0.95f),
+        .lodMaxError       = std::max(0.0f, meta.getFloat("lodMaxError", defaults.lodMaxError)),
+    };
+}
+
+namespace mesh_optimizer
+{
+
+void optimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2) {
+        return;
+    }
+    static const ForsythTables tables;
+
+    // Vertex → triangle adjacency; the first liveCount[v] entries of each
+    // range are the triangles not emitted yet.
+    std::vector<uint32_t> liveCount(vertexCount, 0);
+    for (const uint32_t index : indices) {
+        ++liveCount[index];
+    }
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    std::inclusive_scan(liveCount.begin(), liveCount.end(), adjacencyOffset.begin() + 1);
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+            for (uint32_t corner = 0; corner < 3; ++corner) {
+                adjacency[fill[indices[triangle * 3 + corner]]++] = triangle;
+            }
+        }
+    }
+
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+        vertexScore[vertex] = tables.score(-1, liveCount[vertex]);
+    }
+
+    std::vector<float> triangleScore(triangleCount);
+    std::vector<bool>  emitted(triangleCount, false);
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+        triangleScore[triangle] = vertexScore[indices[triangle * 3]] +
+                                  vertexScore[indices[triangle * 3 + 1]] +
+                                  vertexScore[indices[triangle * 3 + 2]];
+    }
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> nextCache;
+    cache.reserve(FORSYTH_CACHE_SIZE + 3);
+    nextCache.reserve(FORSYTH_CACHE_SIZE + 3);
+
+    uint32_t best        = static_cast<uint32_t>(std::distance(triangleScore.begin(), std::ranges::max_element(triangleScore)));
+    uint32_t inputCursor = 0;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+        if (best == INVALID_INDEX) {
+            // Dead end: nothing adjacent to the cache is left; resume in input order.
+            while (emitted[inputCursor]) {
+                ++inputCursor;
+            }
+            best = inputCursor;
+        }
+
+        const uint32_t corners[3] = {indices[best * 3], indices[best * 3 + 1], indices[best * 3 + 2]};
+        output.insert(output.end(), std::begin(corners), std::end(corners));
+        emitted[best] = true;
+
+        for (const uint32_t vertex : corners) {
+            const uint32_t begin = adjacencyOffset[vertex];
+            const uint32_t end   = begin + liveCount[vertex];
+            for (uint32_t slot = begin; slot < end; ++slot) {
+                if (adjacency[slot] == best) {
+                    std::swap(adjacency[slot], adjacency[end - 1]);
+                    --liveCount[vertex];
+                    break;
+                }
+            }
+        }
+
+        // Most recently used first; duplicates (degenerate triangles) once.
+        nextCache.clear();
+        for (const uint32_t vertex : corners) {
+            if (std::ranges::find(nextCache, vertex) == nextCache.end()) {
+                nextCache.push_back(vertex);
+            }
+        }
+        for (const uint32_t vertex : cache) {
+            if (std::ranges::find(nextCache, vertex) == nextCache.end()) {
+                nextCache.push_back(vertex);
+            }
+        }
+
+        best            = INVALID_INDEX;
+        float bestScore = -1.0f;
+        for (uint32_t position = 0; position < nextCache.size(); ++position) {
+            // Entries past the cache size were just evicted.
+            const uint32_t vertex        = nextCache[position];
+            const int32_t  cachePosition = position < FORSYTH_CACHE_SIZE ? static_cast<int32_t>(position) : -1;
+            const float    newScore      = tables.score(cachePosition, liveCount[vertex]);
+            const float    delta         = newScore - vertexScore[vertex];
+            vertexScore[vertex]          = newScore;
+
+            const uint32_t begin = adjacencyOffset[vertex];
+            for (uint32_t slot = begin; slot < begin + liveCount[vertex]; ++slot) {
+                const uint32_t triangle = adjacency[slot];
+                triangleScore[triangle] += delta;
+                if (triangleScore[triangle] > bestScore) {
+                    bestScore = triangleScore[triangle];
+                    best      = triangle;
+                }
+            }
+        }
+        if (nextCache.size() > FORSYTH_CACHE_SIZE) {
+            nextCache.resize(FORSYTH_CACHE_SIZE);
+        }
+        std::swap(cache, nextCache);
+    }
+
+    std::ranges::copy(output, indices.begin());
+}
+
+void optimizeOverdraw(std::span<uint32_t> indices, std::span<const ya::Vertex> vertices, float threshold)
+{
+    constexpr uint32_t CACHE_SIZE    = 16;
+    const size_t       triangleCount = indices.size() / 3;
+    if (triangleCount < 2) {
+        return;
+    }
+
+    std::vector<uint32_t> timestamps(vertices.size(), 0);
+    uint32_t              timestamp = CACHE_SIZE + 1;
+
+    // Hard boundaries: a triangle with three misses starts a new patch.
+    std::vector<uint32_t> hardClusters;
+    for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+        const uint32_t misses = updateFifoCache(indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2], CACHE_SIZE, timestamps, timestamp);
+        if (triangle == 0 || misses == 3) {
+            hardClusters.push_back(triangle);
+        }
+    }
+
+    // Soft boundaries: split a patch wherever its running miss ratio is
+    // already within the threshold, so sorting costs little cache reuse.
+    std::vector<uint32_t> clusters;
+    for (size_t clusterIndex = 0; clusterIndex < hardClusters.size(); ++clusterIndex) {
+        const uint32_t start = hardClusters[clusterIndex];
+        const uint32_t end   = clusterIndex + 1 < hardClusters.size() ? hardClusters[clusterIndex + 1] : static_cast<uint32_t>(triangleCount);
+
+        timestamp += CACHE_SIZE + 1;
+        uint32_t clusterMisses = 0;
+        for (uint32_t triangle = start; triangle < end; ++triangle) {
+            clusterMisses += updateFifoCache(indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2], CACHE_SIZE, timestamps, timestamp);
+        }
+        const float clusterThreshold = threshold * float(clusterMisses) / float(end - start);
+
+        clusters.push_back(start);
+        timestamp += CACHE_SIZE + 1;
+        uint32_t runningMisses    = 0;
+        uint32_t runningTriangles = 0;
+        for (uint32_t triangle = start; triangle < end; ++triangle) {
+            runningMisses += updateFifoCache(indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2], CACHE_SIZE, timestamps, timestamp);
+            ++runningTriangles;
+            if (float(runningMisses) / float(runningTriangles) <= clusterThreshold) {
+                clusters.push_back(triangle + 1);
+                timestamp += CACHE_SIZE + 1;
+                runningMisses    = 0;
+                runningTriangles = 0;
+            }
+        }
+        // The trailing sub-cluster is usually tiny and cache-hostile: merge it
+        // into the previous one (this also drops a boundary equal to `end`).
+        if (clusters.back() != start) {
+            clusters.pop_back();
+        }
+    }
+
+    // Outward-facing clusters first: they occlude the rest of a convex-ish mesh.
+    glm::dvec3 meshCentroid(0.0);
+    double     meshArea = 0.0;
+    struct ClusterKey
+    {
+        uint32_t start;
+        uint32_t end;
+        float    key;
+    };
+    std::vector<ClusterKey> keys(clusters.size());
+    std::vector<glm::dvec3> clusterCentroids(clusters.size());
+    std::vector<glm::dvec3> clusterNormals(clusters.size());
+    for (size_t clusterIndex = 0; clusterIndex < clusters.size(); ++clusterIndex) {
+        const uint32_t start = clusters[clusterIndex];
+        const uint32_t end   = clusterIndex + 1 < clusters.size() ? clusters[clusterIndex + 1] : static_cast<uint32_t>(triangleCount);
+
+        glm::dvec3 centroid(0.0);
+        glm::dvec3 normal(0.0);
+        double     area = 0.0;
+        for (uint32_t triangle = start; triangle < end; ++triangle) {
+            const glm::dvec3 p0        = vertices[indices[triangle * 3]].position;
+            const glm::dvec3 p1        = vertices[indices[triangle * 3 + 1]].position;
+            const glm::dvec3 p2        = vertices[indices[triangle * 3 + 2]].position;
+            const glm::dvec3 cross     = glm::cross(p1 - p0, p2 - p0);
+            const double     twiceArea = glm::length(cross);
+            centroid += (p0 + p1 + p2) * (twiceArea / 3.0);
+            normal += cross;
+            area += twiceArea;
+        }
+        meshCentroid += centroid;
+        meshArea += area;
+        clusterCentroids[clusterIndex] = area > 0.0 ? centroid / area : centroid;
+        clusterNormals[clusterIndex]   = glm::dot(normal, normal) > 0.0 ? glm::normalize(normal) : normal;
+        keys[clusterIndex]             = ClusterKey{.start = start, .end = end, .key = 0.0f};
+    }
+    if (meshArea > 0.0) {
+        meshCentroid /= meshArea;
+    }
+    for (size_t clusterIndex = 0; clusterIndex < clusters.size(); ++clusterIndex) {
+        keys[clusterIndex].key = static_cast<float>(glm::dot(clusterCentroids[clusterIndex] - meshCentroid, clusterNormals[clusterIndex]));
+    }
+    std::ranges::stable_sort(keys, [](const ClusterKey& lhs, const ClusterKey& rhs) { return lhs.key > rhs.key; });
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    for (const auto& cluster : keys) {
+        output.insert(output.end(), indices.begin() + cluster.start * 3, indices.begin() + cluster.end * 3);
+    }
+    std::ranges::copy(output, indices.begin());
+}
+
+size_t optimizeVertexFetch(EngineMeshData& mesh)
+{
+    std::vector<uint32_t> remap(mesh.vertices.size(), INVALID_INDEX);
+    uint32_t              nextVertex = 0;
+    for (uint32_t& index : mesh.indices) {
+        if (remap[index] == INVALID_INDEX) {
+            remap[index] = nextVertex++;
+        }
+        index = remap[index];
+    }
+
+    for (uint32_t& vertex : mesh.meshletVertices) {
+        vertex = remap[vertex];
+    }
+
+    const bool bRemapSkin = mesh.skeletonVertices.size() == mesh.vertices.size();
+
+    std::vector<ya::Vertex>             vertices(nextVertex);
+    std::vector<ya::SkeletonMeshVertex> skeletonVertices(bRemapSkin ? nextVertex : 0);
+    for (size_t vertex = 0; vertex < remap.size(); ++vertex) {
+        if (remap[vertex] == INVALID_INDEX) {
+            continue;
+        }
+        vertices[remap[vertex]] = mesh.vertices[vertex];
+        if (bRemapSkin) {
+            skeletonVertices[remap[vertex]] = mesh.skeletonVertices[vertex];
+        }
+    }
+    mesh.vertices = std::move(vertices);
+    if (bRemapSkin) {
+        mesh.skeletonVertices = std::move(skeletonVertices);
+    }
+    return nextVertex;
+}
+
+void optimizeMesh(EngineMeshData& mesh, const MeshOptimizationSettings& settings)
+{
+    if (!settings.any() || mesh.indices.empty() || !hasValidTriangles(mesh.indices, mesh.vertices.size())) {
+        return;
+    }
+    // Reordering passes only touch LOD 0; coarser LODs are ordered as they are
+    // built. Once LOD 0 is in meshlet order it must not be reordered again.
+    const std::span<uint32_t> lod0(mesh.indices.data(), mesh.lods.empty() ? mesh.indices.size() : mesh.lods[0].indexCount);
+    if (mesh.meshlets.empty()) {
+        if (settings.bVertexCache) {
+            optimizeVertexCache(lod0, mesh.vertices.size());
+        }
+        if (settings.bOverdraw) {
+            optimizeOverdraw(lod0, mesh.vertices, settings.overdrawThreshold);
+        }
+        if (settings.bMeshlets) {
+            buildMeshlets(mesh);
+        }
+    }
+    if (settings.lodCount > 0 && mesh.lods.empty()) {
+        buildLodChain(mesh, settings);
+    }
+    if (settings.bVertexFetch) {
+        optimizeVertexFetch(mesh);
+    }
+}
+
+VertexCacheStats analyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize)
+{
+    VertexCacheStats stats;
+    if (indices.empty() || vertexCount == 0) {
+        return stats;
+    }
+
+    std::vector<uint32_t> timestamps(vertexCount, 0);
+    uint32_t              timestamp = cacheSize + 1;
+    for (size_t corner = 0; corner + 2 < indices.size(); corner += 3) {
+        stats.vertexTransforms += updateFifoCache(indices[corner], indices[corner + 1], indices[corner + 2], cacheSize, timestamps, timestamp);
+    }
+    stats.acmr = float(stats.vertexTransforms) / float(indices.size() / 3);
+    stats.atvr = float(stats.vertexTransforms) / float(vertexCount);
+    return stats;
+}
+
+} // namespace mesh_optimizer
+
+} // namespace ya
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "Resource/Core/EngineMeshData.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ya
+{
+
+struct AssetMeta;
+struct Frustum;
+
+/**
+ * @brief Import-time mesh optimization switches
+ *
+ * Read from the model's AssetMeta sidecar:
+ * @code
+ * { "optimizeVertexCache": true, "optimizeOverdraw": true, "overdrawThreshold": 1.05,
+ *   "optimizeVertexFetch": true, "buildMeshlets": true,
+ *   "lodCount": 3, "lodReduction": 0.5, "lodMaxError": 0.05 }
+ * @endcode
+ */
+struct MeshOptimizationSettings
+{
+    bool  bVertexCache      = true;
+    bool  bOverdraw         = true;
+    /// Overdraw pass may raise the vertex cache miss ratio by this factor.
+    float overdrawThreshold = 1.05f;
+    bool  bVertexFetch      = true;
+    /// Partition LOD 0 into meshlets (see Meshlet) for cluster culling.
+    bool  bMeshlets         = true;
+    /// Coarser LODs generated below LOD 0 (0 disables the chain).
+    uint32_t lodCount       = 3;
+    /// Target triangle ratio of each LOD to the previous one.
+    float    lodReduction   = 0.5f;
+    /// Simplification stops at this error, relative to the mesh extent.
+    float    lodMaxError    = 0.05f;
+
+    bool operator==(const MeshOptimizationSettings&) const = default;
+
+    [[nodiscard]] bool any() const { return bVertexCache || bOverdraw || bVertexFetch || bMeshlets || lodCount > 0; }
+    /// Changes whenever the optimized output would; part of the cook stamp.
+    [[nodiscard]] YA_RESOURCE_CORE_API uint64_t hash() const;
+
+    static YA_RESOURCE_CORE_API MeshOptimizationSettings fromMeta(const AssetMeta& meta);
+};
+
+/// Post-transform cache behaviour of an index buffer under a FIFO cache.
+struct VertexCacheStats
+{
+    uint32_t vertexTransforms = 0;
+    /// Average cache miss ratio: transforms per triangle (0.5 is ideal on large grids, 3 is worst).
+    float    acmr             = 0.0f;
+    /// Average transform to vertex ratio (1 is ideal).
+    float    atvr             = 0.0f;
+};
+
+namespace mesh_optimizer
+{
+
+/// Reorder triangles for post-transform vertex cache reuse (Forsyth's
+/// linear-speed algorithm). The triangle set and winding are preserved.
+YA_RESOURCE_CORE_API void optimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount);
+
+/**
+ * @brief Reorder vertex-cache-optimized triangles to reduce overdraw
+ *
+ * Splits the index stream into clusters at vertex cache restarts, refines
+ * them while the cluster miss ratio stays within @p threshold times the
+ * original, then draws outward-facing clusters first (Sander et al.,
+ * "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw").
+ */
+YA_RESOURCE_CORE_API void optimizeOverdraw(std::span<uint32_t> indices, std::span<const ya::Vertex> vertices, float threshold);
+
+/// Renumber vertices in first-use order so fetches walk memory linearly.
+/// Unreferenced vertices are dropped; skinning data and meshlet vertex
+/// lists follow their vertex.
+/// Returns the new vertex count.
+YA_RESOURCE_CORE_API size_t optimizeVertexFetch(EngineMeshData& mesh);
+
+/**
+ * @brief Simplify a triangle list with quadric error metrics
+ *
+ * Greedy half-edge collapses (Garland & Heckbert) onto existing vertices, so
+ * the result indexes the same vertex buffer. UV/normal seams (one position,
+ * several attribute sets) and open borders are locked, so silhouettes and
+ * texture charts keep their shape. Stops at @p targetIndexCount or when the
+ * next collapse would exceed @p targetError (relative to the mesh extent).
+ *
+ * @param outError Receives the achieved relative error.
+ */
+YA_RESOURCE_CORE_API std::vector<uint32_t> simplify(std::span<const uint32_t>   indices,
+                                                    std::span<const ya::Vertex> vertices,
+                                                    size_t                      targetIndexCount,
+                                                    float                       targetError,
+                                                    float*                      outError = nullptr);
+
+/// Append a chain of up to settings.lodCount simplified LODs to @p mesh
+/// (see EngineMeshData::lods). Stops early once a level no longer shrinks.
+YA_RESOURCE_CORE_API void buildLodChain(EngineMeshData& mesh, const MeshOptimizationSettings& settings);
+
+/**
+ * @brief Partition LOD 0 into meshlets and rewrite it in meshlet order
+ *
+ * Clusters grow from a seed triangle (taken in index order, so the cache
+ * order survives at cluster granularity) by adding the neighbouring
+ * triangle that brings in the fewest new vertices and bends the normal cone
+ * least, until Meshlet::MAX_VERTICES or MAX_TRIANGLES is reached. Fills
+ * mesh.meshlets, meshletVertices and meshletTriangles. The triangle set is
+ * preserved.
+ */
+YA_RESOURCE_CORE_API void buildMeshlets(EngineMeshData& mesh);
+
+/// Bounding sphere and normal cone of one cluster.
+YA_RESOURCE_CORE_API void computeMeshletBounds(Meshlet&                    meshlet,
+                                               std::span<const uint32_t>   meshletVertices,
+                                               std::span<const uint8_t>    meshletTriangles,
+                                               std::span<const ya::Vertex> vertices);
+
+/// True when every triangle of @p meshlet faces away from @p cameraPosition
+/// (mesh space), for any point of its bounding sphere.
+YA_RESOURCE_CORE_API bool isMeshletBackfacing(const Meshlet& meshlet, const glm::vec3& cameraPosition);
+
+/**
+ * @brief CPU cluster culling against a mesh-space frustum and camera
+ *
+ * Appends the index of every meshlet whose sphere touches @p frustum and
+ * that is not back-facing to @p outVisible. Returns the number appended.
+ */
+YA_RESOURCE_CORE_API size_t cullMeshlets(std::span<const Meshlet> meshlets,
+                                         const Frustum&           frustum,
+                                         const glm::vec3&         cameraPosition,
+                                         std::vector<uint32_t>&   outVisible);
+
+/// Run the passes enabled in @p settings, in cache → overdraw → meshlets →
+/// LOD chain → fetch order. Meshes whose index count is not a multiple of 3
+/// are left untouched.
+YA_RESOURCE_CORE_API void optimizeMesh(EngineMeshData& mesh, const MeshOptimizationSettings& settings);
+
+YA_RESOURCE_CORE_API VertexCacheStats analyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+} // namespace mesh_optimizer
+
+} // namespace ya
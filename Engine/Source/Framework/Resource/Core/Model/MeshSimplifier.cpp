@@ -0,0 +1,387 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr uint32_t INVALID_VERTEX = ~0u;
+
+/// LODs below this many triangles are not worth a separate range.
+constexpr size_t MIN_LOD_TRIANGLES = 32;
+
+/// A LOD must drop at least this fraction of the previous level's triangles.
+constexpr float MIN_LOD_SHRINK = 0.1f;
+
+/// Reject collapses that turn a triangle's normal by more than ~75 degrees.
+constexpr double MAX_FLIP_COS = 0.25;
+
+/// Area-weighted plane quadric; evaluate() returns mean squared distance.
+struct Quadric
+{
+    double a2 = 0, b2 = 0, c2 = 0, d2 = 0;
+    double ab = 0, ac = 0, ad = 0, bc = 0, bd = 0, cd = 0;
+    double weight = 0;
+
+    static Quadric fromPlane(const glm::dvec3& normal, double distance, double weight)
+    {
+        const double a = normal.x, b = normal.y, c = normal.z, d = distance;
+        return Quadric{
+            .a2     = a * a * weight,
+            .b2     = b * b * weight,
+            .c2     = c * c * weight,
+            .d2     = d * d * weight,
+            .ab     = a * b * weight,
+            .ac     = a * c * weight,
+            .ad     = a * d * weight,
+            .bc     = b * c * weight,
+            .bd     = b * d * weight,
+            .cd     = c * d * weight,
+            .weight = weight,
+        };
+    }
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        a2 += other.a2, b2 += other.b2, c2 += other.c2, d2 += other.d2;
+        ab += other.ab, ac += other.ac, ad += other.ad, bc += other.bc, bd += other.bd, cd += other.cd;
+        weight += other.weight;
+        return *this;
+    }
+
+    [[nodiscard]] double evaluate(const glm::dvec3& p) const
+    {
+        const double x = p.x, y = p.y, z = p.z;
+        const double value = a2 * x * x + b2 * y * y + c2 * z * z + d2 +
+                             2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z);
+        return weight > 0.0 ? std::max(value, 0.0) / weight : 0.0;
+    }
+};
+
+template <typename T>
+uint64_t hashBytes(const T& value)
+{
+    uint64_t hash = 14695981039346656037ull;
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    for (size_t index = 0; index < sizeof(T); ++index) {
+        hash ^= bytes[index];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// First vertex with the same bytes as each vertex (attribute-exact weld).
+std::vector<uint32_t> buildCanonicalRemap(std::span<const ya::Vertex> vertices)
+{
+    std::vector<uint32_t>                   canonical(vertices.size());
+    std::unordered_multimap<uint64_t, uint32_t> seen;
+    seen.reserve(vertices.size());
+    for (uint32_t vertex = 0; vertex < vertices.size(); ++vertex) {
+        const uint64_t key   = hashBytes(vertices[vertex]);
+        canonical[vertex]    = vertex;
+        const auto [first, last] = seen.equal_range(key);
+        for (auto it = first; it != last; ++it) {
+            if (std::memcmp(&vertices[it->second], &vertices[vertex], sizeof(ya::Vertex)) == 0) {
+                canonical[vertex] = it->second;
+                break;
+            }
+        }
+        if (canonical[vertex] == vertex) {
+            seen.emplace(key, vertex);
+        }
+    }
+    return canonical;
+}
+
+/// First vertex with the same position as each vertex (topology weld).
+std::vector<uint32_t> buildPositionRemap(std::span<const ya::Vertex> vertices)
+{
+    std::vector<uint32_t>                       positionId(vertices.size());
+    std::unordered_multimap<uint64_t, uint32_t> seen;
+    seen.reserve(vertices.size());
+    for (uint32_t vertex = 0; vertex < vertices.size(); ++vertex) {
+        const uint64_t key   = hashBytes(vertices[vertex].position);
+        positionId[vertex]   = vertex;
+        const auto [first, last] = seen.equal_range(key);
+        for (auto it = first; it != last; ++it) {
+            if (vertices[it->second].position == vertices[vertex].position) {
+                positionId[vertex] = it->second;
+                break;
+            }
+        }
+        if (positionId[vertex] == vertex) {
+            seen.emplace(key, vertex);
+        }
+    }
+    return positionId;
+}
+
+struct Collapse
+{
+    uint32_t from;
+    uint32_t to;
+    double   cost;
+};
+
+} // namespace
+
+namespace mesh_optimizer
+{
+
+std::vector<uint32_t> simplify(std::span<const uint32_t>   indices,
+                               std::span<const ya::Vertex> vertices,
+                               size_t                      targetIndexCount,
+                               float                       targetError,
+                               float*                      outError)
+{
+    if (outError) {
+        *outError = 0.0f;
+    }
+    const size_t vertexCount = vertices.size();
+    if (indices.size() % 3 != 0 || indices.size() <= targetIndexCount ||
+        std::ranges::any_of(indices, [vertexCount](uint32_t index) { return index >= vertexCount; })) {
+        return {indices.begin(), indices.end()};
+    }
+
+    // Collapses run on attribute-welded vertices; topology and quadrics on
+    // position-welded ones, so seams are not mistaken for open borders.
+    const std::vector<uint32_t> canonical  = buildCanonicalRemap(vertices);
+    const std::vector<uint32_t> positionId = buildPositionRemap(vertices);
+
+    std::vector<uint32_t> result(indices.size());
+    std::ranges::transform(indices, result.begin(), [&canonical](uint32_t index) { return canonical[index]; });
+
+    glm::dvec3 boundsMin(std::numeric_limits<double>::max());
+    glm::dvec3 boundsMax(std::numeric_limits<double>::lowest());
+    for (const uint32_t index : result) {
+        const glm::dvec3 position = vertices[index].position;
+        boundsMin                 = glm::min(boundsMin, position);
+        boundsMax                 = glm::max(boundsMax, position);
+    }
+    const glm::dvec3 extent = boundsMax - boundsMin;
+    const double     scale  = std::max({extent.x, extent.y, extent.z, 1e-12});
+
+    // Lock seam wedges (several canonical vertices on one position) and
+    // vertices on open borders (a position edge without its twin).
+    std::vector<uint8_t> bLocked(vertexCount, 0);
+    {
+        std::unordered_map<uint32_t, uint32_t> wedgeOf;
+        for (const uint32_t index : result) {
+            const auto [it, bInserted] = wedgeOf.try_emplace(positionId[index], index);
+            if (!bInserted && it->second != index) {
+                bLocked[positionId[index]] = 1;
+            }
+        }
+
+        std::unordered_map<uint64_t, int32_t> edgeBalance;
+        const auto edgeKey = [](uint32_t a, uint32_t b) { return (uint64_t(std::min(a, b)) << 32) | std::max(a, b); };
+        for (size_t corner = 0; corner < result.size(); corner += 3) {
+            for (int edge = 0; edge < 3; ++edge) {
+                const uint32_t a = positionId[result[corner + edge]];
+                const uint32_t b = positionId[result[corner + (edge + 1) % 3]];
+                edgeBalance[edgeKey(a, b)] += a < b ? 1 : -1;
+            }
+        }
+        for (const auto& [key, balance] : edgeBalance) {
+            if (balance != 0) {
+                bLocked[static_cast<uint32_t>(key >> 32)]     = 1;
+                bLocked[static_cast<uint32_t>(key & ~0u)]     = 1;
+            }
+        }
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+            bLocked[vertex] = bLocked[positionId[vertex]];
+        }
+    }
+
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t corner = 0; corner < result.size(); corner += 3) {
+        const glm::dvec3 p0     = vertices[result[corner]].position;
+        const glm::dvec3 p1     = vertices[result[corner + 1]].position;
+        const glm::dvec3 p2     = vertices[result[corner + 2]].position;
+        glm::dvec3       normal = glm::cross(p1 - p0, p2 - p0);
+        const double     area   = glm::length(normal);
+        if (area <= 0.0) {
+            continue;
+        }
+        normal /= area;
+        const Quadric plane = Quadric::fromPlane(normal, -glm::dot(normal, p0), area);
+        for (int corner3 = 0; corner3 < 3; ++corner3) {
+            quadrics[positionId[result[corner + corner3]]] += plane;
+        }
+    }
+
+    const double          maxErrorSq = double(targetError) * scale * double(targetError) * scale;
+    double                achievedSq = 0.0;
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<uint8_t>  bTouched(vertexCount);
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> candidates;
+
+    while (result.size() > targetIndexCount) {
+        const size_t triangleCount = result.size() / 3;
+
+        std::ranges::fill(adjacencyOffset, 0);
+        for (const uint32_t index : result) {
+            ++adjacencyOffset[index + 1];
+        }
+        std::partial_sum(adjacencyOffset.begin(), adjacencyOffset.end(), adjacencyOffset.begin());
+        adjacency.resize(result.size());
+        {
+            std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+            for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+                for (int corner = 0; corner < 3; ++corner) {
+                    adjacency[fill[result[triangle * 3 + corner]]++] = triangle;
+                }
+            }
+        }
+
+        // Cheapest outgoing collapse per unlocked vertex.
+        candidates.clear();
+        for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+            for (int edge = 0; edge < 3; ++edge) {
+                const uint32_t from = result[triangle * 3 + edge];
+                for (const int other : {(edge + 1) % 3, (edge + 2) % 3}) {
+                    const uint32_t to = result[triangle * 3 + other];
+                    if (bLocked[from] || from == to) {
+                        continue;
+                    }
+                    Quadric merged = quadrics[positionId[from]];
+                    merged += quadrics[positionId[to]];
+                    candidates.push_back(Collapse{.from = from, .to = to, .cost = merged.evaluate(vertices[to].position)});
+                }
+            }
+        }
+        std::ranges::sort(candidates, [](const Collapse& lhs, const Collapse& rhs) {
+            return lhs.from != rhs.from ? lhs.from < rhs.from : lhs.cost < rhs.cost;
+        });
+        candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.from == rhs.from; }),
+                         candidates.end());
+        std::ranges::stable_sort(candidates, [](const Collapse& lhs, const Collapse& rhs) { return lhs.cost < rhs.cost; });
+
+        std::iota(remap.begin(), remap.end(), 0u);
+        std::ranges::fill(bTouched, 0);
+        const size_t trianglesToRemove = (result.size() - targetIndexCount) / 3;
+        size_t       removed           = 0;
+        size_t       collapses         = 0;
+
+        for (const Collapse& collapse : candidates) {
+            if (collapse.cost > maxErrorSq || removed >= trianglesToRemove) {
+                break;
+            }
+            if (bTouched[collapse.from] || bTouched[collapse.to]) {
+                continue;
+            }
+
+            // Triangles around `from` that survive must not flip.
+            const glm::dvec3 target   = vertices[collapse.to].position;
+            bool             bFlips   = false;
+            size_t           vanished = 0;
+            for (uint32_t slot = adjacencyOffset[collapse.from]; slot < adjacencyOffset[collapse.from + 1] && !bFlips; ++slot) {
+                const uint32_t* triangle = &result[adjacency[slot] * 3];
+                if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to) {
+                    ++vanished;
+                    continue;
+                }
+                glm::dvec3 before[3];
+                glm::dvec3 after[3];
+                for (int corner = 0; corner < 3; ++corner) {
+                    before[corner] = vertices[triangle[corner]].position;
+                    after[corner]  = triangle[corner] == collapse.from ? target : before[corner];
+                }
+                const glm::dvec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+                const glm::dvec3 normalAfter  = glm::cross(after[1] - after[0], after[2] - after[0]);
+                const double     lengths      = glm::length(normalBefore) * glm::length(normalAfter);
+                bFlips                        = lengths <= 0.0 || glm::dot(normalBefore, normalAfter) < MAX_FLIP_COS * lengths;
+            }
+            if (bFlips) {
+                continue;
+            }
+
+            // Freeze the one-ring for the rest of this pass so later flip
+            // tests see up-to-date topology.
+            for (uint32_t slot = adjacencyOffset[collapse.from]; slot < adjacencyOffset[collapse.from + 1]; ++slot) {
+                for (int corner = 0; corner < 3; ++corner) {
+                    bTouched[result[adjacency[slot] * 3 + corner]] = 1;
+                }
+            }
+            remap[collapse.from] = collapse.to;
+            quadrics[positionId[collapse.to]] += quadrics[positionId[collapse.from]];
+            achievedSq = std::max(achievedSq, collapse.cost);
+            removed += vanished;
+            ++collapses;
+        }
+        if (collapses == 0) {
+            break;
+        }
+
+        size_t write = 0;
+        for (size_t corner = 0; corner < result.size(); corner += 3) {
+            const uint32_t a = remap[result[corner]];
+            const uint32_t b = remap[result[corner + 1]];
+            const uint32_t c = remap[result[corner + 2]];
+            if (a != b && b != c && a != c) {
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+        }
+        result.resize(write);
+    }
+
+    if (outError) {
+        *outError = static_cast<float>(std::sqrt(achievedSq) / scale);
+    }
+    return result;
+}
+
+void buildLodChain(EngineMeshData& mesh, const MeshOptimizationSettings& settings)
+{
+    if (!mesh.lods.empty() || mesh.indices.size() < MIN_LOD_TRIANGLES * 3 * 2) {
+        return;
+    }
+
+    const std::vector<uint32_t> base(mesh.indices);
+    mesh.lods.push_back(MeshLod{.firstIndex = 0, .indexCount = static_cast<uint32_t>(base.size())});
+
+    size_t targetIndexCount = base.size();
+    for (uint32_t level = 1; level <= settings.lodCount; ++level) {
+        targetIndexCount = static_cast<size_t>(double(targetIndexCount / 3) * settings.lodReduction) * 3;
+        if (targetIndexCount < MIN_LOD_TRIANGLES * 3) {
+            break;
+        }
+
+        // Every level starts from LOD 0 so errors do not compound.
+        float      error = 0.0f;
+        auto       lod   = simplify(base, mesh.vertices, targetIndexCount, settings.lodMaxError, &error);
+        const auto& prev = mesh.lods.back();
+        if (lod.empty() || float(lod.size()) > float(prev.indexCount) * (1.0f - MIN_LOD_SHRINK)) {
+            break;
+        }
+        optimizeVertexCache(lod, mesh.vertices.size());
+
+        mesh.lods.push_back(MeshLod{
+            .firstIndex = static_cast<uint32_t>(mesh.indices.size()),
+            .indexCount = static_cast<uint32_t>(lod.size()),
+            .error      = std::max(error, prev.error),
+        });
+        mesh.indices.insert(mesh.indices.end(), lod.begin(), lod.end());
+        targetIndexCount = lod.size();
+    }
+
+    if (mesh.lods.size() == 1) {
+        mesh.lods.clear();
+    }
+}
+
+} // namespace mesh_optimizer
+
+} // namespace ya
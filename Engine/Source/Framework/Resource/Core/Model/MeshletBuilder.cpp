@@ -0,0 +1,294 @@
+#include "MeshOptimizer.h"
+
+#include "Core/Math/Frustum.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+constexpr uint32_t INVALID_SLOT = ~0u;
+
+/// Weight of the normal-cone and distance terms against one new vertex.
+constexpr float CONE_WEIGHT     = 1.0f;
+constexpr float DISTANCE_WEIGHT = 0.5f;
+
+struct MeshletAccumulator
+{
+    std::vector<uint32_t> vertices;
+    std::vector<uint32_t> triangles;
+    glm::vec3             normalSum{0.0f};
+    glm::vec3             centroidSum{0.0f};
+};
+
+} // namespace
+
+namespace mesh_optimizer
+{
+
+void computeMeshletBounds(Meshlet&                    meshlet,
+                          std::span<const uint32_t>   meshletVertices,
+                          std::span<const uint8_t>    meshletTriangles,
+                          std::span<const ya::Vertex> vertices)
+{
+    const auto localVertices  = meshletVertices.subspan(meshlet.vertexOffset, meshlet.vertexCount);
+    const auto localTriangles = meshletTriangles.subspan(meshlet.triangleOffset, size_t{meshlet.triangleCount} * 3);
+
+    glm::vec3 boundsMin(std::numeric_limits<float>::max());
+    glm::vec3 boundsMax(std::numeric_limits<float>::lowest());
+    for (const uint32_t vertex : localVertices) {
+        boundsMin = glm::min(boundsMin, vertices[vertex].position);
+        boundsMax = glm::max(boundsMax, vertices[vertex].position);
+    }
+    meshlet.center = (boundsMin + boundsMax) * 0.5f;
+    meshlet.radius = 0.0f;
+    for (const uint32_t vertex : localVertices) {
+        meshlet.radius = std::max(meshlet.radius, glm::length(vertices[vertex].position - meshlet.center));
+    }
+
+    // Area-weighted mean normal as the axis; the cutoff is the widest
+    // deviation of any non-degenerate triangle from it.
+    std::vector<glm::vec3> normals;
+    normals.reserve(meshlet.triangleCount);
+    glm::vec3 axis(0.0f);
+    for (size_t corner = 0; corner < localTriangles.size(); corner += 3) {
+        const glm::vec3& p0     = vertices[localVertices[localTriangles[corner]]].position;
+        const glm::vec3& p1     = vertices[localVertices[localTriangles[corner + 1]]].position;
+        const glm::vec3& p2     = vertices[localVertices[localTriangles[corner + 2]]].position;
+        const glm::vec3  normal = glm::cross(p1 - p0, p2 - p0);
+        const float      area   = glm::length(normal);
+        if (area > 0.0f) {
+            axis += normal;
+            normals.push_back(normal / area);
+        }
+    }
+
+    const float axisLength = glm::length(axis);
+    if (normals.empty() || axisLength <= 0.0f) {
+        meshlet.coneAxis   = glm::vec3(0.0f, 0.0f, 1.0f);
+        meshlet.coneCutoff = -1.0f;
+        return;
+    }
+    meshlet.coneAxis   = axis / axisLength;
+    meshlet.coneCutoff = 1.0f;
+    for (const glm::vec3& normal : normals) {
+        meshlet.coneCutoff = std::min(meshlet.coneCutoff, glm::dot(meshlet.coneAxis, normal));
+    }
+}
+
+void buildMeshlets(EngineMeshData& mesh)
+{
+    mesh.meshlets.clear();
+    mesh.meshletVertices.clear();
+    mesh.meshletTriangles.clear();
+
+    const std::span<uint32_t> lod0(mesh.indices.data(), mesh.lods.empty() ? mesh.indices.size() : mesh.lods[0].indexCount);
+    const size_t              triangleCount = lod0.size() / 3;
+    const size_t              vertexCount   = mesh.vertices.size();
+    if (triangleCount == 0 || lod0.size() % 3 != 0 ||
+        std::ranges::any_of(lod0, [vertexCount](uint32_t index) { return index >= vertexCount; })) {
+        return;
+    }
+
+    std::vector<glm::vec3> triangleNormals(triangleCount);
+    std::vector<glm::vec3> triangleCentroids(triangleCount);
+    float                  edgeSum = 0.0f;
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+        const glm::vec3& p0       = mesh.vertices[lod0[triangle * 3]].position;
+        const glm::vec3& p1       = mesh.vertices[lod0[triangle * 3 + 1]].position;
+        const glm::vec3& p2       = mesh.vertices[lod0[triangle * 3 + 2]].position;
+        const glm::vec3  normal   = glm::cross(p1 - p0, p2 - p0);
+        const float      area     = glm::length(normal);
+        triangleNormals[triangle] = area > 0.0f ? normal / area : glm::vec3(0.0f);
+        triangleCentroids[triangle] = (p0 + p1 + p2) / 3.0f;
+        edgeSum += glm::length(p1 - p0) + glm::length(p2 - p1) + glm::length(p0 - p2);
+    }
+    const float averageEdge = std::max(edgeSum / float(triangleCount * 3), 1e-6f);
+
+    // Vertex → triangle adjacency (CSR).
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (const uint32_t index : lod0) {
+        ++adjacencyOffset[index + 1];
+    }
+    std::partial_sum(adjacencyOffset.begin(), adjacencyOffset.end(), adjacencyOffset.begin());
+    std::vector<uint32_t> adjacency(lod0.size());
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+            for (int corner = 0; corner < 3; ++corner) {
+                adjacency[fill[lod0[triangle * 3 + corner]]++] = triangle;
+            }
+        }
+    }
+
+    std::vector<uint8_t>  bEmitted(triangleCount, 0);
+    std::vector<uint32_t> candidateStamp(triangleCount, INVALID_SLOT);
+    std::vector<uint32_t> vertexSlot(vertexCount, INVALID_SLOT);
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> reordered;
+    reordered.reserve(lod0.size());
+
+    MeshletAccumulator current;
+    size_t             seedCursor = 0;
+
+    const auto newVertexCount = [&](uint32_t triangle) {
+        const uint32_t a = lod0[triangle * 3], b = lod0[triangle * 3 + 1], c = lod0[triangle * 3 + 2];
+        uint32_t       count = 0;
+        count += vertexSlot[a] == INVALID_SLOT;
+        count += vertexSlot[b] == INVALID_SLOT && b != a;
+        count += vertexSlot[c] == INVALID_SLOT && c != a && c != b;
+        return count;
+    };
+
+    const auto fits = [&](uint32_t triangle) {
+        return current.triangles.size() < Meshlet::MAX_TRIANGLES &&
+               current.vertices.size() + newVertexCount(triangle) <= Meshlet::MAX_VERTICES;
+    };
+
+    const auto addTriangle = [&](uint32_t triangle) {
+        bEmitted[triangle] = 1;
+        current.triangles.push_back(triangle);
+        current.normalSum += triangleNormals[triangle];
+        current.centroidSum += triangleCentroids[triangle];
+        for (int corner = 0; corner < 3; ++corner) {
+            const uint32_t vertex = lod0[triangle * 3 + corner];
+            if (vertexSlot[vertex] == INVALID_SLOT) {
+                vertexSlot[vertex] = static_cast<uint32_t>(current.vertices.size());
+                current.vertices.push_back(vertex);
+            }
+            for (uint32_t slot = adjacencyOffset[vertex]; slot < adjacencyOffset[vertex + 1]; ++slot) {
+                const uint32_t neighbour = adjacency[slot];
+                if (!bEmitted[neighbour] && candidateStamp[neighbour] != mesh.meshlets.size()) {
+                    candidateStamp[neighbour] = static_cast<uint32_t>(mesh.meshlets.size());
+                    candidates.push_back(neighbour);
+                }
+            }
+        }
+    };
+
+    const auto flush = [&]() {
+        Meshlet meshlet{
+            .vertexOffset   = static_cast<uint32_t>(mesh.meshletVertices.size()),
+            .triangleOffset = static_cast<uint32_t>(mesh.meshletTriangles.size()),
+            .vertexCount    = static_cast<uint32_t>(current.vertices.size()),
+            .triangleCount  = static_cast<uint32_t>(current.triangles.size()),
+        };
+        mesh.meshletVertices.insert(mesh.meshletVertices.end(), current.vertices.begin(), current.vertices.end());
+        for (const uint32_t triangle : current.triangles) {
+            for (int corner = 0; corner < 3; ++corner) {
+                const uint32_t vertex = lod0[triangle * 3 + corner];
+                mesh.meshletTriangles.push_back(static_cast<uint8_t>(vertexSlot[vertex]));
+                reordered.push_back(vertex);
+            }
+        }
+        for (const uint32_t vertex : current.vertices) {
+            vertexSlot[vertex] = INVALID_SLOT;
+        }
+        computeMeshletBounds(meshlet, mesh.meshletVertices, mesh.meshletTriangles, mesh.vertices);
+        mesh.meshlets.push_back(meshlet);
+
+        current.vertices.clear();
+        current.triangles.clear();
+        current.normalSum   = glm::vec3(0.0f);
+        current.centroidSum = glm::vec3(0.0f);
+        candidates.clear();
+    };
+
+    size_t emittedCount = 0;
+    while (emittedCount < triangleCount) {
+        // Best neighbouring triangle: fewest new vertices, then the one that
+        // keeps the cluster flat and compact.
+        uint32_t best      = INVALID_SLOT;
+        float    bestScore = std::numeric_limits<float>::max();
+        if (!current.triangles.empty()) {
+            const float     normalLength = glm::length(current.normalSum);
+            const glm::vec3 axis         = normalLength > 0.0f ? current.normalSum / normalLength : glm::vec3(0.0f);
+            const glm::vec3 centroid     = current.centroidSum / float(current.triangles.size());
+            const float     spread       = averageEdge * std::sqrt(float(current.triangles.size()));
+
+            std::erase_if(candidates, [&bEmitted](uint32_t triangle) { return bEmitted[triangle] != 0; });
+            for (const uint32_t triangle : candidates) {
+                if (!fits(triangle)) {
+                    continue;
+                }
+                const float score = float(newVertexCount(triangle)) +
+                                    CONE_WEIGHT * (1.0f - glm::dot(axis, triangleNormals[triangle])) +
+                                    DISTANCE_WEIGHT * glm::length(triangleCentroids[triangle] - centroid) / spread;
+                if (score < bestScore) {
+                    bestScore = score;
+                    best      = triangle;
+                }
+            }
+        }
+
+        if (best == INVALID_SLOT) {
+            // Island exhausted or cluster full: continue with the next
+            // triangle in index order, in a new cluster unless it still fits.
+            while (bEmitted[seedCursor]) {
+                ++seedCursor;
+            }
+            best = static_cast<uint32_t>(seedCursor);
+            if (!current.triangles.empty() && !fits(best)) {
+                flush();
+            }
+        }
+
+        addTriangle(best);
+        ++emittedCount;
+    }
+    if (!current.triangles.empty()) {
+        flush();
+    }
+
+    std::ranges::copy(reordered, lod0.begin());
+}
+
+bool isMeshletBackfacing(const Meshlet& meshlet, const glm::vec3& cameraPosition)
+{
+    if (meshlet.coneCutoff <= 0.0f) {
+        return false;
+    }
+    const glm::vec3 toCenter = meshlet.center - cameraPosition;
+    const float     distance = glm::length(toCenter);
+    if (distance <= meshlet.radius) {
+        return false;
+    }
+
+    // Every normal n is within angle a of the axis and the view direction to
+    // the sphere center is at angle t from it, so dot(n, v) >= |v| cos(t + a);
+    // the cluster faces away for every point of the sphere when that exceeds
+    // the radius.
+    const float cosView  = glm::dot(toCenter, meshlet.coneAxis) / distance;
+    const float sinView  = std::sqrt(std::max(0.0f, 1.0f - cosView * cosView));
+    const float cosCone  = meshlet.coneCutoff;
+    const float sinCone  = std::sqrt(std::max(0.0f, 1.0f - cosCone * cosCone));
+    return cosView * cosCone - sinView * sinCone > meshlet.radius / distance;
+}
+
+size_t cullMeshlets(std::span<const Meshlet> meshlets,
+                    const Frustum&           frustum,
+                    const glm::vec3&         cameraPosition,
+                    std::vector<uint32_t>&   outVisible)
+{
+    const size_t before = outVisible.size();
+    for (uint32_t index = 0; index < meshlets.size(); ++index) {
+        const Meshlet& meshlet = meshlets[index];
+        const bool     bInside = std::ranges::all_of(frustum.planes, [&meshlet](const glm::vec4& plane) {
+            return glm::dot(glm::vec3(plane), meshlet.center) + plane.w >= -meshlet.radius;
+        });
+        if (bInside && !isMeshletBackfacing(meshlet, cameraPosition)) {
+            outVisible.push_back(index);
+        }
+    }
+    return outVisible.size() - before;
+}
+
+} // namespace mesh_optimizer
+
+} // namespace ya
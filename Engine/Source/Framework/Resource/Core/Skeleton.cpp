@@ -131,6 +131,11 @@ std::shared_ptr<Skeleton> createSkeleton(const ImportedSkeletonData& importedSke
         skeleton->animations.push_back(std::move(clip));
     }
 
+    skeleton->compressedAnimations.reserve(skeleton->animations.size());
+    for (const SkeletonAnimationClip& clip : skeleton->animations) {
+        skeleton->compressedAnimations.push_back(compressAnimationClip(*skeleton, clip));
+    }
+
     return skeleton;
 }
 
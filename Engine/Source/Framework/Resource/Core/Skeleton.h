@@ -2,6 +2,7 @@
 
 #include "Core/FName.h"
 #include "Model/IModelImporter.h"
+#include "Resource/Core/CompressedAnimationClip.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -73,9 +74,11 @@ struct Skeleton
 {
     std::string name;
 
-    std::vector<SkeletonNodeInfo>      nodes;
-    std::vector<SkeletonBoneInfo>      bones;
-    std::vector<SkeletonAnimationClip> animations;
+    std::vector<SkeletonNodeInfo>       nodes;
+    std::vector<SkeletonBoneInfo>       bones;
+    std::vector<SkeletonAnimationClip>  animations;
+    /// Runtime form of `animations`, index for index; empty when not cooked.
+    std::vector<CompressedSkeletonClip> compressedAnimations;
 
     uint32_t rootNodeIndex = INVALID_SKELETON_NODE_INDEX;
     uint32_t rootBoneIndex = INVALID_SKELETON_BONE_INDEX;
@@ -118,6 +121,11 @@ struct Skeleton
     {
         return index < animations.size() ? &animations[index] : nullptr;
     }
+
+    const CompressedSkeletonClip* getCompressedAnimation(size_t index) const
+    {
+        return index < compressedAnimations.size() ? &compressedAnimations[index] : nullptr;
+    }
 };
 
 YA_RESOURCE_CORE_API std::shared_ptr<Skeleton> createSkeleton(const ImportedSkeletonData& importedSkeletonData);
@@ -1,6 +1,6 @@
 #include "Resource/Core/SkeletonAnimationSampler.h"
 
-#include <glm/gtc/matrix_transform.hpp>
+#include "Core/Math/SimdMath.h"
 
 #include <algorithm>
 #include <cmath>
@@ -11,6 +11,27 @@ namespace
 {
 constexpr float ZERO_SCALE_EPSILON = 1e-6f;
 
+/// T * R * S written straight from the components, without the three
+/// matrix products.
+inline void composeTrs(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale, glm::mat4& out)
+{
+    const glm::quat q  = glm::normalize(rotation);
+    const float     xx = q.x * q.x;
+    const float     yy = q.y * q.y;
+    const float     zz = q.z * q.z;
+    const float     xy = q.x * q.y;
+    const float     xz = q.x * q.z;
+    const float     yz = q.y * q.z;
+    const float     wx = q.w * q.x;
+    const float     wy = q.w * q.y;
+    const float     wz = q.w * q.z;
+
+    out[0] = glm::vec4((1.0f - 2.0f * (yy + zz)) * scale.x, 2.0f * (xy + wz) * scale.x, 2.0f * (xz - wy) * scale.x, 0.0f);
+    out[1] = glm::vec4(2.0f * (xy - wz) * scale.y, (1.0f - 2.0f * (xx + zz)) * scale.y, 2.0f * (yz + wx) * scale.y, 0.0f);
+    out[2] = glm::vec4(2.0f * (xz + wy) * scale.z, 2.0f * (yz - wx) * scale.z, (1.0f - 2.0f * (xx + yy)) * scale.z, 0.0f);
+    out[3] = glm::vec4(position, 1.0f);
+}
+
 float interpolationFactor(double lhsTime, double rhsTime, double time)
 {
     const double range = rhsTime - lhsTime;
@@ -34,7 +55,148 @@ size_t findQuatKeyframeIndex(const std::vector<SkeletonQuatKeyframe>& keys, doub
     return static_cast<size_t>(std::distance(keys.begin(), upper) - 1);
 }
 
-SkeletonChannelSample decomposeTransform(const glm::mat4& transform)
+constexpr glm::mat4 identityTransform()
+{
+    return glm::mat4(1.0f);
+}
+
+double sampleTimeForClip(double time, double duration, bool loop)
+{
+    if (duration <= 0.0) {
+        return 0.0;
+    }
+    if (loop) {
+        return SkeletonAnimationSampler::wrapTime(time, duration);
+    }
+    return std::clamp(time, 0.0, duration);
+}
+
+void preparePose(const Skeleton& skeleton, SkeletonPose& outPose)
+{
+    const bool needsRebuild = outPose.sourceSkeleton != &skeleton ||
+                              outPose.localTransforms.size() != skeleton.nodes.size() ||
+                              outPose.globalTransforms.size() != skeleton.nodes.size() ||
+                              outPose.boneMatrices.size() != skeleton.bones.size();
+
+    if (needsRebuild) {
+        outPose.sourceSkeleton = &skeleton;
+        outPose.localTransforms.resize(skeleton.nodes.size());
+        outPose.globalTransforms.resize(skeleton.nodes.size());
+        outPose.boneMatrices.resize(skeleton.bones.size());
+        outPose.animatedNodeIndices.clear();
+
+        for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
+            outPose.localTransforms[nodeIndex] = skeleton.nodes[nodeIndex].localTransform;
+        }
+    }
+    else {
+        for (uint32_t nodeIndex : outPose.animatedNodeIndices) {
+            if (nodeIndex < skeleton.nodes.size()) {
+                outPose.localTransforms[nodeIndex] = skeleton.nodes[nodeIndex].localTransform;
+            }
+        }
+        outPose.animatedNodeIndices.clear();
+    }
+}
+
+void finishPose(const Skeleton& skeleton, SkeletonPose& outPose)
+{
+    for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
+        const uint32_t parentIndex = skeleton.nodes[nodeIndex].parentIndex;
+        if (parentIndex == INVALID_SKELETON_NODE_INDEX || parentIndex >= outPose.globalTransforms.size()) {
+            outPose.globalTransforms[nodeIndex] = outPose.localTransforms[nodeIndex];
+        }
+        else {
+            simd_math::multiplyMat4(outPose.globalTransforms[parentIndex], outPose.localTransforms[nodeIndex], outPose.globalTransforms[nodeIndex]);
+        }
+    }
+
+    for (size_t boneIndex = 0; boneIndex < skeleton.bones.size(); ++boneIndex) {
+        const SkeletonBoneInfo& bone = skeleton.bones[boneIndex];
+        if (bone.nodeIndex >= outPose.globalTransforms.size()) {
+            outPose.boneMatrices[boneIndex] = identityTransform();
+            continue;
+        }
+        simd_math::multiplyMat4(outPose.globalTransforms[bone.nodeIndex], bone.offsetMatrix, outPose.boneMatrices[boneIndex]);
+    }
+}
+
+/**
+ * Step @p key (absolute, within [begin, end)) to the last key at or before
+ * @p frame and return the blend factor towards the next key. Forward motion
+ * walks at most a few keys; a rewind re-seeks with a binary search.
+ */
+float advanceKey(const std::vector<uint16_t>& frames, uint32_t begin, uint32_t end, uint32_t& key, double frame, bool bRewind)
+{
+    // Tracks skipped by LOD sampling may hold keys past the current frame.
+    if (bRewind || key < begin || key >= end || static_cast<double>(frames[key]) > frame) {
+        const auto upper = std::upper_bound(frames.begin() + begin, frames.begin() + end, frame, [](double value, uint16_t keyFrame) {
+            return value < static_cast<double>(keyFrame);
+        });
+        key = std::max(begin, static_cast<uint32_t>(std::distance(frames.begin(), upper)) - 1u);
+    }
+    while (key + 1 < end && static_cast<double>(frames[key + 1]) <= frame) {
+        ++key;
+    }
+    if (key + 1 >= end) {
+        return 0.0f;
+    }
+    return static_cast<float>((frame - frames[key]) / static_cast<double>(frames[key + 1] - frames[key]));
+}
+
+template <typename Fn>
+void forEachCompressedTrack(const CompressedSkeletonClip& clip, double time, bool loop, CompressedClipCursor& cursor, uint32_t trackLimit, Fn&& fn)
+{
+    const uint32_t trackCount = clip.getTrackCount();
+    if (cursor.clip != &clip || cursor.keys.size() != static_cast<size_t>(trackCount) * 3) {
+        cursor.reset(clip);
+    }
+
+    const double clipTime = sampleTimeForClip(time, clip.duration, loop);
+    const double frame    = clip.frameInterval > 0.0
+                                ? std::min(clipTime / clip.frameInterval, static_cast<double>(clip.frameCount - 1))
+                                : 0.0;
+    const bool bRewind = frame < cursor.frame;
+    cursor.frame       = frame;
+
+    uint32_t* rotationKeys = cursor.keys.data();
+    uint32_t* positionKeys = rotationKeys + trackCount;
+    uint32_t* scaleKeys    = positionKeys + trackCount;
+    for (uint32_t track = 0, end = std::min(trackLimit, trackCount); track < end; ++track) {
+        SkeletonChannelSample sample;
+
+        const float    rotationT   = advanceKey(clip.rotationFrames, clip.rotationKeyOffsets[track], clip.rotationKeyOffsets[track + 1], rotationKeys[track], frame, bRewind);
+        const uint32_t rotationKey = rotationKeys[track];
+        sample.rotation            = animation_codec::decodeQuat(clip.rotations[rotationKey]);
+        if (rotationT > 0.0f) {
+            sample.rotation = animation_codec::nlerp(sample.rotation, animation_codec::decodeQuat(clip.rotations[rotationKey + 1]), rotationT);
+        }
+
+        const glm::vec3& positionMin    = clip.positionMins[track];
+        const glm::vec3& positionExtent = clip.positionExtents[track];
+        const float      positionT      = advanceKey(clip.positionFrames, clip.positionKeyOffsets[track], clip.positionKeyOffsets[track + 1], positionKeys[track], frame, bRewind);
+        const uint32_t   positionKey    = positionKeys[track];
+        sample.position                 = animation_codec::decodeVec3(clip.positions[positionKey], positionMin, positionExtent);
+        if (positionT > 0.0f) {
+            sample.position = glm::mix(sample.position, animation_codec::decodeVec3(clip.positions[positionKey + 1], positionMin, positionExtent), positionT);
+        }
+
+        const glm::vec3& scaleMin    = clip.scaleMins[track];
+        const glm::vec3& scaleExtent = clip.scaleExtents[track];
+        const float      scaleT      = advanceKey(clip.scaleFrames, clip.scaleKeyOffsets[track], clip.scaleKeyOffsets[track + 1], scaleKeys[track], frame, bRewind);
+        const uint32_t   scaleKey    = scaleKeys[track];
+        sample.scale                 = animation_codec::decodeVec3(clip.scales[scaleKey], scaleMin, scaleExtent);
+        if (scaleT > 0.0f) {
+            sample.scale = glm::mix(sample.scale, animation_codec::decodeVec3(clip.scales[scaleKey + 1], scaleMin, scaleExtent), scaleT);
+        }
+
+        fn(track, sample);
+    }
+}
+
+} // namespace
+
+SkeletonChannelSample SkeletonAnimationSampler::decomposeTransform(const glm::mat4& transform)
 {
     SkeletonChannelSample sample;
     sample.position = glm::vec3(transform[3]);
@@ -53,31 +215,13 @@ SkeletonChannelSample decomposeTransform(const glm::mat4& transform)
     return sample;
 }
 
-constexpr glm::mat4 identityTransform()
-{
-    return glm::mat4(1.0f);
-}
-
-glm::mat4 composeTransform(const SkeletonChannelSample& sample)
+glm::mat4 SkeletonAnimationSampler::composeTransform(const SkeletonChannelSample& sample)
 {
-    return glm::translate(identityTransform(), sample.position) *
-           glm::mat4_cast(glm::normalize(sample.rotation)) *
-           glm::scale(identityTransform(), sample.scale);
+    glm::mat4 transform;
+    composeTrs(sample.position, sample.rotation, sample.scale, transform);
+    return transform;
 }
 
-double sampleTimeForClip(double time, double duration, bool loop)
-{
-    if (duration <= 0.0) {
-        return 0.0;
-    }
-    if (loop) {
-        return SkeletonAnimationSampler::wrapTime(time, duration);
-    }
-    return std::clamp(time, 0.0, duration);
-}
-
-} // namespace
-
 double SkeletonAnimationSampler::wrapTime(double time, double duration)
 {
     if (duration <= 0.0) {
@@ -150,30 +294,7 @@ void SkeletonAnimationSampler::samplePose(const Skeleton&              skeleton,
                                           bool                         loop,
                                           SkeletonPose&                outPose)
 {
-    const bool needsRebuild = outPose.sourceSkeleton != &skeleton ||
-                              outPose.localTransforms.size() != skeleton.nodes.size() ||
-                              outPose.globalTransforms.size() != skeleton.nodes.size() ||
-                              outPose.boneMatrices.size() != skeleton.bones.size();
-
-    if (needsRebuild) {
-        outPose.sourceSkeleton = &skeleton;
-        outPose.localTransforms.resize(skeleton.nodes.size());
-        outPose.globalTransforms.resize(skeleton.nodes.size());
-        outPose.boneMatrices.resize(skeleton.bones.size());
-        outPose.animatedNodeIndices.clear();
-
-        for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
-            outPose.localTransforms[nodeIndex] = skeleton.nodes[nodeIndex].localTransform;
-        }
-    }
-    else {
-        for (uint32_t nodeIndex : outPose.animatedNodeIndices) {
-            if (nodeIndex < skeleton.nodes.size()) {
-                outPose.localTransforms[nodeIndex] = skeleton.nodes[nodeIndex].localTransform;
-            }
-        }
-        outPose.animatedNodeIndices.clear();
-    }
+    preparePose(skeleton, outPose);
 
     const double animationTime = sampleTimeForClip(time, clip.duration, loop);
     outPose.animatedNodeIndices.reserve(clip.channels.size());
@@ -182,29 +303,12 @@ void SkeletonAnimationSampler::samplePose(const Skeleton&              skeleton,
             continue;
         }
 
-        const SkeletonChannelSample sample         = sampleChannel(channel, animationTime, &skeleton.nodes[channel.nodeIndex]);
-        outPose.localTransforms[channel.nodeIndex] = composeTransform(sample);
+        const SkeletonChannelSample sample = sampleChannel(channel, animationTime, &skeleton.nodes[channel.nodeIndex]);
+        composeTrs(sample.position, sample.rotation, sample.scale, outPose.localTransforms[channel.nodeIndex]);
         outPose.animatedNodeIndices.push_back(channel.nodeIndex);
     }
 
-    for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
-        const uint32_t parentIndex = skeleton.nodes[nodeIndex].parentIndex;
-        if (parentIndex == INVALID_SKELETON_NODE_INDEX || parentIndex >= outPose.globalTransforms.size()) {
-            outPose.globalTransforms[nodeIndex] = outPose.localTransforms[nodeIndex];
-        }
-        else {
-            outPose.globalTransforms[nodeIndex] = outPose.globalTransforms[parentIndex] * outPose.localTransforms[nodeIndex];
-        }
-    }
-
-    for (size_t boneIndex = 0; boneIndex < skeleton.bones.size(); ++boneIndex) {
-        const SkeletonBoneInfo& bone = skeleton.bones[boneIndex];
-        if (bone.nodeIndex >= outPose.globalTransforms.size()) {
-            outPose.boneMatrices[boneIndex] = identityTransform();
-            continue;
-        }
-        outPose.boneMatrices[boneIndex] = outPose.globalTransforms[bone.nodeIndex] * bone.offsetMatrix;
-    }
+    finishPose(skeleton, outPose);
 }
 
 SkeletonPose SkeletonAnimationSampler::samplePose(const Skeleton&              skeleton,
@@ -217,4 +321,95 @@ SkeletonPose SkeletonAnimationSampler::samplePose(const Skeleton&              s
     return pose;
 }
 
+void SkeletonAnimationSampler::sampleTracks(const CompressedSkeletonClip&       clip,
+                                            double                              time,
+                                            bool                                loop,
+                                            CompressedClipCursor&               cursor,
+                                            std::vector<SkeletonChannelSample>& outSamples)
+{
+    outSamples.resize(clip.getTrackCount());
+    forEachCompressedTrack(clip, time, loop, cursor, clip.getTrackCount(), [&](uint32_t track, const SkeletonChannelSample& sample) {
+        outSamples[track] = sample;
+    });
+}
+
+void SkeletonAnimationSampler::samplePose(const Skeleton&               skeleton,
+                                          const CompressedSkeletonClip& clip,
+                                          double                        time,
+                                          bool                          loop,
+                                          CompressedClipCursor&         cursor,
+                                          SkeletonPose&                 outPose,
+                                          uint32_t                      maxNodeDepth)
+{
+    preparePose(skeleton, outPose);
+
+    const uint32_t trackLimit = clip.getTrackCountForDepth(maxNodeDepth);
+    outPose.animatedNodeIndices.reserve(trackLimit);
+    forEachCompressedTrack(clip, time, loop, cursor, trackLimit, [&](uint32_t track, const SkeletonChannelSample& sample) {
+        const uint32_t nodeIndex = clip.trackNodes[track];
+        if (nodeIndex >= skeleton.nodes.size()) {
+            return;
+        }
+        composeTrs(sample.position, sample.rotation, sample.scale, outPose.localTransforms[nodeIndex]);
+        outPose.animatedNodeIndices.push_back(nodeIndex);
+    });
+
+    finishPose(skeleton, outPose);
+}
+
+void SkeletonAnimationSampler::makeBindLocalPose(const Skeleton& skeleton, std::vector<SkeletonChannelSample>& outLocalPose)
+{
+    outLocalPose.resize(skeleton.nodes.size());
+    for (size_t nodeIndex = 0; nodeIndex < skeleton.nodes.size(); ++nodeIndex) {
+        outLocalPose[nodeIndex] = decomposeTransform(skeleton.nodes[nodeIndex].localTransform);
+    }
+}
+
+void SkeletonAnimationSampler::sampleLocalPose(const Skeleton&                     skeleton,
+                                               const SkeletonAnimationClip&        clip,
+                                               double                              time,
+                                               bool                                loop,
+                                               std::vector<SkeletonChannelSample>& inOutLocalPose)
+{
+    const double animationTime = sampleTimeForClip(time, clip.duration, loop);
+    for (const SkeletonAnimationChannel& channel : clip.channels) {
+        if (channel.nodeIndex >= skeleton.nodes.size() || channel.nodeIndex >= inOutLocalPose.size()) {
+            continue;
+        }
+        inOutLocalPose[channel.nodeIndex] = sampleChannel(channel, animationTime, &skeleton.nodes[channel.nodeIndex]);
+    }
+}
+
+void SkeletonAnimationSampler::sampleLocalPose(const CompressedSkeletonClip&       clip,
+                                               double                              time,
+                                               bool                                loop,
+                                               CompressedClipCursor&               cursor,
+                                               std::vector<SkeletonChannelSample>& inOutLocalPose)
+{
+    forEachCompressedTrack(clip, time, loop, cursor, clip.getTrackCount(), [&](uint32_t track, const SkeletonChannelSample& sample) {
+        const uint32_t nodeIndex = clip.trackNodes[track];
+        if (nodeIndex < inOutLocalPose.size()) {
+            inOutLocalPose[nodeIndex] = sample;
+        }
+    });
+}
+
+void SkeletonAnimationSampler::composePose(const Skeleton&                           skeleton,
+                                           const std::vector<SkeletonChannelSample>& localPose,
+                                           SkeletonPose&                             outPose)
+{
+    preparePose(skeleton, outPose);
+
+    // Every node may differ from the bind pose, so all of them count as animated.
+    const size_t nodeCount = std::min(localPose.size(), skeleton.nodes.size());
+    outPose.animatedNodeIndices.resize(nodeCount);
+    for (size_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex) {
+        const SkeletonChannelSample& sample = localPose[nodeIndex];
+        composeTrs(sample.position, sample.rotation, sample.scale, outPose.localTransforms[nodeIndex]);
+        outPose.animatedNodeIndices[nodeIndex] = static_cast<uint32_t>(nodeIndex);
+    }
+
+    finishPose(skeleton, outPose);
+}
+
 } // namespace ya
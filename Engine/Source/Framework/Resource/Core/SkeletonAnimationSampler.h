@@ -1,11 +1,14 @@
 #pragma once
 
+#include "Resource/Core/CompressedAnimationClip.h"
 #include "Resource/Core/Skeleton.h"
 #include "Core/Api.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <limits>
+
 namespace ya
 {
 
@@ -37,6 +40,10 @@ struct YA_RESOURCE_CORE_API SkeletonAnimationSampler
                                      double                                   time,
                                      const glm::quat&                         fallback = glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
 
+    /// Split an affine node transform into translation, rotation and scale.
+    static SkeletonChannelSample decomposeTransform(const glm::mat4& transform);
+    static glm::mat4             composeTransform(const SkeletonChannelSample& sample);
+
     static SkeletonChannelSample sampleChannel(const SkeletonAnimationChannel& channel,
                                                double                          time,
                                                const SkeletonNodeInfo*         bindNode = nullptr);
@@ -51,6 +58,57 @@ struct YA_RESOURCE_CORE_API SkeletonAnimationSampler
                                    const SkeletonAnimationClip& clip,
                                    double                       time,
                                    bool                         loop = true);
+
+    /**
+     * @brief Sample every track of a compressed clip
+     *
+     * outSamples[t] receives the local transform of clip.trackNodes[t].
+     * @p cursor is re-targeted when it belongs to another clip; reusing one
+     * cursor per playing instance keeps forward playback search-free.
+     */
+    static void sampleTracks(const CompressedSkeletonClip&       clip,
+                             double                              time,
+                             bool                                loop,
+                             CompressedClipCursor&               cursor,
+                             std::vector<SkeletonChannelSample>& outSamples);
+
+    /**
+     * @brief Sample a compressed clip into @p outPose
+     *
+     * @p maxNodeDepth limits sampling to nodes at most that deep (the root is
+     * depth 0), for animation LOD; deeper nodes hold their bind transform.
+     */
+    static void samplePose(const Skeleton&               skeleton,
+                           const CompressedSkeletonClip& clip,
+                           double                        time,
+                           bool                          loop,
+                           CompressedClipCursor&         cursor,
+                           SkeletonPose&                 outPose,
+                           uint32_t                      maxNodeDepth = std::numeric_limits<uint32_t>::max());
+
+    // ── Local poses ───────────────────────────────────────────────────────
+    // A local pose holds one SkeletonChannelSample per skeleton node, so
+    // poses can be blended before anything is turned into matrices.
+
+    /// Decompose every node's bind transform.
+    static void makeBindLocalPose(const Skeleton& skeleton, std::vector<SkeletonChannelSample>& outLocalPose);
+
+    /// Overwrite the animated nodes of @p inOutLocalPose (sized to the skeleton, usually the bind pose).
+    static void sampleLocalPose(const Skeleton&                     skeleton,
+                                const SkeletonAnimationClip&        clip,
+                                double                              time,
+                                bool                                loop,
+                                std::vector<SkeletonChannelSample>& inOutLocalPose);
+    static void sampleLocalPose(const CompressedSkeletonClip&       clip,
+                                double                              time,
+                                bool                                loop,
+                                CompressedClipCursor&               cursor,
+                                std::vector<SkeletonChannelSample>& inOutLocalPose);
+
+    /// Build local, global and bone matrices from a local pose.
+    static void composePose(const Skeleton&                           skeleton,
+                            const std::vector<SkeletonChannelSample>& localPose,
+                            SkeletonPose&                             outPose);
 };
 
 } // namespace ya
@@ -118,7 +118,9 @@ std::vector<ya::SkeletonMeshVertex> buildSkeletonVertices(const ImportedModelDat
 }
 } // namespace
 
-EngineMeshData buildEngineMeshData(const ImportedModelData& importedModelData, size_t meshIndex)
+EngineMeshData buildEngineMeshData(const ImportedModelData&        importedModelData,
+                                   size_t                          meshIndex,
+                                   const MeshOptimizationSettings& settings)
 {
     const ImportedMeshData& importedMesh             = importedModelData.meshes[meshIndex];
     const bool              needNormalizeCoordSystem = needsCoordSystemNormalization(importedMesh.sourceCoordSystem);
@@ -130,12 +132,14 @@ EngineMeshData buildEngineMeshData(const ImportedModelData& importedModelData, s
                      coordSystemToString(ENGINE_COORDINATE_SYSTEM));
     }
 
-    return EngineMeshData{
+    EngineMeshData meshData{
         .name             = importedMesh.name,
         .vertices         = buildEngineVertices(importedMesh, needNormalizeCoordSystem),
         .skeletonVertices = buildSkeletonVertices(importedModelData, meshIndex, importedMesh.vertices.size()),
         .indices          = buildEngineIndices(importedMesh.indices, needNormalizeCoordSystem),
     };
+    mesh_optimizer::optimizeMesh(meshData, settings);
+    return meshData;
 }
 
 EngineMeshData buildEngineMeshData(std::string                         name,
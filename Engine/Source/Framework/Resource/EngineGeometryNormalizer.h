@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Resource/Core/EngineMeshData.h"
+#include "Resource/Core/Model/MeshOptimizer.h"
 
 #include <cstddef>
 #include <string>
@@ -11,7 +12,11 @@ namespace ya
 
 struct ImportedModelData;
 
-EngineMeshData buildEngineMeshData(const ImportedModelData& importedModelData, size_t meshIndex);
+/// Normalize mesh @p meshIndex to engine conventions, then run the import-time
+/// optimization passes enabled in @p settings.
+EngineMeshData buildEngineMeshData(const ImportedModelData&        importedModelData,
+                                   size_t                          meshIndex,
+                                   const MeshOptimizationSettings& settings = {});
 EngineMeshData buildEngineMeshData(std::string                         name,
                                    std::vector<ya::Vertex>             vertices,
                                    std::vector<uint32_t>               indices,
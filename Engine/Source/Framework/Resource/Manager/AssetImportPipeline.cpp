@@ -0,0 +1,406 @@
+#include "Resource/Manager/AssetImportPipeline.h"
+
+#include "Core/Async/JobSystem.h"
+#include "Core/Async/TaskQueue.h"
+#include "Core/Log.h"
+#include "Core/Profiling/Instrumentor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ya
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kWorkerStageCount = static_cast<size_t>(EAssetImportStage::Upload);
+constexpr size_t kStageCount       = static_cast<size_t>(EAssetImportStage::Count);
+
+} // namespace
+
+struct AssetImportPipeline::State : std::enable_shared_from_this<AssetImportPipeline::State>
+{
+    struct Entry
+    {
+        AssetImportItem item;
+        uint64_t        residentBytes = 0;
+        bool            bFailed       = false;
+    };
+    using EntryPtr = std::unique_ptr<Entry>;
+
+    mutable std::mutex                          mutex;
+    Config                                      config;
+    std::deque<EntryPtr>                        waiting;
+    std::array<std::deque<EntryPtr>, kStageCount> queues; // [Upload] = ready for the main thread
+    std::array<AssetImportStageMetrics, kStageCount> metrics{};
+    AssetImportProgress                         progress;
+    Clock::time_point                           busySince{};
+    bool                                        bUploadPosted = false;
+
+    uint32_t stageLimitLocked(size_t stage) const
+    {
+        switch (static_cast<EAssetImportStage>(stage)) {
+        case EAssetImportStage::Read:
+            return std::max(1u, config.readConcurrency);
+        case EAssetImportStage::Decode:
+            return config.decodeConcurrency > 0 ? config.decodeConcurrency
+                                                : std::max(1u, JobSystem::get().getConcurrency());
+        case EAssetImportStage::PostProcess:
+            return std::max(1u, config.postProcessConcurrency);
+        default:
+            return 0;
+        }
+    }
+
+    static const std::function<bool(AssetImportStageContext&)>* stageFunction(const AssetImportItem& item, size_t stage)
+    {
+        switch (static_cast<EAssetImportStage>(stage)) {
+        case EAssetImportStage::Read:
+            return &item.read;
+        case EAssetImportStage::Decode:
+            return &item.decode;
+        case EAssetImportStage::PostProcess:
+            return &item.postProcess;
+        default:
+            return nullptr;
+        }
+    }
+
+    /// First stage at or after @p stage with work to do; failed items go
+    /// straight to Upload.
+    static size_t nextStage(const Entry& entry, size_t stage)
+    {
+        if (entry.bFailed) {
+            return kWorkerStageCount;
+        }
+        while (stage < kWorkerStageCount && !*stageFunction(entry.item, stage)) {
+            ++stage;
+        }
+        return stage;
+    }
+
+    void setResidentLocked(Entry& entry, uint64_t bytes)
+    {
+        progress.inFlightBytes     = progress.inFlightBytes - entry.residentBytes + bytes;
+        progress.peakInFlightBytes = std::max(progress.peakInFlightBytes, progress.inFlightBytes);
+        entry.residentBytes        = bytes;
+    }
+
+    void enqueueLocked(EntryPtr entry, size_t stage)
+    {
+        auto& metric       = metrics[stage];
+        metric.queuedItems = static_cast<uint32_t>(queues[stage].size() + 1);
+        queues[stage].push_back(std::move(entry));
+    }
+
+    void admitLocked()
+    {
+        while (!waiting.empty()) {
+            const uint64_t estimate = waiting.front()->item.estimatedBytes;
+            const bool     bIdle    = progress.inFlightBytes == 0;
+            if (!bIdle && progress.inFlightBytes + estimate > config.memoryBudgetBytes) {
+                break;
+            }
+            EntryPtr entry = std::move(waiting.front());
+            waiting.pop_front();
+            setResidentLocked(*entry, estimate);
+            const size_t stage = nextStage(*entry, 0);
+            enqueueLocked(std::move(entry), stage);
+        }
+        progress.waitingItems = waiting.size();
+    }
+
+    /// Collect worker launches; the caller schedules them after unlocking.
+    void dispatchLocked(std::vector<std::pair<Entry*, size_t>>& launches)
+    {
+        admitLocked();
+        for (size_t stage = kWorkerStageCount; stage-- > 0;) {
+            auto&          queue  = queues[stage];
+            auto&          metric = metrics[stage];
+            const uint32_t limit  = stageLimitLocked(stage);
+            while (!queue.empty() && metric.activeItems < limit) {
+                launches.emplace_back(queue.front().release(), stage);
+                queue.pop_front();
+                ++metric.activeItems;
+                metric.peakActiveItems = std::max(metric.peakActiveItems, metric.activeItems);
+            }
+            metric.queuedItems = static_cast<uint32_t>(queue.size());
+        }
+    }
+
+    bool takeUploadPostLocked()
+    {
+        if (queues[kWorkerStageCount].empty() || bUploadPosted) {
+            return false;
+        }
+        bUploadPosted = true;
+        return true;
+    }
+
+    void launch(std::vector<std::pair<Entry*, size_t>>& launches, bool bPostUpload)
+    {
+        for (auto [entry, stage] : launches) {
+            JobSystem::get().scheduleBackground([self = shared_from_this(), entry, stage]() {
+                self->runStage(EntryPtr(entry), stage);
+            });
+        }
+        launches.clear();
+
+        if (bPostUpload) {
+            postUploadPump();
+        }
+    }
+
+    void postUploadPump()
+    {
+        TaskQueue::get().postToMainThread([weak = weak_from_this()]() {
+            if (auto self = weak.lock()) {
+                self->pumpUploads(false);
+            }
+        });
+    }
+
+    void runStage(EntryPtr entry, size_t stage)
+    {
+        YA_PROFILE_SCOPE("AssetImport/Stage");
+        AssetImportStageContext context{.residentBytes = entry->residentBytes};
+
+        const auto begin = Clock::now();
+        bool       bOk   = false;
+        try {
+            bOk = (*stageFunction(entry->item, stage))(context);
+        }
+        catch (const std::exception& e) {
+            YA_CORE_WARN("AssetImportPipeline: stage {} threw for '{}': {}", stage, entry->item.label, e.what());
+        }
+        catch (...) {
+            YA_CORE_WARN("AssetImportPipeline: stage {} threw for '{}'", stage, entry->item.label);
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+        std::vector<std::pair<Entry*, size_t>> launches;
+        bool                                   bPostUpload = false;
+        {
+            std::lock_guard lock(mutex);
+            auto&           metric = metrics[stage];
+            --metric.activeItems;
+            metric.busySeconds += seconds;
+            metric.processedBytes += context.processedBytes;
+            ++(bOk ? metric.completedItems : metric.failedItems);
+
+            setResidentLocked(*entry, context.residentBytes);
+            entry->bFailed = !bOk;
+            const size_t next = nextStage(*entry, stage + 1);
+            enqueueLocked(std::move(entry), next);
+
+            dispatchLocked(launches);
+            bPostUpload = takeUploadPostLocked();
+        }
+        launch(launches, bPostUpload);
+    }
+
+    /// Run ready uploads on the calling (main) thread. Unless @p bUnbounded,
+    /// stops once the per-frame upload budget is spent and re-posts itself,
+    /// which TaskQueue runs on the next frame.
+    uint32_t pumpUploads(bool bUnbounded)
+    {
+        uint32_t uploaded      = 0;
+        uint64_t uploadedBytes = 0;
+        for (;;) {
+            EntryPtr entry;
+            {
+                std::lock_guard lock(mutex);
+                auto&           queue = queues[kWorkerStageCount];
+                if (queue.empty()) {
+                    bUploadPosted = false;
+                    break;
+                }
+                const uint64_t budget = config.uploadBudgetBytesPerFrame;
+                if (!bUnbounded && budget > 0 && uploaded > 0 && uploadedBytes + queue.front()->residentBytes > budget) {
+                    ++progress.deferredUploadFrames;
+                    bUploadPosted = true;
+                    postUploadPump();
+                    break;
+                }
+                entry = std::move(queue.front());
+                queue.pop_front();
+                metrics[kWorkerStageCount].queuedItems = static_cast<uint32_t>(queue.size());
+            }
+
+            uploadedBytes += entry->residentBytes;
+            const auto begin = Clock::now();
+            if (entry->item.upload) {
+                entry->item.upload(!entry->bFailed);
+            }
+            const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+            std::vector<std::pair<Entry*, size_t>> launches;
+            {
+                std::lock_guard lock(mutex);
+                auto&           metric = metrics[kWorkerStageCount];
+                metric.busySeconds += seconds;
+                metric.processedBytes += entry->residentBytes;
+                ++(entry->bFailed ? metric.failedItems : metric.completedItems);
+                ++(entry->bFailed ? progress.failedItems : progress.completedItems);
+                setResidentLocked(*entry, 0);
+                dispatchLocked(launches);
+            }
+            launch(launches, false);
+            ++uploaded;
+        }
+        return uploaded;
+    }
+};
+
+AssetImportPipeline::AssetImportPipeline()
+    : AssetImportPipeline(Config{})
+{
+}
+
+AssetImportPipeline::AssetImportPipeline(Config config)
+    : _state(std::make_shared<State>())
+{
+    _state->config = config;
+}
+
+AssetImportPipeline::~AssetImportPipeline()
+{
+    cancelWaiting();
+    // Worker jobs hold the state alive; wait for them so their captures
+    // (owned by managers that die with us) are not touched afterwards.
+    auto& jobSystem = JobSystem::get();
+    for (;;) {
+        {
+            std::lock_guard lock(_state->mutex);
+            bool            bActive = false;
+            for (size_t stage = 0; stage < kWorkerStageCount; ++stage) {
+                bActive |= _state->metrics[stage].activeItems > 0 || !_state->queues[stage].empty();
+            }
+            if (!bActive) {
+                _state->queues[kWorkerStageCount].clear();
+                break;
+            }
+        }
+        if (!jobSystem.tryExecuteOne(true)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void AssetImportPipeline::submit(AssetImportItem item)
+{
+    std::vector<AssetImportItem> items;
+    items.push_back(std::move(item));
+    submitBatch(std::move(items));
+}
+
+void AssetImportPipeline::submitBatch(std::vector<AssetImportItem> items)
+{
+    if (items.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<State::Entry*, size_t>> launches;
+    bool                                          bPostUpload = false;
+    {
+        std::lock_guard lock(_state->mutex);
+        if (_state->progress.isIdle()) {
+            _state->busySince = Clock::now();
+        }
+        for (auto& item : items) {
+            auto entry  = std::make_unique<State::Entry>();
+            entry->item = std::move(item);
+            _state->waiting.push_back(std::move(entry));
+        }
+        _state->progress.submittedItems += items.size();
+        _state->dispatchLocked(launches);
+        bPostUpload = _state->takeUploadPostLocked();
+    }
+    _state->launch(launches, bPostUpload);
+}
+
+void AssetImportPipeline::cancelWaiting()
+{
+    std::deque<State::EntryPtr> cancelled;
+    {
+        std::lock_guard lock(_state->mutex);
+        cancelled.swap(_state->waiting);
+        _state->progress.failedItems += cancelled.size();
+        _state->progress.waitingItems = 0;
+    }
+    for (auto& entry : cancelled) {
+        if (entry->item.upload) {
+            entry->item.upload(false);
+        }
+    }
+}
+
+void AssetImportPipeline::flush()
+{
+    auto& jobSystem = JobSystem::get();
+    for (;;) {
+        _state->pumpUploads(true);
+        if (getProgress().isIdle()) {
+            break;
+        }
+        if (!jobSystem.tryExecuteOne(true)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void AssetImportPipeline::setConfig(const Config& config)
+{
+    std::vector<std::pair<State::Entry*, size_t>> launches;
+    {
+        std::lock_guard lock(_state->mutex);
+        _state->config = config;
+        // A larger budget or more lanes may unblock queued work right away.
+        _state->dispatchLocked(launches);
+    }
+    _state->launch(launches, false);
+}
+
+AssetImportPipeline::Config AssetImportPipeline::getConfig() const
+{
+    std::lock_guard lock(_state->mutex);
+    return _state->config;
+}
+
+AssetImportProgress AssetImportPipeline::getProgress() const
+{
+    std::lock_guard     lock(_state->mutex);
+    AssetImportProgress progress = _state->progress;
+    progress.budgetBytes         = _state->config.memoryBudgetBytes;
+    progress.elapsedSeconds      = progress.isIdle() ? 0.0
+                                                     : std::chrono::duration<double>(Clock::now() - _state->busySince).count();
+    return progress;
+}
+
+AssetImportStageMetrics AssetImportPipeline::getStageMetrics(EAssetImportStage stage) const
+{
+    YA_CORE_ASSERT(stage != EAssetImportStage::Count, "Invalid import stage");
+    std::lock_guard lock(_state->mutex);
+    return _state->metrics[static_cast<size_t>(stage)];
+}
+
+void AssetImportPipeline::resetMetrics()
+{
+    std::lock_guard lock(_state->mutex);
+    for (auto& metric : _state->metrics) {
+        metric.completedItems  = 0;
+        metric.failedItems     = 0;
+        metric.processedBytes  = 0;
+        metric.busySeconds     = 0.0;
+        metric.peakActiveItems = metric.activeItems;
+    }
+    _state->progress.peakInFlightBytes = _state->progress.inFlightBytes;
+}
+
+} // namespace ya
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Core/Base.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ya
+{
+
+enum class EAssetImportStage : uint8_t
+{
+    Read,        // File IO (worker)
+    Decode,      // Format decode / transcode (worker)
+    PostProcess, // Derived-data store, validation (worker)
+    Upload,      // GPU object creation / hand-off (main thread)
+    Count,
+};
+
+/// Per-stage in/out values for one item.
+struct AssetImportStageContext
+{
+    /// In: bytes the item currently holds. Out: bytes it holds after the stage
+    /// (e.g. source bytes released, decoded pixels added). This is what is
+    /// charged against the pipeline memory budget.
+    uint64_t residentBytes = 0;
+    /// Out: bytes produced or consumed by the stage, for throughput metrics.
+    uint64_t processedBytes = 0;
+};
+
+/**
+ * @brief One asset moving through the import pipeline
+ *
+ * Stage state lives in the callables' captures (typically a shared_ptr to a
+ * per-asset struct). Worker stages are optional; a stage returning false
+ * skips the remaining worker stages. `upload` always runs on the main thread
+ * and receives whether every worker stage succeeded.
+ */
+struct AssetImportItem
+{
+    std::string label;
+    /// Budget charge reserved at admission, before any stage has run.
+    uint64_t    estimatedBytes = 0;
+
+    std::function<bool(AssetImportStageContext&)> read;
+    std::function<bool(AssetImportStageContext&)> decode;
+    std::function<bool(AssetImportStageContext&)> postProcess;
+    std::function<void(bool bSucceeded)>          upload;
+};
+
+struct AssetImportStageMetrics
+{
+    uint64_t completedItems  = 0;
+    uint64_t failedItems     = 0;
+    uint64_t processedBytes  = 0;
+    double   busySeconds     = 0.0; // Summed over all lanes
+    uint32_t queuedItems     = 0;
+    uint32_t activeItems     = 0;
+    uint32_t peakActiveItems = 0;
+
+    /// Per-lane throughput: what one worker achieves in this stage.
+    [[nodiscard]] double itemsPerSecond() const { return busySeconds > 0.0 ? completedItems / busySeconds : 0.0; }
+    [[nodiscard]] double megabytesPerSecond() const
+    {
+        return busySeconds > 0.0 ? (processedBytes / (1024.0 * 1024.0)) / busySeconds : 0.0;
+    }
+};
+
+struct AssetImportProgress
+{
+    uint64_t submittedItems       = 0;
+    uint64_t completedItems       = 0;
+    uint64_t failedItems          = 0;
+    uint64_t waitingItems         = 0; // Not admitted yet (budget back-pressure)
+    uint64_t inFlightBytes        = 0;
+    uint64_t peakInFlightBytes    = 0;
+    uint64_t budgetBytes          = 0;
+    uint64_t deferredUploadFrames = 0; // Upload pumps cut short by the per-frame budget
+    double   elapsedSeconds       = 0.0; // Since the pipeline last went from idle to busy
+
+    [[nodiscard]] uint64_t finishedItems() const { return completedItems + failedItems; }
+    [[nodiscard]] bool     isIdle() const { return finishedItems() == submittedItems; }
+    [[nodiscard]] float    fraction() const
+    {
+        return submittedItems == 0 ? 1.0f : static_cast<float>(finishedItems()) / static_cast<float>(submittedItems);
+    }
+};
+
+/**
+ * @brief Staged, memory-bounded asset import
+ *
+ * Items flow Read → Decode → PostProcess on JobSystem workers, each stage
+ * with its own concurrency limit, then Upload on the main thread (posted
+ * through TaskQueue::processMainThreadCallbacks). An item is admitted only
+ * while the bytes held by in-flight items plus its estimate fit the memory
+ * budget, so a 2,000-texture level streams through a bounded window instead
+ * of decoding everything at once. One item is always admitted when nothing
+ * is in flight, so an oversized asset cannot stall the pipeline.
+ *
+ * Downstream stages are dispatched first: finishing items frees budget
+ * sooner than starting new ones. Uploads are paced by a per-frame byte
+ * budget; GPU copies they issue are batched by the render's GpuUploadQueue.
+ */
+class YA_RESOURCE_API AssetImportPipeline
+{
+  public:
+    struct Config
+    {
+        uint64_t memoryBudgetBytes         = 1ull << 30;
+        uint32_t readConcurrency           = 4; // IO-bound, small
+        uint32_t decodeConcurrency         = 0; // 0 = JobSystem concurrency
+        uint32_t postProcessConcurrency    = 2;
+        /// Bytes (as held by the items) handed to upload per frame; the rest
+        /// waits for the next frame so a burst of finished imports does not
+        /// hitch one frame. 0 = unlimited. At least one item runs per frame.
+        uint64_t uploadBudgetBytesPerFrame = 64ull << 20;
+    };
+
+    AssetImportPipeline();
+    explicit AssetImportPipeline(Config config);
+    ~AssetImportPipeline();
+
+    AssetImportPipeline(const AssetImportPipeline&)            = delete;
+    AssetImportPipeline& operator=(const AssetImportPipeline&) = delete;
+
+    void submit(AssetImportItem item);
+    void submitBatch(std::vector<AssetImportItem> items);
+
+    /// Drop items that were not admitted yet; their upload runs with false.
+    void cancelWaiting();
+
+    /// Block until every submitted item finished, helping JobSystem and
+    /// running uploads on the calling thread. Main thread only.
+    void flush();
+
+    void   setConfig(const Config& config);
+    Config getConfig() const;
+
+    [[nodiscard]] AssetImportProgress     getProgress() const;
+    [[nodiscard]] AssetImportStageMetrics getStageMetrics(EAssetImportStage stage) const;
+    void                                  resetMetrics();
+
+  private:
+    struct State;
+    std::shared_ptr<State> _state;
+};
+
+} // namespace ya
@@ -2,13 +2,33 @@
 
 
 #include "Core/Log.h"
-#include "Resource/Core/Model/ImportedModelData.h"
+#include "Resource/Core/Model/ModelImporterCommon.h"
+#include "Resource/Manager/AssetImportPipeline.h"
+#include "Resource/ModelCookCache.h"
 
 #include "Core/Common/DeferredDeletionQueue.h"
 
+#include <filesystem>
+
 namespace ya
 {
 
+namespace
+{
+
+/// Importers hold the parsed scene plus normalized meshes; a few times the
+/// source size is a fair upper bound for budgeting.
+constexpr uint64_t kModelImportExpansion = 4;
+
+uint64_t estimateModelImportBytes(const std::string& filepath)
+{
+    std::error_code ec;
+    const auto      fileSize = std::filesystem::file_size(model_importer::detail::resolveImportedIoPath(filepath), ec);
+    return ec ? 0 : static_cast<uint64_t>(fileSize) * kModelImportExpansion;
+}
+
+} // namespace
+
 AssetModelManager::AssetModelManager(AssetManager& owner)
     : _owner(owner)
 {
@@ -130,100 +150,120 @@ void AssetModelManager::submitModelLoad(const std::string& filepath, const std::
 {
     YA_CORE_INFO("submitModelLoad: async decode '{}'", filepath);
 
-    auto handle = TaskQueue::get().submitWithCallback(
-        [filepath]() -> ImportedModelData
-        {
-            return ImportedModelData::decode(filepath);
-        },
-        [this, filepath, name](ImportedModelData decoded)
-        {
-            std::vector<AssetManager::ModelReadyCallback> callbacks;
-            std::shared_ptr<Model>                        readyModel;
-
-            {
-                std::lock_guard lock(_mutex);
-                auto            existing = modelCache.find(filepath);
-                if (existing != modelCache.end()) {
-                    _pendingModelLoads.erase(filepath);
-                    callbacks  = takeModelCallbacks(filepath);
-                    readyModel = existing->second;
-                }
-            }
+    const uint64_t clearGeneration = [&]() {
+        std::lock_guard lock(_mutex);
+        _pendingModelLoads.insert(filepath);
+        return _clearGeneration;
+    }();
+
+    // Import is one coarse decode stage (the importer owns its own IO); the
+    // pipeline still budgets it against textures in flight.
+    auto decodedResult = std::make_shared<ModelDecodeResult>();
+    // The meta cache is main-thread only: resolve the settings before decode.
+    const auto meshSettings = MeshOptimizationSettings::fromMeta(_owner.getOrLoadMeta(filepath));
+
+    AssetImportItem item;
+    item.label          = filepath;
+    item.estimatedBytes = estimateModelImportBytes(filepath);
+    item.decode         = [filepath, decodedResult, meshSettings](AssetImportStageContext& context)
+    {
+        *decodedResult = model_cook::decodeForLoad(filepath, meshSettings);
+        if (decodedResult->cooked) {
+            context.residentBytes  = decodedResult->cooked->getMappedSize();
+            context.processedBytes = decodedResult->cooked->getMappedSize();
+        }
+        return decodedResult->isValid();
+    };
+    item.upload = [this, filepath, name, clearGeneration, decodedResult](bool)
+    {
+        ModelDecodeResult decoded = std::move(*decodedResult);
+        std::vector<AssetManager::ModelReadyCallback> callbacks;
+        std::shared_ptr<Model>                        readyModel;
 
-            if (readyModel) {
-                dispatchModelCallbacks(callbacks, readyModel);
+        {
+            std::lock_guard lock(_mutex);
+            if (clearGeneration != _clearGeneration) {
                 return;
             }
-
-            if (!decoded.isValid()) {
-                YA_CORE_WARN("Async model decode failed for '{}'", filepath);
-                {
-                    std::lock_guard lock(_mutex);
-                    _pendingModelLoads.erase(filepath);
-                    _failedModelLoads.insert(filepath);
-                    callbacks = takeModelCallbacks(filepath);
-                }
-                dispatchModelCallbacks(callbacks, nullptr);
-                return;
+            auto            existing = modelCache.find(filepath);
+            if (existing != modelCache.end()) {
+                _pendingModelLoads.erase(filepath);
+                callbacks  = takeModelCallbacks(filepath);
+                readyModel = existing->second;
             }
+        }
 
-            auto* render = _owner.getRender();
-            if (!render) {
-                YA_CORE_WARN("Async GPU mesh creation skipped for '{}' because render is unavailable", filepath);
-                {
-                    std::lock_guard lock(_mutex);
-                    _pendingModelLoads.erase(filepath);
-                    _failedModelLoads.insert(filepath);
-                    callbacks = takeModelCallbacks(filepath);
-                }
-                dispatchModelCallbacks(callbacks, nullptr);
-                return;
+        if (readyModel) {
+            dispatchModelCallbacks(callbacks, readyModel);
+            return;
+        }
+
+        if (!decoded.isValid()) {
+            YA_CORE_WARN("Async model decode failed for '{}'", filepath);
+            {
+                std::lock_guard lock(_mutex);
+                _pendingModelLoads.erase(filepath);
+                _failedModelLoads.insert(filepath);
+                callbacks = takeModelCallbacks(filepath);
             }
+            dispatchModelCallbacks(callbacks, nullptr);
+            return;
+        }
 
-            auto model = decoded.createModel(*render);
-            if (!model) {
-                YA_CORE_WARN("Async GPU mesh creation failed for '{}'", filepath);
-                {
-                    std::lock_guard lock(_mutex);
-                    _pendingModelLoads.erase(filepath);
-                    _failedModelLoads.insert(filepath);
-                    callbacks = takeModelCallbacks(filepath);
-                }
-                dispatchModelCallbacks(callbacks, nullptr);
-                return;
+        auto* render = _owner.getRender();
+        if (!render) {
+            YA_CORE_WARN("Async GPU mesh creation skipped for '{}' because render is unavailable", filepath);
+            {
+                std::lock_guard lock(_mutex);
+                _pendingModelLoads.erase(filepath);
+                _failedModelLoads.insert(filepath);
+                callbacks = takeModelCallbacks(filepath);
             }
+            dispatchModelCallbacks(callbacks, nullptr);
+            return;
+        }
 
+        auto model = decoded.createModel(*render);
+        if (!model) {
+            YA_CORE_WARN("Async GPU mesh creation failed for '{}'", filepath);
             {
                 std::lock_guard lock(_mutex);
-                modelCache[filepath] = model;
-                if (!name.empty()) {
-                    _modalName2Path[name] = filepath;
-                }
-                _failedModelLoads.erase(filepath);
                 _pendingModelLoads.erase(filepath);
+                _failedModelLoads.insert(filepath);
                 callbacks = takeModelCallbacks(filepath);
             }
+            dispatchModelCallbacks(callbacks, nullptr);
+            return;
+        }
 
-            dispatchModelCallbacks(callbacks, model);
+        {
+            std::lock_guard lock(_mutex);
+            modelCache[filepath] = model;
+            if (!name.empty()) {
+                _modalName2Path[name] = filepath;
+            }
+            _failedModelLoads.erase(filepath);
+            _pendingModelLoads.erase(filepath);
+            callbacks = takeModelCallbacks(filepath);
+        }
 
-            YA_CORE_INFO("Async model ready: '{}' ({} meshes, {} materials, {} bones)",
-                         filepath,
-                         model->meshes.size(),
-                         model->embeddedMaterials.size(),
-                         model->getSkeleton() ? model->getSkeleton()->bones.size() : 0);
-        });
+        dispatchModelCallbacks(callbacks, model);
 
-    std::lock_guard lock(_mutex);
-    _pendingModelLoads[filepath] = std::move(handle);
+        YA_CORE_INFO("Async model ready: '{}' ({} meshes, {} materials, {} bones)",
+                     filepath,
+                     model->meshes.size(),
+                     model->embeddedMaterials.size(),
+                     model->getSkeleton() ? model->getSkeleton()->bones.size() : 0);
+    };
+
+    _owner.importPipeline().submit(std::move(item));
 }
 
 bool AssetModelManager::isModelLoadPending(const std::string& filepath) const
 {
     const auto normalizedFilepath = AssetManager::normalizeAssetPath(filepath);
     std::lock_guard lock(_mutex);
-    auto            it = _pendingModelLoads.find(normalizedFilepath);
-    if (it == _pendingModelLoads.end()) return false;
-    return !it->second.isReady();
+    return _pendingModelLoads.contains(normalizedFilepath);
 }
 
 bool AssetModelManager::isModelLoaded(const std::string& filepath) const
@@ -250,7 +290,7 @@ std::shared_ptr<Model> AssetModelManager::loadModelImpl(const std::string& filep
         return modelCache[normalizedFilepath];
     }
 
-    auto decoded = ImportedModelData::decode(normalizedFilepath);
+    auto decoded = model_cook::decodeForLoad(normalizedFilepath, MeshOptimizationSettings::fromMeta(_owner.getOrLoadMeta(normalizedFilepath)));
     if (!decoded.isValid()) {
         YA_CORE_ERROR("loadModelImpl: Failed to decode model: {}", normalizedFilepath);
         std::lock_guard lock(_mutex);
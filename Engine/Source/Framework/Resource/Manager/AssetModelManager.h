@@ -3,9 +3,9 @@
 #include "Core/Base.h"
 
 #include <mutex>
+#include <unordered_set>
 
-#include "Core/Async/TaskQueue.h"
-#include "Resource/Core/Model/ImportedModelData.h"
+#include "Resource/ModelCookCache.h"
 #include "Resource/AssetManager.h"
 
 namespace ya
@@ -18,7 +18,7 @@ class AssetModelManager
 
     std::unordered_map<std::string, std::shared_ptr<Model>>                        modelCache;
     std::unordered_map<std::string, std::string>                                   _modalName2Path;
-    std::unordered_map<std::string, TaskHandle<ImportedModelData>>                 _pendingModelLoads;
+    std::unordered_set<std::string>                                                _pendingModelLoads; // Queued in the import pipeline
     std::unordered_map<std::string, std::vector<AssetManager::ModelReadyCallback>> _pendingModelCallbacks;
     std::unordered_set<std::string>                                                _failedModelLoads;
     uint64_t                                                                       _clearGeneration = 0;
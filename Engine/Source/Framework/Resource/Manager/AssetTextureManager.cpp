@@ -1,5 +1,6 @@
 #include "Resource/Manager/AssetTextureManager.h"
 
+#include "Resource/Manager/AssetImportPipeline.h"
 #include "Resource/Texture/AssetTextureInternal.h"
 
 #include "Core/Log.h"
@@ -12,6 +13,39 @@ namespace ya
 {
 using namespace asset_manager_texture_detail;
 
+namespace
+{
+
+/// Import-pipeline item running the staged texture decode. The decoded block
+/// stays in @p work; @p upload consumes it on the main thread.
+AssetImportItem makeTextureImportItem(const std::shared_ptr<TextureDecodeWork>& work,
+                                      std::function<void(bool)>                 upload)
+{
+    AssetImportItem item;
+    item.label          = work->settings.requestedFilepath;
+    item.estimatedBytes = estimateTextureDecodeBytes(work->settings);
+    item.read           = [work](AssetImportStageContext& context) {
+        const bool bOk         = readTextureSource(*work);
+        context.processedBytes = work->bFromCache ? work->result.dataSize() : work->sourceBytes.size();
+        return bOk;
+    };
+    item.decode = [work](AssetImportStageContext& context) {
+        const bool bOk         = decodeTextureSource(*work);
+        context.residentBytes  = work->result.dataSize();
+        context.processedBytes = work->result.dataSize();
+        return bOk;
+    };
+    item.postProcess = [work](AssetImportStageContext& context) {
+        storeDecodedTexture(*work);
+        context.processedBytes = work->result.dataSize();
+        return true;
+    };
+    item.upload = std::move(upload);
+    return item;
+}
+
+} // namespace
+
 AssetTextureManager::AssetTextureManager(AssetManager& owner)
     : _owner(owner)
 {
@@ -235,34 +269,44 @@ AssetManager::TextureBatchMemoryHandle AssetTextureManager::loadTextureBatchInto
         return handleId;
     }
 
-    auto handle = TaskQueue::get().submitWithCallback(
-        [settingsList = std::move(settingsList)]() -> AssetManager::TextureBatchMemory
-        {
-            AssetManager::TextureBatchMemory batchMemory;
-            batchMemory.textures.reserve(settingsList.size());
-
-            for (const auto& settings : settingsList) {
-                auto decoded = decodeTextureToMemory(settings);
-                batchMemory.textures.push_back(std::move(decoded));
-            }
+    struct BatchState
+    {
+        AssetManager::TextureBatchMemory batchMemory;
+        uint32_t                         remaining = 0; // Touched by uploads only (main thread)
+    };
 
-            return batchMemory;
-        },
-        [this, handleId, clearGeneration](AssetManager::TextureBatchMemory batchMemory)
-        {
-            std::lock_guard lock(_mutex);
-            _pendingTextureBatchMemoryLoads.erase(handleId);
-            if (clearGeneration != _clearGeneration) {
-                return;
-            }
-            _readyTextureBatchMemory[handleId] = std::move(batchMemory);
-        });
+    auto batchState = std::make_shared<BatchState>();
+    batchState->batchMemory.textures.resize(settingsList.size());
+    batchState->remaining = static_cast<uint32_t>(settingsList.size());
 
     {
         std::lock_guard lock(_mutex);
-        _pendingTextureBatchMemoryLoads[handleId] = std::move(handle);
+        _pendingTextureBatchMemoryLoads.insert(handleId);
     }
 
+    std::vector<AssetImportItem> items;
+    items.reserve(settingsList.size());
+    for (size_t index = 0; index < settingsList.size(); ++index) {
+        auto work = std::make_shared<TextureDecodeWork>(TextureDecodeWork{.settings = std::move(settingsList[index])});
+        items.push_back(makeTextureImportItem(
+            work,
+            [this, handleId, clearGeneration, batchState, work, index](bool)
+            {
+                batchState->batchMemory.textures[index] = std::move(work->result);
+                if (--batchState->remaining > 0) {
+                    return;
+                }
+
+                std::lock_guard lock(_mutex);
+                _pendingTextureBatchMemoryLoads.erase(handleId);
+                if (clearGeneration != _clearGeneration) {
+                    return;
+                }
+                _readyTextureBatchMemory[handleId] = std::move(batchState->batchMemory);
+            }));
+    }
+    _owner.importPipeline().submitBatch(std::move(items));
+
     return handleId;
 }
 
@@ -373,16 +417,16 @@ void AssetTextureManager::submitTextureLoad(const std::string&
 
     const uint64_t clearGeneration = [&]() {
         std::lock_guard lock(_mutex);
+        _pendingTextureLoads.insert(cacheKey);
         return _clearGeneration;
     }();
 
-    auto handle = TaskQueue::get().submitWithCallback(
-        [settings]() -> AssetManager::TextureMemoryBlock
-        {
-            return decodeTextureToMemory(settings);
-        },
-        [this, filepath, cacheKey, name, clearGeneration](AssetManager::TextureMemoryBlock decoded)
+    auto work = std::make_shared<TextureDecodeWork>(TextureDecodeWork{.settings = std::move(settings)});
+    _owner.importPipeline().submit(makeTextureImportItem(
+        work,
+        [this, filepath, cacheKey, name, clearGeneration, work](bool)
         {
+            auto decoded = std::move(work->result);
             std::vector<AssetManager::TextureReadyCallback> callbacks;
             std::shared_ptr<Texture>                        readyTexture;
 
@@ -467,10 +511,7 @@ void AssetTextureManager::submitTextureLoad(const std::string&
             dispatchTextureCallbacks(callbacks, texture);
 
             YA_CORE_TRACE("Async texture ready: '{}' ({}x{})", filepath, texture->getWidth(), texture->getHeight());
-        });
-
-    std::lock_guard lock(_mutex);
-    _pendingTextureLoads[cacheKey] = std::move(handle);
+        }));
 }
 
 std::shared_ptr<Texture> AssetTextureManager::getTextureByPath(const std::string& filepath) const
@@ -532,8 +573,7 @@ void AssetTextureManager::registerTexture(const std::string& name, const stdptr<
 bool AssetTextureManager::isTextureLoadPending(const std::string& cacheKey) const
 {
     std::lock_guard lock(_mutex);
-    auto            it = _pendingTextureLoads.find(cacheKey);
-    return it != _pendingTextureLoads.end() && !it->second.isReady();
+    return _pendingTextureLoads.contains(cacheKey);
 }
 
 bool AssetTextureManager::isTextureLoadFailed(const std::string& filepath) const
@@ -2,11 +2,10 @@
 
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
-#include "Core/Async/TaskQueue.h"
 #include "Resource/AssetManager.h"
 #include "Resource/Core/Handle/ResourceTable.h"
-#include "Resource/Core/Handle/ResourceTable.h"
 
 namespace ya
 {
@@ -21,11 +20,10 @@ class AssetTextureManager
     ResourceTable<Texture>                                    _textures;
     std::unordered_map<std::string, FResourceHandle<Texture>> _cacheKey2Handle;
     std::unordered_map<FName, std::string>                    _textureName2Path;
-    std::unordered_map<std::string, TaskHandle<AssetManager::TextureMemoryBlock>> _pendingTextureLoads;
+    std::unordered_set<std::string>              _pendingTextureLoads; // cacheKeys queued in the import pipeline
     std::unordered_map<std::string, std::string> _failedTextureLoads;
     std::unordered_map<std::string, std::vector<AssetManager::TextureReadyCallback>> _pendingTextureCallbacks;
-    std::unordered_map<AssetManager::TextureBatchMemoryHandle, TaskHandle<AssetManager::TextureBatchMemory>>
-        _pendingTextureBatchMemoryLoads;
+    std::unordered_set<AssetManager::TextureBatchMemoryHandle> _pendingTextureBatchMemoryLoads;
     std::unordered_map<AssetManager::TextureBatchMemoryHandle, AssetManager::TextureBatchMemory>
         _readyTextureBatchMemory;
     AssetManager::TextureBatchMemoryHandle _nextTextureBatchMemoryHandle = 1;
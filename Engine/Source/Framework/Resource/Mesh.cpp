@@ -7,12 +7,17 @@ namespace ya
 
 stdptr<Mesh> Mesh::create(IRender& render, const EngineMeshData& meshData)
 {
-    return makeShared<Mesh>(Mesh(render, meshData));
+    return makeShared<Mesh>(Mesh(render, EngineMeshView(meshData)));
 }
 
-Mesh::Mesh(IRender& render, const EngineMeshData& meshData)
+stdptr<Mesh> Mesh::create(IRender& render, const EngineMeshView& meshView)
 {
-    _name = meshData.name;
+    return makeShared<Mesh>(Mesh(render, meshView));
+}
+
+Mesh::Mesh(IRender& render, const EngineMeshView& meshData)
+{
+    _name = std::string(meshData.name);
     auto* resourceFactory = render.getResourceFactory();
     YA_CORE_ASSERT(resourceFactory, "Mesh requires a render resource factory");
 
@@ -20,7 +25,14 @@ Mesh::Mesh(IRender& render, const EngineMeshData& meshData)
                           { boundingBox.expand(v.position); });
 
     _vertexCount = static_cast<uint32_t>(meshData.vertices.size());
-    _indexCount  = static_cast<uint32_t>(meshData.indices.size());
+    if (meshData.lods.empty()) {
+        _lods.push_back(MeshLod{.firstIndex = 0, .indexCount = static_cast<uint32_t>(meshData.indices.size())});
+    }
+    else {
+        _lods.assign(meshData.lods.begin(), meshData.lods.end());
+    }
+    _indexCount = _lods[0].indexCount;
+    _meshlets.assign(meshData.meshlets.begin(), meshData.meshlets.end());
 
     _vertexBuffer = resourceFactory->createBuffer(
         {
@@ -29,13 +29,20 @@ struct YA_RESOURCE_API Mesh
     std::vector<stdptr<IBuffer>> _optVertexBuffers;
     std::vector<uint32_t>        _optVertexBufferOffsets;
 
-    uint32_t _indexCount  = 0;
+    uint32_t _indexCount  = 0; // LOD 0
     uint32_t _vertexCount = 0;
 
+    /// Index ranges per LOD; always holds at least LOD 0.
+    std::vector<MeshLod> _lods;
+    /// LOD 0 cluster bounds; each cluster is a contiguous LOD 0 index range.
+    std::vector<Meshlet> _meshlets;
+
     AABB boundingBox;
 
   public:
     static stdptr<Mesh> create(IRender& render, const EngineMeshData& meshData);
+    /// Upload straight from borrowed memory (e.g. a mapped cooked model).
+    static stdptr<Mesh> create(IRender& render, const EngineMeshView& meshView);
 
     ~Mesh() = default;
 
@@ -43,6 +50,12 @@ struct YA_RESOURCE_API Mesh
     [[nodiscard]] uint32_t getVertexCount() const { return _vertexCount; }
     [[nodiscard]] bool     hasSkinningVertexBuffer() const { return !_optVertexBuffers.empty(); }
 
+    [[nodiscard]] uint32_t                 getLodCount() const { return static_cast<uint32_t>(_lods.size()); }
+    [[nodiscard]] std::span<const MeshLod> getLods() const { return _lods; }
+    /// @p lod clamped to the coarsest available level.
+    [[nodiscard]] const MeshLod& getLod(uint32_t lod) const { return _lods[std::min<size_t>(lod, _lods.size() - 1)]; }
+    [[nodiscard]] std::span<const Meshlet> getMeshlets() const { return _meshlets; }
+
 
     [[nodiscard]] const IBuffer* getVertexBuffer() const { return _vertexBuffer.get(); }
     [[nodiscard]] IBuffer*       getVertexBufferMut() const { return _vertexBuffer.get(); }
@@ -51,35 +64,66 @@ struct YA_RESOURCE_API Mesh
     [[nodiscard]] IBuffer*       getIndexBufferMut() const { return _indexBuffer.get(); }
     [[nodiscard]] uint32_t       getIndexBufferOffset() const { return _indexBufferOffset; }
 
-    void drawStatic(ICommandBuffer* cmdBuf) const
+    void drawStatic(ICommandBuffer* cmdBuf, uint32_t lod = 0) const
+    {
+        const MeshLod& range = getLod(lod);
+        cmdBuf->bindVertexBuffer(0, _vertexBuffer.get(), _vertexBufferOffset);
+        cmdBuf->bindIndexBuffer(_indexBuffer.get(), _indexBufferOffset, false); // false = use 32-bit indices
+        cmdBuf->drawIndexed(range.indexCount, 1, range.firstIndex, 0, 0);
+    }
+
+    /// One draw for @p instanceCount instances; the shader fetches per-instance data.
+    void drawStaticInstanced(ICommandBuffer* cmdBuf, uint32_t instanceCount, uint32_t firstInstance = 0, uint32_t lod = 0) const
     {
+        const MeshLod& range = getLod(lod);
         cmdBuf->bindVertexBuffer(0, _vertexBuffer.get(), _vertexBufferOffset);
         cmdBuf->bindIndexBuffer(_indexBuffer.get(), _indexBufferOffset, false); // false = use 32-bit indices
-        cmdBuf->drawIndexed(_indexCount, 1, 0, 0, 0);
+        cmdBuf->drawIndexed(range.indexCount, instanceCount, range.firstIndex, 0, firstInstance);
     }
 
-    void drawSkinned(ICommandBuffer* cmdBuf) const
+    void drawSkinned(ICommandBuffer* cmdBuf, uint32_t lod = 0) const
     {
         YA_CORE_ASSERT(!_optVertexBuffers.empty(), "drawSkinned requires a skinning vertex buffer");
+        const MeshLod& range = getLod(lod);
         cmdBuf->bindVertexBuffer(0, _vertexBuffer.get(), _vertexBufferOffset);
         cmdBuf->bindVertexBuffer(1, _optVertexBuffers[0].get(), _optVertexBufferOffsets[0]);
         cmdBuf->bindIndexBuffer(_indexBuffer.get(), _indexBufferOffset, false); // false = use 32-bit indices
-        cmdBuf->drawIndexed(_indexCount, 1, 0, 0, 0);
+        cmdBuf->drawIndexed(range.indexCount, 1, range.firstIndex, 0, 0);
+    }
+
+    /// Draw the LOD 0 clusters in @p visibleMeshlets (ascending, e.g. from
+    /// mesh_optimizer::cullMeshlets); adjacent clusters share one draw.
+    void drawStaticMeshlets(ICommandBuffer* cmdBuf, std::span<const uint32_t> visibleMeshlets) const
+    {
+        cmdBuf->bindVertexBuffer(0, _vertexBuffer.get(), _vertexBufferOffset);
+        cmdBuf->bindIndexBuffer(_indexBuffer.get(), _indexBufferOffset, false); // false = use 32-bit indices
+        size_t run = 0;
+        while (run < visibleMeshlets.size()) {
+            const Meshlet& first = _meshlets[visibleMeshlets[run]];
+            uint32_t       count = first.triangleCount * 3;
+            size_t         next  = run + 1;
+            while (next < visibleMeshlets.size() && visibleMeshlets[next] == visibleMeshlets[next - 1] + 1) {
+                count += _meshlets[visibleMeshlets[next]].triangleCount * 3;
+                ++next;
+            }
+            cmdBuf->drawIndexed(count, 1, first.triangleOffset, 0, 0);
+            run = next;
+        }
     }
 
-    void draw(ICommandBuffer* cmdBuf) const
+    void draw(ICommandBuffer* cmdBuf, uint32_t lod = 0) const
     {
         if (hasSkinningVertexBuffer()) {
-            drawSkinned(cmdBuf);
+            drawSkinned(cmdBuf, lod);
             return;
         }
-        drawStatic(cmdBuf);
+        drawStatic(cmdBuf, lod);
     }
 
     const std::string& getName() const { return _name; }
 
   private:
-    Mesh(IRender& render, const EngineMeshData& meshData);
+    Mesh(IRender& render, const EngineMeshView& meshData);
 };
 
 } // namespace ya
@@ -3,6 +3,7 @@
 #include "Resource/EngineGeometryNormalizer.h"
 #include "Resource/Loader/Model/AssimpImporter.h"
 #include "Resource/Loader/Model/GltfImporter.h"
+#include "Resource/Core/Model/CookedModel.h"
 #include "Resource/Core/Model/ImportedModelData.h"
 #include "Resource/Core/Model/ModelImporterCommon.h"
 #include "Resource/Loader/Model/ModelImporterRegistry.h"
@@ -27,14 +28,14 @@ ImportedModelData ImportedModelData::decode(const std::string& filepath)
     return model_importer::getAssimpImporter().import(normalizedFilepath);
 }
 
-std::shared_ptr<Model> ImportedModelData::createModel(IRender& render) const
+std::shared_ptr<Model> ImportedModelData::createModel(IRender& render, const MeshOptimizationSettings& settings) const
 {
     auto model      = makeShared<Model>();
     model->filepath = filepath;
     model->setDirectory(directory);
 
     for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
-        auto engineMeshData = buildEngineMeshData(*this, meshIndex);
+        auto engineMeshData = buildEngineMeshData(*this, meshIndex, settings);
         auto mesh           = Mesh::create(render, engineMeshData);
         model->meshes.push_back(std::move(mesh));
     }
@@ -58,4 +59,36 @@ std::shared_ptr<Model> ImportedModelData::createModel(IRender& render) const
     return model;
 }
 
+std::shared_ptr<Model> CookedModel::createModel(IRender& render) const
+{
+    auto model      = makeShared<Model>();
+    model->filepath = getFilepath();
+    model->setDirectory(getDirectory());
+
+    // Mesh data is uploaded straight from the mapping; nothing is rebuilt.
+    model->meshes.reserve(getMeshCount());
+    for (size_t meshIndex = 0; meshIndex < getMeshCount(); ++meshIndex) {
+        model->meshes.push_back(Mesh::create(render, getMesh(meshIndex)));
+    }
+
+    model->embeddedMaterials   = getMaterials();
+    model->meshMaterialIndices = getMeshMaterialIndices();
+    model->meshSkeletonIndices = getMeshSkeletonIndices();
+
+    model->skeletons.reserve(getSkeletons().size());
+    for (const ImportedSkeletonData& importedSkeleton : getSkeletons()) {
+        model->skeletons.push_back(createSkeleton(importedSkeleton));
+    }
+
+    model->setIsLoaded(true);
+
+    YA_CORE_INFO("CookedModel::createModel: '{}' -> {} GPU meshes, {} skeletons ({} bytes mapped)",
+                 model->filepath,
+                 model->meshes.size(),
+                 model->skeletons.size(),
+                 getMappedSize());
+
+    return model;
+}
+
 } // namespace ya
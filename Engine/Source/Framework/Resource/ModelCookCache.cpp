@@ -0,0 +1,119 @@
+#include "Resource/ModelCookCache.h"
+
+#include "Resource/EngineGeometryNormalizer.h"
+#include "Resource/Model.h"
+#include "Resource/Core/Model/ModelImporterCommon.h"
+
+#include "Core/Log.h"
+#include "Core/Profiling/Instrumentor.h"
+
+#include <atomic>
+#include <cctype>
+#include <format>
+
+namespace ya
+{
+
+namespace
+{
+
+std::atomic<bool> g_bCookEnabled{true};
+
+uint64_t hashAssetPath(std::string_view value)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char ch : value) {
+        hash ^= static_cast<uint8_t>(ch);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string makeCookedFileName(std::string_view assetPath)
+{
+    std::string stem = std::filesystem::path(assetPath).stem().generic_string();
+    for (char& ch : stem) {
+        if (!std::isalnum(static_cast<unsigned char>(ch))) {
+            ch = '_';
+        }
+    }
+    constexpr size_t MAX_STEM_LENGTH = 48;
+    if (stem.size() > MAX_STEM_LENGTH) {
+        stem.resize(MAX_STEM_LENGTH);
+    }
+    return std::format("{}-{:016x}.yamodel", stem.empty() ? "model" : stem, hashAssetPath(assetPath));
+}
+
+} // namespace
+
+std::shared_ptr<Model> ModelDecodeResult::createModel(IRender& render) const
+{
+    return cooked ? cooked->createModel(render) : imported.createModel(render, meshSettings);
+}
+
+namespace model_cook
+{
+
+void setEnabled(bool bEnabled)
+{
+    g_bCookEnabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+bool isEnabled()
+{
+    return g_bCookEnabled.load(std::memory_order_relaxed);
+}
+
+std::filesystem::path getCookedPath(std::string_view assetPath)
+{
+    std::filesystem::path directory(COOKED_MODEL_DIRECTORY);
+    if (auto* vfs = VirtualFileSystem::get()) {
+        directory = vfs->translatePath(COOKED_MODEL_DIRECTORY);
+    }
+    return directory / makeCookedFileName(assetPath);
+}
+
+ModelDecodeResult decodeForLoad(const std::string& assetPath, const MeshOptimizationSettings& settings)
+{
+    const std::string normalizedPath = model_importer::detail::normalizeImportedAssetPath(assetPath);
+    if (!isEnabled()) {
+        return {.imported = ImportedModelData::decode(normalizedPath), .meshSettings = settings};
+    }
+
+    const auto cookedPath = getCookedPath(normalizedPath);
+    auto       stamp      = CookedModelSourceStamp::fromFile(normalizedPath, model_importer::detail::resolveImportedIoPath(normalizedPath));
+    if (stamp != CookedModelSourceStamp{}) {
+        stamp.settingsHash = settings.hash();
+        if (auto cooked = CookedModel::open(cookedPath, stamp)) {
+            YA_CORE_INFO("model_cook: '{}' <- cooked '{}' ({} meshes)", normalizedPath, cookedPath.generic_string(), cooked->getMeshCount());
+            return {.cooked = std::move(cooked)};
+        }
+    }
+
+    ModelDecodeResult result{.imported = ImportedModelData::decode(normalizedPath), .meshSettings = settings};
+    if (!result.imported.isValid() || stamp == CookedModelSourceStamp{}) {
+        return result;
+    }
+
+    YA_PROFILE_SCOPE_LOG("model_cook::cook");
+    std::vector<EngineMeshData> meshes;
+    meshes.reserve(result.imported.meshes.size());
+    for (size_t meshIndex = 0; meshIndex < result.imported.meshes.size(); ++meshIndex) {
+        meshes.push_back(buildEngineMeshData(result.imported, meshIndex, settings));
+    }
+    if (!CookedModel::write(cookedPath, stamp, result.imported, meshes)) {
+        YA_CORE_WARN("model_cook: failed to write cooked model '{}' for '{}'", cookedPath.generic_string(), normalizedPath);
+        return result;
+    }
+
+    // Map the cook back so first load and reload take the same upload path;
+    // the normalized meshes are not rebuilt by createModel.
+    if (auto cooked = CookedModel::open(cookedPath, stamp)) {
+        return {.cooked = std::move(cooked)};
+    }
+    return result;
+}
+
+} // namespace model_cook
+
+} // namespace ya
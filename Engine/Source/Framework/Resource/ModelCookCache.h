@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Resource/Core/Model/CookedModel.h"
+#include "Resource/Core/Model/ImportedModelData.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace ya
+{
+
+struct Model;
+struct IRender;
+
+/// A model resolved for loading: the mapped cooked model when one is fresh
+/// (or could be cooked now), otherwise the raw importer output.
+struct ModelDecodeResult
+{
+    std::shared_ptr<CookedModel> cooked;
+    ImportedModelData            imported;
+    /// Applied when `imported` is turned into a model (already baked into `cooked`).
+    MeshOptimizationSettings     meshSettings;
+
+    [[nodiscard]] bool isValid() const { return cooked || imported.isValid(); }
+
+    std::shared_ptr<Model> createModel(IRender& render) const;
+};
+
+namespace model_cook
+{
+
+/// VFS directory that holds cooked models.
+inline constexpr std::string_view COOKED_MODEL_DIRECTORY = "Engine/Intermediate/CookedModel";
+
+/// Physical path of the cooked file for @p assetPath.
+std::filesystem::path getCookedPath(std::string_view assetPath);
+
+/**
+ * @brief Resolve @p assetPath for loading, cooking it on first import
+ *
+ * A fresh cooked file is mapped directly. Otherwise the importer runs, its
+ * meshes are normalized once, written as a cooked file and mapped back, so
+ * the first load and every later load share the zero-copy upload path. If
+ * the cook cannot be written, the importer output is returned as before.
+ *
+ * @p settings (from the model's AssetMeta) drive the import-time mesh
+ * optimization and are part of the cooked stamp, so changing them re-cooks.
+ * Safe to call from worker threads; resolve the meta on the main thread.
+ */
+ModelDecodeResult decodeForLoad(const std::string& assetPath, const MeshOptimizationSettings& settings = {});
+
+/// Globally enable/disable cooked model reuse and writing (enabled by default).
+void setEnabled(bool bEnabled);
+bool isEnabled();
+
+} // namespace model_cook
+
+} // namespace ya
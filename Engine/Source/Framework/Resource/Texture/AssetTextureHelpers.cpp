@@ -5,6 +5,8 @@
 #include "Core/System/VirtualFileSystem.h"
 #include "RHI/Render.h"
 #include "Resource/AssetManager.h"
+#include "Resource/Core/DerivedData/BinaryArchive.h"
+#include "Resource/Core/DerivedData/DerivedDataCache.h"
 #include "ktx.h"
 #include "stb/stb_image.h"
 
@@ -14,7 +16,9 @@
 #include <cctype>
 #include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <memory>
+#include <optional>
 
 namespace ya::asset_manager_texture_detail
 {
@@ -296,6 +300,20 @@ KtxTextureHandle loadKtxTexture(const std::string& filepath, ktxTextureCreateFla
     return KtxTextureHandle(rawTexture);
 }
 
+KtxTextureHandle loadKtxTextureFromMemory(const std::string&          filepath,
+                                          const std::vector<uint8_t>& bytes,
+                                          ktxTextureCreateFlags       createFlags)
+{
+    ktxTexture* rawTexture = nullptr;
+    const auto  result     = ktxTexture_CreateFromMemory(bytes.data(), bytes.size(), createFlags, &rawTexture);
+    if (result != KTX_SUCCESS || rawTexture == nullptr) {
+        YA_CORE_ERROR("KTX load failed for '{}': {}", filepath, ktxErrorString(result));
+        return {};
+    }
+
+    return KtxTextureHandle(rawTexture);
+}
+
 uint16_t floatToHalf(float value)
 {
     uint32_t bits = 0;
@@ -467,7 +485,83 @@ bool applyKtxResolvedSettings(const std::string& filepath,
     return false;
 }
 
-AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::ResolvedTextureImportSettings& settings)
+namespace
+{
+
+/// Bump when decode/transcode output changes for the same inputs.
+constexpr uint32_t TEXTURE_DECODE_DDC_VERSION = 1;
+
+/// Only decodes that cost far more than reading their result back are worth
+/// a cache entry: Basis transcodes and float (HDR) decodes. Plain LDR stb
+/// decodes and pre-compressed KTX payloads are already cheap.
+bool shouldCacheDecodedTexture(const AssetManager::ResolvedTextureImportSettings& settings)
+{
+    if (isKtxPath(settings.sourceInfo.filepath)) {
+        return settings.uploadStrategy == AssetManager::ETextureUploadStrategy::TranscodeKtx2 &&
+               settings.transcodeTarget != AssetManager::ETextureTranscodeTarget::None;
+    }
+    return settings.payloadType == AssetManager::ETexturePayloadType::F16 ||
+           settings.payloadType == AssetManager::ETexturePayloadType::F32;
+}
+
+DerivedDataKey buildTextureDecodeKey(const AssetManager::ResolvedTextureImportSettings& settings)
+{
+    DerivedDataKeyBuilder builder("TextureDecode", TEXTURE_DECODE_DDC_VERSION);
+    if (!builder.sourceFile(settings.sourceInfo.ioFilepath)) {
+        return {};
+    }
+    builder.value(settings.colorSpace)
+        .value(settings.channelPolicy)
+        .value(settings.payloadType)
+        .value(settings.decodePrecision)
+        .value(settings.resolvedFormat)
+        .value(settings.resolvedChannels)
+        .value(settings.uploadStrategy)
+        .value(settings.transcodeTarget);
+    return builder.finish();
+}
+
+std::optional<AssetManager::TextureMemoryBlock> loadCachedTexture(const DerivedDataKey&                              key,
+                                                                  const AssetManager::ResolvedTextureImportSettings& settings)
+{
+    auto payload = DerivedDataCache::get().load(key);
+    if (!payload) {
+        return std::nullopt;
+    }
+
+    BinaryReader                     reader(*payload);
+    AssetManager::TextureMemoryBlock result;
+    result.filepath        = settings.requestedFilepath;
+    result.payloadType     = settings.payloadType;
+    result.importSettings  = settings;
+    result.width           = reader.pod<uint32_t>();
+    result.height          = reader.pod<uint32_t>();
+    result.channels        = reader.pod<uint32_t>();
+    result.mipLevels       = reader.pod<uint32_t>();
+    result.format          = reader.pod<EFormat::T>();
+    result.generateMipmaps = reader.pod<uint8_t>() != 0;
+    result.bytes           = reader.podArray<uint8_t>();
+    if (!reader.ok() || !result.isValid()) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+void storeCachedTexture(const DerivedDataKey& key, const AssetManager::TextureMemoryBlock& block)
+{
+    BinaryWriter writer;
+    writer.pod(block.width);
+    writer.pod(block.height);
+    writer.pod(block.channels);
+    writer.pod(block.mipLevels);
+    writer.pod(block.format);
+    writer.pod(static_cast<uint8_t>(block.generateMipmaps ? 1 : 0));
+    writer.podArray(block.bytes);
+    DerivedDataCache::get().store(key, writer.bytes);
+}
+
+AssetManager::TextureMemoryBlock decodeTextureFromBytes(const AssetManager::ResolvedTextureImportSettings& settings,
+                                                        const std::vector<uint8_t>&                        source)
 {
     AssetManager::TextureMemoryBlock result;
     result.filepath       = settings.requestedFilepath;
@@ -496,7 +590,7 @@ AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::Resol
             return result;
         }
 
-        auto texture = loadKtxTexture(settings.sourceInfo.filepath, KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT);
+        auto texture = loadKtxTextureFromMemory(settings.sourceInfo.filepath, source, KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT);
         if (!texture) {
             result.hardFailure = true;
             result.error       = "Failed to load KTX texture";
@@ -562,7 +656,12 @@ AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::Resol
     const auto& ioPath = settings.sourceInfo.ioFilepath;
 
     if (settings.payloadType == AssetManager::ETexturePayloadType::U8) {
-        stbi_uc* raw = stbi_load(ioPath.c_str(), &width, &height, &channels, desiredChannels);
+        stbi_uc* raw = stbi_load_from_memory(source.data(),
+                                             static_cast<int>(source.size()),
+                                             &width,
+                                             &height,
+                                             &channels,
+                                             desiredChannels);
         if (!raw) {
             YA_CORE_ERROR("decodeTextureToMemory: Failed to load '{}' (io='{}')", settings.sourceInfo.filepath, ioPath);
             result.hardFailure = true;
@@ -579,7 +678,12 @@ AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::Resol
         return result;
     }
 
-    float* rawFloat = stbi_loadf(ioPath.c_str(), &width, &height, &channels, desiredChannels);
+    float* rawFloat = stbi_loadf_from_memory(source.data(),
+                                             static_cast<int>(source.size()),
+                                             &width,
+                                             &height,
+                                             &channels,
+                                             desiredChannels);
     if (!rawFloat) {
         YA_CORE_ERROR("decodeTextureToMemory: Failed to load HDR texture '{}' (io='{}')", settings.sourceInfo.filepath, ioPath);
         result.hardFailure = true;
@@ -617,6 +721,93 @@ AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::Resol
     return result;
 }
 
+} // namespace
+
+uint64_t estimateTextureDecodeBytes(const AssetManager::ResolvedTextureImportSettings& settings)
+{
+    std::error_code ec;
+    const auto      fileSize = std::filesystem::file_size(settings.sourceInfo.ioFilepath, ec);
+    const uint64_t  sourceBytes = ec ? 0 : static_cast<uint64_t>(fileSize);
+
+    uint64_t bytesPerChannel = 1;
+    if (settings.payloadType == AssetManager::ETexturePayloadType::F16) {
+        bytesPerChannel = 2;
+    }
+    else if (settings.payloadType == AssetManager::ETexturePayloadType::F32) {
+        bytesPerChannel = 4;
+    }
+    const uint64_t decodedBytes = static_cast<uint64_t>(settings.sourceInfo.width) * settings.sourceInfo.height *
+                                  settings.resolvedChannels * bytesPerChannel;
+    // Source and decoded pixels are both resident while decode runs.
+    return sourceBytes + std::max(decodedBytes, sourceBytes);
+}
+
+bool readTextureSource(TextureDecodeWork& work)
+{
+    const auto& settings = work.settings;
+    if (shouldCacheDecodedTexture(settings)) {
+        work.cacheKey = buildTextureDecodeKey(settings);
+        if (work.cacheKey.isValid()) {
+            if (auto cached = loadCachedTexture(work.cacheKey, settings)) {
+                work.result     = std::move(*cached);
+                work.bFromCache = true;
+                return true;
+            }
+        }
+    }
+
+    // Placeholders never touch the file; decode reports the diagnostic.
+    if (isKtxPath(settings.sourceInfo.filepath) &&
+        settings.uploadStrategy == AssetManager::ETextureUploadStrategy::Placeholder) {
+        return true;
+    }
+
+    std::ifstream input(settings.sourceInfo.ioFilepath, std::ios::binary | std::ios::ate);
+    const auto    size = input.is_open() ? static_cast<std::streamoff>(input.tellg()) : std::streamoff(-1);
+    if (size > 0) {
+        work.sourceBytes.resize(static_cast<size_t>(size));
+        input.seekg(0);
+        input.read(reinterpret_cast<char*>(work.sourceBytes.data()), size);
+    }
+    if (size <= 0 || !input.good()) {
+        YA_CORE_ERROR("decodeTextureToMemory: Failed to read '{}' (io='{}')",
+                      settings.sourceInfo.filepath,
+                      settings.sourceInfo.ioFilepath);
+        work.sourceBytes.clear();
+        work.result             = {};
+        work.result.filepath    = settings.requestedFilepath;
+        work.result.hardFailure = true;
+        work.result.error       = "Failed to read texture bytes";
+        return false;
+    }
+    return true;
+}
+
+bool decodeTextureSource(TextureDecodeWork& work)
+{
+    if (!work.bFromCache) {
+        work.result = decodeTextureFromBytes(work.settings, work.sourceBytes);
+    }
+    std::vector<uint8_t>().swap(work.sourceBytes);
+    return work.result.isValid();
+}
+
+void storeDecodedTexture(const TextureDecodeWork& work)
+{
+    if (!work.bFromCache && work.cacheKey.isValid() && !work.result.hardFailure && work.result.isValid()) {
+        storeCachedTexture(work.cacheKey, work.result);
+    }
+}
+
+AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::ResolvedTextureImportSettings& settings)
+{
+    TextureDecodeWork work{.settings = settings};
+    if (readTextureSource(work) && decodeTextureSource(work)) {
+        storeDecodedTexture(work);
+    }
+    return std::move(work.result);
+}
+
 AssetManager::ETextureColorSpace parseColorSpace(const std::string& raw, AssetManager::ETextureColorSpace fallback)
 {
     const std::string s = toLowerCopy(raw);
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Resource/AssetManager.h"
+#include "Resource/Core/DerivedData/DerivedDataCache.h"
+
+#include <vector>
 
 namespace ya::asset_manager_texture_detail
 {
@@ -17,6 +20,24 @@ bool applyKtxResolvedSettings(const std::string& filepath,
 
 AssetManager::TextureMemoryBlock decodeTextureToMemory(const AssetManager::ResolvedTextureImportSettings& settings);
 
+/// decodeTextureToMemory split into import-pipeline stages. Read probes the
+/// derived-data cache and loads the source bytes, decode turns them into the
+/// payload (and frees them), store writes cacheable results back.
+struct TextureDecodeWork
+{
+    AssetManager::ResolvedTextureImportSettings settings;
+    DerivedDataKey                              cacheKey;
+    std::vector<uint8_t>                        sourceBytes;
+    AssetManager::TextureMemoryBlock            result;
+    bool                                        bFromCache = false;
+};
+
+/// Peak bytes one decode holds (source file + decoded payload).
+uint64_t estimateTextureDecodeBytes(const AssetManager::ResolvedTextureImportSettings& settings);
+bool     readTextureSource(TextureDecodeWork& work);
+bool     decodeTextureSource(TextureDecodeWork& work);
+void     storeDecodedTexture(const TextureDecodeWork& work);
+
 AssetManager::ETextureColorSpace parseColorSpace(const std::string& raw,
                                                  AssetManager::ETextureColorSpace fallback);
 AssetManager::ETextureSourceKind parseSourceKind(const std::string& raw,
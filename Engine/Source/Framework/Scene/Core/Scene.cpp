@@ -292,6 +292,7 @@ void Scene::clear()
     _widgetEntries.clear();
     _rootNode.reset();
     _registry.clear();
+    _spatialIndex.clear();
     _entityCounter = 0;
 }
 
@@ -12,6 +12,7 @@
 #include "Hierarchy/Node.h"
 #include "Scene/Core/SceneWidgetEntry.h"
 #include "Scene/Core/ISceneLifecycleHost.h"
+#include "Scene/Core/SceneSpatialIndex.h"
 #include "Scene3D/Node3D.h"
 #include "Resource/Model.h"
 #include <entt/entt.hpp>
@@ -49,6 +50,9 @@ struct YA_SCENE_CORE_API Scene
     /// them into a WidgetTree via GameUIHost, Phase 3).
     std::vector<SceneWidgetEntry> _widgetEntries;
 
+    /// World-bounds broad phase; kept in sync by SceneSpatialIndexSystem.
+    SceneSpatialIndex _spatialIndex;
+
   public:
     Scene(const std::string& name = "Untitled Scene");
     ~Scene();
@@ -148,6 +152,10 @@ struct YA_SCENE_CORE_API Scene
     entt::registry&       getRegistry() { return _registry; }
     const entt::registry& getRegistry() const { return _registry; }
 
+    // Spatial queries (picking, range and visibility queries)
+    SceneSpatialIndex&       getSpatialIndex() { return _spatialIndex; }
+    const SceneSpatialIndex& getSpatialIndex() const { return _spatialIndex; }
+
     // Find entities
     Entity              findEntityByName(const std::string& name);
     std::vector<Entity> findEntitiesByTag(const std::string& tag);
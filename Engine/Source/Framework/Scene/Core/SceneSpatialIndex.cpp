@@ -0,0 +1,73 @@
+#include "SceneSpatialIndex.h"
+
+#include "Core/Profiling/Instrumentor.h"
+
+namespace ya
+{
+
+void SceneSpatialIndex::update(entt::entity entity, SpatialProxyComponent &proxy, const AABB &worldBounds)
+{
+    const glm::vec3 center = worldBounds.getCenter();
+    if (proxy.proxyId == DynamicAABBTree::kNullNode) {
+        proxy.proxyId = _tree.createProxy(worldBounds, static_cast<uint64_t>(entt::to_integral(entity)));
+    }
+    else {
+        _tree.moveProxy(proxy.proxyId, worldBounds, center - proxy.lastCenter);
+    }
+    proxy.lastCenter = center;
+}
+
+void SceneSpatialIndex::remove(SpatialProxyComponent &proxy)
+{
+    if (proxy.proxyId == DynamicAABBTree::kNullNode) {
+        return;
+    }
+    _tree.destroyProxy(proxy.proxyId);
+    proxy.proxyId = DynamicAABBTree::kNullNode;
+}
+
+size_t SceneSpatialIndex::removeStale(const entt::registry &registry)
+{
+    YA_PROFILE_FUNCTION();
+
+    std::vector<int32_t> stale;
+    _tree.forEachProxy([&](int32_t proxyId) {
+        const entt::entity entity = toEntity(_tree.getUserData(proxyId));
+        const auto        *link   = registry.valid(entity) ? registry.try_get<SpatialProxyComponent>(entity) : nullptr;
+        if (!link || link->proxyId != proxyId) {
+            stale.push_back(proxyId);
+        }
+        return true;
+    });
+
+    for (int32_t proxyId : stale) {
+        _tree.destroyProxy(proxyId);
+    }
+    return stale.size();
+}
+
+void SceneSpatialIndex::queryAABB(const AABB &bounds, std::vector<entt::entity> &outEntities) const
+{
+    _tree.query(bounds, [&](int32_t proxyId) {
+        outEntities.push_back(toEntity(_tree.getUserData(proxyId)));
+        return true;
+    });
+}
+
+void SceneSpatialIndex::queryFrustum(const Frustum &frustum, std::vector<entt::entity> &outEntities) const
+{
+    _tree.queryFrustum(frustum, [&](int32_t proxyId) {
+        outEntities.push_back(toEntity(_tree.getUserData(proxyId)));
+        return true;
+    });
+}
+
+void SceneSpatialIndex::querySphere(const glm::vec3 &center, float radius, std::vector<entt::entity> &outEntities) const
+{
+    _tree.querySphere(center, radius, [&](int32_t proxyId) {
+        outEntities.push_back(toEntity(_tree.getUserData(proxyId)));
+        return true;
+    });
+}
+
+} // namespace ya
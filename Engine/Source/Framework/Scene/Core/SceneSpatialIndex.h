@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Core/Math/DynamicAABBTree.h"
+
+#include <entt/entt.hpp>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace ya
+{
+
+/**
+ * @brief Runtime-only link from an entity to its SceneSpatialIndex proxy
+ *
+ * Plain data, not an IComponent: never serialized or shown in the editor.
+ * Written by the system that keeps the index in sync with the scene.
+ */
+struct SpatialProxyComponent
+{
+    int32_t     proxyId       = DynamicAABBTree::kNullNode;
+    uint32_t    worldRevision = 0;       // TransformComponent::getWorldRevision() at last sync
+    const void *boundsSource  = nullptr; // Identity of the bounds provider (e.g. mesh) at last sync
+    glm::vec3   lastCenter{0.0f};        // For the motion hint passed to moveProxy()
+};
+
+/**
+ * @brief Scene-owned broad phase over entity world bounds
+ *
+ * Wraps a DynamicAABBTree whose user data is the entity handle. The index is
+ * not self-updating: a system (SceneSpatialIndexSystem) mirrors world bounds
+ * into it after transforms are resolved. Queries return candidates by fat
+ * bounds, so callers narrow with exact tests where it matters.
+ */
+class YA_SCENE_CORE_API SceneSpatialIndex
+{
+  public:
+    struct RayHit
+    {
+        entt::entity entity   = entt::null;
+        float        distance = 0.0f;
+    };
+
+    /// Insert or update the proxy for `entity`; `proxy` is the entity's link component.
+    void update(entt::entity entity, SpatialProxyComponent &proxy, const AABB &worldBounds);
+
+    void remove(SpatialProxyComponent &proxy);
+
+    /// Drop proxies whose entity no longer exists or no longer links to them.
+    size_t removeStale(const entt::registry &registry);
+
+    void clear() { _tree.clear(); }
+
+    [[nodiscard]] size_t                 size() const { return _tree.getProxyCount(); }
+    [[nodiscard]] bool                   empty() const { return _tree.getProxyCount() == 0; }
+    [[nodiscard]] const DynamicAABBTree &getTree() const { return _tree; }
+
+    void queryAABB(const AABB &bounds, std::vector<entt::entity> &outEntities) const;
+    void queryFrustum(const Frustum &frustum, std::vector<entt::entity> &outEntities) const;
+    void querySphere(const glm::vec3 &center, float radius, std::vector<entt::entity> &outEntities) const;
+
+    /**
+     * @brief Closest entity along `ray`
+     *
+     * `exactTest(entity, outDistance)` refines each candidate (e.g. against its
+     * tight world AABB) and returns false for a miss.
+     */
+    template <typename ExactTest>
+    std::optional<RayHit> raycastClosest(const Ray &ray, float maxDistance, ExactTest &&exactTest) const;
+
+  private:
+    static entt::entity toEntity(uint64_t userData)
+    {
+        return static_cast<entt::entity>(static_cast<std::underlying_type_t<entt::entity>>(userData));
+    }
+
+    DynamicAABBTree _tree;
+};
+
+template <typename ExactTest>
+std::optional<SceneSpatialIndex::RayHit> SceneSpatialIndex::raycastClosest(const Ray &ray, float maxDistance, ExactTest &&exactTest) const
+{
+    std::optional<RayHit> closest;
+    _tree.raycast(ray, maxDistance, [&](int32_t proxyId, float /*entryDistance*/) {
+        const entt::entity entity   = toEntity(_tree.getUserData(proxyId));
+        float              distance = 0.0f;
+        if (exactTest(entity, distance) && distance <= maxDistance) {
+            maxDistance = distance;
+            closest     = RayHit{.entity = entity, .distance = distance};
+        }
+        return maxDistance;
+    });
+    return closest;
+}
+
+} // namespace ya
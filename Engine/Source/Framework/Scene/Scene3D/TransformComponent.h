@@ -52,6 +52,7 @@ struct TransformComponent : public IComponent
     // === CACHED DATA (computed by TransformSystem, READ ONLY) ===
     glm::mat4 _localMatrix = glm::mat4(1.0f); // Computed from position/rotation/scale
     glm::mat4 _worldMatrix = glm::mat4(1.0f); // Computed from parent world * local
+    uint32_t  _worldRevision = 0;             // Bumped on every _worldMatrix write (change detection)
 
     // === DIRTY FLAGS ===
     bool _localDirty = true; // Need to recompute _localMatrix
@@ -151,6 +152,10 @@ struct TransformComponent : public IComponent
     [[nodiscard]] bool isLocalDirty() const { return _localDirty; }
     [[nodiscard]] bool isWorldDirty() const { return _worldDirty; }
 
+    /// Changes whenever the world matrix was recomputed; compare against a stored
+    /// value to detect movement without keeping a copy of the matrix.
+    [[nodiscard]] uint32_t getWorldRevision() const { return _worldRevision; }
+
     void markLocalDirty()
     {
         _localDirty = true;
@@ -166,7 +171,11 @@ struct TransformComponent : public IComponent
 
     // Called by TransformSystem after computing matrices
     void clearLocalDirty() { _localDirty = false; }
-    void clearWorldDirty() { _worldDirty = false; }
+    void clearWorldDirty()
+    {
+        _worldDirty = false;
+        ++_worldRevision;
+    }
 
     // ========================================================================
     // Convenience Methods
@@ -0,0 +1,149 @@
+#include "Core/Async/JobSystem.h"
+#include "Resource/Manager/AssetImportPipeline.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+class AssetImportPipelineBenchmark : public ya::JobSystemTestSuite
+{
+};
+
+/// Synthetic texture: read produces "file" bytes, decode expands them 4x.
+struct FakeAsset
+{
+    uint32_t             id = 0;
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> decoded;
+    uint64_t             checksum = 0;
+};
+
+ya::AssetImportItem makeFakeItem(const std::shared_ptr<FakeAsset>& asset,
+                                 size_t                            sourceBytes,
+                                 std::function<void(bool)>         upload)
+{
+    ya::AssetImportItem item;
+    item.label          = "fake_" + std::to_string(asset->id);
+    item.estimatedBytes = sourceBytes * 5;
+    item.read           = [asset, sourceBytes](ya::AssetImportStageContext& context) {
+        asset->source.assign(sourceBytes, static_cast<uint8_t>(asset->id));
+        context.processedBytes = sourceBytes;
+        return true;
+    };
+    item.decode = [asset](ya::AssetImportStageContext& context) {
+        asset->decoded.resize(asset->source.size() * 4);
+        for (size_t index = 0; index < asset->decoded.size(); ++index) {
+            asset->decoded[index] = static_cast<uint8_t>(asset->source[index / 4] + index);
+        }
+        std::vector<uint8_t>().swap(asset->source);
+        context.residentBytes  = asset->decoded.size();
+        context.processedBytes = asset->decoded.size();
+        return true;
+    };
+    item.postProcess = [asset](ya::AssetImportStageContext& context) {
+        asset->checksum        = std::accumulate(asset->decoded.begin(), asset->decoded.end(), uint64_t(0));
+        context.processedBytes = asset->decoded.size();
+        return true;
+    };
+    item.upload = std::move(upload);
+    return item;
+}
+
+} // namespace
+
+// 2,000 synthetic textures through the staged pipeline versus one
+// coarse task per asset with no budget. Prints throughput and peak memory;
+// asserts only on correctness.
+TEST_F(AssetImportPipelineBenchmark, BatchImport)
+{
+    constexpr uint32_t kAssets      = 2000;
+    constexpr size_t   kSourceBytes = 16 * 1024;
+
+    auto runUnbounded = [&]() {
+        auto&                                   jobSystem = ya::JobSystem::get();
+        std::vector<std::shared_ptr<FakeAsset>> assets(kAssets);
+        std::atomic<uint64_t>                   resident{0};
+        std::atomic<uint64_t>                   peak{0};
+        const auto                              begin = std::chrono::steady_clock::now();
+        const ya::JobHandle                     group = jobSystem.createGroup();
+        for (uint32_t id = 0; id < kAssets; ++id) {
+            assets[id]     = std::make_shared<FakeAsset>();
+            assets[id]->id = id;
+            jobSystem.schedule(
+                [asset = assets[id], &resident, &peak]() {
+                    ya::AssetImportStageContext context;
+                    auto                        item = makeFakeItem(asset, kSourceBytes, {});
+                    item.read(context);
+                    item.decode(context);
+                    item.postProcess(context);
+                    // Decoded pixels stay resident until a later upload pass.
+                    const uint64_t now = resident.fetch_add(asset->decoded.size()) + asset->decoded.size();
+                    uint64_t       seen = peak.load();
+                    while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+                    }
+                },
+                group);
+        }
+        jobSystem.run(group);
+        jobSystem.wait(group);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        std::printf("[AssetImportPipeline] unbounded tasks: %u assets in %.2f ms, peak resident %.1f MiB\n",
+                    kAssets,
+                    ms,
+                    peak.load() / (1024.0 * 1024.0));
+    };
+    runUnbounded();
+
+    constexpr uint64_t      kBudget = 32ull << 20;
+    ya::AssetImportPipeline pipeline(ya::AssetImportPipeline::Config{.memoryBudgetBytes = kBudget});
+
+    std::vector<ya::AssetImportItem> items;
+    items.reserve(kAssets);
+    uint32_t uploaded = 0;
+    for (uint32_t id = 0; id < kAssets; ++id) {
+        auto asset = std::make_shared<FakeAsset>();
+        asset->id  = id;
+        items.push_back(makeFakeItem(asset, kSourceBytes, [asset, &uploaded](bool bOk) {
+            uploaded += bOk && asset->checksum != 0 ? 1 : 0;
+            std::vector<uint8_t>().swap(asset->decoded);
+        }));
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    pipeline.submitBatch(std::move(items));
+    pipeline.flush();
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    const auto progress = pipeline.getProgress();
+    std::printf("[AssetImportPipeline] staged pipeline: %u assets in %.2f ms, peak in flight %.1f MiB (budget %.0f MiB)\n",
+                kAssets,
+                ms,
+                progress.peakInFlightBytes / (1024.0 * 1024.0),
+                kBudget / (1024.0 * 1024.0));
+    const char* names[] = {"read", "decode", "postprocess", "upload"};
+    for (size_t stage = 0; stage < 4; ++stage) {
+        const auto metrics = pipeline.getStageMetrics(static_cast<ya::EAssetImportStage>(stage));
+        std::printf("  %-12s items=%llu peakActive=%u %.0f items/s/lane %.1f MiB/s/lane\n",
+                    names[stage],
+                    static_cast<unsigned long long>(metrics.completedItems),
+                    metrics.peakActiveItems,
+                    metrics.itemsPerSecond(),
+                    metrics.megabytesPerSecond());
+    }
+
+    EXPECT_EQ(uploaded, kAssets);
+    EXPECT_EQ(progress.completedItems, kAssets);
+    EXPECT_LE(progress.peakInFlightBytes, kBudget);
+}
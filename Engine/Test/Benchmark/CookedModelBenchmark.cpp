@@ -0,0 +1,136 @@
+#include "Resource/Core/Model/CookedModel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+std::filesystem::path makeTempDir(const char* name)
+{
+    auto dir = std::filesystem::temp_directory_path() / "ya_cooked_model_benchmark" / name;
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    return dir;
+}
+
+EngineMeshData makeMesh(std::string name, uint32_t vertexCount, bool bSkinned)
+{
+    EngineMeshData mesh;
+    mesh.name = std::move(name);
+    mesh.vertices.resize(vertexCount);
+    for (uint32_t index = 0; index < vertexCount; ++index) {
+        mesh.vertices[index].position = glm::vec3(static_cast<float>(index), 1.0f, 2.0f);
+        mesh.vertices[index].normal   = glm::vec3(0.0f, 1.0f, 0.0f);
+    }
+    for (uint32_t index = 0; index + 2 < vertexCount; ++index) {
+        mesh.indices.insert(mesh.indices.end(), {index, index + 1, index + 2});
+    }
+    if (bSkinned) {
+        mesh.skeletonVertices.resize(vertexCount);
+        for (auto& skin : mesh.skeletonVertices) {
+            skin.boneIDs = {1, 0, 0, 0};
+            skin.weights = {1.0f, 0.0f, 0.0f, 0.0f};
+        }
+    }
+    return mesh;
+}
+
+ImportedModelData makeImportedModel(size_t meshCount)
+{
+    ImportedModelData model;
+    model.filepath  = "Content/Test/Robot.gltf";
+    model.directory = "Content/Test";
+    model.meshes.resize(meshCount);
+    model.meshMaterialIndices.assign(meshCount, 0);
+    model.meshSkeletonIndices.assign(meshCount, -1);
+    model.meshSkeletonIndices[0] = 0;
+
+    MaterialData material;
+    material.name = "Body";
+    material.type = "PBR";
+    material.setParam(MatParam::BaseColor, glm::vec4(0.5f, 0.25f, 1.0f, 1.0f));
+    material.setParam(MatParam::Metallic, 0.75f);
+    material.setParam(MatParam::DoubleSided, true);
+    material.setParam(MatParam::AlphaMode, std::string("MASK"));
+    material.setTexturePath(MatTexture::Albedo, "Textures/body_albedo.png");
+    model.materials.push_back(material);
+
+    ImportedSkeletonData skeleton;
+    skeleton.name          = "Armature";
+    skeleton.rootNodeIndex = 0;
+    skeleton.nodes.resize(2);
+    skeleton.nodes[0].name     = FName("Root");
+    skeleton.nodes[0].children = {1};
+    skeleton.nodes[1].name        = FName("Spine");
+    skeleton.nodes[1].parentIndex = 0;
+    skeleton.nameToNodeIndex[FName("Root")]  = 0;
+    skeleton.nameToNodeIndex[FName("Spine")] = 1;
+    skeleton.bones.push_back({.name = FName("Spine"), .boneIndex = 0, .nodeIndex = 1});
+    skeleton.boneNameToIndex[FName("Spine")] = 0;
+
+    ImportedSkeletonAnimationClip clip;
+    clip.name           = "Walk";
+    clip.duration       = 2.0;
+    clip.ticksPerSecond = 30.0;
+    clip.channels.push_back({
+        .targetName   = FName("Spine"),
+        .positionKeys = {{0.0, glm::vec3(0.0f)}, {1.0, glm::vec3(1.0f, 2.0f, 3.0f)}},
+        .rotationKeys = {{0.5, glm::quat(1.0f, 0.0f, 0.0f, 0.0f)}},
+    });
+    skeleton.animations.push_back(clip);
+    skeleton.meshIndices = {0};
+    model.skeletons.push_back(skeleton);
+    return model;
+}
+
+} // namespace
+
+// Mapped open+validate vs a plain read of the same file.
+TEST(CookedModelBenchmark, OpenLargeCookedModel)
+{
+    const auto dir  = makeTempDir("OpenLarge");
+    const auto path = dir / "Large.yamodel";
+
+    constexpr uint32_t                kVertexCount = 1'000'000;
+    const ImportedModelData           imported     = makeImportedModel(1);
+    const std::vector<EngineMeshData> meshes       = {makeMesh("Large", kVertexCount, true)};
+    const CookedModelSourceStamp      stamp{.pathHash = 1};
+    ASSERT_TRUE(CookedModel::write(path, stamp, imported, meshes));
+
+    using Clock         = std::chrono::steady_clock;
+    constexpr int kRuns = 5;
+    double        bestOpenMs = 1e30;
+    double        bestReadMs = 1e30;
+    for (int run = 0; run < kRuns; ++run) {
+        const auto openStart = Clock::now();
+        const auto cooked    = CookedModel::open(path, stamp);
+        bestOpenMs           = std::min(bestOpenMs, std::chrono::duration<double, std::milli>(Clock::now() - openStart).count());
+        ASSERT_NE(cooked, nullptr);
+        ASSERT_EQ(cooked->getMesh(0).vertices.size(), kVertexCount);
+
+        // Baseline: a plain read of the same bytes into memory.
+        const auto     readStart = Clock::now();
+        std::ifstream  input(path, std::ios::binary);
+        std::vector<char> bytes(cooked->getMappedSize());
+        input.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        bestReadMs = std::min(bestReadMs, std::chrono::duration<double, std::milli>(Clock::now() - readStart).count());
+    }
+
+    std::printf("[CookedModel] %u vertices (%.1f MiB): open+validate %.3f ms, full read %.3f ms\n",
+                kVertexCount,
+                static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0),
+                bestOpenMs,
+                bestReadMs);
+}
+
+} // namespace ya
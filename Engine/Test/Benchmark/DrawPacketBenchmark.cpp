@@ -0,0 +1,76 @@
+#include "Render3D/RenderFrameData.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace ya
+{
+
+// Packet grouping and instance packing over an extractor-ordered frame.
+TEST(DrawPacketBenchmark, BuildAndPack100k)
+{
+    constexpr size_t kItemCount = 100'000;
+    constexpr size_t kMeshCount = 64;
+    constexpr size_t kMatCount  = 16;
+
+    // Extractor order: grouped by material, then mesh, with repeated props.
+    std::mt19937                  rng(7);
+    std::uniform_int_distribution meshDist(size_t{1}, kMeshCount);
+    std::uniform_int_distribution matDist(size_t{1}, kMatCount);
+    std::vector<RenderDrawItem>   candidates(kItemCount);
+    for (size_t index = 0; index < kItemCount; ++index) {
+        const size_t mat  = matDist(rng);
+        candidates[index] = RenderDrawItem{
+            .worldMatrix   = glm::mat4(1.0f),
+            .mesh          = reinterpret_cast<Mesh*>(meshDist(rng)),
+            .material      = reinterpret_cast<Material*>(mat),
+            .materialIndex = static_cast<uint32_t>(mat),
+            .entityId      = static_cast<uint32_t>(index),
+        };
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const RenderDrawItem& a, const RenderDrawItem& b) {
+        return a.materialIndex != b.materialIndex ? a.materialIndex < b.materialIndex : a.mesh < b.mesh;
+    });
+    const DrawCandidateView view{std::span<const RenderDrawItem>(candidates)};
+
+    using Clock         = std::chrono::steady_clock;
+    constexpr int kRuns = 10;
+    std::vector<DrawPacket>       packets;
+    std::vector<DrawInstanceData> instances(kItemCount);
+    double                        bestBuildMs = 1e30;
+    double                        bestPackMs  = 1e30;
+    for (int run = 0; run < kRuns; ++run) {
+        const auto buildStart = Clock::now();
+        packets.clear();
+        buildDrawPackets(view, false, packets);
+        const auto packStart = Clock::now();
+        packDrawInstances(view, instances);
+        const auto end = Clock::now();
+        bestBuildMs    = std::min(bestBuildMs, std::chrono::duration<double, std::milli>(packStart - buildStart).count());
+        bestPackMs     = std::min(bestPackMs, std::chrono::duration<double, std::milli>(end - packStart).count());
+    }
+
+    uint32_t covered = 0;
+    for (const auto& packet : packets) {
+        EXPECT_EQ(packet.firstInstance, covered);
+        covered += packet.instanceCount;
+    }
+    EXPECT_EQ(covered, kItemCount);
+    EXPECT_EQ(instances.back().entityId, candidates.back().entityId);
+
+    std::printf("[DrawPackets] %zu items -> %zu instanced draws (x%.1f fewer): build %.3f ms, pack %.3f ms (%.1f MiB)\n",
+                kItemCount,
+                packets.size(),
+                static_cast<double>(kItemCount) / static_cast<double>(packets.size()),
+                bestBuildMs,
+                bestPackMs,
+                static_cast<double>(kItemCount * sizeof(DrawInstanceData)) / (1024.0 * 1024.0));
+}
+
+} // namespace ya
@@ -0,0 +1,100 @@
+#include "Core/Math/DynamicAABBTree.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+ya::AABB boxAt(const glm::vec3& center, float halfSize)
+{
+    return ya::AABB(center - glm::vec3(halfSize), center + glm::vec3(halfSize));
+}
+
+struct MovingBoxes
+{
+    std::vector<ya::AABB>  bounds;
+    std::vector<glm::vec3> velocity;
+    std::vector<int32_t>   proxies;
+};
+
+MovingBoxes makeBoxes(ya::DynamicAABBTree& tree, size_t count, uint32_t seed, float worldExtent = 200.0f)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> position(-worldExtent, worldExtent);
+    std::uniform_real_distribution<float> size(0.25f, 2.0f);
+    std::uniform_real_distribution<float> speed(-0.1f, 0.1f);
+
+    MovingBoxes scene;
+    for (size_t i = 0; i < count; ++i) {
+        const ya::AABB box = boxAt(glm::vec3(position(rng), position(rng), position(rng)), size(rng));
+        scene.bounds.push_back(box);
+        scene.velocity.emplace_back(speed(rng), speed(rng), speed(rng));
+        scene.proxies.push_back(tree.createProxy(box, i));
+    }
+    return scene;
+}
+
+size_t stepBoxes(ya::DynamicAABBTree& tree, MovingBoxes& scene)
+{
+    size_t reinserted = 0;
+    for (size_t i = 0; i < scene.bounds.size(); ++i) {
+        const glm::vec3 delta = scene.velocity[i];
+        scene.bounds[i]       = ya::AABB(scene.bounds[i].min + delta, scene.bounds[i].max + delta);
+        reinserted += tree.moveProxy(scene.proxies[i], scene.bounds[i], delta) ? 1 : 0;
+    }
+    return reinserted;
+}
+
+} // namespace
+
+// 100k moving proxies: per-frame update cost and query latency.
+TEST(DynamicAABBTreeBenchmark, MovingProxies)
+{
+    constexpr size_t kProxies = 100'000;
+    constexpr int    kFrames  = 20;
+    constexpr int    kQueries = 1'000;
+
+    using Clock = std::chrono::steady_clock;
+    auto ms     = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+    ya::DynamicAABBTree tree;
+    const auto          buildBegin = Clock::now();
+    MovingBoxes         scene      = makeBoxes(tree, kProxies, 21, 500.0f);
+    const double        buildMs    = ms(Clock::now() - buildBegin);
+
+    size_t     reinserted  = 0;
+    const auto updateBegin = Clock::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        reinserted += stepBoxes(tree, scene);
+    }
+    const double updateMs = ms(Clock::now() - updateBegin) / kFrames;
+    EXPECT_TRUE(tree.validate());
+
+    std::mt19937                          rng(23);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    size_t                                candidates = 0;
+    const auto                            queryBegin = Clock::now();
+    for (int i = 0; i < kQueries; ++i) {
+        tree.query(boxAt(glm::vec3(position(rng), position(rng), position(rng)), 20.0f), [&](int32_t) {
+            ++candidates;
+            return true;
+        });
+    }
+    const double queryUs = ms(Clock::now() - queryBegin) * 1000.0 / kQueries;
+
+    std::printf("[DynamicAABBTree] proxies=%zu build=%.1f ms update=%.2f ms/frame reinserts=%.1f/frame "
+                "height=%d areaRatio=%.1f boxQuery=%.2f us (%.1f candidates)\n",
+                kProxies,
+                buildMs,
+                updateMs,
+                static_cast<double>(reinserted) / kFrames,
+                tree.getHeight(),
+                tree.getAreaRatio(),
+                queryUs,
+                static_cast<double>(candidates) / kQueries);
+}
@@ -0,0 +1,77 @@
+#include "Core/Math/Frustum.h"
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// Camera at the origin looking down -Z (engine is right-handed, [0, 1] depth).
+ya::Frustum makeCameraFrustum()
+{
+    const glm::mat4 projection = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return ya::Frustum::fromViewProjection(projection * view);
+}
+
+ya::AABB boxAt(const glm::vec3& center, float halfSize)
+{
+    return ya::AABB(center - glm::vec3(halfSize), center + glm::vec3(halfSize));
+}
+
+ya::FrustumCullBounds makeRandomBounds(size_t count, uint32_t seed)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+    std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+    ya::FrustumCullBounds bounds;
+    bounds.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        bounds.push(boxAt(glm::vec3(position(rng), position(rng), position(rng)), size(rng)));
+    }
+    return bounds;
+}
+
+} // namespace
+
+// Scalar vs SIMD kernel cost per box.
+TEST(FrustumCullingBenchmark, Kernels)
+{
+    constexpr size_t  kBoxes      = 100'000;
+    constexpr int     kIterations = 20;
+    const ya::Frustum frustum     = makeCameraFrustum();
+    const auto        bounds      = makeRandomBounds(kBoxes, 11);
+    std::vector<uint8_t> visible(kBoxes);
+
+    auto measure = [&](auto&& kernel) {
+        size_t     visibleCount = 0;
+        const auto begin        = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            visibleCount = kernel(frustum, bounds, visible);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        return std::pair{
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                (static_cast<double>(kBoxes) * kIterations),
+            visibleCount,
+        };
+    };
+
+    const auto [scalarNs, scalarVisible] = measure(ya::FrustumCulling::cullScalar);
+    const auto [simdNs, simdVisible]     = measure(ya::FrustumCulling::cull);
+    EXPECT_EQ(scalarVisible, simdVisible);
+
+    std::printf("[FrustumCulling] boxes=%zu visible=%zu scalar=%.2f ns/box %s=%.2f ns/box\n",
+                kBoxes,
+                simdVisible,
+                scalarNs,
+                ya::FrustumCulling::getKernelName(),
+                simdNs);
+}
@@ -0,0 +1,71 @@
+#include "Core/Profiling/Instrumentor.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+std::filesystem::path makeProfilePath(const char* fileName)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "ya_instrumentor_benchmark";
+    std::filesystem::create_directories(dir);
+    return dir / fileName;
+}
+
+void beginSession(ya::EInstrumentorBackend backend, const std::filesystem::path& path)
+{
+    auto& instrumentor = ya::Instrumentor::Get();
+    auto  config       = instrumentor.GetConfig();
+    config.backend     = backend;
+    instrumentor.SetConfig(config);
+    instrumentor.BeginSession("InstrumentorBenchmark", path.string());
+}
+
+double measureScopeNs(ya::EInstrumentorBackend backend, uint32_t threadCount, int scopesPerThread)
+{
+    beginSession(backend, makeProfilePath("benchmark.json"));
+
+    const auto               begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([scopesPerThread]() {
+            for (int i = 0; i < scopesPerThread; ++i) {
+                ya::InstrumentationTimer timer("InstrumentorBenchmark::scope");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    ya::Instrumentor::Get().EndSession();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+           (static_cast<double>(threadCount) * scopesPerThread);
+}
+
+} // namespace
+
+// Per-scope cost of both backends under contention.
+TEST(InstrumentorBenchmark, PerScopeCost)
+{
+    constexpr int kScopesPerThread = 20'000;
+    const uint32_t threadCount     = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+
+    const double lockedNs = measureScopeNs(ya::EInstrumentorBackend::Locked, threadCount, kScopesPerThread);
+    const double ringNs   = measureScopeNs(ya::EInstrumentorBackend::ThreadRing, threadCount, kScopesPerThread);
+
+    std::printf("[Instrumentor] threads=%u locked=%.1f ns/scope ring=%.1f ns/scope\n", threadCount, lockedNs, ringNs);
+
+    // Leave the singleton on its default backend for other suites.
+    auto config    = ya::Instrumentor::Get().GetConfig();
+    config.backend = ya::ProfilerConfig{}.backend;
+    ya::Instrumentor::Get().SetConfig(config);
+}
@@ -0,0 +1,72 @@
+#include "Core/Async/JobSystem.h"
+#include "Core/Async/TaskQueue.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+
+double elapsedNs(std::chrono::steady_clock::time_point begin)
+{
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+}
+
+} // namespace
+
+// Per-job costs of spawning, stealing and waiting, next to the TaskQueue facade.
+TEST(JobSystemBenchmark, SpawnStealWaitOverhead)
+{
+    ya::JobSystemTestScope jobs;
+
+    auto&              jobSystem = ya::JobSystem::get();
+    constexpr uint32_t kJobs     = 100'000;
+    std::atomic<uint32_t> executed{0};
+
+    // Spawn: main thread creates children of one group; workers steal them off deque 0.
+    const auto statsBefore = jobSystem.getStats();
+    auto       begin       = std::chrono::steady_clock::now();
+    {
+        const ya::JobHandle group = jobSystem.createGroup();
+        for (uint32_t i = 0; i < kJobs; ++i) {
+            jobSystem.schedule([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }, group);
+        }
+        jobSystem.run(group);
+        jobSystem.wait(group);
+    }
+    const double spawnNs    = elapsedNs(begin) / kJobs;
+    const auto   statsAfter = jobSystem.getStats();
+    EXPECT_EQ(executed.load(), kJobs);
+
+    // Round trip: schedule one job and wait for it (wake + execute + completion latency).
+    constexpr uint32_t kRoundTrips = 10'000;
+    begin                          = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kRoundTrips; ++i) {
+        jobSystem.wait(jobSystem.schedule([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    const double waitNs = elapsedNs(begin) / kRoundTrips;
+
+    // TaskQueue facade for comparison: same job plus shared state and future.
+    auto& taskQueue = ya::TaskQueue::get();
+    taskQueue.start();
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kRoundTrips; ++i) {
+        taskQueue.submit([&executed]() { return executed.fetch_add(1, std::memory_order_relaxed); }).get();
+    }
+    const double taskQueueNs = elapsedNs(begin) / kRoundTrips;
+
+    EXPECT_EQ(executed.load(), kJobs + 2 * kRoundTrips);
+    std::printf("[JobSystem] workers=%u spawn+run=%.1f ns/job stolen=%llu/%u schedule+wait=%.1f ns TaskQueue submit+get=%.1f ns\n",
+                jobSystem.getWorkerCount(),
+                spawnNs,
+                static_cast<unsigned long long>(statsAfter.stolenJobs - statsBefore.stolenJobs),
+                kJobs,
+                waitNs,
+                taskQueueNs);
+}
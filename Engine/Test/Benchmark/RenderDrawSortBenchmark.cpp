@@ -0,0 +1,75 @@
+#include "Render3D/RenderDrawSort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+std::vector<RenderDrawItem> makeItems(size_t count, size_t meshCount, size_t materialCount, uint32_t seed)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_int_distribution<size_t> meshDist(1, meshCount);
+    std::uniform_int_distribution<size_t> matDist(0, materialCount - 1);
+    std::uniform_real_distribution<float> depthDist(0.0f, 10000.0f);
+
+    std::vector<RenderDrawItem> items(count);
+    for (size_t index = 0; index < count; ++index) {
+        items[index] = RenderDrawItem{
+            .mesh          = reinterpret_cast<Mesh*>(meshDist(rng) * 64),
+            .materialIndex = static_cast<uint32_t>(matDist(rng)),
+            .entityId      = static_cast<uint32_t>(index),
+            .sortKey       = depthDist(rng),
+        };
+    }
+    return items;
+}
+
+} // namespace
+
+// Comparator sort vs radix sort on 64-bit draw keys.
+TEST(RenderDrawSortBenchmark, RadixVsComparator)
+{
+    using Clock         = std::chrono::steady_clock;
+    constexpr int kRuns = 5;
+
+    RenderDrawSortScratch scratch;
+    for (const size_t count : {size_t{10'000}, size_t{100'000}, size_t{1'000'000}}) {
+        const auto input = makeItems(count, 500, 300, 5);
+
+        double bestComparatorMs = 1e30;
+        double bestRadixMs      = 1e30;
+        auto   items            = input;
+        for (int run = 0; run < kRuns; ++run) {
+            items            = input;
+            const auto start = Clock::now();
+            sortDrawItemsByComparator(items, EDrawSortMode::MaterialMeshFrontToBack);
+            bestComparatorMs = std::min(bestComparatorMs, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+            // Scratch is warm after the first run, as in steady-state frames.
+            items                 = input;
+            const auto radixStart = Clock::now();
+            sortDrawItemsByKey(items, EDrawSortMode::MaterialMeshFrontToBack, scratch);
+            bestRadixMs = std::min(bestRadixMs, std::chrono::duration<double, std::milli>(Clock::now() - radixStart).count());
+        }
+
+        for (size_t index = 1; index < items.size(); ++index) {
+            ASSERT_LE(items[index - 1].materialIndex, items[index].materialIndex);
+        }
+        std::printf("[DrawSort] %7zu items: std::sort %8.3f ms, radix %8.3f ms (x%.2f)\n",
+                    count,
+                    bestComparatorMs,
+                    bestRadixMs,
+                    bestComparatorMs / bestRadixMs);
+    }
+}
+
+} // namespace ya
@@ -0,0 +1,320 @@
+#include "Graph/RenderGraph.h"
+#include "Graph/RenderGraphCompileCache.h"
+#include "Graph/RenderGraphFrameArena.h"
+#include "RHI/Core/RenderTargetCreateInfo.h"
+#include "Render3D/Common/EntityIdViewportPass.h"
+#include "Render3D/Common/PostProcessingStage.h"
+#include "Render3D/Deferred/DeferredFrameGraphOrchestrator.h"
+#include "Render3D/Deferred/GBufferStage.h"
+#include "Render3D/Deferred/LightStage.h"
+#include "Render3D/Deferred/ViewportOverlayStage.h"
+#include "Render3D/Forward/ForwardFrameGraphOrchestrator.h"
+#include "Render3D/Forward/ForwardViewportStage.h"
+
+#include "RenderGraphTestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+
+// Counting global allocator for this binary only. Only allocations made on a
+// thread that opted in through ScopedAllocationCounter are counted; everything
+// else is a plain malloc/free passthrough. On Windows, allocations made inside
+// engine DLLs use the DLL's own operator new and are not seen here.
+namespace
+{
+
+thread_local bool     gbCountAllocations = false;
+thread_local uint64_t gAllocationCount   = 0;
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (gbCountAllocations) {
+        ++gAllocationCount;
+    }
+    if (void* ptr = std::malloc(size != 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace ya
+{
+
+namespace
+{
+
+using render_graph_test::TestBuffer;
+
+class ScopedAllocationCounter
+{
+  public:
+    ScopedAllocationCounter()
+    {
+        gAllocationCount   = 0;
+        gbCountAllocations = true;
+    }
+    ~ScopedAllocationCounter() { gbCountAllocations = false; }
+
+    [[nodiscard]] uint64_t count() const { return gAllocationCount; }
+};
+
+constexpr Extent2D kViewportExtent{.width = 1280, .height = 720};
+
+AttachmentDescription makeAttachment(EFormat::T format, EImageUsage::T usage)
+{
+    return AttachmentDescription{
+        .format      = format,
+        .samples     = ESampleCount::Sample_1,
+        .loadOp      = EAttachmentLoadOp::Clear,
+        .storeOp     = EAttachmentStoreOp::Store,
+        .finalLayout = EImageLayout::ShaderReadOnlyOptimal,
+        .usage       = usage,
+    };
+}
+
+std::shared_ptr<IBuffer> makeHostBuffer(const char* label, uint32_t size)
+{
+    return std::make_shared<TestBuffer>(BufferCreateInfo{.label = label, .size = size});
+}
+
+FrameUploadArena::Allocation makeSlice(const std::shared_ptr<IBuffer>& buffer, uint64_t offset, uint64_t size)
+{
+    return FrameUploadArena::Allocation{.buffer = buffer, .offset = offset, .size = size};
+}
+
+/**
+ * The real DeferredFrameGraphOrchestrator over stages that were never
+ * init()ed. Passes that need GPU objects while being declared (shadow, SSAO,
+ * bloom, post-processing) drop out; G-buffer, lighting, forward, skybox,
+ * entity-id and overlay are declared exactly as in a running frame.
+ */
+struct DeferredPipelineFrame
+{
+    GBufferStage                       gBufferStage;
+    LightStage                         lightStage;
+    ViewportOverlayStage               overlayStage;
+    PostProcessingStage                postProcessStage;
+    EntityIdViewportPass               entityIdPass;
+    ViewportOverlayStage::FrameInputs  overlayInputs;
+    DeferredFrameResourceSet::Binding  binding;
+    RenderTargetCreateInfo             gBufferRTSpec;
+    RenderTargetCreateInfo             viewportRTSpec;
+    RenderStageContext                 stageCtx{.viewportExtent = kViewportExtent};
+    FrameContext                       postContext{};
+    DeferredFrameGraphOrchestrator     orchestrator;
+
+    DeferredPipelineFrame()
+    {
+        constexpr auto kColorSampled = EImageUsage::ColorAttachment | EImageUsage::Sampled;
+
+        const auto uniforms    = makeHostBuffer("Deferred.FrameUploadArena", 64 * 1024);
+        binding.frame          = makeSlice(uniforms, 0, 1024);
+        binding.light          = makeSlice(uniforms, 1024, 4096);
+        binding.skyboxFrame    = makeSlice(uniforms, 8192, 256);
+        binding.instances      = makeSlice(uniforms, 16384, 32768);
+        binding.skinningBuffer = makeHostBuffer("Deferred.SkinningSSBO", 64 * 1024);
+
+        gBufferRTSpec.extent                  = kViewportExtent;
+        gBufferRTSpec.attachments.colorAttach = {
+            makeAttachment(EFormat::R16G16B16A16_SFLOAT, kColorSampled),
+            makeAttachment(EFormat::R16G16B16A16_SFLOAT, kColorSampled),
+            makeAttachment(EFormat::R8G8B8A8_UNORM, kColorSampled),
+            makeAttachment(EFormat::R8G8B8A8_UNORM, kColorSampled),
+        };
+        gBufferRTSpec.attachments.depthAttach = makeAttachment(EFormat::D32_SFLOAT, EImageUsage::DepthStencilAttachment | EImageUsage::Sampled);
+
+        viewportRTSpec.extent                  = kViewportExtent;
+        viewportRTSpec.attachments.colorAttach = {
+            makeAttachment(EFormat::R8G8B8A8_UNORM, kColorSampled | EImageUsage::TransferSrc),
+        };
+    }
+
+    void declare(RenderGraph& graph)
+    {
+        DeferredFrameGraphResources graphResources{};
+        orchestrator.build(
+            DeferredFrameGraphOrchestrator::BuildDependencies{
+                .gBufferStage     = &gBufferStage,
+                .lightStage       = &lightStage,
+                .overlayStage     = &overlayStage,
+                .postProcessStage = &postProcessStage,
+                .entityIdPass     = &entityIdPass,
+            },
+            DeferredFrameGraphOrchestrator::BuildInputs{
+                .graph          = &graph,
+                .graphResources = &graphResources,
+                .stageCtx       = &stageCtx,
+                .frameBinding   = &binding,
+                .gBufferRTSpec  = &gBufferRTSpec,
+                .viewportRTSpec = &viewportRTSpec,
+                .overlayInputs  = &overlayInputs,
+                .postContext    = &postContext,
+                .viewportExtent = kViewportExtent,
+            });
+    }
+};
+
+/// The real ForwardFrameGraphOrchestrator; see DeferredPipelineFrame.
+struct ForwardPipelineFrame
+{
+    ForwardViewportStage          viewportStage;
+    PostProcessingStage           postProcessStage;
+    EntityIdViewportPass          entityIdPass;
+    RenderTargetCreateInfo        viewportRTSpec;
+    RenderStageContext            stageCtx{.viewportExtent = kViewportExtent};
+    FrameContext                  postContext{};
+    ForwardFrameGraphOrchestrator orchestrator;
+
+    ForwardPipelineFrame()
+    {
+        viewportRTSpec.extent                  = kViewportExtent;
+        viewportRTSpec.attachments.colorAttach = {
+            makeAttachment(EFormat::R16G16B16A16_SFLOAT, EImageUsage::ColorAttachment | EImageUsage::Sampled),
+        };
+        viewportRTSpec.attachments.depthAttach = makeAttachment(EFormat::D32_SFLOAT, EImageUsage::DepthStencilAttachment | EImageUsage::Sampled);
+    }
+
+    void declare(RenderGraph& graph)
+    {
+        ForwardViewportStage::PassContext passContext{.stageCtx = stageCtx};
+        orchestrator.build(
+            ForwardFrameGraphOrchestrator::BuildDependencies{
+                .viewportStage    = &viewportStage,
+                .entityIdPass     = &entityIdPass,
+                .postProcessStage = &postProcessStage,
+            },
+            ForwardFrameGraphOrchestrator::BuildInputs{
+                .graph               = &graph,
+                .stageCtx            = &stageCtx,
+                .viewportRTSpec      = &viewportRTSpec,
+                .viewportPassContext = &passContext,
+                .postContext         = &postContext,
+            });
+    }
+};
+
+struct FrameAllocationSample
+{
+    double   baselinePerFrame   = 0.0;
+    double   arenaPerFrame      = 0.0;
+    uint64_t arenaUpstreamDelta = 0;
+    size_t   arenaPeakBytes     = 0;
+    uint64_t cacheHits          = 0;
+    size_t   passCount          = 0;
+};
+
+// Mirrors the pipelines' per-frame sequence: declare, compile through the
+// cache, copy the plan out, destroy the graph. "Before" is the default
+// resource with a fresh RGCompiledGraph per frame; "after" resets the arena
+// and compiles into one retained RGCompiledGraph, as the pipelines do now.
+FrameAllocationSample measureFrameAllocations(const std::function<void(RenderGraph&)>& declareFrame)
+{
+    constexpr int kWarmupFrames   = 3;
+    constexpr int kMeasuredFrames = 64;
+
+    FrameAllocationSample sample;
+
+    {
+        RGCompileCache cache;
+        uint64_t       allocations = 0;
+        for (int frame = 0; frame < kWarmupFrames + kMeasuredFrames; ++frame) {
+            ScopedAllocationCounter counter;
+            {
+                RenderGraph graph;
+                declareFrame(graph);
+                RGCompiledGraph compiled = cache.compile(graph);
+                EXPECT_TRUE(compiled.isValid());
+                sample.passCount = graph.getPasses().size();
+            }
+            if (frame >= kWarmupFrames) {
+                allocations += counter.count();
+            }
+        }
+        sample.baselinePerFrame = static_cast<double>(allocations) / kMeasuredFrames;
+    }
+
+    {
+        RGCompileCache  cache;
+        RGFrameArena    arena;
+        RGCompiledGraph compiled;
+        uint64_t        allocations      = 0;
+        uint64_t        upstreamAtSteady = 0;
+        for (int frame = 0; frame < kWarmupFrames + kMeasuredFrames; ++frame) {
+            if (frame == kWarmupFrames) {
+                upstreamAtSteady = arena.getStats().upstreamAllocationCount;
+            }
+            ScopedAllocationCounter counter;
+            arena.reset();
+            {
+                RenderGraph graph(&arena);
+                declareFrame(graph);
+                compiled = cache.compile(graph);
+                EXPECT_TRUE(compiled.isValid());
+            }
+            if (frame >= kWarmupFrames) {
+                allocations += counter.count();
+            }
+        }
+        sample.arenaPerFrame      = static_cast<double>(allocations) / kMeasuredFrames;
+        sample.arenaUpstreamDelta = arena.getStats().upstreamAllocationCount - upstreamAtSteady;
+        sample.arenaPeakBytes     = arena.getStats().peakBytesUsed;
+        sample.cacheHits          = cache.getStats().hitCount;
+    }
+
+    return sample;
+}
+
+void reportFrameAllocations(const char* pipeline, const FrameAllocationSample& sample)
+{
+    std::printf("[RenderGraphFrameArena] %s (%zu passes): heap allocations per frame before %.1f, after %.1f "
+                "(arena peak %zu bytes, %llu cache hits)\n",
+                pipeline,
+                sample.passCount,
+                sample.baselinePerFrame,
+                sample.arenaPerFrame,
+                sample.arenaPeakBytes,
+                static_cast<unsigned long long>(sample.cacheHits));
+}
+
+} // namespace
+
+TEST(RenderGraphFrameArenaBenchmark, DeferredPipelineAllocationsPerFrame)
+{
+    DeferredPipelineFrame frame;
+    const auto            sample = measureFrameAllocations([&frame](RenderGraph& graph) { frame.declare(graph); });
+    reportFrameAllocations("deferred", sample);
+
+    EXPECT_GT(sample.cacheHits, 0u);
+    EXPECT_LT(sample.arenaPerFrame, sample.baselinePerFrame);
+    EXPECT_EQ(sample.arenaUpstreamDelta, 0u);
+}
+
+TEST(RenderGraphFrameArenaBenchmark, ForwardPipelineAllocationsPerFrame)
+{
+    ForwardPipelineFrame frame;
+    const auto           sample = measureFrameAllocations([&frame](RenderGraph& graph) { frame.declare(graph); });
+    reportFrameAllocations("forward", sample);
+
+    EXPECT_GT(sample.cacheHits, 0u);
+    EXPECT_LT(sample.arenaPerFrame, sample.baselinePerFrame);
+    EXPECT_EQ(sample.arenaUpstreamDelta, 0u);
+}
+
+} // namespace ya
@@ -0,0 +1,84 @@
+#include "Core/Async/JobSystem.h"
+#include "Graph/RenderGraph.h"
+#include "Graph/RenderGraphCommandStream.h"
+#include "Graph/RenderGraphExecutor.h"
+
+#include "JobSystemTestScope.h"
+#include "RenderGraphTestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ya
+{
+
+using namespace render_graph_test;
+
+// Serial recording vs workers recording into secondaries vs replayed streams.
+TEST(RenderGraphParallelRecordingBenchmark, RecordDrawHeavyPasses)
+{
+    JobSystemTestScope jobs;
+
+    constexpr uint32_t kDrawCount = 4000;
+    ParallelTestFrame  frame(kDrawCount, nullptr, 256);
+    ASSERT_TRUE(frame.graph.compile().isValid());
+
+    enum class EMode
+    {
+        Serial,
+        Secondaries,
+        Streams,
+    };
+    auto measure = [&](EMode mode) {
+        TestResourceFactory  factory;
+        RenderGraphExecutor  executor(factory);
+        LoggingSecondaryPool secondaries;
+        executor.setParallelRecording(mode != EMode::Serial);
+        if (mode == EMode::Secondaries) {
+            executor.setSecondaryCommandBufferProvider([&secondaries]() { return secondaries.acquire(); });
+        }
+
+        LoggingCommandBuffer warmup;
+        (void)executor.execute(frame.graph, warmup);
+
+        using Clock         = std::chrono::steady_clock;
+        constexpr int kRuns = 5;
+        double        best  = 1e30;
+        size_t        commands = 0;
+        for (int run = 0; run < kRuns; ++run) {
+            LoggingCommandBuffer cmdBuf;
+            cmdBuf.log.reserve(warmup.log.size());
+            const auto start = Clock::now();
+            EXPECT_TRUE(executor.execute(frame.graph, cmdBuf));
+            best     = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            commands = cmdBuf.log.size();
+        }
+        return std::pair{best, commands};
+    };
+
+    const auto [serialMs, serialCommands]       = measure(EMode::Serial);
+    const auto [secondaryMs, secondaryCommands] = measure(EMode::Secondaries);
+    const auto [streamMs, streamCommands]       = measure(EMode::Streams);
+    EXPECT_EQ(serialCommands, secondaryCommands);
+    EXPECT_EQ(serialCommands, streamCommands);
+
+    std::printf("[RenderGraphParallelRecording] %u passes x %u draws, %u workers: serial %.3f ms, "
+                "secondaries %.3f ms (x%.2f), streams %.3f ms (x%.2f)\n",
+                ParallelTestFrame::kParallelPassCount,
+                kDrawCount,
+                JobSystem::get().getWorkerCount(),
+                serialMs,
+                secondaryMs,
+                secondaryMs > 0.0 ? serialMs / secondaryMs : 0.0,
+                streamMs,
+                streamMs > 0.0 ? serialMs / streamMs : 0.0);
+}
+
+} // namespace ya
@@ -0,0 +1,169 @@
+#include "RHI/Core/Image.h"
+#include "RHI/Core/ResourceStateTracker.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+class TestImage final : public IImage
+{
+  private:
+    EImageLayout::T _compatibilityLayout;
+    uint32_t        _mipLevels;
+    uint32_t        _arrayLayers;
+    std::unordered_map<uint64_t, EImageLayout::T> _subresourceLayouts;
+
+    static uint64_t makeSubresourceKey(uint32_t aspect, uint32_t mip, uint32_t layer)
+    {
+        return (static_cast<uint64_t>(aspect) << 42u) |
+               (static_cast<uint64_t>(mip) << 21u) |
+               static_cast<uint64_t>(layer);
+    }
+
+  public:
+    TestImage(EImageLayout::T layout, uint32_t mipLevels, uint32_t arrayLayers)
+        : _compatibilityLayout(layout), _mipLevels(mipLevels), _arrayLayers(arrayLayers)
+    {}
+
+    ImageHandle getHandle() const override { return {}; }
+    uint32_t getWidth() const override { return 64; }
+    uint32_t getHeight() const override { return 64; }
+    EFormat::T getFormat() const override { return EFormat::R8G8B8A8_UNORM; }
+    uint32_t getMipLevels() const override { return _mipLevels; }
+    uint32_t getArrayLayers() const override { return _arrayLayers; }
+    EImageUsage::T getUsage() const override { return EImageUsage::Sampled; }
+    EImageLayout::T getCompatibilityLayout() const override { return _compatibilityLayout; }
+    EImageLayout::T getCompatibilityLayout(uint32_t aspect, uint32_t mip, uint32_t layer) const override
+    {
+        if (const auto it = _subresourceLayouts.find(makeSubresourceKey(aspect, mip, layer)); it != _subresourceLayouts.end()) {
+            return it->second;
+        }
+        return _compatibilityLayout;
+    }
+    void setDebugName(const std::string&) override {}
+    void setCompatibilityLayout(EImageLayout::T layout) { _compatibilityLayout = layout; }
+    void setCompatibilityLayout(uint32_t aspect, uint32_t mip, uint32_t layer, EImageLayout::T layout)
+    {
+        _subresourceLayouts[makeSubresourceKey(aspect, mip, layer)] = layout;
+    }
+};
+
+ImageSubresourceRange mipRange(uint32_t mip, uint32_t layerCount)
+{
+    return ImageSubresourceRange{
+        .aspectMask     = EImageAspect::Color,
+        .baseMipLevel   = mip,
+        .levelCount     = 1,
+        .baseArrayLayer = 0,
+        .layerCount     = layerCount,
+    };
+}
+
+ImageSubresourceRange layerRange(uint32_t layer)
+{
+    return ImageSubresourceRange{
+        .aspectMask     = EImageAspect::Color,
+        .baseMipLevel   = 0,
+        .levelCount     = 1,
+        .baseArrayLayer = layer,
+        .layerCount     = 1,
+    };
+}
+
+/// Blit-style mip generation: every mip starts as TransferDst and is moved to
+/// TransferSrc once the next level has been written from it.
+size_t generateMips(ResourceStateTracker& tracker, IImage& image)
+{
+    size_t barriers = tracker.transition(image, EImageLayout::TransferDst).size();
+    for (uint32_t mip = 1; mip < image.getMipLevels(); ++mip) {
+        const auto source = mipRange(mip - 1, image.getArrayLayers());
+        barriers += tracker.transition(image, EImageLayout::TransferSrc, &source).size();
+    }
+    return barriers;
+}
+
+/// Render every layer of an array separately, then sample each one.
+size_t renderLayers(ResourceStateTracker& tracker, IImage& image)
+{
+    size_t barriers = 0;
+    for (uint32_t layer = 0; layer < image.getArrayLayers(); ++layer) {
+        const auto range = layerRange(layer);
+        barriers += tracker.transition(image, EImageLayout::ColorAttachmentOptimal, &range).size();
+        barriers += tracker.transition(image, EImageLayout::ShaderReadOnlyOptimal, &range).size();
+    }
+    return barriers;
+}
+
+} // namespace
+
+// Cubemap mip generation and per-layer array writes over reseeded frames.
+TEST(ResourceStateTrackerBenchmark, CubemapMipChainsAndLayerArrays)
+{
+    constexpr uint32_t kCubemapCount = 64;
+    constexpr uint32_t kArrayCount   = 4;
+    constexpr int      kFrames       = 20;
+
+    std::vector<std::unique_ptr<TestImage>> cubemaps;
+    std::vector<std::unique_ptr<TestImage>> arrays;
+    for (uint32_t index = 0; index < kCubemapCount; ++index) {
+        cubemaps.push_back(std::make_unique<TestImage>(EImageLayout::ShaderReadOnlyOptimal, 12, 6));
+    }
+    for (uint32_t index = 0; index < kArrayCount; ++index) {
+        arrays.push_back(std::make_unique<TestImage>(EImageLayout::ShaderReadOnlyOptimal, 1, 256));
+    }
+
+    using Clock = std::chrono::steady_clock;
+    ResourceStateTracker tracker;
+    double               bestCubeMs  = 1e30;
+    double               bestArrayMs = 1e30;
+    size_t               cubeBarriers  = 0;
+    size_t               arrayBarriers = 0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        // Command buffers reset their tracker on begin, so every frame reseeds.
+        tracker.reset();
+        cubeBarriers  = 0;
+        arrayBarriers = 0;
+
+        const auto cubeStart = Clock::now();
+        for (const auto& cubemap : cubemaps) {
+            cubeBarriers += generateMips(tracker, *cubemap);
+            cubeBarriers += tracker.transition(*cubemap, EImageLayout::ShaderReadOnlyOptimal).size();
+        }
+        const auto arrayStart = Clock::now();
+        for (const auto& array : arrays) {
+            arrayBarriers += renderLayers(tracker, *array);
+            EXPECT_TRUE(tracker.validateLayout(*array, EImageLayout::ShaderReadOnlyOptimal).empty());
+            arrayBarriers += tracker.transition(*array, EImageLayout::TransferSrc).size();
+        }
+        const auto end = Clock::now();
+        bestCubeMs     = std::min(bestCubeMs, std::chrono::duration<double, std::milli>(arrayStart - cubeStart).count());
+        bestArrayMs    = std::min(bestArrayMs, std::chrono::duration<double, std::milli>(end - arrayStart).count());
+    }
+
+    // Per cubemap: 12 generation barriers + 2 merged final barriers.
+    EXPECT_EQ(cubeBarriers, kCubemapCount * 14u);
+    // Per array: two per layer + one whole-image barrier.
+    EXPECT_EQ(arrayBarriers, kArrayCount * (2u * 256u + 1u));
+
+    std::printf("[ResourceStateTracker] %u x 6-face 12-mip cubemaps: %.3f ms (%zu barriers); "
+                "%u x 256-layer arrays: %.3f ms (%zu barriers)\n",
+                kCubemapCount,
+                bestCubeMs,
+                cubeBarriers,
+                kArrayCount,
+                bestArrayMs,
+                arrayBarriers);
+}
+
+} // namespace ya
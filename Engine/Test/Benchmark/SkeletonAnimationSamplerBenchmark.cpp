@@ -0,0 +1,152 @@
+#include "Resource/Core/SkeletonAnimationSampler.h"
+
+#include <gtest/gtest.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+bool nearMat4(const glm::mat4& lhs, const glm::mat4& rhs, float epsilon)
+{
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            if (std::fabs(lhs[col][row] - rhs[col][row]) > epsilon) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// Chain of @p boneCount nodes, one bone each, and a looping walk-like clip
+/// keyed at 30 Hz: every joint swings on its own axis, the root also moves.
+void buildWalkCycle(uint32_t boneCount, double seconds, ya::Skeleton& skeleton, ya::SkeletonAnimationClip& clip)
+{
+    constexpr double TICKS_PER_SECOND = 30.0;
+
+    skeleton = {};
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        skeleton.nodes.push_back(ya::SkeletonNodeInfo{
+            .name           = "bone" + std::to_string(index),
+            .parentIndex    = index == 0 ? ya::INVALID_SKELETON_NODE_INDEX : index - 1,
+            .localTransform = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.25f, 0.0f)),
+        });
+        skeleton.bones.push_back(ya::SkeletonBoneInfo{
+            .name      = "bone" + std::to_string(index),
+            .id        = index,
+            .nodeIndex = index,
+        });
+    }
+
+    clip                = {};
+    clip.name           = "walk";
+    clip.ticksPerSecond = TICKS_PER_SECOND;
+    clip.duration       = seconds * TICKS_PER_SECOND;
+    const auto keyCount = static_cast<uint32_t>(clip.duration) + 1;
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        ya::SkeletonAnimationChannel channel{
+            .targetName = skeleton.nodes[index].name,
+            .nodeIndex  = index,
+            .boneIndex  = index,
+        };
+        const glm::vec3 axis  = glm::normalize(glm::vec3(std::sin(index * 1.3f), 1.0f, std::cos(index * 0.7f)));
+        const float     phase = static_cast<float>(index) * 0.4f;
+        for (uint32_t key = 0; key < keyCount; ++key) {
+            const double time  = static_cast<double>(key);
+            const float  cycle = static_cast<float>(time / TICKS_PER_SECOND) * 2.0f * 3.14159265f;
+            channel.rotationKeys.push_back({.time = time, .value = glm::angleAxis(0.6f * std::sin(cycle + phase), axis)});
+            if (index == 0) {
+                channel.positionKeys.push_back({
+                    .time  = time,
+                    .value = glm::vec3(0.0f, 1.0f + 0.05f * std::sin(2.0f * cycle), static_cast<float>(time) * 0.05f),
+                });
+            }
+            else {
+                channel.positionKeys.push_back({.time = time, .value = glm::vec3(0.0f, 0.25f, 0.0f)});
+            }
+            channel.scaleKeys.push_back({.time = time, .value = glm::vec3(1.0f)});
+        }
+        clip.channels.push_back(std::move(channel));
+    }
+}
+
+} // namespace
+
+// Clip memory and per-track sample rate, source vs compressed+cursor.
+TEST(SkeletonAnimationSamplerBenchmark, CompressedClipMemoryAndSampleRate)
+{
+    constexpr uint32_t BONE_COUNT    = 64;
+    constexpr double   CLIP_SECONDS  = 10.0;
+    constexpr int      POSE_COUNT    = 2000;
+    constexpr double   FRAME_SECONDS = 1.0 / 60.0;
+
+    ya::Skeleton              skeleton;
+    ya::SkeletonAnimationClip clip;
+    buildWalkCycle(BONE_COUNT, CLIP_SECONDS, skeleton, clip);
+    const ya::CompressedSkeletonClip compressed = ya::compressAnimationClip(skeleton, clip);
+
+    const size_t sourceBytes     = ya::getAnimationClipMemoryUsage(clip);
+    const size_t compressedBytes = compressed.getMemoryUsage();
+    EXPECT_LT(compressedBytes * 4, sourceBytes);
+
+    using Clock = std::chrono::steady_clock;
+    ya::SkeletonPose sourcePose;
+    ya::SkeletonPose compressedPose;
+    const double     frameTicks = FRAME_SECONDS * clip.ticksPerSecond;
+
+    // Compare the local-pose sampling work the two formats differ in.
+    std::vector<ya::SkeletonChannelSample> samples(BONE_COUNT);
+    const auto                             sourceStart = Clock::now();
+    for (int pose = 0; pose < POSE_COUNT; ++pose) {
+        const double time = ya::SkeletonAnimationSampler::wrapTime(pose * frameTicks, clip.duration);
+        for (uint32_t track = 0; track < BONE_COUNT; ++track) {
+            samples[track] = ya::SkeletonAnimationSampler::sampleChannel(clip.channels[track], time, &skeleton.nodes[track]);
+        }
+    }
+    const auto               compressedStart = Clock::now();
+    ya::CompressedClipCursor cursor;
+    for (int pose = 0; pose < POSE_COUNT; ++pose) {
+        ya::SkeletonAnimationSampler::sampleTracks(compressed, pose * frameTicks, true, cursor, samples);
+    }
+    const auto end = Clock::now();
+
+    const double sourceSeconds     = std::chrono::duration<double>(compressedStart - sourceStart).count();
+    const double compressedSeconds = std::chrono::duration<double>(end - compressedStart).count();
+    const double trackSamples      = static_cast<double>(POSE_COUNT) * BONE_COUNT;
+
+    // Full poses (hierarchy + skinning matrices) for reference.
+    const auto poseStart = Clock::now();
+    for (int pose = 0; pose < POSE_COUNT; ++pose) {
+        ya::SkeletonAnimationSampler::samplePose(skeleton, clip, pose * frameTicks, true, sourcePose);
+    }
+    const auto compressedPoseStart = Clock::now();
+    for (int pose = 0; pose < POSE_COUNT; ++pose) {
+        ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, pose * frameTicks, true, cursor, compressedPose);
+    }
+    const auto poseEnd = Clock::now();
+    for (uint32_t bone = 0; bone < BONE_COUNT; ++bone) {
+        EXPECT_TRUE(nearMat4(sourcePose.boneMatrices[bone], compressedPose.boneMatrices[bone], 5e-3f)) << bone;
+    }
+
+    std::printf("[AnimationClip] %u tracks x %.0f s: source %.1f KiB, compressed %.1f KiB (x%.1f smaller)\n"
+                "[AnimationClip] track samples/s: source %.2f M, compressed+cursor %.2f M (x%.2f); "
+                "full poses/s: source %.0f, compressed %.0f\n",
+                BONE_COUNT,
+                CLIP_SECONDS,
+                static_cast<double>(sourceBytes) / 1024.0,
+                static_cast<double>(compressedBytes) / 1024.0,
+                static_cast<double>(sourceBytes) / static_cast<double>(compressedBytes),
+                trackSamples / sourceSeconds * 1e-6,
+                trackSamples / compressedSeconds * 1e-6,
+                sourceSeconds / compressedSeconds,
+                POSE_COUNT / std::chrono::duration<double>(compressedPoseStart - poseStart).count(),
+                POSE_COUNT / std::chrono::duration<double>(poseEnd - compressedPoseStart).count());
+}
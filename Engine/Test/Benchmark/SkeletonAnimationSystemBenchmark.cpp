@@ -0,0 +1,183 @@
+#include "Core/Async/JobSystem.h"
+#include "ECS/Entity.h"
+#include "ECS/Systems/AnimationSystem.h"
+#include "ECS/Systems/SkeletonAnimatorComponent.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "Scene/Core/Scene.h"
+#include "Scene3D/TransformComponent.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+/// Bone chain with one looping clip that rotates every joint, compressed the
+/// way createSkeleton does it.
+std::shared_ptr<Skeleton> makeAnimatedSkeleton(uint32_t boneCount)
+{
+    auto skeleton = std::make_shared<Skeleton>();
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        skeleton->nodes.push_back(SkeletonNodeInfo{
+            .name           = "bone" + std::to_string(index),
+            .parentIndex    = index == 0 ? INVALID_SKELETON_NODE_INDEX : index - 1,
+            .localTransform = glm::mat4(1.0f),
+        });
+        skeleton->bones.push_back(SkeletonBoneInfo{.name = "bone" + std::to_string(index), .id = index, .nodeIndex = index});
+    }
+
+    SkeletonAnimationClip clip{.name = "Walk", .duration = 60.0, .ticksPerSecond = 30.0};
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        SkeletonAnimationChannel channel{.targetName = skeleton->nodes[index].name, .nodeIndex = index, .boneIndex = index};
+        for (uint32_t key = 0; key <= 60; ++key) {
+            const float angle = 0.5f * std::sin(static_cast<float>(key + index) * 0.2f);
+            channel.rotationKeys.push_back({.time = static_cast<double>(key), .value = glm::angleAxis(angle, glm::vec3(0.0f, 0.0f, 1.0f))});
+            channel.positionKeys.push_back({.time = static_cast<double>(key), .value = glm::vec3(0.0f, 0.1f, 0.0f)});
+        }
+        clip.channels.push_back(std::move(channel));
+    }
+    skeleton->animations.push_back(std::move(clip));
+    skeleton->compressedAnimations.push_back(compressAnimationClip(*skeleton, skeleton->animations[0]));
+    return skeleton;
+}
+
+std::vector<SkeletonAnimatorComponent*> spawnCrowd(Scene& scene, const std::shared_ptr<Skeleton>& skeleton, uint32_t count)
+{
+    std::vector<SkeletonAnimatorComponent*> animators;
+    for (uint32_t index = 0; index < count; ++index) {
+        auto* animator = scene.createEntity("Character")->addComponent<SkeletonAnimatorComponent>();
+        animator->setFromModel("Content/Models/Character.fbx", 0, 0, skeleton);
+        animator->_speed = 0.5f + 0.01f * static_cast<float>(index);
+        animators.push_back(animator);
+    }
+    return animators;
+}
+
+SkeletonAnimationSystem makeAnimationSystem(Scene& scene, bool bParallel)
+{
+    SkeletonAnimationSystem system;
+    system.setSceneProvider([&scene]() { return &scene; });
+    system.setParallelUpdate(bParallel);
+    return system;
+}
+
+SkeletonAnimatorComponent* spawnCharacterAt(Scene& scene, const std::shared_ptr<Skeleton>& skeleton, const glm::vec3& position)
+{
+    Entity* entity = scene.createEntity("Character");
+    TransformSystem::setWorldPosition(entity->getComponent<TransformComponent>(), position);
+    auto* animator = entity->addComponent<SkeletonAnimatorComponent>();
+    animator->setFromModel("Content/Models/Character.fbx", 0, 0, skeleton);
+    return animator;
+}
+
+/// Camera at the origin looking down -Z, 1080 pixels high: a 2 m character
+/// is 200 pixels tall about 10 m away.
+SkeletonAnimationSystem::LodView makeLodView()
+{
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return SkeletonAnimationSystem::LodView{
+        .cameraPosition = glm::vec3(0.0f),
+        .viewProjection = projection * view,
+        .pixelScale     = 0.5f * 1080.0f * std::abs(projection[1][1]),
+    };
+}
+
+} // namespace
+
+// Serial vs batched+jobs update of a skinned crowd.
+TEST(SkeletonAnimationSystemBenchmark, Crowd)
+{
+    constexpr int kFrames = 30;
+
+    JobSystemTestScope jobScope;
+    auto&              jobs = JobSystem::get();
+
+    const auto skeleton = makeAnimatedSkeleton(64);
+    Scene      scene("AnimationCrowd");
+    spawnCrowd(scene, skeleton, 300);
+
+    auto measure = [&](bool bParallel) {
+        auto system = makeAnimationSystem(scene, bParallel);
+        system.onUpdate(0.0f); // Size poses, settle
+
+        using Clock      = std::chrono::steady_clock;
+        const auto begin = Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            system.onUpdate(1.0f / 60.0f);
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - begin).count() / kFrames;
+    };
+
+    const double serialMs   = measure(false);
+    const double parallelMs = measure(true);
+    std::printf("[SkeletonAnimationSystem] animators=300 bones=64 threads=%u serial=%.2f ms batched+jobs=%.2f ms\n",
+                jobs.getConcurrency(),
+                serialMs,
+                parallelMs);
+}
+
+// Full-rate vs LOD-throttled update of a large crowd around the camera.
+TEST(SkeletonAnimationSystemBenchmark, LodCrowd)
+{
+    constexpr int kFrames = 30;
+
+    // 2000 characters on a grid in front of and behind the camera.
+    const auto skeleton = makeAnimatedSkeleton(64);
+    Scene      scene("AnimationLodCrowd");
+    for (int index = 0; index < 2000; ++index) {
+        const float x = static_cast<float>(index % 40) * 3.0f - 60.0f;
+        const float z = static_cast<float>(index / 40) * 3.0f - 30.0f;
+        spawnCharacterAt(scene, skeleton, {x, 0.0f, -z})->_speed = 0.5f + 0.001f * static_cast<float>(index);
+    }
+
+    auto measure = [&](bool bLod) {
+        auto system = makeAnimationSystem(scene, false);
+        if (bLod) {
+            system.setLodViewProvider([](SkeletonAnimationSystem::LodView& view) {
+                view = makeLodView();
+                return true;
+            });
+        }
+        system.onUpdate(0.0f);
+
+        using Clock      = std::chrono::steady_clock;
+        const auto begin = Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            system.onUpdate(1.0f / 60.0f);
+        }
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - begin).count() / kFrames;
+        return std::make_pair(ms, system.getStats());
+    };
+
+    const auto [fullMs, fullStats] = measure(false);
+    const auto [lodMs, lodStats]   = measure(true);
+    std::printf("[SkeletonAnimationSystem] animators=2000 bones=64 serial full=%.2f ms lod=%.2f ms "
+                "(sampled=%u interpolated=%u reduced=%u distant=%u suspended=%u)\n",
+                fullMs,
+                lodMs,
+                lodStats.sampledCount,
+                lodStats.interpolatedCount,
+                lodStats.reducedCount,
+                lodStats.distantCount,
+                lodStats.suspendedCount);
+    EXPECT_EQ(fullStats.sampledCount, 2000u);
+    EXPECT_LT(lodStats.sampledCount, fullStats.sampledCount);
+}
+
+} // namespace ya
@@ -0,0 +1,166 @@
+#include "Core/Async/JobSystem.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "Scene/Core/Scene.h"
+#include "Scene3D/Node3D.h"
+#include "Scene3D/TransformComponent.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+/**
+ * Node layout of a large imported glTF: skinned characters (deep bone
+ * chains with limbs) plus architecture (shallow groups with many leaves).
+ */
+struct ImportedHierarchy
+{
+    std::vector<Node3D*> characterRoots;
+    std::vector<Node3D*> nodes;
+};
+
+ImportedHierarchy buildImportedHierarchy(Scene& scene, uint32_t characters, uint32_t buildings, uint32_t seed)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> angle(-30.0f, 30.0f);
+
+    ImportedHierarchy hierarchy;
+    auto addNode = [&](const char* name, Node* parent) {
+        Node3D* node = scene.createNode3D(name, parent);
+        auto*   tc   = node->getTransformComponent();
+        tc->setPosition({offset(rng), offset(rng), offset(rng)});
+        tc->setRotation({angle(rng), angle(rng), angle(rng)});
+        hierarchy.nodes.push_back(node);
+        return node;
+    };
+
+    // ~30-deep spine with four 12-bone limbs and fingers on the hands.
+    for (uint32_t c = 0; c < characters; ++c) {
+        Node3D* root = addNode("Armature", nullptr);
+        hierarchy.characterRoots.push_back(root);
+        Node* spine = root;
+        for (int bone = 0; bone < 30; ++bone) {
+            spine = addNode("Spine", spine);
+            if (bone == 20 || bone == 10) {
+                for (int limb = 0; limb < 2; ++limb) {
+                    Node* segment = spine;
+                    for (int s = 0; s < 12; ++s) {
+                        segment = addNode("Limb", segment);
+                    }
+                    for (int finger = 0; finger < 5; ++finger) {
+                        Node* joint = segment;
+                        for (int s = 0; s < 3; ++s) {
+                            joint = addNode("Finger", joint);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Buildings: floors of props under one group each.
+    for (uint32_t b = 0; b < buildings; ++b) {
+        Node3D* building = addNode("Building", nullptr);
+        for (int floor = 0; floor < 8; ++floor) {
+            Node3D* level = addNode("Floor", building);
+            for (int prop = 0; prop < 24; ++prop) {
+                addNode("Prop", level);
+            }
+        }
+    }
+    return hierarchy;
+}
+
+std::vector<glm::mat4> snapshotWorld(const ImportedHierarchy& hierarchy)
+{
+    std::vector<glm::mat4> world;
+    world.reserve(hierarchy.nodes.size());
+    for (Node3D* node : hierarchy.nodes) {
+        world.push_back(node->getTransformComponent()->getWorldMatrix());
+    }
+    return world;
+}
+
+void markAllDirty(const ImportedHierarchy& hierarchy)
+{
+    for (Node3D* node : hierarchy.nodes) {
+        node->getTransformComponent()->markDirty();
+    }
+}
+
+void expectNearMatrices(const std::vector<glm::mat4>& a, const std::vector<glm::mat4>& b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                ASSERT_NEAR(a[i][c][r], b[i][c][r], 1e-3f) << "node " << i;
+            }
+        }
+    }
+}
+
+TransformSystem makeSystem(Scene& scene, TransformSystem::EUpdateMode mode)
+{
+    TransformSystem system;
+    system.setSceneProvider([&scene]() { return &scene; });
+    system.setUpdateMode(mode);
+    return system;
+}
+
+} // namespace
+
+// ~50k nodes, every character root animated each frame.
+TEST(TransformSystemBenchmark, DeepHierarchy)
+{
+    constexpr int kFrames = 20;
+
+    Scene      scene("TransformBenchmark");
+    const auto hierarchy = buildImportedHierarchy(scene, 180, 125, 3);
+
+    JobSystemTestScope jobScope;
+    auto&              jobs = JobSystem::get();
+
+    auto measure = [&](TransformSystem::EUpdateMode mode, bool bParallel) {
+        auto system = makeSystem(scene, mode);
+        system.setParallelUpdate(bParallel);
+        markAllDirty(hierarchy);
+        system.onUpdate(0.0f); // Build arrays, settle
+
+        using Clock      = std::chrono::steady_clock;
+        const auto begin = Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (Node3D* root : hierarchy.characterRoots) {
+                root->getTransformComponent()->setRotation({0.0f, static_cast<float>(frame), 0.0f});
+            }
+            system.onUpdate(1.0f / 60.0f);
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - begin).count() / kFrames;
+    };
+
+    const double recursiveMs = measure(TransformSystem::EUpdateMode::Recursive, false);
+    const auto   expected    = snapshotWorld(hierarchy);
+    const double serialMs    = measure(TransformSystem::EUpdateMode::Flattened, false);
+    const double parallelMs  = measure(TransformSystem::EUpdateMode::Flattened, true);
+    expectNearMatrices(snapshotWorld(hierarchy), expected);
+
+    std::printf("[TransformSystem] nodes=%zu threads=%u recursive=%.2f ms flattened=%.2f ms flattened+jobs=%.2f ms\n",
+                hierarchy.nodes.size(),
+                jobs.getConcurrency(),
+                recursiveMs,
+                serialMs,
+                parallelMs);
+}
+
+} // namespace ya
@@ -0,0 +1,313 @@
+#include "Resource/Core/AnimationPoseGraph.h"
+
+#include <gtest/gtest.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr float  EPSILON          = 1e-4f;
+constexpr double TICKS_PER_SECOND = 30.0;
+
+enum ClipIndex : uint32_t
+{
+    IDLE_CLIP,
+    RUN_CLIP,
+    SLOW_RUN_CLIP,
+    LEAN_CLIP,
+};
+
+bool nearMat4(const glm::mat4& lhs, const glm::mat4& rhs, float epsilon = EPSILON)
+{
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            if (std::fabs(lhs[col][row] - rhs[col][row]) > epsilon) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+glm::quat rotationZ(float degrees)
+{
+    return glm::angleAxis(glm::radians(degrees), glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+glm::mat4 trs(const glm::vec3& position, const glm::quat& rotation)
+{
+    return ya::SkeletonAnimationSampler::composeTransform({.position = position, .rotation = rotation, .scale = glm::vec3(1.0f)});
+}
+
+/// Every node rotates about Z from @p fromDegrees to @p toDegrees; the root also moves along X.
+ya::SkeletonAnimationClip makeClip(const ya::Skeleton& skeleton, double seconds, float fromDegrees, float toDegrees, float rootX)
+{
+    ya::SkeletonAnimationClip clip;
+    clip.ticksPerSecond = TICKS_PER_SECOND;
+    clip.duration       = seconds * TICKS_PER_SECOND;
+    for (uint32_t index = 0; index < skeleton.nodes.size(); ++index) {
+        ya::SkeletonAnimationChannel channel{
+            .targetName = skeleton.nodes[index].name,
+            .nodeIndex  = index,
+            .boneIndex  = index,
+        };
+        const glm::vec3 position = index == 0 ? glm::vec3(rootX, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        channel.positionKeys     = {{.time = 0.0, .value = position}, {.time = clip.duration, .value = position}};
+        channel.rotationKeys     = {{.time = 0.0, .value = rotationZ(fromDegrees)}, {.time = clip.duration, .value = rotationZ(toDegrees)}};
+        clip.channels.push_back(std::move(channel));
+    }
+    return clip;
+}
+
+/// root -> spine -> arm, one bone per node, with the clips of ClipIndex.
+ya::Skeleton makeSkeleton()
+{
+    ya::Skeleton skeleton;
+    const char*  names[] = {"root", "spine", "arm"};
+    for (uint32_t index = 0; index < 3; ++index) {
+        skeleton.nodes.push_back(ya::SkeletonNodeInfo{
+            .name           = names[index],
+            .parentIndex    = index == 0 ? ya::INVALID_SKELETON_NODE_INDEX : index - 1,
+            .localTransform = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+        });
+        skeleton.bones.push_back(ya::SkeletonBoneInfo{.name = names[index], .id = index, .nodeIndex = index});
+    }
+
+    skeleton.animations.push_back(makeClip(skeleton, 1.0, 0.0f, 0.0f, 0.0f));   // IDLE_CLIP
+    skeleton.animations.push_back(makeClip(skeleton, 1.0, 90.0f, 90.0f, 2.0f));  // RUN_CLIP
+    skeleton.animations.push_back(makeClip(skeleton, 2.0, 0.0f, 60.0f, 0.0f));   // SLOW_RUN_CLIP
+    skeleton.animations.push_back(makeClip(skeleton, 1.0, 0.0f, 30.0f, 0.0f));   // LEAN_CLIP
+    return skeleton;
+}
+
+/// One frame of the three evaluation steps for a single instance.
+void evaluateFrame(const ya::Skeleton&          skeleton,
+                   ya::AnimationGraphInstance& instance,
+                   ya::AnimationPoseCache&      cache,
+                   float                        deltaSeconds,
+                   ya::SkeletonPose&            outPose)
+{
+    cache.beginFrame();
+    ya::AnimationPoseGraphEvaluator::advance(skeleton, instance, deltaSeconds);
+    ya::AnimationPoseGraphEvaluator::gather(skeleton, instance, cache);
+    cache.sampleAll();
+    ya::AnimationPoseGraphEvaluator::evaluate(skeleton, instance, cache, outPose);
+}
+
+} // namespace
+
+TEST(AnimationPoseGraphTest, SingleClipGraphMatchesSampledPose)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    graph.rootNode = graph.addClip(SLOW_RUN_CLIP);
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+    evaluateFrame(skeleton, instance, cache, 0.75f, pose);
+
+    const ya::SkeletonPose expected = ya::SkeletonAnimationSampler::samplePose(skeleton, skeleton.animations[SLOW_RUN_CLIP], 0.75 * TICKS_PER_SECOND);
+    ASSERT_EQ(pose.boneMatrices.size(), expected.boneMatrices.size());
+    for (size_t index = 0; index < expected.boneMatrices.size(); ++index) {
+        EXPECT_TRUE(nearMat4(pose.boneMatrices[index], expected.boneMatrices[index])) << "bone " << index;
+    }
+}
+
+TEST(AnimationPoseGraphTest, BlendSpaceBlendsBracketingSamples)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    const uint32_t         speed = graph.addParameter("speed");
+    const uint32_t         idle  = graph.addClip(IDLE_CLIP);
+    const uint32_t         run   = graph.addClip(RUN_CLIP);
+    graph.rootNode               = graph.addBlendSpace1D(speed, {{4.0f, run}, {0.0f, idle}});
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+
+    EXPECT_TRUE(instance.setParameter("speed", 2.0f));
+    evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(1.0f, 0.0f, 0.0f), rotationZ(45.0f))));
+    EXPECT_TRUE(nearMat4(pose.localTransforms[2], trs(glm::vec3(0.0f, 1.0f, 0.0f), rotationZ(45.0f))));
+
+    // Beyond the last sample plays that sample alone.
+    instance.setParameter(speed, 10.0f);
+    evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(2.0f, 0.0f, 0.0f), rotationZ(90.0f))));
+    EXPECT_EQ(instance.nodeWeights[idle], 0.0f);
+    EXPECT_EQ(cache.getStats().sampleCount, 1u);
+}
+
+TEST(AnimationPoseGraphTest, BlendSpaceKeepsSamplesOfDifferentLengthsInStep)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    const uint32_t         speed   = graph.addParameter("speed", 0.5f);
+    const uint32_t         run     = graph.addClip(RUN_CLIP);
+    const uint32_t         slowRun = graph.addClip(SLOW_RUN_CLIP);
+    graph.rootNode                 = graph.addBlendSpace1D(speed, {{0.0f, run}, {1.0f, slowRun}});
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+
+    // Blended cycle length is 1.5 s: after 0.75 s both samples are half way through.
+    evaluateFrame(skeleton, instance, cache, 0.75f, pose);
+    EXPECT_NEAR(instance.nodeTimes[graph.rootNode], 0.5, 1e-6);
+    EXPECT_NEAR(instance.nodeTimes[run], 0.5 * skeleton.animations[RUN_CLIP].duration, 1e-6);
+    EXPECT_NEAR(instance.nodeTimes[slowRun], 0.5 * skeleton.animations[SLOW_RUN_CLIP].duration, 1e-6);
+}
+
+TEST(AnimationPoseGraphTest, StateMachineCrossFadesBetweenStates)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    const uint32_t         idle = graph.addClip(IDLE_CLIP);
+    const uint32_t         run  = graph.addClip(RUN_CLIP);
+    graph.rootNode              = graph.addStateMachine({idle, run});
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+    evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(0.0f), rotationZ(0.0f))));
+
+    instance.requestState(graph.rootNode, 1, 0.5f);
+    evaluateFrame(skeleton, instance, cache, 0.25f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(1.0f, 0.0f, 0.0f), rotationZ(45.0f))));
+    EXPECT_NEAR(instance.nodeTimes[run], 0.25 * TICKS_PER_SECOND, 1e-6);
+
+    evaluateFrame(skeleton, instance, cache, 0.3f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(2.0f, 0.0f, 0.0f), rotationZ(90.0f))));
+    EXPECT_EQ(instance.machines[graph.rootNode].previous, ya::INVALID_POSE_GRAPH_INDEX);
+    EXPECT_EQ(instance.nodeWeights[idle], 0.0f);
+}
+
+TEST(AnimationPoseGraphTest, LayerOnlyOverridesMaskedNodes)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    const uint32_t         idle = graph.addClip(IDLE_CLIP);
+    const uint32_t         run  = graph.addClip(RUN_CLIP);
+    const uint32_t         mask = graph.addBoneMask(ya::AnimationPoseGraph::makeSubtreeMask(skeleton, "spine"));
+    graph.rootNode              = graph.addLayer(idle, run, mask, graph.addParameter("upperBody", 1.0f));
+    EXPECT_EQ(graph.boneMasks[mask], (std::vector<float>{0.0f, 1.0f, 1.0f}));
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+    evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(0.0f), rotationZ(0.0f))));
+    EXPECT_TRUE(nearMat4(pose.localTransforms[1], trs(glm::vec3(0.0f, 1.0f, 0.0f), rotationZ(90.0f))));
+    EXPECT_TRUE(nearMat4(pose.localTransforms[2], trs(glm::vec3(0.0f, 1.0f, 0.0f), rotationZ(90.0f))));
+
+    // A zero layer weight skips the overlay branch entirely.
+    instance.setParameter("upperBody", 0.0f);
+    evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[1], trs(glm::vec3(0.0f, 1.0f, 0.0f), rotationZ(0.0f))));
+    EXPECT_EQ(cache.getStats().sampleCount, 1u);
+}
+
+TEST(AnimationPoseGraphTest, AdditiveAppliesDifferenceFromFirstFrame)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    const uint32_t         run  = graph.addClip(RUN_CLIP);
+    const uint32_t         lean = graph.addClip(LEAN_CLIP, 1.0f, false);
+    graph.rootNode              = graph.addAdditive(run, lean);
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+
+    // At the first frame the additive clip equals its reference: no change.
+    evaluateFrame(skeleton, instance, cache, 0.0f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[1], trs(glm::vec3(0.0f, 1.0f, 0.0f), rotationZ(90.0f))));
+
+    // Past the end the clamped clip adds its full 30 degrees.
+    evaluateFrame(skeleton, instance, cache, 2.0f, pose);
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], trs(glm::vec3(2.0f, 0.0f, 0.0f), rotationZ(120.0f))));
+    EXPECT_TRUE(nearMat4(pose.localTransforms[1], trs(glm::vec3(0.0f, 1.0f, 0.0f), rotationZ(120.0f))));
+}
+
+TEST(AnimationPoseGraphTest, CacheSamplesSharedClipTimesOnce)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    ya::AnimationPoseGraph graph;
+    const uint32_t         speed = graph.addParameter("speed", 0.5f);
+    graph.rootNode               = graph.addBlendSpace1D(speed, {{0.0f, graph.addClip(IDLE_CLIP)}, {1.0f, graph.addClip(SLOW_RUN_CLIP)}});
+
+    constexpr uint32_t                      INSTANCE_COUNT = 64;
+    std::vector<ya::AnimationGraphInstance> instances(INSTANCE_COUNT);
+    for (auto& instance : instances) {
+        instance.reset(graph);
+    }
+
+    ya::AnimationPoseCache cache;
+    std::vector<ya::SkeletonPose> poses(INSTANCE_COUNT);
+    for (int frame = 0; frame < 3; ++frame) {
+        cache.beginFrame();
+        for (auto& instance : instances) {
+            ya::AnimationPoseGraphEvaluator::advance(skeleton, instance, 1.0f / 30.0f);
+            ya::AnimationPoseGraphEvaluator::gather(skeleton, instance, cache);
+        }
+        cache.sampleAll();
+        for (uint32_t index = 0; index < INSTANCE_COUNT; ++index) {
+            ya::AnimationPoseGraphEvaluator::evaluate(skeleton, instances[index], cache, poses[index]);
+        }
+
+        EXPECT_EQ(cache.getStats().requestCount, 2 * INSTANCE_COUNT);
+        EXPECT_EQ(cache.getStats().sampleCount, 2u);
+        EXPECT_TRUE(nearMat4(poses.front().boneMatrices[2], poses.back().boneMatrices[2]));
+    }
+}
+
+TEST(AnimationPoseGraphTest, PosePoolStopsGrowingAfterWarmUp)
+{
+    const ya::Skeleton skeleton = makeSkeleton();
+
+    // state machine -> layer -> additive -> blend space: every blend kind nested.
+    ya::AnimationPoseGraph graph;
+    const uint32_t         speed    = graph.addParameter("speed", 0.5f);
+    const uint32_t         locomote = graph.addBlendSpace1D(speed, {{0.0f, graph.addClip(IDLE_CLIP)}, {1.0f, graph.addClip(RUN_CLIP)}});
+    const uint32_t         leaning  = graph.addAdditive(locomote, graph.addClip(LEAN_CLIP));
+    const uint32_t         mask     = graph.addBoneMask(ya::AnimationPoseGraph::makeSubtreeMask(skeleton, "arm"));
+    const uint32_t         upper    = graph.addLayer(leaning, graph.addClip(SLOW_RUN_CLIP), mask);
+    graph.rootNode                  = graph.addStateMachine({upper, graph.addClip(IDLE_CLIP)});
+
+    ya::AnimationGraphInstance instance;
+    instance.reset(graph);
+    ya::AnimationPoseCache cache;
+    ya::SkeletonPose       pose;
+
+    instance.requestState(graph.rootNode, 1, 10.0f);
+    evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    const size_t warmBufferCount = instance.pool.getBufferCount();
+    EXPECT_GT(warmBufferCount, 0u);
+
+    for (int frame = 0; frame < 20; ++frame) {
+        evaluateFrame(skeleton, instance, cache, 0.1f, pose);
+    }
+    EXPECT_EQ(instance.pool.getBufferCount(), warmBufferCount);
+    EXPECT_EQ(pose.boneMatrices.size(), skeleton.bones.size());
+}
@@ -0,0 +1,298 @@
+#include "Core/Async/JobSystem.h"
+#include "Core/Async/TaskQueue.h"
+#include "Resource/Manager/AssetImportPipeline.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+class AssetImportPipelineTest : public ya::JobSystemTestSuite
+{
+};
+
+/// Synthetic texture: read produces "file" bytes, decode expands them 4x.
+struct FakeAsset
+{
+    uint32_t             id = 0;
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> decoded;
+    uint64_t             checksum = 0;
+};
+
+ya::AssetImportItem makeFakeItem(const std::shared_ptr<FakeAsset>& asset,
+                                 size_t                            sourceBytes,
+                                 std::function<void(bool)>         upload)
+{
+    ya::AssetImportItem item;
+    item.label          = "fake_" + std::to_string(asset->id);
+    item.estimatedBytes = sourceBytes * 5;
+    item.read           = [asset, sourceBytes](ya::AssetImportStageContext& context) {
+        asset->source.assign(sourceBytes, static_cast<uint8_t>(asset->id));
+        context.processedBytes = sourceBytes;
+        return true;
+    };
+    item.decode = [asset](ya::AssetImportStageContext& context) {
+        asset->decoded.resize(asset->source.size() * 4);
+        for (size_t index = 0; index < asset->decoded.size(); ++index) {
+            asset->decoded[index] = static_cast<uint8_t>(asset->source[index / 4] + index);
+        }
+        std::vector<uint8_t>().swap(asset->source);
+        context.residentBytes  = asset->decoded.size();
+        context.processedBytes = asset->decoded.size();
+        return true;
+    };
+    item.postProcess = [asset](ya::AssetImportStageContext& context) {
+        asset->checksum        = std::accumulate(asset->decoded.begin(), asset->decoded.end(), uint64_t(0));
+        context.processedBytes = asset->decoded.size();
+        return true;
+    };
+    item.upload = std::move(upload);
+    return item;
+}
+
+} // namespace
+
+TEST_F(AssetImportPipelineTest, RunsStagesInOrderAndUploadsOnCallingThread)
+{
+    ya::AssetImportPipeline pipeline;
+
+    const auto         mainThread = std::this_thread::get_id();
+    std::vector<int>   order;
+    std::mutex         orderMutex;
+    std::thread::id    uploadThread;
+    bool               bUploadOk = false;
+
+    ya::AssetImportItem item;
+    item.label  = "ordered";
+    item.read   = [&](ya::AssetImportStageContext&) { std::lock_guard lock(orderMutex); order.push_back(0); return true; };
+    item.decode = [&](ya::AssetImportStageContext&) { std::lock_guard lock(orderMutex); order.push_back(1); return true; };
+    item.postProcess = [&](ya::AssetImportStageContext&) { std::lock_guard lock(orderMutex); order.push_back(2); return true; };
+    item.upload = [&](bool bOk) {
+        order.push_back(3);
+        uploadThread = std::this_thread::get_id();
+        bUploadOk    = bOk;
+    };
+    pipeline.submit(std::move(item));
+    pipeline.flush();
+
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(uploadThread, mainThread);
+    EXPECT_TRUE(bUploadOk);
+
+    const auto progress = pipeline.getProgress();
+    EXPECT_EQ(progress.submittedItems, 1u);
+    EXPECT_EQ(progress.completedItems, 1u);
+    EXPECT_EQ(progress.inFlightBytes, 0u);
+    EXPECT_FLOAT_EQ(progress.fraction(), 1.0f);
+}
+
+TEST_F(AssetImportPipelineTest, FailedStageSkipsToUploadWithFailure)
+{
+    ya::AssetImportPipeline pipeline;
+
+    bool bPostProcessRan = false;
+    int  uploadResult    = -1;
+
+    ya::AssetImportItem item;
+    item.decode      = [](ya::AssetImportStageContext&) { return false; };
+    item.postProcess = [&](ya::AssetImportStageContext&) { bPostProcessRan = true; return true; };
+    item.upload      = [&](bool bOk) { uploadResult = bOk ? 1 : 0; };
+    pipeline.submit(std::move(item));
+
+    ya::AssetImportItem throwing;
+    throwing.read   = [](ya::AssetImportStageContext&) -> bool { throw std::runtime_error("io"); };
+    throwing.upload = [&](bool bOk) { EXPECT_FALSE(bOk); };
+    pipeline.submit(std::move(throwing));
+    pipeline.flush();
+
+    EXPECT_FALSE(bPostProcessRan);
+    EXPECT_EQ(uploadResult, 0);
+    EXPECT_EQ(pipeline.getProgress().failedItems, 2u);
+    EXPECT_EQ(pipeline.getStageMetrics(ya::EAssetImportStage::Decode).failedItems, 1u);
+    EXPECT_EQ(pipeline.getStageMetrics(ya::EAssetImportStage::Read).failedItems, 1u);
+}
+
+TEST_F(AssetImportPipelineTest, BudgetBoundsBytesInFlight)
+{
+    constexpr size_t   kSourceBytes = 64 * 1024;
+    constexpr uint64_t kBudget      = kSourceBytes * 5 * 3; // Three items at a time
+    ya::AssetImportPipeline pipeline(ya::AssetImportPipeline::Config{
+        .memoryBudgetBytes      = kBudget,
+        .readConcurrency        = 8,
+        .decodeConcurrency      = 8,
+        .postProcessConcurrency = 8,
+    });
+
+    std::vector<std::shared_ptr<FakeAsset>> assets;
+    std::vector<ya::AssetImportItem>        items;
+    uint32_t                                uploaded = 0;
+    for (uint32_t id = 0; id < 64; ++id) {
+        auto asset = std::make_shared<FakeAsset>();
+        asset->id  = id;
+        assets.push_back(asset);
+        items.push_back(makeFakeItem(asset, kSourceBytes, [&uploaded](bool bOk) { uploaded += bOk ? 1 : 0; }));
+    }
+    pipeline.submitBatch(std::move(items));
+    pipeline.flush();
+
+    EXPECT_EQ(uploaded, 64u);
+    const auto progress = pipeline.getProgress();
+    EXPECT_EQ(progress.completedItems, 64u);
+    EXPECT_LE(progress.peakInFlightBytes, kBudget);
+    EXPECT_GT(progress.peakInFlightBytes, 0u);
+    for (const auto& asset : assets) {
+        EXPECT_NE(asset->checksum, 0u);
+    }
+}
+
+TEST_F(AssetImportPipelineTest, OversizedItemStillRunsWhenIdle)
+{
+    ya::AssetImportPipeline pipeline(ya::AssetImportPipeline::Config{.memoryBudgetBytes = 1024});
+
+    auto asset = std::make_shared<FakeAsset>();
+    bool bOk   = false;
+    pipeline.submit(makeFakeItem(asset, 1 << 20, [&bOk](bool bResult) { bOk = bResult; }));
+    pipeline.flush();
+
+    EXPECT_TRUE(bOk);
+    EXPECT_EQ(asset->decoded.size(), 4u << 20);
+}
+
+TEST_F(AssetImportPipelineTest, StageConcurrencyLimitsHold)
+{
+    ya::AssetImportPipeline pipeline(ya::AssetImportPipeline::Config{
+        .memoryBudgetBytes      = ~0ull,
+        .readConcurrency        = 1,
+        .decodeConcurrency      = 2,
+        .postProcessConcurrency = 1,
+    });
+
+    std::atomic<int> activeReads{0};
+    std::atomic<int> peakReads{0};
+    std::vector<ya::AssetImportItem> items(32);
+    for (auto& item : items) {
+        item.read = [&](ya::AssetImportStageContext&) {
+            const int active = activeReads.fetch_add(1) + 1;
+            int       peak   = peakReads.load();
+            while (active > peak && !peakReads.compare_exchange_weak(peak, active)) {
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            activeReads.fetch_sub(1);
+            return true;
+        };
+        item.decode = [](ya::AssetImportStageContext&) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            return true;
+        };
+    }
+    pipeline.submitBatch(std::move(items));
+    pipeline.flush();
+
+    EXPECT_EQ(peakReads.load(), 1);
+    EXPECT_LE(pipeline.getStageMetrics(ya::EAssetImportStage::Read).peakActiveItems, 1u);
+    EXPECT_LE(pipeline.getStageMetrics(ya::EAssetImportStage::Decode).peakActiveItems, 2u);
+    EXPECT_EQ(pipeline.getStageMetrics(ya::EAssetImportStage::PostProcess).completedItems, 0u);
+    EXPECT_EQ(pipeline.getProgress().completedItems, 32u);
+}
+
+TEST_F(AssetImportPipelineTest, UploadsArriveThroughMainThreadCallbacks)
+{
+    auto& taskQueue = ya::TaskQueue::get();
+    taskQueue.start();
+
+    ya::AssetImportPipeline pipeline;
+    bool                    bUploaded = false;
+    ya::AssetImportItem     item;
+    item.decode = [](ya::AssetImportStageContext&) { return true; };
+    item.upload = [&bUploaded](bool) { bUploaded = true; };
+    pipeline.submit(std::move(item));
+
+    for (int attempt = 0; attempt < 10000 && !bUploaded; ++attempt) {
+        taskQueue.processMainThreadCallbacks();
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(bUploaded);
+}
+
+TEST_F(AssetImportPipelineTest, UploadBudgetSpreadsUploadsAcrossFrames)
+{
+    auto& taskQueue = ya::TaskQueue::get();
+    taskQueue.start();
+
+    ya::AssetImportPipeline pipeline(ya::AssetImportPipeline::Config{.uploadBudgetBytesPerFrame = 250});
+    int                     uploadsThisFrame = 0;
+    int                     maxPerFrame      = 0;
+    int                     uploaded         = 0;
+    std::vector<ya::AssetImportItem> items;
+    for (int i = 0; i < 6; ++i) {
+        ya::AssetImportItem item;
+        item.estimatedBytes = 100;
+        item.upload         = [&](bool) {
+            ++uploaded;
+            maxPerFrame = std::max(maxPerFrame, ++uploadsThisFrame);
+        };
+        items.push_back(std::move(item));
+    }
+    // No worker stages: every item is ready for upload at once.
+    pipeline.submitBatch(std::move(items));
+
+    int frames = 0;
+    for (; frames < 100 && uploaded < 6; ++frames) {
+        uploadsThisFrame = 0;
+        taskQueue.processMainThreadCallbacks();
+    }
+    EXPECT_EQ(uploaded, 6);
+    EXPECT_EQ(maxPerFrame, 2);
+    EXPECT_EQ(frames, 3);
+    EXPECT_EQ(pipeline.getProgress().deferredUploadFrames, 2u);
+}
+
+TEST_F(AssetImportPipelineTest, CancelWaitingReportsFailure)
+{
+    ya::AssetImportPipeline pipeline(ya::AssetImportPipeline::Config{.memoryBudgetBytes = 1});
+
+    std::atomic<bool>   bRelease{false};
+    std::vector<int>    results;
+    ya::AssetImportItem blocker;
+    blocker.estimatedBytes = 1;
+    blocker.decode         = [&bRelease](ya::AssetImportStageContext&) {
+        while (!bRelease.load()) {
+            std::this_thread::yield();
+        }
+        return true;
+    };
+    blocker.upload = [&results](bool bOk) { results.push_back(bOk ? 1 : 0); };
+
+    std::vector<ya::AssetImportItem> items;
+    items.push_back(std::move(blocker));
+    for (int index = 0; index < 3; ++index) {
+        ya::AssetImportItem waiting;
+        waiting.estimatedBytes = 1;
+        waiting.decode         = [](ya::AssetImportStageContext&) { return true; };
+        waiting.upload         = [&results](bool bOk) { results.push_back(bOk ? 1 : 0); };
+        items.push_back(std::move(waiting));
+    }
+    pipeline.submitBatch(std::move(items));
+
+    EXPECT_EQ(pipeline.getProgress().waitingItems, 3u);
+    pipeline.cancelWaiting();
+    bRelease.store(true);
+    pipeline.flush();
+
+    EXPECT_EQ(results, (std::vector<int>{0, 0, 0, 1}));
+    EXPECT_EQ(pipeline.getProgress().failedItems, 3u);
+    EXPECT_EQ(pipeline.getProgress().completedItems, 1u);
+}
@@ -0,0 +1,232 @@
+#include "Resource/Core/Model/CookedModel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace ya
+{
+
+namespace
+{
+
+std::filesystem::path makeTempDir(const char* name)
+{
+    auto dir = std::filesystem::temp_directory_path() / "ya_cooked_model_test" / name;
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    return dir;
+}
+
+EngineMeshData makeMesh(std::string name, uint32_t vertexCount, bool bSkinned)
+{
+    EngineMeshData mesh;
+    mesh.name = std::move(name);
+    mesh.vertices.resize(vertexCount);
+    for (uint32_t index = 0; index < vertexCount; ++index) {
+        mesh.vertices[index].position = glm::vec3(static_cast<float>(index), 1.0f, 2.0f);
+        mesh.vertices[index].normal   = glm::vec3(0.0f, 1.0f, 0.0f);
+    }
+    for (uint32_t index = 0; index + 2 < vertexCount; ++index) {
+        mesh.indices.insert(mesh.indices.end(), {index, index + 1, index + 2});
+    }
+    if (bSkinned) {
+        mesh.skeletonVertices.resize(vertexCount);
+        for (auto& skin : mesh.skeletonVertices) {
+            skin.boneIDs = {1, 0, 0, 0};
+            skin.weights = {1.0f, 0.0f, 0.0f, 0.0f};
+        }
+    }
+    return mesh;
+}
+
+ImportedModelData makeImportedModel(size_t meshCount)
+{
+    ImportedModelData model;
+    model.filepath  = "Content/Test/Robot.gltf";
+    model.directory = "Content/Test";
+    model.meshes.resize(meshCount);
+    model.meshMaterialIndices.assign(meshCount, 0);
+    model.meshSkeletonIndices.assign(meshCount, -1);
+    model.meshSkeletonIndices[0] = 0;
+
+    MaterialData material;
+    material.name = "Body";
+    material.type = "PBR";
+    material.setParam(MatParam::BaseColor, glm::vec4(0.5f, 0.25f, 1.0f, 1.0f));
+    material.setParam(MatParam::Metallic, 0.75f);
+    material.setParam(MatParam::DoubleSided, true);
+    material.setParam(MatParam::AlphaMode, std::string("MASK"));
+    material.setTexturePath(MatTexture::Albedo, "Textures/body_albedo.png");
+    model.materials.push_back(material);
+
+    ImportedSkeletonData skeleton;
+    skeleton.name          = "Armature";
+    skeleton.rootNodeIndex = 0;
+    skeleton.nodes.resize(2);
+    skeleton.nodes[0].name     = FName("Root");
+    skeleton.nodes[0].children = {1};
+    skeleton.nodes[1].name        = FName("Spine");
+    skeleton.nodes[1].parentIndex = 0;
+    skeleton.nameToNodeIndex[FName("Root")]  = 0;
+    skeleton.nameToNodeIndex[FName("Spine")] = 1;
+    skeleton.bones.push_back({.name = FName("Spine"), .boneIndex = 0, .nodeIndex = 1});
+    skeleton.boneNameToIndex[FName("Spine")] = 0;
+
+    ImportedSkeletonAnimationClip clip;
+    clip.name           = "Walk";
+    clip.duration       = 2.0;
+    clip.ticksPerSecond = 30.0;
+    clip.channels.push_back({
+        .targetName   = FName("Spine"),
+        .positionKeys = {{0.0, glm::vec3(0.0f)}, {1.0, glm::vec3(1.0f, 2.0f, 3.0f)}},
+        .rotationKeys = {{0.5, glm::quat(1.0f, 0.0f, 0.0f, 0.0f)}},
+    });
+    skeleton.animations.push_back(clip);
+    skeleton.meshIndices = {0};
+    model.skeletons.push_back(skeleton);
+    return model;
+}
+
+} // namespace
+
+TEST(CookedModelTest, RoundTripsMeshBlobsAndMeta)
+{
+    const auto dir  = makeTempDir("RoundTrip");
+    const auto path = dir / "Robot.yamodel";
+
+    const ImportedModelData           imported = makeImportedModel(2);
+    std::vector<EngineMeshData>       meshes   = {makeMesh("Body", 37, true), makeMesh("Visor", 5, false)};
+    meshes[0].lods = {MeshLod{.firstIndex = 0, .indexCount = 60}, MeshLod{.firstIndex = 60, .indexCount = 45, .error = 0.125f}};
+    mesh_optimizer::buildMeshlets(meshes[0]);
+    ASSERT_FALSE(meshes[0].meshlets.empty());
+    const CookedModelSourceStamp      stamp{.pathHash = 1, .fileSize = 2, .writeTime = 3};
+    ASSERT_TRUE(CookedModel::write(path, stamp, imported, meshes));
+
+    const auto cooked = CookedModel::open(path, stamp);
+    ASSERT_NE(cooked, nullptr);
+    EXPECT_EQ(cooked->getFilepath(), imported.filepath);
+    EXPECT_EQ(cooked->getDirectory(), imported.directory);
+    ASSERT_EQ(cooked->getMeshCount(), meshes.size());
+
+    for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
+        const EngineMeshView view = cooked->getMesh(meshIndex);
+        const auto&          mesh = meshes[meshIndex];
+        EXPECT_EQ(view.name, mesh.name);
+        ASSERT_EQ(view.vertices.size(), mesh.vertices.size());
+        ASSERT_EQ(view.indices.size(), mesh.indices.size());
+        ASSERT_EQ(view.skeletonVertices.size(), mesh.skeletonVertices.size());
+        EXPECT_EQ(std::memcmp(view.vertices.data(), mesh.vertices.data(), view.vertices.size_bytes()), 0);
+        EXPECT_EQ(std::memcmp(view.indices.data(), mesh.indices.data(), view.indices.size_bytes()), 0);
+        if (!view.skeletonVertices.empty()) {
+            EXPECT_EQ(std::memcmp(view.skeletonVertices.data(), mesh.skeletonVertices.data(), view.skeletonVertices.size_bytes()), 0);
+        }
+        EXPECT_EQ(std::vector<MeshLod>(view.lods.begin(), view.lods.end()), mesh.lods);
+        EXPECT_EQ(std::vector<Meshlet>(view.meshlets.begin(), view.meshlets.end()), mesh.meshlets);
+        EXPECT_EQ(std::vector<uint32_t>(view.meshletVertices.begin(), view.meshletVertices.end()), mesh.meshletVertices);
+        EXPECT_EQ(std::vector<uint8_t>(view.meshletTriangles.begin(), view.meshletTriangles.end()), mesh.meshletTriangles);
+        // Zero-copy: the spans point into the aligned mapping.
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(view.vertices.data()) % CookedModelHeader::BLOB_ALIGNMENT, 0u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(view.indices.data()) % CookedModelHeader::BLOB_ALIGNMENT, 0u);
+    }
+
+    EXPECT_EQ(cooked->getMeshMaterialIndices(), imported.meshMaterialIndices);
+    EXPECT_EQ(cooked->getMeshSkeletonIndices(), imported.meshSkeletonIndices);
+
+    ASSERT_EQ(cooked->getMaterials().size(), 1u);
+    const MaterialData& material = cooked->getMaterials()[0];
+    EXPECT_EQ(material.name, "Body");
+    EXPECT_FLOAT_EQ(material.getParam<float>(MatParam::Metallic), 0.75f);
+    EXPECT_TRUE(material.getParam<bool>(MatParam::DoubleSided));
+    EXPECT_EQ(material.getParam<std::string>(MatParam::AlphaMode), "MASK");
+    EXPECT_EQ(material.getParam<glm::vec4>(MatParam::BaseColor), glm::vec4(0.5f, 0.25f, 1.0f, 1.0f));
+    EXPECT_EQ(material.getTexturePath(MatTexture::Albedo), "Textures/body_albedo.png");
+
+    ASSERT_EQ(cooked->getSkeletons().size(), 1u);
+    const ImportedSkeletonData& skeleton = cooked->getSkeletons()[0];
+    EXPECT_EQ(skeleton.name, "Armature");
+    ASSERT_EQ(skeleton.nodes.size(), 2u);
+    EXPECT_EQ(skeleton.nodes[1].parentIndex, 0u);
+    EXPECT_EQ(skeleton.nodes[0].children, std::vector<uint32_t>{1});
+    EXPECT_EQ(skeleton.nameToNodeIndex.at(FName("Spine")), 1u);
+    ASSERT_EQ(skeleton.bones.size(), 1u);
+    EXPECT_EQ(skeleton.bones[0].nodeIndex, 1u);
+    EXPECT_EQ(skeleton.boneNameToIndex.at(FName("Spine")), 0u);
+    ASSERT_EQ(skeleton.animations.size(), 1u);
+    const auto& channel = skeleton.animations[0].channels.at(0);
+    EXPECT_EQ(skeleton.animations[0].name, "Walk");
+    EXPECT_DOUBLE_EQ(skeleton.animations[0].ticksPerSecond, 30.0);
+    ASSERT_EQ(channel.positionKeys.size(), 2u);
+    EXPECT_EQ(channel.positionKeys[1].value, glm::vec3(1.0f, 2.0f, 3.0f));
+    ASSERT_EQ(channel.rotationKeys.size(), 1u);
+    EXPECT_DOUBLE_EQ(channel.rotationKeys[0].time, 0.5);
+    EXPECT_TRUE(channel.scaleKeys.empty());
+    EXPECT_EQ(skeleton.meshIndices, std::vector<uint32_t>{0});
+}
+
+TEST(CookedModelTest, RejectsStaleOrCorruptFiles)
+{
+    const auto dir  = makeTempDir("Reject");
+    const auto path = dir / "Robot.yamodel";
+
+    const ImportedModelData           imported = makeImportedModel(1);
+    const std::vector<EngineMeshData> meshes   = {makeMesh("Body", 64, true)};
+    const CookedModelSourceStamp      stamp{.pathHash = 7, .fileSize = 100, .writeTime = 42};
+    ASSERT_TRUE(CookedModel::write(path, stamp, imported, meshes));
+    ASSERT_NE(CookedModel::open(path, stamp), nullptr);
+
+    // Source edited since the cook.
+    CookedModelSourceStamp edited = stamp;
+    edited.writeTime += 1;
+    EXPECT_EQ(CookedModel::open(path, edited), nullptr);
+
+    // Mesh count mismatch is refused at write time.
+    EXPECT_FALSE(CookedModel::write(dir / "Bad.yamodel", stamp, imported, {}));
+
+    // Truncated file.
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 16);
+    EXPECT_EQ(CookedModel::open(path, stamp), nullptr);
+
+    EXPECT_EQ(CookedModel::open(dir / "Missing.yamodel", stamp), nullptr);
+}
+
+TEST(CookedModelTest, OptimizationSettingsAreHonouredByTheStamp)
+{
+    const auto dir = makeTempDir("Settings");
+
+    const ImportedModelData           imported = makeImportedModel(1);
+    const std::vector<EngineMeshData> meshes   = {makeMesh("Body", 300, true)};
+    const CookedModelSourceStamp      stamp{.pathHash = 5, .settingsHash = MeshOptimizationSettings{.bMeshlets = false}.hash()};
+    ASSERT_TRUE(CookedModel::write(dir / "Body.yamodel", stamp, imported, meshes));
+    EXPECT_NE(CookedModel::open(dir / "Body.yamodel", stamp), nullptr);
+
+    // Different optimization settings must not reuse the cook.
+    CookedModelSourceStamp otherSettings = stamp;
+    otherSettings.settingsHash           = MeshOptimizationSettings{}.hash();
+    EXPECT_EQ(CookedModel::open(dir / "Body.yamodel", otherSettings), nullptr);
+}
+
+TEST(CookedModelTest, SourceStampTracksFileChanges)
+{
+    const auto dir    = makeTempDir("Stamp");
+    const auto source = dir / "Robot.gltf";
+    {
+        std::ofstream(source) << "{}";
+    }
+
+    const auto stamp = CookedModelSourceStamp::fromFile("Content/Robot.gltf", source);
+    EXPECT_EQ(stamp.fileSize, 2u);
+    EXPECT_EQ(stamp, CookedModelSourceStamp::fromFile("Content/Robot.gltf", source));
+    EXPECT_NE(stamp, CookedModelSourceStamp::fromFile("Content/Other.gltf", source));
+
+    {
+        std::ofstream(source) << "{\"asset\":{}}";
+    }
+    EXPECT_NE(stamp, CookedModelSourceStamp::fromFile("Content/Robot.gltf", source));
+    EXPECT_EQ(CookedModelSourceStamp::fromFile("Content/Robot.gltf", dir / "Missing.gltf"), CookedModelSourceStamp{});
+}
+
+} // namespace ya
@@ -115,18 +115,20 @@ TEST(DeferredFrameResourceSetTest, SkinningCapacityStartsSmallGrowsAndRejectsOve
     const auto initialCapacity =
         DeferredFrameResourceSetTestAccess::calculateSkinningCapacity(0, 0);
     ASSERT_TRUE(initialCapacity.has_value());
-    EXPECT_EQ(*initialCapacity, 16u);
+    EXPECT_EQ(*initialCapacity, INITIAL_SKINNING_MATRIX_CAPACITY);
 
     const auto grownCapacity =
-        DeferredFrameResourceSetTestAccess::calculateSkinningCapacity(16, 17);
+        DeferredFrameResourceSetTestAccess::calculateSkinningCapacity(
+            INITIAL_SKINNING_MATRIX_CAPACITY,
+            INITIAL_SKINNING_MATRIX_CAPACITY + 1u);
     ASSERT_TRUE(grownCapacity.has_value());
-    EXPECT_EQ(*grownCapacity, 32u);
+    EXPECT_EQ(*grownCapacity, 2u * INITIAL_SKINNING_MATRIX_CAPACITY);
 
-    constexpr uint32_t maxPaletteCount = std::numeric_limits<uint32_t>::max() / sizeof(RenderSkinningPalette);
+    constexpr uint32_t maxMatrixCount = std::numeric_limits<uint32_t>::max() / sizeof(glm::mat4);
     EXPECT_FALSE(
         DeferredFrameResourceSetTestAccess::calculateSkinningCapacity(
-            maxPaletteCount,
-            maxPaletteCount + 1u)
+            maxMatrixCount,
+            maxMatrixCount + 1u)
             .has_value());
 }
 
@@ -0,0 +1,236 @@
+#include "Resource/Core/DerivedData/DerivedDataCache.h"
+#include "Resource/Core/DerivedData/MeshDataCodec.h"
+#include "Resource/Core/Meta/AssetMeta.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace ya
+{
+
+namespace
+{
+
+std::filesystem::path makeTempDir(const char* name)
+{
+    auto dir = std::filesystem::temp_directory_path() / "ya_ddc_test" / name;
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    return dir;
+}
+
+std::vector<std::byte> makePayload(size_t size, uint8_t seed)
+{
+    std::vector<std::byte> payload(size);
+    for (size_t index = 0; index < size; ++index) {
+        payload[index] = static_cast<std::byte>((index * 31 + seed) & 0xFF);
+    }
+    return payload;
+}
+
+DerivedDataKey makeKey(std::string_view name)
+{
+    return DerivedDataKeyBuilder("Test", 1).string(name).finish();
+}
+
+std::filesystem::path entryFile(const DerivedDataCache& cache, const DerivedDataKey& key)
+{
+    const std::string name = key.toString();
+    return cache.getRoot() / name.substr(0, 2) / (name + ".ddc");
+}
+
+} // namespace
+
+TEST(DerivedDataCacheTest, StoreThenLoadRoundTrips)
+{
+    const auto       root = makeTempDir("round_trip");
+    DerivedDataCache cache(root);
+
+    const auto key     = makeKey("mesh");
+    const auto payload = makePayload(4096, 7);
+    EXPECT_FALSE(cache.load(key).has_value());
+    ASSERT_TRUE(cache.store(key, payload));
+    EXPECT_TRUE(cache.contains(key));
+
+    auto loaded = cache.load(key);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(*loaded, payload);
+
+    // A fresh instance rebuilds its index from disk.
+    DerivedDataCache reopened(root);
+    auto             reloaded = reopened.load(key);
+    ASSERT_TRUE(reloaded.has_value());
+    EXPECT_EQ(*reloaded, payload);
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.writes, 1u);
+}
+
+TEST(DerivedDataCacheTest, KeyDependsOnEveryInput)
+{
+    AssetMeta meta;
+    meta.type       = "texture";
+    meta.properties = {{"colorSpace", "srgb"}, {"generateMips", true}};
+    AssetMeta changedMeta = meta;
+    changedMeta.properties["colorSpace"] = "linear";
+
+    const auto base = DerivedDataKeyBuilder("Proc", 1).meta(meta).value(1.5f).finish();
+    EXPECT_EQ(base, DerivedDataKeyBuilder("Proc", 1).meta(meta).value(1.5f).finish());
+    EXPECT_NE(base, DerivedDataKeyBuilder("Proc", 2).meta(meta).value(1.5f).finish());
+    EXPECT_NE(base, DerivedDataKeyBuilder("Other", 1).meta(meta).value(1.5f).finish());
+    EXPECT_NE(base, DerivedDataKeyBuilder("Proc", 1).meta(changedMeta).value(1.5f).finish());
+    EXPECT_NE(base, DerivedDataKeyBuilder("Proc", 1).meta(meta).value(1.25f).finish());
+
+    // Length prefixes keep adjacent strings from aliasing.
+    EXPECT_NE(DerivedDataKeyBuilder("Proc", 1).string("ab").string("c").finish(),
+              DerivedDataKeyBuilder("Proc", 1).string("a").string("bc").finish());
+}
+
+TEST(DerivedDataCacheTest, HasherIsIndependentOfChunking)
+{
+    const auto payload = makePayload(1000, 3);
+
+    DerivedDataHasher whole;
+    whole.update(payload.data(), payload.size());
+
+    DerivedDataHasher pieces;
+    size_t            offset = 0;
+    for (size_t step : {1u, 3u, 7u, 8u, 13u, 64u}) {
+        pieces.update(payload.data() + offset, step);
+        offset += step;
+    }
+    pieces.update(payload.data() + offset, payload.size() - offset);
+
+    EXPECT_EQ(whole.finish(), pieces.finish());
+    EXPECT_EQ(whole.finish().toString().size(), 32u);
+}
+
+TEST(DerivedDataCacheTest, CorruptEntryIsDroppedAsMiss)
+{
+    const auto       root = makeTempDir("corrupt");
+    DerivedDataCache cache(root);
+
+    const auto key = makeKey("corrupt");
+    ASSERT_TRUE(cache.store(key, makePayload(256, 1)));
+
+    {
+        std::fstream file(entryFile(cache, key), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(64 + 100);
+        file.put('\x5A');
+    }
+
+    EXPECT_FALSE(cache.load(key).has_value());
+    EXPECT_FALSE(cache.contains(key));
+    EXPECT_FALSE(std::filesystem::exists(entryFile(cache, key)));
+    EXPECT_EQ(cache.getStats().corruptions, 1u);
+
+    // Truncated entries are rejected too.
+    ASSERT_TRUE(cache.store(key, makePayload(256, 1)));
+    std::filesystem::resize_file(entryFile(cache, key), 100);
+    DerivedDataCache reopened(root);
+    EXPECT_FALSE(reopened.load(key).has_value());
+}
+
+TEST(DerivedDataCacheTest, EvictsLeastRecentlyUsedOverBudget)
+{
+    const auto       root = makeTempDir("lru");
+    const uint64_t   entryBytes = 64 + 1000;
+    DerivedDataCache cache(root, entryBytes * 3);
+
+    const auto first  = makeKey("first");
+    const auto second = makeKey("second");
+    const auto third  = makeKey("third");
+    const auto fourth = makeKey("fourth");
+
+    ASSERT_TRUE(cache.store(first, makePayload(1000, 1)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(cache.store(second, makePayload(1000, 2)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(cache.store(third, makePayload(1000, 3)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    // Touch the oldest so the second entry becomes the LRU victim.
+    ASSERT_TRUE(cache.load(first).has_value());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(cache.store(fourth, makePayload(1000, 4)));
+
+    EXPECT_TRUE(cache.contains(first));
+    EXPECT_FALSE(cache.contains(second));
+    EXPECT_TRUE(cache.contains(third));
+    EXPECT_TRUE(cache.contains(fourth));
+    EXPECT_EQ(cache.getStats().evictions, 1u);
+    EXPECT_LE(cache.getStats().totalBytes, entryBytes * 3);
+
+    cache.setBudget(entryBytes);
+    cache.trim();
+    EXPECT_EQ(cache.getStats().entryCount, 1u);
+    EXPECT_TRUE(cache.contains(fourth));
+}
+
+TEST(DerivedDataCacheTest, SourceHashFollowsContentNotTimestamp)
+{
+    const auto       root   = makeTempDir("source");
+    const auto       source = root / "height.raw";
+    DerivedDataCache cache(root / "ddc");
+
+    {
+        std::ofstream(source, std::ios::binary) << "height map v1";
+    }
+    const auto original = cache.hashSourceFile(source);
+    ASSERT_TRUE(original.has_value());
+
+    // Same bytes, new mtime: the content hash must not change.
+    std::filesystem::last_write_time(source, std::filesystem::last_write_time(source) + std::chrono::seconds(10));
+    EXPECT_EQ(cache.hashSourceFile(source), original);
+
+    {
+        std::ofstream(source, std::ios::binary | std::ios::trunc) << "height map v2";
+    }
+    std::filesystem::last_write_time(source, std::filesystem::last_write_time(source) + std::chrono::seconds(20));
+    const auto changed = cache.hashSourceFile(source);
+    ASSERT_TRUE(changed.has_value());
+    EXPECT_NE(*changed, *original);
+
+    // The memo persists: a new instance answers from the DDC entry.
+    DerivedDataCache reopened(root / "ddc");
+    EXPECT_EQ(reopened.hashSourceFile(source), changed);
+    EXPECT_EQ(reopened.getStats().hits, 1u);
+
+    EXPECT_FALSE(cache.hashSourceFile(root / "missing.raw").has_value());
+}
+
+TEST(DerivedDataCacheTest, MeshDataCodecRoundTrips)
+{
+    EngineMeshData mesh;
+    mesh.name = "terrain_Content/height.png";
+    mesh.vertices.resize(4);
+    for (uint32_t index = 0; index < 4; ++index) {
+        mesh.vertices[index].position = glm::vec3(static_cast<float>(index), 2.0f, 3.0f);
+    }
+    mesh.indices = {0, 1, 2, 2, 1, 3, 0, 1, 3};
+    mesh.lods    = {MeshLod{.firstIndex = 0, .indexCount = 6}, MeshLod{.firstIndex = 6, .indexCount = 3, .error = 0.5f}};
+
+    BinaryWriter writer;
+    writeMeshData(writer, mesh);
+
+    BinaryReader reader(writer.bytes);
+    auto         decoded = readMeshData(reader);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->name, mesh.name);
+    ASSERT_EQ(decoded->vertices.size(), 4u);
+    EXPECT_EQ(decoded->vertices[3].position, mesh.vertices[3].position);
+    EXPECT_EQ(decoded->indices, mesh.indices);
+    EXPECT_EQ(decoded->lods, mesh.lods);
+    EXPECT_TRUE(decoded->skeletonVertices.empty());
+
+    BinaryReader truncated(std::span(writer.bytes).first(writer.bytes.size() - 3));
+    EXPECT_FALSE(readMeshData(truncated).has_value());
+}
+
+} // namespace ya
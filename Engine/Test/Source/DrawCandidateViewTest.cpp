@@ -88,6 +88,69 @@ TEST(DrawCandidateViewTest, DrawPacketGroupingPreservesSortedOrder)
     EXPECT_FALSE(packets[0].bSkinned);
 }
 
+TEST(DrawCandidateViewTest, DrawPacketGroupingSplitsOnLod)
+{
+    auto* mesh = reinterpret_cast<Mesh*>(static_cast<uintptr_t>(1));
+    auto* mat  = reinterpret_cast<Material*>(static_cast<uintptr_t>(2));
+
+    std::vector<RenderDrawItem> candidates(3);
+    candidates[0] = RenderDrawItem{.mesh = mesh, .material = mat, .materialIndex = 1, .sortKey = 1.0f, .lod = 0};
+    candidates[1] = RenderDrawItem{.mesh = mesh, .material = mat, .materialIndex = 1, .sortKey = 2.0f, .lod = 2};
+    candidates[2] = RenderDrawItem{.mesh = mesh, .material = mat, .materialIndex = 1, .sortKey = 3.0f, .lod = 2};
+
+    const auto packets = buildDrawPackets(
+        DrawCandidateView{std::span<const RenderDrawItem>(candidates)},
+        false);
+
+    ASSERT_EQ(packets.size(), 2u);
+    EXPECT_EQ(packets[0].lod, 0u);
+    EXPECT_EQ(packets[0].instanceCount, 1u);
+    EXPECT_EQ(packets[1].lod, 2u);
+    EXPECT_EQ(packets[1].firstInstance, 1u);
+    EXPECT_EQ(packets[1].instanceCount, 2u);
+}
+
+TEST(DrawCandidateViewTest, PackedInstancesLineUpWithPacketRanges)
+{
+    auto* meshA = reinterpret_cast<Mesh*>(static_cast<uintptr_t>(1));
+    auto* meshB = reinterpret_cast<Mesh*>(static_cast<uintptr_t>(2));
+    auto* mat   = reinterpret_cast<Material*>(static_cast<uintptr_t>(3));
+
+    std::vector<RenderDrawItem> candidates(5);
+    for (uint32_t index = 0; index < candidates.size(); ++index) {
+        candidates[index] = RenderDrawItem{
+            .worldMatrix          = glm::mat4(static_cast<float>(index + 1)),
+            .mesh                 = index < 3 ? meshA : meshB,
+            .material             = mat,
+            .materialIndex        = 1,
+            .entityId             = 100 + index,
+            .skinningPaletteIndex = index == 4 ? 2 : -1,
+        };
+    }
+
+    const DrawCandidateView view{std::span<const RenderDrawItem>(candidates)};
+    std::vector<DrawPacket> packets;
+    buildDrawPackets(view, false, packets);
+    std::vector<DrawInstanceData> instances(view.size());
+    packDrawInstances(view, instances);
+
+    ASSERT_EQ(packets.size(), 2u);
+    for (const auto& packet : packets) {
+        for (uint32_t local = 0; local < packet.instanceCount; ++local) {
+            const auto& record    = instances[packet.firstInstance + local];
+            const auto& candidate = packet.candidates[local];
+            EXPECT_EQ(record.worldMatrix, candidate.worldMatrix);
+            EXPECT_EQ(record.entityId, candidate.entityId);
+            EXPECT_EQ(record.skinningPaletteIndex, candidate.skinningPaletteIndex);
+        }
+    }
+    EXPECT_EQ(instances[4].skinningPaletteIndex, 2);
+
+    // Appending overload reuses the caller's vector.
+    buildDrawPackets(view, false, packets);
+    EXPECT_EQ(packets.size(), 4u);
+}
+
 static_assert(std::is_same_v<decltype(std::declval<DrawCandidateView>()[0]),
                              const RenderDrawItem&>);
 
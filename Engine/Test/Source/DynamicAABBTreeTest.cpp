@@ -0,0 +1,220 @@
+#include "Core/Math/DynamicAABBTree.h"
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+ya::AABB boxAt(const glm::vec3& center, float halfSize)
+{
+    return ya::AABB(center - glm::vec3(halfSize), center + glm::vec3(halfSize));
+}
+
+bool overlaps(const ya::AABB& a, const ya::AABB& b)
+{
+    return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+           a.min.y <= b.max.y && a.max.y >= b.min.y &&
+           a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+
+struct MovingBoxes
+{
+    std::vector<ya::AABB>  bounds;
+    std::vector<glm::vec3> velocity;
+    std::vector<int32_t>   proxies;
+};
+
+MovingBoxes makeBoxes(ya::DynamicAABBTree& tree, size_t count, uint32_t seed, float worldExtent = 200.0f)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> position(-worldExtent, worldExtent);
+    std::uniform_real_distribution<float> size(0.25f, 2.0f);
+    std::uniform_real_distribution<float> speed(-0.1f, 0.1f);
+
+    MovingBoxes scene;
+    for (size_t i = 0; i < count; ++i) {
+        const ya::AABB box = boxAt(glm::vec3(position(rng), position(rng), position(rng)), size(rng));
+        scene.bounds.push_back(box);
+        scene.velocity.emplace_back(speed(rng), speed(rng), speed(rng));
+        scene.proxies.push_back(tree.createProxy(box, i));
+    }
+    return scene;
+}
+
+size_t stepBoxes(ya::DynamicAABBTree& tree, MovingBoxes& scene)
+{
+    size_t reinserted = 0;
+    for (size_t i = 0; i < scene.bounds.size(); ++i) {
+        const glm::vec3 delta = scene.velocity[i];
+        scene.bounds[i]       = ya::AABB(scene.bounds[i].min + delta, scene.bounds[i].max + delta);
+        reinserted += tree.moveProxy(scene.proxies[i], scene.bounds[i], delta) ? 1 : 0;
+    }
+    return reinserted;
+}
+
+// Candidates from the tree are fat boxes; narrow them to the exact set to compare.
+std::vector<uint64_t> treeQuery(const ya::DynamicAABBTree& tree, const MovingBoxes& scene, const ya::AABB& box)
+{
+    std::vector<uint64_t> result;
+    tree.query(box, [&](int32_t proxy) {
+        const uint64_t id = tree.getUserData(proxy);
+        if (overlaps(scene.bounds[id], box)) {
+            result.push_back(id);
+        }
+        return true;
+    });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<uint64_t> bruteQuery(const MovingBoxes& scene, const ya::AABB& box)
+{
+    std::vector<uint64_t> result;
+    for (size_t i = 0; i < scene.bounds.size(); ++i) {
+        if (overlaps(scene.bounds[i], box)) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(DynamicAABBTreeTest, InsertMoveRemoveKeepsTreeValid)
+{
+    ya::DynamicAABBTree tree;
+    MovingBoxes         scene = makeBoxes(tree, 2'000, 3);
+    EXPECT_TRUE(tree.validate());
+    EXPECT_EQ(tree.getProxyCount(), 2'000u);
+
+    for (int frame = 0; frame < 10; ++frame) {
+        stepBoxes(tree, scene);
+    }
+    EXPECT_TRUE(tree.validate());
+
+    // Remove every other proxy; ids of the survivors must stay stable.
+    for (size_t i = 0; i < scene.proxies.size(); i += 2) {
+        tree.destroyProxy(scene.proxies[i]);
+    }
+    EXPECT_TRUE(tree.validate());
+    EXPECT_EQ(tree.getProxyCount(), 1'000u);
+    for (size_t i = 1; i < scene.proxies.size(); i += 2) {
+        EXPECT_EQ(tree.getUserData(scene.proxies[i]), i);
+    }
+
+    // Freed nodes are recycled.
+    tree.createProxy(boxAt(glm::vec3(0.0f), 1.0f), 99'999);
+    EXPECT_TRUE(tree.validate());
+
+    // A balanced-ish tree over 1001 leaves should be nowhere near linear depth.
+    EXPECT_LT(tree.getHeight(), 40);
+}
+
+TEST(DynamicAABBTreeTest, QueriesMatchBruteForce)
+{
+    ya::DynamicAABBTree tree;
+    MovingBoxes         scene = makeBoxes(tree, 5'000, 5);
+    for (int frame = 0; frame < 5; ++frame) {
+        stepBoxes(tree, scene);
+    }
+
+    // Box queries.
+    const ya::AABB queryBox = boxAt(glm::vec3(10.0f, -20.0f, 5.0f), 40.0f);
+    EXPECT_EQ(treeQuery(tree, scene, queryBox), bruteQuery(scene, queryBox));
+
+    // Frustum queries never miss a box the scalar test accepts.
+    const glm::mat4 projection = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const auto      frustum    = ya::Frustum::fromViewProjection(projection * view);
+
+    std::vector<uint64_t> fromTree;
+    tree.queryFrustum(frustum, [&](int32_t proxy) {
+        const uint64_t id = tree.getUserData(proxy);
+        if (frustum.intersects(scene.bounds[id])) {
+            fromTree.push_back(id);
+        }
+        return true;
+    });
+    std::sort(fromTree.begin(), fromTree.end());
+
+    std::vector<uint64_t> expected;
+    for (size_t i = 0; i < scene.bounds.size(); ++i) {
+        if (frustum.intersects(scene.bounds[i])) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(fromTree, expected);
+    EXPECT_FALSE(expected.empty());
+
+    // Sphere queries: every box within the radius is reported.
+    const glm::vec3 center(0.0f, 0.0f, 0.0f);
+    const float     radius = 50.0f;
+    std::vector<uint64_t> inSphere;
+    tree.querySphere(center, radius, [&](int32_t proxy) {
+        inSphere.push_back(tree.getUserData(proxy));
+        return true;
+    });
+    std::sort(inSphere.begin(), inSphere.end());
+    for (size_t i = 0; i < scene.bounds.size(); ++i) {
+        const glm::vec3 closest = glm::clamp(center, scene.bounds[i].min, scene.bounds[i].max);
+        if (glm::length(closest - center) <= radius) {
+            EXPECT_TRUE(std::binary_search(inSphere.begin(), inSphere.end(), i)) << "missing " << i;
+        }
+    }
+}
+
+TEST(DynamicAABBTreeTest, RaycastFindsClosestHit)
+{
+    ya::DynamicAABBTree tree;
+    MovingBoxes         scene = makeBoxes(tree, 5'000, 9);
+
+    std::mt19937                          rng(17);
+    std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+    for (int i = 0; i < 50; ++i) {
+        const ya::Ray ray(glm::vec3(0.0f), glm::vec3(direction(rng), direction(rng), direction(rng)));
+
+        float    bestTree = 1e30f;
+        uint64_t hitTree  = UINT64_MAX;
+        tree.raycast(ray, 1e30f, [&](int32_t proxy, float) {
+            const uint64_t id       = tree.getUserData(proxy);
+            float          distance = 0.0f;
+            if (ray.intersects(scene.bounds[id], &distance) && distance < bestTree) {
+                bestTree = distance;
+                hitTree  = id;
+            }
+            return bestTree;
+        });
+
+        float    bestBrute = 1e30f;
+        uint64_t hitBrute  = UINT64_MAX;
+        for (size_t id = 0; id < scene.bounds.size(); ++id) {
+            float distance = 0.0f;
+            if (ray.intersects(scene.bounds[id], &distance) && distance < bestBrute) {
+                bestBrute = distance;
+                hitBrute  = id;
+            }
+        }
+        EXPECT_EQ(hitTree, hitBrute);
+    }
+}
+
+TEST(DynamicAABBTreeTest, SmallMovesStayInFatBox)
+{
+    ya::DynamicAABBTree tree({.margin = 0.5f, .displacementFactor = 2.0f});
+    const ya::AABB      box   = boxAt(glm::vec3(0.0f), 1.0f);
+    const int32_t       proxy = tree.createProxy(box, 0);
+
+    const glm::vec3 nudge(0.1f, 0.0f, 0.0f);
+    EXPECT_FALSE(tree.moveProxy(proxy, ya::AABB(box.min + nudge, box.max + nudge), nudge));
+
+    const glm::vec3 jump(10.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(tree.moveProxy(proxy, ya::AABB(box.min + jump, box.max + jump), jump));
+    // The fat box is stretched ahead along the motion.
+    EXPECT_GT(tree.getFatAABB(proxy).max.x, box.max.x + jump.x + 0.5f);
+    EXPECT_TRUE(tree.validate());
+}
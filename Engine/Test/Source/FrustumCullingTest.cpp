@@ -0,0 +1,109 @@
+#include "Core/Math/Frustum.h"
+#include "Core/Math/Math.h"
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Camera at the origin looking down -Z (engine is right-handed, [0, 1] depth).
+ya::Frustum makeCameraFrustum()
+{
+    const glm::mat4 projection = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return ya::Frustum::fromViewProjection(projection * view);
+}
+
+ya::AABB boxAt(const glm::vec3& center, float halfSize)
+{
+    return ya::AABB(center - glm::vec3(halfSize), center + glm::vec3(halfSize));
+}
+
+ya::FrustumCullBounds makeRandomBounds(size_t count, uint32_t seed)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+    std::uniform_real_distribution<float> size(0.1f, 5.0f);
+
+    ya::FrustumCullBounds bounds;
+    bounds.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        bounds.push(boxAt(glm::vec3(position(rng), position(rng), position(rng)), size(rng)));
+    }
+    return bounds;
+}
+
+} // namespace
+
+TEST(FrustumCullingTest, ClassifiesBoxesAroundCamera)
+{
+    const ya::Frustum frustum = makeCameraFrustum();
+
+    EXPECT_TRUE(frustum.intersects(boxAt(glm::vec3(0.0f, 0.0f, -10.0f), 1.0f)));
+    EXPECT_FALSE(frustum.intersects(boxAt(glm::vec3(0.0f, 0.0f, 10.0f), 1.0f)));    // behind
+    EXPECT_FALSE(frustum.intersects(boxAt(glm::vec3(0.0f, 0.0f, -150.0f), 1.0f)));  // past far
+    EXPECT_FALSE(frustum.intersects(boxAt(glm::vec3(-100.0f, 0.0f, -10.0f), 1.0f))); // left
+    EXPECT_FALSE(frustum.intersects(boxAt(glm::vec3(0.0f, 100.0f, -10.0f), 1.0f)));  // above
+    // Straddling the left plane still counts as visible.
+    EXPECT_TRUE(frustum.intersects(boxAt(glm::vec3(-10.0f, 0.0f, -10.0f), 4.0f)));
+    // Empty bounds are never culled.
+    EXPECT_TRUE(frustum.intersects(ya::AABB()));
+}
+
+TEST(FrustumCullingTest, NearPlaneMatchesZeroToOneDepth)
+{
+    constexpr float   kNear      = 1.0f;
+    const glm::mat4   projection = ya::FMath::perspective(glm::radians(60.0f), 1.0f, kNear, 100.0f);
+    const glm::mat4   view       = ya::FMath::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const ya::Frustum frustum    = ya::Frustum::fromViewProjection(projection * view);
+
+    // Entirely between the camera and the near plane: clipped on the GPU.
+    const ya::AABB beforeNear = boxAt(glm::vec3(0.0f, 0.0f, -0.75f * kNear), 0.1f * kNear);
+    EXPECT_FALSE(frustum.intersects(beforeNear));
+    EXPECT_EQ(frustum.classify(beforeNear), ya::Frustum::EContainment::Outside);
+
+    EXPECT_TRUE(frustum.intersects(boxAt(glm::vec3(0.0f, 0.0f, -kNear), 0.1f * kNear)));
+    EXPECT_EQ(frustum.classify(boxAt(glm::vec3(0.0f, 0.0f, -1.5f * kNear), 0.1f * kNear)), ya::Frustum::EContainment::Inside);
+}
+
+TEST(FrustumCullingTest, PushTransformedMatchesCornerTransform)
+{
+    const ya::AABB  local(glm::vec3(-1.0f, -2.0f, -0.5f), glm::vec3(3.0f, 1.0f, 0.5f));
+    glm::mat4       world = glm::translate(glm::mat4(1.0f), glm::vec3(4.0f, -2.0f, -20.0f));
+    world                 = glm::rotate(world, glm::radians(37.0f), glm::vec3(0.3f, 1.0f, 0.2f));
+    world                 = glm::scale(world, glm::vec3(2.0f, 0.5f, 1.5f));
+    const ya::AABB  expected = local.transformed(world);
+
+    ya::FrustumCullBounds bounds;
+    bounds.pushTransformed(local, world);
+    ASSERT_EQ(bounds.size(), 1u);
+
+    const glm::vec3 center = expected.getCenter();
+    const glm::vec3 extent = expected.getExtent() * 0.5f;
+    EXPECT_NEAR(bounds.centerX[0], center.x, 1e-4f);
+    EXPECT_NEAR(bounds.centerY[0], center.y, 1e-4f);
+    EXPECT_NEAR(bounds.centerZ[0], center.z, 1e-4f);
+    EXPECT_NEAR(bounds.extentX[0], extent.x, 1e-4f);
+    EXPECT_NEAR(bounds.extentY[0], extent.y, 1e-4f);
+    EXPECT_NEAR(bounds.extentZ[0], extent.z, 1e-4f);
+}
+
+TEST(FrustumCullingTest, SimdKernelMatchesScalar)
+{
+    const ya::Frustum frustum = makeCameraFrustum();
+    // Odd count so the scalar tail after the last full SIMD batch is exercised.
+    const ya::FrustumCullBounds bounds = makeRandomBounds(10'003, 7);
+
+    std::vector<uint8_t> simd(bounds.size()), scalar(bounds.size());
+    const size_t simdVisible   = ya::FrustumCulling::cull(frustum, bounds, simd);
+    const size_t scalarVisible = ya::FrustumCulling::cullScalar(frustum, bounds, scalar);
+
+    EXPECT_EQ(simdVisible, scalarVisible);
+    EXPECT_EQ(simd, scalar);
+    EXPECT_GT(simdVisible, 0u);
+    EXPECT_LT(simdVisible, bounds.size());
+}
@@ -0,0 +1,185 @@
+#include "Core/Profiling/Instrumentor.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+std::filesystem::path makeProfilePath(const char* fileName)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "ya_instrumentor_test";
+    std::filesystem::create_directories(dir);
+    return dir / fileName;
+}
+
+void beginSession(ya::EInstrumentorBackend backend, const std::filesystem::path& path)
+{
+    auto& instrumentor = ya::Instrumentor::Get();
+    auto  config       = instrumentor.GetConfig();
+    config.backend     = backend;
+    instrumentor.SetConfig(config);
+    instrumentor.BeginSession("InstrumentorTest", path.string());
+}
+
+void nestedScopes(int iterations)
+{
+    for (int i = 0; i < iterations; ++i) {
+        ya::InstrumentationTimer outer("InstrumentorTest::outer");
+        ya::InstrumentationTimer inner("InstrumentorTest::inner");
+    }
+}
+
+// Every profile must close what it opens, in LIFO order, or speedscope rejects the file.
+void expectBalancedProfiles(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    ASSERT_TRUE(file.is_open());
+    const auto json = nlohmann::json::parse(file);
+
+    ASSERT_TRUE(json.contains("profiles"));
+    for (const auto& profile : json["profiles"]) {
+        std::vector<int> stack;
+        for (const auto& event : profile["events"]) {
+            const int frame = event["frame"].get<int>();
+            if (event["type"].get<std::string>() == "O") {
+                stack.push_back(frame);
+            }
+            else {
+                ASSERT_FALSE(stack.empty());
+                EXPECT_EQ(stack.back(), frame);
+                stack.pop_back();
+            }
+        }
+        EXPECT_TRUE(stack.empty());
+    }
+}
+
+} // namespace
+
+TEST(InstrumentorTest, RingBackendWritesBalancedMultiThreadProfile)
+{
+    const auto path = makeProfilePath("ring.json");
+    beginSession(ya::EInstrumentorBackend::ThreadRing, path);
+
+    nestedScopes(100);
+    std::thread worker([]() { nestedScopes(100); });
+    worker.join();
+    {
+        // Runtime-built names are interned and share one frame.
+        const std::string dynamicName = std::string("InstrumentorTest::") + "dynamic";
+        ya::InstrumentationTimer timer(dynamicName);
+    }
+
+    size_t eventCount = 0, droppedScopes = 0;
+    ya::Instrumentor::Get().GetStats(eventCount, droppedScopes);
+    EXPECT_EQ(droppedScopes, 0u);
+    ya::Instrumentor::Get().EndSession();
+
+    ya::Instrumentor::Get().GetStats(eventCount, droppedScopes);
+    EXPECT_EQ(eventCount, 2u * (2u * 100u * 2u + 1u));
+    EXPECT_EQ(droppedScopes, 0u);
+    expectBalancedProfiles(path);
+}
+
+TEST(InstrumentorTest, RingBackendDropsWholeScopesWhenFull)
+{
+    const auto path = makeProfilePath("ring_overflow.json");
+    beginSession(ya::EInstrumentorBackend::ThreadRing, path);
+
+    // Far more than one ring holds between two drains on a busy thread.
+    constexpr int kScopes = 200'000;
+    nestedScopes(kScopes / 2);
+    ya::Instrumentor::Get().EndSession();
+
+    size_t eventCount = 0, droppedScopes = 0;
+    ya::Instrumentor::Get().GetStats(eventCount, droppedScopes);
+    // A kept scope yields two records, a dropped one none.
+    EXPECT_EQ(eventCount + 2 * droppedScopes, 2u * kScopes);
+    expectBalancedProfiles(path);
+}
+
+TEST(InstrumentorTest, RingBackendReleasesRingsOfExitedThreads)
+{
+    ya::InstrumentorRingBackend backend;
+    backend.beginSession();
+
+    constexpr int kThreads = 8;
+    for (int index = 0; index < kThreads; ++index) {
+        std::thread worker([&backend]() {
+            for (int scope = 0; scope < 10; ++scope) {
+                const uint32_t frame = backend.writeBegin("InstrumentorTest::worker", __FILE__, __LINE__);
+                backend.writeEnd(frame);
+            }
+        });
+        worker.join();
+    }
+    backend.endSession();
+
+    // The final drain freed every exited thread's ring but kept its records.
+    EXPECT_EQ(backend.getThreadRingCount(), 0u);
+    EXPECT_EQ(backend.getRecordedCount(), kThreads * 10u * 2u);
+
+    std::vector<ya::SpeedscopeEvent> events;
+    std::vector<ya::SpeedscopeFrame> frames;
+    backend.exportSession(events, frames, false);
+    EXPECT_EQ(events.size(), kThreads * 10u * 2u);
+
+    // The next session starts without the previous threads' records.
+    backend.beginSession();
+    backend.endSession();
+    backend.exportSession(events, frames, false);
+    EXPECT_TRUE(events.empty());
+}
+
+TEST(InstrumentorTest, RingBackendClosesOpenScopesAtSessionEnd)
+{
+    ya::InstrumentorRingBackend backend;
+    backend.beginSession();
+
+    // Left open on this thread; another thread records after it.
+    const uint32_t open = backend.writeBegin("InstrumentorTest::open", __FILE__, __LINE__);
+    ASSERT_NE(open, ya::InstrumentorRingBackend::kInvalidFrame);
+    std::thread worker([&backend]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        backend.writeEnd(backend.writeBegin("InstrumentorTest::later", __FILE__, __LINE__));
+    });
+    worker.join();
+    backend.endSession();
+
+    std::vector<ya::SpeedscopeEvent> events;
+    std::vector<ya::SpeedscopeFrame> frames;
+    backend.exportSession(events, frames, false);
+    ASSERT_EQ(events.size(), 4u);
+
+    double lastAt = 0.0;
+    for (const ya::SpeedscopeEvent& event : events) {
+        lastAt = std::max(lastAt, event.at);
+    }
+    const auto closeOpen = std::ranges::find_if(events, [open](const ya::SpeedscopeEvent& event) {
+        return event.type == ya::SpeedscopeEvent::Type::Close && event.frameIndex == open;
+    });
+    ASSERT_NE(closeOpen, events.end());
+    EXPECT_DOUBLE_EQ(closeOpen->at, lastAt);
+}
+
+TEST(InstrumentorTest, LockedBackendStillProducesSameShape)
+{
+    const auto path = makeProfilePath("locked.json");
+    beginSession(ya::EInstrumentorBackend::Locked, path);
+    nestedScopes(50);
+    ya::Instrumentor::Get().EndSession();
+
+    size_t eventCount = 0, droppedScopes = 0;
+    ya::Instrumentor::Get().GetStats(eventCount, droppedScopes);
+    EXPECT_EQ(eventCount, 2u * 50u * 2u);
+    expectBalancedProfiles(path);
+}
@@ -0,0 +1,201 @@
+#include "Core/Async/JobSystem.h"
+#include "Core/Async/TaskQueue.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+class JobSystemTest : public ya::JobSystemTestSuite
+{
+};
+
+} // namespace
+
+TEST_F(JobSystemTest, ScheduleAndWaitRunsJob)
+{
+    auto&            jobSystem = ya::JobSystem::get();
+    std::atomic<int> value{0};
+
+    const ya::JobHandle job = jobSystem.schedule([&value]() { value.store(42); });
+    jobSystem.wait(job);
+
+    EXPECT_TRUE(jobSystem.isDone(job));
+    EXPECT_EQ(value.load(), 42);
+    EXPECT_TRUE(jobSystem.isDone(ya::JobHandle{}));
+}
+
+TEST_F(JobSystemTest, GroupFinishesAfterAllChildren)
+{
+    auto&            jobSystem = ya::JobSystem::get();
+    std::atomic<int> counter{0};
+
+    const ya::JobHandle group = jobSystem.createGroup();
+    for (int i = 0; i < 1000; ++i) {
+        jobSystem.schedule([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); }, group);
+    }
+    jobSystem.run(group);
+    jobSystem.wait(group);
+
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST_F(JobSystemTest, DependenciesRunInOrder)
+{
+    auto&            jobSystem = ya::JobSystem::get();
+    std::mutex       mutex;
+    std::vector<int> order;
+    auto             record = [&](int id) {
+        std::lock_guard lock(mutex);
+        order.push_back(id);
+    };
+
+    // Create the whole chain before anything runs so ordering comes from dependencies only.
+    const ya::JobHandle first  = jobSystem.create([&]() { record(1); });
+    const ya::JobHandle second = jobSystem.create([&]() { record(2); });
+    const ya::JobHandle third  = jobSystem.create([&]() { record(3); });
+    jobSystem.addDependency(third, second);
+    jobSystem.addDependency(second, first);
+    jobSystem.run(third);
+    jobSystem.run(second);
+    jobSystem.run(first);
+
+    jobSystem.wait(third);
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+    EXPECT_EQ(order[2], 3);
+
+    // A finished dependency is ignored instead of blocking forever.
+    std::atomic<bool> bRan{false};
+    jobSystem.wait(jobSystem.scheduleAfter({first, third}, [&bRan]() { bRan.store(true); }));
+    EXPECT_TRUE(bRan.load());
+}
+
+TEST_F(JobSystemTest, ParallelForCoversEveryIndexOnce)
+{
+    auto&                          jobSystem = ya::JobSystem::get();
+    constexpr uint32_t             count     = 100'003;
+    std::vector<std::atomic<int>> hits(count);
+
+    jobSystem.parallelFor(count, 0, [&hits](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            hits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (uint32_t i = 0; i < count; ++i) {
+        ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    }
+}
+
+TEST_F(JobSystemTest, NestedParallelForFromJobs)
+{
+    auto&                 jobSystem = ya::JobSystem::get();
+    std::atomic<uint64_t> sum{0};
+
+    jobSystem.parallelFor(16, 1, [&](uint32_t, uint32_t) {
+        // Waiting inside a job helps instead of deadlocking the worker.
+        jobSystem.parallelFor(1000, 64, [&sum](uint32_t begin, uint32_t end) {
+            sum.fetch_add(end - begin, std::memory_order_relaxed);
+        });
+    });
+
+    EXPECT_EQ(sum.load(), 16u * 1000u);
+}
+
+TEST_F(JobSystemTest, OversizedCaptureIsBoxed)
+{
+    auto&                   jobSystem = ya::JobSystem::get();
+    std::array<uint64_t, 32> payload{};
+    std::iota(payload.begin(), payload.end(), 1);
+    std::atomic<uint64_t> result{0};
+
+    static_assert(sizeof(payload) > ya::JobSystem::kJobPayloadBytes);
+    jobSystem.wait(jobSystem.schedule([payload, &result]() {
+        result.store(std::accumulate(payload.begin(), payload.end(), uint64_t(0)));
+    }));
+
+    EXPECT_EQ(result.load(), 32u * 33u / 2u);
+}
+
+TEST_F(JobSystemTest, TaskQueueFacadeKeepsSubmitAndCallbackContract)
+{
+    auto& taskQueue = ya::TaskQueue::get();
+    taskQueue.start();
+
+    auto handle = taskQueue.submit([]() { return 7; });
+    EXPECT_EQ(handle.get(), 7);
+    EXPECT_EQ(handle.getStatus(), ya::ETaskStatus::Completed);
+
+    auto failing = taskQueue.submit([]() -> int { throw std::runtime_error("boom"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+    EXPECT_EQ(failing.getStatus(), ya::ETaskStatus::Failed);
+
+    int  delivered = 0;
+    auto withCallback = taskQueue.submitWithCallback([]() { return 5; },
+                                                     [&delivered](int value) { delivered = value; });
+    EXPECT_EQ(withCallback.get(), 5);
+    // The worker pushes the callback right after fulfilling the promise.
+    for (int attempt = 0; attempt < 1000 && delivered == 0; ++attempt) {
+        taskQueue.processMainThreadCallbacks();
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(delivered, 5);
+}
+
+// A frame-critical wait on the main thread must not pick up long background
+// work; only workers run it, and waits inside a background job still help.
+TEST_F(JobSystemTest, FrameWaitsNeverRunBackgroundJobs)
+{
+    auto&                 jobSystem  = ya::JobSystem::get();
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::atomic<uint32_t> ranOnMain{0};
+    std::atomic<uint32_t> nestedItems{0};
+
+    std::vector<ya::JobHandle> background;
+    for (int i = 0; i < 16; ++i) {
+        background.push_back(jobSystem.scheduleBackground([&]() {
+            ranOnMain.fetch_add(std::this_thread::get_id() == mainThread ? 1 : 0);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            jobSystem.parallelFor(64, 8, [&nestedItems](uint32_t begin, uint32_t end) {
+                nestedItems.fetch_add(end - begin, std::memory_order_relaxed);
+            });
+        }));
+    }
+
+    std::atomic<uint32_t> frameItems{0};
+    jobSystem.parallelFor(256, 1, [&frameItems](uint32_t begin, uint32_t end) {
+        frameItems.fetch_add(end - begin, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(frameItems.load(), 256u);
+
+    for (const ya::JobHandle& job : background) {
+        jobSystem.wait(job);
+    }
+    EXPECT_EQ(ranOnMain.load(), 0u);
+    EXPECT_EQ(nestedItems.load(), 16u * 64u);
+}
+
+// A caller blocked on background work of its own (e.g. a physics step it
+// kicked) runs it itself when every worker is busy, instead of idling.
+TEST_F(JobSystemTest, WaitBackgroundRunsBackgroundJobsOnCaller)
+{
+    auto&                jobSystem = ya::JobSystem::get();
+    ya::ParkedJobWorkers parked;
+    std::thread::id      ranOn;
+    const ya::JobHandle  job = jobSystem.scheduleBackground([&ranOn]() { ranOn = std::this_thread::get_id(); });
+    jobSystem.waitBackground(job);
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Core/Async/JobSystem.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <optional>
+#include <thread>
+
+namespace ya
+{
+
+/**
+ * @brief JobSystemTestScope - keeps the JobSystem running for the lifetime of
+ * the scope.
+ *
+ * Starts it only if nothing else did, and stops it only if this scope started
+ * it, so scopes nest and a suite never tears down workers it does not own.
+ */
+class JobSystemTestScope
+{
+  public:
+    explicit JobSystemTestScope(uint32_t numWorkers = 0)
+        : _bStartedHere(!JobSystem::get().isRunning())
+    {
+        if (_bStartedHere) {
+            JobSystem::get().start(numWorkers);
+        }
+    }
+
+    ~JobSystemTestScope()
+    {
+        if (_bStartedHere) {
+            JobSystem::get().stop();
+        }
+    }
+
+    JobSystemTestScope(const JobSystemTestScope&)            = delete;
+    JobSystemTestScope& operator=(const JobSystemTestScope&) = delete;
+
+  private:
+    bool _bStartedHere = false;
+};
+
+/**
+ * @brief Fixture base for suites whose tests all need worker threads: one
+ * JobSystemTestScope with four workers per suite.
+ */
+class JobSystemTestSuite : public ::testing::Test
+{
+  protected:
+    static void SetUpTestSuite() { _scope.emplace(4); }
+    static void TearDownTestSuite() { _scope.reset(); }
+
+  private:
+    static inline std::optional<JobSystemTestScope> _scope;
+};
+
+/**
+ * @brief ParkedJobWorkers - occupies every JobSystem worker until release(),
+ * so the calling thread is the only one left to pick jobs up.
+ *
+ * The JobSystem must be running; destruction releases and waits for them.
+ */
+class ParkedJobWorkers
+{
+  public:
+    ParkedJobWorkers()
+        : _group(JobSystem::get().createGroup())
+    {
+        auto&          jobs    = JobSystem::get();
+        const uint32_t workers = jobs.getWorkerCount();
+        for (uint32_t index = 0; index < workers; ++index) {
+            jobs.schedule([this]() {
+                _parked.fetch_add(1);
+                while (!_bReleased.load()) {
+                    std::this_thread::yield();
+                }
+            }, _group);
+        }
+        jobs.run(_group);
+        // Spin without helping, or this thread could take a parking job itself.
+        while (_parked.load() < workers) {
+            std::this_thread::yield();
+        }
+    }
+
+    ~ParkedJobWorkers()
+    {
+        release();
+        JobSystem::get().wait(_group);
+    }
+
+    ParkedJobWorkers(const ParkedJobWorkers&)            = delete;
+    ParkedJobWorkers& operator=(const ParkedJobWorkers&) = delete;
+
+    /// Let the workers go; safe from any thread.
+    void release() { _bReleased.store(true); }
+
+    /// Finishes once every parked worker was released.
+    [[nodiscard]] JobHandle getGroup() const { return _group; }
+
+  private:
+    JobHandle             _group;
+    std::atomic<uint32_t> _parked{0};
+    std::atomic<bool>     _bReleased{false};
+};
+
+} // namespace ya
@@ -1,5 +1,6 @@
 // 测试Math.h中的3x3矩阵相关功能
 #include "Core/Math/Math.h"
+#include "Core/Math/SimdMath.h"
 #include <gtest/gtest.h>
 
 #include <cmath>
@@ -203,3 +204,22 @@ TEST_F(MathTest, VectorConstants)
     EXPECT_FLOAT_EQ(worldForward.y, 0.0f);
     EXPECT_FLOAT_EQ(worldForward.z, -1.0f);
 }
+
+// 测试共享的 4x4 矩阵乘法与 glm 结果一致
+TEST_F(MathTest, SimdMultiplyMat4MatchesGlm)
+{
+    const glm::mat4 a = glm::translate(glm::vec3(1.0f, -2.0f, 3.0f)) * glm::rotate(0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 0.5f))) *
+                        glm::scale(glm::vec3(2.0f, 0.5f, 1.5f));
+    glm::mat4 b = glm::rotate(-1.2f, glm::vec3(0.0f, 1.0f, 0.0f)) * glm::translate(glm::vec3(-4.0f, 0.25f, 8.0f));
+    b[0][3]     = 0.3f; // non-affine row to exercise every lane
+
+    glm::mat4 out(0.0f);
+    ya::simd_math::multiplyMat4(a, b, out);
+
+    const glm::mat4 expected = a * b;
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            EXPECT_NEAR(out[col][row], expected[col][row], 1e-5f) << col << "," << row;
+        }
+    }
+}
@@ -0,0 +1,385 @@
+#include "Core/Math/Frustum.h"
+#include "Resource/Core/Meta/AssetMeta.h"
+#include "Resource/Core/Model/MeshOptimizer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+/// @p gridSize x @p gridSize quads on the XZ plane, triangles in random order.
+EngineMeshData makeShuffledGrid(uint32_t gridSize, uint32_t seed)
+{
+    EngineMeshData mesh;
+    mesh.name = "Grid";
+    for (uint32_t z = 0; z <= gridSize; ++z) {
+        for (uint32_t x = 0; x <= gridSize; ++x) {
+            ya::Vertex vertex{};
+            vertex.position  = glm::vec3(float(x), 0.0f, float(z));
+            vertex.texCoord0 = glm::vec2(float(x), float(z)) / float(gridSize);
+            vertex.normal    = glm::vec3(0.0f, 1.0f, 0.0f);
+            vertex.tangent   = glm::vec3(1.0f, 0.0f, 0.0f);
+            mesh.vertices.push_back(vertex);
+        }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    const uint32_t                       stride = gridSize + 1;
+    for (uint32_t z = 0; z < gridSize; ++z) {
+        for (uint32_t x = 0; x < gridSize; ++x) {
+            const uint32_t corner = z * stride + x;
+            triangles.push_back({corner, corner + stride, corner + 1});
+            triangles.push_back({corner + 1, corner + stride, corner + stride + 1});
+        }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+    for (const auto& triangle : triangles) {
+        mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+    }
+    return mesh;
+}
+
+/// Latitude/longitude sphere with UVs; the first and last column share
+/// positions but not UVs, so the mesh has one vertical seam.
+EngineMeshData makeUvSphere(uint32_t rings, uint32_t segments)
+{
+    EngineMeshData mesh;
+    mesh.name = "Sphere";
+    for (uint32_t ring = 0; ring <= rings; ++ring) {
+        const float theta = 3.14159265f * float(ring) / float(rings);
+        for (uint32_t segment = 0; segment <= segments; ++segment) {
+            const float phi = 2.0f * 3.14159265f * float(segment % segments) / float(segments);
+            ya::Vertex  vertex{};
+            vertex.position  = glm::vec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+            vertex.texCoord0 = glm::vec2(float(segment) / float(segments), float(ring) / float(rings));
+            vertex.normal    = vertex.position;
+            mesh.vertices.push_back(vertex);
+        }
+    }
+    const uint32_t stride = segments + 1;
+    for (uint32_t ring = 0; ring < rings; ++ring) {
+        for (uint32_t segment = 0; segment < segments; ++segment) {
+            const uint32_t corner = ring * stride + segment;
+            mesh.indices.insert(mesh.indices.end(), {corner, corner + 1, corner + stride});
+            mesh.indices.insert(mesh.indices.end(), {corner + 1, corner + stride + 1, corner + stride});
+        }
+    }
+    return mesh;
+}
+
+bool indicesInRange(std::span<const uint32_t> indices, size_t vertexCount)
+{
+    return std::all_of(indices.begin(), indices.end(), [vertexCount](uint32_t index) { return index < vertexCount; });
+}
+
+/// Triangles as position triples, rotated to a canonical start (winding kept)
+/// and sorted, so index buffers over different vertex orders compare equal.
+std::vector<std::array<glm::vec3, 3>> canonicalTriangles(const EngineMeshData& mesh)
+{
+    const auto less = [](const glm::vec3& lhs, const glm::vec3& rhs) {
+        return std::tie(lhs.x, lhs.y, lhs.z) < std::tie(rhs.x, rhs.y, rhs.z);
+    };
+
+    std::vector<std::array<glm::vec3, 3>> triangles;
+    for (size_t corner = 0; corner < mesh.indices.size(); corner += 3) {
+        std::array<glm::vec3, 3> triangle = {mesh.vertices[mesh.indices[corner]].position,
+                                             mesh.vertices[mesh.indices[corner + 1]].position,
+                                             mesh.vertices[mesh.indices[corner + 2]].position};
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end(), less), triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end(), [&less](const auto& lhs, const auto& rhs) {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), less);
+    });
+    return triangles;
+}
+
+} // namespace
+
+TEST(MeshOptimizerTest, VertexCacheOrderLowersMissRatioAndKeepsTriangles)
+{
+    EngineMeshData  mesh     = makeShuffledGrid(64, 7);
+    const auto      expected = canonicalTriangles(mesh);
+    const auto      before   = mesh_optimizer::analyzeVertexCache(mesh.indices, mesh.vertices.size());
+
+    mesh_optimizer::optimizeVertexCache(mesh.indices, mesh.vertices.size());
+
+    const auto after = mesh_optimizer::analyzeVertexCache(mesh.indices, mesh.vertices.size());
+    EXPECT_EQ(canonicalTriangles(mesh), expected);
+    EXPECT_LT(after.acmr, before.acmr * 0.5f);
+    EXPECT_LT(after.acmr, 1.0f);
+    EXPECT_LT(after.atvr, 1.6f);
+}
+
+TEST(MeshOptimizerTest, OverdrawOrderStaysWithinCacheThreshold)
+{
+    EngineMeshData mesh     = makeShuffledGrid(48, 11);
+    const auto     expected = canonicalTriangles(mesh);
+
+    mesh_optimizer::optimizeVertexCache(mesh.indices, mesh.vertices.size());
+    const auto cacheOnly = mesh_optimizer::analyzeVertexCache(mesh.indices, mesh.vertices.size());
+
+    constexpr float threshold = 1.05f;
+    mesh_optimizer::optimizeOverdraw(mesh.indices, mesh.vertices, threshold);
+    const auto withOverdraw = mesh_optimizer::analyzeVertexCache(mesh.indices, mesh.vertices.size());
+
+    EXPECT_EQ(canonicalTriangles(mesh), expected);
+    // Cluster splits only happen where the local miss ratio allows it; the
+    // merge of trailing clusters can add a little on top.
+    EXPECT_LT(withOverdraw.acmr, cacheOnly.acmr * threshold * 1.25f);
+}
+
+TEST(MeshOptimizerTest, VertexFetchRenumbersInFirstUseOrder)
+{
+    EngineMeshData mesh = makeShuffledGrid(16, 3);
+    mesh.skeletonVertices.resize(mesh.vertices.size());
+    for (size_t index = 0; index < mesh.vertices.size(); ++index) {
+        mesh.skeletonVertices[index].boneIDs = glm::ivec4(static_cast<int32_t>(index));
+    }
+    // An unreferenced vertex is dropped.
+    mesh.vertices.push_back(ya::Vertex{.position = glm::vec3(-1.0f)});
+    mesh.skeletonVertices.push_back({});
+
+    const auto expected = canonicalTriangles(mesh);
+    const auto original = mesh.vertices;
+    const auto originalSkin = mesh.skeletonVertices;
+
+    const size_t vertexCount = mesh_optimizer::optimizeVertexFetch(mesh);
+    EXPECT_EQ(vertexCount, original.size() - 1);
+    ASSERT_EQ(mesh.vertices.size(), vertexCount);
+    ASSERT_EQ(mesh.skeletonVertices.size(), vertexCount);
+    EXPECT_EQ(canonicalTriangles(mesh), expected);
+
+    uint32_t nextNew = 0;
+    for (const uint32_t index : mesh.indices) {
+        ASSERT_LE(index, nextNew);
+        nextNew = std::max(nextNew, index + 1);
+    }
+
+    // Skinning data followed its vertex.
+    for (size_t index = 0; index < vertexCount; ++index) {
+        const auto sourceIndex = static_cast<size_t>(mesh.skeletonVertices[index].boneIDs.x);
+        EXPECT_EQ(mesh.vertices[index].position, original[sourceIndex].position);
+        EXPECT_EQ(mesh.skeletonVertices[index].boneIDs, originalSkin[sourceIndex].boneIDs);
+    }
+}
+
+TEST(MeshOptimizerTest, OptimizeMeshSkipsMalformedIndexBuffers)
+{
+    EngineMeshData mesh = makeShuffledGrid(4, 1);
+    mesh.indices.push_back(0);
+    const auto indices = mesh.indices;
+    mesh_optimizer::optimizeMesh(mesh, MeshOptimizationSettings{});
+    EXPECT_EQ(mesh.indices, indices);
+
+    mesh.indices.back() = static_cast<uint32_t>(mesh.vertices.size());
+    mesh.indices.insert(mesh.indices.end(), {0, 1});
+    const auto outOfRange = mesh.indices;
+    mesh_optimizer::optimizeMesh(mesh, MeshOptimizationSettings{});
+    EXPECT_EQ(mesh.indices, outOfRange);
+}
+
+TEST(MeshOptimizerTest, SimplifyCollapsesFlatInteriorAndKeepsBorder)
+{
+    const EngineMeshData mesh = makeShuffledGrid(32, 9);
+
+    float      error  = -1.0f;
+    const auto result = mesh_optimizer::simplify(mesh.indices, mesh.vertices, mesh.indices.size() / 8, 0.01f, &error);
+
+    ASSERT_EQ(result.size() % 3, 0u);
+    ASSERT_TRUE(indicesInRange(result, mesh.vertices.size()));
+    EXPECT_LE(result.size(), mesh.indices.size() / 4);
+    // A plane simplifies without geometric error.
+    EXPECT_FLOAT_EQ(error, 0.0f);
+
+    // The open border is locked, so every border vertex is still referenced.
+    const std::set<uint32_t> used(result.begin(), result.end());
+    for (uint32_t index = 0; index < mesh.vertices.size(); ++index) {
+        const glm::vec3& position = mesh.vertices[index].position;
+        if (position.x == 0.0f || position.z == 0.0f || position.x == 32.0f || position.z == 32.0f) {
+            EXPECT_TRUE(used.contains(index)) << "border vertex " << index << " collapsed";
+        }
+    }
+
+    // Winding is kept: every triangle still faces +Y.
+    for (size_t corner = 0; corner < result.size(); corner += 3) {
+        const glm::vec3 p0 = mesh.vertices[result[corner]].position;
+        const glm::vec3 p1 = mesh.vertices[result[corner + 1]].position;
+        const glm::vec3 p2 = mesh.vertices[result[corner + 2]].position;
+        ASSERT_GT(glm::cross(p1 - p0, p2 - p0).y, 0.0f);
+    }
+}
+
+TEST(MeshOptimizerTest, SimplifyRespectsErrorBoundAndSeams)
+{
+    const EngineMeshData mesh = makeUvSphere(48, 64);
+
+    float      error  = -1.0f;
+    const auto result = mesh_optimizer::simplify(mesh.indices, mesh.vertices, 0, 0.02f, &error);
+    ASSERT_TRUE(indicesInRange(result, mesh.vertices.size()));
+    EXPECT_LT(result.size(), mesh.indices.size() / 2);
+    EXPECT_GT(error, 0.0f);
+    EXPECT_LE(error, 0.02f);
+
+    // Seam vertices (u == 0 and u == 1 on the same position) both survive.
+    const std::set<uint32_t> used(result.begin(), result.end());
+    const uint32_t           stride = 65;
+    for (uint32_t ring = 1; ring < 48; ++ring) {
+        EXPECT_TRUE(used.contains(ring * stride)) << "ring " << ring;
+        EXPECT_TRUE(used.contains(ring * stride + 64)) << "ring " << ring;
+    }
+
+    // A tighter bound simplifies less.
+    const auto tight = mesh_optimizer::simplify(mesh.indices, mesh.vertices, 0, 0.002f);
+    EXPECT_GT(tight.size(), result.size());
+}
+
+TEST(MeshOptimizerTest, LodChainSharesVerticesAndShrinks)
+{
+    EngineMeshData mesh = makeUvSphere(40, 56);
+    const size_t   lod0 = mesh.indices.size();
+    mesh_optimizer::optimizeMesh(mesh, MeshOptimizationSettings{.lodCount = 4, .lodMaxError = 0.1f});
+
+    ASSERT_GE(mesh.lods.size(), 3u);
+    EXPECT_EQ(mesh.lods[0], (MeshLod{.firstIndex = 0, .indexCount = static_cast<uint32_t>(lod0)}));
+    ASSERT_TRUE(indicesInRange(mesh.indices, mesh.vertices.size()));
+
+    uint32_t nextFirst = 0;
+    for (size_t level = 0; level < mesh.lods.size(); ++level) {
+        const MeshLod& lod = mesh.lods[level];
+        EXPECT_EQ(lod.firstIndex, nextFirst);
+        EXPECT_EQ(lod.indexCount % 3, 0u);
+        nextFirst = lod.firstIndex + lod.indexCount;
+        if (level > 0) {
+            EXPECT_LT(lod.indexCount, mesh.lods[level - 1].indexCount);
+            EXPECT_GE(lod.error, mesh.lods[level - 1].error);
+        }
+    }
+    EXPECT_EQ(nextFirst, mesh.indices.size());
+
+    // Disabled chain leaves a single range.
+    EngineMeshData plain = makeUvSphere(40, 56);
+    mesh_optimizer::optimizeMesh(plain, MeshOptimizationSettings{.lodCount = 0});
+    EXPECT_TRUE(plain.lods.empty());
+    EXPECT_EQ(plain.indices.size(), lod0);
+}
+
+TEST(MeshOptimizerTest, MeshletsRespectLimitsAndMirrorLod0)
+{
+    EngineMeshData mesh     = makeUvSphere(64, 96);
+    const auto     expected = canonicalTriangles(mesh);
+    mesh_optimizer::optimizeMesh(mesh, MeshOptimizationSettings{.lodCount = 0});
+    EXPECT_EQ(canonicalTriangles(mesh), expected);
+    ASSERT_FALSE(mesh.meshlets.empty());
+
+    uint32_t nextTriangle = 0;
+    size_t   triangles    = 0;
+    for (const Meshlet& meshlet : mesh.meshlets) {
+        ASSERT_LE(meshlet.vertexCount, Meshlet::MAX_VERTICES);
+        ASSERT_LE(meshlet.triangleCount, Meshlet::MAX_TRIANGLES);
+        ASSERT_EQ(meshlet.triangleOffset, nextTriangle);
+        nextTriangle += meshlet.triangleCount * 3;
+        triangles += meshlet.triangleCount;
+
+        // Local triangles decode to the LOD 0 index range at triangleOffset.
+        for (uint32_t corner = 0; corner < meshlet.triangleCount * 3; ++corner) {
+            const uint8_t local = mesh.meshletTriangles[meshlet.triangleOffset + corner];
+            ASSERT_LT(local, meshlet.vertexCount);
+            ASSERT_EQ(mesh.meshletVertices[meshlet.vertexOffset + local], mesh.indices[meshlet.triangleOffset + corner]);
+        }
+
+        // Bounds hold every vertex and every triangle normal.
+        for (uint32_t local = 0; local < meshlet.vertexCount; ++local) {
+            const glm::vec3& position = mesh.vertices[mesh.meshletVertices[meshlet.vertexOffset + local]].position;
+            ASSERT_LE(glm::length(position - meshlet.center), meshlet.radius * 1.0001f + 1e-6f);
+        }
+        for (uint32_t corner = meshlet.triangleOffset; corner < meshlet.triangleOffset + meshlet.triangleCount * 3; corner += 3) {
+            const glm::vec3& p0     = mesh.vertices[mesh.indices[corner]].position;
+            const glm::vec3& p1     = mesh.vertices[mesh.indices[corner + 1]].position;
+            const glm::vec3& p2     = mesh.vertices[mesh.indices[corner + 2]].position;
+            const glm::vec3  normal = glm::cross(p1 - p0, p2 - p0);
+            if (glm::length(normal) > 0.0f) {
+                ASSERT_GE(glm::dot(glm::normalize(normal), meshlet.coneAxis), meshlet.coneCutoff - 1e-5f);
+            }
+        }
+    }
+    EXPECT_EQ(triangles * 3, mesh.indices.size());
+
+    const float averageTriangles = float(triangles) / float(mesh.meshlets.size());
+    EXPECT_GT(averageTriangles, 80.0f);
+}
+
+TEST(MeshOptimizerTest, MeshletCullingRejectsOnlyHiddenClusters)
+{
+    EngineMeshData mesh = makeUvSphere(64, 96);
+    mesh_optimizer::optimizeMesh(mesh, MeshOptimizationSettings{.lodCount = 0});
+
+    // Everything-passing frustum except the x >= 0 half-space.
+    Frustum frustum;
+    frustum.planes.fill(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    frustum.planes[Frustum::Left] = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+
+    const glm::vec3       camera(0.0f, 0.0f, 4.0f);
+    std::vector<uint32_t> visible;
+    const size_t          visibleCount = mesh_optimizer::cullMeshlets(mesh.meshlets, frustum, camera, visible);
+    ASSERT_EQ(visibleCount, visible.size());
+    EXPECT_LT(visible.size(), mesh.meshlets.size() / 2);
+
+    size_t backfacing = 0;
+    for (uint32_t index = 0; index < mesh.meshlets.size(); ++index) {
+        const Meshlet& meshlet = mesh.meshlets[index];
+        if (std::ranges::binary_search(visible, index)) {
+            EXPECT_GE(meshlet.center.x, -meshlet.radius);
+            continue;
+        }
+        if (meshlet.center.x < -meshlet.radius) {
+            continue;
+        }
+        // Rejected by the cone test: no triangle may face the camera.
+        ++backfacing;
+        for (uint32_t corner = meshlet.triangleOffset; corner < meshlet.triangleOffset + meshlet.triangleCount * 3; corner += 3) {
+            const glm::vec3& p0 = mesh.vertices[mesh.indices[corner]].position;
+            const glm::vec3& p1 = mesh.vertices[mesh.indices[corner + 1]].position;
+            const glm::vec3& p2 = mesh.vertices[mesh.indices[corner + 2]].position;
+            ASSERT_GE(glm::dot(glm::cross(p1 - p0, p2 - p0), p0 - camera), 0.0f);
+        }
+    }
+    EXPECT_GT(backfacing, 0u);
+
+    // Inside the bounds nothing is back-face culled.
+    EXPECT_FALSE(mesh_optimizer::isMeshletBackfacing(mesh.meshlets[0], mesh.meshlets[0].center));
+}
+
+TEST(MeshOptimizerTest, SettingsComeFromAssetMeta)
+{
+    AssetMeta meta = AssetMeta::defaultForModel();
+    EXPECT_EQ(MeshOptimizationSettings::fromMeta(meta), MeshOptimizationSettings{});
+
+    meta.properties["optimizeOverdraw"]  = false;
+    meta.properties["overdrawThreshold"] = 0.5f;
+    meta.properties["buildMeshlets"]     = false;
+    meta.properties["lodCount"]          = 12;
+    meta.properties["lodReduction"]      = 2.0f;
+    const auto settings                  = MeshOptimizationSettings::fromMeta(meta);
+    EXPECT_TRUE(settings.bVertexCache);
+    EXPECT_FALSE(settings.bOverdraw);
+    EXPECT_FLOAT_EQ(settings.overdrawThreshold, 1.0f);
+    EXPECT_FALSE(settings.bMeshlets);
+    EXPECT_EQ(settings.lodCount, 7u);
+    EXPECT_FLOAT_EQ(settings.lodReduction, 0.95f);
+
+    EXPECT_NE(settings.hash(), MeshOptimizationSettings{}.hash());
+    EXPECT_EQ(settings.hash(), MeshOptimizationSettings::fromMeta(meta).hash());
+}
+
+} // namespace ya
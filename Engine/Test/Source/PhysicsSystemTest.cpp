@@ -1,11 +1,18 @@
+#include "Core/Async/JobSystem.h"
 #include "Scene3D/TransformComponent.h"
 #include "Physics/PhysicsBodyComponent.h"
 #include "Physics/PhysicsSystem.h"
 #include "Scene/Core/Scene.h"
 #include "Scene/Runtime/SceneManager.h"
 
+#include "JobSystemTestScope.h"
+
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+#include <vector>
+
 namespace ya
 {
 
@@ -23,8 +30,115 @@ TransformComponent* findFirstPhysicsTransform(Scene& scene)
     return nullptr;
 }
 
+// Drops one dynamic body from y = 5 and records its height after every frame.
+std::vector<float> recordFall(bool bAsyncStep, bool bInterpolate, float dt, int frameCount)
+{
+    SceneManager sceneManager;
+    auto         scene = std::make_shared<Scene>("Fall");
+    Entity* const body = scene->createNode3D("Body")->getEntity();
+    body->addComponent<PhysicsBodyComponent>();
+    auto* const transform = body->getComponent<TransformComponent>();
+    transform->setPosition({0.0f, 5.0f, 0.0f});
+    sceneManager.activateScene(scene);
+
+    PhysicsSystem system;
+    system.setSceneManager(&sceneManager);
+    system.setAsyncStep(bAsyncStep);
+    system.setInterpolateTransforms(bInterpolate);
+    system.init();
+
+    std::vector<float> heights;
+    for (int frame = 0; frame < frameCount; ++frame) {
+        system.onUpdate(dt);
+        heights.push_back(transform->getPosition().y);
+    }
+    system.shutdown();
+    return heights;
+}
+
 } // namespace
 
+// At 240 Hz a snapped transform repeats each 60 Hz step for several frames;
+// interpolated by the accumulator remainder it moves every frame, trailing
+// the latest step by less than one step.
+TEST(PhysicsSystemTest, InterpolatedTransformsMoveEveryFrame)
+{
+    const std::vector<float> snapped      = recordFall(false, false, 1.0f / 240.0f, 80);
+    const std::vector<float> interpolated = recordFall(false, true, 1.0f / 240.0f, 80);
+
+    int repeatedFrames = 0;
+    for (size_t frame = 8; frame < interpolated.size(); ++frame) {
+        repeatedFrames += snapped[frame] == snapped[frame - 1] ? 1 : 0;
+        EXPECT_LT(interpolated[frame], interpolated[frame - 1]) << "frame " << frame;
+        EXPECT_GE(interpolated[frame], snapped[frame] - 1e-5f);
+    }
+    EXPECT_GT(repeatedFrames, 40);
+}
+
+// The async step runs the same batches, applied one frame later.
+TEST(PhysicsSystemTest, AsyncStepTrailsInlineStepByOneFrame)
+{
+    JobSystemTestScope jobScope;
+    auto&              jobs = JobSystem::get();
+
+    const std::vector<float> inlineHeights = recordFall(false, true, 1.0f / 144.0f, 60);
+    const std::vector<float> asyncHeights  = recordFall(true, true, 1.0f / 144.0f, 61);
+    if (jobs.getWorkerCount() > 0) {
+        EXPECT_FLOAT_EQ(asyncHeights[0], 5.0f);
+        for (size_t frame = 0; frame < inlineHeights.size(); ++frame) {
+            EXPECT_NEAR(asyncHeights[frame + 1], inlineHeights[frame], 1e-5f) << "frame " << frame;
+        }
+    }
+    EXPECT_LT(asyncHeights.back(), 4.5f);
+}
+
+// The async step is background work: a parallelFor the game thread issues
+// after the kick must not run it inline, even when a batch waits and the game
+// thread has nothing else to help with.
+TEST(PhysicsSystemTest, MainThreadParallelForDoesNotRunAsyncStep)
+{
+    JobSystemTestScope jobScope;
+    auto&              jobs = JobSystem::get();
+    if (jobs.getWorkerCount() == 0) {
+        GTEST_SKIP() << "async stepping needs a worker thread";
+    }
+
+    SceneManager sceneManager;
+    auto         scene = std::make_shared<Scene>("AsyncStep");
+    Entity* const body = scene->createNode3D("Body")->getEntity();
+    body->addComponent<PhysicsBodyComponent>();
+    body->getComponent<TransformComponent>()->setPosition({0.0f, 5.0f, 0.0f});
+    sceneManager.activateScene(scene);
+
+    PhysicsSystem system;
+    system.setSceneManager(&sceneManager);
+    system.setAsyncStep(true);
+    system.init();
+
+    // With every worker parked the game thread is the only one left that
+    // could pick the step up.
+    ParkedJobWorkers parked;
+    system.onUpdate(1.0f / 30.0f);
+
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::thread           releaser([&parked]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        parked.release();
+    });
+    jobs.parallelFor(8, 1, [&](uint32_t, uint32_t) {
+        if (std::this_thread::get_id() == mainThread) {
+            jobs.wait(parked.getGroup());
+        }
+    });
+    releaser.join();
+    EXPECT_NE(system.getLastStepThread(), mainThread);
+
+    // Waiting for the step still completes it.
+    system.setAsyncStep(false);
+    EXPECT_NE(system.getLastStepThread(), std::thread::id{});
+    system.shutdown();
+}
+
 // Regression: leaving a play session must drop every Jolt body immediately,
 // driven by SceneManager lifecycle events (not by polling in onUpdate). A
 // restarted session clones a fresh scene that can reuse the previous scene's
@@ -0,0 +1,172 @@
+#include "Core/Async/JobSystem.h"
+#include "RHI/Backend/Vulkan/VulkanPipelineCache.h"
+#include "RHI/Core/PipelinePrecompiler.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+ya::VulkanPipelineCacheIdentity makeIdentity(uint32_t driverVersion = 42)
+{
+    ya::VulkanPipelineCacheIdentity identity{.vendorID = 0x10005, .deviceID = 0x0000, .driverVersion = driverVersion};
+    for (uint8_t i = 0; i < VK_UUID_SIZE; ++i) {
+        identity.pipelineCacheUUID[i] = i;
+    }
+    return identity;
+}
+
+/// What vkGetPipelineCacheData returns: the version-one header, then driver data.
+std::vector<uint8_t> makeDriverBlob(const ya::VulkanPipelineCacheIdentity& identity, size_t payloadBytes)
+{
+    VkPipelineCacheHeaderVersionOne header{
+        .headerSize    = sizeof(VkPipelineCacheHeaderVersionOne),
+        .headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE,
+        .vendorID      = identity.vendorID,
+        .deviceID      = identity.deviceID,
+    };
+    std::memcpy(header.pipelineCacheUUID, identity.pipelineCacheUUID.data(), VK_UUID_SIZE);
+
+    std::vector<uint8_t> blob(sizeof(header) + payloadBytes);
+    std::memcpy(blob.data(), &header, sizeof(header));
+    for (size_t i = sizeof(header); i < blob.size(); ++i) {
+        blob[i] = static_cast<uint8_t>(i * 31);
+    }
+    return blob;
+}
+
+class PipelineCacheTest : public ya::JobSystemTestSuite
+{
+  protected:
+    void SetUp() override
+    {
+        _cacheDir = std::filesystem::temp_directory_path() /
+                    ("ya_pipeline_cache_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::remove_all(_cacheDir);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(_cacheDir, ec);
+    }
+
+    std::filesystem::path _cacheDir;
+};
+
+} // namespace
+
+TEST_F(PipelineCacheTest, BlobRoundTripsForTheSameDeviceAndDriver)
+{
+    const auto identity = makeIdentity();
+    const auto path     = ya::vulkan_pipeline_cache::makeCachePath(_cacheDir, identity);
+    EXPECT_EQ(path.filename().string(), "Vulkan_10005_0000.bin");
+
+    const auto blob = makeDriverBlob(identity, 4096);
+    ASSERT_TRUE(ya::vulkan_pipeline_cache::saveBlob(path, identity, blob));
+    EXPECT_EQ(ya::vulkan_pipeline_cache::loadBlob(path, identity), blob);
+
+    // Only the final file remains.
+    size_t files = 0;
+    for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator(_cacheDir)) {
+        ++files;
+    }
+    EXPECT_EQ(files, 1u);
+}
+
+TEST_F(PipelineCacheTest, BlobFromAnotherDriverOrDeviceIsDiscarded)
+{
+    const auto identity = makeIdentity();
+    const auto path     = ya::vulkan_pipeline_cache::makeCachePath(_cacheDir, identity);
+    ASSERT_TRUE(ya::vulkan_pipeline_cache::saveBlob(path, identity, makeDriverBlob(identity, 256)));
+
+    // Driver update with an unchanged pipelineCacheUUID.
+    EXPECT_TRUE(ya::vulkan_pipeline_cache::loadBlob(path, makeIdentity(43)).empty());
+
+    auto otherUUID                 = identity;
+    otherUUID.pipelineCacheUUID[3] = 0xff;
+    EXPECT_TRUE(ya::vulkan_pipeline_cache::loadBlob(path, otherUUID).empty());
+
+    // A driver blob that does not describe the device is never written.
+    EXPECT_FALSE(ya::vulkan_pipeline_cache::saveBlob(path, otherUUID, makeDriverBlob(identity, 256)));
+    EXPECT_FALSE(ya::vulkan_pipeline_cache::saveBlob(path, identity, std::vector<uint8_t>(8, 0)));
+}
+
+TEST_F(PipelineCacheTest, TruncatedOrCorruptFilesAreDiscarded)
+{
+    const auto identity = makeIdentity();
+    const auto path     = ya::vulkan_pipeline_cache::makeCachePath(_cacheDir, identity);
+    ASSERT_TRUE(ya::vulkan_pipeline_cache::saveBlob(path, identity, makeDriverBlob(identity, 1024)));
+
+    const auto fullSize = std::filesystem::file_size(path);
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(fullSize - 7));
+        file.put('\x5a');
+    }
+    EXPECT_TRUE(ya::vulkan_pipeline_cache::loadBlob(path, identity).empty());
+
+    std::filesystem::resize_file(path, fullSize / 2);
+    EXPECT_TRUE(ya::vulkan_pipeline_cache::loadBlob(path, identity).empty());
+    EXPECT_TRUE(ya::vulkan_pipeline_cache::loadBlob(_cacheDir / "missing.bin", identity).empty());
+}
+
+TEST_F(PipelineCacheTest, PrecompilerBuildsAcrossJobWorkers)
+{
+    std::atomic<uint32_t> active{0};
+    std::atomic<uint32_t> peak{0};
+
+    ya::PipelinePrecompiler precompiler;
+    for (int i = 0; i < 24; ++i) {
+        precompiler.add("Permutation" + std::to_string(i), [&, i]() {
+            const uint32_t now = ++active;
+            for (uint32_t seen = peak; now > seen && !peak.compare_exchange_weak(seen, now);) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            --active;
+            return i != 7;
+        });
+    }
+    ASSERT_EQ(precompiler.size(), 24u);
+
+    const auto report = precompiler.build();
+    EXPECT_EQ(report.built, 23u);
+    EXPECT_EQ(report.failed, 1u);
+    EXPECT_EQ(report.failedLabels, (std::vector<std::string>{"Permutation7"}));
+    EXPECT_EQ(precompiler.size(), 0u);
+    if (ya::JobSystem::get().getConcurrency() > 1) {
+        EXPECT_GT(peak.load(), 1u);
+    }
+    EXPECT_GT(report.seconds, 0.0);
+}
+
+TEST_F(PipelineCacheTest, PrecompilerAsyncBuildReportsWhenReady)
+{
+    std::atomic<uint32_t> builds{0};
+
+    ya::PipelinePrecompiler precompiler;
+    for (int i = 0; i < 8; ++i) {
+        precompiler.add("Level" + std::to_string(i), [&]() {
+            ++builds;
+            return true;
+        });
+    }
+    precompiler.buildAsync();
+    const auto report = precompiler.wait();
+    EXPECT_TRUE(precompiler.isReady());
+    EXPECT_TRUE(report.succeeded());
+    EXPECT_EQ(report.built, 8u);
+    EXPECT_EQ(builds.load(), 8u);
+}
@@ -0,0 +1,178 @@
+#include "Render3D/RenderDrawSort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+std::vector<RenderDrawItem> makeItems(size_t count, size_t meshCount, size_t materialCount, uint32_t seed)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_int_distribution<size_t> meshDist(1, meshCount);
+    std::uniform_int_distribution<size_t> matDist(0, materialCount - 1);
+    std::uniform_real_distribution<float> depthDist(0.0f, 10000.0f);
+
+    std::vector<RenderDrawItem> items(count);
+    for (size_t index = 0; index < count; ++index) {
+        items[index] = RenderDrawItem{
+            .mesh          = reinterpret_cast<Mesh*>(meshDist(rng) * 64),
+            .materialIndex = static_cast<uint32_t>(matDist(rng)),
+            .entityId      = static_cast<uint32_t>(index),
+            .sortKey       = depthDist(rng),
+        };
+    }
+    return items;
+}
+
+uint32_t depthOf(const RenderDrawItem& item)
+{
+    return draw_sort_key::quantizeDepth(item.sortKey);
+}
+
+/// Each mesh appears as one contiguous run inside [begin, end).
+bool meshRunsAreContiguous(const std::vector<RenderDrawItem>& items, size_t begin, size_t end)
+{
+    std::vector<const Mesh*> closed;
+    for (size_t index = begin; index < end; ++index) {
+        if (index > begin && items[index].mesh == items[index - 1].mesh) {
+            continue;
+        }
+        if (std::find(closed.begin(), closed.end(), items[index].mesh) != closed.end()) {
+            return false;
+        }
+        closed.push_back(items[index].mesh);
+    }
+    return true;
+}
+
+bool sameEntities(std::vector<RenderDrawItem> a, std::vector<RenderDrawItem> b)
+{
+    auto byEntity = [](const RenderDrawItem& x, const RenderDrawItem& y) { return x.entityId < y.entityId; };
+    std::sort(a.begin(), a.end(), byEntity);
+    std::sort(b.begin(), b.end(), byEntity);
+    for (size_t index = 0; index < a.size(); ++index) {
+        if (a[index].entityId != b[index].entityId || a[index].mesh != b[index].mesh) {
+            return false;
+        }
+    }
+    return a.size() == b.size();
+}
+
+} // namespace
+
+TEST(RenderDrawSortTest, QuantizedDepthPreservesOrder)
+{
+    EXPECT_EQ(draw_sort_key::quantizeDepth(0.0f), 0u);
+    EXPECT_EQ(draw_sort_key::quantizeDepth(-4.0f), 0u);
+    EXPECT_LT(draw_sort_key::quantizeDepth(1.0f), draw_sort_key::quantizeDepth(2.0f));
+    EXPECT_LT(draw_sort_key::quantizeDepth(0.001f), draw_sort_key::quantizeDepth(0.002f));
+    EXPECT_LE(draw_sort_key::quantizeDepth(5.0f), draw_sort_key::quantizeDepth(5.001f));
+    EXPECT_LT(draw_sort_key::quantizeDepth(9999.0f), 1u << draw_sort_key::kDepthBits);
+}
+
+TEST(RenderDrawSortTest, MaterialMeshFrontToBackGroupsThenOrdersByDepth)
+{
+    const auto            input = makeItems(20'000, 97, 37, 1);
+    auto                  items = input;
+    RenderDrawSortScratch scratch;
+    sortDrawItemsByKey(items, EDrawSortMode::MaterialMeshFrontToBack, scratch);
+
+    ASSERT_TRUE(sameEntities(input, items));
+    size_t runBegin = 0;
+    for (size_t index = 1; index <= items.size(); ++index) {
+        if (index < items.size()) {
+            const auto& prev = items[index - 1];
+            const auto& cur  = items[index];
+            ASSERT_LE(prev.materialIndex, cur.materialIndex);
+            if (prev.materialIndex == cur.materialIndex && prev.mesh == cur.mesh) {
+                ASSERT_LE(depthOf(prev), depthOf(cur));
+            }
+            if (prev.materialIndex == cur.materialIndex) {
+                continue;
+            }
+        }
+        EXPECT_TRUE(meshRunsAreContiguous(items, runBegin, index));
+        runBegin = index;
+    }
+}
+
+TEST(RenderDrawSortTest, MeshFrontToBackIgnoresMaterial)
+{
+    const auto            input = makeItems(5'000, 13, 200'000, 2);
+    auto                  items = input;
+    RenderDrawSortScratch scratch;
+    sortDrawItemsByKey(items, EDrawSortMode::MeshFrontToBack, scratch);
+
+    ASSERT_TRUE(sameEntities(input, items));
+    EXPECT_TRUE(meshRunsAreContiguous(items, 0, items.size()));
+    for (size_t index = 1; index < items.size(); ++index) {
+        if (items[index - 1].mesh == items[index].mesh) {
+            ASSERT_LE(depthOf(items[index - 1]), depthOf(items[index]));
+        }
+    }
+}
+
+TEST(RenderDrawSortTest, BackToFrontOrdersFarthestFirst)
+{
+    const auto            input = makeItems(5'000, 8, 4, 3);
+    auto                  items = input;
+    RenderDrawSortScratch scratch;
+    sortDrawItemsByKey(items, EDrawSortMode::BackToFront, scratch);
+
+    ASSERT_TRUE(sameEntities(input, items));
+    for (size_t index = 1; index < items.size(); ++index) {
+        const auto& prev = items[index - 1];
+        const auto& cur  = items[index];
+        ASSERT_GE(depthOf(prev), depthOf(cur));
+        if (depthOf(prev) == depthOf(cur)) {
+            ASSERT_LE(prev.materialIndex, cur.materialIndex);
+        }
+    }
+}
+
+TEST(RenderDrawSortTest, EqualKeysKeepExtractionOrder)
+{
+    std::vector<RenderDrawItem> items(64);
+    for (size_t index = 0; index < items.size(); ++index) {
+        items[index] = RenderDrawItem{
+            .mesh          = reinterpret_cast<Mesh*>(64),
+            .materialIndex = static_cast<uint32_t>(index % 2),
+            .entityId      = static_cast<uint32_t>(index),
+            .sortKey       = 1.0f,
+        };
+    }
+    RenderDrawSortScratch scratch;
+    sortDrawItemsByKey(items, EDrawSortMode::MaterialMeshFrontToBack, scratch);
+
+    for (size_t index = 0; index < items.size(); ++index) {
+        const size_t expected = index < 32 ? index * 2 : (index - 32) * 2 + 1;
+        EXPECT_EQ(items[index].entityId, expected);
+    }
+}
+
+TEST(RenderDrawSortTest, OversizedMaterialIndexFallsBackToComparator)
+{
+    auto input = makeItems(1'000, 16, 8, 4);
+    input[17].materialIndex = draw_sort_key::kMaxMaterialIndex + 5;
+
+    auto                  items    = input;
+    auto                  expected = input;
+    RenderDrawSortScratch scratch;
+    sortDrawItemsByKey(items, EDrawSortMode::MaterialMeshFrontToBack, scratch);
+    sortDrawItemsByComparator(expected, EDrawSortMode::MaterialMeshFrontToBack);
+
+    ASSERT_EQ(items.size(), expected.size());
+    for (size_t index = 0; index < items.size(); ++index) {
+        EXPECT_EQ(items[index].entityId, expected[index].entityId);
+    }
+    EXPECT_EQ(items.back().materialIndex, draw_sort_key::kMaxMaterialIndex + 5);
+}
+
+} // namespace ya
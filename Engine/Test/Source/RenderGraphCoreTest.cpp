@@ -374,6 +374,201 @@ std::vector<RGBufferStatePlan> collectBufferStatePlans(const RGCompiledGraph& co
     return states;
 }
 
+/// Imported swapchain target, shadow/GBuffer/lighting raster passes, an
+/// aliasable compute chain and a readback copy: the shape of a typical frame.
+struct CacheTestFrame
+{
+    RGTextureHandle swapchain{};
+    RGTextureHandle lighting{};
+    RGBufferHandle  readback{};
+};
+
+CacheTestFrame declareCacheTestFrame(RenderGraph& graph, const std::shared_ptr<TestImage>& swapchainImage, TestBuffer& readbackBuffer, uint32_t bloomBytes)
+{
+    CacheTestFrame frame;
+    frame.swapchain = graph.importTexture(RGImportedTextureDesc{
+        .desc = RGTextureDesc{
+            .label  = "swapchain",
+            .format = EFormat::B8G8R8A8_UNORM,
+            .extent = Extent3D{640, 360, 1},
+            .usage  = EImageUsage::ColorAttachment | EImageUsage::TransferDst,
+        },
+        .importDesc = ImportedImageDesc{
+            .label         = "swapchain",
+            .format        = EFormat::B8G8R8A8_UNORM,
+            .usage         = EImageUsage::ColorAttachment | EImageUsage::TransferDst,
+            .initialLayout = EImageLayout::Undefined,
+            .finalLayout   = EImageLayout::PresentSrcKHR,
+        },
+        .resource = makeTestImageResource(swapchainImage), // Native handle/extent come from the image
+    });
+    const auto shadow = graph.createTexture(RGTextureDesc{
+        .label  = "shadow",
+        .format = EFormat::D32_SFLOAT,
+        .extent = Extent3D{1024, 1024, 1},
+        .usage  = EImageUsage::DepthStencilAttachment | EImageUsage::Sampled,
+    });
+    const auto albedo = graph.createTexture(RGTextureDesc{
+        .label  = "gbuffer.albedo",
+        .format = EFormat::R8G8B8A8_UNORM,
+        .extent = Extent3D{640, 360, 1},
+        .usage  = EImageUsage::ColorAttachment | EImageUsage::Sampled,
+    });
+    frame.lighting = graph.createTexture(RGTextureDesc{
+        .label  = "lighting",
+        .format = EFormat::R16G16B16A16_SFLOAT,
+        .extent = Extent3D{640, 360, 1},
+        .usage  = EImageUsage::ColorAttachment | EImageUsage::Sampled,
+    });
+    const auto cullOutput = graph.createBuffer(RGBufferDesc{
+        .label = "cull.output",
+        .usage = EBufferUsage::StorageBuffer,
+        .size  = 256,
+    });
+    const auto bloomA = graph.createBuffer(RGBufferDesc{
+        .label = "bloom.a",
+        .usage = EBufferUsage::StorageBuffer,
+        .size  = bloomBytes,
+    });
+    const auto bloomB = graph.createBuffer(RGBufferDesc{
+        .label = "bloom.b",
+        .usage = EBufferUsage::StorageBuffer | EBufferUsage::TransferSrc,
+        .size  = bloomBytes,
+    });
+    frame.readback = graph.importBuffer(RGImportedBufferDesc{
+        .desc = RGBufferDesc{
+            .label = "readback",
+            .usage = EBufferUsage::TransferDst,
+            .size  = 512,
+        },
+        .buffer       = &readbackBuffer,
+        .initialState = BufferResourceState{.stages = EPipelineStage::Transfer, .access = EResourceAccess::TransferWrite, .size = 512},
+        .finalState   = BufferResourceState{.stages = EPipelineStage::Host, .access = EResourceAccess::HostRead, .size = 512},
+    });
+
+    graph.addPass("cull", [&](RGPassBuilder& pass) {
+        pass.declareCompute();
+        pass.storageWrite(cullOutput);
+    });
+    graph.addPass("shadow", [&](RGPassBuilder& pass) {
+        pass.storageRead(cullOutput);
+        pass.declareRaster({
+            .renderArea = Rect2D{.pos = {0, 0}, .extent = {1024, 1024}},
+            .depth      = RGDepthAttachmentDesc{.depth = shadow, .loadOp = EAttachmentLoadOp::Clear},
+        });
+    });
+    graph.addPass("gbuffer", [&](RGPassBuilder& pass) {
+        pass.storageRead(cullOutput);
+        pass.declareRaster({
+            .renderArea = Rect2D{.pos = {0, 0}, .extent = {640, 360}},
+            .colors     = {{.color = albedo}},
+        });
+    });
+    graph.addPass("lighting", [&](RGPassBuilder& pass) {
+        pass.read(shadow);
+        pass.read(albedo);
+        pass.declareRaster({
+            .renderArea = Rect2D{.pos = {0, 0}, .extent = {640, 360}},
+            .colors     = {{.color = frame.lighting, .clearValue = ClearValue(0.1f, 0.2f, 0.3f, 1.0f)}},
+        });
+    });
+    graph.addPass("bloom.down", [&](RGPassBuilder& pass) {
+        pass.declareCompute();
+        pass.storageWrite(bloomA);
+    });
+    graph.addPass("bloom.up", [&](RGPassBuilder& pass) {
+        pass.declareCompute();
+        pass.storageRead(bloomA);
+        pass.storageWrite(bloomB);
+    });
+    graph.addPass("readback", [&](RGPassBuilder& pass) {
+        pass.declareCopy();
+        pass.transferSrc(bloomB);
+        pass.transferDst(frame.readback);
+    });
+    graph.addPass("composite", [&](RGPassBuilder& pass) {
+        pass.read(frame.lighting);
+        pass.declareRaster({
+            .renderArea = Rect2D{.pos = {0, 0}, .extent = {640, 360}},
+            .colors     = {{.color = frame.swapchain, .finalLayout = EImageLayout::PresentSrcKHR}},
+        });
+    });
+    graph.exportTexture(frame.lighting, "lighting");
+    return frame;
+}
+
+void expectSameCompiledGraph(const RGCompiledGraph& lhs, const RGCompiledGraph& rhs)
+{
+    EXPECT_EQ(lhs.order, rhs.order);
+    EXPECT_EQ(lhs.dependencies, rhs.dependencies);
+    EXPECT_EQ(lhs.issues.size(), rhs.issues.size());
+
+    ASSERT_EQ(lhs.passPlans.size(), rhs.passPlans.size());
+    for (size_t i = 0; i < lhs.passPlans.size(); ++i) {
+        const auto& a = lhs.passPlans[i];
+        const auto& b = rhs.passPlans[i];
+        EXPECT_EQ(a.pass, b.pass);
+        EXPECT_EQ(a.kind, b.kind);
+        EXPECT_EQ(a.rasterPlan.has_value(), b.rasterPlan.has_value());
+        ASSERT_EQ(a.textureStates.size(), b.textureStates.size());
+        for (size_t s = 0; s < a.textureStates.size(); ++s) {
+            EXPECT_EQ(a.textureStates[s].texture, b.textureStates[s].texture);
+            EXPECT_EQ(a.textureStates[s].layout, b.textureStates[s].layout);
+            EXPECT_EQ(a.textureStates[s].subresourceRange.levelCount, b.textureStates[s].subresourceRange.levelCount);
+            EXPECT_EQ(a.textureStates[s].subresourceRange.layerCount, b.textureStates[s].subresourceRange.layerCount);
+        }
+        ASSERT_EQ(a.bufferStates.size(), b.bufferStates.size());
+        for (size_t s = 0; s < a.bufferStates.size(); ++s) {
+            EXPECT_EQ(a.bufferStates[s].buffer, b.bufferStates[s].buffer);
+            EXPECT_EQ(a.bufferStates[s].requiredState.stages, b.bufferStates[s].requiredState.stages);
+            EXPECT_EQ(a.bufferStates[s].requiredState.access, b.bufferStates[s].requiredState.access);
+            EXPECT_EQ(a.bufferStates[s].requiredState.offset, b.bufferStates[s].requiredState.offset);
+            EXPECT_EQ(a.bufferStates[s].requiredState.size, b.bufferStates[s].requiredState.size);
+        }
+    }
+
+    ASSERT_EQ(lhs.exportedTextures.size(), rhs.exportedTextures.size());
+    for (size_t i = 0; i < lhs.exportedTextures.size(); ++i) {
+        EXPECT_EQ(lhs.exportedTextures[i].name, rhs.exportedTextures[i].name);
+        EXPECT_EQ(lhs.exportedTextures[i].texture, rhs.exportedTextures[i].texture);
+    }
+    ASSERT_EQ(lhs.importedTextureFinalizes.size(), rhs.importedTextureFinalizes.size());
+    for (size_t i = 0; i < lhs.importedTextureFinalizes.size(); ++i) {
+        EXPECT_EQ(lhs.importedTextureFinalizes[i].texture, rhs.importedTextureFinalizes[i].texture);
+        EXPECT_EQ(lhs.importedTextureFinalizes[i].finalLayout, rhs.importedTextureFinalizes[i].finalLayout);
+    }
+    ASSERT_EQ(lhs.importedBufferFinalizes.size(), rhs.importedBufferFinalizes.size());
+    for (size_t i = 0; i < lhs.importedBufferFinalizes.size(); ++i) {
+        EXPECT_EQ(lhs.importedBufferFinalizes[i].buffer, rhs.importedBufferFinalizes[i].buffer);
+        EXPECT_EQ(lhs.importedBufferFinalizes[i].finalState.access, rhs.importedBufferFinalizes[i].finalState.access);
+    }
+
+    ASSERT_EQ(lhs.transientBufferLifetimes.size(), rhs.transientBufferLifetimes.size());
+    for (size_t i = 0; i < lhs.transientBufferLifetimes.size(); ++i) {
+        EXPECT_EQ(lhs.transientBufferLifetimes[i].buffer, rhs.transientBufferLifetimes[i].buffer);
+        EXPECT_EQ(lhs.transientBufferLifetimes[i].firstPassIndex, rhs.transientBufferLifetimes[i].firstPassIndex);
+        EXPECT_EQ(lhs.transientBufferLifetimes[i].lastPassIndex, rhs.transientBufferLifetimes[i].lastPassIndex);
+    }
+    ASSERT_EQ(lhs.transientBufferAssignments.size(), rhs.transientBufferAssignments.size());
+    for (size_t i = 0; i < lhs.transientBufferAssignments.size(); ++i) {
+        EXPECT_EQ(lhs.transientBufferAssignments[i].buffer, rhs.transientBufferAssignments[i].buffer);
+        EXPECT_EQ(lhs.transientBufferAssignments[i].slotIndex, rhs.transientBufferAssignments[i].slotIndex);
+    }
+    ASSERT_EQ(lhs.transientBufferSlots.size(), rhs.transientBufferSlots.size());
+    for (size_t i = 0; i < lhs.transientBufferSlots.size(); ++i) {
+        EXPECT_EQ(lhs.transientBufferSlots[i].desc.size, rhs.transientBufferSlots[i].desc.size);
+        EXPECT_EQ(lhs.transientBufferSlots[i].buffers, rhs.transientBufferSlots[i].buffers);
+    }
+    ASSERT_EQ(lhs.transientBufferAliasBoundaries.size(), rhs.transientBufferAliasBoundaries.size());
+    for (size_t i = 0; i < lhs.transientBufferAliasBoundaries.size(); ++i) {
+        EXPECT_EQ(lhs.transientBufferAliasBoundaries[i].previousBuffer, rhs.transientBufferAliasBoundaries[i].previousBuffer);
+        EXPECT_EQ(lhs.transientBufferAliasBoundaries[i].nextBuffer, rhs.transientBufferAliasBoundaries[i].nextBuffer);
+        EXPECT_EQ(lhs.transientBufferAliasBoundaries[i].nextPass, rhs.transientBufferAliasBoundaries[i].nextPass);
+    }
+    EXPECT_EQ(lhs.transientBufferDiagnostics.physicalBytes, rhs.transientBufferDiagnostics.physicalBytes);
+    EXPECT_EQ(lhs.transientBufferDiagnostics.aliasBoundaryCount, rhs.transientBufferDiagnostics.aliasBoundaryCount);
+}
+
 } // namespace
 
 TEST(RenderGraphCoreTest, CreateTextureAllocatesGenerationBackedHandle)
@@ -4720,4 +4915,130 @@ TEST(RenderGraphCoreTest, FrameUploadArenaGrowsAndRetiresPreviousBacking)
     EXPECT_FALSE(arena.allocate(0, 4, 0).has_value());
 }
 
+TEST(RenderGraphCoreTest, CompileCacheReusesPlanForIdenticalTopology)
+{
+    auto swapchainA = std::make_shared<TestImage>(ImageCreateInfo{
+        .label  = "swapchain.0",
+        .format = EFormat::B8G8R8A8_UNORM,
+        .extent = {.width = 640, .height = 360, .depth = 1},
+        .usage  = EImageUsage::ColorAttachment | EImageUsage::TransferDst,
+    });
+    auto swapchainB = std::make_shared<TestImage>(ImageCreateInfo{
+        .label  = "swapchain.1",
+        .format = EFormat::B8G8R8A8_UNORM,
+        .extent = {.width = 641, .height = 360, .depth = 1}, // Distinct native handle
+        .usage  = EImageUsage::ColorAttachment | EImageUsage::TransferDst,
+    });
+    TestBuffer readback(BufferCreateInfo{.label = "readback", .usage = EBufferUsage::TransferDst, .size = 512});
+
+    RGCompileCache cache;
+
+    // Frame 0: miss, the cached plan equals an uncached compile.
+    RenderGraph frame0;
+    declareCacheTestFrame(frame0, swapchainA, readback, 1024);
+    const RGCompiledGraph compiled0 = cache.compile(frame0);
+    ASSERT_TRUE(compiled0.isValid());
+    EXPECT_FALSE(cache.getStats().bLastHit);
+    expectSameCompiledGraph(compiled0, frame0.compile());
+    EXPECT_GT(compiled0.transientBufferDiagnostics.aliasBoundaryCount, 0u);
+
+    // Frame 1: same declarations against a different swapchain image -> hit.
+    RenderGraph frame1;
+    declareCacheTestFrame(frame1, swapchainB, readback, 1024);
+    const RGCompiledGraph& compiled1 = cache.compile(frame1);
+    EXPECT_TRUE(cache.getStats().bLastHit);
+    expectSameCompiledGraph(compiled1, frame1.compile());
+    expectSameCompiledGraph(compiled1, compiled0);
+
+    // Frame 2: a descriptor changed (bloom buffers resized) -> miss and a new plan.
+    RenderGraph frame2;
+    declareCacheTestFrame(frame2, swapchainA, readback, 4096);
+    const RGCompiledGraph& compiled2 = cache.compile(frame2);
+    EXPECT_FALSE(cache.getStats().bLastHit);
+    expectSameCompiledGraph(compiled2, frame2.compile());
+    EXPECT_GT(compiled2.transientBufferDiagnostics.physicalBytes, compiled0.transientBufferDiagnostics.physicalBytes);
+
+    // Frame 3: one extra pass changes the topology -> miss.
+    RenderGraph frame3;
+    const auto  declared3 = declareCacheTestFrame(frame3, swapchainA, readback, 4096);
+    frame3.addPass("debug.overlay", [&](RGPassBuilder& pass) {
+        pass.read(declared3.lighting);
+        pass.declareCompute();
+    });
+    const RGCompiledGraph& compiled3 = cache.compile(frame3);
+    EXPECT_FALSE(cache.getStats().bLastHit);
+    expectSameCompiledGraph(compiled3, frame3.compile());
+    EXPECT_EQ(compiled3.order.size(), compiled2.order.size() + 1);
+
+    EXPECT_EQ(cache.getStats().hitCount, 1u);
+    EXPECT_EQ(cache.getStats().missCount, 3u);
+    EXPECT_GT(cache.getStats().lastSignatureSize, 0u);
+    EXPECT_GE(cache.getStats().totalCompileMs, 0.0);
+}
+
+TEST(RenderGraphCoreTest, CompileCacheDoesNotCacheInvalidGraphs)
+{
+    RGCompileCache cache;
+    for (int frame = 0; frame < 2; ++frame) {
+        RenderGraph graph;
+        const auto  texture = graph.createTexture(RGTextureDesc{
+            .label  = "never-written",
+            .format = EFormat::R8G8B8A8_UNORM,
+            .extent = Extent3D{4, 4, 1},
+            .usage  = EImageUsage::Sampled,
+        });
+        graph.addPass("reader", [&](RGPassBuilder& pass) {
+            pass.read(texture);
+        });
+        EXPECT_FALSE(cache.compile(graph).isValid());
+    }
+    EXPECT_EQ(cache.getStats().hitCount, 0u);
+    EXPECT_EQ(cache.getStats().missCount, 2u);
+}
+
+TEST(RenderGraphCoreTest, ExecutorPrepareReusesCompiledPlanAndRebindsImportedTextures)
+{
+    TestResourceFactory factory;
+    RenderGraphExecutor executor(factory);
+    TestBuffer          readback(BufferCreateInfo{.label = "readback", .usage = EBufferUsage::TransferDst, .size = 512});
+
+    std::vector<std::shared_ptr<TestImage>> swapchainImages;
+    for (uint32_t i = 0; i < 2; ++i) {
+        swapchainImages.push_back(std::make_shared<TestImage>(ImageCreateInfo{
+            .label  = "swapchain",
+            .format = EFormat::B8G8R8A8_UNORM,
+            .extent = {.width = 640 + i, .height = 360, .depth = 1},
+            .usage  = EImageUsage::ColorAttachment | EImageUsage::TransferDst,
+        }));
+    }
+
+    RGCompiledGraph previous;
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        const auto& image = swapchainImages[frame % 2];
+
+        RenderGraph graph;
+        const auto  declared = declareCacheTestFrame(graph, image, readback, 1024);
+        RGCompiledGraph compiled;
+        ASSERT_TRUE(executor.prepare(graph, compiled));
+        EXPECT_EQ(executor.getCompileCacheStats().bLastHit, frame > 0);
+        if (frame > 0) {
+            expectSameCompiledGraph(compiled, previous);
+        }
+
+        const auto* swapchain = executor.getRegistry().resolveTexture(declared.swapchain);
+        ASSERT_NE(swapchain, nullptr);
+        EXPECT_EQ(swapchain->getImage(), image.get());
+        previous = compiled;
+    }
+    EXPECT_EQ(executor.getCompileCacheStats().hitCount, 3u);
+    EXPECT_EQ(executor.getCompileCacheStats().missCount, 1u);
+
+    executor.clear();
+    RenderGraph graph;
+    declareCacheTestFrame(graph, swapchainImages[0], readback, 1024);
+    RGCompiledGraph compiled;
+    ASSERT_TRUE(executor.prepare(graph, compiled));
+    EXPECT_FALSE(executor.getCompileCacheStats().bLastHit);
+}
+
 } // namespace ya
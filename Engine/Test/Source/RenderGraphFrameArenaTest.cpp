@@ -0,0 +1,263 @@
+#include "Graph/RenderGraph.h"
+#include "Graph/RenderGraphCompileCache.h"
+#include "Graph/RenderGraphFrameArena.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+struct SyntheticFrameState
+{
+    uint32_t executedPasses = 0;
+    float    exposure       = 1.0f;
+    uint32_t width          = 1280;
+    uint32_t height         = 720;
+};
+
+RGTextureDesc makeTargetDesc(const char* label, EFormat::T format, uint32_t width, uint32_t height, EImageUsage::T usage)
+{
+    return RGTextureDesc{
+        .label  = label,
+        .format = format,
+        .extent = Extent3D{width, height, 1},
+        .usage  = usage,
+    };
+}
+
+Rect2D makeArea(uint32_t width, uint32_t height)
+{
+    return Rect2D{.pos = {0, 0}, .extent = {static_cast<float>(width), static_cast<float>(height)}};
+}
+
+// Same pass shape as DeferredFrameGraphOrchestrator: shadow cascades, G-buffer,
+// SSAO, lighting, forward passes, entity id, post-processing and overlay. The
+// execute lambdas capture more than std::function's small buffer holds.
+void declareDeferredShapedFrame(RenderGraph& graph, SyntheticFrameState& state)
+{
+    constexpr auto kColorSampled = EImageUsage::ColorAttachment | EImageUsage::Sampled;
+    constexpr auto kDepthSampled = EImageUsage::DepthStencilAttachment | EImageUsage::Sampled;
+    const uint32_t w             = state.width;
+    const uint32_t h             = state.height;
+
+    const auto shadow   = graph.createTexture(makeTargetDesc("shadow.atlas", EFormat::D32_SFLOAT, 2048, 2048, kDepthSampled));
+    const auto albedo   = graph.createTexture(makeTargetDesc("gbuffer.albedo", EFormat::R8G8B8A8_UNORM, w, h, kColorSampled));
+    const auto normal   = graph.createTexture(makeTargetDesc("gbuffer.normal", EFormat::R16G16B16A16_SFLOAT, w, h, kColorSampled));
+    const auto material = graph.createTexture(makeTargetDesc("gbuffer.orm", EFormat::R8G8B8A8_UNORM, w, h, kColorSampled));
+    const auto depth    = graph.createTexture(makeTargetDesc("gbuffer.depth", EFormat::D32_SFLOAT, w, h, kDepthSampled));
+    const auto ssao     = graph.createTexture(makeTargetDesc("ssao", EFormat::R8G8B8A8_UNORM, w, h, kColorSampled));
+    const auto lighting = graph.createTexture(makeTargetDesc("lighting", EFormat::R16G16B16A16_SFLOAT, w, h, kColorSampled));
+    const auto entityId = graph.createTexture(makeTargetDesc("entity.id", EFormat::R8G8B8A8_UNORM, w, h, kColorSampled));
+    const auto post     = graph.createTexture(makeTargetDesc("post.output", EFormat::R8G8B8A8_UNORM, w, h, kColorSampled));
+
+    for (uint32_t cascade = 0; cascade < 4; ++cascade) {
+        [[maybe_unused]] const auto pass = graph.addPass(
+            "shadow.cascade",
+            [&](RGPassBuilder& builder) {
+                builder.declareRaster({
+                    .renderArea = makeArea(2048, 2048),
+                    .depth      = RGDepthAttachmentDesc{
+                        .depth  = shadow,
+                        .loadOp = cascade == 0 ? EAttachmentLoadOp::Clear : EAttachmentLoadOp::Load,
+                    },
+                });
+            },
+            [&state, shadow, cascade, w, h](RGRenderContext&) { state.executedPasses += cascade + w + h + shadow.index; });
+    }
+
+    [[maybe_unused]] const auto gBufferPass = graph.addPass(
+        "gbuffer",
+        [&](RGPassBuilder& builder) {
+            builder.declareRaster({
+                .renderArea = makeArea(w, h),
+                .colors     = {{.color = albedo}, {.color = normal}, {.color = material}},
+                .depth      = RGDepthAttachmentDesc{.depth = depth, .loadOp = EAttachmentLoadOp::Clear},
+            });
+        },
+        [&state, albedo, normal, material, depth](RGRenderContext&) {
+            state.executedPasses += albedo.index + normal.index + material.index + depth.index;
+        });
+
+    [[maybe_unused]] const auto ssaoPass = graph.addPass(
+        "ssao",
+        [&](RGPassBuilder& builder) {
+            builder.read(normal);
+            builder.read(depth);
+            builder.declareRaster({.renderArea = makeArea(w, h), .colors = {{.color = ssao}}});
+        },
+        [&state, normal, depth, ssao](RGRenderContext&) { state.executedPasses += normal.index + depth.index + ssao.index; });
+
+    [[maybe_unused]] const auto lightPass = graph.addPass(
+        "light",
+        [&](RGPassBuilder& builder) {
+            builder.read(albedo);
+            builder.read(normal);
+            builder.read(material);
+            builder.read(ssao);
+            builder.read(shadow);
+            builder.declareRaster({.renderArea = makeArea(w, h), .colors = {{.color = lighting}}});
+        },
+        [&state, albedo, normal, material, ssao, shadow](RGRenderContext&) {
+            state.executedPasses += albedo.index + normal.index + material.index + ssao.index + shadow.index;
+        });
+
+    for (const char* forwardPass : {"skybox", "forward.transparent"}) {
+        [[maybe_unused]] const auto pass = graph.addPass(
+            forwardPass,
+            [&](RGPassBuilder& builder) {
+                builder.declareRaster({
+                    .renderArea = makeArea(w, h),
+                    .colors     = {{.color = lighting, .loadOp = EAttachmentLoadOp::Load}},
+                    .depth      = RGDepthAttachmentDesc{.depth = depth},
+                });
+            },
+            [&state, lighting, depth, w, h](RGRenderContext&) { state.executedPasses += lighting.index + depth.index + w + h; });
+    }
+
+    [[maybe_unused]] const auto entityIdPass = graph.addPass(
+        "Deferred EntityId",
+        [&](RGPassBuilder& builder) {
+            builder.declareRaster({
+                .renderArea = makeArea(w, h),
+                .colors     = {{.color = entityId}},
+                .depth      = RGDepthAttachmentDesc{.depth = depth},
+            });
+        },
+        [&state, entityId, depth, w, h](RGRenderContext&) { state.executedPasses += entityId.index + depth.index + w + h; });
+
+    [[maybe_unused]] const auto postPass = graph.addPass(
+        "postprocess",
+        [&](RGPassBuilder& builder) {
+            builder.read(lighting);
+            builder.declareRaster({.renderArea = makeArea(w, h), .colors = {{.color = post}}});
+        },
+        [&state, lighting, post, exposure = state.exposure](RGRenderContext&) {
+            state.executedPasses += lighting.index + post.index + static_cast<uint32_t>(exposure);
+        });
+
+    [[maybe_unused]] const auto overlayPass = graph.addPass(
+        "viewport.overlay",
+        [&](RGPassBuilder& builder) {
+            builder.declareRaster({
+                .renderArea = makeArea(w, h),
+                .colors     = {{.color = post, .loadOp = EAttachmentLoadOp::Load}},
+                .depth      = RGDepthAttachmentDesc{.depth = depth},
+            });
+        },
+        [&state, post, depth, w, h](RGRenderContext&) { state.executedPasses += post.index + depth.index + w + h; });
+
+    graph.exportTexture(post, "viewport.color");
+    graph.exportTexture(entityId, "viewport.entity");
+}
+
+} // namespace
+
+TEST(RenderGraphFrameArenaTest, AlignsAllocationsAndRewindsOnReset)
+{
+    RGFrameArena arena(4096);
+
+    void* first = arena.allocate(3, 1);
+    void* wide  = arena.allocate(16, 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % 64, 0u);
+    EXPECT_GE(arena.getStats().bytesUsed, 19u);
+    EXPECT_EQ(arena.getStats().upstreamAllocationCount, 1u);
+
+    arena.reset();
+    EXPECT_EQ(arena.getStats().bytesUsed, 0u);
+    EXPECT_EQ(arena.getStats().resetCount, 1u);
+    EXPECT_EQ(arena.allocate(3, 1), first);
+    EXPECT_EQ(arena.getStats().upstreamAllocationCount, 1u);
+}
+
+TEST(RenderGraphFrameArenaTest, ResetFoldsOverflowBlocksIntoOne)
+{
+    RGFrameArena arena(4096);
+
+    [[maybe_unused]] void* a = arena.allocate(3000, 8);
+    [[maybe_unused]] void* b = arena.allocate(3000, 8);
+    EXPECT_EQ(arena.getStats().blockCount, 2u);
+    EXPECT_EQ(arena.getStats().upstreamAllocationCount, 2u);
+    const size_t overflowCapacity = arena.getStats().capacity;
+
+    arena.reset();
+    EXPECT_EQ(arena.getStats().blockCount, 1u);
+    EXPECT_EQ(arena.getStats().capacity, overflowCapacity);
+    EXPECT_EQ(arena.getStats().upstreamAllocationCount, 3u);
+
+    // The same frame now fits in the folded block.
+    a = arena.allocate(3000, 8);
+    b = arena.allocate(3000, 8);
+    EXPECT_EQ(arena.getStats().blockCount, 1u);
+    EXPECT_EQ(arena.getStats().upstreamAllocationCount, 3u);
+    EXPECT_GE(arena.getStats().peakBytesUsed, 6000u);
+}
+
+TEST(RenderGraphFrameArenaTest, GraphDestroysExecuteCallablesAndKeepsEmptyExecute)
+{
+    RGFrameArena arena;
+    auto         token = std::make_shared<int>(7);
+    {
+        RenderGraph graph(&arena);
+        const auto  texture = graph.createTexture(makeTargetDesc("target", EFormat::R8G8B8A8_UNORM, 64, 64, EImageUsage::ColorAttachment));
+        const auto  withExecute = graph.addPass(
+            "with.execute",
+            [&](RGPassBuilder& builder) {
+                builder.declareRaster({.renderArea = makeArea(64, 64), .colors = {{.color = texture}}});
+            },
+            [token](RGRenderContext&) { ++*token; });
+        const auto withoutExecute = graph.addPass(
+            "without.execute",
+            [&](RGPassBuilder& builder) {
+                builder.declareRaster({
+                    .renderArea = makeArea(64, 64),
+                    .colors     = {{.color = texture, .loadOp = EAttachmentLoadOp::Load}},
+                });
+            },
+            std::function<void(RGRenderContext&)>{});
+
+        EXPECT_EQ(token.use_count(), 2);
+        ASSERT_NE(graph.getPass(withExecute), nullptr);
+        ASSERT_NE(graph.getPass(withoutExecute), nullptr);
+        EXPECT_TRUE(static_cast<bool>(graph.getPass(withExecute)->execute));
+        EXPECT_FALSE(static_cast<bool>(graph.getPass(withoutExecute)->execute));
+        EXPECT_EQ(graph.getPass(withExecute)->name, "with.execute");
+        EXPECT_EQ(graph.getPasses().get_allocator().resource(), &arena);
+        EXPECT_TRUE(graph.compile().isValid());
+    }
+    EXPECT_EQ(token.use_count(), 1);
+    EXPECT_GT(arena.getStats().bytesUsed, 0u);
+}
+
+TEST(RenderGraphFrameArenaTest, ArenaCompilesSamePlanAsDefaultResource)
+{
+    SyntheticFrameState state;
+    RGFrameArena        arena;
+
+    RenderGraph heapGraph;
+    declareDeferredShapedFrame(heapGraph, state);
+    RenderGraph arenaGraph(&arena);
+    declareDeferredShapedFrame(arenaGraph, state);
+
+    std::vector<uint8_t> heapSignature;
+    std::vector<uint8_t> arenaSignature;
+    RGCompileCache::writeSignature(heapGraph, heapSignature);
+    RGCompileCache::writeSignature(arenaGraph, arenaSignature);
+    EXPECT_EQ(heapSignature, arenaSignature);
+
+    const RGCompiledGraph heapCompiled  = heapGraph.compile();
+    const RGCompiledGraph arenaCompiled = arenaGraph.compile();
+    ASSERT_TRUE(heapCompiled.isValid());
+    ASSERT_TRUE(arenaCompiled.isValid());
+    EXPECT_EQ(heapCompiled.order, arenaCompiled.order);
+    EXPECT_EQ(heapCompiled.dependencies.size(), arenaCompiled.dependencies.size());
+    EXPECT_EQ(heapCompiled.passPlans.size(), arenaCompiled.passPlans.size());
+}
+
+} // namespace ya
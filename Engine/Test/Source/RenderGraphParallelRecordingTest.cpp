@@ -0,0 +1,186 @@
+#include "Core/Async/JobSystem.h"
+#include "Graph/RenderGraph.h"
+#include "Graph/RenderGraphCommandStream.h"
+#include "Graph/RenderGraphExecutor.h"
+
+#include "JobSystemTestScope.h"
+#include "RenderGraphTestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ya
+{
+
+using namespace render_graph_test;
+
+TEST(RenderGraphParallelRecordingTest, CommandStreamReplaysInOrderAndOwnsTransientData)
+{
+    RGCommandStream stream;
+    {
+        const std::string label = "transient label";
+        stream.debugBeginLabel(label.c_str());
+        for (uint32_t index = 0; index < 3; ++index) {
+            const uint32_t constant = 7 + index;
+            stream.pushConstants(nullptr, EShaderStage::Vertex, 4, sizeof(constant), &constant);
+            stream.draw(3, 1, index, 0);
+        }
+        stream.bindDescriptorSets(nullptr, 1, {DescriptorSetHandle{}});
+        stream.beginRendering(RenderingInfo{.label = "transient scope"});
+        stream.endRendering(RenderingInfo{.label = "transient scope"});
+        stream.debugEndLabel();
+    }
+    auto retained = std::make_shared<int>(42);
+    stream.retainResource(retained);
+    EXPECT_EQ(stream.getCommandCount(), 11u);
+
+    LoggingCommandBuffer target;
+    stream.replay(target);
+    const std::vector<std::string> expected{
+        "label transient label",
+        "pushConstants 4 4 7",
+        "draw 3 1 0 0",
+        "pushConstants 4 4 8",
+        "draw 3 1 1 0",
+        "pushConstants 4 4 9",
+        "draw 3 1 2 0",
+        "bindDescriptorSets 1 1",
+        "beginRendering",
+        "endRendering",
+        "endLabel",
+    };
+    EXPECT_EQ(target.log, expected);
+    ASSERT_EQ(target.retainedResources.size(), 1u);
+    EXPECT_EQ(target.retainedResources.front().get(), retained.get());
+    EXPECT_TRUE(stream.retainedResources.empty());
+
+    // Storage is reused after clear().
+    stream.clear();
+    EXPECT_TRUE(stream.isEmpty());
+    stream.dispatch(1, 2, 3);
+    LoggingCommandBuffer second;
+    stream.replay(second);
+    EXPECT_EQ(second.log, std::vector<std::string>{"dispatch 1 2 3"});
+}
+
+TEST(RenderGraphParallelRecordingTest, ParallelRecordingMatchesSerialStream)
+{
+    JobSystemTestScope jobs;
+
+    auto              retained = std::make_shared<int>(7);
+    ParallelTestFrame frame(16, retained);
+    ASSERT_TRUE(frame.graph.compile().isValid());
+
+    TestResourceFactory  serialFactory;
+    RenderGraphExecutor  serialExecutor(serialFactory);
+    LoggingCommandBuffer serialCmd;
+    ASSERT_TRUE(serialExecutor.execute(frame.graph, serialCmd));
+
+    TestResourceFactory parallelFactory;
+    RenderGraphExecutor parallelExecutor(parallelFactory);
+    parallelExecutor.setParallelRecording(true);
+    for (int frameIndex = 0; frameIndex < 3; ++frameIndex) {
+        LoggingCommandBuffer parallelCmd;
+        ASSERT_TRUE(parallelExecutor.execute(frame.graph, parallelCmd));
+
+        // Byte-for-byte the same primary stream, barriers included.
+        EXPECT_EQ(parallelCmd.log, serialCmd.log);
+        EXPECT_EQ(parallelCmd.retainedResources.size(), serialCmd.retainedResources.size());
+
+        const auto& stats = parallelExecutor.getParallelRecordingStats();
+        EXPECT_GE(stats.batchCount, 1u);
+        EXPECT_EQ(stats.parallelPassCount, ParallelTestFrame::kParallelPassCount);
+        EXPECT_GT(stats.recordedCommandCount, 0u);
+    }
+}
+
+TEST(RenderGraphParallelRecordingTest, SecondaryCommandBuffersExecuteInSerialOrder)
+{
+    JobSystemTestScope jobs;
+
+    auto              retained = std::make_shared<int>(9);
+    ParallelTestFrame frame(16, retained);
+
+    TestResourceFactory  serialFactory;
+    RenderGraphExecutor  serialExecutor(serialFactory);
+    LoggingCommandBuffer serialCmd;
+    ASSERT_TRUE(serialExecutor.execute(frame.graph, serialCmd));
+
+    LoggingSecondaryPool secondaries;
+    TestResourceFactory  parallelFactory;
+    RenderGraphExecutor  parallelExecutor(parallelFactory);
+    parallelExecutor.setParallelRecording(true);
+    parallelExecutor.setSecondaryCommandBufferProvider([&secondaries]() { return secondaries.acquire(); });
+
+    LoggingCommandBuffer parallelCmd;
+    ASSERT_TRUE(parallelExecutor.execute(frame.graph, parallelCmd));
+    EXPECT_EQ(parallelCmd.log, serialCmd.log);
+    EXPECT_EQ(parallelCmd.retainedResources.size(), serialCmd.retainedResources.size());
+
+    const auto& stats = parallelExecutor.getParallelRecordingStats();
+    EXPECT_EQ(stats.parallelPassCount, ParallelTestFrame::kParallelPassCount);
+    EXPECT_EQ(stats.secondaryPassCount, ParallelTestFrame::kParallelPassCount);
+    EXPECT_EQ(stats.recordedCommandCount, 0u); // Nothing went through a stream
+    ASSERT_EQ(secondaries.getBuffers().size(), ParallelTestFrame::kParallelPassCount);
+    for (const auto& secondary : secondaries.getBuffers()) {
+        EXPECT_TRUE(secondary->bEnded);
+        EXPECT_TRUE(secondary->retainedResources.empty());
+    }
+}
+
+TEST(RenderGraphParallelRecordingTest, ProviderWithoutSecondariesFallsBackToStreams)
+{
+    JobSystemTestScope jobs;
+
+    ParallelTestFrame frame(8, nullptr);
+
+    TestResourceFactory  serialFactory;
+    RenderGraphExecutor  serialExecutor(serialFactory);
+    LoggingCommandBuffer serialCmd;
+    ASSERT_TRUE(serialExecutor.execute(frame.graph, serialCmd));
+
+    TestResourceFactory parallelFactory;
+    RenderGraphExecutor parallelExecutor(parallelFactory);
+    parallelExecutor.setParallelRecording(true);
+    parallelExecutor.setSecondaryCommandBufferProvider([]() -> ICommandBuffer* { return nullptr; });
+
+    LoggingCommandBuffer parallelCmd;
+    ASSERT_TRUE(parallelExecutor.execute(frame.graph, parallelCmd));
+    EXPECT_EQ(parallelCmd.log, serialCmd.log);
+    EXPECT_EQ(parallelExecutor.getParallelRecordingStats().secondaryPassCount, 0u);
+    EXPECT_GT(parallelExecutor.getParallelRecordingStats().recordedCommandCount, 0u);
+}
+
+TEST(RenderGraphParallelRecordingTest, FallsBackToSerialWithoutFlaggedRuns)
+{
+    JobSystemTestScope jobs;
+
+    RenderGraph graph;
+    const auto  buffer = graph.createBuffer(RGBufferDesc{
+         .label = "single",
+         .usage = EBufferUsage::StorageBuffer,
+         .size  = 64,
+    });
+    graph.addPass(
+        "lonely",
+        [&](RGPassBuilder& pass) {
+            pass.storageWrite(buffer);
+            pass.allowParallelRecording();
+        },
+        [](RGRenderContext& ctx) { recordPassCommands(ctx.getCommandBuffer(), 1, 2); });
+
+    TestResourceFactory  factory;
+    RenderGraphExecutor  executor(factory);
+    LoggingCommandBuffer cmdBuf;
+    executor.setParallelRecording(true);
+    ASSERT_TRUE(executor.execute(graph, cmdBuf));
+
+    // A single flagged pass is not worth a worker round-trip.
+    EXPECT_EQ(executor.getParallelRecordingStats().parallelPassCount, 0u);
+    EXPECT_FALSE(cmdBuf.log.empty());
+}
+
+} // namespace ya
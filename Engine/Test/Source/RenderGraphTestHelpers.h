@@ -0,0 +1,236 @@
+#pragma once
+
+#include "Graph/RenderGraph.h"
+
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ya::render_graph_test
+{
+
+class TestBuffer final : public IBuffer
+{
+  private:
+    std::string _name;
+    uint32_t    _size = 0;
+
+  public:
+    explicit TestBuffer(const BufferCreateInfo& desc)
+        : _name(desc.label), _size(desc.size)
+    {}
+
+    bool writeData(const void*, uint32_t = 0, uint32_t = 0) override { return true; }
+    bool flush(uint32_t = 0, uint32_t = 0) override { return true; }
+    void unmap() override {}
+    BufferHandle getHandle() const override { return BufferHandle{reinterpret_cast<void*>(static_cast<uintptr_t>(_size + 1))}; }
+    uint32_t getSize() const override { return _size; }
+    bool isHostVisible() const override { return true; }
+    const std::string& getName() const override { return _name; }
+
+  protected:
+    void mapInternal(void** ptr) override { *ptr = nullptr; }
+};
+
+class TestResourceFactory final : public IRenderResourceFactory
+{
+  public:
+    std::vector<std::shared_ptr<IBuffer>> ownedBuffers;
+
+    std::shared_ptr<IBuffer> createBuffer(const BufferCreateInfo& desc) override
+    {
+        auto buffer = std::make_shared<TestBuffer>(desc);
+        ownedBuffers.push_back(buffer);
+        return buffer;
+    }
+    std::shared_ptr<Sampler> createSampler(const SamplerDesc&) override { return nullptr; }
+    std::shared_ptr<IImage> createImage(const ImageCreateInfo&) override { return nullptr; }
+    std::shared_ptr<IImage> importImage(const ImportedImageDesc&) override { return nullptr; }
+    std::shared_ptr<IImageView> createImageView(std::shared_ptr<IImage>, const ImageViewCreateInfo&) override { return nullptr; }
+};
+
+/// Logs every call as text so whole primary streams can be compared. An
+/// executed secondary contributes its log in place.
+class LoggingCommandBuffer final : public ICommandBuffer
+{
+  public:
+    std::vector<std::string> log;
+    bool                     bEnded = false;
+
+    CommandBufferHandle getHandle() const override { return {}; }
+    CommandBufferHandle getTypedHandle() const override { return {}; }
+    bool begin(bool = false) override { return true; }
+    bool end() override
+    {
+        bEnded = true;
+        return true;
+    }
+    void reset() override {}
+    bool executeSecondary(ICommandBuffer& secondary) override
+    {
+        auto& logging = static_cast<LoggingCommandBuffer&>(secondary);
+        log.insert(log.end(), logging.log.begin(), logging.log.end());
+        for (auto& resource : logging.retainedResources) {
+            retainResource(std::move(resource));
+        }
+        logging.clearRetainedResources();
+        return true;
+    }
+    void bindPipeline(IGraphicsPipeline*) override { log.emplace_back("bindPipeline"); }
+    void bindComputePipeline(IComputePipeline*) override { log.emplace_back("bindComputePipeline"); }
+    void bindVertexBuffer(uint32_t binding, const IBuffer*, uint64_t offset = 0) override { log.push_back(std::format("bindVertexBuffer {} {}", binding, offset)); }
+    void bindIndexBuffer(IBuffer*, uint64_t offset = 0, bool = false) override { log.push_back(std::format("bindIndexBuffer {}", offset)); }
+    void draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t firstVertex = 0, uint32_t firstInstance = 0) override
+    {
+        log.push_back(std::format("draw {} {} {} {}", vertexCount, instanceCount, firstVertex, firstInstance));
+    }
+    void drawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) override
+    {
+        log.push_back(std::format("drawIndexed {} {} {} {} {}", indexCount, instanceCount, firstIndex, vertexOffset, firstInstance));
+    }
+    void drawIndirect(IBuffer*, uint64_t, uint32_t, uint32_t) override {}
+    void drawIndexedIndirect(IBuffer*, uint64_t, uint32_t, uint32_t) override {}
+    void drawIndexedIndirectCount(IBuffer*, uint64_t, IBuffer*, uint64_t, uint32_t, uint32_t) override {}
+    void fillBuffer(IBuffer*, uint64_t, uint64_t, uint32_t) override {}
+    void bufferMemoryBarrier(IBuffer* buffer, EPipelineStage::T, EPipelineStage::T, EResourceAccess::T, EResourceAccess::T, uint64_t offset = 0, uint64_t size = 0) override
+    {
+        log.push_back(std::format("barrier {} {} {}", buffer ? buffer->getName() : "", offset, size));
+    }
+    void setViewport(float x, float y, float width, float height, float = 0.0f, float = 1.0f) override { log.push_back(std::format("viewport {} {} {} {}", x, y, width, height)); }
+    void setScissor(int32_t x, int32_t y, uint32_t width, uint32_t height) override { log.push_back(std::format("scissor {} {} {} {}", x, y, width, height)); }
+    void setCullMode(ECullMode::T) override {}
+    void setPolygonMode(EPolygonMode::T) override {}
+    void setDepthBias(float, float, float) override {}
+    void bindDescriptorSets(IPipelineLayout*, uint32_t firstSet, const std::vector<DescriptorSetHandle>& sets, const std::vector<uint32_t>& = {}) override
+    {
+        log.push_back(std::format("bindDescriptorSets {} {}", firstSet, sets.size()));
+    }
+    void bindComputeDescriptorSets(IPipelineLayout*, uint32_t, const std::vector<DescriptorSetHandle>&, const std::vector<uint32_t>& = {}) override {}
+    void pushConstants(IPipelineLayout*, EShaderStage::T, uint32_t offset, uint32_t size, const void* data) override
+    {
+        uint32_t value = 0;
+        if (data && size >= sizeof(value)) {
+            std::memcpy(&value, data, sizeof(value));
+        }
+        log.push_back(std::format("pushConstants {} {} {}", offset, size, value));
+    }
+    void copyBuffer(IBuffer*, IBuffer*, uint64_t, uint64_t = 0, uint64_t = 0) override {}
+    void dispatch(uint32_t x, uint32_t y, uint32_t z) override { log.push_back(std::format("dispatch {} {} {}", x, y, z)); }
+    void dispatchIndirect(IBuffer*, uint64_t = 0) override {}
+    void copyBufferToImage(IBuffer*, IImage*, EImageLayout::T, const std::vector<BufferImageCopy>&) override {}
+    void copyImageToBuffer(IImage*, EImageLayout::T, IBuffer*, const std::vector<BufferImageCopy>&) override {}
+    void copyImage(IImage*, EImageLayout::T, IImage*, EImageLayout::T, const std::vector<ImageCopy>&) override {}
+    void beginRendering(const RenderingInfo&) override { log.emplace_back("beginRendering"); }
+    void endRendering(const RenderingInfo& = {}) override { log.emplace_back("endRendering"); }
+    void transitionImageLayout(IImage*, EImageLayout::T, EImageLayout::T, const ImageSubresourceRange* = nullptr) override {}
+    void transitionImageLayoutAuto(IImage*, EImageLayout::T, const ImageSubresourceRange* = nullptr) override {}
+    void debugBeginLabel(const char* labelName, const float* = nullptr) override { log.push_back(std::format("label {}", labelName ? labelName : "")); }
+    void debugEndLabel() override { log.emplace_back("endLabel"); }
+};
+
+/// Hands out LoggingCommandBuffers as secondaries to any thread, standing in
+/// for IRender::beginSecondaryCommands().
+class LoggingSecondaryPool
+{
+  public:
+    ICommandBuffer* acquire()
+    {
+        std::lock_guard lock(_mutex);
+        return _buffers.emplace_back(std::make_unique<LoggingCommandBuffer>()).get();
+    }
+
+    [[nodiscard]] const std::vector<std::unique_ptr<LoggingCommandBuffer>>& getBuffers() const { return _buffers; }
+
+  private:
+    std::mutex                                         _mutex;
+    std::vector<std::unique_ptr<LoggingCommandBuffer>> _buffers;
+};
+
+/// Stand-in for the per-draw CPU work of a real pass (material lookup,
+/// matrix math); returns a value so the work is not optimized out.
+inline uint32_t simulateDrawWork(uint32_t seed, uint32_t iterations)
+{
+    float value = static_cast<float>(seed);
+    for (uint32_t i = 0; i < iterations; ++i) {
+        value = std::sqrt(value * 1.0001f + static_cast<float>(i));
+    }
+    return static_cast<uint32_t>(value);
+}
+
+/// Records a pass-specific, draw-heavy command sequence.
+inline void recordPassCommands(ICommandBuffer& cmdBuf, uint32_t passId, uint32_t drawCount, uint32_t workPerDraw = 0)
+{
+    const std::string label = std::format("pass {}", passId);
+    cmdBuf.debugBeginLabel(label.c_str());
+    cmdBuf.setViewport(0.0f, 0.0f, 64.0f, 64.0f);
+    cmdBuf.bindDescriptorSets(nullptr, 0, {DescriptorSetHandle{}, DescriptorSetHandle{}});
+    for (uint32_t draw = 0; draw < drawCount; ++draw) {
+        // The push-constant source is a stack temporary; streams must copy it.
+        const uint32_t constant = passId * 100000 + draw;
+        cmdBuf.pushConstants(nullptr, EShaderStage::Vertex, 0, sizeof(constant), &constant);
+        const uint32_t firstInstance = workPerDraw ? simulateDrawWork(draw, workPerDraw) : 0;
+        cmdBuf.drawIndexed(36, 1, draw * 36, 0, firstInstance);
+    }
+    cmdBuf.dispatch(passId, 1, 1);
+    cmdBuf.debugEndLabel();
+}
+
+/// upload -> N parallel-safe shadow/gbuffer-like passes -> serial resolve pass.
+struct ParallelTestFrame
+{
+    static constexpr uint32_t kParallelPassCount = 6;
+
+    RenderGraph graph;
+
+    ParallelTestFrame(uint32_t drawCount, std::shared_ptr<void> retained, uint32_t workPerDraw = 0)
+    {
+        const auto source = graph.createBuffer(RGBufferDesc{
+            .label = "source",
+            .usage = EBufferUsage::StorageBuffer,
+            .size  = 256,
+        });
+        graph.addPass(
+            "upload",
+            [&](RGPassBuilder& pass) { pass.storageWrite(source); },
+            [](RGRenderContext& ctx) { recordPassCommands(ctx.getCommandBuffer(), 0, 1); });
+
+        std::vector<RGBufferHandle> outputs;
+        for (uint32_t index = 0; index < kParallelPassCount; ++index) {
+            const uint32_t passId = index + 1;
+            const auto     output = graph.createBuffer(RGBufferDesc{
+                .label = std::format("output.{}", passId),
+                .usage = EBufferUsage::StorageBuffer,
+                .size  = 64 * passId,
+            });
+            outputs.push_back(output);
+            graph.addPass(
+                std::format("parallel.{}", passId),
+                [&](RGPassBuilder& pass) {
+                    pass.storageRead(source);
+                    pass.storageWrite(output);
+                    pass.allowParallelRecording();
+                },
+                [passId, drawCount, retained, workPerDraw](RGRenderContext& ctx) {
+                    recordPassCommands(ctx.getCommandBuffer(), passId, drawCount, workPerDraw);
+                    if (passId == 2) {
+                        ctx.getCommandBuffer().retainResource(retained);
+                    }
+                });
+        }
+
+        graph.addPass(
+            "resolve",
+            [&](RGPassBuilder& pass) {
+                for (const auto output : outputs) {
+                    pass.storageRead(output);
+                }
+            },
+            [](RGRenderContext& ctx) { recordPassCommands(ctx.getCommandBuffer(), 99, 1); });
+    }
+};
+
+} // namespace ya::render_graph_test
@@ -0,0 +1,105 @@
+#include "Render3D/RenderLodSelection.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace ya
+{
+
+namespace
+{
+
+// Errors relative to the mesh extent, as built by mesh_optimizer::buildLodChain.
+constexpr std::array<MeshLod, 4> LODS = {
+    MeshLod{.firstIndex = 0, .indexCount = 3000, .error = 0.0f},
+    MeshLod{.firstIndex = 3000, .indexCount = 1500, .error = 0.002f},
+    MeshLod{.firstIndex = 4500, .indexCount = 750, .error = 0.01f},
+    MeshLod{.firstIndex = 5250, .indexCount = 375, .error = 0.05f},
+};
+
+} // namespace
+
+TEST(RenderLodSelectionTest, PicksCoarsestLodUnderPixelError)
+{
+    const LodSelectionSettings settings{.maxPixelError = 1.0f, .hysteresis = 0.0f};
+
+    // 2000 px on screen: LOD 1 projects to 4 px, too coarse.
+    EXPECT_EQ(render_lod::selectLod(LODS, 2000.0f, 0, settings), 0u);
+    // 400 px: LOD 1 is 0.8 px, LOD 2 is 4 px.
+    EXPECT_EQ(render_lod::selectLod(LODS, 400.0f, 0, settings), 1u);
+    EXPECT_EQ(render_lod::selectLod(LODS, 80.0f, 0, settings), 2u);
+    EXPECT_EQ(render_lod::selectLod(LODS, 10.0f, 0, settings), 3u);
+
+    // Single-LOD meshes and out-of-range history stay valid.
+    EXPECT_EQ(render_lod::selectLod(std::span(LODS).first(1), 1.0f, 3, settings), 0u);
+    EXPECT_EQ(render_lod::selectLod(LODS, 10.0f, 9, settings), 3u);
+}
+
+TEST(RenderLodSelectionTest, HysteresisKeepsPreviousLodNearThreshold)
+{
+    const LodSelectionSettings settings{.maxPixelError = 1.0f, .hysteresis = 0.25f};
+
+    // LOD 1 crosses 1 px at 500 px on screen. Inside the ±25% band either
+    // level is kept, so a size oscillating around the threshold never flips.
+    for (const float pixels : {450.0f, 500.0f, 550.0f, 460.0f, 540.0f}) {
+        EXPECT_EQ(render_lod::selectLod(LODS, pixels, 0, settings), 0u) << pixels;
+        EXPECT_EQ(render_lod::selectLod(LODS, pixels, 1, settings), 1u) << pixels;
+    }
+
+    // Leaving the band switches.
+    EXPECT_EQ(render_lod::selectLod(LODS, 700.0f, 1, settings), 0u);
+    EXPECT_EQ(render_lod::selectLod(LODS, 350.0f, 0, settings), 1u);
+
+    // Large jumps skip levels instead of stepping one at a time.
+    EXPECT_EQ(render_lod::selectLod(LODS, 10.0f, 0, settings), 3u);
+    EXPECT_EQ(render_lod::selectLod(LODS, 5000.0f, 3, settings), 0u);
+}
+
+TEST(RenderLodSelectionTest, HistoryIsPerEntryAndClearable)
+{
+    const LodSelectionSettings settings{.maxPixelError = 1.0f, .hysteresis = 0.25f};
+    LodHistory                 history;
+
+    const uint64_t a = LodHistory::key(0, 1);
+    const uint64_t b = LodHistory::key(0, 2);
+    // Settle a on LOD 1, then sit inside the band: a keeps it, a fresh b
+    // starts from the strict choice.
+    EXPECT_EQ(history.select(a, LODS, 350.0f, settings, 1), 1u);
+    EXPECT_EQ(history.select(a, LODS, 500.0f, settings, 2), 1u);
+    EXPECT_EQ(history.select(b, LODS, 500.0f, settings, 2), 0u);
+    // Same entity in another view is tracked separately.
+    EXPECT_EQ(history.select(LodHistory::key(1, 1), LODS, 500.0f, settings, 2), 0u);
+
+    history.prune(2 + LodHistory::MAX_AGE);
+    EXPECT_EQ(history.entries.size(), 3u);
+    history.prune(3 + LodHistory::MAX_AGE);
+    EXPECT_TRUE(history.entries.empty());
+
+    // A scene change clears it; the entity id no longer names the same object.
+    EXPECT_EQ(history.select(a, LODS, 350.0f, settings, 4), 1u);
+    history.clear();
+    EXPECT_EQ(history.select(a, LODS, 500.0f, settings, 5), 0u);
+}
+
+TEST(RenderLodSelectionTest, PixelsPerWorldUnitFollowsProjection)
+{
+    glm::mat4 perspective(0.0f);
+    perspective[1][1] = 2.0f; // ~53 degree vertical fov
+    perspective[2][3] = -1.0f;
+
+    // Halving the distance doubles the projected size.
+    const float far  = render_lod::pixelsPerWorldUnit(perspective, 1080.0f, 20.0f);
+    const float near = render_lod::pixelsPerWorldUnit(perspective, 1080.0f, 10.0f);
+    EXPECT_FLOAT_EQ(far, 54.0f);
+    EXPECT_FLOAT_EQ(near, 2.0f * far);
+    // Inside the bounds there is no finite distance; stay finite anyway.
+    EXPECT_GT(render_lod::pixelsPerWorldUnit(perspective, 1080.0f, 0.0f), near);
+
+    glm::mat4 orthographic(1.0f);
+    orthographic[1][1] = 0.1f;
+    EXPECT_FLOAT_EQ(render_lod::pixelsPerWorldUnit(orthographic, 1000.0f, 5.0f),
+                    render_lod::pixelsPerWorldUnit(orthographic, 1000.0f, 500.0f));
+}
+
+} // namespace ya
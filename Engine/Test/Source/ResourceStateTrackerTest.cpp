@@ -3,6 +3,7 @@
 #include "RHI/Backend/Vulkan/VulkanUtils.h"
 
 #include <gtest/gtest.h>
+
 #include <unordered_map>
 
 namespace ya
@@ -54,6 +55,40 @@ class TestImage final : public IImage
     }
 };
 
+ImageSubresourceRange mipRange(uint32_t mip, uint32_t layerCount)
+{
+    return ImageSubresourceRange{
+        .aspectMask     = EImageAspect::Color,
+        .baseMipLevel   = mip,
+        .levelCount     = 1,
+        .baseArrayLayer = 0,
+        .layerCount     = layerCount,
+    };
+}
+
+ImageSubresourceRange layerRange(uint32_t layer)
+{
+    return ImageSubresourceRange{
+        .aspectMask     = EImageAspect::Color,
+        .baseMipLevel   = 0,
+        .levelCount     = 1,
+        .baseArrayLayer = layer,
+        .layerCount     = 1,
+    };
+}
+
+/// Blit-style mip generation: every mip starts as TransferDst and is moved to
+/// TransferSrc once the next level has been written from it.
+size_t generateMips(ResourceStateTracker& tracker, IImage& image)
+{
+    size_t barriers = tracker.transition(image, EImageLayout::TransferDst).size();
+    for (uint32_t mip = 1; mip < image.getMipLevels(); ++mip) {
+        const auto source = mipRange(mip - 1, image.getArrayLayers());
+        barriers += tracker.transition(image, EImageLayout::TransferSrc, &source).size();
+    }
+    return barriers;
+}
+
 } // namespace
 
 TEST(ResourceStateTrackerTest, WholeImageTransitionUsesOneRangeAndDeduplicates)
@@ -211,6 +246,63 @@ TEST(ResourceStateTrackerTest, SetStateTracksFullImageResourceStatePerSubresourc
     EXPECT_EQ(mismatches[0].range.baseArrayLayer, 1u);
 }
 
+TEST(ResourceStateTrackerTest, MipChainTransitionMergesIdenticalMipsIntoOneRange)
+{
+    TestImage            cubemap(EImageLayout::Undefined, 12, 6);
+    ResourceStateTracker tracker;
+
+    EXPECT_EQ(generateMips(tracker, cubemap), 12u);
+
+    // Mips 0..10 are TransferSrc, mip 11 is still TransferDst: two barriers,
+    // not one per mip.
+    const auto transitions = tracker.transition(cubemap, EImageLayout::ShaderReadOnlyOptimal);
+    ASSERT_EQ(transitions.size(), 2u);
+    EXPECT_EQ(transitions[0].oldState.layout, EImageLayout::TransferSrc);
+    EXPECT_EQ(transitions[0].range.baseMipLevel, 0u);
+    EXPECT_EQ(transitions[0].range.levelCount, 11u);
+    EXPECT_EQ(transitions[0].range.layerCount, 6u);
+    EXPECT_EQ(transitions[1].oldState.layout, EImageLayout::TransferDst);
+    EXPECT_EQ(transitions[1].range.baseMipLevel, 11u);
+    EXPECT_EQ(transitions[1].range.levelCount, 1u);
+    EXPECT_EQ(transitions[0].newState.subresourceRange.levelCount, 11u);
+
+    EXPECT_TRUE(tracker.validateLayout(cubemap, EImageLayout::ShaderReadOnlyOptimal).empty());
+}
+
+TEST(ResourceStateTrackerTest, PerLayerWritesCoalesceBackToWholeImageState)
+{
+    TestImage            array(EImageLayout::ShaderReadOnlyOptimal, 1, 256);
+    ResourceStateTracker tracker;
+
+    const auto half = ImageSubresourceRange{
+        .aspectMask     = EImageAspect::Color,
+        .baseMipLevel   = 0,
+        .levelCount     = 1,
+        .baseArrayLayer = 64,
+        .layerCount     = 128,
+    };
+    tracker.setLayout(array, EImageLayout::TransferDst, &half);
+    for (uint32_t layer = 64; layer < 192; layer += 2) {
+        const auto range = layerRange(layer);
+        tracker.setLayout(array, EImageLayout::ColorAttachmentOptimal, &range);
+    }
+
+    // Alternating layers cannot share a range; adjacent equal ones do.
+    const auto mismatches = tracker.validateLayout(array, EImageLayout::ShaderReadOnlyOptimal);
+    ASSERT_EQ(mismatches.size(), 128u);
+    EXPECT_EQ(mismatches.front().range.baseArrayLayer, 64u);
+    EXPECT_EQ(mismatches.front().actualLayout, EImageLayout::ColorAttachmentOptimal);
+
+    for (uint32_t layer = 64; layer < 192; ++layer) {
+        const auto range = layerRange(layer);
+        tracker.setLayout(array, EImageLayout::ShaderReadOnlyOptimal, &range);
+    }
+    EXPECT_TRUE(tracker.validateLayout(array, EImageLayout::ShaderReadOnlyOptimal).empty());
+    const auto transitions = tracker.transition(array, EImageLayout::TransferSrc);
+    ASSERT_EQ(transitions.size(), 1u);
+    EXPECT_EQ(transitions[0].range.layerCount, 256u);
+}
+
 TEST(ResourceStateTrackerTest, AttachmentResourceStatesMapToVulkanAttachmentBits)
 {
     EXPECT_EQ(EPipelineStage::toVk(EPipelineStage::ColorAttachmentOutput), VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
@@ -0,0 +1,239 @@
+#include "Core/Async/JobSystem.h"
+#include "RHI/Shader.h"
+#include "RHI/Shader/ShaderBatchCompiler.h"
+#include "RHI/Shader/ShaderInternal.h"
+
+#include "JobSystemTestScope.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+class ShaderBatchCompilerTest : public ya::JobSystemTestSuite
+{
+  protected:
+    void SetUp() override
+    {
+        _cacheDir = std::filesystem::temp_directory_path() /
+                    ("ya_shader_batch_" + std::to_string(reinterpret_cast<uintptr_t>(this)));
+        std::filesystem::remove_all(_cacheDir);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(_cacheDir, ec);
+    }
+
+    std::filesystem::path _cacheDir;
+};
+
+/// Compiles to a two-word SPIR-V stub; the "source hash" of a key is whatever
+/// the test sets, standing in for edits to the shader or its includes.
+struct FakeShaderProcessor : public ya::IShaderProcessor
+{
+    std::filesystem::path                     cacheDir;
+    std::mutex                                mutex;
+    std::unordered_map<std::string, uint64_t> hashes;
+    std::atomic<uint32_t>                     compiles{0};
+    std::atomic<uint32_t>                     activeCompiles{0};
+    std::atomic<uint32_t>                     peakActiveCompiles{0};
+
+    uint64_t hashOf(const std::string& key)
+    {
+        std::lock_guard lock(mutex);
+        return hashes.try_emplace(key, 1).first->second;
+    }
+
+    std::optional<stage2spirv_t> process(const ya::ShaderDesc& ci, ya::EShaderProcessMode) override
+    {
+        const uint32_t active = ++activeCompiles;
+        for (uint32_t peak = peakActiveCompiles; active > peak && !peakActiveCompiles.compare_exchange_weak(peak, active);) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        const auto    key = ci.cacheKey();
+        stage2spirv_t spv;
+        spv[ya::EShaderStage::Vertex] = {0x07230203, 1};
+        ya::shader_internal::saveShaderDiskCache(cacheDir / ya::shader_internal::makeCacheFileName(key), hashOf(key), spv);
+        ++compiles;
+        --activeCompiles;
+        return spv;
+    }
+
+    ya::ShaderReflection::ShaderResources reflect(ya::EShaderStage::T, const std::vector<ir_t>&) override { return {}; }
+
+    std::optional<ya::ShaderCacheEntry> resolveCache(const ya::ShaderDesc& ci) override
+    {
+        const auto key = ci.cacheKey();
+        return ya::ShaderCacheEntry{
+            .cachePath    = cacheDir / ya::shader_internal::makeCacheFileName(key),
+            .sourceHash   = hashOf(key),
+            .dependencies = {"Common/Limits.glsl", key},
+        };
+    }
+};
+
+} // namespace
+
+TEST(ShaderManifestTest, LinesRoundTripNamesStageFilesAndDefines)
+{
+    auto named = ya::parseShaderManifestLine("  DeferredRender/GBufferPass_PBR.slang | ENABLE_SKINNING 1 |SKINNING_SET_INDEX 5  # skinned");
+    ASSERT_TRUE(named.has_value());
+    EXPECT_EQ(named->shaderName, "DeferredRender/GBufferPass_PBR.slang");
+    EXPECT_EQ(named->defines, (std::vector<std::string>{"ENABLE_SKINNING 1", "SKINNING_SET_INDEX 5"}));
+
+    auto staged = ya::parseShaderManifestLine("vertex:Sprite2D.slang fragment:Sprite2D.slang@fragMain | FOO=1");
+    ASSERT_TRUE(staged.has_value());
+    EXPECT_EQ(staged->sourceMode, ya::ShaderDesc::ESourceMode::StageFiles);
+    ASSERT_EQ(staged->stageFiles.size(), 2u);
+    EXPECT_EQ(staged->stageFiles[1].stage, ya::EShaderStage::Fragment);
+    EXPECT_EQ(staged->stageFiles[1].entryName, "fragMain");
+
+    // The manifest must reproduce the runtime cache key exactly.
+    for (const auto* desc : {&*named, &*staged}) {
+        auto reparsed = ya::parseShaderManifestLine(ya::formatShaderManifestLine(*desc));
+        ASSERT_TRUE(reparsed.has_value());
+        EXPECT_EQ(reparsed->cacheKey(), desc->cacheKey());
+    }
+
+    EXPECT_FALSE(ya::parseShaderManifestLine("   # only a comment").has_value());
+    EXPECT_FALSE(ya::parseShaderManifestLine("vertex:Sprite2D.slang fragment").has_value());
+}
+
+TEST_F(ShaderBatchCompilerTest, ManifestMergeKeepsExistingEntriesAndAddsNewKeys)
+{
+    const auto path = _cacheDir / "Permutations.txt";
+    const std::vector<ya::ShaderDesc> first = {
+        ya::ShaderDesc{.shaderName = "Test/Unlit.glsl"},
+        ya::ShaderDesc{.shaderName = "Skybox.glsl"},
+    };
+    ASSERT_TRUE(ya::mergeShaderManifest(path, first));
+
+    const std::vector<ya::ShaderDesc> second = {
+        ya::ShaderDesc{.shaderName = "Skybox.glsl"},
+        ya::ShaderDesc{.shaderName = "Test/Unlit.glsl", .defines = {"ENABLE_SKINNING 1"}},
+    };
+    ASSERT_TRUE(ya::mergeShaderManifest(path, second));
+
+    std::vector<ya::ShaderDesc> loaded;
+    ASSERT_TRUE(ya::loadShaderManifest(path, loaded));
+    ASSERT_EQ(loaded.size(), 3u);
+    EXPECT_EQ(loaded[0].cacheKey(), "Test/Unlit.glsl");
+    EXPECT_EQ(loaded[2].cacheKey(), second[1].cacheKey());
+}
+
+TEST_F(ShaderBatchCompilerTest, RebuildsOnlyPermutationsWhoseSourcesChanged)
+{
+    auto processor      = std::make_shared<FakeShaderProcessor>();
+    processor->cacheDir = _cacheDir;
+    ya::ShaderStorage storage(processor);
+
+    const std::vector<ya::ShaderDesc> shaders = {
+        ya::ShaderDesc{.shaderName = "Lit.glsl"},
+        ya::ShaderDesc{.shaderName = "Lit.glsl", .defines = {"ENABLE_SKINNING 1"}},
+        ya::ShaderDesc{.shaderName = "Unlit.glsl"},
+        ya::ShaderDesc{.shaderName = "Lit.glsl"}, // Duplicate key
+    };
+
+    const ya::ShaderBatchCompiler compiler(storage);
+    auto                          report = compiler.compile(shaders);
+    ASSERT_EQ(report.items.size(), 3u);
+    EXPECT_EQ(report.compiled, 3u);
+    EXPECT_EQ(report.items[0].dependencyCount, 2u);
+    EXPECT_EQ(processor->compiles.load(), 3u);
+
+    report = compiler.compile(shaders);
+    EXPECT_EQ(report.upToDate, 3u);
+    EXPECT_EQ(processor->compiles.load(), 3u);
+
+    // An include edit reaching only the skinned permutation.
+    processor->hashes[shaders[1].cacheKey()] = 2;
+    report = compiler.compile(shaders);
+    EXPECT_EQ(report.compiled, 1u);
+    EXPECT_EQ(report.upToDate, 2u);
+    EXPECT_EQ(report.items[1].status, ya::EShaderBatchStatus::Compiled);
+    EXPECT_EQ(processor->compiles.load(), 4u);
+
+    report = compiler.compile(shaders, ya::ShaderBatchOptions{.bForce = true});
+    EXPECT_EQ(report.compiled, 3u);
+    EXPECT_TRUE(report.succeeded());
+}
+
+TEST_F(ShaderBatchCompilerTest, CompilesAcrossJobWorkers)
+{
+    auto processor      = std::make_shared<FakeShaderProcessor>();
+    processor->cacheDir = _cacheDir;
+    ya::ShaderStorage storage(processor);
+
+    std::vector<ya::ShaderDesc> shaders;
+    for (int i = 0; i < 32; ++i) {
+        shaders.push_back(ya::ShaderDesc{.shaderName = "Permutation.glsl", .defines = {"VARIANT " + std::to_string(i)}});
+    }
+
+    const auto report = ya::ShaderBatchCompiler(storage).compile(shaders);
+    EXPECT_EQ(report.compiled, 32u);
+    EXPECT_EQ(processor->compiles.load(), 32u);
+    if (ya::JobSystem::get().getConcurrency() > 1) {
+        EXPECT_GT(processor->peakActiveCompiles.load(), 1u);
+    }
+    EXPECT_GT(report.seconds, 0.0);
+}
+
+TEST_F(ShaderBatchCompilerTest, PreloadFansOutAndRecordsLoadedPermutations)
+{
+    auto processor      = std::make_shared<FakeShaderProcessor>();
+    processor->cacheDir = _cacheDir;
+    ya::ShaderStorage storage(processor);
+
+    std::vector<ya::ShaderDesc> shaders;
+    for (int i = 0; i < 16; ++i) {
+        shaders.push_back(ya::ShaderDesc{.shaderName = "Preload.glsl", .defines = {"VARIANT " + std::to_string(i)}});
+    }
+    storage.preloadAsync(shaders);
+    storage.waitForPreload();
+
+    EXPECT_EQ(processor->compiles.load(), 16u);
+    for (const auto& desc : shaders) {
+        EXPECT_NE(storage.getCache(desc.cacheKey()), nullptr);
+    }
+    EXPECT_EQ(storage.getLoadedShaderDescs().size(), 16u);
+    if (ya::JobSystem::get().getConcurrency() > 1) {
+        EXPECT_GT(processor->peakActiveCompiles.load(), 1u);
+    }
+}
+
+TEST_F(ShaderBatchCompilerTest, ConcurrentLoadsOfOneKeyCompileOnce)
+{
+    auto processor      = std::make_shared<FakeShaderProcessor>();
+    processor->cacheDir = _cacheDir;
+    ya::ShaderStorage storage(processor);
+
+    const ya::ShaderDesc desc{.shaderName = "Shared.glsl"};
+    std::vector<std::shared_ptr<const ya::ShaderStorage::stage2spirv_t>> results(8);
+    std::vector<std::thread>                                            threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i]() { results[i] = storage.load(desc); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(processor->compiles.load(), 1u);
+    for (const auto& result : results) {
+        EXPECT_EQ(result, results[0]);
+    }
+    EXPECT_EQ(storage.getCache(desc.cacheKey()), results[0]);
+}
@@ -5,7 +5,9 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <random>
 
 namespace
 {
@@ -28,6 +30,66 @@ bool nearMat4(const glm::mat4& lhs, const glm::mat4& rhs, float epsilon = EPSILO
     return true;
 }
 
+/// Quaternion distance, sign-insensitive; about half the angle between the rotations.
+float rotationError(const glm::quat& lhs, const glm::quat& rhs)
+{
+    const glm::quat a = glm::normalize(lhs);
+    const glm::quat b = glm::normalize(rhs);
+    return std::min(glm::length(a - b), glm::length(a + b));
+}
+
+/// Chain of @p boneCount nodes, one bone each, and a looping walk-like clip
+/// keyed at 30 Hz: every joint swings on its own axis, the root also moves.
+void buildWalkCycle(uint32_t boneCount, double seconds, ya::Skeleton& skeleton, ya::SkeletonAnimationClip& clip)
+{
+    constexpr double TICKS_PER_SECOND = 30.0;
+
+    skeleton = {};
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        skeleton.nodes.push_back(ya::SkeletonNodeInfo{
+            .name           = "bone" + std::to_string(index),
+            .parentIndex    = index == 0 ? ya::INVALID_SKELETON_NODE_INDEX : index - 1,
+            .localTransform = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.25f, 0.0f)),
+        });
+        skeleton.bones.push_back(ya::SkeletonBoneInfo{
+            .name      = "bone" + std::to_string(index),
+            .id        = index,
+            .nodeIndex = index,
+        });
+    }
+
+    clip                = {};
+    clip.name           = "walk";
+    clip.ticksPerSecond = TICKS_PER_SECOND;
+    clip.duration       = seconds * TICKS_PER_SECOND;
+    const auto keyCount = static_cast<uint32_t>(clip.duration) + 1;
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        ya::SkeletonAnimationChannel channel{
+            .targetName = skeleton.nodes[index].name,
+            .nodeIndex  = index,
+            .boneIndex  = index,
+        };
+        const glm::vec3 axis  = glm::normalize(glm::vec3(std::sin(index * 1.3f), 1.0f, std::cos(index * 0.7f)));
+        const float     phase = static_cast<float>(index) * 0.4f;
+        for (uint32_t key = 0; key < keyCount; ++key) {
+            const double time  = static_cast<double>(key);
+            const float  cycle = static_cast<float>(time / TICKS_PER_SECOND) * 2.0f * 3.14159265f;
+            channel.rotationKeys.push_back({.time = time, .value = glm::angleAxis(0.6f * std::sin(cycle + phase), axis)});
+            if (index == 0) {
+                channel.positionKeys.push_back({
+                    .time  = time,
+                    .value = glm::vec3(0.0f, 1.0f + 0.05f * std::sin(2.0f * cycle), static_cast<float>(time) * 0.05f),
+                });
+            }
+            else {
+                channel.positionKeys.push_back({.time = time, .value = glm::vec3(0.0f, 0.25f, 0.0f)});
+            }
+            channel.scaleKeys.push_back({.time = time, .value = glm::vec3(1.0f)});
+        }
+        clip.channels.push_back(std::move(channel));
+    }
+}
+
 } // namespace
 
 TEST(SkeletonAnimationSamplerTest, WrapTimeHandlesPositiveNegativeAndZeroDuration)
@@ -135,3 +197,155 @@ TEST(SkeletonAnimationSamplerTest, SamplePoseComputesLocalGlobalAndBoneMatrices)
     EXPECT_TRUE(nearMat4(pose.globalTransforms[1], expectedChildLocal));
     EXPECT_TRUE(nearMat4(pose.boneMatrices[0], expectedChildLocal));
 }
+
+TEST(SkeletonAnimationSamplerTest, ComposeTransformMatchesTrsMatrixProduct)
+{
+    const ya::SkeletonChannelSample sample{
+        .position = glm::vec3(1.0f, -2.0f, 3.5f),
+        .rotation = glm::angleAxis(glm::radians(70.0f), glm::normalize(glm::vec3(0.3f, 1.0f, -0.5f))),
+        .scale    = glm::vec3(0.5f, 2.0f, 1.5f),
+    };
+    const glm::mat4 expected = glm::translate(glm::mat4(1.0f), sample.position) *
+                               glm::mat4_cast(sample.rotation) *
+                               glm::scale(glm::mat4(1.0f), sample.scale);
+    EXPECT_TRUE(nearMat4(ya::SkeletonAnimationSampler::composeTransform(sample), expected));
+}
+
+TEST(SkeletonAnimationSamplerTest, SmallestThreeQuatRoundTripsWithinQuantizationStep)
+{
+    std::mt19937                          rng(11);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (int index = 0; index < 1000; ++index) {
+        const glm::quat value   = glm::normalize(glm::quat(dist(rng), dist(rng), dist(rng), dist(rng)));
+        const glm::quat decoded = ya::animation_codec::decodeQuat(ya::animation_codec::encodeQuat(value));
+        EXPECT_LT(rotationError(value, decoded), 1e-4f) << index;
+    }
+
+    // Constant ranges decode exactly.
+    const glm::vec3 value(1.5f, -2.0f, 0.25f);
+    EXPECT_EQ(ya::animation_codec::decodeVec3(ya::animation_codec::encodeVec3(value, value, glm::vec3(0.0f)), value, glm::vec3(0.0f)), value);
+}
+
+TEST(SkeletonAnimationSamplerTest, CompressedClipTracksSourceClip)
+{
+    ya::Skeleton              skeleton;
+    ya::SkeletonAnimationClip clip;
+    buildWalkCycle(8, 2.0, skeleton, clip);
+
+    const ya::CompressedSkeletonClip compressed = ya::compressAnimationClip(skeleton, clip);
+    ASSERT_TRUE(compressed.isValid());
+    ASSERT_EQ(compressed.getTrackCount(), 8u);
+    EXPECT_EQ(compressed.frameCount, 61u);
+    // Constant scales and child translations keep a single key.
+    EXPECT_EQ(compressed.scaleFrames.size(), 8u);
+    EXPECT_EQ(compressed.positionKeyOffsets[2] - compressed.positionKeyOffsets[1], 1u);
+    EXPECT_LT(compressed.getMemoryUsage(), ya::getAnimationClipMemoryUsage(clip));
+
+    ya::CompressedClipCursor           cursor;
+    std::vector<ya::SkeletonChannelSample> samples;
+    for (double time = 0.0; time <= clip.duration; time += 0.37) {
+        ya::SkeletonAnimationSampler::sampleTracks(compressed, time, false, cursor, samples);
+        for (uint32_t track = 0; track < compressed.getTrackCount(); ++track) {
+            const auto expected = ya::SkeletonAnimationSampler::sampleChannel(clip.channels[track], time, &skeleton.nodes[track]);
+            EXPECT_LT(rotationError(samples[track].rotation, expected.rotation), 1e-3f) << time;
+            EXPECT_TRUE(nearVec3(samples[track].position, expected.position, 1e-3f)) << time;
+            EXPECT_TRUE(nearVec3(samples[track].scale, expected.scale)) << time;
+        }
+    }
+}
+
+TEST(SkeletonAnimationSamplerTest, CursorGivesSameResultAsFreshCursorWhenSeekingAndLooping)
+{
+    ya::Skeleton              skeleton;
+    ya::SkeletonAnimationClip clip;
+    buildWalkCycle(4, 2.0, skeleton, clip);
+    const ya::CompressedSkeletonClip compressed = ya::compressAnimationClip(skeleton, clip);
+
+    ya::CompressedClipCursor               cursor;
+    std::vector<ya::SkeletonChannelSample> advanced;
+    std::vector<ya::SkeletonChannelSample> fresh;
+    // Forward, across the loop point, backwards, and a far jump.
+    for (const double time : {0.0, 0.5, 7.25, 59.9, 61.5, 64.0, 12.0, 11.5, 240.75, 3.0}) {
+        ya::SkeletonAnimationSampler::sampleTracks(compressed, time, true, cursor, advanced);
+        ya::CompressedClipCursor freshCursor;
+        ya::SkeletonAnimationSampler::sampleTracks(compressed, time, true, freshCursor, fresh);
+        for (size_t track = 0; track < fresh.size(); ++track) {
+            EXPECT_EQ(advanced[track].rotation, fresh[track].rotation) << time;
+            EXPECT_EQ(advanced[track].position, fresh[track].position) << time;
+        }
+    }
+}
+
+TEST(SkeletonAnimationSamplerTest, DepthLimitedSamplingOnlyTouchesUpperHierarchy)
+{
+    ya::Skeleton              skeleton;
+    ya::SkeletonAnimationClip clip;
+    buildWalkCycle(6, 2.0, skeleton, clip);
+    // Channels leaf first; tracks are still stored root first.
+    std::reverse(clip.channels.begin(), clip.channels.end());
+    const ya::CompressedSkeletonClip compressed = ya::compressAnimationClip(skeleton, clip);
+
+    ASSERT_EQ(compressed.depthTrackEnds.size(), 6u);
+    for (uint32_t track = 0; track < compressed.getTrackCount(); ++track) {
+        EXPECT_EQ(compressed.trackNodes[track], track);
+        EXPECT_EQ(compressed.getTrackCountForDepth(track), track + 1);
+    }
+    EXPECT_EQ(compressed.getTrackCountForDepth(100), compressed.getTrackCount());
+
+    auto sampleFresh = [&](double time) {
+        ya::CompressedClipCursor cursor;
+        ya::SkeletonPose         pose;
+        ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, time, true, cursor, pose);
+        return pose;
+    };
+
+    ya::CompressedClipCursor cursor;
+    ya::SkeletonPose         pose;
+    ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, 10.0, true, cursor, pose);
+    ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, 40.0, true, cursor, pose, 2);
+    const ya::SkeletonPose full = sampleFresh(40.0);
+    EXPECT_EQ(pose.animatedNodeIndices.size(), 3u);
+    for (size_t node = 0; node < skeleton.nodes.size(); ++node) {
+        EXPECT_EQ(pose.localTransforms[node], node <= 2 ? full.localTransforms[node] : skeleton.nodes[node].localTransform) << node;
+    }
+
+    // Tracks skipped while the upper ones looped back still resume exactly.
+    ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, 70.0, true, cursor, pose, 1);
+    ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, 20.0, true, cursor, pose);
+    EXPECT_EQ(pose.localTransforms, sampleFresh(20.0).localTransforms);
+}
+
+TEST(SkeletonAnimationSamplerTest, CompressedClipHoldsBindPoseForMissingTracks)
+{
+    ya::Skeleton skeleton;
+    skeleton.nodes = {
+        ya::SkeletonNodeInfo{
+            .name           = "root",
+            .localTransform = glm::translate(glm::mat4(1.0f), glm::vec3(3.0f, 0.0f, 0.0f)) *
+                              glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 2.0f, 2.0f)),
+        },
+    };
+
+    ya::SkeletonAnimationClip clip;
+    clip.duration = 10.0;
+    clip.channels.push_back(ya::SkeletonAnimationChannel{
+        .targetName   = "root",
+        .nodeIndex    = 0,
+        .rotationKeys = {
+            {.time = 0.0, .value = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)},
+            {.time = 10.0, .value = glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f))},
+        },
+    });
+    clip.channels.push_back(ya::SkeletonAnimationChannel{.targetName = "missing"});
+
+    const ya::CompressedSkeletonClip compressed = ya::compressAnimationClip(skeleton, clip);
+    ASSERT_EQ(compressed.getTrackCount(), 1u);
+
+    ya::CompressedClipCursor cursor;
+    ya::SkeletonPose         pose;
+    ya::SkeletonAnimationSampler::samplePose(skeleton, compressed, 5.0, false, cursor, pose);
+    const glm::mat4 expected = glm::translate(glm::mat4(1.0f), glm::vec3(3.0f, 0.0f, 0.0f)) *
+                               glm::mat4_cast(glm::angleAxis(glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f))) *
+                               glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 2.0f, 2.0f));
+    EXPECT_TRUE(nearMat4(pose.localTransforms[0], expected, 1e-3f));
+}
@@ -1,10 +1,102 @@
+#include "Core/Async/JobSystem.h"
+#include "Core/Math/Math.h"
+#include "ECS/Entity.h"
+#include "ECS/Systems/AnimationSystem.h"
 #include "ECS/Systems/SkeletonAnimatorComponent.h"
+#include "ECS/Systems/TransformSystem.h"
+#include "Scene/Core/Scene.h"
+#include "Scene3D/TransformComponent.h"
+
+#include "JobSystemTestScope.h"
 
 #include <gtest/gtest.h>
 
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
 namespace ya
 {
 
+namespace
+{
+
+/// Bone chain with one looping clip that rotates every joint, compressed the
+/// way createSkeleton does it.
+std::shared_ptr<Skeleton> makeAnimatedSkeleton(uint32_t boneCount)
+{
+    auto skeleton = std::make_shared<Skeleton>();
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        skeleton->nodes.push_back(SkeletonNodeInfo{
+            .name           = "bone" + std::to_string(index),
+            .parentIndex    = index == 0 ? INVALID_SKELETON_NODE_INDEX : index - 1,
+            .localTransform = glm::mat4(1.0f),
+        });
+        skeleton->bones.push_back(SkeletonBoneInfo{.name = "bone" + std::to_string(index), .id = index, .nodeIndex = index});
+    }
+
+    SkeletonAnimationClip clip{.name = "Walk", .duration = 60.0, .ticksPerSecond = 30.0};
+    for (uint32_t index = 0; index < boneCount; ++index) {
+        SkeletonAnimationChannel channel{.targetName = skeleton->nodes[index].name, .nodeIndex = index, .boneIndex = index};
+        for (uint32_t key = 0; key <= 60; ++key) {
+            const float angle = 0.5f * std::sin(static_cast<float>(key + index) * 0.2f);
+            channel.rotationKeys.push_back({.time = static_cast<double>(key), .value = glm::angleAxis(angle, glm::vec3(0.0f, 0.0f, 1.0f))});
+            channel.positionKeys.push_back({.time = static_cast<double>(key), .value = glm::vec3(0.0f, 0.1f, 0.0f)});
+        }
+        clip.channels.push_back(std::move(channel));
+    }
+    skeleton->animations.push_back(std::move(clip));
+    skeleton->compressedAnimations.push_back(compressAnimationClip(*skeleton, skeleton->animations[0]));
+    return skeleton;
+}
+
+std::vector<SkeletonAnimatorComponent*> spawnCrowd(Scene& scene, const std::shared_ptr<Skeleton>& skeleton, uint32_t count)
+{
+    std::vector<SkeletonAnimatorComponent*> animators;
+    for (uint32_t index = 0; index < count; ++index) {
+        auto* animator = scene.createEntity("Character")->addComponent<SkeletonAnimatorComponent>();
+        animator->setFromModel("Content/Models/Character.fbx", 0, 0, skeleton);
+        animator->_speed = 0.5f + 0.01f * static_cast<float>(index);
+        animators.push_back(animator);
+    }
+    return animators;
+}
+
+SkeletonAnimationSystem makeAnimationSystem(Scene& scene, bool bParallel)
+{
+    SkeletonAnimationSystem system;
+    system.setSceneProvider([&scene]() { return &scene; });
+    system.setParallelUpdate(bParallel);
+    return system;
+}
+
+SkeletonAnimatorComponent* spawnCharacterAt(Scene& scene, const std::shared_ptr<Skeleton>& skeleton, const glm::vec3& position)
+{
+    Entity* entity = scene.createEntity("Character");
+    TransformSystem::setWorldPosition(entity->getComponent<TransformComponent>(), position);
+    auto* animator = entity->addComponent<SkeletonAnimatorComponent>();
+    animator->setFromModel("Content/Models/Character.fbx", 0, 0, skeleton);
+    return animator;
+}
+
+/// Camera at the origin looking down -Z, 1080 pixels high: a 2 m character
+/// is 200 pixels tall about 10 m away.
+SkeletonAnimationSystem::LodView makeLodView()
+{
+    const glm::mat4 projection = FMath::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    const glm::mat4 view       = FMath::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return SkeletonAnimationSystem::LodView{
+        .cameraPosition = glm::vec3(0.0f),
+        .viewProjection = projection * view,
+        .pixelScale     = 0.5f * 1080.0f * std::abs(projection[1][1]),
+    };
+}
+
+} // namespace
+
 TEST(SkeletonAnimatorComponentTest, SetFromModelStoresRuntimeSkeletonReference)
 {
     auto skeleton = std::make_shared<Skeleton>();
@@ -53,4 +145,184 @@ TEST(SkeletonAnimatorComponentTest, PoseDirtyFlagCanBeClearedAndInvalidated)
     EXPECT_TRUE(component.isPoseDirty());
 }
 
+TEST(SkeletonAnimationSystemTest, BatchedParallelUpdateMatchesSerialUpdate)
+{
+    JobSystemTestScope jobScope;
+    auto&              jobs = JobSystem::get();
+
+    const auto skeleton = makeAnimatedSkeleton(24);
+    Scene      serialScene("AnimationSerial");
+    Scene      parallelScene("AnimationParallel");
+    const auto serial   = spawnCrowd(serialScene, skeleton, 64);
+    const auto parallel = spawnCrowd(parallelScene, skeleton, 64);
+
+    auto serialSystem   = makeAnimationSystem(serialScene, false);
+    auto parallelSystem = makeAnimationSystem(parallelScene, true);
+    for (int frame = 0; frame < 5; ++frame) {
+        serialSystem.onUpdate(1.0f / 30.0f);
+        parallelSystem.onUpdate(1.0f / 30.0f);
+    }
+    EXPECT_EQ(parallelSystem.getStats().sampledCount, 64u);
+    EXPECT_EQ(parallelSystem.getStats().bParallel, jobs.getWorkerCount() > 0);
+    EXPECT_FALSE(serialSystem.getStats().bParallel);
+
+    for (size_t index = 0; index < serial.size(); ++index) {
+        ASSERT_FALSE(parallel[index]->isPoseDirty());
+        EXPECT_EQ(parallel[index]->getPose().boneMatrices, serial[index]->getPose().boneMatrices) << index;
+    }
+
+    // Paused animators with a clean pose are not resampled.
+    for (auto* animator : parallel) {
+        animator->_playing = false;
+    }
+    parallelSystem.onUpdate(1.0f / 30.0f);
+    EXPECT_EQ(parallelSystem.getStats().sampledCount, 0u);
+}
+
+TEST(SkeletonAnimationSystemTest, GraphAnimatorsShareClipSamples)
+{
+    JobSystemTestScope jobScope;
+
+    const auto skeleton = makeAnimatedSkeleton(24);
+    auto       graph    = std::make_shared<AnimationPoseGraph>();
+    graph->rootNode     = graph->addClip(0);
+
+    Scene      scene("AnimationGraphCrowd");
+    const auto crowd = spawnCrowd(scene, skeleton, 32);
+    for (auto* animator : crowd) {
+        animator->_speed = 1.0f;
+        animator->setPoseGraph(graph);
+    }
+    // One plain animator as the reference.
+    auto* reference = scene.createEntity("Reference")->addComponent<SkeletonAnimatorComponent>();
+    reference->setFromModel("Content/Models/Character.fbx", 0, 0, skeleton);
+
+    auto system = makeAnimationSystem(scene, true);
+    for (int frame = 0; frame < 3; ++frame) {
+        system.onUpdate(1.0f / 30.0f);
+    }
+    EXPECT_EQ(system.getStats().sampledCount, 33u);
+    EXPECT_EQ(system.getStats().clipRequests, 32u);
+    EXPECT_EQ(system.getStats().clipSamples, 1u);
+
+    for (const auto* animator : crowd) {
+        ASSERT_EQ(animator->getPose().boneMatrices.size(), reference->getPose().boneMatrices.size());
+        for (size_t bone = 0; bone < reference->getPose().boneMatrices.size(); ++bone) {
+            const glm::mat4& lhs = animator->getPose().boneMatrices[bone];
+            const glm::mat4& rhs = reference->getPose().boneMatrices[bone];
+            for (int col = 0; col < 4; ++col) {
+                EXPECT_LT(glm::length(lhs[col] - rhs[col]), 1e-4f) << bone;
+            }
+        }
+    }
+}
+
+TEST(SkeletonAnimationSystemTest, LodSelectionFollowsProjectedSizeWithHysteresis)
+{
+    const SkeletonAnimationSystem::LodSettings settings;
+    const SkeletonAnimationSystem::LodView     view    = makeLodView();
+    const Frustum                              frustum = Frustum::fromViewProjection(view.viewProjection);
+
+    auto lodAt = [&](const glm::vec3& position, EAnimationLod previous) {
+        const AABB bounds = SkeletonAnimationSystem::fallbackBounds(settings, glm::translate(glm::mat4(1.0f), position));
+        return SkeletonAnimationSystem::selectLod(settings, view, &frustum, bounds, previous);
+    };
+    EXPECT_EQ(lodAt({0.0f, 0.0f, -5.0f}, EAnimationLod::Full), EAnimationLod::Full);
+    EXPECT_EQ(lodAt({0.0f, 0.0f, -20.0f}, EAnimationLod::Full), EAnimationLod::Reduced);
+    EXPECT_EQ(lodAt({0.0f, 0.0f, -80.0f}, EAnimationLod::Full), EAnimationLod::Distant);
+    EXPECT_EQ(lodAt({0.0f, 0.0f, 20.0f}, EAnimationLod::Full), EAnimationLod::Suspended);
+
+    // Just past the Full threshold: a Full animator stays Full, a Reduced one stays Reduced.
+    EXPECT_EQ(lodAt({0.0f, 0.0f, -10.6f}, EAnimationLod::Full), EAnimationLod::Full);
+    EXPECT_EQ(lodAt({0.0f, 0.0f, -10.6f}, EAnimationLod::Reduced), EAnimationLod::Reduced);
+
+    // Scaled-up characters count as bigger on screen.
+    const glm::mat4 giant = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -20.0f)), glm::vec3(3.0f));
+    const AABB giantBounds = SkeletonAnimationSystem::fallbackBounds(settings, giant);
+    EXPECT_EQ(SkeletonAnimationSystem::selectLod(settings, view, &frustum, giantBounds, EAnimationLod::Reduced), EAnimationLod::Full);
+
+    // Mesh bounds are measured as they are: a 6 m tall mesh 20 m away is Full.
+    const AABB tall(glm::vec3(-0.5f, 0.0f, -20.5f), glm::vec3(0.5f, 6.0f, -19.5f));
+    EXPECT_EQ(SkeletonAnimationSystem::selectLod(settings, view, &frustum, tall, EAnimationLod::Reduced), EAnimationLod::Full);
+}
+
+TEST(SkeletonAnimationSystemTest, LodUsesSkinnedMeshBoundsOverFallback)
+{
+    const auto skeleton = makeAnimatedSkeleton(4);
+    Scene      scene("AnimationLodBounds");
+    auto*      tall     = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, -20.0f});
+    auto*      plain    = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, -20.0f});
+    // Model root behind the camera, skinned mesh in front of it.
+    auto*      offset   = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, 20.0f});
+
+    auto system = makeAnimationSystem(scene, false);
+    system.setLodViewProvider([](SkeletonAnimationSystem::LodView& view) {
+        view = makeLodView();
+        return true;
+    });
+    system.setBoundsProvider([&](Scene&, SkeletonAnimationSystem::AnimatorBounds& bounds) {
+        bounds[tall]   = AABB(glm::vec3(-0.5f, 0.0f, -20.5f), glm::vec3(0.5f, 6.0f, -19.5f));
+        bounds[offset] = AABB(glm::vec3(-0.5f, 0.0f, -5.5f), glm::vec3(0.5f, 2.0f, -4.5f));
+    });
+
+    system.onUpdate(1.0f / 30.0f);
+    EXPECT_EQ(tall->_lodState.lod, EAnimationLod::Full);
+    EXPECT_EQ(plain->_lodState.lod, EAnimationLod::Reduced);
+    EXPECT_EQ(offset->_lodState.lod, EAnimationLod::Full);
+    EXPECT_EQ(system.getStats().suspendedCount, 0u);
+}
+
+TEST(SkeletonAnimationSystemTest, LodThrottlesDistantAndSuspendsCulledAnimators)
+{
+    const auto skeleton = makeAnimatedSkeleton(8);
+    Scene      scene("AnimationLod");
+    auto*      nearby  = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, -5.0f});
+    auto*      middle  = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, -20.0f});
+    auto*      faraway = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, -80.0f});
+    auto*      behind  = spawnCharacterAt(scene, skeleton, {0.0f, 0.0f, 20.0f});
+
+    auto system = makeAnimationSystem(scene, false);
+    system.setLodViewProvider([](SkeletonAnimationSystem::LodView& view) {
+        view = makeLodView();
+        return true;
+    });
+    auto settings         = system.getLodSettings();
+    settings.bInterpolate = false;
+    system.setLodSettings(settings);
+
+    // Every visible animator gets its first pose right away.
+    system.onUpdate(1.0f / 30.0f);
+    EXPECT_EQ(nearby->_lodState.lod, EAnimationLod::Full);
+    EXPECT_EQ(middle->_lodState.lod, EAnimationLod::Reduced);
+    EXPECT_EQ(faraway->_lodState.lod, EAnimationLod::Distant);
+    EXPECT_EQ(behind->_lodState.lod, EAnimationLod::Suspended);
+    EXPECT_EQ(system.getStats().sampledCount, 3u);
+    EXPECT_TRUE(behind->getPose().boneMatrices.empty());
+
+    // Over 8 frames: Full every frame, Reduced every 2nd, Distant every 4th.
+    uint32_t sampled = 0;
+    for (int frame = 0; frame < 8; ++frame) {
+        system.onUpdate(1.0f / 30.0f);
+        sampled += system.getStats().sampledCount;
+        EXPECT_EQ(system.getStats().suspendedCount, 1u);
+    }
+    EXPECT_EQ(sampled, 8u + 4u + 2u);
+    // Suspended playback keeps time, so it resumes in sync.
+    EXPECT_DOUBLE_EQ(behind->_time, nearby->_time);
+
+    // With interpolation the throttled poses move every frame, once the
+    // snap to a fresh sample on switching over has been held for an interval.
+    settings.bInterpolate = true;
+    system.setLodSettings(settings);
+    for (uint32_t frame = 0; frame < settings.reducedInterval; ++frame) {
+        system.onUpdate(1.0f / 30.0f);
+    }
+    for (int frame = 0; frame < 4; ++frame) {
+        const std::vector<glm::mat4> before = middle->getPose().boneMatrices;
+        system.onUpdate(1.0f / 30.0f);
+        EXPECT_EQ(system.getStats().interpolatedCount, 2u);
+        EXPECT_NE(middle->getPose().boneMatrices, before);
+    }
+}
+
 } // namespace ya
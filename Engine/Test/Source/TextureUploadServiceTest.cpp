@@ -2,12 +2,18 @@
 
 #include "RHI/Core/Buffer.h"
 #include "RHI/Core/CommandBuffer.h"
+#include "RHI/Core/GpuUploadQueue.h"
 #include "RHI/Core/Image.h"
+#include "RHI/Core/RenderResourceFactory.h"
 #include "RHI/Render.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -25,7 +31,21 @@ class SpecStagingBuffer final : public IBuffer
     uint32_t     _size  = 1024;
 
   public:
-    bool writeData(const void*, uint32_t = 0, uint32_t = 0) override { return true; }
+    std::vector<std::byte> contents;
+
+    explicit SpecStagingBuffer(uint32_t size = 1024, std::string name = "Test.Staging")
+        : _name(std::move(name)), _size(size), contents(size)
+    {
+    }
+
+    bool writeData(const void* data, uint32_t size = 0, uint32_t offset = 0) override
+    {
+        if (static_cast<uint64_t>(offset) + size > _size) {
+            return false;
+        }
+        std::memcpy(contents.data() + offset, data, size);
+        return true;
+    }
     bool flush(uint32_t = 0, uint32_t = 0) override { return true; }
     void unmap() override {}
     BufferHandle getHandle() const override
@@ -74,6 +94,9 @@ class RecordingCommandBuffer final : public ICommandBuffer
     };
 
     std::vector<TransitionRecord> transitions;
+    std::vector<uint64_t>         copyBufferSrcOffsets;
+    std::vector<uint64_t>         copyToImageBufferOffsets;
+    uint32_t                      bufferBarrierCount     = 0;
     uint32_t                      copyBufferToImageCount = 0;
     uint32_t                      generateMipmapsCount   = 0;
     bool                          bMipmapsSupported      = true;
@@ -93,7 +116,10 @@ class RecordingCommandBuffer final : public ICommandBuffer
     void drawIndexedIndirect(IBuffer*, uint64_t, uint32_t, uint32_t) override {}
     void drawIndexedIndirectCount(IBuffer*, uint64_t, IBuffer*, uint64_t, uint32_t, uint32_t) override {}
     void fillBuffer(IBuffer*, uint64_t, uint64_t, uint32_t) override {}
-    void bufferMemoryBarrier(IBuffer*, EPipelineStage::T, EPipelineStage::T, EResourceAccess::T, EResourceAccess::T, uint64_t = 0, uint64_t = 0) override {}
+    void bufferMemoryBarrier(IBuffer*, EPipelineStage::T, EPipelineStage::T, EResourceAccess::T, EResourceAccess::T, uint64_t = 0, uint64_t = 0) override
+    {
+        ++bufferBarrierCount;
+    }
     void setViewport(float, float, float, float, float = 0.0f, float = 1.0f) override {}
     void setScissor(int32_t, int32_t, uint32_t, uint32_t) override {}
     void setCullMode(ECullMode::T) override {}
@@ -102,12 +128,18 @@ class RecordingCommandBuffer final : public ICommandBuffer
     void bindDescriptorSets(IPipelineLayout*, uint32_t, const std::vector<DescriptorSetHandle>&, const std::vector<uint32_t>& = {}) override {}
     void bindComputeDescriptorSets(IPipelineLayout*, uint32_t, const std::vector<DescriptorSetHandle>&, const std::vector<uint32_t>& = {}) override {}
     void pushConstants(IPipelineLayout*, EShaderStage::T, uint32_t, uint32_t, const void*) override {}
-    void copyBuffer(IBuffer*, IBuffer*, uint64_t, uint64_t = 0, uint64_t = 0) override {}
+    void copyBuffer(IBuffer*, IBuffer*, uint64_t, uint64_t srcOffset = 0, uint64_t = 0) override
+    {
+        copyBufferSrcOffsets.push_back(srcOffset);
+    }
     void dispatch(uint32_t, uint32_t, uint32_t) override {}
     void dispatchIndirect(IBuffer*, uint64_t = 0) override {}
-    void copyBufferToImage(IBuffer*, IImage*, EImageLayout::T, const std::vector<BufferImageCopy>&) override
+    void copyBufferToImage(IBuffer*, IImage*, EImageLayout::T, const std::vector<BufferImageCopy>& regions) override
     {
         ++copyBufferToImageCount;
+        for (const auto& region : regions) {
+            copyToImageBufferOffsets.push_back(region.bufferOffset);
+        }
     }
     void copyImageToBuffer(IImage*, EImageLayout::T, IBuffer*, const std::vector<BufferImageCopy>&) override {}
     void copyImage(IImage*, EImageLayout::T, IImage*, EImageLayout::T, const std::vector<ImageCopy>&) override {}
@@ -131,10 +163,54 @@ class RecordingCommandBuffer final : public ICommandBuffer
     }
 };
 
+class UploadTestFactory final : public IRenderResourceFactory
+{
+  public:
+    std::vector<std::shared_ptr<SpecStagingBuffer>> buffers;
+
+    std::shared_ptr<IBuffer> createBuffer(const BufferCreateInfo& desc) override
+    {
+        auto buffer = std::make_shared<SpecStagingBuffer>(desc.size, desc.label);
+        if (desc.data.has_value()) {
+            buffer->writeData(*desc.data, desc.size);
+        }
+        buffers.push_back(buffer);
+        return buffer;
+    }
+    std::shared_ptr<Sampler> createSampler(const SamplerDesc&) override { return nullptr; }
+    std::shared_ptr<IImage> createImage(const ImageCreateInfo&) override { return nullptr; }
+    std::shared_ptr<IImage> importImage(const ImportedImageDesc&) override { return nullptr; }
+    std::shared_ptr<IImageView> createImageView(std::shared_ptr<IImage>, const ImageViewCreateInfo&) override { return nullptr; }
+};
+
 class UploadTestRender final : public IRender
 {
   public:
-    RecordingCommandBuffer* recorded = nullptr;
+    RecordingCommandBuffer* recorded        = nullptr;
+    IRenderResourceFactory* factory         = nullptr;
+    GpuUploadQueue*         uploadQueue     = nullptr;
+    uint32_t                isolateBegins   = 0;
+    uint32_t                asyncSubmits    = 0;
+    uint32_t                asyncWaits      = 0;
+    uint64_t                asyncCompleted  = 0;
+    bool                    bGpuAutoComplete = true; // false: tests advance asyncCompleted
+
+    ICommandBuffer* beginAsyncCommands(const std::string& = "") override { return recorded; }
+    uint64_t submitAsyncCommands(ICommandBuffer*) override
+    {
+        ++asyncSubmits;
+        if (bGpuAutoComplete) {
+            asyncCompleted = asyncSubmits;
+        }
+        return asyncSubmits;
+    }
+    uint64_t pollAsyncCommands() override { return asyncCompleted; }
+    void waitAsyncCommands(uint64_t value) override
+    {
+        ++asyncWaits;
+        asyncCompleted = std::max(asyncCompleted, value);
+    }
+    GpuUploadQueue* getUploadQueue() override { return uploadQueue; }
 
     void destroy() override {}
     void setShaderStorage(std::shared_ptr<ShaderStorage>) override {}
@@ -152,11 +228,15 @@ class UploadTestRender final : public IRender
     uint32_t getSwapchainImageCount() const override { return 0; }
     void allocateCommandBuffers(uint32_t, std::vector<std::shared_ptr<ICommandBuffer>>&) override {}
     void waitIdle() override {}
-    ICommandBuffer* beginIsolateCommands(const std::string& = "") override { return recorded; }
+    ICommandBuffer* beginIsolateCommands(const std::string& = "") override
+    {
+        ++isolateBegins;
+        return recorded;
+    }
     void endIsolateCommands(ICommandBuffer*) override {}
     ISwapchain* getSwapchain() override { return nullptr; }
     IDescriptorSetHelper* getDescriptorHelper() override { return nullptr; }
-    IRenderResourceFactory* getResourceFactory() override { return nullptr; }
+    IRenderResourceFactory* getResourceFactory() override { return factory; }
     void submitToQueue(const std::vector<void*>&, const std::vector<void*>&, const std::vector<void*>&, void* = nullptr) override {}
     int presentImage(int32_t, const std::vector<void*>&) override { return 0; }
     void* getCurrentImageAvailableSemaphore() override { return nullptr; }
@@ -347,4 +427,210 @@ TEST(TextureUploadServiceTest, UploadMipGenerationSuccessKeepsImageMipCount)
     EXPECT_EQ(cmdBuf.transitions.size(), 1u);
 }
 
+TEST(TextureUploadServiceTest, SourceDataWithoutQueueStagesThroughFactory)
+{
+    RecordingCommandBuffer cmdBuf;
+    UploadTestFactory      factory;
+    UploadTestRender       render;
+    render.recorded = &cmdBuf;
+    render.factory  = &factory;
+
+    const std::vector<std::byte> pixels(16 * 16 * 4, std::byte{0x7f});
+    TextureUploadService         service;
+    ASSERT_TRUE(service.upload(render, TextureUploadRequest{
+        .image      = makeUploadImage(),
+        .sourceData = pixels,
+        .regions    = {makeCopyRegion(0)},
+        .label      = "Test.Source",
+    }));
+
+    ASSERT_EQ(factory.buffers.size(), 1u);
+    EXPECT_EQ(factory.buffers[0]->contents, pixels);
+    EXPECT_EQ(render.isolateBegins, 1u);
+    EXPECT_EQ(cmdBuf.copyBufferToImageCount, 1u);
+}
+
+TEST(TextureUploadServiceTest, UploadQueueBatchesUploadsIntoOneSubmission)
+{
+    RecordingCommandBuffer cmdBuf;
+    UploadTestFactory      factory;
+    UploadTestRender       render;
+    render.recorded = &cmdBuf;
+    GpuUploadQueue queue(render, factory, GpuUploadQueue::Config{.ringBytes = 64 * 1024});
+    render.uploadQueue = &queue;
+
+    const std::vector<std::byte> pixels(16 * 16 * 4, std::byte{1});
+    TextureUploadService         service;
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(service.upload(render, TextureUploadRequest{
+            .image      = makeUploadImage(),
+            .sourceData = pixels,
+            .regions    = {makeCopyRegion(0)},
+        }));
+    }
+    SpecStagingBuffer            vertexBuffer(256, "Test.Vertices");
+    const std::vector<std::byte> vertices(100, std::byte{2});
+    const GpuUploadTicket        first  = queue.uploadBuffer(&vertexBuffer, 0, vertices);
+    const GpuUploadTicket        second = queue.uploadBuffer(&vertexBuffer, 128, vertices);
+    ASSERT_TRUE(first.valid());
+    ASSERT_TRUE(second.valid());
+
+    // Nothing is recorded or waited on until the flush.
+    EXPECT_EQ(render.isolateBegins, 0u);
+    EXPECT_EQ(cmdBuf.copyBufferToImageCount, 0u);
+    EXPECT_FALSE(queue.isComplete(second));
+
+    ASSERT_TRUE(queue.flush());
+    EXPECT_EQ(render.asyncSubmits, 1u);
+    EXPECT_EQ(render.asyncWaits, 0u);
+    EXPECT_EQ(cmdBuf.copyBufferToImageCount, 3u);
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets.size(), 2u);
+    EXPECT_EQ(cmdBuf.bufferBarrierCount, 2u);
+    EXPECT_EQ(queue.getStats().lastBatchUploads, 5u);
+    EXPECT_FALSE(queue.flush());
+
+    // Texture regions are rebased onto their ring slices, aligned.
+    ASSERT_EQ(cmdBuf.copyToImageBufferOffsets.size(), 3u);
+    EXPECT_EQ(cmdBuf.copyToImageBufferOffsets[0], 0u);
+    EXPECT_EQ(cmdBuf.copyToImageBufferOffsets[1], 1024u);
+    EXPECT_EQ(cmdBuf.copyToImageBufferOffsets[2], 2048u);
+    for (uint64_t offset : cmdBuf.copyBufferSrcOffsets) {
+        EXPECT_EQ(offset % 16, 0u);
+    }
+
+    queue.retire();
+    EXPECT_TRUE(queue.isComplete(first));
+    EXPECT_TRUE(queue.isComplete(second));
+    EXPECT_EQ(queue.getStats().inFlightBytes, 0u);
+}
+
+TEST(TextureUploadServiceTest, UploadQueueRingWrapsAndStallsOnlyWhenFull)
+{
+    RecordingCommandBuffer cmdBuf;
+    UploadTestFactory      factory;
+    UploadTestRender       render;
+    render.recorded         = &cmdBuf;
+    render.bGpuAutoComplete = false;
+    GpuUploadQueue queue(render, factory, GpuUploadQueue::Config{.ringBytes = 256});
+
+    SpecStagingBuffer            dst(1024);
+    const std::vector<std::byte> chunk(100, std::byte{3});
+    const GpuUploadTicket        a = queue.uploadBuffer(&dst, 0, chunk);
+    const GpuUploadTicket        b = queue.uploadBuffer(&dst, 100, chunk);
+    ASSERT_TRUE(queue.flush());
+    EXPECT_EQ(queue.getStats().stalls, 0u);
+
+    // GPU has not finished a and b: the third chunk does not fit anywhere.
+    const GpuUploadTicket c = queue.uploadBuffer(&dst, 200, chunk);
+    ASSERT_TRUE(c.valid());
+    EXPECT_EQ(queue.getStats().stalls, 1u);
+    EXPECT_EQ(render.asyncWaits, 1u);
+    EXPECT_TRUE(queue.isComplete(a));
+    EXPECT_TRUE(queue.isComplete(b));
+    EXPECT_FALSE(queue.isComplete(c));
+
+    // The freed ring restarts at the front.
+    ASSERT_TRUE(queue.flush());
+    ASSERT_EQ(cmdBuf.copyBufferSrcOffsets.size(), 3u);
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets[0], 0u);
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets[1], 112u);
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets[2], 0u);
+
+    // Retire only what the GPU reports as done.
+    queue.retire();
+    EXPECT_FALSE(queue.isComplete(c));
+    render.asyncCompleted = render.asyncSubmits;
+    queue.retire();
+    EXPECT_TRUE(queue.isComplete(c));
+
+    // With only the older batch retired, the next slice wraps to the front
+    // while the newer one is still live; once the ring is full it stalls.
+    const GpuUploadTicket d = queue.uploadBuffer(&dst, 0, chunk);
+    ASSERT_TRUE(queue.flush());
+    const GpuUploadTicket e = queue.uploadBuffer(&dst, 100, chunk);
+    ASSERT_TRUE(queue.flush());
+    render.asyncCompleted = render.asyncSubmits - 1;
+    queue.retire();
+    EXPECT_TRUE(queue.isComplete(d));
+    EXPECT_FALSE(queue.isComplete(e));
+
+    ASSERT_TRUE(queue.uploadBuffer(&dst, 200, chunk).valid());
+    EXPECT_EQ(queue.getStats().stalls, 1u);
+    ASSERT_TRUE(queue.flush());
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets.back(), 0u);
+
+    ASSERT_TRUE(queue.uploadBuffer(&dst, 300, std::span(chunk).first(16)).valid());
+    EXPECT_EQ(queue.getStats().stalls, 2u);
+    EXPECT_TRUE(queue.isComplete(e));
+    ASSERT_TRUE(queue.flush());
+}
+
+TEST(TextureUploadServiceTest, UploadQueueGivesLargeUploadsDedicatedStaging)
+{
+    RecordingCommandBuffer cmdBuf;
+    UploadTestFactory      factory;
+    UploadTestRender       render;
+    render.recorded = &cmdBuf;
+    GpuUploadQueue queue(render, factory, GpuUploadQueue::Config{.ringBytes = 256});
+
+    SpecStagingBuffer            dst(1024);
+    const std::vector<std::byte> large(200, std::byte{4});
+    ASSERT_TRUE(queue.uploadBuffer(&dst, 0, large).valid());
+    ASSERT_EQ(factory.buffers.size(), 1u);
+    EXPECT_EQ(factory.buffers[0]->contents, large);
+    EXPECT_EQ(queue.getStats().dedicatedUploads, 1u);
+
+    ASSERT_TRUE(queue.flush());
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets.size(), 1u);
+    EXPECT_EQ(queue.getStats().stalls, 0u);
+}
+
+TEST(TextureUploadServiceTest, UploadQueueForgetDropsPendingCopies)
+{
+    RecordingCommandBuffer cmdBuf;
+    UploadTestFactory      factory;
+    UploadTestRender       render;
+    render.recorded = &cmdBuf;
+    GpuUploadQueue queue(render, factory, GpuUploadQueue::Config{.ringBytes = 256});
+
+    const std::vector<std::byte> chunk(32, std::byte{5});
+    {
+        SpecStagingBuffer doomed(64);
+        ASSERT_TRUE(queue.uploadBuffer(&doomed, 0, chunk).valid());
+        EXPECT_FALSE(queue.forget(&doomed, [] {}));
+    }
+    SpecStagingBuffer kept(64);
+    ASSERT_TRUE(queue.uploadBuffer(&kept, 0, chunk).valid());
+
+    ASSERT_TRUE(queue.flush());
+    ASSERT_EQ(cmdBuf.copyBufferSrcOffsets.size(), 1u);
+    EXPECT_EQ(cmdBuf.copyBufferSrcOffsets[0], 32u);
+}
+
+TEST(TextureUploadServiceTest, UploadQueueDefersReleaseOfInFlightDestinations)
+{
+    RecordingCommandBuffer cmdBuf;
+    UploadTestFactory      factory;
+    UploadTestRender       render;
+    render.recorded         = &cmdBuf;
+    render.bGpuAutoComplete = false;
+    GpuUploadQueue queue(render, factory, GpuUploadQueue::Config{.ringBytes = 256});
+
+    const std::vector<std::byte> chunk(32, std::byte{6});
+    SpecStagingBuffer            dst(64);
+    ASSERT_TRUE(queue.uploadBuffer(&dst, 0, chunk).valid());
+    ASSERT_TRUE(queue.flush());
+
+    // The copy is submitted but not finished: the memory must outlive it.
+    bool bReleased = false;
+    EXPECT_TRUE(queue.forget(&dst, [&bReleased] { bReleased = true; }));
+    queue.retire();
+    EXPECT_FALSE(bReleased);
+
+    render.asyncCompleted = 1;
+    queue.retire();
+    EXPECT_TRUE(bReleased);
+    EXPECT_FALSE(queue.forget(&dst, [] {}));
+}
+
 } // namespace ya
@@ -0,0 +1,196 @@
+#include "ECS/Systems/TransformSystem.h"
+#include "Scene/Core/Scene.h"
+#include "Scene3D/Node3D.h"
+#include "Scene3D/TransformComponent.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace ya
+{
+
+namespace
+{
+
+/**
+ * Node layout of a large imported glTF: skinned characters (deep bone
+ * chains with limbs) plus architecture (shallow groups with many leaves).
+ */
+struct ImportedHierarchy
+{
+    std::vector<Node3D*> characterRoots;
+    std::vector<Node3D*> nodes;
+};
+
+ImportedHierarchy buildImportedHierarchy(Scene& scene, uint32_t characters, uint32_t buildings, uint32_t seed)
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> angle(-30.0f, 30.0f);
+
+    ImportedHierarchy hierarchy;
+    auto addNode = [&](const char* name, Node* parent) {
+        Node3D* node = scene.createNode3D(name, parent);
+        auto*   tc   = node->getTransformComponent();
+        tc->setPosition({offset(rng), offset(rng), offset(rng)});
+        tc->setRotation({angle(rng), angle(rng), angle(rng)});
+        hierarchy.nodes.push_back(node);
+        return node;
+    };
+
+    // ~30-deep spine with four 12-bone limbs and fingers on the hands.
+    for (uint32_t c = 0; c < characters; ++c) {
+        Node3D* root = addNode("Armature", nullptr);
+        hierarchy.characterRoots.push_back(root);
+        Node* spine = root;
+        for (int bone = 0; bone < 30; ++bone) {
+            spine = addNode("Spine", spine);
+            if (bone == 20 || bone == 10) {
+                for (int limb = 0; limb < 2; ++limb) {
+                    Node* segment = spine;
+                    for (int s = 0; s < 12; ++s) {
+                        segment = addNode("Limb", segment);
+                    }
+                    for (int finger = 0; finger < 5; ++finger) {
+                        Node* joint = segment;
+                        for (int s = 0; s < 3; ++s) {
+                            joint = addNode("Finger", joint);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Buildings: floors of props under one group each.
+    for (uint32_t b = 0; b < buildings; ++b) {
+        Node3D* building = addNode("Building", nullptr);
+        for (int floor = 0; floor < 8; ++floor) {
+            Node3D* level = addNode("Floor", building);
+            for (int prop = 0; prop < 24; ++prop) {
+                addNode("Prop", level);
+            }
+        }
+    }
+    return hierarchy;
+}
+
+std::vector<glm::mat4> snapshotWorld(const ImportedHierarchy& hierarchy)
+{
+    std::vector<glm::mat4> world;
+    world.reserve(hierarchy.nodes.size());
+    for (Node3D* node : hierarchy.nodes) {
+        world.push_back(node->getTransformComponent()->getWorldMatrix());
+    }
+    return world;
+}
+
+void markAllDirty(const ImportedHierarchy& hierarchy)
+{
+    for (Node3D* node : hierarchy.nodes) {
+        node->getTransformComponent()->markDirty();
+    }
+}
+
+void expectNearMatrices(const std::vector<glm::mat4>& a, const std::vector<glm::mat4>& b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                ASSERT_NEAR(a[i][c][r], b[i][c][r], 1e-3f) << "node " << i;
+            }
+        }
+    }
+}
+
+TransformSystem makeSystem(Scene& scene, TransformSystem::EUpdateMode mode)
+{
+    TransformSystem system;
+    system.setSceneProvider([&scene]() { return &scene; });
+    system.setUpdateMode(mode);
+    return system;
+}
+
+} // namespace
+
+TEST(TransformSystemTest, FlattenedMatchesRecursive)
+{
+    Scene      scene("TransformFlatten");
+    const auto hierarchy = buildImportedHierarchy(scene, 4, 4, 1);
+
+    auto recursive = makeSystem(scene, TransformSystem::EUpdateMode::Recursive);
+    recursive.onUpdate(0.0f);
+    const auto expected = snapshotWorld(hierarchy);
+
+    markAllDirty(hierarchy);
+    auto flattened = makeSystem(scene, TransformSystem::EUpdateMode::Flattened);
+    flattened.onUpdate(0.0f);
+    expectNearMatrices(snapshotWorld(hierarchy), expected);
+
+    const auto& stats = flattened.getFlatHierarchyStats();
+    EXPECT_EQ(stats.nodeCount, hierarchy.nodes.size() + 1); // + scene root
+    EXPECT_EQ(stats.updatedCount, hierarchy.nodes.size());
+    EXPECT_GT(stats.levelCount, 30u);
+
+    // Nothing dirty: a second update touches no matrix and does not rebuild.
+    flattened.onUpdate(0.0f);
+    EXPECT_EQ(flattened.getFlatHierarchyStats().updatedCount, 0u);
+    EXPECT_EQ(flattened.getFlatHierarchyStats().rebuildCount, 1u);
+}
+
+TEST(TransformSystemTest, FlattenedFollowsEditsAndReparent)
+{
+    Scene      scene("TransformFlattenEdits");
+    const auto hierarchy = buildImportedHierarchy(scene, 2, 1, 2);
+    auto       flattened = makeSystem(scene, TransformSystem::EUpdateMode::Flattened);
+    flattened.onUpdate(0.0f);
+
+    // Moving a character root re-evaluates its whole subtree.
+    Node3D* character = hierarchy.characterRoots[0];
+    character->getTransformComponent()->setPosition({10.0f, 0.0f, 0.0f});
+    flattened.onUpdate(0.0f);
+    EXPECT_GT(flattened.getFlatHierarchyStats().updatedCount, 100u);
+
+    // Gizmo-style world write outside the system is picked up by children.
+    Node3D* bone = static_cast<Node3D*>(character->getChildren()[0]);
+    TransformSystem::setWorldPosition(bone->getTransformComponent(), {0.0f, 5.0f, 0.0f});
+    flattened.onUpdate(0.0f);
+
+    // Reparent one character under the other: the arrays are rebuilt.
+    Node3D* other = hierarchy.characterRoots[1];
+    other->setParent(character);
+    flattened.onUpdate(0.0f);
+    EXPECT_EQ(flattened.getFlatHierarchyStats().rebuildCount, 2u);
+
+    // Cross-check every node against the recursive path.
+    const auto actual = snapshotWorld(hierarchy);
+    markAllDirty(hierarchy);
+    auto recursive = makeSystem(scene, TransformSystem::EUpdateMode::Recursive);
+    recursive.onUpdate(0.0f);
+    expectNearMatrices(actual, snapshotWorld(hierarchy));
+}
+
+TEST(TransformSystemTest, FlattenedIgnoresEditsToOtherScenes)
+{
+    Scene      scene("TransformFlattenOwn");
+    Scene      other("TransformFlattenOther");
+    const auto hierarchy      = buildImportedHierarchy(scene, 1, 1, 3);
+    const auto otherHierarchy = buildImportedHierarchy(other, 2, 0, 4);
+    auto       flattened      = makeSystem(scene, TransformSystem::EUpdateMode::Flattened);
+    flattened.onUpdate(0.0f);
+    ASSERT_EQ(flattened.getFlatHierarchyStats().rebuildCount, 1u);
+
+    otherHierarchy.characterRoots[1]->setParent(otherHierarchy.characterRoots[0]);
+    otherHierarchy.characterRoots[1]->removeFromParent();
+    flattened.onUpdate(0.0f);
+    EXPECT_EQ(flattened.getFlatHierarchyStats().rebuildCount, 1u);
+
+    hierarchy.characterRoots[0]->removeFromParent();
+    flattened.onUpdate(0.0f);
+    EXPECT_EQ(flattened.getFlatHierarchyStats().rebuildCount, 2u);
+}
+
+} // namespace ya
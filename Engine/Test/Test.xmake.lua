@@ -27,6 +27,23 @@ if get_config("ya_profile") ~= "gui" then
         end
     end
 
+    -- Wall-clock benchmarks: opt-in, kept out of the unit suite. They print
+    -- timings and only assert correctness, so they never gate CI.
+    target("ya-benchmark")
+    do
+        set_kind("binary")
+        set_default(false)
+        add_files("./Benchmark/**.cpp", "./Source/TestEntry.cpp")
+        add_includedirs("./Source") -- shared test helpers (JobSystemTestScope.h)
+
+        add_deps("ya-engine")
+        add_packages("gtest")
+
+        if is_plat("windows") then
+            add_cxxflags("/utf-8")
+        end
+    end
+
     -- Minimal closure targets: fast per-module regression gates.
     target("ya-ecs-core-test")
     do
@@ -41,7 +58,10 @@ if get_config("ya_profile") ~= "gui" then
         set_kind("binary")
         add_files("./Source/TestEntry.cpp",
                   "./Source/PathRegistryTest.cpp",
-                  "./Source/ResourceTableTest.cpp")
+                  "./Source/ResourceTableTest.cpp",
+                  "./Source/CookedModelTest.cpp",
+                  "./Source/DerivedDataCacheTest.cpp",
+                  "./Source/MeshOptimizerTest.cpp")
         add_deps("ya-resource-core", "ya-foundation-core")
         add_packages("gtest")
     end
@@ -16,7 +16,7 @@ run_engine_shared() {
     # xmake b accepts one target per invocation (xmake 3.0.8).
     for t in ya-testing ya-gui-closure-test ya-gui-widgets-test ya-ecs-core-test ya-resource-core-test \
              ya-resource-runtime-closure-test ya-rhi-vulkan-smoke ya-render-3d-test \
-             ya-gui-workbench-workspace-test; do
+             ya-gui-workbench-workspace-test ya-benchmark; do
         xmake b "$t"
     done
     xmake r ya-testing